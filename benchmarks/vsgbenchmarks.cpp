@@ -0,0 +1,317 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+// vsgbenchmarks - micro/meso benchmarks of the VSG's CPU hot paths, built via the VSG_BUILD_BENCHMARKS
+// CMake option. All benchmarks are host side only so no Vulkan device is required, making the suite
+// suitable for CI regression tracking. Use --csv or --json for machine readable output.
+
+#include <vsg/all.h>
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct Result
+{
+    std::string name;
+    uint64_t iterations = 0;
+    uint64_t unitsPerIteration = 1;
+    double totalSeconds = 0.0;
+
+    double nanosecondsPerUnit() const { return totalSeconds * 1e9 / static_cast<double>(iterations * unitsPerIteration); }
+};
+
+template<class Func>
+Result run(const std::string& name, uint64_t iterations, uint64_t unitsPerIteration, Func func)
+{
+    // warm up pass so first touch page faults and lazy initialization don't skew the timings
+    func();
+
+    auto start = vsg::clock::now();
+    for (uint64_t i = 0; i < iterations; ++i) func();
+    auto end = vsg::clock::now();
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.unitsPerIteration = unitsPerIteration;
+    result.totalSeconds = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+// build a synthetic scene graph for traversal benchmarks - alternating Group/MatrixTransform interior
+// nodes with CullNode wrapped leaves so the traversal exercises the matrix stack and culling paths.
+vsg::ref_ptr<vsg::Node> createSyntheticGraph(uint32_t depth, uint32_t childrenPerNode, uint32_t level = 0)
+{
+    if (depth == 0)
+    {
+        vsg::dsphere bound(vsg::dvec3(0.0, 0.0, 0.0), 1.0);
+        return vsg::CullNode::create(bound, vsg::Node::create());
+    }
+
+    vsg::ref_ptr<vsg::Group> group;
+    if ((level % 3) == 1)
+    {
+        auto transform = vsg::MatrixTransform::create();
+        transform->matrix = vsg::translate(1.0, 0.0, static_cast<double>(level));
+        group = transform;
+    }
+    else
+    {
+        group = vsg::Group::create();
+    }
+
+    for (uint32_t i = 0; i < childrenPerNode; ++i)
+    {
+        group->addChild(createSyntheticGraph(depth - 1, childrenPerNode, level + 1));
+    }
+    return group;
+}
+
+uint32_t countNodes(const vsg::Node* node)
+{
+    struct Counter : public vsg::ConstVisitor
+    {
+        uint32_t count = 0;
+        void apply(const vsg::Object& object) override
+        {
+            ++count;
+            object.traverse(*this);
+        }
+    } counter;
+
+    node->accept(counter);
+    return counter.count;
+}
+
+Result benchmarkRecordTraversal(uint32_t depth, uint32_t childrenPerNode, uint64_t iterations)
+{
+    auto graph = createSyntheticGraph(depth, childrenPerNode);
+    auto numNodes = countNodes(graph.get());
+
+    auto recordTraversal = vsg::RecordTraversal::create();
+    auto projection = vsg::perspective(vsg::radians(60.0), 1.5, 1.0, 1000.0);
+    auto view = vsg::lookAt(vsg::dvec3(0.0, -10.0, 0.0), vsg::dvec3(0.0, 0.0, 0.0), vsg::dvec3(0.0, 0.0, 1.0));
+    recordTraversal->getState()->setProjectionAndViewMatrix(projection, view);
+
+    auto result = run("RecordTraversal", iterations, numNodes, [&]() {
+        // reclaim per-frame transient allocations the same way CommandGraph::record() does
+        recordTraversal->regionsOfInterest.clear();
+        recordTraversal->regionsOfInterest.shrink_to_fit();
+        recordTraversal->frameAllocator->release();
+        graph->accept(*recordTraversal);
+    });
+    return result;
+}
+
+Result benchmarkAllocator(uint64_t iterations, size_t numSlots)
+{
+    // mixed size alloc/free churn with a ring of live allocations so the allocator's
+    // free lists see interleaved allocation lifetimes rather than pure LIFO behaviour.
+    std::vector<std::pair<void*, size_t>> slots(numSlots, {nullptr, 0});
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<size_t> sizes(16, 1024);
+
+    size_t next = 0;
+    auto result = run("Allocator alloc/free", iterations, 1, [&]() {
+        auto& slot = slots[next];
+        if (slot.first) vsg::deallocate(slot.first, slot.second);
+        slot.second = sizes(rng);
+        slot.first = vsg::allocate(slot.second, vsg::ALLOCATOR_AFFINITY_NODES);
+        next = (next + 1) % slots.size();
+    });
+
+    for (auto& slot : slots)
+    {
+        if (slot.first) vsg::deallocate(slot.first, slot.second);
+    }
+    return result;
+}
+
+Result benchmarkBinaryInput(uint64_t iterations)
+{
+    // serialize a representative object graph once, then measure binary load throughput from memory
+    auto objects = vsg::Objects::create();
+    objects->addChild(createSyntheticGraph(4, 4));
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        auto array = vsg::vec3Array::create(4096);
+        for (auto& v : *array) v.set(1.0f, 2.0f, 3.0f);
+        objects->addChild(array);
+    }
+
+    auto options = vsg::Options::create();
+    options->extensionHint = ".vsgb";
+
+    vsg::VSG io;
+    std::ostringstream ostr(std::ios::binary);
+    io.write(objects.get(), ostr, options);
+    auto buffer = ostr.str();
+
+    auto result = run("BinaryInput load", iterations, buffer.size(), [&]() {
+        std::istringstream istr(buffer, std::ios::binary);
+        auto loaded = io.read(istr, options);
+        if (!loaded) std::cerr << "BinaryInput load failed." << std::endl;
+    });
+    result.name = "BinaryInput load (ns/byte)";
+    return result;
+}
+
+Result benchmarkSharedObjects(uint64_t iterations, uint32_t numThreads, uint32_t numDistinct)
+{
+    auto sharedObjects = vsg::SharedObjects::create();
+
+    std::vector<std::string> values(numDistinct);
+    for (uint32_t i = 0; i < numDistinct; ++i) values[i] = "shared_value_" + std::to_string(i);
+
+    auto result = run("SharedObjects contention", 1, iterations * numThreads, [&]() {
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        for (uint32_t t = 0; t < numThreads; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    auto value = vsg::stringValue::create(values[(i + t) % values.size()]);
+                    sharedObjects->share(value);
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+    });
+    result.name = "SharedObjects contention (" + std::to_string(numThreads) + " threads)";
+    return result;
+}
+
+Result benchmarkMat4Multiply(uint64_t iterations)
+{
+    vsg::dmat4 accumulated;
+    vsg::dmat4 step = vsg::rotate(0.001, 0.0, 0.0, 1.0) * vsg::translate(0.001, 0.002, 0.003);
+
+    auto result = run("dmat4 multiply", iterations, 1, [&]() {
+        accumulated = accumulated * step;
+    });
+
+    // fold the accumulated matrix into the output stream so the multiplies can't be optimized away
+    volatile double sink = accumulated[3][0];
+    (void)sink;
+    return result;
+}
+
+Result benchmarkBinSort(vsg::Bin::SortOrder sortOrder, const std::string& name, uint64_t iterations, uint32_t numElements)
+{
+    auto recordTraversal = vsg::RecordTraversal::create();
+    auto projection = vsg::perspective(vsg::radians(60.0), 1.5, 1.0, 1000.0);
+    auto view = vsg::lookAt(vsg::dvec3(0.0, -10.0, 0.0), vsg::dvec3(0.0, 0.0, 0.0), vsg::dvec3(0.0, 0.0, 1.0));
+    recordTraversal->getState()->setProjectionAndViewMatrix(projection, view);
+
+    auto bin = vsg::Bin::create(0, sortOrder);
+    auto leaf = vsg::Node::create();
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> depths(0.0, 1000.0);
+    std::vector<double> values(numElements);
+    for (auto& value : values) value = depths(rng);
+
+    auto state = recordTraversal->getState();
+    auto result = run("Bin sort", iterations, numElements, [&]() {
+        bin->clear();
+        for (auto value : values) bin->add(state, value, leaf.get());
+        bin->traverse(*recordTraversal);
+    });
+    result.name = "Bin sort " + name;
+    return result;
+}
+
+void report(const std::vector<Result>& results, bool csv, bool json)
+{
+    if (json)
+    {
+        std::cout << "[\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            auto& result = results[i];
+            std::cout << "  { \"name\": \"" << result.name << "\", \"iterations\": " << result.iterations
+                      << ", \"units_per_iteration\": " << result.unitsPerIteration
+                      << ", \"total_seconds\": " << result.totalSeconds
+                      << ", \"ns_per_unit\": " << result.nanosecondsPerUnit() << " }"
+                      << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        std::cout << "]" << std::endl;
+        return;
+    }
+
+    if (csv)
+    {
+        std::cout << "name,iterations,units_per_iteration,total_seconds,ns_per_unit\n";
+        for (auto& result : results)
+        {
+            std::cout << "\"" << result.name << "\"," << result.iterations << "," << result.unitsPerIteration
+                      << "," << result.totalSeconds << "," << result.nanosecondsPerUnit() << "\n";
+        }
+        return;
+    }
+
+    for (auto& result : results)
+    {
+        std::cout << std::left << std::setw(48) << result.name
+                  << std::right << std::setw(12) << std::fixed << std::setprecision(2) << result.nanosecondsPerUnit() << " ns/unit"
+                  << "   (total " << std::setprecision(3) << result.totalSeconds << "s over " << result.iterations << " iterations)" << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    vsg::CommandLine arguments(&argc, argv);
+
+    if (arguments.read({"-h", "--help"}))
+    {
+        std::cout << "vsgbenchmarks - benchmarks of VSG CPU hot paths.\n"
+                  << "  --depth <n>      depth of the synthetic scene graph (default 6)\n"
+                  << "  --children <n>   children per interior node (default 4)\n"
+                  << "  --iterations <n> base iteration count (default 100)\n"
+                  << "  --threads <n>    threads for the SharedObjects benchmark (default 4)\n"
+                  << "  --csv            machine readable CSV output\n"
+                  << "  --json           machine readable JSON output\n";
+        return 0;
+    }
+
+    uint32_t depth = arguments.value<uint32_t>(6, "--depth");
+    uint32_t childrenPerNode = arguments.value<uint32_t>(4, "--children");
+    uint64_t iterations = arguments.value<uint64_t>(100, "--iterations");
+    uint32_t numThreads = arguments.value<uint32_t>(4, "--threads");
+    bool csv = arguments.read("--csv");
+    bool json = arguments.read("--json");
+
+    if (arguments.errors()) return arguments.writeErrorMessages(std::cerr);
+
+    std::vector<Result> results;
+    results.push_back(benchmarkRecordTraversal(depth, childrenPerNode, iterations));
+    results.push_back(benchmarkAllocator(iterations * 10000, 1024));
+    results.push_back(benchmarkBinaryInput(std::max<uint64_t>(iterations / 10, 1)));
+    results.push_back(benchmarkSharedObjects(iterations * 100, numThreads, 64));
+    results.push_back(benchmarkMat4Multiply(iterations * 100000));
+    results.push_back(benchmarkBinSort(vsg::Bin::ASCENDING, "ASCENDING", iterations, 10000));
+    results.push_back(benchmarkBinSort(vsg::Bin::ASCENDING_RADIX, "ASCENDING_RADIX", iterations, 10000));
+    results.push_back(benchmarkBinSort(vsg::Bin::STATE_SORT, "STATE_SORT", iterations, 10000));
+
+    report(results, csv, json);
+    return 0;
+}
@@ -15,26 +15,33 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 // Core header files
 #include <vsg/core/Allocator.h>
 #include <vsg/core/Array.h>
+#include <vsg/core/ArraySoA.h>
 #include <vsg/core/Array2D.h>
 #include <vsg/core/Array3D.h>
 #include <vsg/core/Auxiliary.h>
 #include <vsg/core/ConstVisitor.h>
 #include <vsg/core/Data.h>
 #include <vsg/core/Exception.h>
+#include <vsg/core/FrameAllocator.h>
 #include <vsg/core/Export.h>
 #include <vsg/core/External.h>
 #include <vsg/core/Inherit.h>
 #include <vsg/core/Mask.h>
 #include <vsg/core/MemorySlots.h>
 #include <vsg/core/Object.h>
+#include <vsg/core/ObjectPool.h>
 #include <vsg/core/Objects.h>
 #include <vsg/core/ScratchMemory.h>
+#include <vsg/core/Token.h>
+#include <vsg/core/TypeDispatcher.h>
 #include <vsg/core/Value.h>
 #include <vsg/core/Version.h>
 #include <vsg/core/Visitor.h>
 #include <vsg/core/compare.h>
 #include <vsg/core/contains.h>
 #include <vsg/core/observer_ptr.h>
+#include <vsg/core/parallel.h>
+#include <vsg/core/small_vector.h>
 #include <vsg/core/ref_ptr.h>
 #include <vsg/core/type_name.h>
 #include <vsg/core/visit.h>
@@ -46,6 +53,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/maths/common.h>
 #include <vsg/maths/mat3.h>
 #include <vsg/maths/mat4.h>
+#include <vsg/maths/packed.h>
 #include <vsg/maths/plane.h>
 #include <vsg/maths/quat.h>
 #include <vsg/maths/sample.h>
@@ -61,17 +69,25 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/Compilable.h>
 #include <vsg/nodes/CullGroup.h>
 #include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/MaskGroup.h>
+#include <vsg/nodes/OcclusionQueryNode.h>
 #include <vsg/nodes/DepthSorted.h>
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/Group.h>
+#include <vsg/nodes/IndirectDrawCollection.h>
 #include <vsg/nodes/InstrumentationNode.h>
+#include <vsg/nodes/ImpostorLOD.h>
 #include <vsg/nodes/LOD.h>
 #include <vsg/nodes/Layer.h>
+#include <vsg/nodes/LazyLoadNode.h>
 #include <vsg/nodes/MatrixTransform.h>
 #include <vsg/nodes/Node.h>
 #include <vsg/nodes/PagedLOD.h>
+#include <vsg/nodes/ParticleSystem.h>
 #include <vsg/nodes/QuadGroup.h>
+#include <vsg/nodes/CompiledDrawList.h>
 #include <vsg/nodes/RegionOfInterest.h>
+#include <vsg/nodes/SpatialIndexGroup.h>
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/nodes/Switch.h>
 #include <vsg/nodes/TileDatabase.h>
@@ -83,7 +99,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/animation/Animation.h>
 #include <vsg/animation/AnimationGroup.h>
 #include <vsg/animation/AnimationManager.h>
+#include <vsg/animation/AnimationPhaseBuckets.h>
 #include <vsg/animation/CameraAnimation.h>
+#include <vsg/animation/ComputeSkinning.h>
 #include <vsg/animation/FindAnimations.h>
 #include <vsg/animation/Joint.h>
 #include <vsg/animation/JointSampler.h>
@@ -97,6 +115,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/lighting/Light.h>
 #include <vsg/lighting/PercentageCloserSoftShadows.h>
 #include <vsg/lighting/PointLight.h>
+#include <vsg/lighting/RayTracedShadows.h>
 #include <vsg/lighting/ShadowSettings.h>
 #include <vsg/lighting/SoftShadows.h>
 #include <vsg/lighting/SpotLight.h>
@@ -106,6 +125,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/commands/BindIndexBuffer.h>
 #include <vsg/commands/BindVertexBuffers.h>
 #include <vsg/commands/BlitImage.h>
+#include <vsg/commands/CachedCommands.h>
 #include <vsg/commands/ClearAttachments.h>
 #include <vsg/commands/ClearImage.h>
 #include <vsg/commands/Command.h>
@@ -125,6 +145,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/commands/EndQuery.h>
 #include <vsg/commands/Event.h>
 #include <vsg/commands/ExecuteCommands.h>
+#include <vsg/commands/FillBuffer.h>
 #include <vsg/commands/NextSubPass.h>
 #include <vsg/commands/PipelineBarrier.h>
 #include <vsg/commands/ResetQueryPool.h>
@@ -152,6 +173,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/DescriptorSetLayout.h>
 #include <vsg/state/DescriptorTexelBufferView.h>
 #include <vsg/state/DynamicState.h>
+#include <vsg/state/DynamicUniformRing.h>
 #include <vsg/state/GraphicsPipeline.h>
 #include <vsg/state/Image.h>
 #include <vsg/state/ImageInfo.h>
@@ -160,6 +182,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/MultisampleState.h>
 #include <vsg/state/PipelineLayout.h>
 #include <vsg/state/PushConstants.h>
+#include <vsg/state/PushDescriptorSet.h>
 #include <vsg/state/QueryPool.h>
 #include <vsg/state/RasterizationState.h>
 #include <vsg/state/ResourceHints.h>
@@ -182,11 +205,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/threading/Latch.h>
 #include <vsg/threading/OperationQueue.h>
 #include <vsg/threading/OperationThreads.h>
+#include <vsg/threading/TaskGraph.h>
 #include <vsg/threading/atomics.h>
 
 // User Interface abstraction header files
 #include <vsg/ui/ApplicationEvent.h>
 #include <vsg/ui/CollectEvents.h>
+#include <vsg/ui/EventPool.h>
 #include <vsg/ui/FrameStamp.h>
 #include <vsg/ui/KeyEvent.h>
 #include <vsg/ui/Keyboard.h>
@@ -201,21 +226,31 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/ui/WindowEvent.h>
 
 // Application header files
+#include <vsg/app/AsyncStartup.h>
 #include <vsg/app/Camera.h>
 #include <vsg/app/CloseHandler.h>
 #include <vsg/app/CommandGraph.h>
 #include <vsg/app/CompileManager.h>
 #include <vsg/app/CompileTraversal.h>
+#include <vsg/app/DynamicResolution.h>
 #include <vsg/app/EllipsoidModel.h>
+#include <vsg/app/FrameGraph.h>
+#include <vsg/app/FramePacer.h>
+#include <vsg/app/LODPolicy.h>
+#include <vsg/app/OffscreenRenderer.h>
+#include <vsg/app/OrderIndependentTransparency.h>
 #include <vsg/app/Presentation.h>
 #include <vsg/app/ProjectionMatrix.h>
 #include <vsg/app/RecordAndSubmitTask.h>
 #include <vsg/app/RecordTraversal.h>
 #include <vsg/app/RenderGraph.h>
+#include <vsg/app/ReplayBenchmark.h>
 #include <vsg/app/SecondaryCommandGraph.h>
 #include <vsg/app/Trackball.h>
 #include <vsg/app/TransferTask.h>
+#include <vsg/app/TransientAttachments.h>
 #include <vsg/app/UpdateOperations.h>
+#include <vsg/app/UpdateThread.h>
 #include <vsg/app/View.h>
 #include <vsg/app/ViewMatrix.h>
 #include <vsg/app/Viewer.h>
@@ -230,7 +265,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/CommandPool.h>
 #include <vsg/vk/Context.h>
 #include <vsg/vk/DescriptorPool.h>
+#include <vsg/vk/DestructionQueue.h>
 #include <vsg/vk/Device.h>
+#include <vsg/vk/DeviceDispatch.h>
 #include <vsg/vk/DeviceExtensions.h>
 #include <vsg/vk/DeviceFeatures.h>
 #include <vsg/vk/DeviceMemory.h>
@@ -240,31 +277,43 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/InstanceExtensions.h>
 #include <vsg/vk/MemoryBufferPools.h>
 #include <vsg/vk/PhysicalDevice.h>
+#include <vsg/vk/PipelineCache.h>
 #include <vsg/vk/Queue.h>
 #include <vsg/vk/RenderPass.h>
 #include <vsg/vk/ResourceRequirements.h>
 #include <vsg/vk/Semaphore.h>
+#include <vsg/vk/SparseImageManager.h>
+#include <vsg/vk/TimelineSemaphore.h>
 #include <vsg/vk/State.h>
 #include <vsg/vk/SubmitCommands.h>
 #include <vsg/vk/Surface.h>
 #include <vsg/vk/Swapchain.h>
+#include <vsg/vk/SyncObjectPool.h>
 #include <vsg/vk/vk_buffer.h>
 #include <vsg/vk/vulkan.h>
 
 // Input/Output header files
+#include <vsg/io/Archive.h>
 #include <vsg/io/AsciiInput.h>
 #include <vsg/io/AsciiOutput.h>
+#include <vsg/io/AsyncReader.h>
 #include <vsg/io/BinaryInput.h>
 #include <vsg/io/BinaryOutput.h>
+#include <vsg/io/CompressionCodec.h>
 #include <vsg/io/DatabasePager.h>
+#include <vsg/io/DirectoryCache.h>
 #include <vsg/io/FileSystem.h>
 #include <vsg/io/Input.h>
 #include <vsg/io/Logger.h>
+#include <vsg/io/MappedData.h>
+#include <vsg/io/MemoryBinaryInput.h>
+#include <vsg/io/ObjectCache.h>
 #include <vsg/io/ObjectFactory.h>
 #include <vsg/io/Options.h>
 #include <vsg/io/Output.h>
 #include <vsg/io/Path.h>
 #include <vsg/io/ReaderWriter.h>
+#include <vsg/io/RetainedTileCache.h>
 #include <vsg/io/VSG.h>
 #include <vsg/io/convert_utf.h>
 #include <vsg/io/glsl.h>
@@ -278,27 +327,51 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/write.h>
 
 // Utility header files
+#include <vsg/utils/BatchInstances.h>
+#include <vsg/utils/BindlessTextureArray.h>
 #include <vsg/utils/Builder.h>
 #include <vsg/utils/CommandLine.h>
+#include <vsg/utils/CompressTextures.h>
+#include <vsg/utils/CachedComputeBounds.h>
 #include <vsg/utils/ComputeBounds.h>
+#include <vsg/utils/ConsolidateGeometry.h>
 #include <vsg/utils/FindDynamicObjects.h>
+#include <vsg/utils/ComputeAggregateMasks.h>
+#include <vsg/utils/FlattenStaticTransforms.h>
+#include <vsg/utils/FrameStatsCollector.h>
 #include <vsg/utils/GpuAnnotation.h>
+#include <vsg/utils/GpuPicker.h>
+#include <vsg/utils/GpuStatsCollector.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
+#include <vsg/utils/ImpostorBaker.h>
 #include <vsg/utils/Instrumentation.h>
 #include <vsg/utils/Intersector.h>
 #include <vsg/utils/LineSegmentIntersector.h>
+#include <vsg/utils/MemoryBudgetMonitor.h>
+#include <vsg/utils/OptimizeMeshes.h>
+#include <vsg/utils/PackAttributes.h>
+#include <vsg/utils/ParallelComputeBounds.h>
+#include <vsg/utils/ParallelLineSegmentIntersector.h>
 #include <vsg/utils/LoadPagedLOD.h>
+#include <vsg/utils/PolytopeIntersector.h>
+#include <vsg/utils/PrefetchPagedLOD.h>
 #include <vsg/utils/Profiler.h>
 #include <vsg/utils/PropagateDynamicObjects.h>
+#include <vsg/utils/SceneAnalysis.h>
 #include <vsg/utils/ShaderCompiler.h>
 #include <vsg/utils/ShaderSet.h>
+#include <vsg/utils/ShaderSetWarmup.h>
 #include <vsg/utils/SharedObjects.h>
+#include <vsg/utils/SphereIntersector.h>
+#include <vsg/utils/TriangleBVH.h>
 
 // Text header files
 #include <vsg/text/CpuLayoutTechnique.h>
 #include <vsg/text/Font.h>
+#include <vsg/text/FontAtlas.h>
 #include <vsg/text/GlyphMetrics.h>
 #include <vsg/text/GpuLayoutTechnique.h>
+#include <vsg/text/SignedDistanceField.h>
 #include <vsg/text/StandardLayout.h>
 #include <vsg/text/Text.h>
 #include <vsg/text/TextGroup.h>
@@ -310,6 +383,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/raytracing/AccelerationStructure.h>
 #include <vsg/raytracing/BottomLevelAccelerationStructure.h>
 #include <vsg/raytracing/BuildAccelerationStructureTraversal.h>
+#include <vsg/raytracing/CompactAccelerationStructures.h>
 #include <vsg/raytracing/DescriptorAccelerationStructure.h>
 #include <vsg/raytracing/RayTracingPipeline.h>
 #include <vsg/raytracing/RayTracingShaderGroup.h>
@@ -320,3 +394,5 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/meshshaders/DrawMeshTasks.h>
 #include <vsg/meshshaders/DrawMeshTasksIndirect.h>
 #include <vsg/meshshaders/DrawMeshTasksIndirectCount.h>
+#include <vsg/meshshaders/MeshletDraw.h>
+#include <vsg/meshshaders/Meshlets.h>
@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/Group.h>
 #include <vsg/nodes/Transform.h>
 
+#include <atomic>
+
 namespace vsg
 {
 
@@ -28,6 +30,11 @@ namespace vsg
 
         Animations animations;
 
+        /// frame count of the last RecordTraversal that reached this group, i.e. the last frame it
+        /// survived culling. Maintained by RecordTraversal and read by AnimationManager's visibility
+        /// gating to pause updating animations belonging to off screen subgraphs.
+        mutable std::atomic_uint64_t lastRecordedFrameIndex{0};
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return AnimationGroup::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -13,9 +13,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/animation/AnimationGroup.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/ui/FrameStamp.h>
 #include <vsg/utils/Instrumentation.h>
 
+#include <map>
+
 namespace vsg
 {
 
@@ -30,6 +33,11 @@ namespace vsg
 
         ref_ptr<Instrumentation> instrumentation;
 
+        /// optional thread pool used by run() to update animations in parallel. Animations whose samplers
+        /// write to the same objects are grouped together and updated serially within a single operation,
+        /// so independent characters are spread across threads without racing on shared targets.
+        ref_ptr<OperationThreads> operationThreads;
+
         /// assign instrumentation if required
         virtual void assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation);
 
@@ -48,8 +56,29 @@ namespace vsg
         /// update all the animations being played, called automatically by Viewer::update()
         virtual void run(vsg::ref_ptr<vsg::FrameStamp> frameStamp);
 
+        /// update the animations across the operationThreads, called by run() when operationThreads are assigned
+        virtual void runParallel();
+
+        /// opt-in visibility driven update culling - collect the AnimationGroups in the subgraph and
+        /// gate their animations' updates on the cull results the record traversal already computes.
+        /// Animations whose AnimationGroup hasn't been reached by a record traversal for more than
+        /// visibilityLatency frames stop being advanced, and snap straight to the correct playback
+        /// position when the group reappears since position is computed from simulation time rather
+        /// than accumulated per update. Call again after structural changes to the subgraph; pass an
+        /// empty ref_ptr to disable the gating.
+        virtual void assignVisibilityGating(ref_ptr<Node> subgraph);
+
+        /// number of consecutive frames a gated AnimationGroup may go unrecorded before its animations
+        /// pause, allowing for in flight frames and multi view latency in the record stamps
+        uint64_t visibilityLatency = 2;
+
     protected:
+        /// return false when the animation belongs to a gated AnimationGroup that is currently culled
+        bool animationVisible(const Animation* animation) const;
+
         double _simulationTime = 0.0;
+        uint64_t _frameCount = 0;
+        std::map<const Animation*, ref_ptr<AnimationGroup>> _visibilityGroups;
     };
     VSG_type_name(vsg::AnimationManager);
 
@@ -0,0 +1,63 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/animation/Animation.h>
+
+namespace vsg
+{
+
+    class AnimationManager;
+
+    /// AnimationPhaseBuckets shares animation evaluation between instanced characters playing the same
+    /// clip. Instead of one full Animation graph per instance, instance phases are quantized into a fixed
+    /// number of buckets and the prototype Animation is cloned once per bucket, with the clone's keyframe
+    /// tracks shared rather than copied. Every instance assigned to a bucket renders from that bucket's
+    /// sampled outputs - typically the JointSampler's jointMatrices palette and skeleton - so keyframes are
+    /// evaluated once per bucket per frame and the cost scales with the bucket count, not the instance
+    /// count. The phase spread across buckets keeps a crowd from visibly stepping in unison.
+    class VSG_DECLSPEC AnimationPhaseBuckets : public Inherit<Object, AnimationPhaseBuckets>
+    {
+    public:
+        explicit AnimationPhaseBuckets(ref_ptr<Animation> in_prototype = {}, uint32_t in_numBuckets = 16);
+
+        /// the clip to share, its samplers and their target subgraph define what each bucket drives
+        ref_ptr<Animation> prototype;
+
+        /// number of quantized phase buckets the clip duration is divided into
+        uint32_t numBuckets = 16;
+
+        /// map a phase offset (seconds into the clip) to its bucket's Animation, cloning the prototype on
+        /// first use. Assign the returned bucket's sampled outputs to the instance's rendering subgraph.
+        ref_ptr<Animation> animationForPhase(double phase);
+
+        /// quantized phase offset that the bucket containing the specified phase plays at
+        double bucketPhase(double phase) const;
+
+        /// number of bucket Animations created so far
+        size_t numActiveBuckets() const;
+
+        /// play all the buckets created so far via the manager, each starting at its quantized phase offset
+        bool play(AnimationManager& manager);
+
+        /// stop all the buckets created so far
+        bool stop(AnimationManager& manager);
+
+    protected:
+        virtual ~AnimationPhaseBuckets();
+
+        std::vector<ref_ptr<Animation>> _buckets;
+    };
+    VSG_type_name(vsg::AnimationPhaseBuckets);
+
+} // namespace vsg
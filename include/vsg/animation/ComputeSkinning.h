@@ -0,0 +1,80 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Commands.h>
+#include <vsg/state/BufferInfo.h>
+#include <vsg/state/ShaderStage.h>
+
+namespace vsg
+{
+
+    /// ComputeSkinning builds a compute dispatch that skins a character's vertices and normals once per
+    /// frame, writing the results to device buffers that the render passes then consume as static vertex
+    /// data. Vertex shader skinning re-evaluates the joint palette for every view, so with shadow maps and
+    /// a depth pre-pass each character is skinned once per pass - a compute pre-pass skins it once.
+    ///
+    /// Usage: assign the source arrays, joint palette and a skinningShaderStage, call setup(), record this
+    /// node before the render graphs (e.g. at the start of the frame's first CommandGraph), and bind
+    /// skinnedVertices/skinnedNormals in the render geometry's BindVertexBuffers in place of the source
+    /// arrays, using a render ShaderSet without the skinning define.
+    ///
+    /// The skinning shader is supplied by the application as the built in ShaderSets bake skinning into
+    /// their vertex stages. Its descriptor set 0 must declare:
+    ///     binding 0 : uniform  - uint vertexCount
+    ///     binding 1 : storage  - source vertices, 3 floats per vertex (readonly)
+    ///     binding 2 : storage  - source normals, 3 floats per vertex (readonly)
+    ///     binding 3 : storage  - joint indices, vec4 per vertex (readonly)
+    ///     binding 4 : storage  - joint weights, vec4 per vertex (readonly)
+    ///     binding 5 : storage  - joint matrices, mat4 array updated per frame (readonly)
+    ///     binding 6 : storage  - skinned vertices, 3 floats per vertex (writeonly)
+    ///     binding 7 : storage  - skinned normals, 3 floats per vertex (writeonly)
+    /// For dual quaternion skinning supply a shader whose binding 5 takes the two vec4 per joint
+    /// palette filled in by JointSampler::jointDualQuaternions instead of the mat4 palette.
+    class VSG_DECLSPEC ComputeSkinning : public Inherit<Commands, ComputeSkinning>
+    {
+    public:
+        ComputeSkinning();
+
+        /// compute shader performing the skinning, with a descriptor set 0 matching the documented bindings
+        ref_ptr<ShaderStage> skinningShaderStage;
+
+        /// local_size_x of skinningShaderStage, used to size the dispatch
+        uint32_t workgroupSize = 64;
+
+        /// per vertex source data
+        ref_ptr<vec3Array> sourceVertices;
+        ref_ptr<vec3Array> sourceNormals;
+        ref_ptr<vec4Array> jointIndices;
+        ref_ptr<vec4Array> jointWeights;
+
+        /// joint palette updated each frame, typically the JointSampler::jointMatrices array
+        ref_ptr<mat4Array> jointMatrices;
+
+        /// skinned outputs created by setup(), allocated at compile with combined storage/vertex buffer
+        /// usage so they can be bound directly by the render geometry's BindVertexBuffers
+        ref_ptr<BufferInfo> skinnedVertices;
+        ref_ptr<BufferInfo> skinnedNormals;
+
+        /// build the bind/dispatch/barrier commands from the assigned inputs.
+        /// Requires skinningShaderStage and the source arrays, returns false when they are missing.
+        bool setup();
+
+        void compile(Context& context) override;
+
+    protected:
+        virtual ~ComputeSkinning();
+    };
+    VSG_type_name(vsg::ComputeSkinning);
+
+} // namespace vsg
@@ -29,6 +29,13 @@ namespace vsg
         std::vector<dmat4> offsetMatrices;
         ref_ptr<Node> subgraph;
 
+        /// optional dual quaternion palette for dual quaternion skinning, two vec4 per joint - the real
+        /// (rotation) part at index 2*joint and the dual (translation) part at 2*joint+1. When assigned
+        /// update() fills it alongside jointMatrices from the same accumulated transforms, for binding in
+        /// a dual quaternion skinning shader that avoids the volume loss of linear blend skinning at
+        /// equivalent cost. Scale in the joint transforms is ignored by the dual quaternion palette.
+        ref_ptr<vec4Array> jointDualQuaternions;
+
         void update(double time) override;
         double maxTime() const override;
 
@@ -45,6 +52,28 @@ namespace vsg
         void apply(Joint& joint) override;
 
         std::vector<dmat4> _matrixStack;
+
+    protected:
+        /// flattened skeleton representation - parent indices plus contiguous local/world matrix access -
+        /// evaluated by update() in a single linear pass rather than a per node virtual traversal.
+        /// Rebuilt automatically when the subgraph pointer changes, call invalidateFlattenedSkeleton()
+        /// after structural changes within the subgraph.
+        struct FlattenedNode
+        {
+            int32_t parent = -1;                  // index of the parent entry, -1 for roots
+            int32_t joint = -1;                   // Joint::index addressing jointMatrices/offsetMatrices, -1 for plain transforms
+            const dmat4* localMatrix = nullptr;   // points to the Joint::matrix or MatrixTransform::matrix updated by animation
+            const Transform* transform = nullptr; // generic Transform evaluated via its virtual transform() method
+        };
+
+        std::vector<FlattenedNode> _flattenedNodes;
+        std::vector<dmat4> _worldMatrices;
+        const Node* _flattenedSubgraph = nullptr;
+
+        void flattenSubgraph();
+
+    public:
+        void invalidateFlattenedSkeleton() { _flattenedSubgraph = nullptr; }
     };
     VSG_type_name(vsg::JointSampler);
 
@@ -72,6 +72,10 @@ namespace vsg
             scales.push_back(VectorKey{time, scale});
         }
 
+        /// compare keyframe tracks, enabling identical tracks to be deduplicated with SharedObjects::share()
+        /// so instanced characters playing the same animation share one copy of the keyframe storage
+        int compare(const Object& rhs) const override;
+
         void read(Input& input) override;
         void write(Output& output) const override;
     };
@@ -110,6 +114,13 @@ namespace vsg
         void apply(Joint& joint) override;
         void apply(LookAt& lookAt) override;
         void apply(Camera& camera) override;
+
+    protected:
+        // cached keyframe cursors so sequential playback resumes each track search from the previous
+        // frame's bracketing keyframes rather than binary searching the whole track every sample
+        size_t _positionCursor = 0;
+        size_t _rotationCursor = 0;
+        size_t _scaleCursor = 0;
     };
     VSG_type_name(vsg::TransformSampler);
 
@@ -0,0 +1,68 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/Window.h>
+#include <vsg/threading/TaskGraph.h>
+
+namespace vsg
+{
+
+    /// AsyncStartup overlaps the expensive phases of application startup - Vulkan
+    /// Instance/PhysicalDevice/Device creation, scene loading and shader warm up - that typically run
+    /// back to back before the first frame. Each begin*() call schedules its phase on a TaskGraph
+    /// worker and returns the Task so later phases can be made to depend on it, then wait() joins
+    /// them with the calling thread helping to run outstanding tasks. After wait() the usual
+    /// window/viewer wiring and Viewer::compile() proceed with the device and scene already in hand,
+    /// cutting time to first frame by the overlap between the phases.
+    ///
+    /// Usage:
+    ///     auto startup = vsg::AsyncStartup::create();
+    ///     startup->beginDeviceCreation(window);
+    ///     startup->beginLoad({"scene.vsgb"}, options);
+    ///     startup->wait();
+    ///     auto scene = startup->loadedObject("scene.vsgb");
+    class VSG_DECLSPEC AsyncStartup : public Inherit<Object, AsyncStartup>
+    {
+    public:
+        explicit AsyncStartup(uint32_t numThreads = 2);
+
+        /// the graph running the startup phases, exposed so applications can add further stages directly
+        ref_ptr<TaskGraph> taskGraph;
+
+        /// schedule creation of the window's Instance, Surface, PhysicalDevice and Device on a worker thread.
+        /// The window itself must already have been created on the thread the windowing system requires.
+        ref_ptr<Task> beginDeviceCreation(ref_ptr<Window> window);
+
+        /// schedule reading of the specified files into loadedObjects, dispatched via vsg::readShared so
+        /// the batch itself is read in parallel across Options::operationThreads when assigned
+        ref_ptr<Task> beginLoad(const Paths& filenames, ref_ptr<const Options> options = {});
+
+        /// schedule an application supplied operation, such as shader warm up, with optional dependencies
+        ref_ptr<Task> begin(ref_ptr<Operation> operation, const std::vector<ref_ptr<Task>>& dependencies = {});
+
+        /// block until all scheduled phases have completed, with the calling thread running tasks alongside the workers
+        void wait();
+
+        /// return the object loaded for the specified filename, valid once wait() has returned
+        ref_ptr<Object> loadedObject(const Path& filename) const;
+
+        /// the objects read by beginLoad() keyed by filename, valid once wait() has returned
+        PathObjects loadedObjects;
+
+    protected:
+        virtual ~AsyncStartup();
+    };
+    VSG_type_name(vsg::AsyncStartup);
+
+} // namespace vsg
@@ -23,6 +23,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 namespace vsg
 {
 
+    // forward declare
+    class SecondaryCommandGraph;
+    class OperationThreads;
+
     /// CommandGraph is a group node that sits at the top of the scene graph and manages the recording of its subgraph to Vulkan command buffers.
     class VSG_DECLSPEC CommandGraph : public Inherit<Group, CommandGraph>
     {
@@ -53,10 +57,38 @@ namespace vsg
         /// hook for assigning Instrumentation to enable profiling of record traversal.
         ref_ptr<Instrumentation> instrumentation;
 
+        /// opt-in multi-threaded record mode - when recordThreads is assigned the secondaryCommandGraphs are
+        /// recorded in parallel across the threads into Vulkan secondary command buffers, with the primary
+        /// traversal stitching them together via the ExecuteCommands nodes connected to each SecondaryCommandGraph.
+        ref_ptr<OperationThreads> recordThreads;
+
+        /// SecondaryCommandGraphs to record in parallel when recordThreads is assigned, each must be referenced
+        /// by an ExecuteCommands node placed within this CommandGraph's subgraph.
+        std::vector<ref_ptr<SecondaryCommandGraph>> secondaryCommandGraphs;
+
+        /// opt-in reuse of the previous frame's recording for static views such as overview maps and
+        /// fixed camera RTT. When enabled record() fingerprints the inputs that shape the recorded
+        /// commands - each View's camera view/projection matrices and mask, and each RenderGraph's
+        /// renderArea - and resubmits the previously recorded command buffer when nothing has changed
+        /// and no DatabasePager is mutating the scene. Dynamic data updates are transferred by the
+        /// TransferTask independently of recording so they don't require a re-record. Structural edits
+        /// to the subgraph are invisible to the fingerprint - call markRecordingDirty() after making them.
+        bool conditionalRecord = false;
+
+        /// force the next record() to re-record even when the fingerprint is unchanged
+        void markRecordingDirty() { _lastFingerprint = 0; }
+
     protected:
         virtual ~CommandGraph();
 
-        CommandBuffers _commandBuffers; // assign one per index? Or just use round robin, each has a CommandPool
+        /// ring of CommandBuffers, one per in flight frame, each with its own dedicated CommandPool so recording
+        /// threads never contend on a pool and per frame recycling is a single retained vkResetCommandPool call.
+        /// record() reuses the first CommandBuffer with no outstanding submissions, growing the ring when all are in flight.
+        CommandBuffers _commandBuffers;
+
+        // conditional record state - fingerprint of the last recording and the buffer it produced
+        std::size_t _lastFingerprint = 0;
+        ref_ptr<CommandBuffer> _lastRecordedCommandBuffer;
     };
     VSG_type_name(vsg::CommandGraph);
 
@@ -18,6 +18,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 namespace vsg
 {
 
+    class OperationThreads;
+
     /// CompileResult struct encapsulates the results of compile traversal.
     /// Used to help guide further operations done with the compiled subgraph.
     struct VSG_DECLSPEC CompileResult
@@ -41,7 +43,9 @@ namespace vsg
     class VSG_DECLSPEC CompileManager : public Inherit<Object, CompileManager>
     {
     public:
-        CompileManager(Viewer& viewer, ref_ptr<ResourceHints> hints);
+        /// in_numCompileTraversals sets the number of CompileTraversals, each with their own Contexts, available
+        /// to concurrent compile() calls, such as those made by the DatabasePager's read threads.
+        CompileManager(Viewer& viewer, ref_ptr<ResourceHints> hints, size_t in_numCompileTraversals = 1);
 
         /// add a compile Context for device
         void add(ref_ptr<Device> device, const ResourceRequirements& resourceRequirements = {});
@@ -66,11 +70,31 @@ namespace vsg
         /// compile object
         CompileResult compile(ref_ptr<Object> object, ContextSelectionFunction contextSelection = {});
 
+        /// compile the children of a group in parallel across the specified OperationThreads, with each task
+        /// taking its own CompileTraversal from the pool so that only the queue submissions are serialized.
+        /// Construct the CompileManager with in_numCompileTraversals > 1 to provide the pool, otherwise, or when
+        /// the object cannot be partitioned, compilation falls back to the single threaded compile().
+        CompileResult compile(ref_ptr<Object> object, ref_ptr<OperationThreads> operationThreads, ContextSelectionFunction contextSelection = {});
+
+        /// grow the pool so at least count CompileTraversals, each with its own compile Contexts, staging
+        /// memory pools and queue submissions, are available to concurrent compile() calls. Called by
+        /// DatabasePager::start() with its read thread count so each loader thread records and submits its
+        /// tile uploads on its own Context instead of the threads serializing on a shared one.
+        void reserveCompileTraversals(size_t count);
+
+        /// return ResourceHints accumulated from the requirements of every compile() call made during the
+        /// session, or an empty ref_ptr when nothing has been compiled. Merged with the initial compile's
+        /// requirements by Viewer::captureResourceHints() to persist right-sized pools for future runs.
+        ref_ptr<ResourceHints> accumulatedResourceHints() const;
+
     protected:
         using CompileTraversals = ThreadSafeQueue<ref_ptr<CompileTraversal>>;
         size_t numCompileTraversals = 0;
         ref_ptr<CompileTraversals> compileTraversals;
 
+        mutable std::mutex _accumulatedResourceHintsMutex;
+        ref_ptr<ResourceHints> _accumulatedResourceHints;
+
         CompileTraversals::container_type takeCompileTraversals(size_t count);
     };
     VSG_type_name(vsg::CompileManager);
@@ -85,6 +85,7 @@ namespace vsg
         void apply(Compilable& node) override;
         void apply(Commands& commands) override;
         void apply(Geometry& geometry) override;
+        void apply(OcclusionQueryNode& oqn) override;
         void apply(CommandGraph& commandGraph) override;
         void apply(SecondaryCommandGraph& secondaryCommandGraph) override;
         void apply(RenderGraph& renderGraph) override;
@@ -0,0 +1,115 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/RenderGraph.h>
+#include <vsg/commands/BlitImage.h>
+#include <vsg/commands/SetScissor.h>
+#include <vsg/commands/SetViewport.h>
+#include <vsg/state/QueryPool.h>
+#include <vsg/threading/OperationQueue.h>
+
+namespace vsg
+{
+
+    /// DynamicResolution holds a target frame rate by scaling the resolution rendered each frame, driven
+    /// by GPU frame time measured with QueryPool timestamps. The scene is rendered into a fixed, full
+    /// size framebuffer with only RenderGraph::renderArea and the assigned SetViewport/SetScissor
+    /// commands updated to cover the scaled region, followed by an upscale blit to the presented image,
+    /// so changing resolution never recreates pipelines or framebuffers.
+    ///
+    /// Usage: render the scene via an offscreen RenderGraph whose GraphicsPipelines enable dynamic
+    /// viewport/scissor state, add beginTiming as the first child of the CommandGraph and endTiming as
+    /// the last, assign renderGraph, setViewport, setScissor, upscaleBlit and fullExtent, and register
+    /// the DynamicResolution with viewer->addUpdateOperation(dynamicResolution, UpdateOperations::ALL_FRAMES).
+    /// Sampling passes that read the scaled image must restrict their texture coordinates to scale() of
+    /// the image, which the upscale blit's source region handles for the common present path.
+    class VSG_DECLSPEC DynamicResolution : public Inherit<Operation, DynamicResolution>
+    {
+    public:
+        explicit DynamicResolution(uint32_t numFramesInFlight = 3);
+
+        /// GPU frame time to aim for in seconds, 1/90th of a second by default for 90Hz displays
+        double targetFrameTime = 1.0 / 90.0;
+
+        /// fraction of targetFrameTime to aim the controller at, leaving headroom for frame to frame variation
+        double headroom = 0.9;
+
+        /// smoothing factor applied to the measured GPU time, 0 = no smoothing, towards 1.0 = heavier smoothing
+        double smoothing = 0.8;
+
+        /// relative change in scale below which the current scale is kept, avoiding continual small adjustments
+        double deadband = 0.05;
+
+        /// bounds on the resolution scale, as a proportion of fullExtent in each axis
+        float minScale = 0.5f;
+        float maxScale = 1.0f;
+
+        /// extent of the full size framebuffer that a scale of 1.0 corresponds to
+        VkExtent2D fullExtent = {0, 0};
+
+        /// offscreen RenderGraph whose renderArea is scaled
+        ref_ptr<RenderGraph> renderGraph;
+
+        /// dynamic viewport/scissor commands in the scene that are rescaled, may be left unassigned
+        ref_ptr<SetViewport> setViewport;
+        ref_ptr<SetScissor> setScissor;
+
+        /// final upscale blit whose source region is rescaled, may be left unassigned
+        ref_ptr<BlitImage> upscaleBlit;
+
+        /// timing commands to add as the first and last children of the CommandGraph
+        ref_ptr<Command> beginTiming;
+        ref_ptr<Command> endTiming;
+
+        /// current resolution scale
+        float scale() const { return _scale; }
+
+        /// smoothed GPU frame time in seconds, 0.0 until the first timestamps are available
+        double gpuFrameTime() const { return _gpuFrameTime; }
+
+        /// read the completed frame's timestamps, update the controller and apply the new scale,
+        /// invoked once per frame by Viewer::update()
+        void run() override;
+
+    protected:
+        virtual ~DynamicResolution();
+
+        /// internal command that writes the frame's begin or end timestamp into the current ring slot
+        class Timing : public Inherit<Command, Timing>
+        {
+        public:
+            Timing(DynamicResolution* in_dynamicResolution, bool in_begin);
+
+            void compile(Context& context) override;
+            void record(CommandBuffer& commandBuffer) const override;
+
+        protected:
+            DynamicResolution* _dynamicResolution;
+            bool _begin;
+        };
+        friend class Timing;
+
+        void applyScale();
+
+        ref_ptr<QueryPool> _queryPool;
+        ref_ptr<Device> _device;
+        uint32_t _numSlots;
+        uint32_t _currentSlot = 0;
+        uint32_t _framesRecorded = 0;
+        float _scale = 1.0f;
+        double _gpuFrameTime = 0.0;
+    };
+    VSG_type_name(vsg::DynamicResolution);
+
+} // namespace vsg
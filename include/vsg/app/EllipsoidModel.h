@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Inherit.h>
 #include <vsg/maths/mat4.h>
 #include <vsg/maths/vec3.h>
+#include <vsg/threading/OperationThreads.h>
 
 namespace vsg
 {
@@ -51,6 +52,23 @@ namespace vsg
         /// latitude and longitude in degrees, altitude in metres, ECEF coords in metres.
         dvec3 convertECEFToLatLongAltitude(const dvec3& ecef) const;
 
+        /// batch conversion of a contiguous array of lat/long/altitude coordinates to ECEF,
+        /// in place conversion by passing the same array for input and output is supported.
+        /// The tight loop over contiguous memory keeps the trig/sqrt work auto-vectorizable and
+        /// avoids the per-call overhead of the single coordinate method for bulk conversions.
+        void convertLatLongAltitudeToECEF(const dvec3* lla, dvec3* ecef, size_t count) const;
+
+        /// batch conversion of a contiguous array of ECEF coordinates to lat/long/altitude
+        void convertECEFToLatLongAltitude(const dvec3* ecef, dvec3* lla, size_t count) const;
+
+        /// parallel batch conversion that partitions the array into blocks distributed across the
+        /// OperationThreads, with the calling thread helping out and joining before returning.
+        /// Falls back to the single threaded batch conversion for small counts or when threads is empty.
+        void convertLatLongAltitudeToECEF(const dvec3* lla, dvec3* ecef, size_t count, ref_ptr<OperationThreads> operationThreads, size_t blockSize = 65536) const;
+
+        /// parallel batch conversion of ECEF coordinates to lat/long/altitude
+        void convertECEFToLatLongAltitude(const dvec3* ecef, dvec3* lla, size_t count, ref_ptr<OperationThreads> operationThreads, size_t blockSize = 65536) const;
+
         /// latitude and longitude in degrees, altitude in metres
         dmat4 computeLocalToWorldTransform(const dvec3& lla) const;
 
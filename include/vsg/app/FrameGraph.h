@@ -0,0 +1,88 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/PipelineBarrier.h>
+#include <vsg/nodes/Group.h>
+
+namespace vsg
+{
+
+    /// FrameGraph computes the minimal synchronization between a chain of passes - RenderGraphs and
+    /// compute/transfer Commands subgraphs - from the image and buffer usage each pass declares,
+    /// replacing the conservative ALL_COMMANDS PipelineBarriers applications hand insert between
+    /// render to texture passes to stay correct.
+    ///
+    /// Each pass declares the resources it reads and writes along with the pipeline stages, access
+    /// masks and, for images, the layout the resource must be in while the pass executes. build()
+    /// then reorders the passes where the declared dependencies permit, so independent passes can
+    /// overlap on the GPU, and emits at most one PipelineBarrier ahead of each pass containing only
+    /// the stage, access and layout transitions that pass actually requires - read after read needs
+    /// no barrier at all, and all of a pass's transitions are merged into a single
+    /// vkCmdPipelineBarrier call.
+    ///
+    /// For a RenderGraph pass the declared layout of an attachment should match the RenderPass's
+    /// initialLayout, and its usage after the pass is taken from the RenderPass's finalLayout side of
+    /// the declaration, i.e. declare the layouts the render pass itself expects and leaves behind.
+    class VSG_DECLSPEC FrameGraph : public Inherit<Object, FrameGraph>
+    {
+    public:
+        FrameGraph();
+
+        /// declared usage of a single image or buffer by a pass
+        struct ResourceUsage
+        {
+            ref_ptr<Image> image;   // assign image or buffer, not both
+            ref_ptr<Buffer> buffer;
+            VkPipelineStageFlags stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            VkAccessFlags accessMask = 0;
+            VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED; // images only, layout required while the pass executes
+            bool write = false;
+        };
+
+        /// a single pass in the frame - the node is typically a RenderGraph or a Commands subgraph with dispatches
+        class Pass : public Inherit<Object, Pass>
+        {
+        public:
+            ref_ptr<Node> node;
+            std::vector<ResourceUsage> usage;
+
+            /// declare an image read by this pass
+            void read(ref_ptr<Image> image, VkPipelineStageFlags stageMask, VkAccessFlags accessMask, VkImageLayout layout);
+
+            /// declare an image written by this pass
+            void write(ref_ptr<Image> image, VkPipelineStageFlags stageMask, VkAccessFlags accessMask, VkImageLayout layout);
+
+            /// declare a buffer read by this pass
+            void read(ref_ptr<Buffer> buffer, VkPipelineStageFlags stageMask, VkAccessFlags accessMask);
+
+            /// declare a buffer written by this pass
+            void write(ref_ptr<Buffer> buffer, VkPipelineStageFlags stageMask, VkAccessFlags accessMask);
+        };
+
+        /// passes in submission order, addPass() appends and returns the new Pass for usage declarations
+        std::vector<ref_ptr<Pass>> passes;
+
+        ref_ptr<Pass> addPass(ref_ptr<Node> node);
+
+        /// reorder the passes respecting the declared dependencies and return a Group containing the
+        /// pass nodes interleaved with the minimal PipelineBarriers, ready for adding to a CommandGraph.
+        /// Passes with no dependency between them keep their original relative order.
+        ref_ptr<Group> build() const;
+
+    protected:
+        virtual ~FrameGraph();
+    };
+    VSG_type_name(vsg::FrameGraph);
+
+} // namespace vsg
@@ -0,0 +1,67 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/Window.h>
+#include <vsg/ui/UIEvent.h>
+
+namespace vsg
+{
+
+    /// FramePacer regulates when each CPU frame starts so that frames are produced at a steady cadence
+    /// rather than oscillating between early and late against the display's vsync, assign to
+    /// Viewer::framePacer to have Viewer::advanceToNextFrame() pace each frame.
+    ///
+    /// Two modes are provided:
+    ///   throughput (default) - the frame start is delayed until one targetFrameDuration before the next
+    ///   expected present, smoothing out frame times under FIFO present modes.
+    ///   minimizeLatency - the frame start is delayed as long as possible, using a running estimate of how
+    ///   long the application takes to produce a frame, so input is sampled as close as possible to the
+    ///   present it will be displayed by, minimizing input to photon latency.
+    class VSG_DECLSPEC FramePacer : public Inherit<Object, FramePacer>
+    {
+    public:
+        FramePacer(double in_targetFrameDuration = 1.0 / 60.0);
+
+        /// the interval to pace frames to, in seconds. Defaults to 60Hz, use assignRefreshRate() to set it from the display.
+        double targetFrameDuration = 1.0 / 60.0;
+
+        /// when true delay the frame start as late as the frame work estimate allows to minimize latency,
+        /// when false just pace frames one targetFrameDuration apart for smooth throughput.
+        bool minimizeLatency = false;
+
+        /// extra time in seconds subtracted from the latest possible frame start in minimizeLatency mode to absorb frame time variation.
+        double safetyMargin = 0.002;
+
+        /// weight given to previous frames when smoothing the frame work time estimate, in the range [0, 1).
+        double smoothing = 0.9;
+
+        /// set targetFrameDuration from the display's refresh cycle using vkGetRefreshCycleDurationGOOGLE.
+        /// Returns false and leaves targetFrameDuration unchanged when the VK_GOOGLE_display_timing device extension isn't available.
+        bool assignRefreshRate(Window& window);
+
+        /// block until the paced start time for the next frame, called by Viewer::advanceToNextFrame().
+        virtual void pace();
+
+        /// smoothed estimate of the CPU time in seconds spent producing a frame between pace() calls.
+        double frameWorkDuration() const { return _frameWorkDuration; }
+
+    protected:
+        clock::time_point _nextPresentTime;
+        clock::time_point _previousPaceEnd;
+        double _frameWorkDuration = 0.0;
+        bool _initialized = false;
+    };
+    VSG_type_name(vsg::FramePacer);
+
+} // namespace vsg
@@ -0,0 +1,64 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/LOD.h>
+
+namespace vsg
+{
+
+    /// LODPolicy provides optional control over how RecordTraversal selects LOD children, assigned via RecordTraversal::lodPolicy.
+    /// It caches each LOD's previous selection and keeps it while the screen height ratio stays within a hysteresis band around
+    /// the child's minimumScreenHeightRatio, suppressing LOD flicker and avoiding re-deriving identical selections each frame.
+    /// An optional per frame selection budget demotes LODs by scaling the cutoff distances up when the previous frame exceeded it.
+    /// The cached selection is stored on the LOD node itself, so a LODPolicy is best suited to scenes recorded by a single main view.
+    class VSG_DECLSPEC LODPolicy : public Inherit<Object, LODPolicy>
+    {
+    public:
+        LODPolicy();
+
+        /// width of the hysteresis band around each child's minimumScreenHeightRatio, as a proportion of the ratio.
+        /// A previously selected child is kept while the screen height ratio stays within [lower band of this child, upper band of the next finer child].
+        double transitionRatio = 0.1;
+
+        /// target number of LOD child selections per frame, 0 disables the budget.
+        /// When the previous frame selected more children than the budget the cutoff distances are scaled up, demoting distant LODs to coarser children.
+        uint32_t selectionBudget = 0;
+
+        /// proportion by which the demotion scale grows or decays each frame in response to being over or under budget.
+        double budgetAdjustmentRate = 0.1;
+
+        /// upper limit on the demotion scale applied when over budget.
+        double maxBudgetScale = 4.0;
+
+        /// called once per frame before the record traversal, applies the budget feedback and resets the per frame selection count.
+        void beginFrame();
+
+        /// select the child of the lod to traverse for the specified lodDistance, returning the child index or -1 when no child passes.
+        int32_t select(const LOD& lod, double lodDistance);
+
+        /// number of LOD child selections made in the current frame.
+        uint32_t numSelections() const { return _numSelections; }
+
+        /// current demotion scale applied to the cutoff distances, 1.0 when within budget.
+        double budgetScale() const { return _scale; }
+
+    protected:
+        virtual ~LODPolicy();
+
+        uint32_t _numSelections = 0;
+        double _scale = 1.0;
+    };
+    VSG_type_name(vsg::LODPolicy);
+
+} // namespace vsg
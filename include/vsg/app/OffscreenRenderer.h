@@ -0,0 +1,117 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/CommandGraph.h>
+#include <vsg/app/RenderGraph.h>
+#include <vsg/vk/Fence.h>
+#include <vsg/vk/Framebuffer.h>
+#include <vsg/vk/Queue.h>
+
+namespace vsg
+{
+
+    /// OffscreenRenderer provides a first class headless rendering target for server side image
+    /// generation, with no Surface or Swapchain involvement. It maintains a ring of offscreen
+    /// framebuffers so numFrames frames can be in flight on the GPU at once, and reads each completed
+    /// frame back through a per frame host visible buffer, delivering the pixels via a callback when
+    /// the frame's fence signals - the CPU only blocks when the whole ring is in flight, keeping the
+    /// GPU continuously fed for high throughput image generation pipelines.
+    ///
+    /// Usage: create the OffscreenRenderer, build a CommandGraph containing a RenderGraph compatible
+    /// with renderPass(), assign commandGraph and renderGraph, add readbackCommand as the last child of
+    /// the CommandGraph, assign a readbackCallback, then call render() once per frame and
+    /// waitForCompletion() before shutdown to drain the in flight frames.
+    class VSG_DECLSPEC OffscreenRenderer : public Inherit<Object, OffscreenRenderer>
+    {
+    public:
+        OffscreenRenderer(ref_ptr<Device> in_device, const VkExtent2D& in_extent, VkFormat in_imageFormat, VkFormat in_depthFormat, uint32_t in_numFrames = 3);
+
+        /// callback invoked as each frame's rendering and readback completes.
+        /// data points at the frame's tightly packed pixels and is only valid for the duration of the call.
+        class ReadbackCallback : public Inherit<Object, ReadbackCallback>
+        {
+        public:
+            virtual void apply(uint64_t frameIndex, void* data, VkDeviceSize size) = 0;
+        };
+
+        ref_ptr<Device> device;
+        VkExtent2D extent;
+        VkFormat imageFormat;
+        VkFormat depthFormat;
+
+        /// queue the frames are submitted to, assigned to the device's first graphics queue by the constructor
+        ref_ptr<Queue> queue;
+
+        /// CommandGraph to record each frame, assign in application setup
+        ref_ptr<CommandGraph> commandGraph;
+
+        /// RenderGraph within the CommandGraph whose framebuffer is switched to the frame's framebuffer each render()
+        ref_ptr<RenderGraph> renderGraph;
+
+        /// command copying the frame's color attachment into its readback buffer, add as the last child of the CommandGraph
+        ref_ptr<Command> readbackCommand;
+
+        ref_ptr<ReadbackCallback> readbackCallback;
+
+        /// RenderPass shared by all the framebuffers, with the color attachment left in TRANSFER_SRC_OPTIMAL for the readback copy
+        RenderPass* getRenderPass() { return _renderPass; }
+
+        uint32_t numFrames() const { return static_cast<uint32_t>(_frames.size()); }
+
+        /// record and submit the next frame, first completing the oldest in flight frame when the ring is full,
+        /// which invokes the readbackCallback with its pixels
+        VkResult render(ref_ptr<FrameStamp> frameStamp = {});
+
+        /// block until all in flight frames have completed, invoking the readbackCallback for each
+        void waitForCompletion();
+
+    protected:
+        virtual ~OffscreenRenderer();
+
+        struct Frame
+        {
+            ref_ptr<Framebuffer> framebuffer;
+            ref_ptr<Image> colorImage;
+            ref_ptr<Buffer> readbackBuffer;
+            void* mappedData = nullptr;
+            VkDeviceSize readbackSize = 0;
+            ref_ptr<Fence> fence;
+            uint64_t frameIndex = 0;
+            bool inFlight = false;
+        };
+
+        /// internal command recording the copy of the current frame's color attachment to its readback buffer
+        class Readback : public Inherit<Command, Readback>
+        {
+        public:
+            explicit Readback(OffscreenRenderer* in_renderer);
+
+            void record(CommandBuffer& commandBuffer) const override;
+
+        protected:
+            OffscreenRenderer* _renderer;
+        };
+        friend class Readback;
+
+        /// wait for the frame's fence, hand its pixels to the readbackCallback and recycle it
+        VkResult completeFrame(Frame& frame);
+
+        ref_ptr<RenderPass> _renderPass;
+        std::vector<Frame> _frames;
+        uint64_t _frameCount = 0;
+        uint32_t _currentFrame = 0;
+    };
+    VSG_type_name(vsg::OffscreenRenderer);
+
+} // namespace vsg
@@ -0,0 +1,88 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Commands.h>
+#include <vsg/commands/FillBuffer.h>
+#include <vsg/state/BufferInfo.h>
+#include <vsg/state/DescriptorSet.h>
+#include <vsg/state/ImageInfo.h>
+#include <vsg/state/ShaderStage.h>
+
+namespace vsg
+{
+
+    /// OrderIndependentTransparency builds the per pixel linked list resources and commands that let
+    /// transparent geometry render unsorted - assign it to a Bin with SortOrder NO_SORT - replacing the
+    /// CPU depth sort of DepthSorted/Bin with a bounded GPU resolve pass. Transparent fragments append
+    /// a node per fragment to a shared buffer, with a per pixel head index image chaining them, and a
+    /// fullscreen resolve pass sorts and composites the short per pixel lists.
+    ///
+    /// Usage: assign width/height and the resolve shader stages, call setup(), record this node in the
+    /// CommandGraph before the RenderGraph (the clears are illegal inside a render pass), and add
+    /// resolveCommands as the RenderGraph's last child. The render pass needs a by-region subpass self
+    /// dependency on the fragment shader stage for the in pass barrier recorded by resolveCommands.
+    ///
+    /// The shaders are supplied by the application as the built in ShaderSets have no OIT variants.
+    /// The transparent pass fragment shaders, and the resolve fragment shader, share the descriptors
+    /// held in descriptorSet/descriptorSetLayout:
+    ///     binding 0 : storage image  - r32ui per pixel head indices, cleared to 0xffffffff
+    ///     binding 1 : storage buffer - fragment nodes, 16 bytes each: uint packed rgba8 color,
+    ///                                  float depth, uint next, uint pad
+    ///     binding 2 : storage buffer - uint node allocation counter, cleared to 0
+    /// The node buffer holds width * height * averageLayersPerPixel nodes; shaders must drop fragments
+    /// once the counter passes that capacity. The transparent pass fragment shaders write no color
+    /// output and the pipelines should disable depth writes.
+    class VSG_DECLSPEC OrderIndependentTransparency : public Inherit<Commands, OrderIndependentTransparency>
+    {
+    public:
+        OrderIndependentTransparency();
+
+        /// dimensions of the framebuffer the transparency is resolved for
+        uint32_t width = 0;
+        uint32_t height = 0;
+
+        /// sizes the fragment node buffer, width * height * averageLayersPerPixel nodes
+        uint32_t averageLayersPerPixel = 4;
+
+        /// fullscreen triangle vertex shader and per pixel sort/composite fragment shader for the resolve pass
+        ref_ptr<ShaderStage> fullscreenVertexShaderStage;
+        ref_ptr<ShaderStage> resolveFragmentShaderStage;
+
+        /// resources created by setup(), with the buffers allocated device only at compile
+        ref_ptr<ImageInfo> headIndexImage;
+        ref_ptr<BufferInfo> fragmentNodes;
+        ref_ptr<BufferInfo> fragmentCounter;
+
+        /// descriptors shared by the transparent pass pipelines and the resolve pass, created by setup()
+        ref_ptr<DescriptorSetLayout> descriptorSetLayout;
+        ref_ptr<DescriptorSet> descriptorSet;
+
+        /// barrier/bind/draw sequence compositing the per pixel lists, created by setup(),
+        /// to be added as the RenderGraph's last child
+        ref_ptr<Commands> resolveCommands;
+
+        /// build the clear and resolve commands from the assigned settings.
+        /// Requires width/height and the resolve shader stages, returns false when they are missing.
+        bool setup();
+
+        void compile(Context& context) override;
+
+    protected:
+        virtual ~OrderIndependentTransparency();
+
+        ref_ptr<FillBuffer> _clearCounter;
+    };
+    VSG_type_name(vsg::OrderIndependentTransparency);
+
+} // namespace vsg
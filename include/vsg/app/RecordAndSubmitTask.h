@@ -15,10 +15,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/CommandGraph.h>
 #include <vsg/app/TransferTask.h>
 #include <vsg/app/Window.h>
+#include <vsg/core/observer_ptr.h>
 #include <vsg/io/DatabasePager.h>
 #include <vsg/nodes/Group.h>
 #include <vsg/utils/Instrumentation.h>
 #include <vsg/vk/CommandBuffer.h>
+#include <vsg/vk/SyncObjectPool.h>
+#include <vsg/vk/TimelineSemaphore.h>
 
 namespace vsg
 {
@@ -35,7 +38,30 @@ namespace vsg
         virtual VkResult record(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers, ref_ptr<FrameStamp> frameStamp);
         virtual VkResult finish(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers);
 
+        /// collated Vulkan handles for a pending queue submission, kept alive until the vkQueueSubmit call that consumes them.
+        class Submission : public Inherit<Object, Submission>
+        {
+        public:
+            std::vector<VkCommandBuffer> commandBuffers;
+            std::vector<VkSemaphore> waitSemaphores;
+            std::vector<VkPipelineStageFlags> waitStages;
+            std::vector<VkSemaphore> signalSemaphores;
+            std::vector<uint64_t> waitValues;
+            std::vector<uint64_t> signalValues;
+            VkTimelineSemaphoreSubmitInfo timelineSubmitInfo = {};
+            VkSubmitInfo submitInfo = {};
+        };
+
+        /// collate the recorded command buffers and semaphores into a Submission, registering the dependencies on the
+        /// specified Fence, so that submissions from multiple tasks targeting the same queue can be combined into a
+        /// single vkQueueSubmit call. The submission is left null when there is nothing to submit.
+        virtual VkResult buildSubmission(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers, Fence* fence, ref_ptr<Submission>& submission);
+
         ref_ptr<Device> device;
+
+        /// device wide pool the task's fences and semaphores are acquired from and recycled to on destruction
+        ref_ptr<SyncObjectPool> syncObjectPool;
+
         Windows windows;
         Semaphores waitSemaphores;
         CommandGraphs commandGraphs; // assign in application setup
@@ -47,9 +73,33 @@ namespace vsg
         ref_ptr<TransferTask> lateTransferTask; // data is updated during the record traversal so has to be transferred after record traversal
         ref_ptr<Semaphore> lateTransferTaskConsumerCompletedSemaphore;
 
+        /// cross queue ordering - make this task's submission wait for the specified producer task's work for the
+        /// current frame to complete before it executes, using the producer's per frame timeline semaphore value.
+        /// Used to order an async compute task, such as CommandGraphs assigned a dedicated compute queueFamily
+        /// running particle, light clustering or skinning passes, before the graphics task that consumes their
+        /// outputs, while leaving the two queues free to overlap all non dependent work. As timeline semaphores
+        /// permit a wait to be submitted before the matching signal the tasks may be submitted in any order.
+        void dependsOn(ref_ptr<RecordAndSubmitTask> producerTask);
+
+        /// producer tasks registered via dependsOn() whose current frame's submission must complete before this
+        /// task's submission executes.
+        std::vector<observer_ptr<RecordAndSubmitTask>> waitTasks;
+
+        /// timeline semaphore signalled with frameTimelineValue when this task's submission completes, created by
+        /// dependsOn() when another task depends on this one.
+        ref_ptr<TimelineSemaphore> frameCompletedSemaphore;
+
+        /// per frame timeline value, incremented by advance()
+        uint64_t frameTimelineValue = 0;
+
         /// advance the currentFrameIndex
         void advance();
 
+        /// number of frames the task keeps in flight, i.e. the depth of its per frame fence and index rings,
+        /// for sizing dependent per frame resources consistently. Set via the numBuffers constructor argument,
+        /// which the Viewer assigns from Viewer::framesInFlight.
+        uint32_t framesInFlight() const { return static_cast<uint32_t>(_fences.size()); }
+
         /// return the fence index value for relativeFrameIndex where 0 is current frame, 1 is previous frame etc.
         size_t index(size_t relativeFrameIndex = 0) const;
 
@@ -67,6 +117,8 @@ namespace vsg
         void assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation);
 
     protected:
+        virtual ~RecordAndSubmitTask();
+
         size_t _currentFrameIndex;
         std::vector<size_t> _indices;
         std::vector<ref_ptr<Fence>> _fences;
@@ -12,6 +12,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/FrameAllocator.h>
 #include <vsg/core/Mask.h>
 #include <vsg/core/Object.h>
 #include <vsg/core/type_name.h>
@@ -26,14 +27,18 @@ namespace vsg
     // forward declare nodes
     class Node;
     class Group;
+    class SpatialIndexGroup;
     class QuadGroup;
     class LOD;
     class PagedLOD;
+    class ImpostorLOD;
     class StateGroup;
     class CullGroup;
     class CullNode;
+    class OcclusionQueryNode;
     class DepthSorted;
     class Layer;
+    class MaskGroup;
     class Transform;
     class MatrixTransform;
     class Joint;
@@ -52,6 +57,7 @@ namespace vsg
     class Bin;
     class Switch;
     class RegionOfInterest;
+    class CompiledDrawList;
     class ViewDependentState;
     class Light;
     class AmbientLight;
@@ -61,6 +67,8 @@ namespace vsg
     class CommandGraph;
     class RecordedCommandBuffers;
     class Instrumentation;
+    class LODPolicy;
+    class AnimationGroup;
 
     VSG_type_name(vsg::RecordTraversal);
 
@@ -85,8 +93,32 @@ namespace vsg
         Mask traversalMask = MASK_ALL;
         Mask overrideMask = MASK_OFF;
 
+        /// opt-in batched culling mode - when enabled sibling CullNode/CullGroup bounding spheres are
+        /// gathered into structure of arrays form and tested against the view frustum in SIMD batches,
+        /// falling back to scalar tests on platforms without SSE2/AVX/NEON support.
+        bool useBatchedCulling = false;
+
+        /// opt-in fast path that records the projection and modelview matrices with a single 128 byte
+        /// vkCmdPushConstants call from a stack buffer instead of two 64 byte calls. Only enable when all
+        /// pipeline layouts in the scene graph declare a push constant range covering both matrices.
+        bool useCombinedMatrixPushConstants = false;
+
+        /// opt-in debug aid for the borrowed pointer record path - verify that the children containers of
+        /// Group and StateGroup nodes are not modified while they are being traversed, warning when a
+        /// mid-traversal mutation is detected.
+        bool validateTraversal = false;
+
+        /// optional policy controlling LOD child selection, adding hysteresis, caching of the previous
+        /// selection and an optional per frame selection budget. When left null the LOD children are
+        /// selected purely by their minimumScreenHeightRatio each frame.
+        ref_ptr<LODPolicy> lodPolicy;
+
         ref_ptr<Instrumentation> instrumentation;
 
+        /// arena allocator for per-frame transient data gathered during the traversal,
+        /// released at the start of each frame's record by CommandGraph::record().
+        ref_ptr<FrameAllocator> frameAllocator;
+
         /// Container for CommandBuffers that have been recorded in current frame
         ref_ptr<RecordedCommandBuffers> recordedCommandBuffers;
 
@@ -109,16 +141,22 @@ namespace vsg
 
         // scene graph nodes
         void apply(const Group& group);
+        void apply(const AnimationGroup& animationGroup);
+        void apply(const SpatialIndexGroup& group);
         void apply(const QuadGroup& quadGroup);
         void apply(const LOD& lod);
         void apply(const PagedLOD& pagedLOD);
+        void apply(const ImpostorLOD& impostorLOD);
         void apply(const TileDatabase& tileDatabase);
         void apply(const CullGroup& cullGroup);
         void apply(const CullNode& cullNode);
+        void apply(const OcclusionQueryNode& oqn);
         void apply(const DepthSorted& depthSorted);
         void apply(const Layer& layer);
+        void apply(const MaskGroup& group);
         void apply(const Switch& sw);
         void apply(const RegionOfInterest& roi);
+        void apply(const CompiledDrawList& drawList);
 
         // leaf node
         void apply(const VertexDraw& vid);
@@ -156,12 +194,16 @@ namespace vsg
         // clear the bins to record a new frame.
         void clearBins();
 
-        // list of pairs of modelview matrix & region of interest
-        std::vector<std::pair<dmat4, const RegionOfInterest*>> regionsOfInterest;
+        // list of pairs of modelview matrix & region of interest, backed by the frameAllocator
+        frame_vector<std::pair<dmat4, const RegionOfInterest*>> regionsOfInterest;
 
     protected:
         virtual ~RecordTraversal();
 
+        /// gather the bounding spheres of CullNode/CullGroup children into SoA batches and cull them against the current frustum,
+        /// traversing the children that pass. Non cull nodes within the children are accepted directly.
+        void _batchedCullTraverse(const ref_ptr<Node>* children, size_t count);
+
         ref_ptr<FrameStamp> _frameStamp;
         ref_ptr<State> _state;
 
@@ -169,6 +211,10 @@ namespace vsg
         ref_ptr<DatabasePager> _databasePager;
         ref_ptr<CulledPagedLODs> _culledPagedLODs;
 
+        // per View traversal overrides, assigned from View::lodScale and View::smallFeatureCullingRatio by apply(const View&)
+        double _lodScale = 1.0;
+        double _smallFeatureCullingRatio = 0.0;
+
         int32_t _minimumBinNumber = 0;
         std::vector<ref_ptr<Bin>> _bins;
         ref_ptr<ViewDependentState> _viewDependentState;
@@ -0,0 +1,82 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/Viewer.h>
+#include <vsg/ui/PlayEvents.h>
+#include <vsg/utils/FrameStatsCollector.h>
+
+namespace vsg
+{
+
+    /// ReplayBenchmark turns an event session captured with vsg::RecordEvents into a deterministic,
+    /// repeatable benchmark. The recorded FrameEvents drive the simulation time of each replayed frame,
+    /// so cameras and animations follow the captured session exactly regardless of how fast the replay
+    /// renders, and the remaining recorded events are dispatched frame by frame in place of live window
+    /// input. Frame statistics - record and GPU pass times, draw counts, transfers and pager activity -
+    /// are gathered through a FrameStatsCollector assigned to the viewer and written out as a machine
+    /// readable JSON report, giving like for like regression numbers across releases and driver updates.
+    ///
+    /// Usage: replace viewer->advanceToNextFrame() in the frame loop with benchmark->advanceToNextFrame()
+    /// and write the report once it returns false:
+    ///
+    ///     auto benchmark = vsg::ReplayBenchmark::create(viewer, vsg::read_cast<vsg::Objects>("session.vsgb"));
+    ///     while (benchmark->advanceToNextFrame())
+    ///     {
+    ///         viewer->handleEvents();
+    ///         viewer->update();
+    ///         viewer->recordAndSubmit();
+    ///         viewer->present();
+    ///     }
+    ///     benchmark->report_json(fout);
+    class VSG_DECLSPEC ReplayBenchmark : public Inherit<Object, ReplayBenchmark>
+    {
+    public:
+        ReplayBenchmark(ref_ptr<Viewer> in_viewer, ref_ptr<Objects> in_events);
+
+        ref_ptr<Viewer> viewer;
+
+        /// events recorded with RecordEvents, the FrameEvents amongst them provide the per frame simulation times
+        ref_ptr<Objects> events;
+
+        /// instrumentation collecting the per frame statistics. Assign before the first
+        /// advanceToNextFrame() call to customize, otherwise a GpuStatsCollector retaining the whole
+        /// session is created and assigned to the viewer automatically.
+        ref_ptr<FrameStatsCollector> stats;
+
+        /// number of leading frames excluded from the report summary while pipelines, caches and the pager warm up
+        size_t warmupFrames = 0;
+
+        /// advance the viewer to the next frame using the recorded frame's simulation time and replace any
+        /// polled window input with the frame's recorded events. Returns false once the session has been
+        /// fully replayed or the viewer is no longer active.
+        bool advanceToNextFrame();
+
+        /// number of frames replayed so far
+        size_t framesReplayed() const { return _frameIndex; }
+
+        /// write a summary aggregated across the replayed frames followed by the per frame statistics as JSON
+        void report_json(std::ostream& out) const;
+
+    protected:
+        /// extract the recorded frame times, create/assign the stats instrumentation and set up the PlayEvents
+        void _start();
+
+        bool _started = false;
+        ref_ptr<PlayEvents> _playEvents;
+        std::vector<double> _simulationTimes;
+        size_t _frameIndex = 0;
+    };
+    VSG_type_name(vsg::ReplayBenchmark);
+
+} // namespace vsg
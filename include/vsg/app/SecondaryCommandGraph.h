@@ -28,6 +28,12 @@ namespace vsg
         explicit SecondaryCommandGraph(ref_ptr<Window> in_window, ref_ptr<Node> child = {}, uint32_t in_subpass = 0);
 
         uint32_t subpass = 0;
+
+        /// record the secondary CommandBuffer with VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT so a single recording
+        /// can be referenced by multiple pending primary command buffer submissions, required when a recording is
+        /// replayed across frames such as by CachedCommands.
+        bool simultaneousUse = false;
+
         VkBool32 occlusionQueryEnable = VK_FALSE;
         VkQueryControlFlags queryFlags = 0;
         VkQueryPipelineStatisticFlags pipelineStatistics = 0;
@@ -17,6 +17,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/DatabasePager.h>
 #include <vsg/nodes/Group.h>
 #include <vsg/vk/CommandBuffer.h>
+#include <vsg/vk/SyncObjectPool.h>
+#include <vsg/vk/TimelineSemaphore.h>
 
 namespace vsg
 {
@@ -35,13 +37,24 @@ namespace vsg
 
         virtual bool containsDataToTransfer() const;
 
+        /// return true if any of the assigned dynamic data has been modified since it was last transferred to GPU memory
+        virtual bool containsModifiedData() const;
+
         ref_ptr<Device> device;
+
+        /// device wide pool the task's per frame transfer complete semaphores are acquired from and recycled to on destruction
+        ref_ptr<SyncObjectPool> syncObjectPool;
+
         Semaphores waitSemaphores;
         Semaphores signalSemaphores;
 
         /// advance the currentFrameIndex
         void advance();
 
+        /// number of staging frames the task cycles through, set via the numBuffers constructor argument
+        /// to match the owning RecordAndSubmitTask's frames in flight.
+        uint32_t framesInFlight() const { return static_cast<uint32_t>(_frames.size()); }
+
         void assign(const ResourceRequirements::DynamicData& dynamicData);
         void assign(const BufferInfoList& bufferInfoList);
         void assign(const ImageInfoList& imageInfoList);
@@ -49,6 +62,22 @@ namespace vsg
         ref_ptr<Queue> transferQueue;
         ref_ptr<Semaphore> currentTransferCompletedSemaphore;
 
+        /// optional timeline semaphore that enables the dedicated transfer queue mode.
+        /// When assigned, transfer submissions signal this semaphore with a monotonically increasing value instead of the
+        /// per frame binary semaphores, and the consuming RecordAndSubmitTask waits on and signals it from the graphics queue,
+        /// so the transferQueue can be a queue from a dedicated DMA/transfer queue family, discovered via
+        /// PhysicalDevice::getDedicatedQueueFamily(..), and uploads overlap with rendering rather than serialize with it.
+        /// Note, queues from transfer only families cannot blit, so mipmap generation is automatically skipped for them -
+        /// assign Data with precomputed mipmaps, such as mipmapped KTX2 imagery, when full mip chains are required.
+        /// The TimelineSemaphore must be dedicated to this TransferTask.
+        ref_ptr<TimelineSemaphore> timelineSemaphore;
+
+        /// timeline value signalled by the most recent transfer submission, 0 when nothing was submitted this frame.
+        uint64_t currentTransferTimelineValue = 0;
+
+        /// timeline value that the consumer of the most recent transfer should signal once it has finished with the transferred data.
+        uint64_t currentConsumerTimelineValue = 0;
+
         /// hook for assigning Instrumentation to enable profiling of record traversal.
         ref_ptr<Instrumentation> instrumentation;
 
@@ -56,6 +85,8 @@ namespace vsg
         Logger::Level level = Logger::LOGGER_DEBUG;
 
     protected:
+        virtual ~TransferTask();
+
         using OffsetBufferInfoMap = std::map<VkDeviceSize, ref_ptr<BufferInfo>>;
         using BufferMap = std::map<ref_ptr<Buffer>, OffsetBufferInfoMap>;
 
@@ -70,6 +101,15 @@ namespace vsg
         size_t _currentFrameIndex;
         std::vector<size_t> _indices;
 
+        /// largest transfer size seen so far, used to size the per frame staging buffers consistently with geometric headroom.
+        VkDeviceSize _stagingHighWaterMark = 0;
+
+        /// debounce for the warning emitted when dynamic image data requires mipmap generation but the transferQueue cannot blit.
+        bool _warnedMipmapGeneration = false;
+
+        /// next value to signal on the timelineSemaphore, advanced by two per submission to reserve the consumer's value.
+        uint64_t _nextTimelineValue = 1;
+
         struct Frame
         {
             ref_ptr<CommandBuffer> transferCommandBuffer;
@@ -77,6 +117,7 @@ namespace vsg
             ref_ptr<Buffer> staging;
             void* buffer_data = nullptr;
             std::vector<VkBufferCopy> copyRegions;
+            uint64_t consumerTimelineValue = 0;
         };
 
         std::vector<Frame> _frames;
@@ -0,0 +1,73 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/state/Image.h>
+#include <vsg/vk/Device.h>
+
+namespace vsg
+{
+
+    /// TransientAttachments aliases the memory of framebuffer attachments whose lifetimes don't overlap,
+    /// so a chain of render to texture passes no longer holds every intermediate attachment alive for the
+    /// whole session when each is only live for a couple of passes.
+    ///
+    /// Declare each attachment Image along with the half open range of passes over which its contents are
+    /// live, using the pass order the RenderGraphs are recorded in (such as the order built by FrameGraph).
+    /// compile() then creates the VkImages, computes a placement where attachments with disjoint lifetimes
+    /// share the same region of a DeviceMemory allocation, and binds them at the computed offsets - in
+    /// place of the per image allocations Image::compile() would make. Call before the Images are compiled
+    /// by the Viewer, i.e. before the Framebuffers using them are created.
+    ///
+    /// Attachments used only as attachments (no sampled/transfer usage) are additionally given
+    /// VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT and their memory is allocated from a
+    /// VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT memory type when the device provides one, so tilers can
+    /// keep them entirely on chip.
+    ///
+    /// An attachment that takes over an aliased region has undefined contents at the start of its
+    /// lifetime, so aliased attachments must be initialized by their render pass via
+    /// VK_ATTACHMENT_LOAD_OP_CLEAR or VK_ATTACHMENT_LOAD_OP_DONT_CARE.
+    class VSG_DECLSPEC TransientAttachments : public Inherit<Object, TransientAttachments>
+    {
+    public:
+        TransientAttachments();
+
+        struct Attachment
+        {
+            ref_ptr<Image> image;
+            uint32_t firstPass = 0;
+            uint32_t lastPass = 0; // inclusive, the last pass that reads or writes the attachment
+        };
+
+        std::vector<Attachment> attachments;
+
+        /// set to false to keep the declared image usage unchanged and allocate from device local memory only
+        bool useTransientAttachments = true;
+
+        /// declare an attachment live over the inclusive pass range [firstPass, lastPass]
+        void add(ref_ptr<Image> image, uint32_t firstPass, uint32_t lastPass);
+
+        /// create the VkImages, compute the aliased placement and bind the attachments to shared DeviceMemory
+        void compile(Device* device);
+
+        /// total size of the shared allocations made by compile(), for comparison against the sum of the individual image sizes
+        VkDeviceSize totalMemorySize() const { return _totalMemorySize; }
+
+    protected:
+        virtual ~TransientAttachments();
+
+        VkDeviceSize _totalMemorySize = 0;
+    };
+    VSG_type_name(vsg::TransientAttachments);
+
+} // namespace vsg
@@ -12,7 +12,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
-#include <vsg/threading/OperationQueue.h>
+#include <vsg/threading/OperationThreads.h>
 
 #include <list>
 #include <mutex>
@@ -36,8 +36,17 @@ namespace vsg
         using value_type = ref_ptr<Operation>;
         using container_type = std::list<value_type>;
 
-        /// add operation
-        virtual void add(ref_ptr<Operation> op, RunBehavior runBehavior = ONE_TIME);
+        /// optional threads that operations flagged independent are distributed across, with the
+        /// calling thread helping and joining all of them before run() returns, so updates still
+        /// complete before the record traversals start. When unassigned all operations run serially.
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// when true an operation enqueued multiple times in the same frame is run only once per frame
+        bool coalesceDuplicates = true;
+
+        /// add operation, flag it independent when it doesn't depend on the ordering or results of
+        /// other update operations and may be run in parallel with them on operationThreads
+        virtual void add(ref_ptr<Operation> op, RunBehavior runBehavior = ONE_TIME, bool independent = false);
 
         /// remove operation
         virtual void remove(ref_ptr<Operation> op);
@@ -45,6 +54,9 @@ namespace vsg
         /// clear all update operations
         void clear();
 
+        /// return true if no update operations are pending
+        bool empty() const;
+
         /// get a copy of all current one time updated operations
         container_type getUpdateOperationsOneTime() const;
 
@@ -57,9 +69,15 @@ namespace vsg
     protected:
         virtual ~UpdateOperations();
 
+        struct Entry
+        {
+            ref_ptr<Operation> operation;
+            bool independent = false;
+        };
+
         mutable std::mutex _updateOperationMutex;
-        std::list<ref_ptr<Operation>> _updateOperationsOneTime;
-        std::list<ref_ptr<Operation>> _updateOperationsAllFrames;
+        std::list<Entry> _updateOperationsOneTime;
+        std::list<Entry> _updateOperationsAllFrames;
     };
     VSG_type_name(vsg::UpdateOperations);
 
@@ -0,0 +1,98 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/quat.h>
+#include <vsg/nodes/MatrixTransform.h>
+#include <vsg/threading/OperationQueue.h>
+#include <vsg/ui/UIEvent.h>
+
+#include <thread>
+
+namespace vsg
+{
+
+    /// UpdateThread runs simulation/update work at its own fixed rate on a dedicated thread,
+    /// decoupling its cost from the viewer's render loop. The update operation writes its results
+    /// into simulationMatrices, which are snapshotted after each step; the render thread calls
+    /// apply() before record to copy the latest complete snapshot into the registered scene
+    /// transforms, optionally interpolating between the two most recent steps, so a 20ms physics
+    /// step slows the simulation rather than dropping render frames. Assign to Viewer::updateThread
+    /// to have Viewer::update() call apply() automatically. The update operation must only write
+    /// simulationMatrices - apply() is the sole writer of the scene transforms, keeping the handoff
+    /// free of races without locking the scene graph.
+    class VSG_DECLSPEC UpdateThread : public Inherit<Object, UpdateThread>
+    {
+    public:
+        explicit UpdateThread(ref_ptr<Operation> in_updateOperation, double in_updatesPerSecond = 50.0, ref_ptr<ActivityStatus> in_status = {});
+        UpdateThread(const UpdateThread&) = delete;
+        UpdateThread& operator=(const UpdateThread&) = delete;
+
+        /// the operation run once per update step on the update thread
+        ref_ptr<Operation> updateOperation;
+
+        /// rate the update thread steps at, independent of the render frame rate
+        double updatesPerSecond;
+
+        /// when true apply() blends between the two most recent snapshots to the render time,
+        /// when false the latest complete snapshot is written unmodified
+        bool interpolate = true;
+
+        /// scene transforms that apply() writes the snapshotted matrices into, assign before start()
+        std::vector<ref_ptr<MatrixTransform>> transforms;
+
+        /// the update operation's output, one matrix per entry in transforms, written on the update
+        /// thread and snapshotted after each step. Resized to match transforms by start().
+        std::vector<dmat4> simulationMatrices;
+
+        ref_ptr<ActivityStatus> status;
+
+        /// start the update thread
+        void start();
+
+        /// stop the update thread and join it
+        void stop();
+
+        /// write the latest complete snapshot into the registered transforms, interpolating between
+        /// the two most recent snapshots to the specified time when interpolate is true.
+        /// Call from the render thread before recording, or assign to Viewer::updateThread.
+        void apply(clock::time_point time);
+
+        /// convenience apply() that interpolates to now less one update period, keeping the render
+        /// time inside the interval the two retained snapshots bracket
+        void apply();
+
+    protected:
+        virtual ~UpdateThread();
+
+        /// decomposed transform state captured at the end of one update step
+        struct Snapshot : public Inherit<Object, Snapshot>
+        {
+            clock::time_point time;
+            std::vector<dvec3> translations;
+            std::vector<dquat> rotations;
+            std::vector<dvec3> scales;
+        };
+
+        void _run();
+        void _snapshot();
+
+        std::thread _thread;
+
+        std::mutex _snapshotMutex;
+        ref_ptr<Snapshot> _latest;
+        ref_ptr<Snapshot> _previous;
+    };
+    VSG_type_name(vsg::UpdateThread);
+
+} // namespace vsg
@@ -86,6 +86,43 @@ namespace vsg
         /// override states for customization of graphics pipelines for this view
         GraphicsPipelineStates overridePipelineStates;
 
+        /// opt-in VK_KHR_multiview stereo - relative view matrices, one per multiview eye, applied on top of
+        /// the camera's view matrix. When non-empty the ViewDependentState uploads the per eye matrices each
+        /// frame to the "eyeMatrices" descriptor of ShaderSets that declare it, with vertex shaders selecting
+        /// their eye's matrix using gl_ViewIndex. Pair the View with a RenderGraph assigned a renderPass
+        /// created via vsg::createMultiviewRenderPass(..) and a layered framebuffer, so both eyes are rendered
+        /// by a single record traversal rather than one View per eye.
+        std::vector<dmat4> eyeOffsets;
+
+        /// opt-in depth pre-pass - when enabled RecordTraversal records the opaque bins, those not using the
+        /// DESCENDING/DESCENDING_RADIX sort orders, twice: first with depthPrePassMask assigned to the
+        /// CommandBuffer's traversalMask so StateSwitch entries, such as those created by
+        /// GraphicsPipelineConfigurator::enableDepthPrePass(), bind depth only pipeline variants, then again
+        /// normally for the color pass. Both passes replay the same bin contents so the scene is still only
+        /// traversed and culled once per frame.
+        bool depthPrePass = false;
+
+        /// mask assigned to the CommandBuffer's traversalMask while recording the depth pre-pass,
+        /// assign a dedicated mask bit matching the one passed to GraphicsPipelineConfigurator::enableDepthPrePass().
+        Mask depthPrePassMask = MASK_ALL;
+
+        /// scale factor applied to the LOD cutoff distances while recording this View's subgraph,
+        /// values greater than 1.0 select coarser LOD/PagedLOD children - useful for rendering
+        /// shadow maps and other secondary views at reduced detail.
+        double lodScale = 1.0;
+
+        /// when greater than zero, cull CullNode/CullGroup/LOD subgraphs whose bounding sphere projects
+        /// to a screen height ratio below this value - set to 1.0/renderTargetHeight to skip sub pixel features.
+        double smallFeatureCullingRatio = 0.0;
+
+        /// opt-in relative-to-eye rendering for georeferenced/whole earth scenes, such as those built
+        /// around EllipsoidModel, where world coordinates are too large for float precision. When enabled
+        /// the State's modelview stack maintains a float shadow stack rebased about the camera's eye point
+        /// each frame, so the matrices pushed to shaders are jitter free floats and per node matrix
+        /// multiplies run through the SIMD float path, while culling and LOD selection continue to use
+        /// the full double precision stack.
+        bool relativeToEye = false;
+
     protected:
         virtual ~View();
     };
@@ -14,6 +14,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/animation/AnimationManager.h>
 #include <vsg/app/CompileManager.h>
+#include <vsg/app/FramePacer.h>
+#include <vsg/app/UpdateThread.h>
 #include <vsg/app/Presentation.h>
 #include <vsg/app/RecordAndSubmitTask.h>
 #include <vsg/app/UpdateOperations.h>
@@ -22,10 +24,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/threading/FrameBlock.h>
 #include <vsg/utils/Instrumentation.h>
 
+#include <atomic>
 #include <map>
 
 namespace vsg
 {
+    // forward declare
+    class DestructionQueue;
 
     /// Viewer provides high level viewer functionality for managing windows, handling events and recording and submitting
     /// command graphs for compute and rendering.
@@ -61,6 +66,11 @@ namespace vsg
         /// poll the events for all attached windows, return true if new events are available
         virtual bool pollEvents(bool discardPreviousEvents = true);
 
+        /// when true pollEvents() coalesces high rate events ahead of dispatch - consecutive pointer
+        /// moves collapse to the most recent and consecutive scroll wheel events sum their deltas -
+        /// so 1kHz mice don't flood handleEvents(). Set to false when every intermediate event is required.
+        bool coalesceEvents = true;
+
         /// get the current set of Events that are filled in by prior calls to pollEvents
         UIEvents& getEvents() { return _events; }
 
@@ -90,6 +100,47 @@ namespace vsg
         /// manager for starting and running animations
         ref_ptr<AnimationManager> animationManager;
 
+        /// optional frame pacer, when assigned advanceToNextFrame() delays the frame start to pace frames against the display refresh
+        ref_ptr<FramePacer> framePacer;
+
+        /// opt-in render on demand - when true advanceToNextFrame() blocks until something has marked the
+        /// scene dirty: new window events, pending update operations, playing animations, DatabasePager
+        /// loads/merges in flight, dynamic data modified since its last transfer, or an explicit
+        /// requestRedraw() call. Static scenes then render zero frames while idle, while interaction
+        /// latency is unchanged as events are polled throughout the wait.
+        bool renderOnDemand = false;
+
+        /// interval, in seconds, between event polls while advanceToNextFrame() waits for the scene to be marked dirty in render on demand mode
+        double renderOnDemandPollInterval = 0.001;
+
+        /// mark the scene dirty so that the next advanceToNextFrame() call renders a frame, thread safe so may be called from background threads
+        void requestRedraw() { _redrawRequested.store(true); }
+
+        /// when true setupThreading() applies topology aware thread placement, pinning each record
+        /// thread to a distinct physical performance core via renderThreadAffinity(). Set to false
+        /// before setupThreading() to leave placement to the OS scheduler or to hand-tuned affinities.
+        bool automaticThreadAffinity = true;
+
+        /// opt-in synchronized presentation for multi device configurations, such as a single scene graph
+        /// rendered by per Device CommandGraphs driving one display per GPU. Vulkan semaphores cannot span
+        /// devices, so when true present() first waits on every RecordAndSubmitTask's current frame fence
+        /// and only then issues all the queue presents back to back, keeping the swapchain flips of the
+        /// separate devices aligned to the same refresh rather than drifting independently. Requires the
+        /// VSG was built with VSG_MAX_DEVICES set to the number of devices in use.
+        bool synchronizedPresentation = false;
+
+        /// number of CPU frames allowed in flight, independent of the swapchain image count. Sizes all the
+        /// per frame rings created by assignRecordAndSubmitTaskAndPresentation() - each RecordAndSubmitTask's
+        /// fence ring, its early/late TransferTask staging frames and the CommandBuffer pools that grow to
+        /// match the overlap - and is propagated to the compile Contexts so that per frame resources in the
+        /// scene graph, such as DynamicUniformRing regions and OcclusionQueryNode query pools, are sized
+        /// consistently. Set to 1 to serialize the CPU against the GPU for minimum latency, or raise to 3-4
+        /// to absorb frame time spikes on latency tolerant displays. Set before assigning windows/CommandGraphs.
+        uint32_t framesInFlight = 3;
+
+        /// optional decoupled update thread, when assigned update() applies its latest transform snapshot each frame
+        ref_ptr<UpdateThread> updateThread;
+
         /// compile manager provides thread safe support for compiling subgraphs
         ref_ptr<CompileManager> compileManager;
 
@@ -106,6 +157,26 @@ namespace vsg
 
         virtual void compile(ref_ptr<ResourceHints> hints = {});
 
+        /// optional filename used to persist captured ResourceHints between runs. When set, compile() reads
+        /// the hints from the file when the caller doesn't provide any, so descriptor pools and device
+        /// memory are sized to the previous run's recorded peak before the first frame. Call
+        /// writeResourceHints() at the end of a session to capture and save the hints.
+        Path resourceHintsFilename;
+
+        /// optional scene file the persisted ResourceHints are keyed to. When set, writeResourceHints()
+        /// stamps the hints with the file's modification stamp and compile() only applies hints read from
+        /// resourceHintsFilename when the stamp still matches, so requirements captured from a previous
+        /// run are never applied to a scene file that has since changed.
+        Path resourceHintsSceneFilename;
+
+        /// return ResourceHints capturing the resource requirements recorded by compile() and by all the
+        /// CompileManager compilations made during the session, or an empty ref_ptr when nothing has been compiled.
+        ref_ptr<ResourceHints> captureResourceHints() const;
+
+        /// write the ResourceHints returned by captureResourceHints() to the specified file, or to
+        /// resourceHintsFilename when no filename is specified, returning true on success.
+        bool writeResourceHints(const Path& filename = {}, ref_ptr<const Options> options = {});
+
         virtual bool acquireNextFrame();
 
         /// call vkWaitForFence on the fences associated with previous frames RecordAndSubmitTask, a relativeFrameIndex of 1 is the previous frame, 2 is two frames ago.
@@ -141,6 +212,13 @@ namespace vsg
         /// Call vkDeviceWaitIdle on all the devices associated with this Viewer
         virtual void deviceWaitIdle() const;
 
+        /// Hand an object, typically a subgraph just removed from the scene or a closed window's resources, to the
+        /// devices' DestructionQueues: a reference is retained until the current frame's fences signal, then dropped
+        /// so the object's destructors release its Vulkan handles, making large removals stall free rather than
+        /// requiring a deviceWaitIdle() pipeline drain. The handover to the queues happens at the end of
+        /// recordAndSubmit(), so call at any point in the frame loop before then.
+        virtual void deferDestruction(ref_ptr<Object> object);
+
         /// Hook for assigning Instrumentation to enable profiling of record traversal.
         uint64_t frameReference = 0;
         ref_ptr<Instrumentation> instrumentation;
@@ -151,8 +229,13 @@ namespace vsg
     protected:
         virtual ~Viewer();
 
+        /// return true if anything requires a new frame to be rendered, consuming any pending requestRedraw() request
+        virtual bool requiresRedraw();
+
         bool _close = false;
 
+        std::atomic_bool _redrawRequested{true};
+
         ref_ptr<FrameStamp> _frameStamp;
 
         Windows _windows;
@@ -164,6 +247,12 @@ namespace vsg
         bool _threading = false;
         ref_ptr<FrameBlock> _frameBlock;
         ref_ptr<Barrier> _submissionCompleted;
+
+        ref_ptr<ResourceHints> _capturedResourceHints;
+
+        /// owning references to the per device DestructionQueues populated by deferDestruction(), advanced with
+        /// the frame's fences at the end of recordAndSubmit().
+        std::map<ref_ptr<Device>, ref_ptr<DestructionQueue>> _destructionQueues;
     };
     VSG_type_name(vsg::Viewer);
 
@@ -24,6 +24,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 namespace vsg
 {
 
+    class EventPool;
+
     /// Window base class provides a cross platform window
     /// The Android_Window, iOS_Window, MacOS_Window, Xcb_Window and Win32_Window classes derived from Window provide
     /// the platform specific implementations of Window that are created by Window::create(traits).
@@ -53,6 +55,9 @@ namespace vsg
         /// events buffered since the last pollEvents.
         UIEvents bufferedEvents;
 
+        /// pool used by the windowing implementations to recycle high rate move/scroll/touch events
+        ref_ptr<EventPool> eventPool;
+
         /// get the list of events since the last pollEvents() call by splicing bufferEvents with polled windowing events.
         virtual bool pollEvents(UIEvents& events);
 
@@ -61,6 +61,11 @@ namespace vsg
         // X11 hint of whether to ignore the Window managers redirection of window size/position
         bool overrideRedirect = false;
 
+        // hint that the window should drain native windowing events on a dedicated thread into the
+        // buffered event queue, so pollEvents() on the frame loop just splices an already filled queue
+        // rather than making windowing system calls. Currently implemented by the xcb platform layer.
+        bool dedicatedEventThread = false;
+
         uint32_t vulkanVersion = VK_API_VERSION_1_0;
 
         SwapchainPreferences swapchainPreferences;
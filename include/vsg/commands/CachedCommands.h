@@ -0,0 +1,78 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/Camera.h>
+#include <vsg/app/SecondaryCommandGraph.h>
+
+namespace vsg
+{
+
+    /// CachedCommands captures its SecondaryCommandGraph's subgraph into a Vulkan secondary command buffer on first
+    /// record, then replays that command buffer on subsequent frames, avoiding re-recording identical commands for
+    /// static subgraphs every frame. The capture is re-recorded when invalidate() is called, or automatically when
+    /// any dynamic data within the subgraph is modified or the view/projection matrices of contained Cameras change.
+    /// As with ExecuteCommands, the render pass that the CachedCommands is recorded within must use
+    /// VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+    class VSG_DECLSPEC CachedCommands : public Inherit<Command, CachedCommands>
+    {
+    public:
+        explicit CachedCommands(ref_ptr<SecondaryCommandGraph> in_secondaryCommandGraph = {});
+
+        /// SecondaryCommandGraph that provides the subgraph to capture and the secondary CommandBuffer it is recorded to.
+        ref_ptr<SecondaryCommandGraph> secondaryCommandGraph;
+
+        /// number of subsequent records an invalidated command buffer is retained for before its CommandBuffer can be
+        /// re-recorded, must cover the number of frames that can be in flight.
+        uint32_t retentionFrames = 3;
+
+        /// mark the cached command buffer as invalid so the subgraph is re-recorded on the next record.
+        void invalidate();
+
+        /// replay the cached secondary command buffer, capturing the subgraph first when the cache is empty or invalidated.
+        void record(CommandBuffer& commandBuffer) const override;
+
+    protected:
+        virtual ~CachedCommands();
+
+        struct TrackedData
+        {
+            ref_ptr<const Data> data;
+            ModifiedCount modifiedCount;
+        };
+
+        struct TrackedCamera
+        {
+            ref_ptr<Camera> camera;
+            dmat4 viewMatrix;
+            dmat4 projectionMatrix;
+        };
+
+        struct RetiredCommandBuffer
+        {
+            ref_ptr<CommandBuffer> commandBuffer;
+            uint32_t framesRemaining = 0;
+        };
+
+        void _invalidate() const;
+        bool _subgraphModified() const;
+
+        mutable std::mutex _mutex;
+        mutable ref_ptr<CommandBuffer> _commandBuffer;
+        mutable std::vector<TrackedData> _trackedData;
+        mutable std::vector<TrackedCamera> _trackedCameras;
+        mutable std::vector<RetiredCommandBuffer> _retired;
+    };
+    VSG_type_name(vsg::CachedCommands);
+
+} // namespace vsg
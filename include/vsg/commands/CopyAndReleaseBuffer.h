@@ -17,6 +17,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/commands/Command.h>
 
+#include <map>
+
 namespace vsg
 {
 
@@ -31,6 +33,11 @@ namespace vsg
         /// MemoryBufferPools used for allocation of staging buffer used by the copy(ref_ptr<Data>, BufferInfo) method.  Users should assign MemoryBufferPools with appropriate settings.
         ref_ptr<MemoryBufferPools> stagingMemoryBufferPools;
 
+        /// byte budget of completed staging BufferInfos retained for reuse by subsequent copy() calls,
+        /// avoiding a release and re-reserve round trip through the staging MemoryBufferPools for
+        /// streaming workloads that upload similar amounts of data every frame. Set to 0 to disable recycling.
+        VkDeviceSize maximumRecycledStagingBytes = 16 * 1024 * 1024;
+
         void copy(ref_ptr<Data> data, ref_ptr<BufferInfo> dest);
 
         void record(CommandBuffer& commandBuffer) const override;
@@ -42,14 +49,18 @@ namespace vsg
         {
             ref_ptr<BufferInfo> source;
             ref_ptr<BufferInfo> destination;
-
-            void record(CommandBuffer& commandBuffer) const;
+            bool recyclableSource = false;
         };
 
+        ref_ptr<BufferInfo> _recycleStagingBuffer(VkDeviceSize size, VkDeviceSize alignment) const;
+        void _addToRecycledStagingBuffers(ref_ptr<BufferInfo> source) const; // _mutex must be held by the caller
+
         mutable std::mutex _mutex;
         mutable std::vector<CopyData> _pending;
         mutable std::vector<CopyData> _completed;
         mutable std::vector<CopyData> _readyToClear;
+        mutable std::multimap<VkDeviceSize, ref_ptr<BufferInfo>> _recycledStagingBufferInfos;
+        mutable VkDeviceSize _recycledStagingBytes = 0;
     };
 
 } // namespace vsg
@@ -17,6 +17,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/commands/Command.h>
 
+#include <map>
+
 namespace vsg
 {
 
@@ -42,6 +44,8 @@ namespace vsg
             uint32_t depth = 0;
             Data::MipmapOffsets mipmapOffsets;
 
+            bool recyclableSource = false;
+
             void record(CommandBuffer& commandBuffer) const;
         };
 
@@ -52,6 +56,11 @@ namespace vsg
         /// MemoryBufferPools used for allocation of staging buffer used by the copy(ref_ptr<Data>, ImageInfo) method.  Users should assign MemoryBufferPools with appropriate settings.
         ref_ptr<MemoryBufferPools> stagingMemoryBufferPools;
 
+        /// byte budget of completed staging BufferInfos retained for reuse by subsequent copy() calls,
+        /// saving the staging MemoryBufferPools release/re-reserve cycle when textures of similar sizes
+        /// are streamed in every frame. Set to 0 to disable recycling.
+        VkDeviceSize maximumRecycledStagingBytes = 16 * 1024 * 1024;
+
         /// copy data into a staging buffer and then use copy command to transfer this to the GPU image specified by ImageInfo
         void copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest);
         void copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest, uint32_t numMipMapLevels);
@@ -63,10 +72,15 @@ namespace vsg
 
         void _copyDirectly(ref_ptr<Data> data, ref_ptr<ImageInfo> dest, uint32_t numMipMapLevels);
 
+        ref_ptr<BufferInfo> _recycleStagingBuffer(VkDeviceSize size, VkDeviceSize alignment) const;
+        void _addToRecycledStagingBuffers(ref_ptr<BufferInfo> source) const; // _mutex must be held by the caller
+
         mutable std::mutex _mutex;
         mutable std::vector<CopyData> _pending;
         mutable std::vector<CopyData> _completed;
         mutable std::vector<CopyData> _readyToClear;
+        mutable std::multimap<VkDeviceSize, ref_ptr<BufferInfo>> _recycledStagingBufferInfos;
+        mutable VkDeviceSize _recycledStagingBytes = 0;
     };
 
 } // namespace vsg
@@ -34,7 +34,7 @@ namespace vsg
 
         void record(CommandBuffer& commandBuffer) const override
         {
-            vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+            commandBuffer.dispatch->vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
         }
 
         uint32_t groupCountX = 0;
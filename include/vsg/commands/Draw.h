@@ -38,7 +38,7 @@ namespace vsg
 
         void record(CommandBuffer& commandBuffer) const override
         {
-            vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+            commandBuffer.dispatch->vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
         }
 
         uint32_t vertexCount = 0;
@@ -39,7 +39,7 @@ namespace vsg
 
         void record(CommandBuffer& commandBuffer) const override
         {
-            vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+            commandBuffer.dispatch->vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
         }
 
         uint32_t indexCount = 0;
@@ -48,4 +48,37 @@ namespace vsg
 
     VSG_array(DrawIndirectCommandArray, DrawIndirectCommand);
 
+    /// Equivalent to VkDrawIndexedIndirectCommand that adds read/write support
+    struct DrawIndexedIndirectCommand
+    {
+        uint32_t indexCount;
+        uint32_t instanceCount;
+        uint32_t firstIndex;
+        int32_t vertexOffset;
+        uint32_t firstInstance;
+
+        void read(vsg::Input& input)
+        {
+            input.read("indexCount", indexCount);
+            input.read("instanceCount", instanceCount);
+            input.read("firstIndex", firstIndex);
+            input.read("vertexOffset", vertexOffset);
+            input.read("firstInstance", firstInstance);
+        }
+
+        void write(vsg::Output& output) const
+        {
+            output.write("indexCount", indexCount);
+            output.write("instanceCount", instanceCount);
+            output.write("firstIndex", firstIndex);
+            output.write("vertexOffset", vertexOffset);
+            output.write("firstInstance", firstInstance);
+        }
+    };
+
+    template<>
+    constexpr bool has_read_write<DrawIndexedIndirectCommand>() { return true; }
+
+    VSG_array(DrawIndexedIndirectCommandArray, DrawIndexedIndirectCommand);
+
 } // namespace vsg
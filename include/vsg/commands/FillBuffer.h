@@ -0,0 +1,43 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Command.h>
+#include <vsg/state/Buffer.h>
+
+namespace vsg
+{
+
+    /// FillBuffer command encapsulates vkCmdFillBuffer functionality and associated settings.
+    /// Must be recorded outside a render pass.
+    class VSG_DECLSPEC FillBuffer : public Inherit<Command, FillBuffer>
+    {
+    public:
+        FillBuffer() {}
+
+        FillBuffer(ref_ptr<Buffer> in_buffer, VkDeviceSize in_dstOffset, VkDeviceSize in_size, uint32_t in_data) :
+            buffer(in_buffer),
+            dstOffset(in_dstOffset),
+            size(in_size),
+            data(in_data) {}
+
+        ref_ptr<Buffer> buffer;
+        VkDeviceSize dstOffset = 0;
+        VkDeviceSize size = VK_WHOLE_SIZE;
+        uint32_t data = 0;
+
+        void record(CommandBuffer& commandBuffer) const override;
+    };
+    VSG_type_name(vsg::FillBuffer);
+
+} // namespace vsg
@@ -14,8 +14,11 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/core/MemorySlots.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace vsg
@@ -25,7 +28,8 @@ namespace vsg
         ALLOCATOR_TYPE_NO_DELETE = 0,
         ALLOCATOR_TYPE_NEW_DELETE,
         ALLOCATOR_TYPE_MALLOC_FREE,
-        ALLOCATOR_TYPE_VSG_ALLOCATOR
+        ALLOCATOR_TYPE_VSG_ALLOCATOR,
+        ALLOCATOR_TYPE_THREAD_LOCAL /// MemoryBlocks fronted by per-thread magazines so the common small object allocation path is lock-free
     };
 
     enum AllocatorAffinity : uint32_t
@@ -52,9 +56,30 @@ namespace vsg
         /// allocate from the pool of memory blocks, or allocate from a new memory block
         virtual void* allocate(std::size_t size, AllocatorAffinity allocatorAffinity = ALLOCATOR_AFFINITY_OBJECTS);
 
-        /// deallocate, returning data to pool.
+        /// deallocate, returning data to pool. When deferDeallocations is true the allocation is queued
+        /// and released by the next drainDeferredDeallocations() call rather than taking the pool mutex.
         virtual bool deallocate(void* ptr, std::size_t size);
 
+        /// deallocate a batch of allocations in a single acquisition of the pool mutex,
+        /// returns the number of allocations successfully returned to the pool.
+        virtual size_t deallocateBatch(const std::vector<std::pair<void*, std::size_t>>& allocations);
+
+        /// when true deallocate() appends to the deferred list instead of releasing immediately, so
+        /// destroying a large subgraph costs one list append per object rather than one mutex/pool
+        /// operation per object. Queued allocations are released by drainDeferredDeallocations().
+        std::atomic_bool deferDeallocations{false};
+
+        /// release all queued deferred deallocations in a single acquisition of the pool mutex,
+        /// returns the number of allocations released. Call from a frame-idle point or let the
+        /// background drain thread handle it.
+        virtual size_t drainDeferredDeallocations();
+
+        /// start a background thread that periodically drains the deferred deallocation list
+        void startDeferredDeallocationThread(uint32_t interval_milliseconds = 16);
+
+        /// stop the background drain thread, draining anything still queued
+        void stopDeferredDeallocationThread();
+
         /// delete any MemoryBlock that are empty
         virtual size_t deleteEmptyMemoryBlocks();
 
@@ -78,7 +103,7 @@ namespace vsg
 
         struct MemoryBlock
         {
-            MemoryBlock(size_t blockSize, int memoryTracking, size_t in_alignment);
+            MemoryBlock(size_t blockSize, int memoryTracking, size_t in_alignment, int in_numaNode = -1, bool in_useHugePages = false);
             virtual ~MemoryBlock();
 
             void* allocate(std::size_t size);
@@ -88,6 +113,10 @@ namespace vsg
             size_t alignment = 4;
             size_t block_alignment = 16;
             uint8_t* memory = nullptr;
+
+            int numaNode = -1;
+            bool useHugePages = false;
+            size_t mappedSize = 0; // non zero when the block is backed by a platform memory mapping rather than operator new
         };
 
         struct MemoryBlocks
@@ -96,6 +125,8 @@ namespace vsg
             std::string name;
             size_t blockSize = 0;
             size_t alignment = 4;
+            int numaNode = -1;         /// NUMA node to bind new MemoryBlocks to, -1 leaves placement to the OS
+            bool useHugePages = false; /// back new MemoryBlocks with huge pages where the platform supports it
             std::map<void*, std::shared_ptr<MemoryBlock>> memoryBlocks;
             std::shared_ptr<MemoryBlock> latestMemoryBlock;
 
@@ -117,6 +148,11 @@ namespace vsg
 
         void setBlockSize(AllocatorAffinity allocatorAffinity, size_t blockSize);
 
+        /// set the NUMA node binding and huge page backing applied to MemoryBlocks subsequently created
+        /// for an affinity. Existing blocks are left where they are, so configure placement at startup
+        /// alongside setBlockSize().
+        void setBlockPlacement(AllocatorAffinity allocatorAffinity, int numaNode, bool useHugePages = false);
+
         mutable std::mutex mutex;
 
         size_t default_alignment = 4;
@@ -125,10 +161,33 @@ namespace vsg
         double deallocationTime = 0.0;
 
     protected:
+        /// deallocate with the pool mutex already held by the caller
+        bool _deallocate(void* ptr, std::size_t size);
+
+        /// serve a small allocation from the calling thread's magazine, refilling from the shared
+        /// MemoryBlocks in batches, returns nullptr when the allocation can't be served locally.
+        /// Select ALLOCATOR_TYPE_THREAD_LOCAL before making any allocations - the magazines round
+        /// allocations up to their size classes, so mixing with allocations made under a different
+        /// AllocatorType would release mismatched sizes back to the MemorySlots.
+        void* _threadLocalAllocate(std::size_t size, AllocatorAffinity allocatorAffinity);
+
+        /// return a small allocation to the calling thread's magazine, flushing to the shared
+        /// MemoryBlocks in batches when the magazine is full
+        bool _threadLocalDeallocate(void* ptr, std::size_t size);
+
         // if you are assigning a custom allocator you must retain the old allocator to manage the memory it allocated and needs to delete
         std::unique_ptr<Allocator> nestedAllocator;
 
         std::vector<std::unique_ptr<MemoryBlocks>> allocatorMemoryBlocks;
+
+        // deferred deallocation list, guarded by its own light weight mutex so queuing doesn't contend with the pool mutex
+        mutable std::mutex _deferredMutex;
+        std::vector<std::pair<void*, std::size_t>> _deferredDeallocations;
+
+        // optional background drain thread
+        std::thread _drainThread;
+        std::atomic_bool _drainThreadActive{false};
+        std::condition_variable _drainCV;
     };
 
     /// allocate memory using vsg::Allocator::instance() if available, otherwise use std::malloc(size)
@@ -49,6 +49,15 @@ namespace vsg
             _data(nullptr),
             _size(rhs._size)
         {
+            if (copyop.copyOnWriteData && rhs._data)
+            {
+                // alias the source's buffer, deferring the copy until the first write to this Array
+                _storage = ref_ptr<Data>(const_cast<Array*>(&rhs));
+                _cowSource = _storage;
+                _data = rhs._data;
+                ++_modifiedCount;
+                return;
+            }
             if (_size != 0)
             {
                 _data = _allocate(_size);
@@ -158,6 +167,30 @@ namespace vsg
             {
                 size_t new_total_size = computeValueCountIncludingMipmaps(width_size, 1, 1, properties.maxNumMipmaps);
 
+                // zero copy path - alias memory mapped storage provided by the input rather than allocating and copying
+                size_t mapped_offset = 0;
+                if (auto mapped_storage = input.mappedStorage(new_total_size * sizeof(value_type), alignof(value_type), mapped_offset))
+                {
+                    clear();
+
+                    _storage = mapped_storage;
+                    properties.stride = sizeof(value_type);
+                    _data = reinterpret_cast<value_type*>(static_cast<uint8_t*>(mapped_storage->dataPointer()) + mapped_offset);
+                    _size = width_size;
+
+                    // serialize as inline data and take a private copy on first write access, via the copy-on-write machinery
+                    _cowSource = _storage;
+                    ++_modifiedCount;
+                    return;
+                }
+
+                if (_cowSource) // a copy-on-write aliased buffer isn't owned so can't be reused or read into
+                {
+                    _cowSource = nullptr;
+                    _storage = nullptr;
+                    _data = nullptr;
+                }
+
                 if (_data) // if data exists already may be able to reuse it
                 {
                     if (original_total_size != new_total_size) // if existing data is a different size delete old, and create new
@@ -187,8 +220,10 @@ namespace vsg
             Data::write(output);
 
             output.writeValue<uint32_t>("size", _size);
-            output.writeObject("storage", _storage);
-            if (_storage)
+
+            // copy-on-write clones are written out as inline data rather than as a reference to the shared storage
+            output.writeObject("storage", _cowSource ? nullptr : _storage.get());
+            if (_storage && !_cowSource)
             {
                 auto offset = (reinterpret_cast<uintptr_t>(_data) - reinterpret_cast<uintptr_t>(_storage->dataPointer()));
                 output.writeValue<uint32_t>("offset", offset);
@@ -212,6 +247,7 @@ namespace vsg
             _size = 0;
             _data = nullptr;
             _storage = nullptr;
+            _cowSource = nullptr;
         }
 
         Array& operator=(const Array& rhs)
@@ -244,6 +280,7 @@ namespace vsg
             _size = numElements;
             _data = data;
             _storage = nullptr;
+            _cowSource = nullptr;
 
             dirty();
         }
@@ -253,6 +290,7 @@ namespace vsg
             _delete();
 
             _storage = storage;
+            _cowSource = nullptr;
             properties = in_properties;
             properties.stride = stride;
             if (_storage && _storage->dataPointer())
@@ -292,12 +330,37 @@ namespace vsg
         bool dataAvailable() const override { return available(); }
         size_t dataSize() const override { return size() * properties.stride; }
 
-        void* dataPointer() override { return _data; }
+        void* dataPointer() override
+        {
+            duplicateData();
+            return _data;
+        }
         const void* dataPointer() const override { return _data; }
 
-        void* dataPointer(size_t i) override { return data(i); }
+        void* dataPointer(size_t i) override
+        {
+            duplicateData();
+            return data(i);
+        }
         const void* dataPointer(size_t i) const override { return data(i); }
 
+        /// take a private copy of a buffer shared via a copy-on-write clone(), no-op when the buffer is already unique.
+        void duplicateData() override
+        {
+            if (!_cowSource) return;
+
+            auto shared_source = _cowSource; // keep the shared buffer alive while copying from it
+            _cowSource = nullptr;
+            _storage = nullptr;
+
+            const_iterator src_itr{_data, properties.stride};
+            _data = _allocate(_size);
+            properties.stride = sizeof(value_type);
+
+            auto dest_v = _data;
+            for (uint32_t i = 0; i < _size; ++i, ++src_itr) *(dest_v++) = *src_itr;
+        }
+
         uint32_t dimensions() const override { return 1; }
 
         uint32_t width() const override { return _size; }
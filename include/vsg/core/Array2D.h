@@ -49,6 +49,15 @@ namespace vsg
             _width(rhs._width),
             _height(rhs._height)
         {
+            if (copyop.copyOnWriteData && rhs._data)
+            {
+                // alias the source's buffer, deferring the copy until the first write to this Array2D
+                _storage = ref_ptr<Data>(const_cast<Array2D*>(&rhs));
+                _cowSource = _storage;
+                _data = rhs._data;
+                ++_modifiedCount;
+                return;
+            }
             _data = _allocate(static_cast<size_t>(_width) * static_cast<size_t>(_height));
             if (_data)
             {
@@ -137,6 +146,31 @@ namespace vsg
             {
                 size_t new_size = computeValueCountIncludingMipmaps(w, h, 1, properties.maxNumMipmaps);
 
+                // zero copy path - alias memory mapped storage provided by the input rather than allocating and copying
+                size_t mapped_offset = 0;
+                if (auto mapped_storage = input.mappedStorage(new_size * sizeof(value_type), alignof(value_type), mapped_offset))
+                {
+                    clear();
+
+                    _storage = mapped_storage;
+                    properties.stride = sizeof(value_type);
+                    _data = reinterpret_cast<value_type*>(static_cast<uint8_t*>(mapped_storage->dataPointer()) + mapped_offset);
+                    _width = w;
+                    _height = h;
+
+                    // serialize as inline data and take a private copy on first write access, via the copy-on-write machinery
+                    _cowSource = _storage;
+                    ++_modifiedCount;
+                    return;
+                }
+
+                if (_cowSource) // a copy-on-write aliased buffer isn't owned so can't be reused or read into
+                {
+                    _cowSource = nullptr;
+                    _storage = nullptr;
+                    _data = nullptr;
+                }
+
                 if (_data) // if data exists already may be able to reuse it
                 {
                     if (original_size != new_size) // if existing data is a different size delete old, and create new
@@ -168,8 +202,9 @@ namespace vsg
             output.writeValue<uint32_t>("width", _width);
             output.writeValue<uint32_t>("height", _height);
 
-            output.writeObject("storage", _storage);
-            if (_storage)
+            // copy-on-write clones are written out as inline data rather than as a reference to the shared storage
+            output.writeObject("storage", _cowSource ? nullptr : _storage.get());
+            if (_storage && !_cowSource)
             {
                 auto offset = (reinterpret_cast<uintptr_t>(_data) - reinterpret_cast<uintptr_t>(_storage->dataPointer()));
                 output.writeValue<uint32_t>("offset", offset);
@@ -194,6 +229,7 @@ namespace vsg
             _height = 0;
             _data = nullptr;
             _storage = nullptr;
+            _cowSource = nullptr;
         }
 
         Array2D& operator=(const Array2D& rhs)
@@ -228,6 +264,7 @@ namespace vsg
             _height = height;
             _data = data;
             _storage = nullptr;
+            _cowSource = nullptr;
 
             dirty();
         }
@@ -237,6 +274,7 @@ namespace vsg
             _delete();
 
             _storage = storage;
+            _cowSource = nullptr;
             properties = in_properties;
             properties.stride = stride;
             if (_storage && _storage->dataPointer())
@@ -279,12 +317,38 @@ namespace vsg
         bool dataAvailable() const override { return available(); }
         size_t dataSize() const override { return size() * properties.stride; }
 
-        void* dataPointer() override { return _data; }
+        void* dataPointer() override
+        {
+            duplicateData();
+            return _data;
+        }
         const void* dataPointer() const override { return _data; }
 
-        void* dataPointer(size_t i) override { return data(i); }
+        void* dataPointer(size_t i) override
+        {
+            duplicateData();
+            return data(i);
+        }
         const void* dataPointer(size_t i) const override { return data(i); }
 
+        /// take a private copy of a buffer shared via a copy-on-write clone(), no-op when the buffer is already unique.
+        void duplicateData() override
+        {
+            if (!_cowSource) return;
+
+            auto shared_source = _cowSource; // keep the shared buffer alive while copying from it
+            _cowSource = nullptr;
+            _storage = nullptr;
+
+            size_t numValues = static_cast<size_t>(_width) * static_cast<size_t>(_height);
+            const_iterator src_itr{_data, properties.stride};
+            _data = _allocate(numValues);
+            properties.stride = sizeof(value_type);
+
+            auto dest_v = _data;
+            for (size_t i = 0; i < numValues; ++i, ++src_itr) *(dest_v++) = *src_itr;
+        }
+
         uint32_t dimensions() const override { return 2; }
         uint32_t width() const override { return _width; }
         uint32_t height() const override { return _height; }
@@ -50,6 +50,15 @@ namespace vsg
             _height(rhs._height),
             _depth(rhs._depth)
         {
+            if (copyop.copyOnWriteData && rhs._data)
+            {
+                // alias the source's buffer, deferring the copy until the first write to this Array3D
+                _storage = ref_ptr<Data>(const_cast<Array3D*>(&rhs));
+                _cowSource = _storage;
+                _data = rhs._data;
+                ++_modifiedCount;
+                return;
+            }
             _data = _allocate(static_cast<size_t>(_width) * static_cast<size_t>(_height) * static_cast<size_t>(_depth));
             if (_data)
             {
@@ -143,6 +152,32 @@ namespace vsg
             {
                 size_t new_size = computeValueCountIncludingMipmaps(w, h, d, properties.maxNumMipmaps);
 
+                // zero copy path - alias memory mapped storage provided by the input rather than allocating and copying
+                size_t mapped_offset = 0;
+                if (auto mapped_storage = input.mappedStorage(new_size * sizeof(value_type), alignof(value_type), mapped_offset))
+                {
+                    clear();
+
+                    _storage = mapped_storage;
+                    properties.stride = sizeof(value_type);
+                    _data = reinterpret_cast<value_type*>(static_cast<uint8_t*>(mapped_storage->dataPointer()) + mapped_offset);
+                    _width = w;
+                    _height = h;
+                    _depth = d;
+
+                    // serialize as inline data and take a private copy on first write access, via the copy-on-write machinery
+                    _cowSource = _storage;
+                    ++_modifiedCount;
+                    return;
+                }
+
+                if (_cowSource) // a copy-on-write aliased buffer isn't owned so can't be reused or read into
+                {
+                    _cowSource = nullptr;
+                    _storage = nullptr;
+                    _data = nullptr;
+                }
+
                 if (_data) // if data exists already may be able to reuse it
                 {
                     if (original_size != new_size) // if existing data is a different size delete old, and create new
@@ -176,8 +211,9 @@ namespace vsg
             output.writeValue<uint32_t>("height", _height);
             output.writeValue<uint32_t>("depth", _depth);
 
-            output.writeObject("storage", _storage);
-            if (_storage)
+            // copy-on-write clones are written out as inline data rather than as a reference to the shared storage
+            output.writeObject("storage", _cowSource ? nullptr : _storage.get());
+            if (_storage && !_cowSource)
             {
                 auto offset = (reinterpret_cast<uintptr_t>(_data) - reinterpret_cast<uintptr_t>(_storage->dataPointer()));
                 output.writeValue<uint32_t>("offset", offset);
@@ -203,6 +239,7 @@ namespace vsg
             _depth = 0;
             _data = nullptr;
             _storage = nullptr;
+            _cowSource = nullptr;
         }
 
         Array3D& operator=(const Array3D& rhs)
@@ -239,6 +276,7 @@ namespace vsg
             _depth = depth;
             _data = data;
             _storage = nullptr;
+            _cowSource = nullptr;
 
             dirty();
         }
@@ -248,6 +286,7 @@ namespace vsg
             _delete();
 
             _storage = storage;
+            _cowSource = nullptr;
             properties = in_properties;
             properties.stride = stride;
             if (_storage && _storage->dataPointer())
@@ -293,12 +332,38 @@ namespace vsg
         bool dataAvailable() const override { return available(); }
         size_t dataSize() const override { return size() * properties.stride; }
 
-        void* dataPointer() override { return _data; }
+        void* dataPointer() override
+        {
+            duplicateData();
+            return _data;
+        }
         const void* dataPointer() const override { return _data; }
 
-        void* dataPointer(size_t i) override { return data(i); }
+        void* dataPointer(size_t i) override
+        {
+            duplicateData();
+            return data(i);
+        }
         const void* dataPointer(size_t i) const override { return data(i); }
 
+        /// take a private copy of a buffer shared via a copy-on-write clone(), no-op when the buffer is already unique.
+        void duplicateData() override
+        {
+            if (!_cowSource) return;
+
+            auto shared_source = _cowSource; // keep the shared buffer alive while copying from it
+            _cowSource = nullptr;
+            _storage = nullptr;
+
+            size_t numValues = static_cast<size_t>(_width) * static_cast<size_t>(_height) * static_cast<size_t>(_depth);
+            const_iterator src_itr{_data, properties.stride};
+            _data = _allocate(numValues);
+            properties.stride = sizeof(value_type);
+
+            auto dest_v = _data;
+            for (size_t i = 0; i < numValues; ++i, ++src_itr) *(dest_v++) = *src_itr;
+        }
+
         uint32_t dimensions() const override { return 3; }
 
         uint32_t width() const override { return _width; }
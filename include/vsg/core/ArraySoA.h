@@ -0,0 +1,99 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Data.h>
+#include <vsg/core/Inherit.h>
+
+namespace vsg
+{
+
+    /// ArraySoA stores multiple vertex attribute channels in structure of arrays form within a single
+    /// allocation - each channel is tightly packed and 16 byte aligned, so positions, normals etc. can be
+    /// processed with SIMD over contiguous values rather than strided through interleaved vertices.
+    /// BindVertexBuffers expands an ArraySoA into one vertex buffer binding per channel via channelView(),
+    /// with each view carrying its own ModifiedCount so dynamic channels transfer independently.
+    class VSG_DECLSPEC ArraySoA : public Inherit<Data, ArraySoA>
+    {
+    public:
+        struct Channel
+        {
+            VkFormat format = VK_FORMAT_UNDEFINED;
+            uint32_t valueSize = 0; /// bytes per value, channels are tightly packed so this is also the channel's stride
+            size_t offset = 0;      /// byte offset of the channel within the shared allocation, computed when the data is allocated
+        };
+
+        using Channels = std::vector<Channel>;
+
+        ArraySoA();
+        ArraySoA(const ArraySoA& rhs, const CopyOp& copyop = {});
+        ArraySoA(uint32_t numValues, const Channels& in_channels, Properties in_properties = {});
+
+        Channels channels;
+
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return ArraySoA::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+        size_t valueSize() const override;
+        size_t valueCount() const override { return _numValues; }
+
+        bool dataAvailable() const override { return _data != nullptr; }
+        size_t dataSize() const override { return _totalSize; }
+
+        void* dataPointer() override { return _data; }
+        const void* dataPointer() const override { return _data; }
+
+        /// return the start of the index'th channel - values within a channel are contiguous so there is no meaningful per value pointer across channels
+        void* dataPointer(size_t index) override { return channelPointer(index); }
+        const void* dataPointer(size_t index) const override { return channelPointer(index); }
+
+        void* dataRelease() override;
+
+        uint32_t dimensions() const override { return 1; }
+        uint32_t width() const override { return _numValues; }
+        uint32_t height() const override { return 1; }
+        uint32_t depth() const override { return 1; }
+
+        /// pointer to the start of a channel's tightly packed values
+        void* channelPointer(size_t channelIndex) { return _data + channels[channelIndex].offset; }
+        const void* channelPointer(size_t channelIndex) const { return _data + channels[channelIndex].offset; }
+
+        /// typed access to a channel for SIMD friendly processing over contiguous values
+        template<typename T>
+        T* channelData(size_t channelIndex) { return reinterpret_cast<T*>(channelPointer(channelIndex)); }
+        template<typename T>
+        const T* channelData(size_t channelIndex) const { return reinterpret_cast<const T*>(channelPointer(channelIndex)); }
+
+        /// create a Data view over a channel suitable for assigning to BufferInfo/BindVertexBuffers,
+        /// the view shares this ArraySoA's storage and has its own ModifiedCount for dynamic data transfer.
+        ref_ptr<Data> channelView(size_t channelIndex);
+
+    protected:
+        virtual ~ArraySoA();
+
+        /// compute the 16 byte aligned channel offsets and the total allocation size for the current channels/numValues
+        size_t _computeLayout();
+
+        uint8_t* _allocate(size_t size) const;
+        void _delete();
+
+        uint8_t* _data = nullptr;
+        uint32_t _numValues = 0;
+        size_t _totalSize = 0;
+    };
+    VSG_type_name(vsg::ArraySoA);
+
+} // namespace vsg
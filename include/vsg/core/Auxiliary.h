@@ -13,22 +13,41 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Object.h>
+#include <vsg/core/Token.h>
 #include <vsg/core/ref_ptr.h>
 
+#include <atomic>
 #include <map>
-#include <mutex>
+#include <vector>
 
 namespace vsg
 {
 
-    /** Auxiliary provides extra Object data that is rarely used, and hooks for observers.*/
+    /** Auxiliary provides extra Object data that is rarely used, and hooks for observers.
+      * The connection between the Auxiliary and its Object is managed lock-free - observer_ptr<>
+      * resolution announces itself with beginResolve()/endResolve() which pins the connection,
+      * while the Object's delete path claims the connection once no resolves are in flight,
+      * so converting large numbers of observers to references never serializes on a mutex. */
     class VSG_DECLSPEC Auxiliary
     {
     public:
-        std::mutex& getMutex() const { return _mutex; }
+        Object* getConnectedObject() { return _connectedObject.load(std::memory_order_acquire); }
+        const Object* getConnectedObject() const { return _connectedObject.load(std::memory_order_acquire); }
 
-        Object* getConnectedObject() { return _connectedObject; }
-        const Object* getConnectedObject() const { return _connectedObject; }
+        /// announce the start of an observer_ptr<> resolve, returning true if the connection to the
+        /// Object is still live, in which case the connection is pinned until the matching endResolve()
+        /// and the caller may attempt to take a reference with Object::try_ref(). Lock-free.
+        bool beginResolve() const
+        {
+            auto previous = _connection.fetch_add(RESOLVER, std::memory_order_acquire);
+            if ((previous & CONNECTED) != 0) return true;
+
+            _connection.fetch_sub(RESOLVER, std::memory_order_release);
+            return false;
+        }
+
+        /// announce the end of an observer_ptr<> resolve, unpinning the connection
+        void endResolve() const { _connection.fetch_sub(RESOLVER, std::memory_order_release); }
 
         virtual std::size_t getSizeOf() const { return sizeof(Auxiliary); }
 
@@ -42,6 +61,9 @@ namespace vsg
         void setObject(const std::string& key, ref_ptr<Object> object)
         {
             userObjects[key] = object;
+
+            // keep the token indexed view coherent for keys that have been interned
+            if (auto token = Token::find(key)) _assignTokenObject(token, object);
         }
 
         Object* getObject(const std::string& key)
@@ -76,14 +98,77 @@ namespace vsg
                 return {};
         }
 
+        /// assign an object by interned token, also keeping the string keyed userObjects map coherent
+        /// so comparison, copying and serialization continue to see the entry
+        void setObject(const Token& token, ref_ptr<Object> object)
+        {
+            if (!token) return;
+            _assignTokenObject(token, object);
+            userObjects[token.name()] = object;
+        }
+
+        /// get the object assigned to the interned token, indexing directly without any string comparisons
+        Object* getObject(const Token& token)
+        {
+            return token.index() < tokenObjects.size() ? tokenObjects[token.index()].get() : nullptr;
+        }
+
+        const Object* getObject(const Token& token) const
+        {
+            return token.index() < tokenObjects.size() ? tokenObjects[token.index()].get() : nullptr;
+        }
+
+        ref_ptr<Object> getRefObject(const Token& token)
+        {
+            return token.index() < tokenObjects.size() ? tokenObjects[token.index()] : ref_ptr<Object>{};
+        }
+
+        ref_ptr<const Object> getRefObject(const Token& token) const
+        {
+            return token.index() < tokenObjects.size() ? ref_ptr<const Object>(tokenObjects[token.index()]) : ref_ptr<const Object>{};
+        }
+
+        /// remove the entry associated with key from both the string and token indexed views
+        void removeObject(const std::string& key)
+        {
+            userObjects.erase(key);
+            if (auto token = Token::find(key); token && token.index() < tokenObjects.size()) tokenObjects[token.index()] = {};
+        }
+
+        void removeObject(const Token& token)
+        {
+            if (!token) return;
+            if (token.index() < tokenObjects.size()) tokenObjects[token.index()] = {};
+            userObjects.erase(token.name());
+        }
+
+        /// rebuild the token indexed view from the userObjects map, used after the map has been assigned wholesale
+        void rebuildTokenObjects()
+        {
+            tokenObjects.clear();
+            for (auto& [key, object] : userObjects)
+            {
+                if (auto token = Token::find(key)) _assignTokenObject(token, object);
+            }
+        }
+
         using ObjectMap = std::map<std::string, vsg::ref_ptr<Object>>;
 
         /// container for all user objects
         ObjectMap userObjects;
 
+        /// view of userObjects indexed by interned Token for constant time lookups, sparse entries are null
+        std::vector<ref_ptr<Object>> tokenObjects;
+
     protected:
         explicit Auxiliary(Object* object);
 
+        void _assignTokenObject(const Token& token, ref_ptr<Object> object)
+        {
+            if (tokenObjects.size() <= token.index()) tokenObjects.resize(token.index() + 1);
+            tokenObjects[token.index()] = object;
+        }
+
         virtual ~Auxiliary();
 
         /// reset the ConnectedObject pointer to 0 unless the ConnectedObject referenceCount goes back above 0,
@@ -95,10 +180,18 @@ namespace vsg
         friend class Object;
         friend class Allocator;
 
+        /// _connection packs a CONNECTED flag in the lowest bit with a count of in flight resolves
+        /// in the remaining bits, claiming the connection spins until the resolve count reaches zero.
+        enum ConnectionBits : unsigned int
+        {
+            CONNECTED = 1,
+            RESOLVER = 2
+        };
+
         mutable std::atomic_uint _referenceCount;
 
-        mutable std::mutex _mutex;
-        Object* _connectedObject;
+        mutable std::atomic_uint _connection;
+        std::atomic<Object*> _connectedObject;
     };
 
 } // namespace vsg
@@ -28,12 +28,16 @@ namespace vsg
     class Node;
     class Commands;
     class Group;
+    class SpatialIndexGroup;
     class QuadGroup;
     class LOD;
     class PagedLOD;
+    class ImpostorLOD;
     class StateGroup;
     class CullGroup;
+    class MaskGroup;
     class CullNode;
+    class OcclusionQueryNode;
     class MatrixTransform;
     class Transform;
     class Geometry;
@@ -50,6 +54,7 @@ namespace vsg
     class SpotLight;
     class InstrumentationNode;
     class RegionOfInterest;
+    class CompiledDrawList;
 
     // forward declare text classes
     class Text;
@@ -320,9 +325,13 @@ namespace vsg
         virtual void apply(const QuadGroup&);
         virtual void apply(const LOD&);
         virtual void apply(const PagedLOD&);
+        virtual void apply(const ImpostorLOD&);
         virtual void apply(const StateGroup&);
         virtual void apply(const CullGroup&);
+        virtual void apply(const MaskGroup&);
+        virtual void apply(const SpatialIndexGroup&);
         virtual void apply(const CullNode&);
+        virtual void apply(const OcclusionQueryNode&);
         virtual void apply(const MatrixTransform&);
         virtual void apply(const Transform&);
         virtual void apply(const Geometry&);
@@ -339,6 +348,7 @@ namespace vsg
         virtual void apply(const SpotLight&);
         virtual void apply(const InstrumentationNode&);
         virtual void apply(const RegionOfInterest&);
+        virtual void apply(const CompiledDrawList&);
 
         // text
         virtual void apply(const Text&);
@@ -18,7 +18,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/type_name.h>
 #include <vsg/vk/vulkan.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <limits>
 #include <vector>
 
 namespace vsg
@@ -174,6 +177,10 @@ namespace vsg
         virtual void* dataPointer() = 0;
         virtual const void* dataPointer() const = 0;
 
+        /// convenience read-only access to the buffer for use on non-const Data pointers,
+        /// avoiding the non-const dataPointer() which triggers a copy-on-write duplication.
+        const void* constDataPointer() const { return dataPointer(); }
+
         virtual void* dataPointer(size_t index) = 0;
         virtual const void* dataPointer(size_t index) const = 0;
 
@@ -193,8 +200,50 @@ namespace vsg
         MipmapOffsets computeMipmapOffsets() const;
         static size_t computeValueCountIncludingMipmaps(size_t w, size_t h, size_t d, uint32_t maxNumMipmaps);
 
-        /// increment the ModifiedCount to signify the data has been modified
-        void dirty() { ++_modifiedCount; }
+        /// return true if this Data is sharing another Data's buffer as a result of a copy-on-write clone(),
+        /// prior to the first write triggering a private copy.
+        bool sharedViaCopyOnWrite() const { return _cowSource.valid(); }
+
+        /// take a private copy of a buffer shared by a copy-on-write clone(), no-op when this Data already owns its buffer.
+        /// Subclasses that support copy-on-write cloning implement the buffer duplication.
+        virtual void duplicateData() {}
+
+        /// byte range within the data buffer, used for tracking the modified region of dynamic data.
+        /// size of 0 signifies no recorded range and should be treated as the whole buffer by consumers.
+        struct DirtyRange
+        {
+            size_t offset = 0;
+            size_t size = 0;
+        };
+
+        /// increment the ModifiedCount to signify the whole of the data has been modified,
+        /// taking a private copy of the buffer first when it's shared via copy-on-write.
+        void dirty()
+        {
+            if (_cowSource) duplicateData();
+            ++_modifiedCount;
+            _extendDirtyRange(0, std::numeric_limits<size_t>::max());
+        }
+
+        /// increment the ModifiedCount to signify modification limited to the specified byte range,
+        /// allowing the transfer machinery to upload just the modified region of large dynamic buffers.
+        /// Successive ranges are coalesced into a single bounding interval until consumed.
+        void dirty(size_t offset, size_t size)
+        {
+            if (_cowSource) duplicateData();
+            ++_modifiedCount;
+            _extendDirtyRange(offset, size);
+        }
+
+        /// return the coalesced byte range modified since the previous call and clear the record.
+        /// Intended for use by the transfer machinery after a ModifiedCount sync, callers must treat
+        /// a size of 0 as the whole buffer and clamp the range to the size of the region they manage.
+        DirtyRange consumeDirtyRange()
+        {
+            DirtyRange range = _dirtyRange;
+            _dirtyRange = {};
+            return range;
+        }
 
         /// get the Data's ModifiedCount and return true if this changes the specified ModifiedCount
         bool getModifiedCount(ModifiedCount& mc) const
@@ -211,11 +260,50 @@ namespace vsg
         /// return true if Data's ModifiedCount is different from the specified ModifiedCount
         bool differentModifiedCount(const ModifiedCount& mc) const { return _modifiedCount != mc; }
 
+        /// return an FNV-1a hash of the data contents, computed lazily and cached, and recomputed after
+        /// dirty() advances the ModifiedCount. Used by Data::compare() to short-circuit repeated deep
+        /// comparisons of unequal data and by SharedObjects to bucket objects by content. Only meaningful
+        /// on quiescent data - concurrent writers must be synchronized externally, as with compare().
+        uint64_t contentHash() const;
+
     protected:
         virtual ~Data() {}
 
         ModifiedCount _modifiedCount;
 
+        /// cached content hash, 0 signifies not yet computed, and the ModifiedCount it was computed at
+        mutable std::atomic<uint64_t> _contentHash{0};
+        mutable std::atomic<uint32_t> _contentHashCount{0};
+
+        /// coalesced byte range covering the modifications recorded by dirty() calls since the last consumeDirtyRange().
+        DirtyRange _dirtyRange;
+
+        void _extendDirtyRange(size_t offset, size_t size)
+        {
+            if (size == 0) return;
+
+            // a size of max signifies the whole buffer
+            if (size == std::numeric_limits<size_t>::max() || _dirtyRange.size == std::numeric_limits<size_t>::max())
+            {
+                _dirtyRange = {0, std::numeric_limits<size_t>::max()};
+                return;
+            }
+
+            if (_dirtyRange.size == 0)
+            {
+                _dirtyRange = {offset, size};
+                return;
+            }
+
+            size_t begin = std::min(_dirtyRange.offset, offset);
+            size_t end = std::max(_dirtyRange.offset + _dirtyRange.size, offset + size);
+            _dirtyRange = {begin, end - begin};
+        }
+
+        /// source Data whose buffer this Data aliases following a copy-on-write clone(), see CopyOp::copyOnWriteData.
+        /// Keeps the source, and with it the shared buffer, alive until duplicateData() takes a private copy.
+        ref_ptr<Data> _cowSource;
+
 #if 1
     public:
         /// deprecated: provided for backwards compatibility, use Properties instead.
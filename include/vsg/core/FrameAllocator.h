@@ -0,0 +1,143 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace vsg
+{
+    /** Bump/arena allocator for per-frame transient data such as bin contents and culling results gathered
+      * during RecordTraversal. Allocations are trivially fast pointer bumps, individual deallocations are
+      * no-ops, and all memory is reclaimed in one go by release() at the start of each frame's record.
+      * Blocks are retained across frames so a steady state frame performs no heap traffic at all.*/
+    class FrameAllocator : public Inherit<Object, FrameAllocator>
+    {
+    public:
+        explicit FrameAllocator(size_t in_blockSize = 1024 * 1024) :
+            blockSize(in_blockSize)
+        {
+        }
+
+        FrameAllocator(const FrameAllocator&) = delete;
+        FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+        size_t blockSize;
+
+        void* allocate(size_t size, size_t alignment = sizeof(void*))
+        {
+            for (; _current < _blocks.size(); ++_current)
+            {
+                if (auto* ptr = _blocks[_current].allocate(size, alignment)) return ptr;
+            }
+
+            _blocks.emplace_back(std::max(blockSize, size + alignment));
+            return _blocks.back().allocate(size, alignment);
+        }
+
+        /// individual deallocation is a no-op, all memory is reclaimed by release()
+        void deallocate(void* /*ptr*/, size_t /*size*/) {}
+
+        /// reset all blocks, retaining them for reuse, invalidating all outstanding allocations
+        void release()
+        {
+            for (auto& block : _blocks) block.position = 0;
+            _current = 0;
+        }
+
+        /// total number of bytes held by the allocator's blocks
+        size_t totalMemorySize() const
+        {
+            size_t total = 0;
+            for (auto& block : _blocks) total += block.size;
+            return total;
+        }
+
+    protected:
+        virtual ~FrameAllocator()
+        {
+            for (auto& block : _blocks) delete[] block.memory;
+        }
+
+        struct Block
+        {
+            explicit Block(size_t in_size) :
+                memory(new uint8_t[in_size]),
+                size(in_size)
+            {
+            }
+
+            uint8_t* memory = nullptr;
+            size_t size = 0;
+            size_t position = 0;
+
+            void* allocate(size_t allocation_size, size_t alignment)
+            {
+                size_t aligned = ((position + alignment - 1) / alignment) * alignment;
+                if ((aligned + allocation_size) > size) return nullptr;
+                position = aligned + allocation_size;
+                return memory + aligned;
+            }
+        };
+
+        std::vector<Block> _blocks;
+        size_t _current = 0;
+    };
+    VSG_type_name(vsg::FrameAllocator);
+
+    /** std compatible allocator adapter that draws from a FrameAllocator, for use with containers holding
+      * per-frame transient data. Falls back to global new/delete when no FrameAllocator is assigned.*/
+    template<typename T>
+    struct FrameAlloc
+    {
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        FrameAllocator* frameAllocator = nullptr;
+
+        FrameAlloc() = default;
+        explicit FrameAlloc(FrameAllocator* fa) :
+            frameAllocator(fa) {}
+
+        template<typename U>
+        FrameAlloc(const FrameAlloc<U>& rhs) :
+            frameAllocator(rhs.frameAllocator) {}
+
+        T* allocate(size_t n)
+        {
+            if (frameAllocator) return static_cast<T*>(frameAllocator->allocate(n * sizeof(T), alignof(T)));
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, size_t n)
+        {
+            if (frameAllocator)
+                frameAllocator->deallocate(ptr, n * sizeof(T));
+            else
+                ::operator delete(ptr);
+        }
+
+        bool operator==(const FrameAlloc& rhs) const { return frameAllocator == rhs.frameAllocator; }
+        bool operator!=(const FrameAlloc& rhs) const { return frameAllocator != rhs.frameAllocator; }
+    };
+
+    /// std::vector that draws its memory from a FrameAllocator
+    template<typename T>
+    using frame_vector = std::vector<T, FrameAlloc<T>>;
+
+} // namespace vsg
@@ -14,9 +14,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/core/Export.h>
 
-#include <list>
-#include <map>
+#include <cstdint>
 #include <ostream>
+#include <unordered_map>
 #include <vector>
 
 namespace vsg
@@ -31,7 +31,9 @@ namespace vsg
         MEMORY_TRACKING_DEFAULT = MEMORY_TRACKING_NO_CHECKS
     };
 
-    /** class used internally by vsg::Allocator, vsg::DeviceMemory and vsg::Buffer to manage suballocation within a block of CPU or GPU memory.*/
+    /** class used internally by vsg::Allocator, vsg::DeviceMemory and vsg::Buffer to manage suballocation within a block of CPU or GPU memory.
+     *  Free space is binned by size into a two level segregated free list (TLSF style) so reserve() and release() run in constant time
+     *  rather than the ordered container rebalancing cost per (de)allocation of earlier releases.*/
     class VSG_DECLSPEC MemorySlots
     {
     public:
@@ -43,14 +45,18 @@ namespace vsg
 
         bool release(size_t offset, size_t size);
 
-        bool full() const { return _availableMemory.empty(); }
-        bool empty() const { return totalAvailableSize() == totalMemorySize(); }
+        bool full() const { return _totalAvailableSize == 0; }
+        bool empty() const { return _totalAvailableSize == _totalMemorySize; }
 
-        size_t maximumAvailableSpace() const { return _availableMemory.empty() ? 0 : _availableMemory.rbegin()->first; }
-        size_t totalAvailableSize() const;
-        size_t totalReservedSize() const;
+        size_t maximumAvailableSpace() const;
+        size_t totalAvailableSize() const { return _totalAvailableSize; }
+        size_t totalReservedSize() const { return _totalReservedSize; }
         size_t totalMemorySize() const { return _totalMemorySize; }
 
+        // occupancy stats
+        size_t numAvailableSlots() const { return _numAvailableSlots; }
+        size_t numReservedSlots() const { return _numReservedSlots; }
+
         // debug facilities
         void report(std::ostream& out) const;
         bool check() const;
@@ -58,14 +64,53 @@ namespace vsg
         mutable int memoryTracking = MEMORY_TRACKING_DEFAULT;
 
     protected:
-        std::multimap<size_t, size_t> _availableMemory;
-        std::map<size_t, size_t> _offsetSizes;
-        std::map<size_t, size_t> _reservedMemory;
-
-        void insertAvailableSlot(size_t offset, size_t size);
-        void removeAvailableSlot(size_t offset, size_t size);
-
-        size_t _totalMemorySize;
+        // free slots are binned by size - the first level selects the power of two of the slot size,
+        // the second level subdivides each power of two into SECOND_LEVEL_COUNT linear ranges, with
+        // sizes below SECOND_LEVEL_COUNT mapped one to one to the first group of bins. Bitmaps mark
+        // the non empty bins so a suitable slot is located with a couple of bit scans.
+        static constexpr uint32_t SECOND_LEVEL_BITS = 5;
+        static constexpr uint32_t SECOND_LEVEL_COUNT = 1 << SECOND_LEVEL_BITS;
+        static constexpr uint32_t FIRST_LEVEL_COUNT = 64 - SECOND_LEVEL_BITS + 1;
+        static constexpr uint32_t NUM_BINS = FIRST_LEVEL_COUNT * SECOND_LEVEL_COUNT;
+        static constexpr uint32_t INVALID_SLOT = 0xffffffff;
+        static constexpr uint32_t INVALID_BIN = 0xffffffff;
+
+        // every byte of the managed range belongs to exactly one slot, with the slots chained into a
+        // doubly linked list ordered by offset so release() can coalesce with its physical neighbours
+        // without any searching. Free slots are additionally chained into the free list of their size bin.
+        struct Slot
+        {
+            size_t offset = 0;
+            size_t size = 0;
+            uint32_t prevPhysical = INVALID_SLOT;
+            uint32_t nextPhysical = INVALID_SLOT;
+            uint32_t prevFree = INVALID_SLOT;
+            uint32_t nextFree = INVALID_SLOT;
+            bool free = false;
+        };
+
+        uint32_t _binIndex(size_t size) const;     // bin that slots of the specified size are placed in
+        uint32_t _binIndexCeil(size_t size) const; // first bin where every slot is guaranteed >= the specified size
+        uint32_t _findFreeBin(uint32_t fromBin) const;
+
+        uint32_t _acquireSlot();
+        void _recycleSlot(uint32_t slotIndex);
+        void _pushFree(uint32_t slotIndex);
+        void _popFree(uint32_t slotIndex);
+
+        std::vector<Slot> _slots;
+        uint32_t _unusedSlots = INVALID_SLOT;
+        uint32_t _firstPhysical = INVALID_SLOT;
+        std::vector<uint32_t> _freeLists;
+        uint64_t _firstLevelBitmap = 0;
+        uint32_t _secondLevelBitmaps[FIRST_LEVEL_COUNT] = {};
+        std::unordered_map<size_t, uint32_t> _reservedSlots;
+
+        size_t _totalMemorySize = 0;
+        size_t _totalAvailableSize = 0;
+        size_t _totalReservedSize = 0;
+        size_t _numAvailableSlots = 0;
+        size_t _numReservedSlots = 0;
     };
 
 } // namespace vsg
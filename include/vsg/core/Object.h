@@ -19,6 +19,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vector>
 
 #include <vsg/core/Export.h>
+#include <vsg/core/Token.h>
 #include <vsg/core/ref_ptr.h>
 #include <vsg/core/type_name.h>
 
@@ -43,6 +44,10 @@ namespace vsg
     public:
         mutable ref_ptr<Duplicate> duplicate;
 
+        /// when true, Data subclasses that support it alias the source buffer when cloned rather than deep copying it,
+        /// deferring the copy until the first write to the clone via dirty() or non-const dataPointer().
+        bool copyOnWriteData = false;
+
         /// copy/clone pointer
         template<class T>
         inline ref_ptr<T> operator()(ref_ptr<T> ptr) const;
@@ -110,15 +115,34 @@ namespace vsg
         virtual void read(Input& input);
         virtual void write(Output& output) const;
 
-        // ref counting methods
+        // ref counting methods. unref() uses release ordering on the decrement with an acquire fence
+        // before deletion, so the hot path avoids the cost of a sequentially consistent atomic while
+        // still ordering all writes to the object before its destruction.
         inline void ref() const noexcept { _referenceCount.fetch_add(1, std::memory_order_relaxed); }
         inline void unref() const noexcept
         {
-            if (_referenceCount.fetch_sub(1, std::memory_order_seq_cst) <= 1) _attemptDelete();
+            if (_referenceCount.fetch_sub(1, std::memory_order_release) <= 1)
+            {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                _attemptDelete();
+            }
         }
-        inline void unref_nodelete() const noexcept { _referenceCount.fetch_sub(1, std::memory_order_seq_cst); }
+        inline void unref_nodelete() const noexcept { _referenceCount.fetch_sub(1, std::memory_order_release); }
         inline unsigned int referenceCount() const noexcept { return _referenceCount.load(); }
 
+        /// increment the reference count only if it is non zero, returning true on success.
+        /// used by observer_ptr<> to convert to a ref_ptr<> without taking a lock - an object whose
+        /// count has reached zero is on its way to deletion and can never be resurrected this way.
+        inline bool try_ref() const noexcept
+        {
+            auto count = _referenceCount.load(std::memory_order_relaxed);
+            while (count != 0)
+            {
+                if (_referenceCount.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)) return true;
+            }
+            return false;
+        }
+
         /// meta data access methods
         /// wraps the value with a vsg::Value<T> object and then assigns via setObject(key, vsg::Value<T>)
         template<typename T>
@@ -165,6 +189,53 @@ namespace vsg
         /// remove meta object or value associated with key
         void removeObject(const std::string& key);
 
+        /// Token variants of the meta data access methods that index Auxiliary storage directly by the
+        /// interned token, avoiding per-lookup string comparisons in hot traversal code.
+        /// Entries remain visible through the string keyed API under the token's name.
+        template<typename T>
+        void setValue(const Token& token, const T& value);
+
+        /// specialization of setValue to handle passing C strings
+        void setValue(const Token& token, const char* value) { setValue(token, value ? std::string(value) : std::string()); }
+
+        /// get specified value type, return false if value associated with token is not assigned or is not the correct type
+        template<typename T>
+        bool getValue(const Token& token, T& value) const;
+
+        /// assign an Object associated with the interned token
+        void setObject(const Token& token, ref_ptr<Object> object);
+
+        /// get Object pointer associated with token, return nullptr if no object associated with token has been assigned
+        Object* getObject(const Token& token);
+
+        /// get const Object pointer associated with token, return nullptr if no object associated with token has been assigned
+        const Object* getObject(const Token& token) const;
+
+        /// get object pointer of specified type associated with token, return nullptr if no object associated with token has been assigned
+        template<class T>
+        T* getObject(const Token& token) { return dynamic_cast<T*>(getObject(token)); }
+
+        /// get const object pointer of specified type associated with token, return nullptr if no object associated with token has been assigned
+        template<class T>
+        const T* getObject(const Token& token) const { return dynamic_cast<const T*>(getObject(token)); }
+
+        /// get ref_ptr<Object> associated with token, return nullptr if no object associated with token has been assigned
+        ref_ptr<Object> getRefObject(const Token& token);
+
+        /// get ref_ptr<const Object> pointer associated with token, return nullptr if no object associated with token has been assigned
+        ref_ptr<const Object> getRefObject(const Token& token) const;
+
+        /// get ref_ptr<T> of specified type associated with token, return nullptr if no object associated with token has been assigned
+        template<class T>
+        ref_ptr<T> getRefObject(const Token& token) { return getRefObject(token).cast<T>(); }
+
+        /// get ref_ptr<const T> of specified type associated with token, return nullptr if no object associated with token has been assigned
+        template<class T>
+        const ref_ptr<const T> getRefObject(const Token& token) const { return getRefObject(token).cast<const T>(); }
+
+        /// remove meta object or value associated with token
+        void removeObject(const Token& token);
+
         // Auxiliary object access methods, the optional Auxiliary is used to store meta data
         Auxiliary* getOrCreateAuxiliary();
         Auxiliary* getAuxiliary() { return _auxiliary; }
@@ -0,0 +1,68 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Export.h>
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace vsg
+{
+
+    /// ObjectPool recycles node storage through freelists keyed by allocation size, so high churn
+    /// types like PagedLOD, CullNode and VertexIndexDraw created and destroyed in large numbers
+    /// during paging reuse each other's storage instead of round-tripping through the Allocator's
+    /// block bookkeeping. Node::operator new draws from the pool and Node::operator delete returns
+    /// to it when the pool is enabled:
+    ///     vsg::ObjectPool::instance().enabled = true;
+    class VSG_DECLSPEC ObjectPool
+    {
+    public:
+        ObjectPool();
+        virtual ~ObjectPool();
+
+        /// ObjectPool singleton used by Node::operator new/delete
+        static ObjectPool& instance();
+
+        /// when false take() and recycle() are no-ops and allocations pass straight through to the Allocator
+        std::atomic_bool enabled{false};
+
+        /// largest allocation recycled through the pool, bigger allocations pass through to the Allocator
+        std::size_t maxObjectSize = 512;
+
+        /// cap on the number of recycled allocations retained per size, anything beyond is returned to the Allocator
+        std::size_t maxObjectsPerSize = 4096;
+
+        /// take recycled storage of exactly the requested size, returns nullptr when none is available
+        void* take(std::size_t size);
+
+        /// recycle storage for reuse by a subsequent take() of the same size,
+        /// returns false when the pool is disabled or full and the caller should deallocate normally.
+        bool recycle(void* ptr, std::size_t size);
+
+        /// return all recycled storage to the Allocator, returns the number of allocations released
+        std::size_t clear();
+
+        /// total number of bytes currently held by the pool's freelists
+        std::size_t totalRecycledSize() const;
+
+    protected:
+        mutable std::mutex _mutex;
+        std::map<std::size_t, std::vector<void*>> _freeLists;
+    };
+
+} // namespace vsg
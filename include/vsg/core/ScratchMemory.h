@@ -71,10 +71,31 @@ namespace vsg
             return next->allocate<T>(num);
         }
 
+        /// number of bytes allocated from this block and any overflow blocks since the last release()
+        size_t highWaterMark() const
+        {
+            size_t total = static_cast<size_t>(ptr - buffer);
+            if (next) total += next->highWaterMark();
+            return total;
+        }
+
         void release()
         {
+            if (next)
+            {
+                // allocations overflowed into chained blocks, so grow the primary block to the
+                // high-water mark and drop the chain - subsequent passes of a similar size are then
+                // serviced by a single block without any allocation or chain walking.
+                size_t requiredSize = highWaterMark();
+                if (requiredSize > size)
+                {
+                    delete[] buffer;
+                    size = requiredSize;
+                    buffer = new uint8_t[size];
+                }
+                next = {};
+            }
             ptr = buffer;
-            if (next) next->release();
         }
     };
 
@@ -0,0 +1,59 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Export.h>
+
+#include <cstdint>
+#include <string>
+
+namespace vsg
+{
+
+    /// Token is an interned metadata key - a process-wide unique index assigned to a string the first
+    /// time it is interned. Constructing a Token from a string pays the string hash once, after which
+    /// Object::setValue/getValue/setObject/getObject lookups index Auxiliary storage directly by the
+    /// token, avoiding the per-lookup string comparisons of the string keyed API.
+    /// Intern tokens once, typically as static const variables, and reuse them in hot traversal code.
+    class VSG_DECLSPEC Token
+    {
+    public:
+        Token() = default;
+        Token(const Token&) = default;
+        Token& operator=(const Token&) = default;
+
+        /// intern the name, returning the same token for the same string within the process
+        explicit Token(const std::string& name);
+
+        static constexpr uint32_t invalid_index = 0xffffffffu;
+
+        uint32_t index() const { return _index; }
+
+        bool valid() const { return _index != invalid_index; }
+        explicit operator bool() const { return valid(); }
+
+        /// return the string the token was interned from, or an empty string for an invalid token
+        const std::string& name() const;
+
+        /// look up the token for a name without interning it, returning an invalid Token when the name has never been interned
+        static Token find(const std::string& name);
+
+        bool operator==(const Token& rhs) const { return _index == rhs._index; }
+        bool operator!=(const Token& rhs) const { return _index != rhs._index; }
+        bool operator<(const Token& rhs) const { return _index < rhs._index; }
+
+    protected:
+        uint32_t _index = invalid_index;
+    };
+
+} // namespace vsg
@@ -179,6 +179,30 @@ namespace vsg
         }
     }
 
+    template<typename T>
+    void Object::setValue(const Token& token, const T& value)
+    {
+        using ValueT = Value<T>;
+        setObject(token, ValueT::create(value));
+    }
+
+    template<typename T>
+    bool Object::getValue(const Token& token, T& value) const
+    {
+        using ValueT = Value<T>;
+        const Object* object = getObject(token);
+        if (object && (typeid(*object) == typeid(ValueT)))
+        {
+            const ValueT* vo = static_cast<const ValueT*>(object);
+            value = *vo;
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     /// convenience function for getting a value from the first object with the named value, falling back to specified defaultValue when none is available.
     /// usage:   auto flag = vsg::value<bool>(false, "flag", object1);
     /// usage:   auto angle = vsg::value<float>(0.0f, "angle", object1, object2);
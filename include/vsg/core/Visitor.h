@@ -28,12 +28,16 @@ namespace vsg
     class Node;
     class Commands;
     class Group;
+    class SpatialIndexGroup;
     class QuadGroup;
     class LOD;
     class PagedLOD;
+    class ImpostorLOD;
     class StateGroup;
     class CullGroup;
+    class MaskGroup;
     class CullNode;
+    class OcclusionQueryNode;
     class MatrixTransform;
     class Transform;
     class Geometry;
@@ -50,6 +54,7 @@ namespace vsg
     class SpotLight;
     class InstrumentationNode;
     class RegionOfInterest;
+    class CompiledDrawList;
 
     // forward declare text classes
     class Text;
@@ -320,9 +325,13 @@ namespace vsg
         virtual void apply(QuadGroup&);
         virtual void apply(LOD&);
         virtual void apply(PagedLOD&);
+        virtual void apply(ImpostorLOD&);
         virtual void apply(StateGroup&);
         virtual void apply(CullGroup&);
+        virtual void apply(MaskGroup&);
+        virtual void apply(SpatialIndexGroup&);
         virtual void apply(CullNode&);
+        virtual void apply(OcclusionQueryNode&);
         virtual void apply(MatrixTransform&);
         virtual void apply(Transform&);
         virtual void apply(Geometry&);
@@ -339,6 +348,7 @@ namespace vsg
         virtual void apply(SpotLight&);
         virtual void apply(InstrumentationNode&);
         virtual void apply(RegionOfInterest&);
+        virtual void apply(CompiledDrawList&);
 
         // text
         virtual void apply(Text&);
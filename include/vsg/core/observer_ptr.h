@@ -122,16 +122,19 @@ namespace vsg
         vsg::ref_ptr<T> ref_ptr() const { return vsg::ref_ptr<T>(*this); }
 
         /// convert observer_ptr into a ref_ptr so that Object pointed to can be safely accessed.
+        /// lock-free - the connection to the Object is pinned with Auxiliary::beginResolve()/endResolve()
+        /// while Object::try_ref() attempts to take a reference, so concurrent conversions never serialize.
         template<class R>
         operator vsg::ref_ptr<R>() const
         {
-            if (!_auxiliary) return vsg::ref_ptr<R>();
-
-            std::scoped_lock<std::mutex> guard(_auxiliary->getMutex());
-            if (_auxiliary->getConnectedObject() != nullptr)
-                return vsg::ref_ptr<R>(_ptr);
-            else
-                return {};
+            vsg::ref_ptr<R> result;
+            if (_auxiliary && _auxiliary->beginResolve())
+            {
+                // the connection is pinned so the Object cannot be deleted while we attempt to take a reference
+                if (_ptr->try_ref()) result._ptr = _ptr;
+                _auxiliary->endResolve();
+            }
+            return result;
         }
 
     protected:
@@ -142,4 +145,16 @@ namespace vsg
         vsg::ref_ptr<Auxiliary> _auxiliary;
     };
 
+    /// convert a whole container of observer_ptr<> into a vector of ref_ptr<> in a single pass.
+    /// entries whose objects have been deleted yield a null ref_ptr<> so the result lines up index for
+    /// index with the source container, callers that only want the live objects can skip the nulls.
+    template<class T, class Allocator>
+    std::vector<vsg::ref_ptr<T>> convert_to_ref(const std::vector<observer_ptr<T>, Allocator>& observers)
+    {
+        std::vector<vsg::ref_ptr<T>> refs;
+        refs.reserve(observers.size());
+        for (auto& observer : observers) refs.push_back(observer.ref_ptr());
+        return refs;
+    }
+
 } // namespace vsg
@@ -0,0 +1,167 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/Latch.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace vsg
+{
+
+    namespace detail
+    {
+        /// Operation running a caller provided chunk function over an index subrange, counting down the shared latch on completion.
+        /// The chunk function is held by reference as the issuing thread blocks until all chunks have completed.
+        template<typename ChunkFunc>
+        struct ParallelRangeOperation : public Inherit<Operation, ParallelRangeOperation<ChunkFunc>>
+        {
+            ParallelRangeOperation(size_t in_begin, size_t in_end, ChunkFunc& in_chunk, ref_ptr<Latch> in_latch) :
+                begin(in_begin),
+                end(in_end),
+                chunk(in_chunk),
+                latch(in_latch) {}
+
+            size_t begin;
+            size_t end;
+            ChunkFunc& chunk;
+            ref_ptr<Latch> latch;
+
+            void run() override
+            {
+                chunk(begin, end);
+                latch->count_down();
+            }
+        };
+    } // namespace detail
+
+    /// run chunk(begin, end) over the subranges of [begin, end) in parallel across the OperationThreads,
+    /// with the calling thread helping to process chunks while it waits for the others to complete.
+    /// The chunks are contiguous index ranges so the inner loops over them remain SIMD/vectorization friendly.
+    /// Ranges smaller than grainSize, or a null operationThreads, fall back to a single inline chunk call,
+    /// so callers don't need a separate serial path.
+    template<typename ChunkFunc>
+    void parallel_for(ref_ptr<OperationThreads> operationThreads, size_t begin, size_t end, ChunkFunc chunk, size_t grainSize = 16384)
+    {
+        if (begin >= end) return;
+
+        size_t count = end - begin;
+        if (grainSize == 0) grainSize = 1;
+
+        size_t maxChunks = operationThreads ? (operationThreads->threads.size() + 1) * 4 : 1;
+        size_t numChunks = std::min((count + grainSize - 1) / grainSize, maxChunks);
+        if (!operationThreads || numChunks <= 1)
+        {
+            chunk(begin, end);
+            return;
+        }
+
+        size_t chunkSize = (count + numChunks - 1) / numChunks;
+        numChunks = (count + chunkSize - 1) / chunkSize;
+
+        auto latch = Latch::create(numChunks);
+
+        std::vector<ref_ptr<Operation>> operations;
+        operations.reserve(numChunks);
+        for (size_t start = begin; start < end; start += chunkSize)
+        {
+            operations.push_back(detail::ParallelRangeOperation<ChunkFunc>::create(start, std::min(start + chunkSize, end), chunk, latch));
+        }
+
+        operationThreads->add(operations.begin(), operations.end());
+
+        // help process chunks while waiting for the worker threads to finish
+        operationThreads->run();
+        latch->wait();
+    }
+
+    /// parallel reduction over [begin, end) - each chunk computes its partial result with chunk(begin, end),
+    /// and the partials are combined with combine(result, partial) on the calling thread once all chunks have
+    /// completed, starting from init. combine must tolerate the partials arriving in any order.
+    template<typename R, typename ChunkFunc, typename CombineOp>
+    R parallel_reduce(ref_ptr<OperationThreads> operationThreads, size_t begin, size_t end, R init, ChunkFunc chunk, CombineOp combine, size_t grainSize = 16384)
+    {
+        if (begin >= end) return init;
+
+        size_t count = end - begin;
+        if (grainSize == 0) grainSize = 1;
+
+        size_t maxChunks = operationThreads ? (operationThreads->threads.size() + 1) * 4 : 1;
+        size_t numChunks = std::min((count + grainSize - 1) / grainSize, maxChunks);
+        if (!operationThreads || numChunks <= 1)
+        {
+            return combine(init, chunk(begin, end));
+        }
+
+        size_t chunkSize = (count + numChunks - 1) / numChunks;
+        numChunks = (count + chunkSize - 1) / chunkSize;
+
+        std::vector<R> partials(numChunks, init);
+        parallel_for(
+            operationThreads, 0, numChunks, [&](size_t chunkBegin, size_t chunkEnd) {
+                for (size_t c = chunkBegin; c < chunkEnd; ++c)
+                {
+                    size_t start = begin + c * chunkSize;
+                    partials[c] = chunk(start, std::min(start + chunkSize, end));
+                }
+            },
+            1);
+
+        R result = init;
+        for (auto& partial : partials) result = combine(result, partial);
+        return result;
+    }
+
+    /// parallel for_each over the elements of a container providing size() and operator[],
+    /// such as vsg::Array, Array2D, Array3D and std::vector.
+    template<class Container, typename Func>
+    void parallel_for_each(ref_ptr<OperationThreads> operationThreads, Container& container, Func func, size_t grainSize = 16384)
+    {
+        parallel_for(
+            operationThreads, 0, container.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) func(container[i]);
+            },
+            grainSize);
+    }
+
+    /// parallel transform assigning dest[i] = func(source[i]) over the overlapping extent of the two containers,
+    /// for bulk conversions such as image format widening or vertex remapping.
+    template<class SourceContainer, class DestContainer, typename Func>
+    void parallel_transform(ref_ptr<OperationThreads> operationThreads, const SourceContainer& source, DestContainer& dest, Func func, size_t grainSize = 16384)
+    {
+        size_t count = std::min(static_cast<size_t>(source.size()), static_cast<size_t>(dest.size()));
+        parallel_for(
+            operationThreads, 0, count, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) dest[i] = func(source[i]);
+            },
+            grainSize);
+    }
+
+    /// element level parallel reduce over a container - reduce(result, element) folds each chunk serially
+    /// and combine(result, partial) merges the per chunk partials, e.g. summing areas or unioning bounds.
+    template<class Container, typename R, typename ReduceOp, typename CombineOp>
+    R parallel_reduce(ref_ptr<OperationThreads> operationThreads, const Container& container, R init, ReduceOp reduce, CombineOp combine, size_t grainSize = 16384)
+    {
+        return parallel_reduce(
+            operationThreads, size_t(0), static_cast<size_t>(container.size()), init,
+            [&](size_t begin, size_t end) {
+                R partial = init;
+                for (size_t i = begin; i < end; ++i) partial = reduce(partial, container[i]);
+                return partial;
+            },
+            combine, grainSize);
+    }
+
+} // namespace vsg
@@ -196,6 +196,9 @@ namespace vsg
         template<class R>
         friend class ref_ptr;
 
+        template<class R>
+        friend class observer_ptr;
+
         T* _ptr;
     };
 
@@ -0,0 +1,253 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace vsg
+{
+
+    /** Vector with inline storage for the first N elements (small buffer optimization), spilling to a
+      * heap allocation obtained from the supplied allocator when it grows beyond N. Keeps small child
+      * lists in the same cache lines as their owning node, which dominates deep scene graph traversal.
+      * Provides the subset of the std::vector interface used by the scene graph containers.*/
+    template<typename T, std::size_t N, typename Allocator = std::allocator<T>>
+    class small_vector
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        small_vector() noexcept :
+            _data(_inline()), _size(0), _capacity(N) {}
+
+        explicit small_vector(size_type count) :
+            small_vector()
+        {
+            resize(count);
+        }
+
+        small_vector(const small_vector& rhs) :
+            small_vector()
+        {
+            reserve(rhs._size);
+            for (size_type i = 0; i < rhs._size; ++i) ::new (static_cast<void*>(_data + i)) T(rhs._data[i]);
+            _size = rhs._size;
+        }
+
+        small_vector(small_vector&& rhs) noexcept :
+            small_vector()
+        {
+            _moveFrom(rhs);
+        }
+
+        ~small_vector()
+        {
+            _destroy();
+        }
+
+        small_vector& operator=(const small_vector& rhs)
+        {
+            if (this == &rhs) return *this;
+            clear();
+            reserve(rhs._size);
+            for (size_type i = 0; i < rhs._size; ++i) ::new (static_cast<void*>(_data + i)) T(rhs._data[i]);
+            _size = rhs._size;
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& rhs) noexcept
+        {
+            if (this == &rhs) return *this;
+            _destroy();
+            _data = _inline();
+            _size = 0;
+            _capacity = N;
+            _moveFrom(rhs);
+            return *this;
+        }
+
+        size_type size() const noexcept { return _size; }
+        size_type capacity() const noexcept { return _capacity; }
+        bool empty() const noexcept { return _size == 0; }
+
+        T* data() noexcept { return _data; }
+        const T* data() const noexcept { return _data; }
+
+        T& operator[](size_type i) noexcept { return _data[i]; }
+        const T& operator[](size_type i) const noexcept { return _data[i]; }
+
+        T& front() noexcept { return _data[0]; }
+        const T& front() const noexcept { return _data[0]; }
+        T& back() noexcept { return _data[_size - 1]; }
+        const T& back() const noexcept { return _data[_size - 1]; }
+
+        iterator begin() noexcept { return _data; }
+        const_iterator begin() const noexcept { return _data; }
+        const_iterator cbegin() const noexcept { return _data; }
+        iterator end() noexcept { return _data + _size; }
+        const_iterator end() const noexcept { return _data + _size; }
+        const_iterator cend() const noexcept { return _data + _size; }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        void reserve(size_type new_capacity)
+        {
+            if (new_capacity <= _capacity) return;
+
+            T* new_data = _allocator.allocate(new_capacity);
+            for (size_type i = 0; i < _size; ++i)
+            {
+                ::new (static_cast<void*>(new_data + i)) T(std::move(_data[i]));
+                _data[i].~T();
+            }
+
+            if (_onHeap()) _allocator.deallocate(_data, _capacity);
+            _data = new_data;
+            _capacity = new_capacity;
+        }
+
+        void resize(size_type count)
+        {
+            if (count < _size)
+            {
+                for (size_type i = count; i < _size; ++i) _data[i].~T();
+            }
+            else if (count > _size)
+            {
+                reserve(count);
+                for (size_type i = _size; i < count; ++i) ::new (static_cast<void*>(_data + i)) T();
+            }
+            _size = count;
+        }
+
+        void clear() noexcept
+        {
+            for (size_type i = 0; i < _size; ++i) _data[i].~T();
+            _size = 0;
+        }
+
+        void push_back(const T& value)
+        {
+            if (_size == _capacity) reserve(_capacity * 2);
+            ::new (static_cast<void*>(_data + _size)) T(value);
+            ++_size;
+        }
+
+        void push_back(T&& value)
+        {
+            if (_size == _capacity) reserve(_capacity * 2);
+            ::new (static_cast<void*>(_data + _size)) T(std::move(value));
+            ++_size;
+        }
+
+        template<typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (_size == _capacity) reserve(_capacity * 2);
+            ::new (static_cast<void*>(_data + _size)) T(std::forward<Args>(args)...);
+            return _data[_size++];
+        }
+
+        iterator erase(iterator pos)
+        {
+            for (iterator itr = pos; (itr + 1) != end(); ++itr) *itr = std::move(*(itr + 1));
+            _data[_size - 1].~T();
+            --_size;
+            return pos;
+        }
+
+        iterator insert(iterator pos, const T& value)
+        {
+            size_type index = static_cast<size_type>(pos - _data);
+            push_back(T{});
+            for (size_type i = _size - 1; i > index; --i) _data[i] = std::move(_data[i - 1]);
+            _data[index] = value;
+            return _data + index;
+        }
+
+        void swap(small_vector& rhs) noexcept
+        {
+            small_vector temp(std::move(rhs));
+            rhs = std::move(*this);
+            *this = std::move(temp);
+        }
+
+    private:
+        T* _inline() noexcept { return reinterpret_cast<T*>(_inlineStorage); }
+        bool _onHeap() const noexcept { return _data != reinterpret_cast<const T*>(_inlineStorage); }
+
+        void _destroy()
+        {
+            clear();
+            if (_onHeap()) _allocator.deallocate(_data, _capacity);
+        }
+
+        // move the contents of rhs into this freshly reset vector, stealing the heap block when there is one
+        void _moveFrom(small_vector& rhs) noexcept
+        {
+            if (rhs._onHeap())
+            {
+                _data = rhs._data;
+                _size = rhs._size;
+                _capacity = rhs._capacity;
+            }
+            else
+            {
+                for (size_type i = 0; i < rhs._size; ++i)
+                {
+                    ::new (static_cast<void*>(_data + i)) T(std::move(rhs._data[i]));
+                    rhs._data[i].~T();
+                }
+                _size = rhs._size;
+            }
+            rhs._data = rhs._inline();
+            rhs._size = 0;
+            rhs._capacity = N;
+        }
+
+        T* _data;
+        size_type _size;
+        size_type _capacity;
+        alignas(T) unsigned char _inlineStorage[N * sizeof(T)];
+        Allocator _allocator;
+    };
+
+    template<typename T, std::size_t N, typename Allocator>
+    bool operator==(const small_vector<T, N, Allocator>& lhs, const small_vector<T, N, Allocator>& rhs)
+    {
+        if (lhs.size() != rhs.size()) return false;
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            if (!(lhs[i] == rhs[i])) return false;
+        }
+        return true;
+    }
+
+    template<typename T, std::size_t N, typename Allocator>
+    bool operator!=(const small_vector<T, N, Allocator>& lhs, const small_vector<T, N, Allocator>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+} // namespace vsg
@@ -0,0 +1,83 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/ReaderWriter.h>
+
+#include <fstream>
+#include <unordered_map>
+
+namespace vsg
+{
+
+    /// Archive packs many small files, such as PagedLOD tile databases, into a single file with a
+    /// central directory mapping keys to offsets, held in a hash map once opened. Reads are served
+    /// from a single memory mapping of the archive so resolving a tile requires no per file
+    /// open/stat system calls. Add an opened Archive to Options::readerWriters so that vsg::read()
+    /// and the DatabasePager resolve tile filenames against the archive, keys must therefore match
+    /// the filenames recorded in the dataset, such as PagedLOD::filename.
+    /// open() must complete before the Archive is shared between threads, after which reads are lock free.
+    class VSG_DECLSPEC Archive : public Inherit<ReaderWriter, Archive>
+    {
+    public:
+        Archive();
+        explicit Archive(const Path& archiveFilename);
+
+        /// open an existing archive, memory mapping its contents and loading the central directory
+        bool open(const Path& archiveFilename);
+
+        /// serve a read of a key stored in the archive, returning {} when the key is not present
+        ref_ptr<Object> read(const Path& filename, ref_ptr<const Options> options = {}) const override;
+
+        /// return true if the archive contains the specified key
+        bool contains(const Path& key) const { return _entries.count(key.string()) != 0; }
+
+        /// return the number of entries in the central directory
+        size_t numEntries() const { return _entries.size(); }
+
+        // writing interface for tools that pack tile datasets, not thread safe.
+        /// start writing a new archive
+        bool create(const Path& archiveFilename);
+
+        /// append the contents of sourceFilename to the archive under the specified key
+        bool add(const Path& key, const Path& sourceFilename);
+
+        /// append size bytes to the archive under the specified key
+        bool add(const Path& key, const void* ptr, uint64_t size);
+
+        /// serialize the object as native binary .vsgb and append it to the archive under the specified key.
+        /// Together with LazyLoadNode this allows a large scene to be split into named subgraphs that are
+        /// only read and compiled when first traversed - write each subgraph under its key and reference
+        /// it from a LazyLoadNode in the root scene, itself stored under a well known key such as "root".
+        bool add(const Path& key, const Object* object, ref_ptr<const Options> options = {});
+
+        /// write the central directory and finish the archive
+        bool close();
+
+    protected:
+        struct Entry
+        {
+            uint64_t offset = 0;
+            uint64_t size = 0;
+        };
+
+        ref_ptr<Data> _mappedData;
+        std::unordered_map<std::string, Entry> _entries;
+
+        ref_ptr<ReaderWriter> _native;
+
+        std::ofstream _output;
+    };
+    VSG_type_name(vsg::Archive);
+
+} // namespace vsg
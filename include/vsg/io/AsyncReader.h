@@ -0,0 +1,100 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/ReaderWriter.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <functional>
+
+namespace vsg
+{
+
+    /// ReadRequest represents a single in-flight asynchronous read - the filename and options to
+    /// read with, an optional completion callback and, once the read has finished, the result.
+    /// The callback is invoked on the thread that performed the read, so it should hand heavy
+    /// follow-on work to OperationThreads/TaskGraph rather than doing it inline. Callers that
+    /// prefer blocking can instead call wait() to rendezvous with the result.
+    class VSG_DECLSPEC ReadRequest : public Inherit<Object, ReadRequest>
+    {
+    public:
+        using Completion = std::function<void(ReadRequest&)>;
+
+        ReadRequest(const Path& in_filename, ref_ptr<const Options> in_options = {}, Completion in_completion = {});
+
+        Path filename;
+        ref_ptr<const Options> options;
+        Completion completion;
+
+        /// the result of the read, valid once completed() returns true - either the loaded object,
+        /// a ReadError, or null when no ReaderWriter supported the file
+        ref_ptr<Object> object;
+
+        bool completed() const;
+
+        /// block until the read has completed and return the result
+        ref_ptr<Object> wait();
+
+        /// assign the result, invoke the completion callback and release any threads blocked in wait().
+        /// Called by the ReaderWriter/AsyncReader that performed the read.
+        void complete(ref_ptr<Object> result);
+
+    protected:
+        mutable std::mutex _mutex;
+        std::condition_variable _cv;
+        bool _completed = false;
+    };
+    VSG_type_name(vsg::ReadRequest);
+
+    /// AsyncReader keeps many file reads in flight on a small pool of threads, completing each
+    /// ReadRequest via its callback as it finishes rather than blocking one thread per read. Reads
+    /// are dispatched through ReaderWriter::readAsync() when an explicit readerWriter is assigned,
+    /// so ReaderWriters with native asynchronous backends can overlap their I/O, otherwise through
+    /// the standard vsg::read() path. Suitable for DatabasePager style tile loading where hundreds
+    /// of requests may be outstanding at once.
+    class VSG_DECLSPEC AsyncReader : public Inherit<Object, AsyncReader>
+    {
+    public:
+        explicit AsyncReader(uint32_t numThreads = 4, ref_ptr<ActivityStatus> in_status = {});
+        explicit AsyncReader(ref_ptr<OperationThreads> in_operationThreads);
+
+        /// threads that perform the reads, assignable so a pool can be shared with other subsystems
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// optional ReaderWriter to dispatch reads through, when unset reads go through vsg::read()
+        ref_ptr<ReaderWriter> readerWriter;
+
+        /// begin an asynchronous read, returning the ReadRequest to poll, wait on or ignore in
+        /// favour of the completion callback
+        ref_ptr<ReadRequest> read(const Path& filename, ref_ptr<const Options> options = {}, ReadRequest::Completion completion = {});
+
+        /// begin a previously constructed request, allowing callers to preassign fields
+        void read(ref_ptr<ReadRequest> request);
+
+        /// number of requests begun but not yet completed
+        size_t pendingRequests() const { return _pendingRequests.load(std::memory_order_acquire); }
+
+        /// block until all pending requests have completed
+        void wait();
+
+        /// called by the read operations as each request finishes, releasing threads blocked in wait()
+        void requestCompleted();
+
+    protected:
+        std::atomic<size_t> _pendingRequests{0};
+        std::mutex _waitMutex;
+        std::condition_variable _waitCV;
+    };
+    VSG_type_name(vsg::AsyncReader);
+
+} // namespace vsg
@@ -14,10 +14,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/core/Object.h>
 
+#include <vsg/io/CompressionCodec.h>
 #include <vsg/io/Input.h>
 #include <vsg/io/Options.h>
 
 #include <fstream>
+#include <vector>
 
 namespace vsg
 {
@@ -27,7 +29,9 @@ namespace vsg
     class VSG_DECLSPEC BinaryInput : public vsg::Input
     {
     public:
-        BinaryInput(std::istream& input, ref_ptr<ObjectFactory> in_objectFactory, ref_ptr<const Options> in_options = {});
+        /// in_mappedData optionally provides the memory mapped storage that the input stream reads from,
+        /// enabling Arrays to alias the mapped pages via mappedStorage() rather than copying their data.
+        BinaryInput(std::istream& input, ref_ptr<ObjectFactory> in_objectFactory, ref_ptr<const Options> in_options = {}, ref_ptr<Data> in_mappedData = {});
 
         bool matchPropertyName(const char*) override { return true; }
 
@@ -41,7 +45,10 @@ namespace vsg
         template<typename T>
         void _read(size_t num, T* value)
         {
-            _input.read(reinterpret_cast<char*>(value), num * sizeof(T));
+            if (size_t bytes = num * sizeof(T); codec && bytes >= CompressionCodec::minimumBlockSize)
+                _readBlock(value, bytes);
+            else
+                _input.read(reinterpret_cast<char*>(value), bytes);
         }
 
         // read value(s)
@@ -74,8 +81,27 @@ namespace vsg
         /// read object
         vsg::ref_ptr<vsg::Object> read() override;
 
+        /// return the memory mapped storage when assigned and the next size bytes are suitably aligned
+        ref_ptr<Data> mappedStorage(size_t size, size_t alignment, size_t& offset) override;
+
+        /// optional codec used to decompress bulk data blocks, assigned from Options::compressionCodec
+        ref_ptr<const CompressionCodec> codec;
+
     protected:
+        /// read a bulk data block written by BinaryOutput::_writeBlock(), decompressing it when required
+        void _readBlock(void* ptr, size_t bytes);
+
         std::istream& _input;
+        ref_ptr<Data> _mappedData;
+
+        // table of class names and their creation functions indexed by the tokens written by BinaryOutput,
+        // resolving each class name against the ObjectFactory only once per file.
+        struct ClassNameEntry
+        {
+            std::string className;
+            ObjectFactory::CreateFunction createFunction;
+        };
+        std::vector<ClassNameEntry> _classNameTable;
     };
 
 } // namespace vsg
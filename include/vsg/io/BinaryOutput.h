@@ -12,10 +12,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/io/CompressionCodec.h>
 #include <vsg/io/Options.h>
 #include <vsg/io/Output.h>
 
 #include <fstream>
+#include <unordered_map>
 
 namespace vsg
 {
@@ -36,7 +38,10 @@ namespace vsg
         template<typename T>
         void _write(size_t num, const T* value)
         {
-            _output.write(reinterpret_cast<const char*>(value), num * sizeof(T));
+            if (size_t bytes = num * sizeof(T); codec && bytes >= CompressionCodec::minimumBlockSize)
+                _writeBlock(value, bytes);
+            else
+                _output.write(reinterpret_cast<const char*>(value), bytes);
         }
 
         // write contiguous array of value(s)
@@ -61,8 +66,19 @@ namespace vsg
         /// write object
         void write(const vsg::Object* object) override;
 
+        /// optional codec used to compress bulk data blocks, assigned from Options::compressionCodec
+        ref_ptr<const CompressionCodec> codec;
+
     protected:
+        /// compress a bulk data block and write it with its block framing, falling back to storing it raw when incompressible
+        void _writeBlock(const void* ptr, size_t bytes);
+
+        /// write the class name as a uint32 token, emitting the string itself only on its first occurrence
+        void _writeClassName(const char* className);
+
         std::ostream& _output;
+
+        std::unordered_map<std::string, uint32_t> _classNameTokens;
     };
 
 } // namespace vsg
@@ -0,0 +1,44 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+
+namespace vsg
+{
+
+    /// CompressionCodec provides a base class for pluggable block compression codecs (LZ4, zstd etc.)
+    /// used by BinaryOutput/BinaryInput to compress the bulk data blocks of .vsgb files.
+    /// Assign an implementation to Options::compressionCodec when writing, and assign the same codec
+    /// when reading the files back - the codec used is not recorded in the file itself.
+    /// Each block is compressed independently so multiple threads, such as DatabasePager's
+    /// OperationThreads, can decompress different files/tiles concurrently.
+    class CompressionCodec : public Inherit<Object, CompressionCodec>
+    {
+    public:
+        /// data blocks smaller than minimumBlockSize are written without compression or block framing.
+        /// Shared by BinaryOutput and BinaryInput so must be identical when writing and reading.
+        static constexpr size_t minimumBlockSize = 4096;
+
+        /// return the maximum number of bytes that compress() may require to hold a compressed block of sourceSize bytes
+        virtual size_t compressBound(size_t sourceSize) const = 0;
+
+        /// compress sourceSize bytes from source into dest, returning the compressed size, or 0 on failure
+        virtual size_t compress(const void* source, size_t sourceSize, void* dest, size_t destCapacity) const = 0;
+
+        /// decompress sourceSize compressed bytes from source into destSize bytes at dest, returning true on success
+        virtual bool decompress(const void* source, size_t sourceSize, void* dest, size_t destSize) const = 0;
+    };
+    VSG_type_name(vsg::CompressionCodec);
+
+} // namespace vsg
@@ -17,6 +17,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/observer_ptr.h>
 #include <vsg/io/FileSystem.h>
 #include <vsg/io/Options.h>
+#include <vsg/io/RetainedTileCache.h>
 #include <vsg/nodes/PagedLOD.h>
 #include <vsg/threading/ActivityStatus.h>
 #include <vsg/utils/Instrumentation.h>
@@ -67,10 +68,23 @@ namespace vsg
 
         Nodes take_all(CompileResult& result);
 
+        /// remove and return all entries that have not been recorded within maxFrameDelta frames of frameCount,
+        /// so that the caller can cancel the associated requests.
+        Nodes take_stale(uint64_t frameCount, uint64_t maxFrameDelta);
+
+        /// splice nodes onto the front of the queue, leaving the passed in container empty.
+        void add_front(Nodes& nodes);
+
+        /// return true if the queue contains no entries
+        bool empty() const;
+
+        /// return the number of entries in the queue
+        size_t size() const;
+
     protected:
         virtual ~DatabaseQueue();
 
-        std::mutex _mutex;
+        mutable std::mutex _mutex;
         std::condition_variable _cv;
         Nodes _queue;
         CompileResult _compileResult;
@@ -94,6 +108,9 @@ namespace vsg
 
         virtual void updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr);
 
+        /// return true if requests are still being read/compiled or newly loaded subgraphs are queued for the next updateSceneGraph() call
+        bool requiresUpdateSceneGraph() const;
+
         ref_ptr<CompileManager> compileManager;
 
         std::atomic_uint numActiveRequests{0};
@@ -101,9 +118,59 @@ namespace vsg
 
         ref_ptr<CulledPagedLODs> culledPagedLODs;
 
+        /// when true start() places the read threads on the efficiency cores of hybrid CPUs via
+        /// pagerThreadAffinity(), keeping database reads and compiles off the cores running per frame work.
+        bool automaticThreadAffinity = true;
+
+        /// bounds for the adaptive read thread pool. start() launches maxReadThreads threads and
+        /// updateSceneGraph() periodically adjusts how many are active from the request queue depth and the
+        /// measured per request read latency, so slow network mounted databases get more concurrent reads
+        /// in flight than fast local storage without per deployment hand tuning. Assign before start().
+        uint32_t minReadThreads = 1;
+        uint32_t maxReadThreads = 8;
+
+        /// bounds for the compile thread pool that runs the CPU/GPU bound compile stage of newly loaded
+        /// subgraphs, kept separate from the I/O bound read pool so heavy compiles don't starve reads and
+        /// slow reads don't idle the compilers. Assign before start().
+        uint32_t minCompileThreads = 1;
+        uint32_t maxCompileThreads = 4;
+
+        /// number of frames between adaptive thread pool scaling updates
+        uint32_t threadScalingInterval = 60;
+
+        /// target time, in seconds, for the active read threads to clear the current request backlog,
+        /// combined with the measured average read latency to size the read pool
+        double targetDrainTime = 1.0;
+
         /// for systems with smaller GPU memory limits you may need to reduce the targetMaxNumPagedLODWithHighResSubgraphs to keep memory usage within available limits.
         uint32_t targetMaxNumPagedLODWithHighResSubgraphs = 1500;
 
+        /// target maximum memory footprint, in bytes, of the loaded high res PagedLOD subgraphs. Each loaded
+        /// subgraph is accounted at its estimated CPU + GPU size, assigned to PagedLOD::highResBytes when the
+        /// load completes, and the least recently traversed tiles are expired first whenever the total goes
+        /// over budget, so memory use stays bounded regardless of how heavy individual tiles are. 0 disables
+        /// the byte budget, with targetMaxNumPagedLODWithHighResSubgraphs remaining in force as a count based
+        /// limit either way.
+        std::size_t targetMaxPagedLODMemory = 0;
+
+        /// maximum number of newly loaded PagedLOD subgraphs to merge into the scene graph per updateSceneGraph() call,
+        /// with any remainder kept queued for subsequent frames. 0 disables the limit.
+        uint32_t maximumTilesMergedPerFrame = 0;
+
+        /// maximum time, in seconds, that updateSceneGraph() spends merging newly loaded PagedLOD subgraphs,
+        /// with any remainder kept queued for subsequent frames. 0.0 disables the limit.
+        double maximumTimeMergingPerFrame = 0.0;
+
+        /// optional second chance cache for expired tiles - when assigned, the subgraphs trimmed by
+        /// updateSceneGraph() are retained as compressed in memory blobs and the read threads consult the
+        /// cache before reading from the filesystem, so revisiting an area deserializes from RAM rather
+        /// than paying the full disk/network reload cost.
+        ref_ptr<RetainedTileCache> retainedTileCache;
+
+        /// when true updateSceneGraph() cancels queued read requests for PagedLOD that were not recorded in the previous frame,
+        /// so that read bandwidth during fast camera movement isn't spent loading tiles that have already gone off screen.
+        bool cancelStaleRequests = true;
+
         std::mutex pendingPagedLODMutex;
 
         ref_ptr<PagedLODContainer> pagedLODContainer;
@@ -119,12 +186,26 @@ namespace vsg
 
         void requestDiscarded(PagedLOD* plod);
 
+        /// adjust the number of active read and compile threads from the queue depths, measured read latency and merge backlog
+        void updateThreadScaling();
+
         ref_ptr<ActivityStatus> _status;
 
         ref_ptr<DatabaseQueue> _requestQueue;
+        ref_ptr<DatabaseQueue> _toCompileQueue;
         ref_ptr<DatabaseQueue> _toMergeQueue;
 
         std::list<std::thread> _readThreads;
+        std::list<std::thread> _compileThreads;
+
+        // adaptive thread pool state - threads with a slot index at or above the active count park until regrowth
+        std::atomic_uint _activeReadThreads{0};
+        std::atomic_uint _activeCompileThreads{0};
+        std::atomic_uint64_t _readTimeNanoseconds{0};
+        std::atomic_uint _readSampleCount{0};
+        uint64_t _lastScalingFrame = 0;
+        uint32_t _readIdleIntervals = 0;
+        uint32_t _compileIdleIntervals = 0;
     };
     VSG_type_name(vsg::DatabasePager);
 
@@ -0,0 +1,69 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/FileSystem.h>
+
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace vsg
+{
+
+    /// DirectoryCache caches directory listings in memory so that repeated file existence checks,
+    /// such as vsg::findFile() probing each of Options::paths per tile during database paging,
+    /// become hash lookups rather than per file stat/access system calls. Each directory is listed
+    /// once and re-listed when older than timeToLive. Assign to Options::directoryCache to have
+    /// vsg::findFile(filename, options) served from the cache. Thread safe.
+    class VSG_DECLSPEC DirectoryCache : public Inherit<Object, DirectoryCache>
+    {
+    public:
+        DirectoryCache();
+
+        /// time to live, in seconds, of a cached directory listing before it is re-read,
+        /// 0.0 (the default) caches listings for the lifetime of the cache/until invalidated.
+        double timeToLive = 0.0;
+
+        /// return true if the file exists, consulting the cached listing of its containing directory
+        bool fileExists(const Path& path);
+
+        /// equivalent of vsg::findFile(filename, paths) served from the cache
+        Path findFile(const Path& filename, const Paths& paths);
+
+        /// equivalent of vsg::findFile(filename, options) served from the cache
+        Path findFile(const Path& filename, const Options* options);
+
+        /// discard all cached directory listings
+        void clear();
+
+        /// discard the cached listing of the specified directory so the next query re-reads it
+        void invalidate(const Path& directory);
+
+    protected:
+        struct DirectoryEntry
+        {
+            std::chrono::steady_clock::time_point timeLoaded;
+            std::unordered_set<std::string> files;
+        };
+
+        /// return the cached listing for the directory, reading/refreshing it when required. Requires _mutex to be held.
+        DirectoryEntry& getDirectory(const Path& directory);
+
+        std::mutex _mutex;
+        std::unordered_map<std::string, DirectoryEntry> _directories;
+    };
+    VSG_type_name(vsg::DirectoryCache);
+
+} // namespace vsg
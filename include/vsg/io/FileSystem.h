@@ -47,6 +47,10 @@ namespace vsg
     /// return true if a specified file/path exists on system.
     extern VSG_DECLSPEC bool fileExists(const Path& path);
 
+    /// return a string combining the file's size and last modification time, a cheap key for detecting
+    /// whether a file has changed between runs, or an empty string when the file doesn't exist.
+    extern VSG_DECLSPEC std::string fileModificationStamp(const Path& path);
+
     /// return the full filename path if specified filename can be found in the list of paths.
     extern VSG_DECLSPEC Path findFile(const Path& filename, const Paths& paths);
 
@@ -68,6 +68,12 @@ namespace vsg
         // read object
         virtual ref_ptr<Object> read() = 0;
 
+        /// Optional zero copy support. When the input is backed by memory mapped storage and the next size
+        /// bytes are aligned to the specified alignment, return the Data object providing the mapping, set
+        /// offset to their position within it and advance the read position past them. Return {} when
+        /// unsupported, in which case the caller falls back to allocating and copying as usual.
+        virtual ref_ptr<Data> mappedStorage(size_t /*size*/, size_t /*alignment*/, size_t& /*offset*/) { return {}; }
+
         // map char to int8_t
         void read(size_t num, char* value) { read(num, reinterpret_cast<int8_t*>(value)); }
         void read(size_t num, bool* value) { read(num, reinterpret_cast<int8_t*>(value)); }
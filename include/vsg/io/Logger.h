@@ -14,7 +14,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/core/Inherit.h>
 #include <vsg/io/stream.h>
+#include <vsg/threading/LockFreeQueue.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <string_view>
 #include <thread>
@@ -385,6 +388,55 @@ namespace vsg
     };
     VSG_type_name(vsg::ThreadLogger);
 
+    /// Logger that hands formatted messages to a background thread through a lock free ring buffer,
+    /// so hot path logging calls pay only for formatting and an enqueue while the delegate logger's
+    /// I/O runs asynchronously. When the ring is momentarily full the message is written through the
+    /// delegate directly so no messages are lost, and fatal messages drain the queue and are written
+    /// synchronously so the exception the delegate throws propagates on the calling thread.
+    /// Message filtering is controlled by the AsyncLogger's own level, the delegate's level is set to LOGGER_ALL.
+    /// To use the AsyncLogger use:
+    ///     vsg::Logger::instance() = AsyncLogger::create();
+    class VSG_DECLSPEC AsyncLogger : public Inherit<Logger, AsyncLogger>
+    {
+    public:
+        explicit AsyncLogger(ref_ptr<Logger> in_delegate = {}, size_t queueSize = 1024);
+
+        /// logger that performs the actual writing on the background thread, defaults to StdLogger
+        ref_ptr<Logger> delegate;
+
+        /// block until all queued messages have been written, then flush the delegate
+        void flush() override;
+
+    protected:
+        ~AsyncLogger();
+
+        struct Message
+        {
+            Level msg_level = LOGGER_INFO;
+            std::string text;
+        };
+
+        void debug_implementation(const std::string_view& message) override;
+        void info_implementation(const std::string_view& message) override;
+        void warn_implementation(const std::string_view& message) override;
+        void error_implementation(const std::string_view& message) override;
+        void fatal_implementation(const std::string_view& message) override;
+
+        void _enqueue(Level msg_level, const std::string_view& message);
+        void _wait();
+        void _run();
+
+        ref_ptr<LockFreeQueue<Message*>> _queue;
+        std::atomic_uint _pending{0};
+        std::atomic_bool _active{true};
+        std::mutex _sleepMutex;
+        std::condition_variable _sleepCV;
+        std::mutex _drainMutex;
+        std::condition_variable _drainCV;
+        std::thread _thread;
+    };
+    VSG_type_name(vsg::AsyncLogger);
+
     /// Logger that ignores all messages
     /// To use the NullLogger use:
     ///     vsg::Logger::instance() = NullLogger::create();
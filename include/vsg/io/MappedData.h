@@ -0,0 +1,62 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Data.h>
+#include <vsg/core/Inherit.h>
+#include <vsg/io/Path.h>
+
+namespace vsg
+{
+
+    /// MappedData wraps a private, copy-on-write memory mapping of a file as a vsg::Data, so loaders
+    /// can construct Array objects that alias pages of native binary files instead of copying them,
+    /// with the operating system paging the data in on first touch. The mapping is writable but
+    /// private, so modifying an aliasing Array dirties private pages rather than the file itself.
+    /// The mapping is released when the last Array referencing it as storage is destroyed.
+    class VSG_DECLSPEC MappedData : public Inherit<Data, MappedData>
+    {
+    public:
+        /// map the specified file, returning {} if the file cannot be opened or mapped
+        static ref_ptr<MappedData> map(const Path& filename);
+
+        size_t valueSize() const override { return 1; }
+        size_t valueCount() const override { return _size; }
+
+        bool dataAvailable() const override { return _ptr != nullptr; }
+        size_t dataSize() const override { return _size; }
+
+        void* dataPointer() override { return _ptr; }
+        const void* dataPointer() const override { return _ptr; }
+
+        void* dataPointer(size_t index) override { return static_cast<uint8_t*>(_ptr) + index; }
+        const void* dataPointer(size_t index) const override { return static_cast<const uint8_t*>(_ptr) + index; }
+
+        /// the mapping cannot be released to the caller, ownership stays with the MappedData
+        void* dataRelease() override { return nullptr; }
+
+        uint32_t dimensions() const override { return 1; }
+        uint32_t width() const override { return static_cast<uint32_t>(_size); }
+        uint32_t height() const override { return 1; }
+        uint32_t depth() const override { return 1; }
+
+    protected:
+        MappedData(void* ptr, size_t size);
+        virtual ~MappedData();
+
+        void* _ptr = nullptr;
+        size_t _size = 0;
+    };
+    VSG_type_name(vsg::MappedData);
+
+} // namespace vsg
@@ -0,0 +1,142 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Object.h>
+
+#include <vsg/io/CompressionCodec.h>
+#include <vsg/io/Input.h>
+#include <vsg/io/Options.h>
+
+#include <cstring>
+#include <vector>
+
+namespace vsg
+{
+
+    /// vsg::Input subclass that parses native .vsgb binary data directly from a block of memory through an
+    /// inlined bounds checked cursor, avoiding the per read std::istream virtual call and streambuf protocol
+    /// overhead that BinaryInput pays even when wrapping memory in a mem_stream. Used automatically by the
+    /// VSG ReaderWriter when the source is already in memory - memory mapped files, archive payloads and
+    /// network tiles read through the (ptr, size) entry point.
+    class VSG_DECLSPEC MemoryBinaryInput : public vsg::Input
+    {
+    public:
+        /// read from the [ptr, ptr+size) block of memory. in_mappedData optionally provides the object that
+        /// owns the memory, such as a memory mapped file, enabling Arrays to alias it via mappedStorage()
+        /// rather than copying their data - the block must then lie within in_mappedData's storage.
+        MemoryBinaryInput(const uint8_t* ptr, size_t size, ref_ptr<ObjectFactory> in_objectFactory, ref_ptr<const Options> in_options = {}, ref_ptr<Data> in_mappedData = {});
+
+        bool matchPropertyName(const char*) override { return true; }
+
+        /// current read position within the memory block
+        size_t position() const { return static_cast<size_t>(_ptr - _begin); }
+
+        /// number of bytes remaining in the memory block
+        size_t remaining() const { return static_cast<size_t>(_end - _ptr); }
+
+        /// return true when a read has run past the end of the memory block
+        bool failed() const { return _failed; }
+
+        ObjectID objectID()
+        {
+            ObjectID id = 0;
+            _readBytes(&id, sizeof(uint32_t));
+            return id;
+        }
+
+        template<typename T>
+        void _read(size_t num, T* value)
+        {
+            if (size_t bytes = num * sizeof(T); codec && bytes >= CompressionCodec::minimumBlockSize)
+                _readBlock(value, bytes);
+            else
+                _readBytes(value, bytes);
+        }
+
+        // read value(s)
+        void read(size_t num, int8_t* value) override { _read(num, value); }
+        void read(size_t num, uint8_t* value) override { _read(num, value); }
+        void read(size_t num, int16_t* value) override { _read(num, value); }
+        void read(size_t num, uint16_t* value) override { _read(num, value); }
+        void read(size_t num, int32_t* value) override { _read(num, value); }
+        void read(size_t num, uint32_t* value) override { _read(num, value); }
+        void read(size_t num, int64_t* value) override { _read(num, value); }
+        void read(size_t num, uint64_t* value) override { _read(num, value); }
+        void read(size_t num, float* value) override { _read(num, value); }
+        void read(size_t num, double* value) override { _read(num, value); }
+
+        // read in an individual string
+        void _read(std::string& value);
+
+        /// read one or more strings
+        void read(size_t num, std::string* value) override;
+
+        // read in an individual string
+        void _read(std::wstring& value);
+
+        /// read one or more strings
+        void read(size_t num, std::wstring* value) override;
+
+        /// read one or more paths
+        void read(size_t num, Path* value) override;
+
+        /// read object
+        vsg::ref_ptr<vsg::Object> read() override;
+
+        /// return the memory owning object when assigned and the next size bytes are suitably aligned
+        ref_ptr<Data> mappedStorage(size_t size, size_t alignment, size_t& offset) override;
+
+        /// optional codec used to decompress bulk data blocks, assigned from Options::compressionCodec
+        ref_ptr<const CompressionCodec> codec;
+
+    protected:
+        /// inlined bounds checked copy from the cursor, zero filling the destination and flagging
+        /// failure when the read would run past the end of the memory block
+        void _readBytes(void* dest, size_t bytes)
+        {
+            if (static_cast<size_t>(_end - _ptr) < bytes)
+            {
+                _ptr = _end;
+                _failed = true;
+                std::memset(dest, 0, bytes);
+                return;
+            }
+            std::memcpy(dest, _ptr, bytes);
+            _ptr += bytes;
+        }
+
+        /// read a bulk data block written by BinaryOutput::_writeBlock(), decompressing it in place from the cursor when required
+        void _readBlock(void* ptr, size_t bytes);
+
+        const uint8_t* _begin = nullptr;
+        const uint8_t* _ptr = nullptr;
+        const uint8_t* _end = nullptr;
+        bool _failed = false;
+
+        ref_ptr<Data> _mappedData;
+
+        /// offset of _begin within _mappedData's storage, so mappedStorage() offsets are relative to the owning object
+        size_t _mappedOffset = 0;
+
+        // table of class names and their creation functions indexed by the tokens written by BinaryOutput,
+        // resolving each class name against the ObjectFactory only once per file.
+        struct ClassNameEntry
+        {
+            std::string className;
+            ObjectFactory::CreateFunction createFunction;
+        };
+        std::vector<ClassNameEntry> _classNameTable;
+    };
+
+} // namespace vsg
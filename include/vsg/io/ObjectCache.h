@@ -0,0 +1,94 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace vsg
+{
+
+    /// ObjectCache caches the objects loaded by vsg::read() so that repeated reads of the same file,
+    /// such as a texture referenced by many models, return the already loaded instance rather than
+    /// re-reading and re-parsing it. Entries are keyed by (filename, options), with the options
+    /// distinguished by their deep compare so equivalent Options instances share entries, and are
+    /// evicted least recently used first against a byte budget. Concurrent reads of the same file,
+    /// such as parallel DatabasePager loads of a shared texture, block on a per entry mutex so only
+    /// one performs the load. Assign to Options::objectCache to enable. Thread safe.
+    class VSG_DECLSPEC ObjectCache : public Inherit<Object, ObjectCache>
+    {
+    public:
+        explicit ObjectCache(std::size_t in_maxCachedBytes = 512 * 1024 * 1024);
+
+        /// maximum total bytes of cached objects, the least recently used entries are evicted when over
+        std::size_t maxCachedBytes;
+
+        using LoadFunction = std::function<ref_ptr<Object>()>;
+
+        /// return the cached object for (filename, options), invoking loadFunction and caching its
+        /// result on a miss. Failed loads are not retained so subsequent calls retry.
+        ref_ptr<Object> getOrLoad(const Path& filename, ref_ptr<const Options> options, const LoadFunction& loadFunction);
+
+        /// return the cached object for (filename, options), or null when not in the cache
+        ref_ptr<Object> get(const Path& filename, ref_ptr<const Options> options = {});
+
+        /// remove any entries for filename, across all options they were loaded with
+        void remove(const Path& filename);
+
+        /// total bytes currently cached
+        std::size_t cachedBytes() const;
+
+        /// discard all cached objects
+        void clear();
+
+    protected:
+        struct Key
+        {
+            Path filename;
+            ref_ptr<const Options> options;
+        };
+
+        struct KeyCompare
+        {
+            bool operator()(const Key& lhs, const Key& rhs) const;
+        };
+
+        struct Item : public Inherit<Object, Item>
+        {
+            std::mutex mutex;
+            ref_ptr<Object> object;
+            std::size_t bytes = 0;
+            bool loaded = false;
+            std::list<Key>::iterator lruItr;
+        };
+
+        using Items = std::map<Key, ref_ptr<Item>, KeyCompare>;
+
+        /// find or create the entry for key, refreshing its LRU position. Requires _mutex to be held.
+        ref_ptr<Item> _getOrCreateItem(const Key& key);
+
+        /// evict least recently used entries until within maxCachedBytes. Requires _mutex to be held.
+        void _evict();
+
+        mutable std::mutex _mutex;
+        Items _items;
+        std::list<Key> _lru; // least recently used at the front
+        std::size_t _cachedBytes = 0;
+    };
+    VSG_type_name(vsg::ObjectCache);
+
+} // namespace vsg
@@ -16,7 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/type_name.h>
 
 #include <functional>
-#include <map>
+#include <unordered_map>
 
 namespace vsg
 {
@@ -31,7 +31,8 @@ namespace vsg
         virtual vsg::ref_ptr<vsg::Object> create(const std::string& className);
 
         using CreateFunction = std::function<vsg::ref_ptr<vsg::Object>()>;
-        using CreateMap = std::map<std::string, CreateFunction>;
+        // hash indexed so that the per object class name lookups done during loading are O(1)
+        using CreateMap = std::unordered_map<std::string, CreateFunction>;
 
         CreateMap& getCreateMap() { return _createMap; }
         const CreateMap& getCreateMap() const { return _createMap; }
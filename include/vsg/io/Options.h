@@ -24,6 +24,10 @@ namespace vsg
 
     class SharedObjects;
     class ReaderWriter;
+    class ReaderWriterDispatch;
+    class CompressionCodec;
+    class DirectoryCache;
+    class ObjectCache;
     class OperationThreads;
     class CommandLine;
     class ShaderSet;
@@ -59,7 +63,20 @@ namespace vsg
         void add(const ReaderWriters& rws);
 
         ref_ptr<SharedObjects> sharedObjects;
+
+        /// optional cache of loaded objects consulted by vsg::read(filename, options) before dispatching
+        /// to the ReaderWriters, so repeated reads of the same file, such as a texture referenced by many
+        /// models, return the already loaded instance. Entries are evicted least recently used first
+        /// against the cache's byte budget.
+        ref_ptr<ObjectCache> objectCache;
+
         ReaderWriters readerWriters;
+
+        /// optional dispatch index over readerWriters - when assigned, vsg::read routes each file
+        /// straight to the ReaderWriter its extension or leading bytes identify instead of trialling
+        /// the readerWriters in sequence. Create with ReaderWriterDispatch::create(readerWriters).
+        ref_ptr<ReaderWriterDispatch> readerWriterDispatch;
+
         ref_ptr<OperationThreads> operationThreads;
 
         /// Hint to use when searching for Paths with vsg::findFile(filename, options);
@@ -76,8 +93,22 @@ namespace vsg
         using FindFileCallback = std::function<Path(const Path& filename, const Options* options)>;
         FindFileCallback findFileCallback;
 
+        /// optional cache of directory listings used by vsg::findFile() so repeated searches of Options::paths
+        /// during database paging become hash lookups rather than per file stat system calls.
+        ref_ptr<DirectoryCache> directoryCache;
+
         Path fileCache;
 
+        /// optional directory used by ShaderCompiler to cache compiled SPIR-V on disk, keyed by a hash of
+        /// the shader source, defines and compile settings, so that subsequent runs can reuse previous
+        /// compiles rather than invoking glslang.
+        Path shaderCacheDirectory;
+
+        /// optional directory used by CompressTextures to cache BCn encoded textures on disk, keyed by
+        /// a hash of the source image contents and target format, so that subsequent runs can reuse
+        /// previous encodes rather than recompressing.
+        Path textureCacheDirectory;
+
         Path extensionHint;
         bool mapRGBtoRGBAHint = true;
 
@@ -108,6 +139,10 @@ namespace vsg
         /// mechanism for propogating dynamic objects classification up parental chain so that cloning is done on all dynamic objects to avoid sharing of dyanmic parts.
         ref_ptr<PropagateDynamicObjects> propagateDynamicObjects;
 
+        /// optional codec used by BinaryOutput/BinaryInput to block compress the bulk data of .vsgb files.
+        /// Files written with a codec must be read back with the same codec assigned.
+        ref_ptr<const CompressionCodec> compressionCodec;
+
     protected:
         virtual ~Options();
     };
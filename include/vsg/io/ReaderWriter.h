@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/FileSystem.h>
 #include <vsg/io/Options.h>
 
+#include <mutex>
+
 namespace vsg
 {
 
@@ -30,6 +32,8 @@ namespace vsg
     };
     VSG_type_name(vsg::ReadError);
 
+    class ReadRequest;
+
     /// Base class for providing support for reading and/or writing various file formats and IO protocols
     class VSG_DECLSPEC ReaderWriter : public Inherit<Object, ReaderWriter>
     {
@@ -76,6 +80,12 @@ namespace vsg
         /// write object to output stream, return true on success, return false on failure.
         virtual bool write(const vsg::Object* /*object*/, std::ostream& /*fout*/, vsg::ref_ptr<const vsg::Options> = {}) const { return false; }
 
+        /// begin an asynchronous read of the request's filename, calling ReadRequest::complete() when
+        /// the read finishes. The default implementation falls back to the synchronous read(filename, options)
+        /// on the calling thread; ReaderWriters with native asynchronous backends can override it to keep
+        /// many reads in flight per thread. See vsg::AsyncReader for dispatching requests across threads.
+        virtual void readAsync(ref_ptr<ReadRequest> request) const;
+
         /// read the command line arguments for any options appropriate for this ReaderWriter
         virtual bool readOptions(Options&, CommandLine&) const { return false; }
 
@@ -93,6 +103,10 @@ namespace vsg
             std::map<vsg::Path, FeatureMask> protocolFeatureMap;
             std::map<vsg::Path, FeatureMask> extensionFeatureMap;
             std::map<std::string, std::string> optionNameTypeMap;
+
+            /// leading byte sequences that identify content this ReaderWriter can read, used by
+            /// ReaderWriterDispatch to route files without a recognized extension from their first bytes
+            std::vector<std::string> signatures;
         };
 
         /// get the Features supported by this ReaderWriter
@@ -128,4 +142,33 @@ namespace vsg
     };
     VSG_type_name(vsg::CompositeReaderWriter);
 
+    /// ReaderWriterDispatch builds an index over a list of ReaderWriters from their getFeatures()
+    /// metadata so vsg::read can hand a file straight to a ReaderWriter that supports it instead of
+    /// trialling each in turn. Files are dispatched by extension when the index recognizes one,
+    /// otherwise by matching the file's leading bytes against the signatures the ReaderWriters
+    /// advertise - covering extensionless content addressed files. Files that match nothing fall back
+    /// to trialling the full chain, with the ReaderWriter that succeeds memoized against the extension
+    /// so subsequent files dispatch directly. Assign to Options::readerWriterDispatch to enable.
+    class VSG_DECLSPEC ReaderWriterDispatch : public Inherit<Object, ReaderWriterDispatch>
+    {
+    public:
+        explicit ReaderWriterDispatch(const ReaderWriters& in_readerWriters);
+
+        ReaderWriters readerWriters;
+
+        /// read the file, dispatching directly by extension or leading bytes where possible
+        ref_ptr<Object> read(const Path& filename, ref_ptr<const Options> options = {}) const;
+
+    protected:
+        virtual ~ReaderWriterDispatch();
+
+        std::map<Path, ref_ptr<ReaderWriter>> _extensionMap;
+        std::vector<std::pair<std::string, ref_ptr<ReaderWriter>>> _signatures;
+
+        // guards the memoized extensions recorded during concurrent reads
+        mutable std::mutex _mutex;
+        mutable std::map<Path, ref_ptr<ReaderWriter>> _memoizedExtensionMap;
+    };
+    VSG_type_name(vsg::ReaderWriterDispatch);
+
 } // namespace vsg
@@ -0,0 +1,97 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/CompressionCodec.h>
+#include <vsg/io/Options.h>
+#include <vsg/nodes/Node.h>
+
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace vsg
+{
+
+    // forward declare
+    class VSG;
+
+    /// RetainedTileCache provides a second chance, in memory cache of the PagedLOD subgraphs expired by the
+    /// DatabasePager, so revisiting an area restores tiles from RAM rather than repeating the full
+    /// disk/network read and parse. Expired subgraphs are handed over by reference and serialized to a
+    /// .vsgb blob on the cache's own background thread, with the bulk data blocks compressed through the
+    /// optional codec, so the scene graph objects themselves are released and only the compact blob is
+    /// retained. Assign to DatabasePager::retainedTileCache to enable, the pager's read threads then
+    /// consult the cache before reading from the filesystem. Thread safe.
+    class VSG_DECLSPEC RetainedTileCache : public Inherit<Object, RetainedTileCache>
+    {
+    public:
+        explicit RetainedTileCache(std::size_t in_maxRetainedBytes = 256 * 1024 * 1024);
+
+        /// optional codec (LZ4, zstd etc.) used to compress the bulk data blocks of the serialized tiles
+        ref_ptr<const CompressionCodec> codec;
+
+        /// maximum total bytes of retained tiles, the least recently retained entries are evicted when over
+        std::size_t maxRetainedBytes;
+
+        /// hand an expired subgraph over to the cache. bytesHint estimates the subgraph's in memory size
+        /// and accounts the entry against maxRetainedBytes until the background thread has serialized it.
+        void retain(const Path& filename, ref_ptr<Node> subgraph, ref_ptr<const Options> options, std::size_t bytesHint);
+
+        /// remove and return the retained subgraph for filename, or null when not in the cache. Tiles not
+        /// yet processed by the background thread are handed straight back, otherwise the blob is deserialized.
+        ref_ptr<Node> take(const Path& filename);
+
+        /// total bytes currently retained
+        std::size_t retainedBytes() const;
+
+        /// discard all retained tiles
+        void clear();
+
+    protected:
+        virtual ~RetainedTileCache();
+
+        struct Entry
+        {
+            ref_ptr<Node> subgraph;         // subgraph awaiting serialization, released once the blob has been written
+            ref_ptr<const Options> options; // the tile's original load options, reused when deserializing so sharing/dynamic object settings are preserved
+            std::string blob;               // serialized tile
+            std::size_t bytes = 0;
+            std::list<Path>::iterator lruItr;
+        };
+
+        using Entries = std::map<Path, Entry>;
+
+        /// background thread that serializes pending entries
+        void _run();
+
+        /// evict least recently retained entries until within maxRetainedBytes. Requires _mutex to be held.
+        void _evict();
+
+        ref_ptr<VSG> _vsgReaderWriter;
+
+        mutable std::mutex _mutex;
+        std::condition_variable _cv;
+        bool _stop = false;
+        std::thread _thread;
+
+        Entries _entries;
+        std::list<Path> _lru;     // least recently retained at the front
+        std::list<Path> _pending; // entries awaiting serialization by the background thread
+        std::size_t _retainedBytes = 0;
+    };
+    VSG_type_name(vsg::RetainedTileCache);
+
+} // namespace vsg
@@ -34,6 +34,10 @@ namespace vsg
 
         bool getFeatures(Features& features) const override;
 
+        /// when true, read(filename) memory maps .vsgb files so that Arrays can alias the mapped pages
+        /// rather than copying their data, deferring page-in to first access. Set false to always copy.
+        bool memoryMapFiles = true;
+
         ObjectFactory* getObjectFactory() { return _objectFactory; }
         const ObjectFactory* getObjectFactory() const { return _objectFactory; }
 
@@ -26,6 +26,12 @@ namespace vsg
     /** convenience method for reading objects from files.*/
     extern VSG_DECLSPEC PathObjects read(const Paths& filenames, ref_ptr<const Options> options = {});
 
+    /** read a batch of files, dispatching them across Options::operationThreads when assigned, with a
+      * single SharedObjects instance shared across the batch so that equivalent objects loaded from
+      * different files deduplicate to one instance. Uses Options::sharedObjects when assigned,
+      * otherwise a temporary SharedObjects local to the batch. Returns when all files have completed.*/
+    extern VSG_DECLSPEC PathObjects readShared(const Paths& filenames, ref_ptr<const Options> options = {});
+
     /** convenience method for reading objects from stream.*/
     extern VSG_DECLSPEC ref_ptr<Object> read(std::istream& fin, ref_ptr<const Options> options = {});
 
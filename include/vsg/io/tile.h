@@ -15,9 +15,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/ReaderWriter.h>
 #include <vsg/nodes/TileDatabase.h>
 #include <vsg/state/GraphicsPipeline.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 #include <vsg/utils/ShaderSet.h>
 
+#include <list>
+#include <map>
+
 namespace vsg
 {
 
@@ -39,6 +43,7 @@ namespace vsg
         // timing stats
         mutable std::mutex statsMutex;
         mutable uint64_t numTilesRead{0};
+        mutable uint64_t numTilesFromCache{0};
         mutable double totalTimeReadingTiles{0.0};
 
     protected:
@@ -50,7 +55,7 @@ namespace vsg
         Path getTilePath(const Path& src, uint32_t x, uint32_t y, uint32_t level) const;
 
         ref_ptr<Object> read_root(ref_ptr<const Options> options = {}) const;
-        ref_ptr<Object> read_subtile(uint32_t x, uint32_t y, uint32_t lod, ref_ptr<const Options> options = {}) const;
+        ref_ptr<Object> read_subtile(uint32_t x, uint32_t y, uint32_t lod, ref_ptr<const Options> options, uint64_t& estimatedBytes) const;
 
         ref_ptr<Node> createTile(const dbox& tile_extents, ref_ptr<Data> sourceData) const;
         ref_ptr<Node> createECEFTile(const dbox& tile_extents, ref_ptr<Data> sourceData) const;
@@ -58,7 +63,26 @@ namespace vsg
 
         ref_ptr<StateGroup> createRoot() const;
 
+        /// byte budgeted least recently used cache of built tile subgraphs, keyed by their .tile filename.
+        /// Cached subgraphs keep hold of any compiled Vulkan state so reattaching them avoids both the
+        /// download/decode and the recompile of tiles that were recently expired by the DatabasePager.
+        struct CacheEntry
+        {
+            ref_ptr<Object> object;
+            uint64_t bytes = 0;
+            std::list<Path>::iterator mru_itr;
+        };
+
+        ref_ptr<Object> _getCachedTile(const Path& filename) const;
+        void _addToCache(const Path& filename, ref_ptr<Object> object, uint64_t bytes) const;
+
+        mutable std::mutex _cacheMutex;
+        mutable std::list<Path> _cacheMRU; // front = most recently used
+        mutable std::map<Path, CacheEntry> _tileCache;
+        mutable uint64_t _cacheTotalBytes = 0;
+
         ref_ptr<ShaderSet> _shaderSet;
+        ref_ptr<OperationThreads> _loadThreads;
         ref_ptr<GraphicsPipelineConfigurator> _graphicsPipelineConfig;
         uint32_t _materialSetIndex = 1;
         ref_ptr<Sampler> _sampler;
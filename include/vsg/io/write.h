@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Inherit.h>
 #include <vsg/io/FileSystem.h>
 #include <vsg/io/Options.h>
+#include <vsg/threading/Latch.h>
 
 namespace vsg
 {
@@ -22,4 +23,33 @@ namespace vsg
     /** convenience method for writing objects to file.*/
     extern VSG_DECLSPEC bool write(ref_ptr<Object> object, const Path& filename, ref_ptr<const Options> options = {});
 
+    /// handle returned by vsg::writeAsync() for tracking completion of a write scheduled on Options::operationThreads.
+    class AsyncWrite : public Inherit<Object, AsyncWrite>
+    {
+    public:
+        AsyncWrite() :
+            latch(Latch::create(1)) {}
+
+        /// return true if the write has completed, without blocking.
+        bool complete() const { return latch->is_ready(); }
+
+        /// block until the write has completed, returning true if the file was successfully written.
+        bool wait()
+        {
+            latch->wait();
+            return fileWritten;
+        }
+
+        ref_ptr<Latch> latch;
+        std::atomic_bool fileWritten{false};
+    };
+    VSG_type_name(vsg::AsyncWrite);
+
+    /** write an object to file asynchronously so that saving never blocks the caller's frame loop.
+     *  Objects classified as dynamic, via the Options::findDynamicObjects/propagateDynamicObjects visitors when assigned,
+     *  are cloned up front with copy-on-write Data so the caller can continue updating the scene graph while
+     *  serialization proceeds on Options::operationThreads. When no operationThreads are assigned the write is
+     *  carried out synchronously before returning, with the returned AsyncWrite already signalled complete.*/
+    extern VSG_DECLSPEC ref_ptr<AsyncWrite> writeAsync(ref_ptr<Object> object, const Path& filename, ref_ptr<const Options> options = {});
+
 } // namespace vsg
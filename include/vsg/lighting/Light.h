@@ -12,6 +12,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/Data.h>
 #include <vsg/lighting/ShadowSettings.h>
 #include <vsg/maths/common.h>
 #include <vsg/nodes/Node.h>
@@ -33,6 +34,13 @@ namespace vsg
         float intensity = 1.0f;
         ref_ptr<ShadowSettings> shadowSettings;
 
+        /// increment the modifiedCount to signal that the light's settings, or those of its
+        /// assigned shadowSettings, have been modified. Used by ViewDependentState to detect
+        /// when cached light data and shadow cascade computations need to be refreshed.
+        void dirty() { ++modifiedCount; }
+
+        ModifiedCount modifiedCount;
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return Light::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -0,0 +1,48 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/lighting/ShadowSettings.h>
+
+namespace vsg
+{
+
+    /// RayTracedShadows selects the ray traced shadow/ambient occlusion backend for a light in place of
+    /// shadow map rasterization. Lights with these settings contribute no shadow map passes, their
+    /// shadowing is supplied by the screen space mask written by ViewDependentState::rayShadowCommands,
+    /// so many shadow casting lights can share a single ray pass per frame.
+    class VSG_DECLSPEC RayTracedShadows : public Inherit<ShadowSettings, RayTracedShadows>
+    {
+    public:
+        RayTracedShadows();
+        RayTracedShadows(const RayTracedShadows& rhs, const CopyOp& copyop = {});
+
+        /// number of shadow rays cast per pixel per light, higher values soften penumbras
+        uint32_t raysPerPixel = 1;
+
+        /// also trace ambient occlusion rays into the mask's second channel
+        bool ambientOcclusion = false;
+
+        /// world space radius of the ambient occlusion rays
+        float ambientOcclusionRadius = 1.0f;
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return RayTracedShadows::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+    };
+    VSG_type_name(vsg::RayTracedShadows);
+
+} // namespace vsg
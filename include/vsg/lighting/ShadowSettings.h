@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Inherit.h>
+#include <vsg/core/Mask.h>
 
 namespace vsg
 {
@@ -25,6 +26,22 @@ namespace vsg
 
         uint32_t shadowMapCount = 1;
 
+        /// opt-in caching of this light's shadow maps - when enabled the depth maps are kept across frames
+        /// and only re-rendered when the shadow map projection changes or the scene contains dynamic casters,
+        /// with re-renders of stale maps rationed by ViewDependentState::maxCachedShadowMapUpdatesPerFrame.
+        bool cacheShadowMaps = false;
+
+        /// traversal mask assigned to this light's shadow map views, controlling which parts of the scene cast shadows
+        Mask castShadowMask = 0x1;
+
+        /// scale factor applied to LOD cutoff distances while rendering this light's shadow maps,
+        /// values greater than 1.0 select coarser LOD children than the main view
+        double lodScale = 1.0;
+
+        /// when greater than zero, skip casters whose bounding sphere projects to fewer pixels than this
+        /// in the shadow map, avoiding rasterizing sub pixel geometry into the depth maps
+        double minimumShadowCasterSizeInPixels = 0.0;
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return ShadowSettings::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -16,6 +16,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/maths/vec3.h>
 #include <vsg/maths/vec4.h>
 
+#if defined(__AVX__)
+#    include <immintrin.h>
+#elif defined(__SSE2__)
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#endif
+
 namespace vsg
 {
 
@@ -182,6 +190,106 @@ namespace vsg
                          lhs[0][3] * rhs[0] + lhs[1][3] * rhs[1] + lhs[2][3] * rhs[2] + lhs[3][3] * rhs[3]);
     }
 
+#if defined(__AVX__) || defined(__SSE2__)
+    /// SSE specialization of float matrix multiplication, selected at compile time when the compiler flags enable SSE2 or above.
+    inline mat4 operator*(const mat4& lhs, const mat4& rhs)
+    {
+        const __m128 c0 = _mm_loadu_ps(lhs.value[0].data());
+        const __m128 c1 = _mm_loadu_ps(lhs.value[1].data());
+        const __m128 c2 = _mm_loadu_ps(lhs.value[2].data());
+        const __m128 c3 = _mm_loadu_ps(lhs.value[3].data());
+
+        mat4 result;
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            __m128 col = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(rhs[c][0])),
+                                               _mm_mul_ps(c1, _mm_set1_ps(rhs[c][1]))),
+                                    _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(rhs[c][2])),
+                                               _mm_mul_ps(c3, _mm_set1_ps(rhs[c][3]))));
+            _mm_storeu_ps(result.value[c].data(), col);
+        }
+        return result;
+    }
+
+    /// SSE specialization of float matrix * vec4 transform.
+    inline vec4 operator*(const mat4& lhs, const vec4& rhs)
+    {
+        __m128 v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(lhs.value[0].data()), _mm_set1_ps(rhs[0])),
+                                         _mm_mul_ps(_mm_loadu_ps(lhs.value[1].data()), _mm_set1_ps(rhs[1]))),
+                              _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(lhs.value[2].data()), _mm_set1_ps(rhs[2])),
+                                         _mm_mul_ps(_mm_loadu_ps(lhs.value[3].data()), _mm_set1_ps(rhs[3]))));
+        vec4 result;
+        _mm_storeu_ps(result.data(), v);
+        return result;
+    }
+#elif defined(__ARM_NEON)
+    /// NEON specialization of float matrix multiplication, selected at compile time when the compiler flags enable NEON.
+    inline mat4 operator*(const mat4& lhs, const mat4& rhs)
+    {
+        const float32x4_t c0 = vld1q_f32(lhs.value[0].data());
+        const float32x4_t c1 = vld1q_f32(lhs.value[1].data());
+        const float32x4_t c2 = vld1q_f32(lhs.value[2].data());
+        const float32x4_t c3 = vld1q_f32(lhs.value[3].data());
+
+        mat4 result;
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            float32x4_t col = vmulq_n_f32(c0, rhs[c][0]);
+            col = vmlaq_n_f32(col, c1, rhs[c][1]);
+            col = vmlaq_n_f32(col, c2, rhs[c][2]);
+            col = vmlaq_n_f32(col, c3, rhs[c][3]);
+            vst1q_f32(result.value[c].data(), col);
+        }
+        return result;
+    }
+
+    /// NEON specialization of float matrix * vec4 transform.
+    inline vec4 operator*(const mat4& lhs, const vec4& rhs)
+    {
+        float32x4_t v = vmulq_n_f32(vld1q_f32(lhs.value[0].data()), rhs[0]);
+        v = vmlaq_n_f32(v, vld1q_f32(lhs.value[1].data()), rhs[1]);
+        v = vmlaq_n_f32(v, vld1q_f32(lhs.value[2].data()), rhs[2]);
+        v = vmlaq_n_f32(v, vld1q_f32(lhs.value[3].data()), rhs[3]);
+        vec4 result;
+        vst1q_f32(result.data(), v);
+        return result;
+    }
+#endif
+
+#if defined(__AVX__)
+    /// AVX specialization of double matrix multiplication, selected at compile time when the compiler flags enable AVX.
+    inline dmat4 operator*(const dmat4& lhs, const dmat4& rhs)
+    {
+        const __m256d c0 = _mm256_loadu_pd(lhs.value[0].data());
+        const __m256d c1 = _mm256_loadu_pd(lhs.value[1].data());
+        const __m256d c2 = _mm256_loadu_pd(lhs.value[2].data());
+        const __m256d c3 = _mm256_loadu_pd(lhs.value[3].data());
+
+        dmat4 result;
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            __m256d col = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(c0, _mm256_set1_pd(rhs[c][0])),
+                                                      _mm256_mul_pd(c1, _mm256_set1_pd(rhs[c][1]))),
+                                        _mm256_add_pd(_mm256_mul_pd(c2, _mm256_set1_pd(rhs[c][2])),
+                                                      _mm256_mul_pd(c3, _mm256_set1_pd(rhs[c][3]))));
+            _mm256_storeu_pd(result.value[c].data(), col);
+        }
+        return result;
+    }
+
+    /// AVX specialization of double matrix * vec4 transform.
+    inline dvec4 operator*(const dmat4& lhs, const dvec4& rhs)
+    {
+        __m256d v = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(lhs.value[0].data()), _mm256_set1_pd(rhs[0])),
+                                                _mm256_mul_pd(_mm256_loadu_pd(lhs.value[1].data()), _mm256_set1_pd(rhs[1]))),
+                                  _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(lhs.value[2].data()), _mm256_set1_pd(rhs[2])),
+                                                _mm256_mul_pd(_mm256_loadu_pd(lhs.value[3].data()), _mm256_set1_pd(rhs[3]))));
+        dvec4 result;
+        _mm256_storeu_pd(result.data(), v);
+        return result;
+    }
+#endif
+
     /* Right multiplication of a matrix and a plane. This can't be used directly to transform a
        plane from one coordinate system to another using the coordinate system's matrix; the inverse
        transpose of the matrix should be used. */
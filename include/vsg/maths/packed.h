@@ -0,0 +1,47 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/clamp.h>
+#include <vsg/maths/vec4.h>
+
+namespace vsg
+{
+
+    /// convert a float to an IEEE 754 half float bit pattern, rounding to nearest even,
+    /// for packing vertex attributes into VK_FORMAT_R16*_SFLOAT arrays
+    extern VSG_DECLSPEC uint16_t floatToHalf(float value);
+
+    /// convert an IEEE 754 half float bit pattern back to a float
+    extern VSG_DECLSPEC float halfToFloat(uint16_t value);
+
+    /// pack a [0, 1] float into a 16 bit unsigned normalized value for VK_FORMAT_R16*_UNORM arrays
+    inline uint16_t packUnorm16(float value)
+    {
+        return static_cast<uint16_t>(clamp(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+    }
+
+    /// unpack a 16 bit unsigned normalized value back to a [0, 1] float
+    inline float unpackUnorm16(uint16_t value)
+    {
+        return static_cast<float>(value) / 65535.0f;
+    }
+
+    /// pack a [-1, 1] vec4 into a VK_FORMAT_A2B10G10R10_SNORM_PACK32 value,
+    /// 10 bits per xyz component and 2 bits for w, suited to normals and tangents
+    extern VSG_DECLSPEC uint32_t packSnorm_A2B10G10R10(const vec4& value);
+
+    /// unpack a VK_FORMAT_A2B10G10R10_SNORM_PACK32 value back to a [-1, 1] vec4
+    extern VSG_DECLSPEC vec4 unpackSnorm_A2B10G10R10(uint32_t value);
+
+} // namespace vsg
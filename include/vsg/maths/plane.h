@@ -168,6 +168,15 @@ namespace vsg
     {
         return intersect(polytope.begin(), polytope.end(), s);
     }
+
+    /** test an array of float bounding spheres against the convex polytope defined by the planes [planes, planes + numPlanes),
+        with normals pointing inwards, writing 1 to results[i] when spheres[i] wholly or partially intersects the polytope and 0 when wholly outside.
+        Batch equivalent of intersect(first, last, sphere) that uses SIMD batches when enabled in the compiler flags,
+        for culling, intersection and shadow caster gathering workloads. */
+    extern VSG_DECLSPEC void intersect(const plane* planes, std::size_t numPlanes, const sphere* spheres, uint8_t* results, std::size_t count);
+
+    /** test an array of double bounding spheres against the convex polytope defined by the planes [planes, planes + numPlanes). */
+    extern VSG_DECLSPEC void intersect(const dplane* planes, std::size_t numPlanes, const dsphere* spheres, uint8_t* results, std::size_t count);
 } // namespace vsg
 
 #if defined(__clang__)
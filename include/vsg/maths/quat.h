@@ -297,6 +297,22 @@ namespace vsg
         }
     }
 
+    /// batch normalized linear interpolation (nlerp) across contiguous quaternion arrays, with the
+    /// hemisphere corrected so each pair interpolates along the shorter arc and the result renormalized.
+    /// Vectorized with SSE/NEON when the compiler flags enable them, intended for animation paths that
+    /// blend whole joint palettes per frame rather than calling mix() per joint.
+    extern VSG_DECLSPEC void nlerp(size_t count, const quat* from, const quat* to, const float* r, quat* result);
+
+    /// batch nlerp with a single interpolation ratio shared across the whole array
+    extern VSG_DECLSPEC void nlerp(size_t count, const quat* from, const quat* to, float r, quat* result);
+
+    /// batch spherical linear interpolation matching mix(), falling back to linear interpolation for
+    /// nearly parallel pairs. nlerp() is cheaper and visually equivalent for closely spaced keyframes.
+    extern VSG_DECLSPEC void slerp(size_t count, const quat* from, const quat* to, const float* r, quat* result);
+
+    /// batch slerp with a single interpolation ratio shared across the whole array
+    extern VSG_DECLSPEC void slerp(size_t count, const quat* from, const quat* to, float r, quat* result);
+
 } // namespace vsg
 
 #if defined(__clang__)
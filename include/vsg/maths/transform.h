@@ -235,6 +235,19 @@ namespace vsg
     /// compute the bounding sphere that encloses a frustum defined by specified double ModelViewMatrixProjection
     extern VSG_DECLSPEC dsphere computeFrustumBound(const dmat4& m);
 
+    /// transform an array of float vec3 by the matrix, batch equivalent of operator*(const mat4&, const vec3&) for skinning and intersection workloads.
+    /// src and dst may point to the same array, uses SIMD instructions when enabled in the compiler flags.
+    extern VSG_DECLSPEC void transform(const mat4& matrix, const vec3* src, vec3* dst, size_t count);
+
+    /// transform an array of double vec3 by the matrix, batch equivalent of operator*(const dmat4&, const dvec3&).
+    extern VSG_DECLSPEC void transform(const dmat4& matrix, const dvec3* src, dvec3* dst, size_t count);
+
+    /// transform an array of float vec4 by the matrix, batch equivalent of operator*(const mat4&, const vec4&).
+    extern VSG_DECLSPEC void transform(const mat4& matrix, const vec4* src, vec4* dst, size_t count);
+
+    /// transform an array of double vec4 by the matrix, batch equivalent of operator*(const dmat4&, const dvec4&).
+    extern VSG_DECLSPEC void transform(const dmat4& matrix, const dvec4* src, dvec4* dst, size_t count);
+
     /// visitor that computes a transform matrix, accumulating the result in order of objects visited
     /// usage:  auto matrix = vsg::visit<vsg::ComputeTransform>(nodePath).matrix;
     struct VSG_DECLSPEC ComputeTransform : public ConstVisitor
@@ -0,0 +1,63 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Commands.h>
+#include <vsg/meshshaders/DrawMeshTasks.h>
+#include <vsg/meshshaders/Meshlets.h>
+#include <vsg/state/PipelineLayout.h>
+
+namespace vsg
+{
+
+    /// MeshletDraw renders meshlet clusters built by vsg::buildMeshlets() through the mesh shading
+    /// pipeline, binding the cluster data as storage buffers and recording a DrawMeshTasks covering all
+    /// clusters. Per cluster culling is done on the GPU by the application's task shader using the
+    /// bounding sphere and normal cone in each Meshlet entry, giving cluster granularity frustum and
+    /// backface culling that the CPU scene graph cannot provide for massive meshes.
+    ///
+    /// The task/mesh shaders bound by the accompanying BindGraphicsPipeline are expected to read the
+    /// cluster data from storage buffers in descriptor set = firstSet:
+    ///     binding 0 - Meshlet entries (two vec4s followed by four uints per cluster)
+    ///     binding 1 - meshlet vertex indices (uint per entry)
+    ///     binding 2 - meshlet triangle indices (uint per triangle, cluster local indices packed as i0 | i1<<8 | i2<<16)
+    ///     binding 3 - vertex positions, tightly packed 3 floats per vertex
+    /// Each task shader workgroup tests taskWorkgroupSize clusters and emits mesh workgroups for the
+    /// visible ones. Assign meshletData and pipelineLayout then call setup() before compile.
+    class VSG_DECLSPEC MeshletDraw : public Inherit<Commands, MeshletDraw>
+    {
+    public:
+        MeshletDraw();
+
+        /// cluster data built by vsg::buildMeshlets()
+        ref_ptr<MeshletData> meshletData;
+
+        /// layout shared with the mesh shading GraphicsPipeline, setLayouts[firstSet] provides the
+        /// DescriptorSetLayout for the cluster data bindings
+        ref_ptr<PipelineLayout> pipelineLayout;
+
+        /// descriptor set index to bind the cluster data to
+        uint32_t firstSet = 0;
+
+        /// number of clusters tested per task shader workgroup, must match the task shader's local size
+        uint32_t taskWorkgroupSize = 32;
+
+        /// create the descriptor set and child commands, returns false if the inputs are incomplete
+        bool setup();
+
+    protected:
+        virtual ~MeshletDraw();
+    };
+    VSG_type_name(vsg::MeshletDraw);
+
+} // namespace vsg
@@ -0,0 +1,69 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+
+namespace vsg
+{
+
+    /// Meshlet describes one cluster of triangles, laid out for direct use as a std430 storage buffer
+    /// entry by task/mesh shaders.
+    struct Meshlet
+    {
+        vec4 boundingSphere;      // xyz = center, w = radius, in model coordinates
+        vec4 coneAxisCutoff;      // xyz = normalized cone axis, w = cutoff for backface culling, 1.0 when the cluster cannot be cone culled
+        uint32_t vertexOffset = 0;   // first entry in MeshletData::meshletVertexIndices
+        uint32_t vertexCount = 0;    // number of vertices referenced by the cluster
+        uint32_t triangleOffset = 0; // first entry in MeshletData::meshletTriangleIndices
+        uint32_t triangleCount = 0;  // number of triangles in the cluster
+    };
+    VSG_array(MeshletArray, Meshlet);
+
+    /// MeshletData holds the meshlet clusters built from indexed triangle geometry by buildMeshlets(),
+    /// ready for binding as storage buffers consumed by task/mesh shaders, see MeshletDraw.
+    class VSG_DECLSPEC MeshletData : public Inherit<Object, MeshletData>
+    {
+    public:
+        MeshletData();
+
+        /// per cluster bounds, cone and index ranges
+        ref_ptr<MeshletArray> meshlets;
+
+        /// indices into positions, meshlet by meshlet, addressed via Meshlet::vertexOffset
+        ref_ptr<uintArray> meshletVertexIndices;
+
+        /// per triangle cluster local vertex indices, one triangle per uint packed as
+        /// (i0 | i1 << 8 | i2 << 16), addressed via Meshlet::triangleOffset
+        ref_ptr<uintArray> meshletTriangleIndices;
+
+        /// source vertex positions, tightly packed 3 floats per vertex
+        ref_ptr<vec3Array> positions;
+
+        uint32_t numMeshlets() const { return meshlets ? static_cast<uint32_t>(meshlets->valueCount()) : 0; }
+    };
+    VSG_type_name(vsg::MeshletData);
+
+    /// build meshlet clusters from indexed triangle geometry, greedily packing triangles until the
+    /// vertex or triangle limits are reached and computing a bounding sphere and normal cone per cluster.
+    /// The defaults match common task/mesh shader workgroup limits. The cone cutoff supports conservative
+    /// backface culling in the task shader - a cluster is invisible when
+    /// dot(normalize(center - eye), coneAxis) * distance(center, eye) >= cutoff * distance(center, eye) + radius.
+    /// indices may be a ushortArray or uintArray. Returns empty ref_ptr when inputs are incomplete.
+    extern VSG_DECLSPEC ref_ptr<MeshletData> buildMeshlets(ref_ptr<vec3Array> positions, ref_ptr<Data> indices, uint32_t maxVertices = 64, uint32_t maxTriangles = 124);
+
+    /// build meshlet clusters from a VertexIndexDraw, taking arrays[0] as the vertex positions
+    extern VSG_DECLSPEC ref_ptr<MeshletData> buildMeshlets(const VertexIndexDraw& vid, uint32_t maxVertices = 64, uint32_t maxTriangles = 124);
+
+} // namespace vsg
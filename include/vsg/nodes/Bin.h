@@ -27,7 +27,10 @@ namespace vsg
         {
             NO_SORT,
             ASCENDING,
-            DESCENDING
+            DESCENDING,
+            ASCENDING_RADIX,
+            DESCENDING_RADIX,
+            STATE_SORT /// group elements that share the same state commands together to minimize redundant pipeline and descriptor set binds, for use with opaque geometry bins
         };
 
         Bin();
@@ -68,6 +71,13 @@ namespace vsg
 
         using KeyIndex = std::pair<float, uint32_t>;
         mutable std::vector<KeyIndex> _binElements;
+
+        /// linear time sort of _binElements on quantized depth keys, used by the ASCENDING_RADIX/DESCENDING_RADIX sort orders
+        void _radixSort(bool descending) const;
+
+        // persistent scratch buffers for _radixSort(), retained across frames to avoid per frame allocation
+        mutable std::vector<uint64_t> _radixPacked;
+        mutable std::vector<uint64_t> _radixScratch;
     };
     VSG_type_name(vsg::Bin);
 
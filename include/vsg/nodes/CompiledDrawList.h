@@ -0,0 +1,77 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Command.h>
+#include <vsg/nodes/Transform.h>
+#include <vsg/state/StateCommand.h>
+
+namespace vsg
+{
+
+    /// CompiledDrawList flattens a mostly static subgraph into a contiguous array of
+    /// {state change, transform, draw} records that RecordTraversal can replay linearly,
+    /// avoiding the per node virtual dispatch and pointer chasing of a full traversal.
+    /// Node types that require per frame evaluation, such as LOD, Switch, CullNode and lights,
+    /// are retained as normal traversal entries so behavior is preserved.
+    /// Call compile() after assigning or modifying the subgraph.
+    class VSG_DECLSPEC CompiledDrawList : public Inherit<Node, CompiledDrawList>
+    {
+    public:
+        CompiledDrawList();
+        explicit CompiledDrawList(ref_ptr<Node> in_subgraph);
+
+        /// the source subgraph the draw list is compiled from
+        ref_ptr<Node> subgraph;
+
+        enum OpType : uint8_t
+        {
+            PUSH_STATE,
+            POP_STATE,
+            PUSH_TRANSFORM,
+            POP_TRANSFORM,
+            RECORD_COMMAND,
+            ACCEPT_NODE
+        };
+
+        struct Entry
+        {
+            OpType op;
+            uint32_t index;
+        };
+
+        /// flattened record of the subgraph, replayed linearly by RecordTraversal::apply(const CompiledDrawList&)
+        std::vector<Entry> entries;
+        std::vector<ref_ptr<const StateCommand>> stateCommands;
+        std::vector<ref_ptr<const Transform>> transforms;
+        std::vector<ref_ptr<const Command>> commands;
+        std::vector<ref_ptr<const Node>> nodes;
+
+        /// (re)build the flattened entries from the subgraph
+        void compile();
+
+        void traverse(Visitor& visitor) override
+        {
+            if (subgraph) subgraph->accept(visitor);
+        }
+        void traverse(ConstVisitor& visitor) const override
+        {
+            if (subgraph) subgraph->accept(visitor);
+        }
+
+    protected:
+        virtual ~CompiledDrawList();
+    };
+    VSG_type_name(vsg::CompiledDrawList);
+
+} // namespace vsg
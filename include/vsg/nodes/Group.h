@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Allocator.h>
+#include <vsg/core/small_vector.h>
 #include <vsg/nodes/Node.h>
 
 #include <vector>
@@ -33,7 +34,9 @@ namespace vsg
             for (Iterator itr = begin; itr != end; ++itr) addChild(*itr);
         }
 
-        using Children = std::vector<ref_ptr<Node>, allocator_affinity_nodes<ref_ptr<Node>>>;
+        /// children are stored with inline capacity for the first 4 entries so that small groups,
+        /// which dominate deep scene graphs, keep parent and children within the same cache lines.
+        using Children = small_vector<ref_ptr<Node>, 4, allocator_affinity_nodes<ref_ptr<Node>>>;
         Children children;
 
         void addChild(vsg::ref_ptr<Node> child)
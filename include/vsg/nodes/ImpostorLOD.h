@@ -0,0 +1,66 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Node.h>
+
+namespace vsg
+{
+
+    /** Impostor Level of Detail Node,
+     *  Traverses the full detail child while the bounding sphere occupies more than minimumScreenHeightRatio of the screen height,
+     *  and swaps to the impostor subgraph, typically a camera facing quad textured with a baked rendering of the child, beyond that.
+     *  While the impostor is still null, such as before an asynchronous bake with vsg::ImpostorBaker has completed, the child is
+     *  traversed at all distances. During the record traversals the bound sphere is also checked against the view frustum so
+     *  ImpostorLOD also enables view frustum culling for subgraphs without the need for a separate CullNode/CullGroup to decorate it. */
+    class VSG_DECLSPEC ImpostorLOD : public Inherit<Node, ImpostorLOD>
+    {
+    public:
+        ImpostorLOD();
+        ImpostorLOD(const ImpostorLOD& rhs, const CopyOp& copyop = {});
+
+        dsphere bound;
+
+        /// minimum ratio of screen height the bound needs to occupy for the full detail child to be traversed, below this the impostor is used.
+        double minimumScreenHeightRatio = 0.0;
+
+        /// full detail subgraph.
+        ref_ptr<Node> child;
+
+        /// impostor subgraph traversed in place of the child at far range, typically created by vsg::ImpostorBaker.
+        ref_ptr<Node> impostor;
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return ImpostorLOD::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        template<class N, class V>
+        static void t_traverse(N& node, V& visitor)
+        {
+            if (node.child) node.child->accept(visitor);
+            if (node.impostor) node.impostor->accept(visitor);
+        }
+
+        void traverse(Visitor& visitor) override { t_traverse(*this, visitor); }
+        void traverse(ConstVisitor& visitor) const override { t_traverse(*this, visitor); }
+        void traverse(RecordTraversal& visitor) const override { t_traverse(*this, visitor); }
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~ImpostorLOD();
+    };
+    VSG_type_name(vsg::ImpostorLOD);
+
+} // namespace vsg
@@ -0,0 +1,99 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Commands.h>
+#include <vsg/commands/DrawIndirectCommand.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/state/ShaderStage.h>
+
+namespace vsg
+{
+
+    /// IndirectDrawCollection packs the vertex arrays, indices and draw parameters of many VertexIndexDraw
+    /// geometries that share a graphics pipeline into shared buffers plus a VkDrawIndexedIndirectCommand
+    /// buffer, so the whole collection is recorded with a single vkCmdDrawIndexedIndirect call.
+    ///
+    /// An optional GPU frustum culling pass is available by assigning a compute ShaderStage to
+    /// cullShaderStage and recording the Commands returned by createCullCommands() before the render pass,
+    /// such as by adding them to the CommandGraph ahead of the RenderGraph. The compute shader reads the
+    /// packed commands and per draw bounding spheres and writes the command buffer consumed by the draw,
+    /// zeroing the instanceCount of draws outside the frustum:
+    ///     set 0, binding 0 : uniform vec4[7] - six frustum planes (xyz normal, w distance, positive half
+    ///                        space visible) followed by (drawCount, 0, 0, 0), updated via setFrustum()
+    ///     set 0, binding 1 : readonly storage buffer of the source VkDrawIndexedIndirectCommands
+    ///     set 0, binding 2 : readonly storage buffer of vec4 bounding spheres (xyz center, w radius,
+    ///                        radius < 0 marks a draw that is always visible), in the coordinate frame
+    ///                        the collection is recorded in
+    ///     set 0, binding 3 : writeonly storage buffer of the culled VkDrawIndexedIndirectCommands
+    class VSG_DECLSPEC IndirectDrawCollection : public Inherit<Command, IndirectDrawCollection>
+    {
+    public:
+        IndirectDrawCollection();
+        explicit IndirectDrawCollection(const std::vector<ref_ptr<VertexIndexDraw>>& draws);
+
+        /// pack the draws' arrays, indices and draw parameters into the shared arrays, indices and commands.
+        /// All draws must have the same number of arrays with matching value sizes and matching index types.
+        /// Returns false, leaving the collection empty, when the layouts are not compatible.
+        bool assign(const std::vector<ref_ptr<VertexIndexDraw>>& draws);
+
+        uint32_t firstBinding = 0;
+        BufferInfoList arrays;
+        ref_ptr<BufferInfo> indices;
+
+        /// packed draw parameters, one entry per assigned VertexIndexDraw
+        ref_ptr<DrawIndexedIndirectCommandArray> commands;
+
+        /// bounding sphere per draw, computed by assign() from each draw's first array when it is a vec3Array
+        ref_ptr<vec4Array> bounds;
+
+        uint32_t drawCount = 0;
+
+        /// optional compute shader implementing the culling interface described above, assign before compile()
+        ref_ptr<ShaderStage> cullShaderStage;
+
+        /// local_size_x of cullShaderStage, used to size the cull dispatch
+        uint32_t workgroupSize = 64;
+
+        /// frustum planes and draw count uniform used by the cull pass, update each frame via setFrustum()
+        ref_ptr<vec4Array> cullParams;
+
+        /// create, or return the previously created, compute cull pass for the collection.
+        /// Requires cullShaderStage and an assigned set of draws, returns empty ref_ptr otherwise.
+        ref_ptr<Commands> createCullCommands();
+
+        /// update cullParams' frustum planes from the combined projection * view matrix of the camera
+        /// the collection is rendered with
+        void setFrustum(const dmat4& projectionViewMatrix);
+
+        void compile(Context& context) override;
+        void record(CommandBuffer& commandBuffer) const override;
+
+    protected:
+        virtual ~IndirectDrawCollection();
+
+        void _createCullResources();
+
+        vk_buffer<VulkanArrayData> _vulkanData;
+        VkIndexType indexType = VK_INDEX_TYPE_UINT16;
+
+        // source commands uploaded to the GPU, and when culling is enabled the GPU only buffer the cull
+        // pass compacts them into and the draw consumes
+        ref_ptr<BufferInfo> _sourceCommands;
+        ref_ptr<BufferInfo> _culledCommands;
+        ref_ptr<BufferInfo> _boundsInfo;
+        ref_ptr<Commands> _cullCommands;
+    };
+    VSG_type_name(vsg::IndirectDrawCollection);
+
+} // namespace vsg
@@ -18,6 +18,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 
 namespace vsg
 {
@@ -65,6 +66,10 @@ namespace vsg
         void read(Input& input) override;
         void write(Output& output) const override;
 
+    public:
+        // child index selected in the previous record traversal, maintained by the LODPolicy assigned to RecordTraversal::lodPolicy, -1 when no child was selected.
+        mutable std::atomic<int32_t> lastSelectedChild{-1};
+
     protected:
         virtual ~LOD();
     };
@@ -0,0 +1,42 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/PagedLOD.h>
+
+namespace vsg
+{
+
+    /// LazyLoadNode is a proxy node that defers loading its subgraph until it is first traversed.
+    /// Assign the filename of the payload - typically a key in an Archive's table of contents, with the
+    /// Archive added to Options::readerWriters - along with the bounding sphere that stands in for the
+    /// subgraph, and the record traversal will request the load through the DatabasePager the first time
+    /// the bound passes view frustum culling. A session then only pays the read and compile cost of the
+    /// parts of the scene it actually visits, with the pager expiring subgraphs that fall out of use.
+    /// Implemented as a PagedLOD whose single external child has no minimum screen height ratio, so the
+    /// payload is requested whenever the proxy is visible rather than at a particular level of detail.
+    class VSG_DECLSPEC LazyLoadNode : public Inherit<PagedLOD, LazyLoadNode>
+    {
+    public:
+        LazyLoadNode();
+        LazyLoadNode(const LazyLoadNode& rhs, const CopyOp& copyop = {});
+        LazyLoadNode(const Path& in_filename, const dsphere& in_bound, ref_ptr<Options> in_options = {});
+
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return LazyLoadNode::create(*this, copyop); }
+
+    protected:
+        virtual ~LazyLoadNode();
+    };
+    VSG_type_name(vsg::LazyLoadNode);
+
+} // namespace vsg
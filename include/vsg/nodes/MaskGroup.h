@@ -0,0 +1,59 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Group.h>
+
+namespace vsg
+{
+
+    /// MaskGroup is a Group with a mask that gates traversal of the whole subgraph in a single test.
+    /// The mask can be set directly, or baked to the union of the masks reachable in the subgraph with
+    /// ComputeAggregateMasks so traversals whose traversalMask matches nothing beneath the group skip
+    /// the branch in O(1). The mask is a cache - re-run ComputeAggregateMasks after modifying the
+    /// subgraph, in the same way bounds and compile state are refreshed after modification.
+    class VSG_DECLSPEC MaskGroup : public Inherit<Group, MaskGroup>
+    {
+    public:
+        MaskGroup();
+        MaskGroup(const MaskGroup& rhs, const CopyOp& copyop = {});
+        explicit MaskGroup(size_t numChildren);
+
+        Mask mask = MASK_ALL;
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return MaskGroup::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void traverse(Visitor& visitor) override
+        {
+            if ((visitor.traversalMask & (visitor.overrideMask | mask)) != MASK_OFF) Group::traverse(visitor);
+        }
+        void traverse(ConstVisitor& visitor) const override
+        {
+            if ((visitor.traversalMask & (visitor.overrideMask | mask)) != MASK_OFF) Group::traverse(visitor);
+        }
+        void traverse(RecordTraversal& visitor) const override
+        {
+            if ((visitor.traversalMask & (visitor.overrideMask | mask)) != MASK_OFF) Group::traverse(visitor);
+        }
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~MaskGroup();
+    };
+    VSG_type_name(vsg::MaskGroup);
+
+} // namespace vsg
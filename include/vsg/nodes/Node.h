@@ -28,9 +28,12 @@ namespace vsg
 
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return Node::create(*this, copyop); }
 
-        /// provide new and delete to enable custom memory management via the vsg::Allocator singleton, using the MEMORY_NODES_OBJECTS
+        /// provide new and delete to enable custom memory management via the vsg::Allocator singleton, using the MEMORY_NODES_OBJECTS.
+        /// when the vsg::ObjectPool singleton is enabled storage is recycled through its size keyed freelists,
+        /// the sized operator delete receives the most derived size so storage is returned to the matching freelist.
         static void* operator new(std::size_t count);
         static void operator delete(void* ptr);
+        static void operator delete(void* ptr, std::size_t size);
 
     protected:
         virtual ~Node();
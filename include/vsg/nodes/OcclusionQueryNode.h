@@ -0,0 +1,77 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/CullNode.h>
+#include <vsg/state/QueryPool.h>
+
+namespace vsg
+{
+
+    /// OcclusionQueryNode extends CullNode with hardware occlusion culling on top of the view frustum test.
+    /// Each frame the subgraph is recorded inside a vkCmdBeginQuery/vkCmdEndQuery pair and the sample count
+    /// from the oldest in flight query is polled without waiting. When a completed query reports no more than
+    /// visibilityThreshold samples the subgraph is culled for culledRetestFrames frames before being recorded
+    /// again to re-test visibility, so the cost of an occluded subgraph is amortized over the retest interval.
+    /// The QueryPool is created lazily from the recording CommandBuffer's device on first use, and the per frame
+    /// bookkeeping assumes the node is recorded by a single view.
+    class VSG_DECLSPEC OcclusionQueryNode : public Inherit<CullNode, OcclusionQueryNode>
+    {
+    public:
+        OcclusionQueryNode();
+        OcclusionQueryNode(const OcclusionQueryNode& rhs, const CopyOp& copyop = {});
+        OcclusionQueryNode(const dsphere& in_bound, Node* in_child);
+
+        /// pool of queries cycled through frame by frame, sized to cover the maximum number of frames in flight.
+        /// The compile traversal grows queryCount to the Context's framesInFlight + 1 before the pool is created,
+        /// so the pool automatically tracks Viewer::framesInFlight unless a larger count is set explicitly.
+        ref_ptr<QueryPool> queryPool;
+
+        /// number of samples a query may report while the subgraph is still treated as occluded
+        uint32_t visibilityThreshold = 0;
+
+        /// number of frames an occluded subgraph is skipped before it is recorded again to re-test its visibility
+        uint32_t culledRetestFrames = 3;
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return OcclusionQueryNode::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+        /// poll the oldest in flight query and advance the per frame bookkeeping, returning true when the
+        /// subgraph should be recorded this frame. Called by RecordTraversal before recording the query.
+        bool pollQueryAndCheckVisibility() const;
+
+        /// query slot to record this frame, advancing the rotation for the next frame.
+        /// Called by RecordTraversal after pollQueryAndCheckVisibility() has returned true.
+        uint32_t nextQuery() const
+        {
+            uint32_t query = _queryIndex;
+            _queryIndex = (_queryIndex + 1) % queryPool->queryCount;
+            return query;
+        }
+
+    protected:
+        virtual ~OcclusionQueryNode();
+
+        // per frame bookkeeping updated during record
+        mutable uint32_t _queryIndex = 0;
+        mutable uint32_t _framesSinceCulled = 0;
+        mutable bool _culled = false;
+        mutable std::vector<uint32_t> _results;
+    };
+    VSG_type_name(vsg::OcclusionQueryNode);
+
+} // namespace vsg
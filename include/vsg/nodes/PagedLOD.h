@@ -87,8 +87,19 @@ namespace vsg
         mutable std::atomic<double> priority{0.0};
 
         mutable std::atomic_uint64_t frameHighResLastUsed{0};
+
+        // frame count of the last speculative prefetch of the external child, used to keep prefetch
+        // requests alive through the DatabasePager's staleness checks without affecting the
+        // frameHighResLastUsed based expiry of high res subgraphs.
+        mutable std::atomic_uint64_t framePrefetchLastUsed{0};
+
         mutable std::atomic_uint requestCount{0};
 
+        // estimated CPU + GPU memory footprint, in bytes, of the loaded high res subgraph, assigned by the
+        // DatabasePager read threads when a load completes and used by the byte budgeted expiry in
+        // DatabasePager::updateSceneGraph().
+        mutable std::atomic<std::size_t> highResBytes{0};
+
         enum RequestStatus : unsigned int
         {
             NoRequest = 0,
@@ -102,51 +113,68 @@ namespace vsg
         };
 
         mutable std::atomic<RequestStatus> requestStatus{NoRequest};
-        mutable uint32_t index = 0;
+
+        // slot map handle assigned by the PagedLODContainer, packing the slot index in the lower 32 bits and the slot's generation in the upper 32 bits, 0 when not assigned.
+        mutable uint64_t index = 0;
 
         ref_ptr<Node> pending;
     };
     VSG_type_name(vsg::PagedLOD);
 
+    /// PagedLODContainer is a slot map used by the DatabasePager to track the set of PagedLOD with loaded high res subgraphs.
+    /// Elements are stored in a contiguous array addressed by generation checked handles assigned to PagedLOD::index,
+    /// with dense arrays of the active and inactive slots so the per frame expiry scanning in
+    /// DatabasePager::updateSceneGraph() walks cache friendly linear memory rather than chasing list pointers.
     struct PagedLODContainer : public Inherit<Object, PagedLODContainer>
     {
-        PagedLODContainer(uint32_t maxNumPagedLOD = 10000);
+        explicit PagedLODContainer(uint32_t maxNumPagedLOD = 10000);
 
-        struct List
+        enum Status : uint8_t
         {
-            uint32_t head = 0;
-            uint32_t tail = 0;
-            uint32_t count = 0;
-            std::string name;
+            AVAILABLE = 0,
+            ACTIVE,
+            INACTIVE
         };
 
         struct Element
         {
-            uint32_t previous = 0;
-            uint32_t next = 0;
             ref_ptr<PagedLOD> plod;
-            List* list = nullptr;
+            std::size_t bytes = 0;   // memory footprint accounted to this slot, snapshot of PagedLOD::highResBytes
+            uint32_t generation = 0; // incremented each time the slot is released, invalidating any outstanding handles to it
+            uint32_t denseIndex = 0; // position of the slot within activeSlots/inactiveSlots
+            Status status = AVAILABLE;
         };
 
         using Elements = std::vector<Element>;
 
+        /// slot storage, elements[0] is reserved as the null slot
         Elements elements;
-        List availableList;
-        List inactiveList;
-        List activeList;
 
-        void resize(uint32_t new_size);
-        void resize();
+        /// slots available for reuse
+        std::vector<uint32_t> freeSlots;
+
+        /// dense array of the slots with active high res subgraphs
+        std::vector<uint32_t> activeSlots;
+
+        /// dense array of the slots whose high res subgraphs are no longer actively used, in approximately the order they became inactive
+        std::vector<uint32_t> inactiveSlots;
+
+        /// total bytes accounted across the active and inactive slots, maintained by active()/inactive()/remove()
+        std::size_t residentBytes = 0;
+
+        /// return the slot index associated with the plod's handle, or 0 when the handle is null or stale
+        uint32_t slot(const PagedLOD* plod) const;
+
         void inactive(const PagedLOD* plod);
         void active(const PagedLOD* plod);
         void remove(PagedLOD* plod);
 
-        void _move(const PagedLOD* plod, List* targetList);
-
-        bool check();
-        bool check(const List& list);
-
         void print(std::ostream& out);
+
+    protected:
+        uint32_t _acquireSlot(const PagedLOD* plod);
+        void _refreshBytes(Element& element);
+        void _eraseDense(std::vector<uint32_t>& denseSlots, Element& element);
     };
 
 } // namespace vsg
@@ -0,0 +1,89 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Commands.h>
+#include <vsg/commands/DrawIndirect.h>
+#include <vsg/commands/FillBuffer.h>
+#include <vsg/state/BufferInfo.h>
+#include <vsg/state/ShaderStage.h>
+
+namespace vsg
+{
+
+    /// ParticleSystem keeps the particle state entirely on the GPU: a compute dispatch advances the
+    /// particles each frame and appends the live ones to a VkDrawIndirectCommand, so the per frame
+    /// CPU and PCIe cost is independent of the particle count. The only host upload is the emitter
+    /// parameters uniform, transferred as dynamic data.
+    ///
+    /// Usage: assign maxParticles, updateShaderStage and an emitterParameters value with dynamic data
+    /// variance, call setup(), record this node in the CommandGraph before the render graphs, and add
+    /// drawIndirect under the application's particle StateGroup with the particles buffer bound as a
+    /// per instance vertex attribute or read as a storage buffer.
+    ///
+    /// The update shader is supplied by the application. Its descriptor set 0 must declare:
+    ///     binding 0 : uniform  - emitter parameters, the assigned emitterParameters value
+    ///     binding 1 : storage  - particle pool, particleStride bytes per particle
+    ///     binding 2 : storage  - VkDrawIndirectCommand, atomically increment instanceCount per live particle
+    /// Each frame instanceCount/firstVertex/firstInstance are cleared to zero and vertexCount set
+    /// before the dispatch, so the shader only accumulates instanceCount.
+    class VSG_DECLSPEC ParticleSystem : public Inherit<Commands, ParticleSystem>
+    {
+    public:
+        ParticleSystem();
+
+        /// size of the particle pool, the update shader dispatches one invocation per slot
+        uint32_t maxParticles = 1048576;
+
+        /// bytes per particle in the pool, must match the update shader's particle struct
+        uint32_t particleStride = 32;
+
+        /// number of vertices drawn per particle instance, written to the draw command each frame
+        uint32_t vertexCount = 6;
+
+        /// compute shader advancing the particles, with a descriptor set 0 matching the documented bindings
+        ref_ptr<ShaderStage> updateShaderStage;
+
+        /// local_size_x of updateShaderStage, used to size the dispatch
+        uint32_t workgroupSize = 64;
+
+        /// emitter parameters uniform updated by the application, give it dynamic data variance so the
+        /// transfer machinery uploads changes each frame
+        ref_ptr<Data> emitterParameters;
+
+        /// particle pool created by setup(), allocated device only at compile with combined
+        /// storage/vertex usage so it can be bound by the render geometry's BindVertexBuffers
+        ref_ptr<BufferInfo> particles;
+
+        /// GPU written VkDrawIndirectCommand created by setup(), allocated device only at compile
+        ref_ptr<BufferInfo> drawCommand;
+
+        /// draw sourcing its counts from drawCommand, created by setup(),
+        /// to be added under the application's particle StateGroup
+        ref_ptr<DrawIndirect> drawIndirect;
+
+        /// build the clear/bind/dispatch/barrier commands from the assigned inputs.
+        /// Requires updateShaderStage and emitterParameters, returns false when they are missing.
+        bool setup();
+
+        void compile(Context& context) override;
+
+    protected:
+        virtual ~ParticleSystem();
+
+        ref_ptr<FillBuffer> _writeVertexCount;
+        ref_ptr<FillBuffer> _clearCounts;
+    };
+    VSG_type_name(vsg::ParticleSystem);
+
+} // namespace vsg
@@ -0,0 +1,86 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/sphere.h>
+#include <vsg/nodes/Group.h>
+
+namespace vsg
+{
+
+    /** Group node that maintains a bounding volume hierarchy over its children.
+     *  Intended for flat scenes, such as CAD imports, with thousands of direct children where per child
+     *  culling and intersection otherwise degenerate to linear scans. RecordTraversal and Intersector walk
+     *  the hierarchy instead of the child list, skipping whole branches whose bounds fail the frustum or
+     *  intersection test. The hierarchy is built lazily on first traversal and after invalidate() has been
+     *  called, so callers only need to call invalidate() after modifying the children or their transforms. */
+    class VSG_DECLSPEC SpatialIndexGroup : public Inherit<Group, SpatialIndexGroup>
+    {
+    public:
+        explicit SpatialIndexGroup(size_t numChildren = 0);
+
+        SpatialIndexGroup(const SpatialIndexGroup& rhs, const CopyOp& copyop = {});
+
+        /// maximum number of children referenced by a leaf of the hierarchy
+        uint32_t maxChildrenPerLeaf = 8;
+
+        /// entry in the bounding volume hierarchy, a leaf when count is non zero
+        struct IndexNode
+        {
+            dsphere bound;
+            uint32_t left = 0;  // leaf: first entry in leafChildren(), internal node: index of the first child IndexNode
+            uint32_t right = 0; // internal node: index of the second child IndexNode
+            uint32_t count = 0; // leaf: number of leafChildren() entries, 0 for internal nodes
+        };
+
+        /// mark the index as needing rebuilding, call after adding/removing children or changing their transforms
+        void invalidate() const { _dirty = true; }
+
+        /// rebuild the bounding volume hierarchy over the current children
+        void build() const;
+
+        /// rebuild the index if it has been invalidated, called by traversals before walking the index
+        void validateIndex() const
+        {
+            if (_dirty) build();
+        }
+
+        /// hierarchy nodes, entry 0 is the root when non empty
+        const std::vector<IndexNode>& indexNodes() const { return _indexNodes; }
+
+        /// indices into children referenced by the leaf IndexNodes
+        const std::vector<uint32_t>& leafChildren() const { return _leafChildren; }
+
+        /// indices of children without a computable bound, always traversed
+        const std::vector<uint32_t>& unboundedChildren() const { return _unboundedChildren; }
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return SpatialIndexGroup::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~SpatialIndexGroup();
+
+        uint32_t _build(uint32_t first, uint32_t count, const std::vector<dsphere>& bounds) const;
+
+        mutable bool _dirty = true;
+        mutable std::vector<IndexNode> _indexNodes;
+        mutable std::vector<uint32_t> _leafChildren;
+        mutable std::vector<uint32_t> _unboundedChildren;
+    };
+    VSG_type_name(vsg::SpatialIndexGroup);
+
+} // namespace vsg
@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/ref_ptr.h>
+#include <vsg/core/small_vector.h>
 #include <vsg/nodes/Node.h>
 
 #include <vector>
@@ -33,7 +34,7 @@ namespace vsg
             ref_ptr<Node> node;
         };
 
-        using Children = std::vector<Child>;
+        using Children = small_vector<Child, 4>;
         Children children;
 
         /// add a child to the back of the children list.
@@ -51,6 +51,17 @@ namespace vsg
         /// optional shaderSet to use for setting up shaders, if left null use vsg::createTileShaderSet().
         ref_ptr<ShaderSet> shaderSet;
 
+        /// number of threads the vsg::tile ReaderWriter uses internally to fetch, decode and assemble
+        /// the subtiles of each tile concurrently, 0 runs the subtile loads serially on the pager thread.
+        /// A machine specific runtime hint, so not serialized with the rest of the database settings.
+        uint32_t concurrentLoadThreads = 4;
+
+        /// maximum number of bytes of built tile subgraphs that the vsg::tile ReaderWriter retains in
+        /// its least recently used cache, so revisiting an area reattaches recently expired tiles rather
+        /// than re-downloading and rebuilding them, 0 disables the cache. A machine specific runtime
+        /// hint, so not serialized with the rest of the database settings.
+        uint64_t tileCacheByteLimit = 0;
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return TileDatabaseSettings::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -15,6 +15,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/Window.h>
 #include <vsg/ui/KeyEvent.h>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include <xcb/xcb.h>
 
 #include <vulkan/vulkan_xcb.h>
@@ -77,6 +81,19 @@ namespace vsgXcb
 
         void _initSurface() override;
 
+        /// handle a single xcb event, appending any resulting vsg events to destination
+        void _handleXcbEvent(xcb_generic_event_t* event, vsg::UIEvents& destination);
+
+        /// optional dedicated event thread, enabled via WindowTraits::dedicatedEventThread, that
+        /// continuously drains xcb events into _eventThreadEvents for pollEvents() to splice.
+        void _startEventThread();
+        void _stopEventThread();
+
+        std::thread _eventThread;
+        std::atomic_bool _eventThreadActive{false};
+        std::mutex _eventThreadMutex;
+        vsg::UIEvents _eventThreadEvents;
+
         xcb_connection_t* _connection = nullptr;
         xcb_screen_t* _screen = nullptr;
         xcb_window_t _window{};
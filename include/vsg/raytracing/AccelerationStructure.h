@@ -21,14 +21,32 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 namespace vsg
 {
 
+    class BuildAccelerationStructureCommand;
+    class CompactAccelerationStructures;
+
     /// AccelerationStructure is a base class for top/bottom level acceleration structure classes.
     class VSG_DECLSPEC AccelerationStructure : public Inherit<Object, AccelerationStructure>
     {
     public:
         AccelerationStructure(VkAccelerationStructureTypeKHR type, Device* device);
 
+        /// when true the structure is built with VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR so
+        /// it can be refitted in place with the command returned by createUpdateCommand(). Set before compile().
+        bool allowUpdate = false;
+
+        /// when true the structure is built with VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR so
+        /// it can be copied into tightly packed storage by CompactAccelerationStructures. Set before compile().
+        bool allowCompaction = false;
+
         virtual void compile(Context& context);
 
+        /// create a command that refits the structure in place (VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR)
+        /// after the source vertex/instance buffers have changed, far cheaper than a full rebuild for
+        /// deforming geometry. Requires allowUpdate to have been set before compile(), returns empty
+        /// ref_ptr otherwise. Assign a scratch buffer of at least requiredUpdateScratchSize() with
+        /// BuildAccelerationStructureCommand::setScratchBuffer() before recording.
+        ref_ptr<BuildAccelerationStructureCommand> createUpdateCommand();
+
         operator VkAccelerationStructureKHR() const { return _accelerationStructure; }
         operator VkAccelerationStructureBuildGeometryInfoKHR() const { return _accelerationStructureBuildGeometryInfo; }
 
@@ -36,17 +54,23 @@ namespace vsg
 
         VkDeviceSize requiredScratchSize() const { return _requiredBuildScratchSize; }
 
+        VkDeviceSize requiredUpdateScratchSize() const { return _requiredUpdateScratchSize; }
+
     protected:
         virtual ~AccelerationStructure();
 
+        friend class CompactAccelerationStructures;
+
         VkAccelerationStructureKHR _accelerationStructure;
         VkAccelerationStructureCreateInfoKHR _accelerationStructureInfo;
         std::vector<uint32_t> _geometryPrimitiveCounts;
         VkAccelerationStructureBuildGeometryInfoKHR _accelerationStructureBuildGeometryInfo;
+        ref_ptr<BufferInfo> _bufferInfo;
         ref_ptr<Buffer> _buffer;
         ref_ptr<DeviceMemory> _memory;
         uint64_t _handle = 0;
         VkDeviceSize _requiredBuildScratchSize;
+        VkDeviceSize _requiredUpdateScratchSize = 0;
 
         ref_ptr<Device> _device;
     };
@@ -17,6 +17,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Object.h>
 #include <vsg/core/Visitor.h>
 
+#include <vsg/commands/Commands.h>
+
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/MatrixTransform.h>
 #include <vsg/nodes/VertexIndexDraw.h>
@@ -42,6 +44,13 @@ namespace vsg
         // the top level acceleration structure we are creating and adding geometry instances to as we find and create them
         ref_ptr<TopLevelAccelerationStructure> tlas;
 
+        /// create a Commands node that refits all the acceleration structures with allowUpdate set, bottom
+        /// level structures first then the top level structure, sharing a single pooled scratch buffer sized
+        /// to the largest requiredUpdateScratchSize(). Use together with TopLevelAccelerationStructure::updateInstances()
+        /// and updated vertex buffers to animate a compiled scene without paying full rebuild cost each frame.
+        /// The Commands node and scratch buffer are cached and reused by subsequent calls.
+        ref_ptr<Commands> createUpdateCommands();
+
     protected:
         void createGeometryInstance(BottomLevelAccelerationStructure* blas);
 
@@ -52,6 +61,10 @@ namespace vsg
         // cache blas's created for various types of draw node
         std::map<VertexIndexDraw*, ref_ptr<BottomLevelAccelerationStructure>> _vertexIndexDrawBlasMap;
         std::map<Geometry*, ref_ptr<BottomLevelAccelerationStructure>> _geometryBlasMap;
+
+        // cached refit commands and the scratch buffer shared by them
+        ref_ptr<Commands> _updateCommands;
+        ref_ptr<Buffer> _updateScratchBuffer;
     };
     VSG_type_name(vsg::BuildAccelerationStructureTraversal);
 
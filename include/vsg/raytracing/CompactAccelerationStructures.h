@@ -0,0 +1,69 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/raytracing/AccelerationStructure.h>
+#include <vsg/threading/OperationQueue.h>
+#include <vsg/vk/CommandPool.h>
+#include <vsg/vk/Fence.h>
+#include <vsg/vk/MemoryBufferPools.h>
+#include <vsg/vk/Queue.h>
+
+#include <list>
+#include <mutex>
+
+namespace vsg
+{
+
+    /// CompactAccelerationStructures copies acceleration structures built with allowCompaction set into
+    /// tightly packed storage, reclaiming the worst case sizing slack reported by
+    /// vkGetAccelerationStructureBuildSizesKHR. The compacted storage is suballocated from a
+    /// MemoryBufferPools so many structures pack into a few larger buffers/memory allocations.
+    /// Implemented as an Operation so batches can be processed on a background thread, add the
+    /// instance to OperationThreads after the builds have completed, or call run() directly.
+    /// Queue submission is mutex protected, but the caller must ensure structures aren't rebuilt or
+    /// traced while their compaction batch is in flight, and compaction changes the structure handles
+    /// so dependent top level structures must be updated/rebuilt afterwards.
+    class VSG_DECLSPEC CompactAccelerationStructures : public Inherit<Operation, CompactAccelerationStructures>
+    {
+    public:
+        CompactAccelerationStructures(Device* device, ref_ptr<Queue> in_queue);
+
+        /// queue compaction of an acceleration structure, no-op for structures that were not compiled
+        /// with allowCompaction set
+        void add(ref_ptr<AccelerationStructure> accelerationStructure);
+
+        /// true when structures are still waiting to be compacted
+        bool pending() const;
+
+        /// maximum number of structures compacted per run() so the cost can be spread across frames
+        uint32_t maxCompactionsPerRun = 16;
+
+        /// pools providing the compacted storage
+        ref_ptr<MemoryBufferPools> memoryBufferPools;
+
+        /// compact up to maxCompactionsPerRun pending structures
+        void run() override;
+
+    protected:
+        ref_ptr<Device> _device;
+        ref_ptr<Queue> _queue;
+        ref_ptr<CommandPool> _commandPool;
+        ref_ptr<Fence> _fence;
+
+        mutable std::mutex _mutex;
+        std::list<ref_ptr<AccelerationStructure>> _pending;
+    };
+    VSG_type_name(vsg::CompactAccelerationStructures);
+
+} // namespace vsg
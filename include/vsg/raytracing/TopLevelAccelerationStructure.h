@@ -87,12 +87,21 @@ namespace vsg
 
         void compile(Context& context) override;
 
+        /// re-pack the instance buffer from the geometryInstances transforms after they have changed,
+        /// covering all changed instances in a single copy. Pair with the refit command returned by
+        /// createUpdateCommand() (set allowUpdate before compile()) to update the structure without a
+        /// full rebuild. The instance count must match the compiled count, add/removal of instances
+        /// requires a fresh compile. Returns false when the structure has not yet been compiled.
+        bool updateInstances();
+
         GeometryInstances geometryInstances;
 
     protected:
         // compiled data
         ref_ptr<VkGeometryInstanceArray> _instances;
+        BufferInfoList _instanceBufferInfo;
         ref_ptr<Buffer> _instanceBuffer;
+        VkAccelerationStructureGeometryKHR _accelerationStructureGeometry;
     };
     VSG_type_name(vsg::TopLevelAccelerationStructure);
 
@@ -37,6 +37,14 @@ namespace vsg
         /// VkDescriptorSetLayoutCreateInfo settings
         DescriptorSetLayoutBindings bindings;
 
+        /// VkDescriptorSetLayoutCreateInfo.flags setting, i.e. VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR for layouts used with vsg::PushDescriptorSet
+        VkDescriptorSetLayoutCreateFlags flags = 0;
+
+        /// optional per binding VK_EXT_descriptor_indexing flags, i.e. VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT.
+        /// When non empty it must have one entry per entry in bindings, and is chained into the
+        /// VkDescriptorSetLayoutCreateInfo via VkDescriptorSetLayoutBindingFlagsCreateInfo.
+        std::vector<VkDescriptorBindingFlags> bindingFlags;
+
         /// map the descriptor bindings to the descriptor pool sizes that will be required to represent them.
         void getDescriptorPoolSizes(DescriptorPoolSizes& descriptorPoolSizes);
 
@@ -59,7 +67,7 @@ namespace vsg
 
         struct Implementation : public Inherit<Object, Implementation>
         {
-            Implementation(Device* device, const DescriptorSetLayoutBindings& descriptorSetLayoutBindings);
+            Implementation(Device* device, const DescriptorSetLayoutBindings& descriptorSetLayoutBindings, VkDescriptorSetLayoutCreateFlags descriptorSetLayoutCreateFlags = 0, const std::vector<VkDescriptorBindingFlags>& descriptorBindingFlags = {});
 
             virtual ~Implementation();
 
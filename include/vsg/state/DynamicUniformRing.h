@@ -0,0 +1,89 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/state/Buffer.h>
+#include <vsg/state/Descriptor.h>
+
+#include <atomic>
+
+namespace vsg
+{
+
+    /// DynamicUniformRing is a VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC Descriptor that suballocates
+    /// per draw uniform blocks from a single persistently mapped buffer, replacing one DescriptorBuffer
+    /// and DescriptorSet per draw with a single set bound once and a per draw dynamic offset recorded
+    /// through BindDescriptorSet::dynamicOffsets.
+    ///
+    /// The buffer is divided into framesInFlight regions that are cycled through by advanceFrame(), so
+    /// the region being written is never the one the GPU is still reading. Each frame call advanceFrame()
+    /// once before recording, then for each draw copy its uniform block in with write(..) and assign the
+    /// returned offset to the draw's BindDescriptorSet::dynamicOffsets. write(..) is safe to call
+    /// concurrently from multiple record threads.
+    class VSG_DECLSPEC DynamicUniformRing : public Inherit<Descriptor, DynamicUniformRing>
+    {
+    public:
+        explicit DynamicUniformRing(uint32_t in_dstBinding = 0, VkDeviceSize in_blockSize = 256, VkDeviceSize in_bytesPerFrame = 1048576, uint32_t in_framesInFlight = 0);
+
+        /// maximum size of a single write(..), published as the descriptor's range. Set before compilation.
+        VkDeviceSize blockSize;
+
+        /// bytes available to write(..) calls between successive advanceFrame() calls. Set before compilation.
+        VkDeviceSize bytesPerFrame;
+
+        /// number of frame regions cycled through by advanceFrame(). Leave at 0, the default, to adopt the
+        /// Context's framesInFlight during compile so the ring automatically matches Viewer::framesInFlight,
+        /// or set a non zero count before compilation to size the ring explicitly.
+        uint32_t framesInFlight;
+
+        void compile(Context& context) override;
+        void assignTo(Context& context, VkWriteDescriptorSet& wds) const override;
+
+        /// advance to the next frame's region and reset the suballocation cursor, call once per frame
+        /// before any of the frame's write(..) calls, typically at the start of the update phase.
+        void advanceFrame();
+
+        /// copy size bytes into the current frame's region of every compiled device's mapping and return
+        /// the dynamic offset to record with the associated BindDescriptorSet/BindDescriptorSets.
+        uint32_t write(const void* data, VkDeviceSize size);
+
+        template<typename T>
+        uint32_t write(const T& value) { return write(&value, sizeof(T)); }
+
+    public:
+        int compare(const Object& rhs_object) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+
+    protected:
+        virtual ~DynamicUniformRing();
+
+        struct DeviceData
+        {
+            ref_ptr<Buffer> buffer;
+            uint8_t* mapped = nullptr;
+        };
+
+        vk_buffer<DeviceData> _deviceData;
+
+        // the specification caps minUniformBufferOffsetAlignment at 256, so a fixed 256 byte alignment
+        // keeps the offsets returned by write(..) valid on every device the ring is compiled for.
+        VkDeviceSize _alignment = 256;
+        VkDeviceSize _frameOrigin = 0;
+        uint32_t _frameIndex = 0;
+        std::atomic<VkDeviceSize> _cursor{0};
+    };
+    VSG_type_name(vsg::DynamicUniformRing);
+
+} // namespace vsg
@@ -71,6 +71,14 @@ namespace vsg
         ref_ptr<PipelineLayout> layout;
         uint32_t subpass;
 
+        /// VkGraphicsPipelineCreateInfo.flags setting, i.e. VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT
+        VkPipelineCreateFlags flags = 0;
+
+        /// optional pipeline to derive from. When set the pipeline is created with VK_PIPELINE_CREATE_DERIVATIVE_BIT
+        /// and the basePipeline's VkPipeline as the basePipelineHandle, hinting to drivers that compilation work can
+        /// be reused between related pipeline variants. The basePipeline is compiled first when required.
+        ref_ptr<GraphicsPipeline> basePipeline;
+
         int compare(const Object& rhs_object) const override;
 
         void read(Input& input) override;
@@ -91,7 +99,7 @@ namespace vsg
 
         struct Implementation : public Inherit<Object, Implementation>
         {
-            Implementation(Context& context, Device* device, const RenderPass* renderPass, const PipelineLayout* pipelineLayout, const ShaderStages& shaderStages, const GraphicsPipelineStates& pipelineStates, uint32_t subpass);
+            Implementation(Context& context, Device* device, const RenderPass* renderPass, const PipelineLayout* pipelineLayout, const ShaderStages& shaderStages, const GraphicsPipelineStates& pipelineStates, uint32_t subpass, VkPipelineCreateFlags pipelineCreateFlags = 0, VkPipeline basePipelineHandle = VK_NULL_HANDLE);
 
             virtual ~Implementation();
 
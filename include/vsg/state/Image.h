@@ -48,6 +48,12 @@ namespace vsg
         std::vector<uint32_t> queueFamilyIndices;
         VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
+        /// handle types the image's memory will be exported as, i.e. VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT.
+        /// When non zero compile() chains a VkExternalMemoryImageCreateInfo into the image creation and binds the
+        /// image to a dedicated exportable DeviceMemory, whose handle DeviceMemory::getMemoryFd()/getMemoryWin32Handle()
+        /// can then pass to external consumers such as video encoders without a GPU to CPU round trip.
+        VkExternalMemoryHandleTypeFlags externalMemoryHandleTypes = 0;
+
         int compare(const Object& rhs_object) const override;
 
         DeviceMemory* getDeviceMemory(uint32_t deviceID) { return _vulkanData[deviceID].deviceMemory; }
@@ -55,8 +61,16 @@ namespace vsg
 
         VkDeviceSize getMemoryOffset(uint32_t deviceID) const { return _vulkanData[deviceID].memoryOffset; }
 
+        /// return true when flags contain VK_IMAGE_CREATE_SPARSE_BINDING_BIT, in which case compile() creates
+        /// the VkImage but leaves memory unbound - pages are bound/unbound through vkQueueBindSparse, typically
+        /// managed by a vsg::SparseImageManager, so VRAM usage stays proportional to the resident pages.
+        bool sparse() const { return (flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) != 0; }
+
         VkMemoryRequirements getMemoryRequirements(uint32_t deviceID) const;
 
+        /// return the sparse memory requirements, such as the page granularity and miptail ranges, for sparse images
+        std::vector<VkSparseImageMemoryRequirements> getSparseMemoryRequirements(uint32_t deviceID) const;
+
         VkResult allocateAndBindMemory(Device* device, VkMemoryPropertyFlags memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, void* pNextAllocInfo = nullptr);
 
         VkResult bind(DeviceMemory* deviceMemory, VkDeviceSize memoryOffset);
@@ -68,6 +68,15 @@ namespace vsg
     extern VSG_DECLSPEC ref_ptr<ImageView> createImageView(Device* device, ref_ptr<Image> image, VkImageAspectFlags aspectFlags);
 
     /// convenience function that uploads staging buffer data to device including mipmaps.
-    extern VSG_DECLSPEC void transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetImageLayout, Data::Properties properties, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, const Data::MipmapOffsets& mipmapOffsets, ref_ptr<Buffer> stagingBuffer, VkDeviceSize stagingBufferOffset, VkCommandBuffer vk_commandBuffer, vsg::Device* device);
+    /// Data with precomputed mipmaps (mipmapOffsets.size() > 1), such as BCn compressed KTX2 imagery, is copied level by level directly from the staging buffer.
+    /// Data without precomputed mipmaps has its remaining levels generated with a vkCmdBlitImage chain when the format supports blitting and allowMipmapGeneration is true.
+    /// Set allowMipmapGeneration to false when the command buffer will be submitted to a queue family without VK_QUEUE_GRAPHICS_BIT support, as vkCmdBlitImage is not supported on such queues.
+    extern VSG_DECLSPEC void transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetImageLayout, Data::Properties properties, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, const Data::MipmapOffsets& mipmapOffsets, ref_ptr<Buffer> stagingBuffer, VkDeviceSize stagingBufferOffset, VkCommandBuffer vk_commandBuffer, vsg::Device* device, bool allowMipmapGeneration = true);
+
+    /// convenience function that uploads image data directly from host memory using VK_EXT_host_image_copy, without a staging buffer, command buffer or queue submission.
+    /// Requires the device to have the extension enabled and the Image to have been created with VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT, and cannot generate mipmaps,
+    /// so Data without precomputed mipmaps must only require a single mip level. Returns false, leaving the image untouched, when any of these requirements are not met,
+    /// allowing the caller to fall back to transferImageData().
+    extern VSG_DECLSPEC bool hostTransferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetImageLayout, Data::Properties properties, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, const Data::MipmapOffsets& mipmapOffsets, const void* sourceData, vsg::Device* device);
 
 } // namespace vsg
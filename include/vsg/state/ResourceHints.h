@@ -26,6 +26,10 @@ namespace vsg
 
         bool empty() const noexcept { return maxSlot == 0 && numDescriptorSets == 0 && descriptorPoolSizes.empty(); }
 
+        /// merge the rhs hints into this one, summing the descriptor set and pool counts and taking
+        /// the maximum of the limits - used when accumulating hints captured from multiple compilations.
+        void add(const ResourceHints& rhs);
+
         uint32_t maxSlot = 0;
         uint32_t numDescriptorSets = 0;
         DescriptorPoolSizes descriptorPoolSizes;
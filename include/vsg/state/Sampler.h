@@ -12,9 +12,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/observer_ptr.h>
 #include <vsg/vk/Device.h>
 #include <vsg/vk/vk_buffer.h>
 
+#include <map>
+#include <mutex>
+
 namespace vsg
 {
     // forward declare
@@ -61,6 +65,8 @@ namespace vsg
     protected:
         virtual ~Sampler();
 
+        friend class SamplerCache;
+
         struct Implementation : public Inherit<Object, Implementation>
         {
             Implementation(Device* device, const VkSamplerCreateInfo& createSamplerInfo);
@@ -75,4 +81,51 @@ namespace vsg
     };
     VSG_type_name(vsg::Sampler)
 
+    /// SamplerCache is a device level cache, used by Sampler::compile(), that shares a single VkSampler between
+    /// all Samplers with the same VkSamplerCreateInfo settings, independent of whether the Sampler objects
+    /// themselves were deduplicated via SharedObjects. Drivers typically cap the number of unique samplers at
+    /// around 4000, which scenes assembled from many independently loaded models can otherwise exceed.
+    /// The cache holds observer pointers so it does not extend the lifetime of the shared VkSamplers.
+    class VSG_DECLSPEC SamplerCache : public Inherit<Object, SamplerCache>
+    {
+    public:
+        SamplerCache();
+
+        /// return the shared sampler implementation for the specified settings, creating it when first required. Thread safe.
+        ref_ptr<Sampler::Implementation> getOrCreate(Device* device, const VkSamplerCreateInfo& createSamplerInfo);
+
+        /// number of unique VkSamplers currently shared through the cache
+        std::size_t size() const;
+
+    protected:
+        virtual ~SamplerCache();
+
+        /// cache key covering all the VkSamplerCreateInfo settings, ordered bytewise
+        struct Key
+        {
+            VkSamplerCreateFlags flags;
+            VkFilter magFilter;
+            VkFilter minFilter;
+            VkSamplerMipmapMode mipmapMode;
+            VkSamplerAddressMode addressModeU;
+            VkSamplerAddressMode addressModeV;
+            VkSamplerAddressMode addressModeW;
+            float mipLodBias;
+            VkBool32 anisotropyEnable;
+            float maxAnisotropy;
+            VkBool32 compareEnable;
+            VkCompareOp compareOp;
+            float minLod;
+            float maxLod;
+            VkBorderColor borderColor;
+            VkBool32 unnormalizedCoordinates;
+
+            bool operator<(const Key& rhs) const;
+        };
+
+        mutable std::mutex _mutex;
+        std::map<Key, observer_ptr<Sampler::Implementation>> _samplers;
+    };
+    VSG_type_name(vsg::SamplerCache)
+
 } // namespace vsg
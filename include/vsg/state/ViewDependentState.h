@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/app/CommandGraph.h>
 #include <vsg/app/RenderGraph.h>
+#include <vsg/commands/Commands.h>
 #include <vsg/io/Logger.h>
 #include <vsg/lighting/Light.h>
 #include <vsg/nodes/Switch.h>
@@ -129,6 +130,10 @@ namespace vsg
         virtual void clear();
         virtual void bindDescriptorSets(CommandBuffer& commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet);
 
+        /// bin the point and spot lights gathered by the RecordTraversal into the froxel grid, called automatically
+        /// during the record traversal when clusteredLighting is enabled.
+        virtual void updateClusters(const dmat4& projectionMatrix, double nearDistance, double farDistance);
+
         virtual void compile(Context& context);
 
         View* view = nullptr;
@@ -142,8 +147,49 @@ namespace vsg
         ref_ptr<vec4Array> viewportData;
         ref_ptr<BufferInfo> viewportDataBufferInfo;
 
+        /// per eye view matrices for VK_KHR_multiview stereo, allocated when View::eyeOffsets is non-empty
+        /// and assigned to ShaderSets that declare a uniform binding named "eyeMatrices", with vertex
+        /// shaders selecting their eye's matrix using gl_ViewIndex.
+        ref_ptr<mat4Array> eyeMatricesData;
+        ref_ptr<BufferInfo> eyeMatricesBufferInfo;
+
+        /// opt-in clustered light culling - when enabled the point and spot lights gathered by the RecordTraversal
+        /// are binned each frame into an eye space froxel grid so that fragment shaders only need to iterate over
+        /// the lights overlapping their froxel rather than the whole light list. The cluster buffers are assigned
+        /// to ShaderSets that declare storage buffer descriptor bindings named "clusterGridData" and
+        /// "clusterLightIndices". Enable and set the grid dimensions before the scene is compiled.
+        bool clusteredLighting = false;
+        uint32_t clusterGridWidth = 16;
+        uint32_t clusterGridHeight = 9;
+        uint32_t clusterGridDepth = 24;
+        uint32_t maxLightsPerCluster = 63;
+
+        /// luminance cutoff used to derive the sphere of influence of lights that leave their radius at the default 0.0
+        double minClusterLuminance = 0.001;
+
+        /// two vec4 header - (gridWidth, gridHeight, gridDepth, maxLightsPerCluster), (sliceScale, nearDistance, farDistance, 0)
+        ref_ptr<vec4Array> clusterGridData;
+        ref_ptr<BufferInfo> clusterGridDataBufferInfo;
+
+        /// per froxel fixed stride entries - a light count followed by maxLightsPerCluster light indices,
+        /// point lights indexed first with spot lights following on
+        ref_ptr<uintArray> clusterLightIndices;
+        ref_ptr<BufferInfo> clusterLightIndicesBufferInfo;
+
         ref_ptr<Image> shadowDepthImage;
 
+        /// opt-in ray traced shadow/ambient occlusion support - lights assigned RayTracedShadows settings
+        /// contribute no shadow map rasterization passes, instead the application supplied rayShadowCommands
+        /// (a compute dispatch using ray queries or a TraceRays pass against the scene's
+        /// TopLevelAccelerationStructure) write a screen space mask (R = shadow visibility, G = ambient
+        /// occlusion) that is bound to ShaderSets declaring a texture binding named "shadowAOMask".
+        /// The commands are executed by the preRenderCommandGraph ahead of the main rendering pass,
+        /// replacing N shadow map rasterizations with a single ray pass. Set rayShadowCommands and
+        /// shadowAOMaskSize before the scene is compiled.
+        uvec2 shadowAOMaskSize = {1920, 1080};
+        ref_ptr<Commands> rayShadowCommands;
+        ref_ptr<ImageInfo> shadowAOMaskImageInfo;
+
         ref_ptr<DescriptorSetLayout> descriptorSetLayout;
         ref_ptr<DescriptorSet> descriptorSet;
 
@@ -167,12 +213,59 @@ namespace vsg
         {
             ref_ptr<RenderGraph> renderGraph;
             ref_ptr<View> view;
+
+            // shadow map caching state, see ShadowSettings::cacheShadowMaps
+            dmat4 cachedProjView;
+            bool rendered = false;
         };
 
         mutable std::vector<ShadowMap> shadowMaps;
 
+        /// number of cached shadow maps allowed to re-render per frame once they have been initially rendered,
+        /// rationing the cost of camera movement across frames for lights with ShadowSettings::cacheShadowMaps
+        /// enabled. 0 disables the limit.
+        uint32_t maxCachedShadowMapUpdatesPerFrame = 1;
+
+        /// mark all cached shadow maps as requiring a re-render and re-check the scene for dynamic casters,
+        /// call after modifying the scene graph viewed by a light with ShadowSettings::cacheShadowMaps enabled.
+        void invalidateCachedShadowMaps();
+
+        /// return true if the View's subgraph contains objects tagged as dynamic by FindDynamicObjects,
+        /// checked lazily on first use and cached until invalidateCachedShadowMaps() is called.
+        bool containsDynamicCasters() const;
+
     protected:
         ~ViewDependentState();
+
+        mutable bool _checkedForDynamicCasters = false;
+        mutable bool _containsDynamicCasters = false;
+
+        /// snapshot of the inputs a frame's light data and shadow cascades were derived from,
+        /// used by traverse(RecordTraversal&) to skip the rewrite, upload and cascade recomputation
+        /// when no light, transform or camera state has changed since the previous frame.
+        struct LightRecord
+        {
+            const Light* light = nullptr;
+            uint32_t modifiedCount = 0;
+            dmat4 modelview;
+
+            bool operator==(const LightRecord& rhs) const
+            {
+                return light == rhs.light && modifiedCount == rhs.modifiedCount && modelview == rhs.modelview;
+            }
+        };
+
+        mutable std::vector<LightRecord> _lightRecords;
+        mutable std::vector<LightRecord> _previousLightRecords;
+        mutable dmat4 _previousProjection;
+        mutable dmat4 _previousView;
+        mutable double _previousNear = 0.0;
+        mutable double _previousFar = 0.0;
+        mutable bool _previousValid = false;
+
+        /// per shadow map switch masks to apply on frames where nothing has changed, MASK_OFF for
+        /// cached shadow maps that can be reused, MASK_ALL for maps that re-render every frame.
+        mutable std::vector<Mask> _steadyStateShadowMapMasks;
     };
     VSG_type_name(vsg::ViewDependentState);
 
@@ -23,6 +23,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 namespace vsg
 {
 
+    class CompileManager;
+    class OperationThreads;
+    class UpdateOperations;
+
     class VSG_DECLSPEC CpuLayoutTechnique : public Inherit<TextTechnique, CpuLayoutTechnique>
     {
     public:
@@ -40,6 +44,19 @@ namespace vsg
         void setup(TextGroup* textGroup, uint32_t minimumAllocation = 0, ref_ptr<const Options> options = {}) override;
         dbox extents() const override { return textExtents; }
 
+        /// optional asynchronous rebuild: when operationThreads and updateOperations are both assigned,
+        /// setup() enqueues the layout and buffer generation as an operation on operationThreads,
+        /// building into a worker technique while the existing subgraph carries on rendering, and swaps
+        /// the result in via updateOperations during Viewer::update(). Assign compileManager
+        /// (viewer->compileManager) so the rebuilt subgraph's Vulkan objects are compiled on the worker
+        /// thread before the swap. The Text fields must not be modified while a rebuild is in flight.
+        ref_ptr<OperationThreads> operationThreads;
+        ref_ptr<UpdateOperations> updateOperations;
+        ref_ptr<CompileManager> compileManager;
+
+        /// take the results built by an asynchronous setup's worker technique, called during Viewer::update()
+        void swapIn(CpuLayoutTechnique& workerTechnique);
+
         virtual ref_ptr<Node> createRenderingSubgraph(ref_ptr<ShaderSet> shaderSet, ref_ptr<Font> font, bool billboard, TextQuads& textQuads, uint32_t minimumAllocation);
 
         // implementation data structure
@@ -57,6 +74,17 @@ namespace vsg
 
         ref_ptr<BindVertexBuffers> bindVertexBuffers;
         ref_ptr<BindIndexBuffer> bindIndexBuffer;
+
+    protected:
+        virtual ~CpuLayoutTechnique();
+
+        // attribute granularity and shader defines used by the last build of the rendering subgraph,
+        // a change forces a rebuild as the existing arrays and pipeline are incompatible
+        bool _singleColor = true;
+        bool _singleOutlineColor = true;
+        bool _singleOutlineWidth = true;
+        bool _singleCenterAutoScaleDistance = true;
+        bool _billboard = false;
     };
     VSG_type_name(vsg::CpuLayoutTechnique);
 
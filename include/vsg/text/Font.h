@@ -45,6 +45,10 @@ namespace vsg
             if (charmap && charcode < charmap->size()) return charmap->at(charcode);
             return 0;
         }
+        /// set the index into the glyphMetrics array for the glyph associated with specified charcode,
+        /// growing the charmap as required. Used with FontAtlas when adding glyphs at runtime.
+        void setGlyphIndexForCharcode(uint32_t charcode, uint32_t glyphIndex);
+
         void createFontImages();
 
     protected:
@@ -0,0 +1,73 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array2D.h>
+#include <vsg/text/Font.h>
+
+namespace vsg
+{
+
+    /// FontAtlas manages a glyph atlas that is populated incrementally at runtime and can be shared between
+    /// multiple Fonts, so atlas memory scales with the glyphs actually displayed rather than each font's full
+    /// codepoint coverage - particularly useful for large CJK character sets. Glyph bitmaps are added with
+    /// addGlyph(), packed into the atlas with a simple shelf packer and streamed to the GPU through the
+    /// dynamic data transfer path. Assign the atlas to one or more Fonts with assign(), then map charcodes to
+    /// the returned glyph indices with Font::setGlyphIndexForCharcode(). Rasterization of the glyph bitmaps
+    /// is left to the application or loader, such as vsgXchange::freetype.
+    class VSG_DECLSPEC FontAtlas : public Inherit<Object, FontAtlas>
+    {
+    public:
+        explicit FontAtlas(uint32_t width = 1024, uint32_t height = 1024, uint32_t maxGlyphs = 1024);
+
+        /// atlas texels, single channel, created with DYNAMIC_DATA variance so that newly packed glyphs are
+        /// automatically transferred to the GPU
+        ref_ptr<ubyteArray2D> atlas;
+
+        /// metrics of the glyphs packed into the atlas, allocated up front at maxGlyphs capacity so the
+        /// descriptors created from it remain valid as glyphs are added
+        ref_ptr<GlyphMetricsArray> glyphMetrics;
+
+        /// SharedObjects shared with all Fonts this atlas is assigned to, enabling pipeline and descriptor reuse between them
+        ref_ptr<SharedObjects> sharedObjects;
+
+        /// ImageInfos shared with all Fonts this atlas is assigned to, created by assign()
+        ref_ptr<ImageInfo> atlasImageInfo;
+        ref_ptr<ImageInfo> glyphImageInfo;
+
+        /// number of glyphs added so far, index 0 is reserved for the default glyph
+        uint32_t numGlyphs = 1;
+
+        /// border in texels left around each packed glyph to prevent bleeding between neighbouring glyphs when filtering
+        uint32_t padding = 1;
+
+        /// pack the glyph bitmap into the atlas and append its metrics, rewriting metrics.uvrect to the
+        /// packed position within the atlas. Returns the glyph index to assign to Font charmaps, or 0 when
+        /// the atlas or glyphMetrics capacity is exhausted.
+        uint32_t addGlyph(GlyphMetrics metrics, const ubyteArray2D& bitmap);
+
+        /// assign this atlas's texel data, glyph metrics, ImageInfos and SharedObjects to the font,
+        /// the font retains its own charmap so fonts sharing an atlas keep independent charcode mappings
+        void assign(Font& font);
+
+    protected:
+        virtual ~FontAtlas();
+
+        // shelf packing state
+        uint32_t _shelfX = 0;
+        uint32_t _shelfY = 0;
+        uint32_t _shelfHeight = 0;
+    };
+    VSG_type_name(vsg::FontAtlas);
+
+} // namespace vsg
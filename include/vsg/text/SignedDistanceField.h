@@ -0,0 +1,35 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array2D.h>
+#include <vsg/text/Font.h>
+
+namespace vsg
+{
+
+    /// generate a signed distance field from a single channel greyscale coverage glyph atlas, using the
+    /// 8SSEDT two pass distance transform. The returned atlas maps the glyph edge to 0.5, with spreadInTexels
+    /// controlling how many texels the distance ramp extends either side of the edge. The text ShaderSet
+    /// expects a signed distance field atlas, so one atlas resolution serves all zoom levels without
+    /// regenerating glyph geometry or calling Text::setup() on camera zoom.
+    extern VSG_DECLSPEC ref_ptr<ubyteArray2D> generateSignedDistanceField(const ubyteArray2D& coverage, float spreadInTexels = 8.0f);
+
+    /// convert a Font's coverage atlas to a signed distance field atlas in place, at load time.
+    /// A no-op for fonts whose atlas is already a signed distance field - conversion is recorded with the
+    /// "signedDistanceField" meta value so repeated calls are cheap, and a converted Font can be written out
+    /// with vsg::write() to cache the precomputed atlas across runs. Call before the font is first used for
+    /// rendering so that descriptors are created against the converted atlas.
+    extern VSG_DECLSPEC void convertFontToSignedDistanceField(Font& font, float spreadInTexels = 8.0f);
+
+} // namespace vsg
@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <set>
 #include <thread>
+#include <vector>
 
 namespace vsg
 {
@@ -42,4 +43,48 @@ namespace vsg
     /// Note, under Linux the CPU affinity of thread is inherited by any threads that it creates
     extern VSG_DECLSPEC void setAffinity(const Affinity& affinity);
 
+    /// CpuTopology describes the processor layout of the host - SMT siblings, hybrid
+    /// performance/efficiency cores and NUMA nodes - discovered once on first use.
+    /// It underpins the named thread placement policies below, and can be used directly by
+    /// applications that want to co-locate threads with memory, e.g. pass a cpu's numaNode to
+    /// Allocator::setBlockPlacement() and pin the threads using that allocator to cpusForNumaNode().
+    struct VSG_DECLSPEC CpuTopology
+    {
+        struct LogicalCpu
+        {
+            uint32_t cpu = 0;            /// logical cpu id as used by Affinity
+            uint32_t physicalCore = 0;   /// id shared by SMT siblings resident on the same physical core
+            uint32_t numaNode = 0;       /// NUMA node the cpu's local memory belongs to
+            bool performanceCore = true; /// false for efficiency (E) cores on hybrid CPUs
+        };
+
+        std::vector<LogicalCpu> logicalCpus;
+
+        /// true when the host mixes performance and efficiency cores
+        bool hybrid() const;
+
+        /// one logical cpu per distinct physical performance core, the first SMT sibling of each
+        std::vector<uint32_t> distinctPerformanceCores() const;
+
+        /// logical cpus of the efficiency cores, or all logical cpus when the host is not hybrid
+        std::vector<uint32_t> efficiencyCores() const;
+
+        /// logical cpus belonging to the specified NUMA node
+        std::vector<uint32_t> cpusForNumaNode(uint32_t numaNode) const;
+
+        /// the topology of the host, discovered on the first call
+        static const CpuTopology& get();
+    };
+
+    /// Affinity placing render/record thread threadIndex on a distinct physical performance core -
+    /// all SMT siblings of the selected core - so per frame threads neither share a core with each
+    /// other nor get scheduled onto efficiency cores. Returns an empty Affinity, leaving the thread
+    /// unpinned, when there are more threads than performance cores.
+    extern VSG_DECLSPEC Affinity renderThreadAffinity(uint32_t threadIndex);
+
+    /// Affinity placing background pager/IO threads on the efficiency cores of hybrid hosts, keeping
+    /// database reads and compile traversals off the cores running per frame work. Returns an empty
+    /// Affinity, leaving the threads unpinned, when the host is not hybrid.
+    extern VSG_DECLSPEC Affinity pagerThreadAffinity();
+
 } // namespace vsg
@@ -0,0 +1,136 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+
+#include <atomic>
+
+namespace vsg
+{
+
+    /// Bounded lock-free MPMC ring buffer queue, based on the sequence number per cell scheme.
+    /// push() returns false when the ring is full and pop() returns an empty value when it's empty,
+    /// leaving back-off and blocking policy to the caller. Capacity is rounded up to a power of two.
+    template<class T>
+    class LockFreeQueue : public Inherit<Object, LockFreeQueue<T>>
+    {
+    public:
+        using value_type = T;
+
+        explicit LockFreeQueue(size_t minimumCapacity = 1024)
+        {
+            size_t capacity = 1;
+            while (capacity < minimumCapacity) capacity <<= 1;
+
+            _mask = capacity - 1;
+            _cells = new Cell[capacity];
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            _head.store(0, std::memory_order_relaxed);
+            _tail.store(0, std::memory_order_relaxed);
+        }
+
+        LockFreeQueue(const LockFreeQueue&) = delete;
+        LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+        size_t capacity() const { return _mask + 1; }
+
+        /// add value to the back of the queue, returns false if the queue is full
+        bool push(value_type value)
+        {
+            size_t pos = _tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = _cells[pos & _mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                if (difference == 0)
+                {
+                    if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(value);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false; // full
+                }
+                else
+                {
+                    pos = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// take the head of the queue, returns a default constructed value if the queue is empty
+        value_type pop()
+        {
+            size_t pos = _head.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = _cells[pos & _mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+                if (difference == 0)
+                {
+                    if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        value_type value = std::move(cell.value);
+                        cell.value = value_type{};
+                        cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+                        return value;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return {}; // empty
+                }
+                else
+                {
+                    pos = _head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// return true if the queue appears empty at the time of the call
+        bool empty() const
+        {
+            return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+        }
+
+    protected:
+        virtual ~LockFreeQueue()
+        {
+            delete[] _cells;
+        }
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0};
+            value_type value{};
+        };
+
+        // head and tail on separate cache lines to avoid false sharing between producers and consumers
+        alignas(64) std::atomic<size_t> _head{0};
+        alignas(64) std::atomic<size_t> _tail{0};
+        size_t _mask = 0;
+        Cell* _cells = nullptr;
+    };
+
+} // namespace vsg
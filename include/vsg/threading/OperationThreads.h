@@ -12,6 +12,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/threading/LockFreeQueue.h>
 #include <vsg/threading/OperationQueue.h>
 
 #include <thread>
@@ -22,22 +23,45 @@ namespace vsg
     /// OperationThreads provides a collection of std::threads that share a single OperationQueue.
     /// Each thread polls the queue for vsg::Operation to process, when one is available it's removed
     /// from the queue and its Operation::run() method is called.
+    /// When constructed with useWorkStealing enabled each thread is given its own lock-free ring buffer
+    /// that added operations are distributed across, with idle threads stealing from their neighbours'
+    /// rings and the shared OperationQueue only used as an overflow, avoiding serializing short
+    /// operations on a single mutex.
     class VSG_DECLSPEC OperationThreads : public Inherit<Object, OperationThreads>
     {
     public:
-        explicit OperationThreads(uint32_t numThreads, ref_ptr<ActivityStatus> in_status = {});
+        explicit OperationThreads(uint32_t numThreads, ref_ptr<ActivityStatus> in_status = {}, bool in_useWorkStealing = false);
         OperationThreads(const OperationThreads&) = delete;
         OperationThreads& operator=(const OperationThreads& rhs) = delete;
 
         void add(ref_ptr<Operation> operation)
         {
+            if (useWorkStealing && !localQueues.empty())
+            {
+                auto index = _nextQueue.fetch_add(1, std::memory_order_relaxed) % localQueues.size();
+                if (localQueues[index]->push(operation))
+                {
+                    _notify();
+                    return;
+                }
+                // local ring full, fall through to the shared overflow queue
+            }
+
             queue->add(operation);
+            if (useWorkStealing) _notify();
         }
 
         template<typename Iterator>
         void add(Iterator begin, Iterator end)
         {
-            queue->add(begin, end);
+            if (useWorkStealing)
+            {
+                for (auto itr = begin; itr != end; ++itr) add(*itr);
+            }
+            else
+            {
+                queue->add(begin, end);
+            }
         }
 
         /// use this thread to run operations till the queue is empty as well
@@ -52,8 +76,24 @@ namespace vsg
         ref_ptr<OperationQueue> queue;
         ref_ptr<ActivityStatus> status;
 
+        /// when true operations are distributed across per thread lock-free rings with work stealing
+        const bool useWorkStealing;
+
+        using LocalQueue = LockFreeQueue<ref_ptr<Operation>>;
+        using LocalQueues = std::vector<ref_ptr<LocalQueue>>;
+        LocalQueues localQueues;
+
     protected:
         virtual ~OperationThreads();
+
+        /// take the next available operation, checking the shared queue and stealing from the local rings
+        ref_ptr<Operation> _takeOrSteal(size_t index);
+
+        void _notify();
+
+        std::atomic<uint32_t> _nextQueue{0};
+        std::mutex _sleepMutex;
+        std::condition_variable _sleepCV;
     };
     VSG_type_name(vsg::OperationThreads)
 
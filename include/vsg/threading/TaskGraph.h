@@ -0,0 +1,118 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationQueue.h>
+
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace vsg
+{
+
+    /// Task wraps a vsg::Operation together with its dependency edges for scheduling by a TaskGraph.
+    /// A Task only becomes runnable once all the Tasks it depends on have completed, so multi stage
+    /// pipelines such as decompress -> parse -> compile -> merge can be expressed without dedicating
+    /// a blocked thread to each stage.
+    class VSG_DECLSPEC Task : public Inherit<Object, Task>
+    {
+    public:
+        explicit Task(ref_ptr<Operation> in_operation);
+
+        /// the operation to invoke when all dependencies have completed
+        ref_ptr<Operation> operation;
+
+        /// return true once the task's operation has been run
+        bool completed() const { return _completed.load(std::memory_order_acquire); }
+
+    protected:
+        friend class TaskGraph;
+
+        std::atomic<uint32_t> _remainingDependencies{0};
+        std::atomic<bool> _completed{false};
+
+        // guards _successors against concurrent edge registration and completion
+        std::mutex _edgeMutex;
+        std::vector<ref_ptr<Task>> _successors;
+    };
+    VSG_type_name(vsg::Task);
+
+    /// TaskGraph provides a pool of worker threads that execute Tasks respecting their dependency
+    /// edges. Each worker owns a deque that it pushes and pops at the back while idle workers steal
+    /// from the front of their neighbours' deques, and when a task completes its newly ready
+    /// successors are enqueued on the completing worker's own deque so pipeline stages stay on the
+    /// thread whose caches hold their inputs. Intended as a more general alternative to
+    /// OperationThreads for work, such as DatabasePager stages and parallel record/compile, that has
+    /// ordering constraints between operations.
+    class VSG_DECLSPEC TaskGraph : public Inherit<Object, TaskGraph>
+    {
+    public:
+        explicit TaskGraph(uint32_t numThreads, ref_ptr<ActivityStatus> in_status = {});
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph& rhs) = delete;
+
+        /// add an operation to the graph, it will run once all the dependency Tasks have completed.
+        /// With no dependencies the task is immediately runnable. Returns the Task so it can be used
+        /// as a dependency of later additions.
+        ref_ptr<Task> add(ref_ptr<Operation> operation, const std::vector<ref_ptr<Task>>& dependencies = {});
+
+        /// convenience for chaining a continuation, equivalent to add(operation, {task})
+        ref_ptr<Task> then(ref_ptr<Task> task, ref_ptr<Operation> operation) { return add(operation, {task}); }
+
+        /// use the calling thread to run tasks alongside the worker threads until all added tasks have completed
+        void run();
+
+        /// block until all added tasks have completed
+        void wait();
+
+        /// stop the worker threads, leaving any tasks that have not yet run unexecuted
+        void stop();
+
+        using Threads = std::list<std::thread>;
+        Threads threads;
+        ref_ptr<ActivityStatus> status;
+
+    protected:
+        virtual ~TaskGraph();
+
+        struct WorkerDeque
+        {
+            std::mutex mutex;
+            std::deque<ref_ptr<Task>> tasks;
+        };
+
+        /// push a runnable task onto the specified worker's deque and wake a sleeping worker
+        void _enqueue(ref_ptr<Task> task, size_t index);
+
+        /// take from the back of the specified worker's own deque, or steal from the front of a neighbour's
+        ref_ptr<Task> _takeOrSteal(size_t index);
+
+        /// run the task's operation then release its successors, enqueuing newly ready ones locally
+        void _runTask(ref_ptr<Task> task, size_t index);
+
+        std::vector<std::unique_ptr<WorkerDeque>> _deques;
+
+        std::atomic<uint32_t> _nextDeque{0};
+        std::atomic<uint64_t> _pendingTasks{0};
+
+        std::mutex _sleepMutex;
+        std::condition_variable _sleepCV;
+
+        std::mutex _waitMutex;
+        std::condition_variable _waitCV;
+    };
+    VSG_type_name(vsg::TaskGraph);
+
+} // namespace vsg
@@ -0,0 +1,76 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/ui/PointerEvent.h>
+#include <vsg/ui/ScrollWheelEvent.h>
+#include <vsg/ui/TouchEvent.h>
+
+namespace vsg
+{
+
+    /// EventPool recycles the high rate pointer, scroll and touch events so a 1kHz mouse doesn't
+    /// allocate thousands of heap objects per second. Each acquire method returns a pooled instance
+    /// that no handler still references, falling back to a normal allocation when the ring is fully
+    /// in flight, so handlers see the ordinary UIEvent API and may retain events as usual. Pools are
+    /// owned per Window and used from that window's event thread, so no locking is required.
+    class VSG_DECLSPEC EventPool : public Inherit<Object, EventPool>
+    {
+    public:
+        explicit EventPool(size_t in_poolSize = 256);
+
+        /// maximum number of events of each type retained for reuse
+        size_t poolSize;
+
+        ref_ptr<MoveEvent> acquireMoveEvent(Window* window, time_point time, int32_t x, int32_t y, ButtonMask mask);
+        ref_ptr<ScrollWheelEvent> acquireScrollWheelEvent(Window* window, time_point time, const vec3& delta);
+        ref_ptr<TouchMoveEvent> acquireTouchMoveEvent(Window* window, time_point time, uint32_t x, uint32_t y, uint32_t id);
+
+    protected:
+        /// return a pooled instance only this pool references, growing the ring up to poolSize,
+        /// otherwise falling back to a fresh allocation that is not retained
+        template<class T>
+        ref_ptr<T> _acquire(std::vector<ref_ptr<T>>& pool, size_t& next)
+        {
+            for (size_t i = 0; i < pool.size(); ++i)
+            {
+                auto& candidate = pool[(next + i) % pool.size()];
+                if (candidate->referenceCount() == 1)
+                {
+                    next = (next + i + 1) % pool.size();
+                    return candidate;
+                }
+            }
+
+            auto event = T::create();
+            if (pool.size() < poolSize) pool.push_back(event);
+            return event;
+        }
+
+        std::vector<ref_ptr<MoveEvent>> _moveEvents;
+        std::vector<ref_ptr<ScrollWheelEvent>> _scrollWheelEvents;
+        std::vector<ref_ptr<TouchMoveEvent>> _touchMoveEvents;
+        size_t _nextMoveEvent = 0;
+        size_t _nextScrollWheelEvent = 0;
+        size_t _nextTouchMoveEvent = 0;
+    };
+    VSG_type_name(vsg::EventPool);
+
+    /// coalesce high rate events in place ahead of dispatch - consecutive pointer moves with the
+    /// same window and button mask collapse to the most recent, consecutive scroll wheel events on
+    /// the same window sum their deltas, and consecutive touch moves with the same id keep the most
+    /// recent - returning the number of events removed. Button, key and window events are never
+    /// touched, and an intervening event of another type flushes the run so ordering is preserved.
+    extern VSG_DECLSPEC size_t coalesceEvents(UIEvents& events);
+
+} // namespace vsg
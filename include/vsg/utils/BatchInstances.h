@@ -0,0 +1,97 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/core/Visitor.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+
+#include <map>
+#include <set>
+
+namespace vsg
+{
+
+    /// BatchInstances detects VertexIndexDraw geometries that appear multiple times in a scene graph under
+    /// different transforms - typically copies deduplicated by SharedObjects - hoists the per instance
+    /// transforms into a mat4 array bound as an additional vertex buffer, and replaces the individual
+    /// subgraphs with a single instanced draw.
+    ///
+    /// The graphics pipeline used with a merged draw must declare an extra vertex input binding after the
+    /// geometry's existing arrays with VK_VERTEX_INPUT_RATE_INSTANCE and four vec4 attributes forming the
+    /// instance matrix, and the vertex shader must apply that matrix. Instanced draws are attached beneath
+    /// the attach point passed to batch(), so only the state commands of the StateGroup found on the
+    /// replaced subgraphs is carried over, not state inherited from their other ancestors.
+    ///
+    /// Usage:
+    ///     auto batchInstances = vsg::BatchInstances::create();
+    ///     batchInstances->dynamicObjects = vsg::visit<vsg::FindDynamicObjects>(scene).dynamicObjects;
+    ///     scene->accept(*batchInstances); // collect the candidate draws
+    ///     batchInstances->batch(scene);   // prune the copies and attach the instanced draws to scene
+    class VSG_DECLSPEC BatchInstances : public Inherit<Visitor, BatchInstances>
+    {
+    public:
+        BatchInstances();
+
+        /// minimum number of copies of a VertexIndexDraw required before they are merged into an instanced draw
+        uint32_t minimumInstances = 4;
+
+        /// objects that are updated at runtime, typically gathered with FindDynamicObjects/PropagateDynamicObjects.
+        /// When a replaced subgraph contains a dynamic transform the merged instance array is marked DYNAMIC_DATA
+        /// so that updating the array and calling its dirty() transfers the new transforms to the GPU each frame.
+        /// Candidates beneath dynamic transforms that are not part of the replaced subgraph are left untouched.
+        std::set<const Object*> dynamicObjects;
+
+        /// one entry per draw merged by batch(), with the instance transforms exposed so applications can
+        /// update them at runtime in place of the original MatrixTransforms
+        struct InstancedDraw
+        {
+            ref_ptr<VertexIndexDraw> draw;
+            ref_ptr<mat4Array> transforms;
+        };
+        std::vector<InstancedDraw> instancedDraws;
+
+        bool dynamic(const Object* object) const { return dynamicObjects.count(object) != 0; }
+
+        void apply(Group& group) override;
+        void apply(Transform& transform) override;
+        void apply(MatrixTransform& mt) override;
+
+        /// remove the subgraphs of the collected draws with minimumInstances or more copies and add one
+        /// instanced draw per geometry under attachPoint, returning the number of draws merged
+        uint32_t batch(ref_ptr<Group> attachPoint);
+
+    protected:
+        // a single use of a candidate draw - the chain of single child nodes from a Group child down to the draw
+        struct Occurrence
+        {
+            Group* parent = nullptr;
+            ref_ptr<Node> subgraphRoot;
+            ref_ptr<VertexIndexDraw> draw;
+            StateGroup* stateGroup = nullptr;
+            dmat4 matrix;
+            bool dynamic = false;
+        };
+
+        bool _matchInstanceSubgraph(Group& parent, const ref_ptr<Node>& subgraphRoot, Occurrence& occurrence) const;
+
+        std::map<std::pair<const VertexIndexDraw*, const StateGroup*>, std::vector<Occurrence>> _candidates;
+
+        // accumulated absolute matrix and whether the path from the root permits hoisting transforms
+        dmat4 _matrix;
+        bool _pathBatchable = true;
+    };
+    VSG_type_name(vsg::BatchInstances);
+
+} // namespace vsg
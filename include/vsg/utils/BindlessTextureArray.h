@@ -0,0 +1,72 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/state/DescriptorImage.h>
+#include <vsg/utils/ShaderSet.h>
+
+#include <map>
+#include <mutex>
+
+namespace vsg
+{
+
+    /// BindlessTextureArray manages a single large, partially bound combined image sampler array that a whole
+    /// material library can share, so that individual materials no longer need their own descriptor sets -
+    /// shaders select the texture by an index passed via PushConstants or a per instance vertex attribute.
+    ///
+    /// Usage:
+    ///    1. call assignTo(shaderSet, ..) to declare the unbounded sampler array binding, which requires the
+    ///       VK_EXT_descriptor_indexing/Vulkan-1.2 descriptorBindingPartiallyBound feature to be enabled on the Device.
+    ///    2. register each texture with addTexture(..), which returns the stable index to pass to the shaders.
+    ///    3. attach the descriptor to the DescriptorSet for the declared set/binding, i.e. via
+    ///       GraphicsPipelineConfigurator::assignDescriptor() or directly in a BindDescriptorSet.
+    /// All textures must be registered before the descriptor is compiled.
+    class VSG_DECLSPEC BindlessTextureArray : public Inherit<Object, BindlessTextureArray>
+    {
+    public:
+        explicit BindlessTextureArray(uint32_t in_maxTextures = 2048, uint32_t in_set = 0, uint32_t in_binding = 0);
+
+        /// capacity of the texture array, used as the descriptorCount of the array binding
+        uint32_t maxTextures;
+
+        /// descriptor set and binding the texture array is declared at
+        uint32_t set;
+        uint32_t binding;
+
+        /// sampler used by addTexture(..) calls that don't provide their own
+        ref_ptr<Sampler> defaultSampler;
+
+        /// descriptor holding the registered textures, only the entries that have been registered are written
+        /// as the binding is created with VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+        ref_ptr<DescriptorImage> descriptor;
+
+        /// declare the texture array binding on the ShaderSet with the descriptor indexing flags it requires
+        void assignTo(ShaderSet& shaderSet, const std::string& name, const std::string& define, VkShaderStageFlags stageFlags) const;
+
+        /// register a texture and return its index in the array, reusing the existing entry when the same
+        /// textureData/sampler combination has already been registered. Thread safe.
+        uint32_t addTexture(ref_ptr<Data> textureData, ref_ptr<Sampler> sampler = {});
+
+        /// register an explicitly set up ImageInfo and return its index in the array. Thread safe.
+        uint32_t addTexture(ref_ptr<ImageInfo> imageInfo);
+
+    protected:
+        virtual ~BindlessTextureArray();
+
+        mutable std::mutex _mutex;
+        std::map<std::pair<const Data*, const Sampler*>, uint32_t> _textureIndices;
+    };
+    VSG_type_name(vsg::BindlessTextureArray);
+
+} // namespace vsg
@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/CompileTraversal.h>
 #include <vsg/maths/box.h>
 #include <vsg/maths/sphere.h>
+#include <vsg/state/ImageInfo.h>
 #include <vsg/utils/ShaderSet.h>
 #include <vsg/utils/SharedObjects.h>
 
@@ -30,10 +31,11 @@ namespace vsg
         bool greyscale = false; /// greyscale image
         bool wireframe = false;
         bool instance_colors_vec4 = true;
-        bool instance_positions_vec3 = false; // user must assign GeometryInfo::positions with vec3Array containing positions
+        bool instance_positions_vec3 = false; // automatically enabled when GeometryInfo::positions is assigned a vec3Array containing positions
         bool billboard = false;               // user must assign GeometryInfo::positions with vec4Array containing position_scaleDistance, overrides instance_positions_vec3 setting
 
         ref_ptr<Data> image;
+        ref_ptr<ImageInfo> imageInfo; // pre-existing texture, such as a render to texture attachment, takes precedence over image when assigned
         ref_ptr<Data> displacementMap;
         ref_ptr<DescriptorSetLayout> viewDescriptorSetLayout;
 
@@ -43,6 +45,7 @@ namespace vsg
             if (result) return result < 0;
 
             if ((result = compare_pointer(image, rhs.image))) return result < 0;
+            if ((result = compare_pointer(imageInfo, rhs.imageInfo))) return result < 0;
             if ((result = compare_pointer(displacementMap, rhs.displacementMap))) return result < 0;
             return compare_pointer(viewDescriptorSetLayout, rhs.viewDescriptorSetLayout) < 0;
         }
@@ -92,11 +95,18 @@ namespace vsg
         ref_ptr<Data> positions;
         ref_ptr<Data> colors;
 
+        /// when true the instance positions/colors arrays are marked as DYNAMIC_DATA so they can be
+        /// updated after compile by writing new values and calling Data::dirty(), with the viewer's
+        /// TransferTask copying the changes to the GPU each frame
+        bool dynamic = false;
+
         bool operator<(const GeometryInfo& rhs) const
         {
             int result = compare_region(position, transform, rhs.position);
             if (result) return result < 0;
 
+            if (dynamic != rhs.dynamic) return dynamic < rhs.dynamic;
+
             if ((result = compare_pointer(positions, rhs.positions))) return result < 0;
             return compare_pointer(colors, rhs.colors) < 0;
         }
@@ -0,0 +1,87 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/utils/ComputeBounds.h>
+
+#include <map>
+
+namespace vsg
+{
+
+    /// CachedComputeBounds is a ComputeBounds variant intended to be kept alive and reused for repeated,
+    /// per frame bounds queries over large models. The bounds of each draw command's vertex range are
+    /// cached between traversals, keyed on the vertex/index arrays and draw parameters and validated
+    /// against the Data ModifiedCount machinery, so a traversal only re-reads arrays that have been
+    /// dirty()'d since the previous query and the cost becomes proportional to the number of nodes and
+    /// changed arrays rather than the number of vertices.
+    ///
+    /// As the cached local bounds are transformed by their box corners rather than per vertex, the result
+    /// can be slightly looser than ComputeBounds for rotated geometry, the same trade off as useNodeBounds.
+    ///
+    /// Usage:
+    ///     auto computeBounds = vsg::CachedComputeBounds::create();
+    ///     scene->accept(*computeBounds); // first query does the full per vertex compute
+    ///     ...
+    ///     computeBounds->reset();
+    ///     scene->accept(*computeBounds); // subsequent queries only re-read changed arrays
+    class VSG_DECLSPEC CachedComputeBounds : public Inherit<ComputeBounds, CachedComputeBounds>
+    {
+    public:
+        explicit CachedComputeBounds(ref_ptr<ArrayState> initialArrayState = {});
+
+        /// clear the accumulated bounds ready for a new traversal, retaining the cached draw bounds
+        void reset();
+
+        /// discard all cached draw bounds, forcing the next traversal to recompute everything
+        void clearCache();
+
+        /// remove cache entries that were not referenced by the latest traversal, call occasionally
+        /// after the scene graph structure has changed to stop the cache growing.
+        void prune();
+
+        void applyDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+        void applyDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+
+    protected:
+        struct DrawKey
+        {
+            const Data* vertices = nullptr;
+            const Data* indices = nullptr;
+            uint32_t first = 0;
+            uint32_t count = 0;
+
+            bool operator<(const DrawKey& rhs) const
+            {
+                if (vertices != rhs.vertices) return vertices < rhs.vertices;
+                if (indices != rhs.indices) return indices < rhs.indices;
+                if (first != rhs.first) return first < rhs.first;
+                return count < rhs.count;
+            }
+        };
+
+        struct CachedDraw
+        {
+            dbox localBounds; /// bounds of the vertex range in the local coordinate frame of the draw command
+            ref_ptr<const Data> vertices;
+            ref_ptr<const Data> indices;
+            ModifiedCount verticesModified;
+            ModifiedCount indicesModified;
+            bool used = false; /// entry was referenced by the latest traversal, maintained for prune()
+        };
+
+        std::map<DrawKey, CachedDraw> _cache;
+    };
+    VSG_type_name(vsg::CachedComputeBounds);
+
+} // namespace vsg
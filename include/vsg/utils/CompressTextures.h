@@ -0,0 +1,95 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Visitor.h>
+#include <vsg/io/Options.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/state/ImageInfo.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <map>
+#include <vector>
+
+namespace vsg
+{
+
+    /// select the BCn block compressed format best suited to an uncompressed 2D image - BC4 for
+    /// single channel, BC5 for two channel, BC1 for opaque RGBA and BC3 for RGBA with varying
+    /// alpha, with the sRGB variants chosen when the source format is sRGB. Returns
+    /// VK_FORMAT_UNDEFINED for data that cannot be compressed, including non power of two or
+    /// smaller than 4x4 images.
+    extern VSG_DECLSPEC VkFormat selectCompressedFormat(const Data& image);
+
+    /// encode an uncompressed 8 bit 2D image (ubyteArray2D/ubvec2Array2D/ubvec4Array2D) into the
+    /// specified BC1/BC3/BC4/BC5 block compressed format, optionally box filtering a full mipmap
+    /// chain before encoding as the mipmap generation blits used for uncompressed uploads cannot
+    /// be applied to block compressed images. The source must be power of two and at least 4x4.
+    /// Returns a block64Array2D/block128Array2D ready to assign to an Image, or {} when the
+    /// image/format combination is not supported.
+    extern VSG_DECLSPEC ref_ptr<Data> compressImage(const Data& image, VkFormat targetFormat, bool generateMipmaps = true);
+
+    /// CompressTextures replaces the uncompressed 8 bit textures of a loaded subgraph with BCn
+    /// block compressed equivalents, cutting texture VRAM and sampling bandwidth by 4-8x without
+    /// asset pipeline changes. accept() collects the textures bound by DescriptorImage beneath
+    /// the visited StateGroups, and finish() encodes each unique image once - in parallel when
+    /// operationThreads is assigned - and rebuilds the associated Image/ImageView around the
+    /// compressed data. When Options::textureCacheDirectory is assigned via options, encoded
+    /// results are cached on disk keyed by the source data's content hash, so subsequent runs
+    /// load the compressed blocks instead of re-encoding. Dynamic data is left untouched.
+    /// Apply before compile().
+    ///
+    /// Usage:
+    ///     auto compress = vsg::CompressTextures::create();
+    ///     compress->options = options;
+    ///     scene->accept(*compress);
+    ///     compress->finish();
+    class VSG_DECLSPEC CompressTextures : public Inherit<Visitor, CompressTextures>
+    {
+    public:
+        CompressTextures();
+
+        /// box filter a full mipmap chain before encoding
+        bool generateMipmaps = true;
+
+        /// options providing the textureCacheDirectory used for the on disk cache of encoded results
+        ref_ptr<const Options> options;
+
+        /// optional threads used by finish() to encode images in parallel
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// number of textures replaced with block compressed data
+        uint32_t numCompressed = 0;
+
+        void apply(Object& object) override;
+        void apply(StateGroup& stateGroup) override;
+
+        /// encode the collected images and assign the compressed results, call after the traversal
+        void finish();
+
+    protected:
+        struct Job
+        {
+            ref_ptr<Data> source;
+            VkFormat targetFormat = VK_FORMAT_UNDEFINED;
+            ref_ptr<Data> result;
+            std::vector<ref_ptr<ImageInfo>> imageInfos;
+        };
+
+        void _collect(ImageInfo& imageInfo);
+
+        std::map<const Data*, Job> _jobs;
+    };
+    VSG_type_name(vsg::CompressTextures);
+
+} // namespace vsg
@@ -0,0 +1,49 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Visitor.h>
+
+namespace vsg
+{
+
+    /// ComputeAggregateMasks bakes each MaskGroup's mask to the union of the masks reachable beneath it,
+    /// so traversals whose traversalMask overlaps nothing in the subgraph can skip the branch with a single
+    /// mask test. Masks are gathered from Switch children, Layer and nested MaskGroup nodes; subgraph content
+    /// that isn't guarded by a mask conservatively contributes MASK_ALL. Re-run the visitor after modifying
+    /// a subgraph to refresh the cached masks:
+    ///     vsg::visit<vsg::ComputeAggregateMasks>(scene);
+    class VSG_DECLSPEC ComputeAggregateMasks : public Inherit<Visitor, ComputeAggregateMasks>
+    {
+    public:
+        ComputeAggregateMasks();
+
+        /// number of MaskGroups whose mask was updated
+        uint32_t numMasksBaked = 0;
+
+        void apply(Node& node) override;
+        void apply(Group& group) override;
+        void apply(MaskGroup& maskGroup) override;
+        void apply(Switch& sw) override;
+        void apply(Layer& layer) override;
+        void apply(CullNode& cullNode) override;
+
+    protected:
+        /// compute the union of the masks reachable in a subgraph
+        Mask _aggregate(Node& node);
+
+        Mask _mask = MASK_OFF;
+    };
+    VSG_type_name(vsg::ComputeAggregateMasks);
+
+} // namespace vsg
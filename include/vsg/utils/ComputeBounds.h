@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/maths/box.h>
 #include <vsg/state/ArrayState.h>
+#include <vsg/threading/OperationThreads.h>
 
 namespace vsg
 {
@@ -31,6 +32,10 @@ namespace vsg
         /// Using the bounding volumes is faster but may result in less tight bounds around the geometry in the scene.
         bool useNodeBounds = true;
 
+        /// optional OperationThreads used to process the vertices of large Draw/DrawIndexed commands in parallel
+        /// via vsg::parallel_reduce(..), with small arrays handled inline as usual.
+        ref_ptr<OperationThreads> operationThreads;
+
         using ArrayStateStack = std::vector<ref_ptr<ArrayState>>;
         ArrayStateStack arrayStateStack;
 
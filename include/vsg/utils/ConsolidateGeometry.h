@@ -0,0 +1,77 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Visitor.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <set>
+
+namespace vsg
+{
+
+    /// ConsolidateGeometry rewrites importer style subgraphs built from many small Geometry nodes into
+    /// the form a hand batched graph would take. Each Geometry whose command list is a single Draw or
+    /// DrawIndexed is replaced with the equivalent VertexDraw/VertexIndexDraw, and sibling draws beneath
+    /// the same StateGroup that share a vertex layout are merged into one draw over concatenated arrays,
+    /// with index values rebased so the merged ranges address the shared buffers.
+    ///
+    /// Draws are only merged when the StateGroup's own BindGraphicsPipeline declares a point/line/triangle
+    /// list topology without primitive restart, as other topologies change meaning when concatenated, and
+    /// merging is skipped for dynamic data. Merging reorders the draws within a StateGroup, so leave
+    /// mergeDraws off for subgraphs whose children depend on draw order, such as sorted transparency.
+    /// Apply before compile() while the vertex and index data are still present.
+    ///
+    /// Usage:
+    ///     auto consolidate = vsg::ConsolidateGeometry::create();
+    ///     consolidate->dynamicObjects = vsg::visit<vsg::FindDynamicObjects>(scene).dynamicObjects;
+    ///     scene->accept(*consolidate);
+    class VSG_DECLSPEC ConsolidateGeometry : public Inherit<Visitor, ConsolidateGeometry>
+    {
+    public:
+        ConsolidateGeometry();
+
+        /// merge compatible sibling draws sharing a StateGroup into single draws over concatenated buffers
+        bool mergeDraws = true;
+
+        /// optional OperationThreads used to concatenate the vertex arrays and rebase the index data of
+        /// large merges in parallel via vsg::parallel_for(..), with small merges handled inline as usual.
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// objects that are updated at runtime, typically gathered with FindDynamicObjects/PropagateDynamicObjects.
+        /// Draws whose arrays or indices are dynamic are converted but never merged, as merging would
+        /// leave the application updating buffers that are no longer bound.
+        std::set<const Object*> dynamicObjects;
+
+        /// number of Geometry nodes replaced with VertexDraw/VertexIndexDraw
+        uint32_t numConverted = 0;
+
+        /// number of draws merged away into shared buffers
+        uint32_t numMerged = 0;
+
+        bool dynamic(const Object* object) const { return dynamicObjects.count(object) != 0; }
+
+        void apply(Group& group) override;
+        void apply(StateGroup& stateGroup) override;
+
+    protected:
+        bool _mergeable(const Data* data) const;
+        void _mergeVertexIndexDraws(StateGroup& stateGroup);
+        void _mergeVertexDraws(StateGroup& stateGroup);
+    };
+    VSG_type_name(vsg::ConsolidateGeometry);
+
+} // namespace vsg
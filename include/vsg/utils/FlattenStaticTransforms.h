@@ -0,0 +1,57 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Visitor.h>
+#include <vsg/maths/mat4.h>
+
+#include <set>
+
+namespace vsg
+{
+
+    /// FlattenStaticTransforms is a one time baking pass that computes the absolute matrix of every
+    /// MatrixTransform whose path from the root is static and replaces it with an AbsoluteTransform
+    /// holding the precomputed matrix, so RecordTraversal pushes the matrix without the per visit
+    /// multiply. Transforms tagged in dynamicObjects, typically gathered with FindDynamicObjects and
+    /// PropagateDynamicObjects, and any transforms beneath them are left untouched.
+    ///
+    /// Usage:
+    ///     auto flatten = vsg::FlattenStaticTransforms::create();
+    ///     flatten->dynamicObjects = vsg::visit<vsg::FindDynamicObjects>(scene).dynamicObjects;
+    ///     scene->accept(*flatten);
+    class VSG_DECLSPEC FlattenStaticTransforms : public Inherit<Visitor, FlattenStaticTransforms>
+    {
+    public:
+        FlattenStaticTransforms();
+
+        /// objects that must be treated as dynamic and excluded from baking
+        std::set<const Object*> dynamicObjects;
+
+        /// number of MatrixTransforms converted to AbsoluteTransform
+        uint32_t numTransformsBaked = 0;
+
+        bool dynamic(const Object* object) const { return dynamicObjects.count(object) != 0; }
+
+        void apply(Group& group) override;
+        void apply(Transform& transform) override;
+        void apply(MatrixTransform& mt) override;
+
+    protected:
+        // accumulated absolute matrix and whether the path from the root is still provably static
+        dmat4 _matrix;
+        bool _pathStatic = true;
+    };
+    VSG_type_name(vsg::FlattenStaticTransforms);
+
+} // namespace vsg
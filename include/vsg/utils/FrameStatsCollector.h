@@ -0,0 +1,153 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#pragma once
+
+#include <vsg/ui/FrameStamp.h>
+#include <vsg/utils/Instrumentation.h>
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace vsg
+{
+
+    /// FrameStatsCollector is a lightweight Instrumentation implementation intended to be left enabled in
+    /// production builds. Each instrumented thread writes scoped timings into its own lock free ring buffer,
+    /// which the viewer thread drains on each enterFrame() into per frame, per scope statistics - call count,
+    /// total/min/max time and a log2 duration histogram. Scope names follow the SourceLocation names used
+    /// throughout the VSG so record times, cull and draw counts, transfers and pager activity all appear
+    /// under their usual instrumentation names. Completed frames are queryable via frameStats() and can be
+    /// dumped as JSON via report_json(), unlike vsg::Profiler no log of individual events is retained.
+    class VSG_DECLSPEC FrameStatsCollector : public Inherit<Instrumentation, FrameStatsCollector>
+    {
+    public:
+        explicit FrameStatsCollector(size_t in_framesToKeep = 64, size_t in_eventsPerThread = 16384);
+
+        /// scopes with a SourceLocation level greater than maxLevel are ignored, keeping the overhead of fine grained instrumentation out of production telemetry
+        uint32_t maxLevel = 2;
+
+        /// number of completed frames retained for querying
+        size_t framesToKeep = 64;
+
+        /// number of bins in ScopeStats::histogram, bin i counts durations in [2^i, 2^(i+1)) nanoseconds
+        static constexpr size_t numHistogramBins = 32;
+
+        /// aggregated statistics for a single scope over a single frame
+        struct ScopeStats
+        {
+            uint64_t count = 0;
+            uint64_t totalNanoseconds = 0;
+            uint64_t minNanoseconds = ~0ull;
+            uint64_t maxNanoseconds = 0;
+            uint64_t histogram[numHistogramBins] = {};
+
+            void add(uint64_t durationNanoseconds);
+            void merge(const ScopeStats& rhs);
+        };
+
+        /// statistics for all the scopes recorded during a single frame
+        struct FrameStats : public Inherit<Object, FrameStats>
+        {
+            uint64_t frameCount = 0;
+            vsg::time_point time = {};
+            uint64_t frameDurationNanoseconds = 0;
+            uint64_t droppedEvents = 0;
+            std::map<const SourceLocation*, ScopeStats> scopes;
+
+            /// GPU durations per scope, filled in by GpuStatsCollector several frames after the frame completes
+            std::map<const SourceLocation*, ScopeStats> gpuScopes;
+
+            /// find the stats for a scope by its SourceLocation name, or nullptr when the scope wasn't recorded this frame
+            const ScopeStats* find(const char* name) const;
+        };
+
+        /// thread safe access to a completed frame, framesAgo = 0 is the most recently completed frame.
+        /// Returns an empty ref_ptr when the requested frame is no longer retained.
+        ref_ptr<FrameStats> frameStats(size_t framesAgo = 0) const;
+
+        /// thread safe copy of all retained frames, ordered oldest first
+        std::vector<ref_ptr<FrameStats>> retainedFrames() const;
+
+        /// write the retained frames out as JSON
+        void report_json(std::ostream& out) const;
+
+    public:
+        void setThreadName(const std::string& name) const override;
+
+        void enterFrame(const SourceLocation* sl, uint64_t& reference, FrameStamp& frameStamp) const override;
+        void leaveFrame(const SourceLocation* sl, uint64_t& reference, FrameStamp& frameStamp) const override;
+
+        void enter(const SourceLocation* sl, uint64_t& reference, const Object* object = nullptr) const override;
+        void leave(const SourceLocation* sl, uint64_t& reference, const Object* object = nullptr) const override;
+
+        void enterCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer) const override;
+        void leaveCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer) const override;
+
+        void enter(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer, const Object* object = nullptr) const override;
+        void leave(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer, const Object* object = nullptr) const override;
+
+        void finish() const override;
+
+    protected:
+        virtual ~FrameStatsCollector();
+
+        struct Event
+        {
+            const SourceLocation* sourceLocation = nullptr;
+            uint64_t durationNanoseconds = 0;
+        };
+
+        /// single producer, single consumer ring buffer - the owning thread pushes events lock free,
+        /// the viewer thread drains them during enterFrame(). Events are dropped rather than blocking when the ring is full.
+        struct ThreadEvents
+        {
+            explicit ThreadEvents(size_t size) :
+                events(size) {}
+
+            std::vector<Event> events;
+            std::atomic<uint64_t> head = 0;
+            uint64_t tail = 0;
+            std::atomic<uint64_t> dropped = 0;
+
+            inline void push(const SourceLocation* sl, uint64_t durationNanoseconds)
+            {
+                uint64_t current = head.load(std::memory_order_relaxed);
+                if (current - tail >= events.size())
+                {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                events[current % events.size()] = Event{sl, durationNanoseconds};
+                head.store(current + 1, std::memory_order_release);
+            }
+        };
+
+        ThreadEvents& threadEvents() const;
+
+        size_t _eventsPerThread;
+
+        mutable std::mutex _threadsMutex;
+        mutable std::map<std::thread::id, std::unique_ptr<ThreadEvents>> _threads;
+        mutable std::map<std::thread::id, std::string> _threadNames;
+
+        mutable std::mutex _framesMutex;
+        mutable std::deque<ref_ptr<FrameStats>> _frames;
+        mutable vsg::time_point _frameStartTime = {};
+        mutable bool _frameStarted = false;
+    };
+    VSG_type_name(vsg::FrameStatsCollector);
+
+} // namespace vsg
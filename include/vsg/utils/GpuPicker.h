@@ -0,0 +1,138 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/Camera.h>
+#include <vsg/app/CommandGraph.h>
+#include <vsg/app/RenderGraph.h>
+#include <vsg/core/Visitor.h>
+#include <vsg/vk/Fence.h>
+#include <vsg/vk/Framebuffer.h>
+#include <vsg/vk/Queue.h>
+
+namespace vsg
+{
+
+    /// AssignObjectIDs traverses a scene graph assigning a unique 32 bit objectID to each drawable
+    /// leaf node (VertexDraw, VertexIndexDraw and Geometry), recording the full object path to each
+    /// so the IDs written by a GPU ID pass can be resolved back to the nodes that produced them.
+    /// The assigned ID is also stored on the node as an "objectID" value so the application's
+    /// ID pass pipeline setup can route it to the fragment shader. objectID 0 is reserved for
+    /// the cleared background.
+    class VSG_DECLSPEC AssignObjectIDs : public Inherit<Visitor, AssignObjectIDs>
+    {
+    public:
+        /// object paths indexed by objectID - 1
+        std::vector<RefObjectPath> objectPaths;
+
+        void apply(Object& object) override;
+        void apply(Geometry& geometry) override;
+        void apply(VertexDraw& vd) override;
+        void apply(VertexIndexDraw& vid) override;
+
+    protected:
+        void assign(Node& node);
+
+        RefObjectPath _objectPath;
+    };
+    VSG_type_name(vsg::AssignObjectIDs);
+
+    /// GpuPicker provides constant time picking regardless of scene complexity by rendering 32 bit
+    /// objectIDs to a small offscreen R32_UINT target covering just the region around the cursor and
+    /// reading the IDs back via vkCmdCopyImageToBuffer, complementing the precise CPU intersectors.
+    ///
+    /// Usage: call assignObjectIDs(scene) to allocate IDs and record the ID to node path mapping,
+    /// build a View of the scene using pickCamera and an ID writing ShaderSet whose fragment stage
+    /// outputs the node's "objectID" value to the uint color attachment, add the View to renderGraph,
+    /// then per pick call submitPick(camera, x, y) with the scene's camera and the cursor position,
+    /// and later completePick() to collect the IDs under the cursor without blocking mid frame, or
+    /// use the blocking pick() convenience method. submitPick() narrows the pick camera's projection
+    /// to the extent x extent pixel window around the cursor so the cost of the pass is independent
+    /// of both window size and scene complexity.
+    class VSG_DECLSPEC GpuPicker : public Inherit<Object, GpuPicker>
+    {
+    public:
+        explicit GpuPicker(ref_ptr<Device> in_device, uint32_t in_extent = 8, VkFormat in_depthFormat = VK_FORMAT_D32_SFLOAT);
+
+        ref_ptr<Device> device;
+
+        /// width and height, in pixels, of the pick window rendered around the cursor
+        uint32_t extent = 8;
+
+        VkFormat depthFormat = VK_FORMAT_D32_SFLOAT;
+
+        /// queue the pick passes are submitted to, assigned to the device's first graphics queue by the constructor
+        ref_ptr<Queue> queue;
+
+        /// camera the application's ID View should use, its projection is updated by submitPick() to frame the cursor region
+        ref_ptr<Camera> pickCamera;
+
+        /// RenderGraph rendering into the ID framebuffer, add the application's ID View as a child
+        ref_ptr<RenderGraph> renderGraph;
+
+        /// CommandGraph recorded and submitted by submitPick(), containing the renderGraph followed by the readback copy
+        ref_ptr<CommandGraph> commandGraph;
+
+        /// RenderPass the application's ID pipelines must be compatible with, with a single R32_UINT color attachment
+        RenderPass* getRenderPass() { return _renderPass; }
+
+        /// traverse the scene with AssignObjectIDs, storing the resulting ID to object path mapping for objectPath() lookups
+        void assignObjectIDs(Node& scene);
+
+        /// resolve an objectID read back from the ID pass to the path of the node it was assigned to, empty for the background or unknown IDs
+        RefObjectPath objectPath(uint32_t objectID) const;
+
+        /// record and submit the ID pass for the specified cursor position, completing any previous pick still in flight.
+        /// camera provides the view, projection and viewport of the rendering the cursor position is relative to.
+        VkResult submitPick(ref_ptr<Camera> camera, double x, double y, ref_ptr<FrameStamp> frameStamp = {});
+
+        /// wait for the pick pass submitted by submitPick() to complete, then return the unique non zero objectIDs
+        /// under the pick window ordered by their distance from the cursor, closest first.
+        std::vector<uint32_t> completePick();
+
+        /// blocking convenience method returning the object path of the ID closest to the cursor, empty when nothing was hit
+        RefObjectPath pick(ref_ptr<Camera> camera, double x, double y);
+
+        /// return true when a pick submitted by submitPick() has not yet been completed
+        bool pending() const { return _inFlight; }
+
+    protected:
+        virtual ~GpuPicker();
+
+        /// internal command recording the copy of the ID attachment to the readback buffer
+        class Readback : public Inherit<Command, Readback>
+        {
+        public:
+            explicit Readback(GpuPicker* in_picker);
+
+            void record(CommandBuffer& commandBuffer) const override;
+
+        protected:
+            GpuPicker* _picker;
+        };
+        friend class Readback;
+
+        ref_ptr<RenderPass> _renderPass;
+        ref_ptr<Framebuffer> _framebuffer;
+        ref_ptr<Image> _idImage;
+        ref_ptr<Buffer> _readbackBuffer;
+        void* _mappedData = nullptr;
+        VkDeviceSize _readbackSize = 0;
+        ref_ptr<Fence> _fence;
+        bool _inFlight = false;
+
+        std::vector<RefObjectPath> _objectPaths;
+    };
+    VSG_type_name(vsg::GpuPicker);
+
+} // namespace vsg
@@ -0,0 +1,80 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#pragma once
+
+#include <vsg/state/QueryPool.h>
+#include <vsg/utils/FrameStatsCollector.h>
+
+namespace vsg
+{
+
+    /// GpuStatsCollector extends FrameStatsCollector with automatic GPU timing. Every GPU instrumented
+    /// scope - each RenderGraph, CommandGraph record and any other GPU_INSTRUMENTATION site - is bracketed
+    /// with vkCmdWriteTimestamp pairs written into a per frame-in-flight QueryPool, so no hand placed
+    /// queries are needed to see which pass is GPU bound. Query results are read back framesBuffered frames
+    /// later without stalling and published into the corresponding retained FrameStats::gpuScopes, alongside
+    /// the CPU statistics, so they appear in frameStats() queries and report_json() output.
+    class VSG_DECLSPEC GpuStatsCollector : public Inherit<FrameStatsCollector, GpuStatsCollector>
+    {
+    public:
+        explicit GpuStatsCollector(size_t in_framesToKeep = 64, size_t in_eventsPerThread = 16384, uint32_t in_timestampsPerFrame = 256, size_t in_framesBuffered = 3);
+
+        /// GPU scopes with a SourceLocation level greater than gpuMaxLevel are not timed, level 1 covers RenderGraph/CommandGraph granularity
+        uint32_t gpuMaxLevel = 1;
+
+        /// number of timestamps available per frame and device, two are consumed per timed scope
+        uint32_t timestampsPerFrame = 256;
+
+    public:
+        void enterFrame(const SourceLocation* sl, uint64_t& reference, FrameStamp& frameStamp) const override;
+
+        void enterCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer) const override;
+        void leaveCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer) const override;
+
+        void enter(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer, const Object* object = nullptr) const override;
+        void leave(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer, const Object* object = nullptr) const override;
+
+        void finish() const override;
+
+    protected:
+        virtual ~GpuStatsCollector();
+
+        /// timestamp queries for a single device over a single frame
+        struct DeviceQueries : public Inherit<Object, DeviceQueries>
+        {
+            ref_ptr<Device> device;
+            ref_ptr<QueryPool> queryPool;
+            mutable std::atomic<uint32_t> queryIndex = 0;
+            std::vector<const SourceLocation*> sourceLocations;
+            std::vector<uint64_t> timestamps;
+            double nanosecondsPerTick = 1.0;
+        };
+
+        /// timestamp queries for all devices over a single frame
+        struct FrameQueries
+        {
+            uint64_t frameCount = 0;
+            bool active = false;
+            std::vector<ref_ptr<DeviceQueries>> perDevice;
+        };
+
+        ref_ptr<DeviceQueries> deviceQueries(CommandBuffer& commandBuffer) const;
+        void resolve(FrameQueries& frameQueries) const;
+
+        mutable std::mutex _queriesMutex;
+        mutable std::vector<FrameQueries> _frameQueries;
+        mutable size_t _queryFrameIndex = 0;
+    };
+    VSG_type_name(vsg::GpuStatsCollector);
+
+} // namespace vsg
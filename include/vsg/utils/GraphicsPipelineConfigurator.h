@@ -23,6 +23,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/InputAssemblyState.h>
 #include <vsg/state/MultisampleState.h>
 #include <vsg/state/RasterizationState.h>
+#include <vsg/state/StateSwitch.h>
 #include <vsg/state/TessellationState.h>
 #include <vsg/state/VertexInputState.h>
 #include <vsg/state/ViewportState.h>
@@ -54,6 +55,11 @@ namespace vsg
         bool assignDescriptor(const std::string& name, ref_ptr<Data> data = {}, uint32_t dstArrayElement = 0);
         bool assignDescriptor(const std::string& name, const BufferInfoList& bufferInfoList, uint32_t dstArrayElement = 0);
 
+        /// assign a ready made Descriptor, such as a DynamicUniformRing, to the binding the ShaderSet declares under name.
+        /// The descriptor's dstBinding is taken from the binding declaration, while the set layout uses the descriptor's own
+        /// descriptorType so a dynamic descriptor can be assigned to a binding declared with the non dynamic type.
+        bool assignCustomDescriptor(const std::string& name, ref_ptr<Descriptor> descriptor);
+
         [[deprecated("use enableDescriptor(..)")]] bool enableUniform(const std::string& name) { return enableDescriptor(name); }
 
         [[deprecated("use assignDescriptor(..)")]] bool assignUniform(const std::string& name, ref_ptr<Data> data = {}, uint32_t dstArrayElement = 0) { return assignDescriptor(name, data, dstArrayElement); }
@@ -109,6 +115,18 @@ namespace vsg
         uint32_t baseAttributeBinding = 0;
         ref_ptr<ShaderSet> shaderSet;
 
+        /// build pipelines with VK_DYNAMIC_STATE_VIEWPORT/VK_DYNAMIC_STATE_SCISSOR so the viewport and
+        /// scissor are set by the RecordTraversal from the View's camera each frame rather than baked in
+        /// at compile, allowing window resizes to skip pipeline recreation entirely. Set to false before
+        /// calling init() for pipelines that are recorded outside a View with a camera/ViewportState.
+        bool dynamicViewportAndScissor = true;
+
+        /// descriptor sets that should be emitted as vsg::PushDescriptorSet state commands rather than BindDescriptorSet,
+        /// avoiding descriptor pool allocations for descriptors that change at high frequency. Requires the device to
+        /// support VK_KHR_push_descriptor. Assign before calling init() so the associated DescriptorSetLayout can be
+        /// created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR.
+        std::set<uint32_t> pushDescriptorSets;
+
         void reset();
 
         bool enableArray(const std::string& name, VkVertexInputRate vertexInputRate, uint32_t stride, VkFormat format = VK_FORMAT_UNDEFINED);
@@ -118,9 +136,17 @@ namespace vsg
         bool assignArray(DataList& arrays, const std::string& name, VkVertexInputRate vertexInputRate, ref_ptr<Data> array);
         bool assignDescriptor(const std::string& name, ref_ptr<Data> data = {}, uint32_t dstArrayElement = 0);
         bool assignDescriptor(const std::string& name, const BufferInfoList& bufferInfoList, uint32_t dstArrayElement = 0);
+        bool assignCustomDescriptor(const std::string& name, ref_ptr<Descriptor> descriptor);
         bool assignTexture(const std::string& name, ref_ptr<Data> textureData = {}, ref_ptr<Sampler> sampler = {}, uint32_t dstArrayElement = 0);
         bool assignTexture(const std::string& name, const ImageInfoList& imageInfoList, uint32_t dstArrayElement = 0);
 
+        /// assign a value for a specialization constant declared by the ShaderSet, by name. The value is
+        /// folded into the pipeline by the driver from the shared SPIR-V module, so per material feature
+        /// flags specialize the ubershader without the GLSL recompile cost of a define based variant.
+        /// When the binding declares a define it is added to shaderHints so shader code gated on it is
+        /// included. Passing an empty value reverts to the binding's default. Call before init().
+        bool assignSpecializationConstant(const std::string& name, ref_ptr<Data> value);
+
         /// set the inherited state which if compatible can hint the the state setup and copying to avoid setting inherited state local subgraph
         void assignInheritedState(const StateCommands& stateCommands);
 
@@ -132,12 +158,22 @@ namespace vsg
         ref_ptr<ShaderCompileSettings> shaderHints;
         ref_ptr<DescriptorConfigurator> descriptorConfigurator;
         StateCommands inheritedState;
+        ShaderStage::SpecializationConstants specializationConstants;
 
         int compare(const Object& rhs) const override;
 
         /// initialize state objects
         virtual void init();
 
+        /// create a depth only derivative of the initialized graphicsPipeline, with the fragment stage removed and
+        /// color writes disabled, and assign a StateSwitch that binds the depth only pipeline when the recorded
+        /// traversalMask matches depthPrePassMask and the full pipeline when it matches mainPassMask, which defaults
+        /// to the complement of depthPrePassMask so only the depth only variant is bound during the pre-pass replay.
+        /// The StateSwitch takes the place of bindGraphicsPipeline in copyTo(). Call after init(), and assign the
+        /// same depthPrePassMask to View::depthPrePassMask so the pre-pass replay selects the depth only variant.
+        /// Not suitable for alpha tested materials as the fragment stage does not run during the pre-pass.
+        virtual void enableDepthPrePass(Mask depthPrePassMask, Mask mainPassMask = MASK_OFF);
+
         /// convinience function for calling shaderSet->getSuitableArrayState(shaderHints->defines) to return the appropriate ArrayState object
         virtual ref_ptr<ArrayState> getSuitableArrayState() const;
 
@@ -153,6 +189,10 @@ namespace vsg
         ref_ptr<GraphicsPipeline> graphicsPipeline;
         ref_ptr<BindGraphicsPipeline> bindGraphicsPipeline;
 
+        // setup by enableDepthPrePass()
+        ref_ptr<GraphicsPipeline> depthGraphicsPipeline;
+        ref_ptr<StateSwitch> pipelineStateSwitch;
+
     protected:
         void _assignShaderSetSettings();
         void _assignInheritedSets();
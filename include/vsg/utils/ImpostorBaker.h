@@ -0,0 +1,65 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/CommandGraph.h>
+#include <vsg/app/RenderGraph.h>
+#include <vsg/nodes/ImpostorLOD.h>
+#include <vsg/utils/Builder.h>
+
+namespace vsg
+{
+
+    /// ImpostorBaker creates the offscreen rendering setup and camera facing quad used by ImpostorLOD nodes.
+    /// createAtlas() allocates the texture the subgraph is rendered into, createBakeRenderGraph() sets up a
+    /// RenderGraph/Framebuffer that renders the subgraph into the atlas with an orthographic camera fitted to
+    /// its bound, and createImpostor() builds the billboard quad that samples the atlas. The convenience
+    /// bake() method wires these together for an ImpostorLOD, returning a CommandGraph that must be submitted,
+    /// such as by adding it to the Viewer's recordAndSubmitTasks, to render the atlas. The bake runs on the GPU
+    /// alongside normal frames so thousands of distant subgraphs collapse to textured quad batches without
+    /// stalling the main rendering loop.
+    class VSG_DECLSPEC ImpostorBaker : public Inherit<Object, ImpostorBaker>
+    {
+    public:
+        ImpostorBaker();
+
+        /// width and height of the atlas each impostor is baked into
+        uint32_t atlasSize = 256;
+
+        VkFormat colorFormat = VK_FORMAT_R8G8B8A8_UNORM;
+        VkFormat depthFormat = VK_FORMAT_D32_SFLOAT;
+
+        ref_ptr<Options> options;
+
+        /// builder used to create the impostor quads, created on first use when left unassigned
+        ref_ptr<Builder> builder;
+
+        /// create the color attachment the bake RenderGraph renders into and the impostor quad samples
+        ref_ptr<ImageInfo> createAtlas(Device* device) const;
+
+        /// create an offscreen RenderGraph that renders the subgraph into the atlas with an orthographic camera fitted to the bound, looking along the +y axis
+        ref_ptr<RenderGraph> createBakeRenderGraph(Device* device, ref_ptr<ImageInfo> atlas, ref_ptr<Node> subgraph, const dsphere& bound) const;
+
+        /// create the camera facing quad that samples the atlas, centered and scaled to the bound
+        ref_ptr<Node> createImpostor(ref_ptr<ImageInfo> atlas, const dsphere& bound);
+
+        /// create the atlas and impostor quad for the impostorLOD's child and assign the quad to impostorLOD->impostor,
+        /// returning the CommandGraph that renders the atlas, which the caller must submit for at least one frame
+        ref_ptr<CommandGraph> bake(ref_ptr<ImpostorLOD> impostorLOD, ref_ptr<Device> device, int queueFamily);
+
+    protected:
+        virtual ~ImpostorBaker();
+    };
+    VSG_type_name(vsg::ImpostorBaker);
+
+} // namespace vsg
@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/app/Camera.h>
 #include <vsg/utils/Intersector.h>
+#include <vsg/utils/TriangleBVH.h>
 
 namespace vsg
 {
@@ -57,6 +58,11 @@ namespace vsg
         using Intersections = std::vector<ref_ptr<Intersection>>;
         Intersections intersections;
 
+        /// optional cache of lazily built per mesh triangle BVH, assign a cache kept alive across
+        /// picks so repeated queries of large meshes cull triangles hierarchically instead of brute
+        /// forcing every primitive. When unset all triangles are tested.
+        ref_ptr<TriangleBVHCache> bvhCache;
+
         ref_ptr<Intersection> add(const dvec3& coord, double ratio, const IndexRatios& indexRatios, uint32_t instanceIndex);
 
         void pushTransform(const Transform& transform) override;
@@ -0,0 +1,90 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/DatabasePager.h>
+#include <vsg/vk/Device.h>
+#include <vsg/vk/MemoryBufferPools.h>
+
+#include <map>
+
+namespace vsg
+{
+
+    /// MemoryBudgetMonitor tracks the per heap memory budget and usage reported by VK_EXT_memory_budget
+    /// and applies reactive policies when other processes squeeze the device local heaps, so the
+    /// application degrades gracefully rather than silently spilling allocations to host memory.
+    /// While the most loaded device local heap is over pressureThreshold the monitor scales back the
+    /// DatabasePager's targetMaxPagedLODMemory byte budget, releases idle MemoryBufferPools blocks and
+    /// caps the size of new pool blocks; once usage falls back below recoveryThreshold the original
+    /// budgets are restored. Call update() once per frame, typically after Viewer::update(), and use
+    /// budgets/deviceLocalPressure or report() to feed the figures into application telemetry.
+    class VSG_DECLSPEC MemoryBudgetMonitor : public Inherit<Object, MemoryBudgetMonitor>
+    {
+    public:
+        explicit MemoryBudgetMonitor(ref_ptr<Device> in_device);
+
+        ref_ptr<Device> device;
+
+        /// pager whose targetMaxPagedLODMemory byte budget is scaled back under pressure and restored on recovery (optional)
+        ref_ptr<DatabasePager> databasePager;
+
+        /// pools whose idle blocks are released and whose new block sizes are capped under pressure (optional)
+        std::vector<ref_ptr<MemoryBufferPools>> memoryBufferPools;
+
+        /// usage/budget ratio on the most loaded device local heap above which the reactive policies engage
+        double pressureThreshold = 0.9;
+
+        /// usage/budget ratio below which the budgets shrunk under pressure are restored
+        double recoveryThreshold = 0.75;
+
+        /// factor the pager byte budget is multiplied by for each update() spent over pressureThreshold
+        double shrinkFactor = 0.9;
+
+        /// lower bound on the shrunk pager budget, as a fraction of its original value
+        double minimumBudgetFraction = 0.25;
+
+        /// return true when the device's PhysicalDevice supports VK_EXT_memory_budget so update() has figures to act on
+        bool supported() const;
+
+        /// requery the heap budgets and apply/release the reactive policies, call once per frame
+        void update();
+
+        /// the per heap figures from the latest update()
+        PhysicalDevice::MemoryBudgets budgets;
+
+        /// highest usage/budget ratio across the device local heaps from the latest update()
+        double deviceLocalPressure = 0.0;
+
+        /// true while deviceLocalPressure is above pressureThreshold, cleared once it falls below recoveryThreshold
+        bool underPressure = false;
+
+        /// write the latest per heap figures and the policy state, in the style of MemoryBufferPools::report()
+        void report(std::ostream& out) const;
+
+    protected:
+        void _applyPressurePolicies();
+        void _restoreBudgets();
+
+        struct PoolSizes
+        {
+            VkDeviceSize minimumBufferSize = 0;
+            VkDeviceSize minimumDeviceMemorySize = 0;
+        };
+
+        std::size_t _originalPagedLODMemory = 0;
+        std::map<MemoryBufferPools*, PoolSizes> _originalPoolSizes;
+    };
+    VSG_type_name(vsg::MemoryBudgetMonitor);
+
+} // namespace vsg
@@ -0,0 +1,43 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/maths/packed.h>
+
+namespace vsg
+{
+
+    /// Convert a float/vec2/vec3/vec4 array to a half float array, halving (or better) the memory
+    /// and vertex fetch bandwidth of static attributes such as texture coordinates and local space
+    /// positions of small meshes. vec3 input is padded to four components as three component 16 bit
+    /// vertex formats have poor device support. The returned array's Data::properties.format is set
+    /// to the matching VK_FORMAT_R16*_SFLOAT so GraphicsPipelineConfigurator::assignArray and
+    /// ArrayConfigurator::assignArray automatically declare the packed format in the pipeline's
+    /// vertex input state. Returns {} for unsupported input types.
+    extern VSG_DECLSPEC ref_ptr<Data> packHalf(const Data& array);
+
+    /// Convert a float/vec2/vec3/vec4 array with [0, 1] components, such as texture coordinates,
+    /// to a 16 bit unsigned normalized array with Data::properties.format set to the matching
+    /// VK_FORMAT_R16*_UNORM. vec3 input is padded to four components. Values outside [0, 1] are
+    /// clamped. Returns {} for unsupported input types.
+    extern VSG_DECLSPEC ref_ptr<Data> packUnorm16(const Data& array);
+
+    /// Convert a vec3/vec4 array with [-1, 1] components, such as normals and tangents, to a
+    /// uintArray of VK_FORMAT_A2B10G10R10_SNORM_PACK32 values - a quarter/half of the original
+    /// size with ample precision for unit vectors. Data::properties.format is set so the
+    /// configurators declare the packed format automatically. Returns {} for unsupported input
+    /// types.
+    extern VSG_DECLSPEC ref_ptr<Data> packSnorm_A2B10G10R10(const Data& array);
+
+} // namespace vsg
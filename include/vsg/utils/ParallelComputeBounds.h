@@ -0,0 +1,41 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/ComputeBounds.h>
+
+namespace vsg
+{
+
+    /// ParallelComputeBounds is a ComputeBounds variant that fans the subtrees of wide Groups out
+    /// across a set of OperationThreads, each subtree computed by its own seeded ComputeBounds and
+    /// the per subtree bounds unioned into the overall result. The calling thread helps process
+    /// operations while it waits, so large models are bounded at roughly the speed of the available
+    /// cores rather than blocking the calling thread for the full single threaded traversal.
+    class VSG_DECLSPEC ParallelComputeBounds : public Inherit<ComputeBounds, ParallelComputeBounds>
+    {
+    public:
+        explicit ParallelComputeBounds(ref_ptr<OperationThreads> in_operationThreads, ref_ptr<ArrayState> initialArrayState = {});
+
+        /// threads used to process the subtree bounds computations, when not assigned the traversal runs single threaded
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// minimum number of children a Group requires before its subtrees are fanned out rather than traversed inline
+        uint32_t minimumChildrenForFanOut = 2;
+
+        void apply(const Group& group) override;
+    };
+    VSG_type_name(vsg::ParallelComputeBounds);
+
+} // namespace vsg
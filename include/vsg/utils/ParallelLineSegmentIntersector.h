@@ -0,0 +1,45 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/LineSegmentIntersector.h>
+
+namespace vsg
+{
+
+    /// ParallelLineSegmentIntersector is a LineSegmentIntersector variant that fans the subtrees of
+    /// wide Groups out across a set of OperationThreads, each subtree intersected by its own seeded
+    /// intersector and the per subtree intersections merged into the overall list. The calling thread
+    /// helps process operations while it waits, so pick operations on very large models no longer
+    /// block for the full single threaded traversal.
+    ///
+    /// The merged intersections are in a non deterministic order, callers wanting the nearest hit
+    /// should sort by Intersection::ratio as is usual for pick handling.
+    class VSG_DECLSPEC ParallelLineSegmentIntersector : public Inherit<LineSegmentIntersector, ParallelLineSegmentIntersector>
+    {
+    public:
+        ParallelLineSegmentIntersector(const dvec3& s, const dvec3& e, ref_ptr<OperationThreads> in_operationThreads, ref_ptr<ArrayState> initialArrayData = {});
+        ParallelLineSegmentIntersector(const Camera& camera, int32_t x, int32_t y, ref_ptr<OperationThreads> in_operationThreads, ref_ptr<ArrayState> initialArrayData = {});
+
+        /// threads used to process the subtree intersections, when not assigned the traversal runs single threaded
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// minimum number of children a Group requires before its subtrees are fanned out rather than traversed inline
+        uint32_t minimumChildrenForFanOut = 2;
+
+        void apply(const Group& group) override;
+    };
+    VSG_type_name(vsg::ParallelLineSegmentIntersector);
+
+} // namespace vsg
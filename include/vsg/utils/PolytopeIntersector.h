@@ -0,0 +1,93 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/Camera.h>
+#include <vsg/utils/Intersector.h>
+#include <vsg/utils/TriangleBVH.h>
+
+namespace vsg
+{
+
+    /// PolytopeIntersector is an Intersector subclass that computes which primitives lie wholly or
+    /// partially inside one or more convex polytopes, suitable for rubber band selection. Multiple
+    /// polytopes may be queried in a single traversal via addPolytope(), with each Intersection
+    /// recording the polytope that selected it. Assign bvhCache to reuse the per mesh triangle BVH
+    /// shared with LineSegmentIntersector for hierarchical culling of large meshes.
+    class VSG_DECLSPEC PolytopeIntersector : public Inherit<Intersector, PolytopeIntersector>
+    {
+    public:
+        /// a convex polytope defined by planes with normals pointing inwards
+        using Polytope = std::vector<dplane>;
+
+        explicit PolytopeIntersector(const Polytope& polytope, ref_ptr<ArrayState> initialArrayData = {});
+
+        /// construct a polytope from the window space rectangle [xMin, yMin], [xMax, yMax] on the specified camera
+        PolytopeIntersector(const Camera& camera, double xMin, double yMin, double xMax, double yMax, ref_ptr<ArrayState> initialArrayData = {});
+
+        /// add an additional polytope, in the same coordinate frame as the constructor's, to evaluate in the same traversal
+        void addPolytope(const Polytope& polytope);
+
+        class VSG_DECLSPEC Intersection : public Inherit<Object, Intersection>
+        {
+        public:
+            Intersection() {}
+            Intersection(const dvec3& in_localIntersection, const dvec3& in_worldIntersection, const dmat4& in_localToWorld, const NodePath& in_nodePath, const DataList& in_arrays, const std::vector<uint32_t>& in_indices, uint32_t in_instanceIndex, uint32_t in_polytopeIndex);
+
+            dvec3 localIntersection;
+            dvec3 worldIntersection;
+
+            dmat4 localToWorld;
+            NodePath nodePath;
+            DataList arrays;
+
+            /// vertex indices of the intersected primitive
+            std::vector<uint32_t> indices;
+            uint32_t instanceIndex = 0;
+
+            /// index of the polytope, in the order constructed/added, that selected this primitive
+            uint32_t polytopeIndex = 0;
+
+            // return true if Intersection is valid
+            operator bool() const { return !nodePath.empty(); }
+        };
+
+        using Intersections = std::vector<ref_ptr<Intersection>>;
+        Intersections intersections;
+
+        /// optional cache of lazily built per mesh triangle BVH shared with the other intersectors
+        ref_ptr<TriangleBVHCache> bvhCache;
+
+        ref_ptr<Intersection> add(const dvec3& coord, const std::vector<uint32_t>& indices, uint32_t instanceIndex, uint32_t polytopeIndex);
+
+        void pushTransform(const Transform& transform) override;
+        void popTransform() override;
+
+        /// check for intersection with sphere
+        bool intersects(const dsphere& bs) override;
+
+        bool intersectDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+        bool intersectDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+
+    protected:
+        using Polytopes = std::vector<Polytope>;
+
+        /// one set of polytopes per transform level, index 0 is the reference frame the constructor defined
+        std::vector<Polytopes> _polytopeStack;
+
+        /// clip the triangle against the polytope, returning true and the centroid of the clipped polygon when a portion lies inside
+        static bool _triangleInside(const dvec3& v0, const dvec3& v1, const dvec3& v2, const Polytope& polytope, dvec3& centroid);
+    };
+    VSG_type_name(vsg::PolytopeIntersector);
+
+} // namespace vsg
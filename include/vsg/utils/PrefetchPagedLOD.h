@@ -0,0 +1,72 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/DatabasePager.h>
+#include <vsg/ui/FrameStamp.h>
+#include <vsg/utils/LoadPagedLOD.h>
+
+namespace vsg
+{
+    /// Traverse the scene graph issuing speculative, low priority DatabasePager requests for any PagedLOD
+    /// children that the specified view matrix would require, rather than loading them synchronously
+    /// like the LoadPagedLOD base class. Used by DatabasePrefetcher with a predicted view matrix.
+    class VSG_DECLSPEC PrefetchPagedLOD : public LoadPagedLOD
+    {
+    public:
+        PrefetchPagedLOD(ref_ptr<Camera> in_camera, ref_ptr<DatabasePager> in_databasePager, const dmat4& viewMatrix, int in_loadLevels = 30);
+
+        void apply(PagedLOD& plod) override;
+
+        ref_ptr<DatabasePager> databasePager;
+
+        /// scale applied to the screen space error based priority of speculative requests so that
+        /// tiles requested by the record traversal for the actual view are always loaded first.
+        double priorityScale = 0.001;
+    };
+    VSG_type_name(vsg::PrefetchPagedLOD);
+
+    /// DatabasePrefetcher extrapolates camera motion from the frame to frame change in the camera's
+    /// view matrix and issues speculative, low priority DatabasePager requests for the PagedLOD
+    /// children that the predicted view will require, reducing low res popping during fast camera
+    /// movement. Call update() once per frame, typically just before Viewer::recordAndSubmit().
+    class VSG_DECLSPEC DatabasePrefetcher : public Inherit<Object, DatabasePrefetcher>
+    {
+    public:
+        DatabasePrefetcher(ref_ptr<Camera> in_camera, ref_ptr<DatabasePager> in_databasePager, ref_ptr<Node> in_scene);
+
+        ref_ptr<Camera> camera;
+        ref_ptr<DatabasePager> databasePager;
+        ref_ptr<Node> scene;
+
+        /// how far ahead, in seconds, to extrapolate the camera's motion when deciding which tiles to prefetch
+        double lookAheadTime = 1.0;
+
+        /// scale applied to the priority of speculative requests, see PrefetchPagedLOD::priorityScale
+        double priorityScale = 0.001;
+
+        /// number of PagedLOD levels to traverse when prefetching
+        int loadLevels = 30;
+
+        /// predict the view lookAheadTime seconds ahead and traverse the scene issuing speculative requests.
+        /// The prediction extrapolates the eye position only, keeping the current orientation.
+        void update(const FrameStamp& frameStamp);
+
+    protected:
+        dmat4 _previousView;
+        time_point _previousTime;
+        bool _hasPrevious = false;
+    };
+    VSG_type_name(vsg::DatabasePrefetcher);
+
+} // namespace vsg
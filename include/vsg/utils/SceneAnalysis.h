@@ -0,0 +1,125 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/ConstVisitor.h>
+#include <vsg/core/Visitor.h>
+#include <vsg/nodes/InstrumentationNode.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace vsg
+{
+
+    /// SceneAnalysis traverses a scene graph gathering the statistics needed to diagnose a scene's record
+    /// cost without a live viewer: node counts by type, state change counts, group fan-out, the transform
+    /// nesting depth distribution, and an estimated per-frame record cost attributed to each subgraph using
+    /// simple per node type cost weights. Use report() for a human readable summary, or subgraphCosts to
+    /// drive tooling such as InstrumentExpensiveSubgraphs.
+    class VSG_DECLSPEC SceneAnalysis : public Inherit<ConstVisitor, SceneAnalysis>
+    {
+    public:
+        SceneAnalysis();
+
+        /// when true the estimated subtree record cost of every Node is recorded in subgraphCosts,
+        /// when false only the aggregate statistics are gathered
+        bool collectSubgraphCosts = true;
+
+        /// gathered statistics
+        std::map<std::string, uint64_t> typeCounts;
+        uint64_t numNodes = 0;
+        uint64_t numGroups = 0;
+        uint64_t totalGroupChildren = 0;
+        uint64_t numTransforms = 0;
+        uint64_t numStateGroups = 0;
+        uint64_t numStateCommands = 0;
+        uint64_t numCommands = 0;
+        uint64_t numCullNodes = 0;
+
+        /// transformDepthHistogram[depth] is the number of transforms encountered at that transform nesting depth
+        std::vector<uint64_t> transformDepthHistogram;
+
+        /// estimated record cost of each node's subtree in arbitrary units, filled in when collectSubgraphCosts is true
+        std::map<const Node*, double> subgraphCosts;
+
+        /// estimated record cost of the whole traversed scene
+        double totalCost = 0.0;
+
+        double averageChildrenPerGroup() const { return (numGroups > 0) ? static_cast<double>(totalGroupChildren) / static_cast<double>(numGroups) : 0.0; }
+
+        /// write a human readable summary of the gathered statistics, including the topK most expensive subgraphs
+        void report(std::ostream& out, size_t topK = 10) const;
+
+    public:
+        void apply(const Object& object) override;
+        void apply(const Node& node) override;
+        void apply(const Group& group) override;
+        void apply(const StateGroup& stateGroup) override;
+        void apply(const Transform& transform) override;
+        void apply(const CullNode& cullNode) override;
+        void apply(const CullGroup& cullGroup) override;
+        void apply(const LOD& lod) override;
+        void apply(const PagedLOD& plod) override;
+        void apply(const Command& command) override;
+        void apply(const StateCommand& stateCommand) override;
+        void apply(const Geometry& geometry) override;
+        void apply(const VertexDraw& vd) override;
+        void apply(const VertexIndexDraw& vid) override;
+
+    protected:
+        /// count the object, add its self cost, traverse its subgraph and attribute the subtree cost to it
+        void applyNode(const Object& object, double selfCost);
+
+        double _currentCost = 0.0;
+        uint32_t _transformDepth = 0;
+    };
+    VSG_type_name(vsg::SceneAnalysis);
+
+    /// InstrumentExpensiveSubgraphs wraps the most expensive subgraphs of a scene, as estimated by
+    /// SceneAnalysis, in named InstrumentationNode so their real per-frame record times can be sampled by
+    /// whatever Instrumentation implementation the viewer is running - Profiler, FrameStatsCollector etc.
+    /// Wrapped subgraphs are not descended into, so nested candidates resolve to the outermost selection.
+    class VSG_DECLSPEC InstrumentExpensiveSubgraphs : public Inherit<Visitor, InstrumentExpensiveSubgraphs>
+    {
+    public:
+        InstrumentExpensiveSubgraphs();
+
+        /// number of subgraphs to wrap
+        size_t topK = 8;
+
+        /// subgraphs whose estimated cost exceeds this fraction of the whole scene's cost are skipped,
+        /// keeping the near root nodes that dominate by construction from consuming the topK slots
+        double maxCostFraction = 0.5;
+
+        /// level assigned to the inserted InstrumentationNodes
+        uint32_t level = 1;
+
+        /// the InstrumentationNodes inserted by the last call to instrument()
+        std::vector<ref_ptr<InstrumentationNode>> insertedNodes;
+
+        /// analyse the scene, select the topK most expensive subgraphs and wrap them in InstrumentationNode
+        void instrument(ref_ptr<Node> scene);
+
+    public:
+        void apply(Group& group) override;
+
+    protected:
+        ref_ptr<Node> wrapIfSelected(ref_ptr<Node> node);
+
+        std::set<const Node*> _selected;
+    };
+    VSG_type_name(vsg::InstrumentExpensiveSubgraphs);
+
+} // namespace vsg
@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/compare.h>
+#include <vsg/core/observer_ptr.h>
 #include <vsg/state/ArrayState.h>
 #include <vsg/state/GraphicsPipeline.h>
 #include <vsg/state/Sampler.h>
@@ -46,6 +47,9 @@ namespace vsg
         VkShaderStageFlags stageFlags = 0;
         ref_ptr<Data> data;
 
+        /// optional VK_EXT_descriptor_indexing flags, i.e. VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT for bindless texture arrays
+        VkDescriptorBindingFlags bindingFlags = 0;
+
         int compare(const DescriptorBinding& rhs) const;
 
         explicit operator bool() const noexcept { return !name.empty(); }
@@ -62,6 +66,19 @@ namespace vsg
     };
     VSG_type_name(vsg::PushConstantRange);
 
+    struct VSG_DECLSPEC SpecializationConstantBinding
+    {
+        std::string name;
+        std::string define;
+        uint32_t constantID = 0;
+        ref_ptr<Data> defaultValue;
+
+        int compare(const SpecializationConstantBinding& rhs) const;
+
+        explicit operator bool() const noexcept { return !name.empty(); }
+    };
+    VSG_type_name(vsg::SpecializationConstantBinding);
+
     struct VSG_DECLSPEC DefinesArrayState
     {
         std::set<std::string> defines;
@@ -120,6 +137,7 @@ namespace vsg
         std::vector<AttributeBinding> attributeBindings;
         std::vector<DescriptorBinding> descriptorBindings;
         std::vector<PushConstantRange> pushConstantRanges;
+        std::vector<SpecializationConstantBinding> specializationConstantBindings;
         std::vector<DefinesArrayState> definesArrayStates; // put more constrained ArrayState matches first so they are matched first.
         std::set<std::string> optionalDefines;
         GraphicsPipelineStates defaultGraphicsPipelineStates;
@@ -138,11 +156,21 @@ namespace vsg
         /// add an uniform binding. Not thread safe, should only be called when initially setting up the ShaderSet
         void addDescriptorBinding(const std::string& name, const std::string& define, uint32_t set, uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags, ref_ptr<Data> data);
 
+        /// add a descriptor binding with VK_EXT_descriptor_indexing binding flags, i.e. a partially bound texture array. Not thread safe, should only be called when initially setting up the ShaderSet
+        void addDescriptorBinding(const std::string& name, const std::string& define, uint32_t set, uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags, ref_ptr<Data> data, VkDescriptorBindingFlags bindingFlags);
+
         [[deprecated("use addDescriptorBinding(..)")]] void addUniformBinding(const std::string& name, const std::string& define, uint32_t set, uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags, ref_ptr<Data> data) { addDescriptorBinding(name, define, set, binding, descriptorType, descriptorCount, stageFlags, data); }
 
         /// add a push constant range. Not thread safe, should only be called when initially setting up the ShaderSet
         void addPushConstantRange(const std::string& name, const std::string& define, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size);
 
+        /// add a specialization constant that the shaders read in place of a runtime uniform or branch, so
+        /// per material feature flags are folded into the pipeline by the driver from a single SPIR-V module
+        /// rather than compiling a GLSL variant per combination - see
+        /// GraphicsPipelineConfigurator::assignSpecializationConstant(). Not thread safe, should only be
+        /// called when initially setting up the ShaderSet
+        void addSpecializationConstantBinding(const std::string& name, const std::string& define, uint32_t constantID, ref_ptr<Data> defaultValue);
+
         /// get the AttributeBinding associated with name
         AttributeBinding& getAttributeBinding(const std::string& name);
 
@@ -159,12 +187,28 @@ namespace vsg
 
         [[deprecated("use getDescriptorBinding(..)")]] const DescriptorBinding& getUnifomrBinding(const std::string& name) const { return getDescriptorBinding(name); }
 
+        /// get the SpecializationConstantBinding associated with name
+        SpecializationConstantBinding& getSpecializationConstantBinding(const std::string& name);
+
+        /// get the const SpecializationConstantBinding associated with name
+        const SpecializationConstantBinding& getSpecializationConstantBinding(const std::string& name) const;
+
         /// get the first ArrayState that has matches with defines in the specified list of defines.
         ref_ptr<ArrayState> getSuitableArrayState(const std::set<std::string>& defines) const;
 
         /// get the ShaderStages variant that uses specified ShaderCompileSettings.
         ShaderStages getShaderStages(ref_ptr<ShaderCompileSettings> scs = {});
 
+        /// enumerate combinations of the defines declared by the attribute/descriptor bindings and
+        /// optionalDefines, in order of increasing number of enabled defines and capped at
+        /// maxCombinations, for pre-compiling likely pipeline variants - see ShaderSetWarmup.
+        std::vector<std::set<std::string>> enumerateDefineCombinations(size_t maxCombinations = 64) const;
+
+        /// return the pipeline that subsequent pipeline variants created from this ShaderSet should derive from,
+        /// or an empty ref_ptr when the passed in pipeline has been adopted as the base - in which case it is
+        /// flagged with VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT. Thread safe.
+        ref_ptr<GraphicsPipeline> getOrAssignBasePipeline(ref_ptr<GraphicsPipeline> pipeline);
+
         /// return the <minimum_set, maximum_set+1> range of set numbers encompassing DescriptorBindings
         std::pair<uint32_t, uint32_t> descriptorSetRange() const;
 
@@ -197,6 +241,10 @@ namespace vsg
 
         AttributeBinding _nullAttributeBinding;
         DescriptorBinding _nullDescriptorBinding;
+        SpecializationConstantBinding _nullSpecializationConstantBinding;
+
+        /// first pipeline created from this ShaderSet, observed so pipeline variants can be linked to it as derivatives
+        observer_ptr<GraphicsPipeline> _basePipeline;
     };
     VSG_type_name(vsg::ShaderSet);
 
@@ -0,0 +1,58 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/CompileManager.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/ShaderSet.h>
+
+namespace vsg
+{
+
+    /// ShaderSetWarmup pre-compiles the likely graphics pipeline variants of a set of ShaderSets so
+    /// material variants streaming in mid-session hit the driver's pipeline cache and the ShaderSet's
+    /// variants map instead of hitching the frame. Variants are enumerated from each ShaderSet's
+    /// declared define combinations via ShaderSet::enumerateDefineCombinations() and compiled through
+    /// the CompileManager, either on the calling thread via run() or on background threads, typically
+    /// during a loading screen, via schedule().
+    class VSG_DECLSPEC ShaderSetWarmup : public Inherit<Operation, ShaderSetWarmup>
+    {
+    public:
+        explicit ShaderSetWarmup(ref_ptr<CompileManager> in_compileManager, ref_ptr<ActivityStatus> in_status = {});
+
+        /// maximum number of define combinations compiled per ShaderSet
+        size_t maxVariantsPerShaderSet = 64;
+
+        ref_ptr<CompileManager> compileManager;
+
+        /// optional status used to abandon the warm up early, e.g. on application shutdown
+        ref_ptr<ActivityStatus> status;
+
+        /// add a ShaderSet whose pipeline variants should be pre-compiled
+        void add(ref_ptr<ShaderSet> shaderSet);
+
+        /// enqueue this warm up on background threads, typically the viewer's operationThreads
+        void schedule(ref_ptr<OperationThreads> operationThreads);
+
+        /// compile the queued variants, checking status between variants
+        void run() override;
+
+    protected:
+        void warmup(ref_ptr<ShaderSet> shaderSet);
+
+        std::mutex _mutex;
+        std::vector<ref_ptr<ShaderSet>> _shaderSets;
+    };
+    VSG_type_name(vsg::ShaderSetWarmup);
+
+} // namespace vsg
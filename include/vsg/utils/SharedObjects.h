@@ -12,10 +12,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/ConstVisitor.h>
 #include <vsg/core/Inherit.h>
 #include <vsg/core/compare.h>
 #include <vsg/io/stream.h>
 
+#include <array>
 #include <map>
 #include <mutex>
 #include <ostream>
@@ -27,6 +29,26 @@ namespace vsg
     // forward declare
     class SuitableForSharing;
 
+    /// ConstVisitor that computes a shallow FNV-1a content hash of an object, used by SharedObjects to
+    /// select the bucket an object is deduplicated in so that concurrent share() calls on objects with
+    /// different contents don't contend on a single mutex. The hash only routes objects to buckets -
+    /// equality is still decided by compare() - so it just has to be deterministic for a given object's
+    /// contents and derived only from the properties compare() uses as the identity. Types without an
+    /// explicit hash fall back to hashing the type name alone, which keeps all their instances in one bucket.
+    class VSG_DECLSPEC HashVisitor : public Inherit<ConstVisitor, HashVisitor>
+    {
+    public:
+        uint64_t hash = 0xcbf29ce484222325ULL;
+
+        void hashBytes(const void* data, std::size_t size);
+        void hashString(const std::string& str);
+
+        void apply(const Object& object) override;
+        void apply(const Data& data) override;
+        void apply(const ShaderStage& shaderStage) override;
+    };
+    VSG_type_name(vsg::HashVisitor);
+
     /// class for facilitating the sharing of instances of objects that have the same properties.
     class VSG_DECLSPEC SharedObjects : public Inherit<Object, SharedObjects>
     {
@@ -75,9 +97,22 @@ namespace vsg
     protected:
         virtual ~SharedObjects();
 
-        mutable std::recursive_mutex _mutex;
+        /// number of independently locked buckets the shared objects are distributed across by content hash,
+        /// so concurrent share() calls on different types/hashes don't contend
+        static constexpr std::size_t numBuckets = 16;
+
+        struct Bucket
+        {
+            std::mutex mutex;
+            std::map<std::type_index, std::set<ref_ptr<Object>, DereferenceLess>> sharedObjects;
+        };
+
+        /// select the bucket for an object from its content hash, LoadedObjects are routed by filename
+        Bucket& _bucket(const Object& object) const;
+
+        mutable std::recursive_mutex _mutex; // guards _defaults
         std::map<std::type_index, ref_ptr<Object>> _defaults;
-        std::map<std::type_index, std::set<ref_ptr<Object>, DereferenceLess>> _sharedObjects;
+        mutable std::array<Bucket, numBuckets> _buckets;
     };
     VSG_type_name(vsg::SharedObjects);
 
@@ -114,12 +149,17 @@ namespace vsg
         void apply(const Object& object) override;
         void apply(const PagedLOD& plod) override;
 
+        /// thread safe check of an object, serialized internally as share() no longer holds a global lock
         bool suitable(const Object* object)
         {
+            std::scoped_lock<std::mutex> lock(_mutex);
             suitableForSharing = true;
             if (object) object->accept(*this);
             return suitableForSharing;
         }
+
+    protected:
+        std::mutex _mutex;
     };
     VSG_type_name(vsg::SuitableForSharing);
 
@@ -135,7 +175,11 @@ namespace vsg
         if (!def_T)
         {
             def_T = T::create();
-            auto& shared_objects = _sharedObjects[id];
+
+            auto& bucket = _bucket(*def_T);
+            std::scoped_lock<std::mutex> bucketLock(bucket.mutex);
+
+            auto& shared_objects = bucket.sharedObjects[id];
             if (auto itr = shared_objects.find(def_T); itr != shared_objects.end())
             {
                 def_T = (static_cast<T*>(itr->get()));
@@ -155,12 +199,13 @@ namespace vsg
     template<class T>
     void SharedObjects::share(ref_ptr<T>& object)
     {
-        std::scoped_lock<std::recursive_mutex> lock(_mutex);
-
         if (suitableForSharing && !suitableForSharing->suitable(object.get())) return;
 
+        auto& bucket = _bucket(*object);
+        std::scoped_lock<std::mutex> lock(bucket.mutex);
+
         auto id = std::type_index(typeid(T));
-        auto& shared_objects = _sharedObjects[id];
+        auto& shared_objects = bucket.sharedObjects[id];
         if (auto itr = shared_objects.find(object); itr != shared_objects.end())
         {
             object = ref_ptr<T>(static_cast<T*>(itr->get()));
@@ -174,11 +219,13 @@ namespace vsg
     template<class T, typename Func>
     void SharedObjects::share(ref_ptr<T>& object, Func init)
     {
+        auto id = std::type_index(typeid(T));
+
         {
-            std::scoped_lock<std::recursive_mutex> lock(_mutex);
+            auto& bucket = _bucket(*object);
+            std::scoped_lock<std::mutex> lock(bucket.mutex);
 
-            auto id = std::type_index(typeid(T));
-            auto& shared_objects = _sharedObjects[id];
+            auto& shared_objects = bucket.sharedObjects[id];
             if (auto itr = shared_objects.find(object); itr != shared_objects.end())
             {
                 object = ref_ptr<T>(static_cast<T*>(itr->get()));
@@ -189,9 +236,19 @@ namespace vsg
         init(object);
 
         {
-            std::scoped_lock<std::recursive_mutex> lock(_mutex);
-            auto id = std::type_index(typeid(T));
-            auto& shared_objects = _sharedObjects[id];
+            auto& bucket = _bucket(*object);
+            std::scoped_lock<std::mutex> lock(bucket.mutex);
+
+            auto& shared_objects = bucket.sharedObjects[id];
+
+            // another thread may have initialized and shared an equivalent object while init was
+            // running unlocked, in which case adopt it so all callers end up with the same instance.
+            if (auto itr = shared_objects.find(object); itr != shared_objects.end())
+            {
+                object = ref_ptr<T>(static_cast<T*>(itr->get()));
+                return;
+            }
+
             if (suitableForSharing && suitableForSharing->suitable(object.get()))
             {
                 shared_objects.insert(object);
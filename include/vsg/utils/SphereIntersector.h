@@ -0,0 +1,94 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/utils/Intersector.h>
+#include <vsg/utils/TriangleBVH.h>
+
+namespace vsg
+{
+
+    /// SphereIntersector is an Intersector subclass that computes which primitives lie within a set
+    /// of query spheres, suitable for proximity queries. Multiple spheres may be queried in a single
+    /// traversal via addSphere(), with each Intersection recording the sphere that selected it and
+    /// the closest point on the primitive. Assign bvhCache to reuse the per mesh triangle BVH shared
+    /// with the other intersectors for hierarchical culling of large meshes.
+    class VSG_DECLSPEC SphereIntersector : public Inherit<Intersector, SphereIntersector>
+    {
+    public:
+        SphereIntersector(const dvec3& center, double radius, ref_ptr<ArrayState> initialArrayData = {});
+        explicit SphereIntersector(const dsphere& sphere, ref_ptr<ArrayState> initialArrayData = {});
+
+        /// add an additional sphere, in the same coordinate frame as the constructor's, to evaluate in the same traversal
+        void addSphere(const dsphere& sphere);
+
+        class VSG_DECLSPEC Intersection : public Inherit<Object, Intersection>
+        {
+        public:
+            Intersection() {}
+            Intersection(const dvec3& in_localIntersection, const dvec3& in_worldIntersection, double in_distance, const dmat4& in_localToWorld, const NodePath& in_nodePath, const DataList& in_arrays, const std::vector<uint32_t>& in_indices, uint32_t in_instanceIndex, uint32_t in_sphereIndex);
+
+            /// closest point on the primitive to the sphere center, in local and world coordinates
+            dvec3 localIntersection;
+            dvec3 worldIntersection;
+
+            /// distance from the sphere center to the closest point, in the reference frame of the sphere
+            double distance = 0.0;
+
+            dmat4 localToWorld;
+            NodePath nodePath;
+            DataList arrays;
+
+            /// vertex indices of the intersected primitive
+            std::vector<uint32_t> indices;
+            uint32_t instanceIndex = 0;
+
+            /// index of the sphere, in the order constructed/added, that selected this primitive
+            uint32_t sphereIndex = 0;
+
+            // return true if Intersection is valid
+            operator bool() const { return !nodePath.empty(); }
+        };
+
+        using Intersections = std::vector<ref_ptr<Intersection>>;
+        Intersections intersections;
+
+        /// optional cache of lazily built per mesh triangle BVH shared with the other intersectors
+        ref_ptr<TriangleBVHCache> bvhCache;
+
+        ref_ptr<Intersection> add(const dvec3& coord, double distance, const std::vector<uint32_t>& indices, uint32_t instanceIndex, uint32_t sphereIndex);
+
+        void pushTransform(const Transform& transform) override;
+        void popTransform() override;
+
+        /// check for intersection with sphere
+        bool intersects(const dsphere& bs) override;
+
+        bool intersectDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+        bool intersectDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+
+    protected:
+        using Spheres = std::vector<dsphere>;
+
+        /// one set of spheres per transform level, index 0 is the reference frame the constructor defined
+        std::vector<Spheres> _sphereStack;
+
+        /// uniform scale factor applied to the sphere radii by a worldToLocal matrix, conservative for non uniform scales
+        static double _radiusScale(const dmat4& worldToLocal);
+
+        /// closest point on the triangle [v0, v1, v2] to the point p
+        static dvec3 _closestPointOnTriangle(const dvec3& p, const dvec3& v0, const dvec3& v1, const dvec3& v2);
+    };
+    VSG_type_name(vsg::SphereIntersector);
+
+} // namespace vsg
@@ -0,0 +1,227 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/core/Inherit.h>
+#include <vsg/maths/box.h>
+#include <vsg/maths/plane.h>
+
+#include <map>
+#include <mutex>
+
+namespace vsg
+{
+
+    /// TriangleBVH is a flat axis aligned bounding volume hierarchy over the triangles of a mesh,
+    /// used by the intersectors to cull whole subtrees of triangles against a line segment instead
+    /// of brute forcing every primitive. Built once per vertex/index array combination and reusable
+    /// across queries - see TriangleBVHCache for lazy build and reuse across repeated picks.
+    class VSG_DECLSPEC TriangleBVH : public Inherit<Object, TriangleBVH>
+    {
+    public:
+        /// build a BVH over an indexed triangle list, one of ushort_indices/uint_indices may be null,
+        /// when both are null the range firstIndex/indexCount addresses the vertices array directly
+        static ref_ptr<TriangleBVH> build(ref_ptr<const vec3Array> vertices,
+                                          ref_ptr<const ushortArray> ushort_indices, ref_ptr<const uintArray> uint_indices,
+                                          uint32_t firstIndex, uint32_t indexCount);
+
+        /// interior nodes reference their pair of children, leaf nodes a run of triangles
+        struct BVHNode
+        {
+            box bounds;
+            uint32_t index = 0; /// leaf: first triangle, interior: first child, second child is index + 1
+            uint32_t count = 0; /// number of triangles in a leaf, 0 for interior nodes
+        };
+
+        std::vector<BVHNode> nodes;
+
+        /// vertex indices of the triangles, three entries per triangle, reordered so each leaf's run is contiguous
+        std::vector<uint32_t> triangleIndices;
+
+        size_t numTriangles() const { return triangleIndices.size() / 3; }
+
+        /// traverse the hierarchy, invoking callback(i0, i1, i2) for every triangle in a leaf whose bounds the segment passes through
+        template<class F>
+        void intersect(const dvec3& start, const dvec3& end, F&& callback) const
+        {
+            const dvec3 direction = end - start;
+            _traverse([&](const box& bounds) { return _intersects(bounds, start, direction); }, callback);
+        }
+
+        /// traverse the hierarchy, invoking callback(i0, i1, i2) for every triangle in a leaf whose bounds the sphere overlaps
+        template<class F>
+        void intersectSphere(const dvec3& center, double radius, F&& callback) const
+        {
+            _traverse([&](const box& bounds) { return _intersects(bounds, center, radius); }, callback);
+        }
+
+        /// traverse the hierarchy, invoking callback(i0, i1, i2) for every triangle in a leaf whose bounds the convex
+        /// polytope, defined by planes with normals pointing inwards, wholly or partially contains
+        template<class F>
+        void intersectPolytope(const std::vector<dplane>& polytope, F&& callback) const
+        {
+            _traverse([&](const box& bounds) { return _intersects(bounds, polytope); }, callback);
+        }
+
+    protected:
+        template<class BoundsTest, class F>
+        void _traverse(BoundsTest&& boundsTest, F&& callback) const
+        {
+            if (nodes.empty()) return;
+
+            uint32_t stack[64];
+            uint32_t stackSize = 0;
+            stack[stackSize++] = 0;
+
+            while (stackSize > 0)
+            {
+                const auto& node = nodes[stack[--stackSize]];
+                if (!boundsTest(node.bounds)) continue;
+
+                if (node.count > 0)
+                {
+                    const uint32_t* itr = triangleIndices.data() + size_t(node.index) * 3;
+                    for (uint32_t i = 0; i < node.count; ++i, itr += 3)
+                    {
+                        callback(itr[0], itr[1], itr[2]);
+                    }
+                }
+                else if (stackSize + 2 <= 64)
+                {
+                    stack[stackSize++] = node.index;
+                    stack[stackSize++] = node.index + 1;
+                }
+            }
+        }
+
+        /// squared distance from the sphere center to the box compared against the squared radius
+        static bool _intersects(const box& bounds, const dvec3& center, double radius)
+        {
+            double distance2 = 0.0;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                double v = center[axis];
+                if (v < double(bounds.min[axis]))
+                {
+                    double d = double(bounds.min[axis]) - v;
+                    distance2 += d * d;
+                }
+                else if (v > double(bounds.max[axis]))
+                {
+                    double d = v - double(bounds.max[axis]);
+                    distance2 += d * d;
+                }
+            }
+            return distance2 <= radius * radius;
+        }
+
+        /// conservative box vs convex polytope test - reject when the box's most inside corner lies outside any plane
+        static bool _intersects(const box& bounds, const std::vector<dplane>& polytope)
+        {
+            for (const auto& pl : polytope)
+            {
+                dvec3 corner(pl.n.x >= 0.0 ? double(bounds.max.x) : double(bounds.min.x),
+                             pl.n.y >= 0.0 ? double(bounds.max.y) : double(bounds.min.y),
+                             pl.n.z >= 0.0 ? double(bounds.max.z) : double(bounds.min.z));
+                if (distance(pl, corner) < 0.0) return false;
+            }
+            return true;
+        }
+
+        /// slab test of the parametric segment start + t * direction, t in [0, 1], against the node bounds
+        static bool _intersects(const box& bounds, const dvec3& start, const dvec3& direction)
+        {
+            double tmin = 0.0;
+            double tmax = 1.0;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                double bmin = double(bounds.min[axis]);
+                double bmax = double(bounds.max[axis]);
+                if (direction[axis] != 0.0)
+                {
+                    double inv = 1.0 / direction[axis];
+                    double t0 = (bmin - start[axis]) * inv;
+                    double t1 = (bmax - start[axis]) * inv;
+                    if (t0 > t1) std::swap(t0, t1);
+                    if (t0 > tmin) tmin = t0;
+                    if (t1 < tmax) tmax = t1;
+                    if (tmin > tmax) return false;
+                }
+                else if (start[axis] < bmin || start[axis] > bmax)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+    VSG_type_name(vsg::TriangleBVH);
+
+    /// TriangleBVHCache is a thread safe side table mapping vertex/index array combinations to
+    /// lazily built TriangleBVH, revalidated against the arrays' ModifiedCount so edited meshes are
+    /// rebuilt on the next query. Keep one cache alive across picks - typically assigned to
+    /// LineSegmentIntersector::bvhCache - so repeated picks of large meshes skip both the brute
+    /// force triangle loop and the rebuild.
+    class VSG_DECLSPEC TriangleBVHCache : public Inherit<Object, TriangleBVHCache>
+    {
+    public:
+        TriangleBVHCache();
+
+        /// meshes with fewer triangles than this are left to the brute force path, where a BVH costs more than it saves
+        uint32_t minimumTriangles = 256;
+
+        /// return the cached BVH for the arrays, building or rebuilding it when absent or modified,
+        /// or null for meshes below the minimumTriangles threshold
+        ref_ptr<TriangleBVH> getOrBuild(ref_ptr<const vec3Array> vertices,
+                                        ref_ptr<const ushortArray> ushort_indices, ref_ptr<const uintArray> uint_indices,
+                                        uint32_t firstIndex, uint32_t indexCount);
+
+        /// remove entries whose arrays are no longer referenced outside the cache
+        void prune();
+
+        /// remove all entries
+        void clear();
+
+    protected:
+        struct Key
+        {
+            const Data* vertices = nullptr;
+            const Data* indices = nullptr;
+            uint32_t first = 0;
+            uint32_t count = 0;
+
+            bool operator<(const Key& rhs) const
+            {
+                if (vertices != rhs.vertices) return vertices < rhs.vertices;
+                if (indices != rhs.indices) return indices < rhs.indices;
+                if (first != rhs.first) return first < rhs.first;
+                return count < rhs.count;
+            }
+        };
+
+        struct Entry
+        {
+            ref_ptr<TriangleBVH> bvh;
+            ref_ptr<const Data> vertices;
+            ref_ptr<const Data> indices;
+            ModifiedCount verticesModified;
+            ModifiedCount indicesModified;
+        };
+
+        std::mutex _mutex;
+        std::map<Key, Entry> _entries;
+    };
+    VSG_type_name(vsg::TriangleBVHCache);
+
+} // namespace vsg
@@ -33,6 +33,11 @@ namespace vsg
         std::atomic_uint& numDependentSubmissions() { return _numDependentSubmissions; }
 
         const uint32_t deviceID;
+
+        /// the Device's dispatch table of core Vulkan commands fetched via vkGetDeviceProcAddr, used by
+        /// the record hot paths so per call loader trampoline and dispatch overhead is bypassed.
+        const DeviceDispatch* dispatch;
+
         uint32_t viewID = 0;
         Mask traversalMask = MASK_ALL;
         Mask overrideMask = MASK_OFF;
@@ -40,7 +45,7 @@ namespace vsg
 
         VkCommandBufferLevel level() const { return _level; }
 
-        /// reset the CommandBuffer for the new frame.
+        /// reset the CommandBuffer for the new frame by resetting its dedicated CommandPool, retaining the pool's allocations for reuse.
         void reset();
 
         Device* getDevice() { return _device; }
@@ -61,6 +66,48 @@ namespace vsg
         VkPipelineLayout getCurrentPipelineLayout() const { return _currentPipelineLayout; }
         VkShaderStageFlags getCurrentPushConstantStageFlags() const { return _currentPushConstantStageFlags; }
 
+        /// record the specified index buffer binding as current, returning false when it matches the binding
+        /// already current so the vkCmdBindIndexBuffer call can be elided.
+        bool assignIndexBufferBinding(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType)
+        {
+            if (buffer == _currentIndexBuffer && offset == _currentIndexBufferOffset && indexType == _currentIndexType) return false;
+            _currentIndexBuffer = buffer;
+            _currentIndexBufferOffset = offset;
+            _currentIndexType = indexType;
+            return true;
+        }
+
+        /// record the specified vertex buffer bindings as current, returning false when they all match the
+        /// bindings already current so the vkCmdBindVertexBuffers call can be elided. Geometry that the
+        /// MemoryBufferPools packed into the same VkBuffer then only pays for its first bind.
+        bool assignVertexBufferBindings(uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* buffers, const VkDeviceSize* offsets)
+        {
+            if (firstBinding + bindingCount > _vertexBufferBindings.size()) _vertexBufferBindings.resize(firstBinding + bindingCount, {VK_NULL_HANDLE, 0});
+
+            bool changed = false;
+            auto itr = _vertexBufferBindings.begin() + firstBinding;
+            for (uint32_t i = 0; i < bindingCount; ++i, ++itr)
+            {
+                if (itr->first != buffers[i] || itr->second != offsets[i])
+                {
+                    itr->first = buffers[i];
+                    itr->second = offsets[i];
+                    changed = true;
+                }
+            }
+            return changed;
+        }
+
+        /// mark the tracked vertex and index buffer bindings as unknown, used after commands such as
+        /// vkCmdExecuteCommands that leave the command buffer's bound state undefined.
+        void invalidateBufferBindings()
+        {
+            _currentIndexBuffer = VK_NULL_HANDLE;
+            _currentIndexBufferOffset = 0;
+            _currentIndexType = VK_INDEX_TYPE_MAX_ENUM;
+            _vertexBufferBindings.clear();
+        }
+
         ref_ptr<ScratchMemory> scratchMemory;
 
     protected:
@@ -77,6 +124,11 @@ namespace vsg
         ref_ptr<CommandPool> _commandPool;
         VkPipelineLayout _currentPipelineLayout;
         VkShaderStageFlags _currentPushConstantStageFlags;
+
+        VkBuffer _currentIndexBuffer = VK_NULL_HANDLE;
+        VkDeviceSize _currentIndexBufferOffset = 0;
+        VkIndexType _currentIndexType = VK_INDEX_TYPE_MAX_ENUM;
+        std::vector<std::pair<VkBuffer, VkDeviceSize>> _vertexBufferBindings;
     };
     VSG_type_name(vsg::CommandBuffer);
 
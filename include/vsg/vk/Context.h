@@ -30,6 +30,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/Fence.h>
 #include <vsg/vk/MemoryBufferPools.h>
 #include <vsg/vk/ResourceRequirements.h>
+#include <vsg/vk/SyncObjectPool.h>
 
 namespace vsg
 {
@@ -81,6 +82,11 @@ namespace vsg
         Mask mask = MASK_ALL;
         ViewDependentState* viewDependentState = nullptr;
 
+        /// number of frames the viewer keeps in flight, assigned from Viewer::framesInFlight so that per frame
+        /// rings created during compile, such as DynamicUniformRing regions and OcclusionQueryNode query pools,
+        /// are sized consistently with the RecordAndSubmitTask's fence and staging rings.
+        uint32_t framesInFlight = 3;
+
         /// get existing ShaderCompiler or create a new one when GLSLang is supported
         ShaderCompiler* getOrCreateShaderCompiler();
 
@@ -95,6 +101,19 @@ namespace vsg
         /// allocate or reuse a DescriptorSet::Implementation from the available DescriptorPool
         ref_ptr<DescriptorSet::Implementation> allocateDescriptorSet(DescriptorSetLayout* descriptorSetLayout);
 
+        /// accumulate the VkWriteDescriptorSet entries for the specified descriptor set so that all the sets
+        /// compiled in a traversal are applied in large batches rather than one vkUpdateDescriptorSets call per set.
+        /// The entries and the arrays they point to are built in the dedicated descriptorScratchMemory so that
+        /// interleaved users of the shared scratchMemory don't invalidate them before the flush.
+        void batchDescriptorWrites(VkDescriptorSet descriptorSet, const Descriptors& descriptors);
+
+        /// apply all the accumulated descriptor writes in a single vkUpdateDescriptorSets call, called by record().
+        void flushDescriptorWrites();
+
+        /// descriptor writes accumulated by batchDescriptorWrites() awaiting the next flushDescriptorWrites()
+        std::vector<VkWriteDescriptorSet> descriptorWrites;
+        ref_ptr<ScratchMemory> descriptorScratchMemory;
+
         /// reserve resources that may be needed during compile traversal.
         void reserve(const ResourceRequirements& requirements);
 
@@ -126,6 +145,7 @@ namespace vsg
         ref_ptr<Queue> graphicsQueue;
         ref_ptr<CommandPool> commandPool;
         ref_ptr<CommandBuffer> commandBuffer;
+        ref_ptr<SyncObjectPool> syncObjectPool;
         ref_ptr<Fence> fence;
         ref_ptr<Semaphore> semaphore;
         ref_ptr<ScratchMemory> scratchMemory;
@@ -139,6 +159,16 @@ namespace vsg
         ref_ptr<CopyAndReleaseBuffer> copyBufferCmd;
         void copy(ref_ptr<BufferInfo> src, ref_ptr<BufferInfo> dest);
 
+        /// BufferInfo/ImageInfo entries whose data is marked STATIC_DATA_UNREF_AFTER_TRANSFER, collected
+        /// during the compile traversal and unreffed by waitForCompletion() once the fence confirms the
+        /// transfer has completed, so large static vertex arrays and textures don't stay resident in host
+        /// memory for the lifetime of the scene. Only the BufferInfo/Image reference to the data is
+        /// dropped - the BufferInfo/Image and any Auxiliary metadata attached to it survive, so
+        /// applications that may need CPU access again can reattach the data after re-reading it from its
+        /// source file.
+        BufferInfoList bufferInfosToRelease;
+        ImageInfoList imageInfosToRelease;
+
         /// return true if there are commands that have been submitted
         bool record();
 
@@ -38,6 +38,11 @@ namespace vsg
         /// get the stats of the available DescriptorSets/Descriptors
         bool getAvailability(uint32_t& maxSets, DescriptorPoolSizes& descriptorPoolSizes) const;
 
+        /// when no allocated DescriptorSets remain in use, release the recycled sets in bulk by resetting the
+        /// VkDescriptorPool and restore the full capacity of the pool, undoing any fragmentation across layouts.
+        /// Returns false without side effects while any allocated DescriptorSet is still in use.
+        bool reset();
+
         /// mutex used to ensure thread safe access of DescriptorPool resources.
         /// Locked automatically by allocateDescriptorSet(..), freeDescriptorSet(), getAvailability() and DescriptorSet:::Implementation
         /// to ensure thread safe operation. Normal VulkanSceneGraph usage will not require users to lock this mutex so treat as an internal implementation detail.
@@ -49,10 +54,24 @@ namespace vsg
         VkDescriptorPool _descriptorPool;
         ref_ptr<Device> _device;
 
+        const uint32_t _maxSets;
+        const DescriptorPoolSizes _descriptorPoolSizes;
+
         uint32_t _availableDescriptorSet;
         DescriptorPoolSizes _availableDescriptorPoolSizes;
 
-        std::list<ref_ptr<DescriptorSet::Implementation>> _recyclingList;
+        /// freed DescriptorSet::Implementations grouped by the DescriptorSetLayout they were allocated with,
+        /// so that recycling is a per layout lookup rather than a scan over every freed set.
+        struct RecycledSets
+        {
+            ref_ptr<DescriptorSetLayout> descriptorSetLayout;
+            std::list<ref_ptr<DescriptorSet::Implementation>> sets;
+        };
+
+        std::list<RecycledSets> _recyclingLists;
+        size_t _numRecycledSets = 0;
+
+        std::list<RecycledSets>::iterator _findRecycledSets(DescriptorSetLayout* descriptorSetLayout);
     };
     VSG_type_name(vsg::DescriptorPool);
 
@@ -0,0 +1,68 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/vk/Fence.h>
+
+#include <deque>
+#include <mutex>
+
+namespace vsg
+{
+
+    /// DestructionQueue defers the destruction of objects whose Vulkan handles may still be referenced by
+    /// frames in flight. Objects handed to defer() - typically a subgraph just removed from the scene, or a
+    /// closed window's resources - are kept alive until the frame fences passed to the next advance() have
+    /// signaled, at which point their references are dropped and their destructors release the Vulkan handles
+    /// and DeviceMemory as usual, with no vkDeviceWaitIdle() pipeline drain required. Access via
+    /// Device::getDestructionQueue() and drive per frame through Viewer::deferDestruction(). Thread safe.
+    class VSG_DECLSPEC DestructionQueue : public Inherit<Object, DestructionQueue>
+    {
+    public:
+        DestructionQueue();
+
+        using Fences = std::vector<ref_ptr<Fence>>;
+
+        /// park an object so its destruction is deferred until the frame fences passed to the next advance() have signaled
+        void defer(ref_ptr<Object> object);
+
+        /// move the parked objects into the in flight list guarded by the frame's fences, and release any earlier
+        /// batches whose fences have all signaled. Call once per frame after the frame's submissions - the Viewer
+        /// does so at the end of recordAndSubmit(). When frameFences is empty nothing is in flight and the parked
+        /// objects are destroyed immediately.
+        void advance(const Fences& frameFences);
+
+        /// release the batches whose fences have all signaled, returning the number of objects destroyed
+        size_t expire();
+
+        /// number of objects still parked or in flight
+        size_t pendingObjects() const;
+
+    protected:
+        // destruction drops any remaining batches without waiting, the owner is responsible for the device
+        // being idle at that point, as the Viewer's destructor already ensures.
+        virtual ~DestructionQueue();
+
+        struct Batch
+        {
+            Fences fences;
+            std::vector<ref_ptr<Object>> objects;
+        };
+
+        mutable std::mutex _mutex;
+        std::vector<ref_ptr<Object>> _pending;
+        std::deque<Batch> _batches;
+    };
+    VSG_type_name(vsg::DestructionQueue);
+
+} // namespace vsg
@@ -12,17 +12,24 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/observer_ptr.h>
+#include <vsg/vk/DeviceDispatch.h>
 #include <vsg/vk/DeviceExtensions.h>
 #include <vsg/vk/DeviceFeatures.h>
 #include <vsg/vk/Queue.h>
 
 #include <list>
+#include <mutex>
 
 namespace vsg
 {
 
     // forward declare
     class WindowTraits;
+    class PipelineCache;
+    class SamplerCache;
+    class SyncObjectPool;
+    class DestructionQueue;
 
     struct QueueSetting
     {
@@ -60,6 +67,9 @@ namespace vsg
         /// get the extensions structure that holds a range of function pointers to vkInstance extensions
         const DeviceExtensions* getExtensions() const { return _extensions.get(); }
 
+        /// get the dispatch table of device specific function pointers for the core commands used by the record hot paths
+        const DeviceDispatch* getDispatch() const { return _dispatch.get(); }
+
         /// get the address of specified function using vkGetDeviceProcAddr
         /// for core commands beyond the apiVersion specified in vsg::Instance creation, vkGetDeviceProcAddr may return a non-nullptr function pointer, though the function pointer must not be called.
         /// for extension commands, vkGetDeviceProcAddr will always return nullptr if the extension is not enabled in vsg::Device creation.
@@ -82,6 +92,25 @@ namespace vsg
         /// return true if Device was created with specified extension
         bool supportsDeviceExtension(const char* extensionName) const;
 
+        /// PipelineCache passed to all pipeline creation for this device, created automatically by the Device constructor.
+        /// Replace with a PipelineCache created with a filename to persist the cache data across runs.
+        ref_ptr<PipelineCache> pipelineCache;
+
+        /// SamplerCache used by Sampler::compile() so that equivalent Samplers share a single VkSampler handle,
+        /// created automatically by the Device constructor. Reset to an empty ref_ptr to disable the sharing.
+        ref_ptr<SamplerCache> samplerCache;
+
+        /// return the device wide SyncObjectPool used to recycle Fence, Semaphore and Event objects, creating it
+        /// when first required. The Device only observes the pool, as the pooled objects themselves keep the
+        /// Device alive, so ownership is shared between the tasks and contexts using it. Thread safe.
+        ref_ptr<SyncObjectPool> getSyncObjectPool();
+
+        /// return the device wide DestructionQueue used to defer destruction of objects whose Vulkan handles may
+        /// still be in flight, creating it when first required. The Device only observes the queue, as the parked
+        /// objects themselves keep the Device alive - the Viewer, or whoever drives DestructionQueue::advance(),
+        /// holds the owning reference. Thread safe.
+        ref_ptr<DestructionQueue> getDestructionQueue();
+
     protected:
         virtual ~Device();
 
@@ -91,6 +120,13 @@ namespace vsg
         ref_ptr<PhysicalDevice> _physicalDevice;
         ref_ptr<AllocationCallbacks> _allocator;
         ref_ptr<DeviceExtensions> _extensions;
+        ref_ptr<DeviceDispatch> _dispatch;
+
+        std::mutex _syncObjectPoolMutex;
+        observer_ptr<SyncObjectPool> _syncObjectPool;
+
+        std::mutex _destructionQueueMutex;
+        observer_ptr<DestructionQueue> _destructionQueue;
 
         Queues _queues;
     };
@@ -0,0 +1,44 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/vk/Instance.h>
+
+namespace vsg
+{
+    class Device;
+
+    /// DeviceDispatch manages a table of device specific function pointers for the core Vulkan commands
+    /// called by the record hot paths, fetched via vkGetDeviceProcAddr so that calls made during command
+    /// buffer recording go straight to the driver rather than through the Vulkan loader's per call
+    /// trampoline and dispatch. The vsg::Device "has a" DeviceDispatch object that can be accessed via
+    /// device->getDispatch(), and each vsg::CommandBuffer caches a pointer to its Device's table.
+    class VSG_DECLSPEC DeviceDispatch : public Inherit<Object, DeviceDispatch>
+    {
+    public:
+        explicit DeviceDispatch(Device* device);
+
+        PFN_vkCmdBindPipeline vkCmdBindPipeline = nullptr;
+        PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets = nullptr;
+        PFN_vkCmdPushConstants vkCmdPushConstants = nullptr;
+        PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers = nullptr;
+        PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer = nullptr;
+        PFN_vkCmdDraw vkCmdDraw = nullptr;
+        PFN_vkCmdDrawIndexed vkCmdDrawIndexed = nullptr;
+        PFN_vkCmdDrawIndirect vkCmdDrawIndirect = nullptr;
+        PFN_vkCmdDrawIndexedIndirect vkCmdDrawIndexedIndirect = nullptr;
+        PFN_vkCmdDispatch vkCmdDispatch = nullptr;
+    };
+    VSG_type_name(vsg::DeviceDispatch);
+
+} // namespace vsg
@@ -28,6 +28,11 @@ namespace vsg
         // VK_EXT_host_query_reset / Vulkan-1.2
         PFN_vkResetQueryPoolEXT vkResetQueryPool = nullptr;
 
+        // VK_KHR_timeline_semaphore / Vulkan-1.2
+        PFN_vkWaitSemaphoresKHR vkWaitSemaphores = nullptr;
+        PFN_vkSignalSemaphoreKHR vkSignalSemaphore = nullptr;
+        PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValue = nullptr;
+
         // VK_KHR_create_renderpass2
         PFN_vkCreateRenderPass2KHR_Compatibility vkCreateRenderPass2 = nullptr;
 
@@ -37,17 +42,26 @@ namespace vsg
         PFN_vkGetAccelerationStructureDeviceAddressKHR vkGetAccelerationStructureDeviceAddressKHR = nullptr;
         PFN_vkGetAccelerationStructureBuildSizesKHR vkGetAccelerationStructureBuildSizesKHR = nullptr;
         PFN_vkCmdBuildAccelerationStructuresKHR vkCmdBuildAccelerationStructuresKHR = nullptr;
+        PFN_vkCmdWriteAccelerationStructuresPropertiesKHR vkCmdWriteAccelerationStructuresPropertiesKHR = nullptr;
+        PFN_vkCmdCopyAccelerationStructureKHR vkCmdCopyAccelerationStructureKHR = nullptr;
         PFN_vkCreateRayTracingPipelinesKHR vkCreateRayTracingPipelinesKHR = nullptr;
         PFN_vkGetRayTracingShaderGroupHandlesKHR vkGetRayTracingShaderGroupHandlesKHR = nullptr;
         PFN_vkCmdTraceRaysKHR vkCmdTraceRaysKHR = nullptr;
 
         PFN_vkGetBufferDeviceAddressKHR_Compatibility vkGetBufferDeviceAddressKHR = nullptr;
 
+        // VK_KHR_push_descriptor
+        PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR = nullptr;
+
         // VK_EXT_mesh_shader
         PFN_vkCmdDrawMeshTasksEXT vkCmdDrawMeshTasksEXT = nullptr;
         PFN_vkCmdDrawMeshTasksIndirectEXT vkCmdDrawMeshTasksIndirectEXT = nullptr;
         PFN_vkCmdDrawMeshTasksIndirectCountEXT vkCmdDrawMeshTasksIndirectCountEXT = nullptr;
 
+        // VK_EXT_host_image_copy
+        PFN_vkCopyMemoryToImageEXT vkCopyMemoryToImageEXT = nullptr;
+        PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT = nullptr;
+
         // VK_EXT_extended_dynamic_state / Vulkan 1.3
         PFN_vkCmdSetCullModeEXT vkCmdSetCullMode = nullptr;
         PFN_vkCmdSetFrontFaceEXT vkCmdSetFrontFace = nullptr;
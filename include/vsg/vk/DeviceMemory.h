@@ -53,6 +53,18 @@ namespace vsg
         Device* getDevice() { return _device; }
         const Device* getDevice() const { return _device; }
 
+        /// export the DeviceMemory as a POSIX file descriptor for zero copy handoff to external consumers
+        /// such as video encoders. Requires the VK_KHR_external_memory_fd device extension and memory
+        /// allocated with a VkExportMemoryAllocateInfo in its pNextAllocInfo chain, see
+        /// Image::externalMemoryHandleTypes. Ownership of the fd passes to the caller.
+        VkResult getMemoryFd(VkExternalMemoryHandleTypeFlagBits handleType, int& fd) const;
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+        /// export the DeviceMemory as a Win32 handle, the equivalent of getMemoryFd() for the
+        /// VK_KHR_external_memory_win32 device extension.
+        VkResult getMemoryWin32Handle(VkExternalMemoryHandleTypeFlagBits handleType, HANDLE& handle) const;
+#endif
+
     protected:
         virtual ~DeviceMemory();
 
@@ -34,6 +34,14 @@ namespace vsg
         VkDeviceSize minimumBufferSize = 16 * 1024 * 1024;
         VkDeviceSize minimumDeviceMemorySize = 16 * 1024 * 1024;
 
+        /// when assigned a non zero size, reserveBuffer() runs in arena mode: new pool buffers are created with
+        /// arenaUsageFlags and sized to arenaBufferSize, so that allocations whose usage is a subset of the arena's,
+        /// such as the vertex and index data of a whole model load, pack into the same few large VkBuffers rather
+        /// than usage specific ones. Packing geometry into shared buffers maximizes the CommandBuffer's elision of
+        /// redundant vkCmdBindVertexBuffers/vkCmdBindIndexBuffer calls during record.
+        VkDeviceSize arenaBufferSize = 0;
+        VkBufferUsageFlags arenaUsageFlags = VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+
         VkDeviceSize computeMemoryTotalAvailable() const;
         VkDeviceSize computeMemoryTotalReserved() const;
         VkDeviceSize computeBufferTotalAvailable() const;
@@ -44,6 +52,14 @@ namespace vsg
         using DeviceMemoryOffset = std::pair<ref_ptr<DeviceMemory>, VkDeviceSize>;
         DeviceMemoryOffset reserveMemory(VkMemoryRequirements memRequirements, VkMemoryPropertyFlags memoryProperties, void* pNextAllocInfo = nullptr);
 
+        /// report per pool occupancy and fragmentation stats, in the style of Allocator::report().
+        void report(std::ostream& out) const;
+
+        /// release Buffer and DeviceMemory pools that no longer have any outstanding reservations, returning
+        /// the number of pools released. Useful for long running sessions where paging churn leaves fully idle,
+        /// fragmented blocks behind, subsequent reservations will then allocate fresh compact blocks.
+        size_t releaseEmptyPools();
+
     protected:
         mutable std::mutex _mutex;
 
@@ -30,6 +30,10 @@ namespace vsg
         int getQueueFamily(VkQueueFlags queueFlags) const;
         std::pair<int, int> getQueueFamily(VkQueueFlags queueFlags, Surface* surface) const;
 
+        /// return the index of the first queue family that supports all the specified queueFlags but none of the excludedFlags, or -1 if no such family exists.
+        /// Useful for discovering dedicated DMA/transfer queue families, i.e. getDedicatedQueueFamily(VK_QUEUE_TRANSFER_BIT, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT).
+        int getDedicatedQueueFamily(VkQueueFlags queueFlags, VkQueueFlags excludedFlags) const;
+
         using QueueFamilyProperties = std::vector<VkQueueFamilyProperties>;
         const QueueFamilyProperties& getQueueFamilyProperties() const { return _queueFamilies; }
 
@@ -72,6 +76,25 @@ namespace vsg
             return properties;
         }
 
+        /// per memory heap budget and usage, in bytes, queried via VK_EXT_memory_budget
+        struct MemoryHeapBudget
+        {
+            uint32_t heapIndex = 0;
+            VkMemoryHeapFlags flags = 0;
+            VkDeviceSize size = 0;   /// total size of the heap
+            VkDeviceSize budget = 0; /// bytes this process can allocate before allocations risk spilling to slower memory or failing
+            VkDeviceSize usage = 0;  /// bytes currently allocated by this process
+        };
+        using MemoryBudgets = std::vector<MemoryHeapBudget>;
+
+        /// return true when VK_EXT_memory_budget is supported, so getMemoryBudgets() will return per heap figures
+        bool supportsMemoryBudget() const { return _supportsMemoryBudget; }
+
+        /// query the current per heap memory budget and usage via VK_EXT_memory_budget. The budgets move as other
+        /// processes allocate and release memory, so requery each frame when driving reactive policies such as
+        /// MemoryBudgetMonitor. Returns an empty container when the extension isn't supported.
+        MemoryBudgets getMemoryBudgets() const;
+
         /// Call vkEnumerateDeviceExtensionProperties to enumerate extension properties.
         ExtensionProperties enumerateDeviceExtensionProperties(const char* pLayerName = nullptr);
 
@@ -94,6 +117,9 @@ namespace vsg
 
         PFN_vkGetPhysicalDeviceFeatures2 _vkGetPhysicalDeviceFeatures2 = nullptr;
         PFN_vkGetPhysicalDeviceProperties2 _vkGetPhysicalDeviceProperties2 = nullptr;
+        PFN_vkGetPhysicalDeviceMemoryProperties2 _vkGetPhysicalDeviceMemoryProperties2 = nullptr;
+
+        bool _supportsMemoryBudget = false;
 
         vsg::observer_ptr<Instance> _instance;
     };
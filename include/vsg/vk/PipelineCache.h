@@ -0,0 +1,49 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/FileSystem.h>
+#include <vsg/vk/Device.h>
+
+namespace vsg
+{
+
+    /// PipelineCache encapsulates VkPipelineCache, allowing the driver to reuse previously compiled pipeline state
+    /// across graphics, compute and ray tracing pipeline creation. A PipelineCache is created automatically by
+    /// Device and passed to all pipeline creation. To persist the cache across runs replace it before compiling
+    /// any pipelines, i.e. device->pipelineCache = vsg::PipelineCache::create(device, cacheFilename);
+    /// which preloads previously saved cache data at creation and saves it back to the file on destruction.
+    class VSG_DECLSPEC PipelineCache : public Inherit<Object, PipelineCache>
+    {
+    public:
+        explicit PipelineCache(Device* device, const Path& in_filename = {});
+
+        operator VkPipelineCache() const { return _pipelineCache; }
+        VkPipelineCache vk() const { return _pipelineCache; }
+
+        /// filename the cache data is saved to on destruction, empty disables persistence.
+        Path filename;
+
+        /// write the current cache data to the specified file.
+        bool save(const Path& saveFilename) const;
+
+    protected:
+        virtual ~PipelineCache();
+
+        VkDevice _device = VK_NULL_HANDLE;
+        ref_ptr<AllocationCallbacks> _allocator;
+        VkPipelineCache _pipelineCache = VK_NULL_HANDLE;
+    };
+    VSG_type_name(vsg::PipelineCache);
+
+} // namespace vsg
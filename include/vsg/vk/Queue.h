@@ -38,6 +38,9 @@ namespace vsg
 
         VkResult submit(const VkSubmitInfo& submitInfo, Fence* fence = nullptr);
 
+        /// bind/unbind sparse resource memory, requires a queue from a family with VK_QUEUE_SPARSE_BINDING_BIT
+        VkResult bindSparse(const VkBindSparseInfo& bindSparseInfo, Fence* fence = nullptr);
+
         VkResult present(const VkPresentInfoKHR& info);
 
         VkResult waitIdle();
@@ -120,6 +120,13 @@ namespace vsg
     /// create RenderPass with color and depth buffers
     extern VSG_DECLSPEC ref_ptr<RenderPass> createRenderPass(Device* device, VkFormat imageFormat, VkFormat depthFormat, bool requiresDepthRead = false);
 
+    /// convenience function that creates a single subpass VK_KHR_multiview RenderPass with color and depth attachments,
+    /// broadcasting each draw to the attachment layers selected by viewMask, i.e. viewMask = 0x3 renders layers 0 and 1
+    /// for left/right eye stereo. Use with a layered Framebuffer and a single View whose View::eyeOffsets provide the
+    /// per eye view matrices, so stereo/dome rendering requires one record traversal rather than one per eye.
+    /// multiview support requires Vulkan 1.2 or later.
+    extern VSG_DECLSPEC ref_ptr<RenderPass> createMultiviewRenderPass(Device* device, VkFormat imageFormat, VkFormat depthFormat, uint32_t viewMask, bool requiresDepthRead = false);
+
     /// create RenderPass with multisampled color and depth buffers
     extern VSG_DECLSPEC ref_ptr<RenderPass> createMultisampledRenderPass(Device* device, VkFormat imageFormat, VkFormat depthFormat, VkSampleCountFlagBits samples, bool requiresDepthRead = false);
 
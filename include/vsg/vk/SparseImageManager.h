@@ -0,0 +1,114 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/state/Image.h>
+#include <vsg/vk/Queue.h>
+#include <vsg/vk/SyncObjectPool.h>
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <tuple>
+
+namespace vsg
+{
+    // forward declare
+    class Context;
+
+    /// SparseImageManager streams pages of sparse resident images in and out of device memory so that
+    /// VRAM usage stays proportional to what is visible rather than to the full texture, enabling
+    /// virtual texturing of imagery far larger than device memory.
+    /// Create images with VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT
+    /// flags - Image::compile() creates such images without binding memory - then drive page residency
+    /// with requestPage()/releasePage(), typically from the same visibility information that schedules
+    /// PagedLOD loads, with the page data itself read asynchronously through the DatabasePager/
+    /// OperationThreads I/O machinery. flush() applies the accumulated binds/unbinds in a single
+    /// vkQueueBindSparse submission on the sparse binding queue and schedules the upload of newly
+    /// bound page data through the compile Context.
+    /// Note, the Device must have been created with a queue from a family supporting VK_QUEUE_SPARSE_BINDING_BIT,
+    /// and the logical device feature sparseResidencyImage2D (et al.) enabled.
+    class VSG_DECLSPEC SparseImageManager : public Inherit<Object, SparseImageManager>
+    {
+    public:
+        explicit SparseImageManager(Device* in_device);
+
+        ref_ptr<Device> device;
+
+        /// queue used for the vkQueueBindSparse submissions, assigned by the constructor from the first
+        /// queue family supporting VK_QUEUE_SPARSE_BINDING_BIT
+        ref_ptr<Queue> sparseBindingQueue;
+
+        /// device wide pool that the bind completion fences are acquired from and recycled to
+        ref_ptr<SyncObjectPool> syncObjectPool;
+
+        /// return the page granularity, in texels, for the specified compiled image
+        VkExtent3D pageGranularity(Image* image) const;
+
+        /// schedule binding of device memory for the page containing the specified texel offset of the
+        /// given mip level/array layer, with the optional pageData uploaded into the page once the bind
+        /// has completed. Requests for pages that are already resident only re-upload the pageData.
+        void requestPage(ref_ptr<Image> image, uint32_t mipLevel, uint32_t arrayLayer, const VkOffset3D& offset, ref_ptr<Data> pageData = {});
+
+        /// schedule unbinding of the page containing the specified texel offset, releasing its device
+        /// memory once the unbind has completed. Requests for pages that are not resident are ignored.
+        void releasePage(ref_ptr<Image> image, uint32_t mipLevel, uint32_t arrayLayer, const VkOffset3D& offset);
+
+        /// device memory currently bound to pages
+        VkDeviceSize residentMemory() const;
+
+        /// apply the pending page binds/unbinds in a single vkQueueBindSparse submission, waiting for its
+        /// completion before releasing unbound pages' memory and scheduling the upload of the newly bound
+        /// pages' data through the context. Call once per frame/compile ahead of the context's record().
+        VkResult flush(Context& context);
+
+    protected:
+        virtual ~SparseImageManager();
+
+        struct PageKey
+        {
+            VkImage image;
+            uint32_t mipLevel;
+            uint32_t arrayLayer;
+            VkOffset3D offset;
+
+            bool operator<(const PageKey& rhs) const;
+        };
+
+        struct Page
+        {
+            ref_ptr<DeviceMemory> memory;
+            VkDeviceSize size = 0;
+        };
+
+        struct PendingPage
+        {
+            ref_ptr<Image> image;
+            ref_ptr<DeviceMemory> memory;
+            VkSparseImageMemoryBind bind;
+            ref_ptr<Data> data;
+        };
+
+        mutable std::mutex _mutex;
+        std::map<PageKey, Page> _pages;
+        std::vector<PendingPage> _pendingBinds;
+        std::vector<PendingPage> _pendingUnbinds;
+        std::vector<PendingPage> _pendingUploads;
+        VkDeviceSize _residentMemory = 0;
+
+        /// subresources that have had their first page upload, and so have been transitioned out of VK_IMAGE_LAYOUT_UNDEFINED
+        std::set<std::tuple<VkImage, uint32_t, uint32_t>> _initializedSubresources;
+    };
+    VSG_type_name(vsg::SparseImageManager);
+
+} // namespace vsg
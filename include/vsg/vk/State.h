@@ -19,6 +19,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/CommandBuffer.h>
 
 #include <array>
+#include <cstring>
 #include <map>
 #include <stack>
 
@@ -27,7 +28,10 @@ namespace vsg
 
 #define POLYTOPE_SIZE 5
 
-    /// StateStack used internally by vsg::State to manage stack of vsg::StateCommand
+    /// StateStack used internally by vsg::State to manage stack of vsg::StateCommand.
+    /// The stack borrows raw pointers rather than taking references - the scene graph being recorded
+    /// owns the StateCommands for the duration of the traversal, so pushing and popping state on the
+    /// record path pays no reference counting traffic.
     template<class T>
     class StateStack
     {
@@ -35,40 +39,55 @@ namespace vsg
         StateStack() :
             dirty(false) {}
 
-        using Stack = std::stack<ref_ptr<const T>>;
+        using Stack = std::stack<const T*>;
         Stack stack;
         bool dirty;
 
         template<class R>
-        inline void push(ref_ptr<R> value)
+        inline void push(const ref_ptr<R>& value)
         {
-            stack.push(value);
-            dirty = true;
+            push(value.get());
         }
 
         template<class R>
         inline void push(R* value)
         {
-            stack.push(ref_ptr<const T>(value));
-            dirty = true;
+            stack.push(value);
+            dirty = value != _lastRecorded;
         }
 
         inline void pop()
         {
             stack.pop();
-            dirty = !stack.empty();
+            dirty = !stack.empty() && stack.top() != _lastRecorded;
         }
         size_t size() const { return stack.size(); }
         const T* top() const { return stack.top(); }
 
-        inline void record(CommandBuffer& commandBuffer)
+        /// record the top state command if it differs from the last command recorded to the command buffer,
+        /// eliding redundant re-binds when the same command is pushed again. Returns true when a command was recorded.
+        inline bool record(CommandBuffer& commandBuffer)
         {
             if (dirty)
             {
                 stack.top()->record(commandBuffer);
+                _lastRecorded = stack.top();
                 dirty = false;
+                return true;
             }
+            return false;
+        }
+
+        /// forget the last recorded command so the current top is re-recorded, used at the start of recording a
+        /// new command buffer and when commands recorded to earlier slots may disturb this slot's bindings.
+        inline void invalidate()
+        {
+            _lastRecorded = nullptr;
+            dirty = !stack.empty();
         }
+
+    protected:
+        const T* _lastRecorded = nullptr;
     };
 
     /// MatrixStack used internally by vsg::State to manage stack of projection or modelview matrices
@@ -89,47 +108,83 @@ namespace vsg
         uint32_t offset = 0;
         bool dirty = false;
 
+        /// opt-in relative-to-eye mode for georeferenced scenes, set via View::relativeToEye. A float
+        /// shadow stack is maintained alongside the double stack, rebased so the eye sits at the world
+        /// origin - the view matrix is composed with translate(origin) and the first model matrix pushed
+        /// above it has origin subtracted from its translation, so the float matrices never hold the
+        /// planet sized coordinates that cause jitter and the per node multiplies run through the
+        /// SIMD float mat4 path. The double stack is retained untouched for exact culling and LOD selection.
+        bool relativeToEye = false;
+        dvec3 origin;
+
+        std::stack<mat4> relMatrixStack;
+
         inline void set(const mat4& matrix)
         {
-            matrixStack = {};
-            matrixStack.emplace(matrix);
-            dirty = true;
+            set(dmat4(matrix));
         }
 
         inline void set(const dmat4& matrix)
         {
             matrixStack = {};
             matrixStack.emplace(matrix);
+            if (relativeToEye)
+            {
+                relMatrixStack = {};
+                relMatrixStack.emplace(mat4(matrix * translate(origin)));
+            }
             dirty = true;
         }
 
         inline void push(const mat4& matrix)
         {
-            matrixStack.emplace(matrix);
-            dirty = true;
+            push(dmat4(matrix));
         }
         inline void push(const dmat4& matrix)
         {
-            matrixStack.emplace(matrix);
+            if (relativeToEye) pushRelative(matrix);
+            matrixStack.emplace(matrixStack.top() * matrix);
             dirty = true;
         }
         inline void push(const Transform& transform)
         {
             matrixStack.emplace(transform.transform(matrixStack.top()));
+            // generic Transforms can't be rebased locally, but the double result's translation is
+            // already eye relative and small so converting it to float is free of jitter.
+            if (relativeToEye) relMatrixStack.emplace(mat4(matrixStack.top()));
             dirty = true;
         }
 
         inline void push(const MatrixTransform& transform)
         {
+            if (relativeToEye) pushRelative(transform.matrix);
             matrixStack.emplace(matrixStack.top() * transform.matrix);
             dirty = true;
         }
 
         const dmat4& top() const { return matrixStack.top(); }
 
+        /// the float matrix to supply to push constants, the rebased shadow top in relative-to-eye mode
+        mat4 floatTop() const { return relativeToEye ? relMatrixStack.top() : mat4(matrixStack.top()); }
+
+        // cache of the float matrix last written to push constants, so push/pop sequences that land back on
+        // the same effective matrix (common for batched siblings) share a single double to float conversion
+        // and elide the redundant vkCmdPushConstants call.
+        mat4 lastRecorded;
+        bool lastRecordedValid = false;
+
+        /// forget the last pushed matrix so the next record() pushes unconditionally, called at the start of
+        /// recording a new command buffer.
+        inline void invalidate()
+        {
+            lastRecordedValid = false;
+            dirty = true;
+        }
+
         inline void pop()
         {
             matrixStack.pop();
+            if (relativeToEye && !relMatrixStack.empty()) relMatrixStack.pop();
             dirty = true;
         }
 
@@ -147,11 +202,42 @@ namespace vsg
                 }
 
                 // make sure matrix is a float matrix.
-                mat4 newmatrix(matrixStack.top());
-                vkCmdPushConstants(commandBuffer, pipeline, stageFlags, offset, sizeof(newmatrix), newmatrix.data());
+                mat4 newmatrix = floatTop();
+
+                // the stack may have been popped back to, or pushed with, the matrix already held by the
+                // command buffer, in which case there is nothing to push.
+                if (lastRecordedValid && std::memcmp(newmatrix.data(), lastRecorded.data(), sizeof(mat4)) == 0)
+                {
+                    dirty = false;
+                    return;
+                }
+
+                commandBuffer.dispatch->vkCmdPushConstants(commandBuffer, pipeline, stageFlags, offset, sizeof(newmatrix), newmatrix.data());
+                lastRecorded = newmatrix;
+                lastRecordedValid = true;
                 dirty = false;
             }
         }
+
+    protected:
+        /// push a model matrix onto the float shadow stack - the first matrix above the rebased view has
+        /// the origin subtracted from its translation in double precision, deeper matrices are local and
+        /// small so multiply through the float SIMD path directly.
+        inline void pushRelative(const dmat4& matrix)
+        {
+            if (relMatrixStack.size() == 1)
+            {
+                mat4 m(matrix);
+                m[3][0] = static_cast<float>(matrix[3][0] - origin.x);
+                m[3][1] = static_cast<float>(matrix[3][1] - origin.y);
+                m[3][2] = static_cast<float>(matrix[3][2] - origin.z);
+                relMatrixStack.emplace(relMatrixStack.top() * m);
+            }
+            else
+            {
+                relMatrixStack.emplace(relMatrixStack.top() * mat4(matrix));
+            }
+        }
     };
 
     /// Frustum used internally by vsg::State to manage view fustum culling during vsg::RecordTraversal
@@ -245,6 +331,12 @@ namespace vsg
 
         bool dirty = true;
 
+        /// opt-in fast path that writes the projection and modelview matrices as a single 128 byte
+        /// vkCmdPushConstants call from a stack buffer rather than two 64 byte calls, set via
+        /// RecordTraversal::useCombinedMatrixPushConstants. Requires pipeline layouts to declare a
+        /// push constant range covering both matrices.
+        bool combineMatrixPushConstants = false;
+
         bool inheritViewForLODScaling = false;
         dmat4 inheritedProjectionMatrix;
         dmat4 inheritedViewMatrix;
@@ -269,6 +361,13 @@ namespace vsg
 
             _frustumProjected.set(_frustumUnit, proj);
 
+            if (modelviewMatrixStack.relativeToEye)
+            {
+                // rebase the float shadow stack about the eye point so camera local coordinates stay small
+                auto inverse_viewMatrix = inverse(viewMatrix);
+                modelviewMatrixStack.origin = dvec3(inverse_viewMatrix[3][0], inverse_viewMatrix[3][1], inverse_viewMatrix[3][2]);
+            }
+
             modelviewMatrixStack.set(viewMatrix);
 
             // clear frustum stack
@@ -283,17 +382,62 @@ namespace vsg
             pushFrustum();
         }
 
+        /// reset the per command buffer bind tracking, called at the start of recording a new command buffer so
+        /// that the first use of each state command records its bindings rather than being elided.
+        inline void reset()
+        {
+            for (auto& stateStack : stateStacks)
+            {
+                stateStack.invalidate();
+            }
+            projectionMatrixStack.invalidate();
+            modelviewMatrixStack.invalidate();
+            dirty = true;
+        }
+
         inline void record()
         {
             if (dirty)
             {
+                bool invalidateFollowingSlots = false;
                 for (auto& stateStack : stateStacks)
                 {
-                    stateStack.record(*_commandBuffer);
+                    // once a slot records a new command, re-record the tops of the later slots as the new bindings may disturb them
+                    if (invalidateFollowingSlots) stateStack.invalidate();
+                    if (stateStack.record(*_commandBuffer)) invalidateFollowingSlots = true;
                 }
 
-                projectionMatrixStack.record(*_commandBuffer);
-                modelviewMatrixStack.record(*_commandBuffer);
+                if (combineMatrixPushConstants && projectionMatrixStack.dirty && modelviewMatrixStack.dirty &&
+                    modelviewMatrixStack.offset == projectionMatrixStack.offset + sizeof(mat4))
+                {
+                    auto pipeline = _commandBuffer->getCurrentPipelineLayout();
+                    auto stageFlags = _commandBuffer->getCurrentPushConstantStageFlags();
+                    if (pipeline != 0 && stageFlags != 0)
+                    {
+                        // write both matrices with a single vkCmdPushConstants call from a stack buffer
+                        mat4 matrices[2] = {mat4(projectionMatrixStack.top()), modelviewMatrixStack.floatTop()};
+
+                        bool unchanged = projectionMatrixStack.lastRecordedValid && modelviewMatrixStack.lastRecordedValid &&
+                                         std::memcmp(matrices[0].data(), projectionMatrixStack.lastRecorded.data(), sizeof(mat4)) == 0 &&
+                                         std::memcmp(matrices[1].data(), modelviewMatrixStack.lastRecorded.data(), sizeof(mat4)) == 0;
+                        if (!unchanged)
+                        {
+                            _commandBuffer->dispatch->vkCmdPushConstants(*_commandBuffer, pipeline, stageFlags, projectionMatrixStack.offset, sizeof(matrices), matrices);
+                            projectionMatrixStack.lastRecorded = matrices[0];
+                            projectionMatrixStack.lastRecordedValid = true;
+                            modelviewMatrixStack.lastRecorded = matrices[1];
+                            modelviewMatrixStack.lastRecordedValid = true;
+                        }
+
+                        projectionMatrixStack.dirty = false;
+                        modelviewMatrixStack.dirty = false;
+                    }
+                }
+                else
+                {
+                    projectionMatrixStack.record(*_commandBuffer);
+                    modelviewMatrixStack.record(*_commandBuffer);
+                }
 
                 dirty = false;
             }
@@ -38,6 +38,12 @@ namespace vsg
         VkSurfaceFormatKHR surfaceFormat = {VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
         VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR;
         VkImageUsageFlags imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+
+        /// present modes the swapchain may be switched between at runtime without recreation, i.e. FIFO for
+        /// vsync and IMMEDIATE/MAILBOX for low latency. Requires the VK_EXT_swapchain_maintenance1 device
+        /// extension to be enabled and the listed modes to be compatible on the surface; leave empty to
+        /// disable runtime switching. See Swapchain::setPresentMode().
+        std::vector<VkPresentModeKHR> compatiblePresentModes;
     };
 
     /// Swapchain encapsulates vkSwapchainKHR
@@ -59,6 +65,17 @@ namespace vsg
         /// call vkAcquireNextImageKHR
         VkResult acquireNextImage(uint64_t timeout, ref_ptr<Semaphore> semaphore, ref_ptr<Fence> fence, uint32_t& imageIndex);
 
+        /// the present mode currently in use
+        VkPresentModeKHR presentMode() const { return _presentMode; }
+
+        /// present modes the swapchain was created with via SwapchainPreferences::compatiblePresentModes, empty when runtime switching is unavailable
+        const std::vector<VkPresentModeKHR>& compatiblePresentModes() const { return _compatiblePresentModes; }
+
+        /// switch the present mode without recreating the swapchain. The requested mode must be one of compatiblePresentModes(),
+        /// the switch takes effect on the next present, applied by Presentation::present() via VkSwapchainPresentModeInfoEXT.
+        /// Returns false and leaves the present mode unchanged when the mode isn't in the compatible list.
+        bool setPresentMode(VkPresentModeKHR presentMode);
+
     protected:
         virtual ~Swapchain();
 
@@ -67,6 +84,8 @@ namespace vsg
         VkSwapchainKHR _swapchain;
         VkFormat _format;
         VkExtent2D _extent;
+        VkPresentModeKHR _presentMode;
+        std::vector<VkPresentModeKHR> _compatiblePresentModes;
         ImageViews _imageViews;
     };
     VSG_type_name(vsg::Swapchain);
@@ -0,0 +1,71 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/vk/Fence.h>
+
+#include <mutex>
+
+namespace vsg
+{
+
+    // forward declare
+    class Event;
+
+    /// SyncObjectPool recycles Fence, Semaphore and Event objects at Device scope, obtained via
+    /// Device::getSyncObjectPool() and used by RecordAndSubmitTask, TransferTask and Context so that
+    /// dynamically created and destroyed views and tasks reuse synchronization objects rather than
+    /// churning vkCreateFence/vkCreateSemaphore/vkCreateEvent. Ownership of the pool is shared between
+    /// its users, so the pool and the objects it holds are destroyed once the last user releases it.
+    class VSG_DECLSPEC SyncObjectPool : public Inherit<Object, SyncObjectPool>
+    {
+    public:
+        explicit SyncObjectPool(Device* in_device);
+
+        ref_ptr<Device> device;
+
+        /// take a reset Fence from the pool, creating a new one when none are available. Thread safe.
+        ref_ptr<Fence> acquireFence();
+
+        /// take a Semaphore with the specified pipelineStageFlags from the pool, creating a new one when none are available. Thread safe.
+        ref_ptr<Semaphore> acquireSemaphore(VkPipelineStageFlags pipelineStageFlags = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+
+        /// take a reset Event from the pool, creating a new one when none are available. Thread safe.
+        ref_ptr<Event> acquireEvent();
+
+        /// return a Fence to the pool, resetting it and clearing its dependencies. Fences whose dependencies
+        /// haven't been cleared while they remain unsignaled are assumed to be associated with an incomplete
+        /// submission and are dropped rather than pooled.
+        void recycle(ref_ptr<Fence> fence);
+
+        /// return a Semaphore to the pool. The caller must only recycle semaphores that are unsignaled,
+        /// semaphores with pending submissions are dropped rather than pooled.
+        void recycle(ref_ptr<Semaphore> semaphore);
+
+        /// return an Event to the pool, resetting it to the unsignaled state.
+        void recycle(ref_ptr<Event> event);
+
+        /// number of objects currently available for reuse
+        size_t numAvailable() const;
+
+    protected:
+        virtual ~SyncObjectPool();
+
+        mutable std::mutex _mutex;
+        std::vector<ref_ptr<Fence>> _fences;
+        std::vector<ref_ptr<Semaphore>> _semaphores;
+        std::vector<ref_ptr<Event>> _events;
+    };
+    VSG_type_name(vsg::SyncObjectPool);
+
+} // namespace vsg
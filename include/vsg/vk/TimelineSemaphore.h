@@ -0,0 +1,41 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/vk/Semaphore.h>
+
+#include <limits>
+
+namespace vsg
+{
+    /// TimelineSemaphore encapsulates a VkSemaphore of VK_SEMAPHORE_TYPE_TIMELINE, provided by VK_KHR_timeline_semaphore/Vulkan-1.2.
+    /// A timeline semaphore carries a monotonically increasing 64 bit counter that can be waited on and signalled from
+    /// both the host and multiple queues, making it suited to ordering work across queues, such as running a TransferTask
+    /// on a dedicated transfer queue so uploads overlap with rendering.
+    class VSG_DECLSPEC TimelineSemaphore : public Inherit<Semaphore, TimelineSemaphore>
+    {
+    public:
+        explicit TimelineSemaphore(Device* device, uint64_t initialValue = 0, VkPipelineStageFlags pipelineStageFlags = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+        /// block the calling thread until the semaphore's counter reaches the specified value, or the timeout in nanoseconds elapses.
+        VkResult wait(uint64_t value, uint64_t timeout = std::numeric_limits<uint64_t>::max()) const;
+
+        /// signal the specified counter value from the host.
+        VkResult signal(uint64_t value) const;
+
+        /// return the current counter value of the semaphore.
+        uint64_t counterValue() const;
+    };
+    VSG_type_name(vsg::TimelineSemaphore);
+
+} // namespace vsg
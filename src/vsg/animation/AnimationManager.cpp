@@ -11,7 +11,16 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/animation/AnimationManager.h>
+#include <vsg/animation/CameraAnimation.h>
+#include <vsg/animation/JointSampler.h>
+#include <vsg/animation/MorphSampler.h>
+#include <vsg/animation/TransformSampler.h>
 #include <vsg/io/Options.h>
+#include <vsg/threading/Latch.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
 
 using namespace vsg;
 
@@ -76,14 +85,62 @@ bool AnimationManager::update(vsg::Animation& animation)
     return animation.update(_simulationTime);
 }
 
+void AnimationManager::assignVisibilityGating(ref_ptr<Node> subgraph)
+{
+    _visibilityGroups.clear();
+    if (!subgraph) return;
+
+    struct CollectAnimationGroups : public Visitor
+    {
+        std::map<const Animation*, ref_ptr<AnimationGroup>>& groups;
+
+        explicit CollectAnimationGroups(std::map<const Animation*, ref_ptr<AnimationGroup>>& in_groups) :
+            groups(in_groups) {}
+
+        void apply(Object& object) override { object.traverse(*this); }
+
+        void apply(AnimationGroup& animationGroup) override
+        {
+            for (auto& animation : animationGroup.animations) groups[animation.get()] = &animationGroup;
+            animationGroup.traverse(*this);
+        }
+    } collect(_visibilityGroups);
+
+    subgraph->accept(collect);
+}
+
+bool AnimationManager::animationVisible(const Animation* animation) const
+{
+    if (_visibilityGroups.empty()) return true;
+
+    auto itr = _visibilityGroups.find(animation);
+    if (itr == _visibilityGroups.end()) return true;
+
+    return itr->second->lastRecordedFrameIndex.load(std::memory_order_relaxed) + visibilityLatency >= _frameCount;
+}
+
 void AnimationManager::run(vsg::ref_ptr<vsg::FrameStamp> frameStamp)
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "AnimationManager run animation updates", COLOR_VIEWER);
 
     _simulationTime = frameStamp->simulationTime;
+    _frameCount = frameStamp->frameCount;
+
+    if (operationThreads && animations.size() > 1)
+    {
+        runParallel();
+        return;
+    }
 
     for (auto itr = animations.begin(); itr != animations.end();)
     {
+        // leave culled animations in the list unadvanced, they resume at the correct time on reappearance
+        if (!animationVisible(itr->get()))
+        {
+            ++itr;
+            continue;
+        }
+
         if (update(**itr))
             ++itr;
         else
@@ -92,3 +149,122 @@ void AnimationManager::run(vsg::ref_ptr<vsg::FrameStamp> frameStamp)
         }
     }
 }
+
+void AnimationManager::runParallel()
+{
+    CPU_INSTRUMENTATION_L1_NC(instrumentation, "AnimationManager parallel animation updates", COLOR_VIEWER);
+
+    // operation that updates a group of animations serially, recording which have finished
+    struct UpdateAnimationsOperation : public Inherit<Operation, UpdateAnimationsOperation>
+    {
+        double simulationTime = 0.0;
+        ref_ptr<Latch> latch;
+        std::vector<Animation*> animations;
+        std::vector<Animation*> finished;
+
+        void run() override
+        {
+            for (auto animation : animations)
+            {
+                if (!animation->update(simulationTime)) finished.push_back(animation);
+            }
+            latch->count_down();
+        }
+    };
+
+    // group animations so that any that write to the same objects land in the same group and are
+    // updated serially by a single operation, leaving the groups free to run concurrently
+    std::vector<ref_ptr<UpdateAnimationsOperation>> groups;
+    std::map<const Object*, size_t> targetToGroup;
+
+    std::vector<const Object*> targets;
+    for (auto& animation : animations)
+    {
+        // leave culled animations in the list unadvanced, they resume at the correct time on reappearance
+        if (!animationVisible(animation.get())) continue;
+
+        targets.clear();
+        for (auto& sampler : animation->samplers)
+        {
+            if (auto transformSampler = sampler.cast<TransformSampler>())
+            {
+                if (transformSampler->object) targets.push_back(transformSampler->object.get());
+            }
+            else if (auto morphSampler = sampler.cast<MorphSampler>())
+            {
+                if (morphSampler->object) targets.push_back(morphSampler->object.get());
+            }
+            else if (auto jointSampler = sampler.cast<JointSampler>())
+            {
+                if (jointSampler->subgraph) targets.push_back(jointSampler->subgraph.get());
+                if (jointSampler->jointMatrices) targets.push_back(jointSampler->jointMatrices.get());
+            }
+            else
+            {
+                // unknown sampler type, we can't tell what it writes so serialize all such animations together
+                targets.push_back(nullptr);
+            }
+        }
+        if (auto cameraAnimation = animation.cast<CameraAnimation>())
+        {
+            targets.push_back(cameraAnimation->object ? cameraAnimation->object.get() : nullptr);
+        }
+
+        // find the group of the first already mapped target, merging any further groups that share a target
+        constexpr size_t unassigned = std::numeric_limits<size_t>::max();
+        size_t group = unassigned;
+        for (auto target : targets)
+        {
+            auto itr = targetToGroup.find(target);
+            if (itr == targetToGroup.end()) continue;
+
+            if (group == unassigned)
+            {
+                group = itr->second;
+            }
+            else if (itr->second != group)
+            {
+                auto mergedGroup = itr->second;
+                auto& mergedAnimations = groups[mergedGroup]->animations;
+                groups[group]->animations.insert(groups[group]->animations.end(), mergedAnimations.begin(), mergedAnimations.end());
+                mergedAnimations.clear();
+                for (auto& [mappedTarget, mappedGroup] : targetToGroup)
+                {
+                    if (mappedGroup == mergedGroup) mappedGroup = group;
+                }
+            }
+        }
+
+        if (group == unassigned)
+        {
+            group = groups.size();
+            groups.push_back(UpdateAnimationsOperation::create());
+        }
+
+        for (auto target : targets) targetToGroup[target] = group;
+        groups[group]->animations.push_back(animation.get());
+    }
+
+    auto latch = Latch::create(groups.size());
+    for (auto& group : groups)
+    {
+        group->simulationTime = _simulationTime;
+        group->latch = latch;
+        operationThreads->add(group);
+    }
+
+    // help consume operations on this thread, then wait for any still being processed by the workers
+    operationThreads->run();
+    latch->wait();
+
+    // prune the animations that completed this frame
+    for (auto& group : groups)
+    {
+        for (auto finished : group->finished)
+        {
+            auto itr = std::find_if(animations.begin(), animations.end(),
+                                    [&](const ref_ptr<Animation>& animation) { return animation.get() == finished; });
+            if (itr != animations.end()) animations.erase(itr);
+        }
+    }
+}
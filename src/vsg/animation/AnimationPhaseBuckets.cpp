@@ -0,0 +1,157 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/animation/AnimationManager.h>
+#include <vsg/animation/AnimationPhaseBuckets.h>
+#include <vsg/animation/JointSampler.h>
+#include <vsg/animation/MorphSampler.h>
+#include <vsg/animation/TransformSampler.h>
+
+#include <cmath>
+
+using namespace vsg;
+
+namespace
+{
+    // collect the objects that must be duplicated per bucket - the animation, its samplers, their target
+    // subgraphs and output buffers - while leaving the keyframe tracks shared between all buckets
+    struct CollectPerBucketObjects : public ConstVisitor
+    {
+        Duplicate& duplicate;
+
+        explicit CollectPerBucketObjects(Duplicate& in_duplicate) :
+            duplicate(in_duplicate) {}
+
+        void apply(const Object& object) override
+        {
+            duplicate.insert(&object);
+            object.traverse(*this);
+        }
+
+        void apply(const Animation& animation) override
+        {
+            duplicate.insert(&animation);
+            for (auto& sampler : animation.samplers) sampler->accept(*this);
+        }
+
+        void apply(const TransformSampler& sampler) override
+        {
+            duplicate.insert(&sampler);
+            if (sampler.object) sampler.object->accept(*this);
+        }
+
+        void apply(const MorphSampler& sampler) override
+        {
+            duplicate.insert(&sampler);
+            if (sampler.object) sampler.object->accept(*this);
+        }
+
+        void apply(const JointSampler& sampler) override
+        {
+            duplicate.insert(&sampler);
+            if (sampler.jointMatrices) duplicate.insert(sampler.jointMatrices.get());
+            if (sampler.subgraph) sampler.subgraph->accept(*this);
+        }
+    };
+} // namespace
+
+AnimationPhaseBuckets::AnimationPhaseBuckets(ref_ptr<Animation> in_prototype, uint32_t in_numBuckets) :
+    prototype(in_prototype),
+    numBuckets(in_numBuckets)
+{
+}
+
+AnimationPhaseBuckets::~AnimationPhaseBuckets()
+{
+}
+
+double AnimationPhaseBuckets::bucketPhase(double phase) const
+{
+    if (!prototype || numBuckets == 0) return 0.0;
+
+    double duration = prototype->maxTime();
+    if (duration <= 0.0) return 0.0;
+
+    double wrapped = std::fmod(phase, duration);
+    if (wrapped < 0.0) wrapped += duration;
+
+    auto index = std::min(static_cast<uint32_t>(wrapped / duration * static_cast<double>(numBuckets)), numBuckets - 1);
+    return duration * static_cast<double>(index) / static_cast<double>(numBuckets);
+}
+
+size_t AnimationPhaseBuckets::numActiveBuckets() const
+{
+    size_t count = 0;
+    for (auto& bucket : _buckets)
+    {
+        if (bucket) ++count;
+    }
+    return count;
+}
+
+ref_ptr<Animation> AnimationPhaseBuckets::animationForPhase(double phase)
+{
+    if (!prototype || numBuckets == 0) return prototype;
+
+    double duration = prototype->maxTime();
+    if (duration <= 0.0) return prototype;
+
+    if (_buckets.size() != numBuckets) _buckets.resize(numBuckets);
+
+    double wrapped = std::fmod(phase, duration);
+    if (wrapped < 0.0) wrapped += duration;
+
+    auto index = std::min(static_cast<uint32_t>(wrapped / duration * static_cast<double>(numBuckets)), numBuckets - 1);
+
+    auto& bucket = _buckets[index];
+    if (!bucket)
+    {
+        // first instance landing in this bucket, clone the prototype with per bucket sampler state and
+        // target subgraph while the keyframe tracks stay shared with all other buckets
+        CopyOp copyop;
+        copyop.duplicate = new Duplicate;
+
+        CollectPerBucketObjects collect(*copyop.duplicate);
+        prototype->accept(collect);
+
+        bucket = copyop(prototype);
+    }
+
+    return bucket;
+}
+
+bool AnimationPhaseBuckets::play(AnimationManager& manager)
+{
+    if (!prototype) return false;
+
+    double duration = prototype->maxTime();
+
+    bool result = false;
+    for (size_t i = 0; i < _buckets.size(); ++i)
+    {
+        if (!_buckets[i]) continue;
+
+        double phase = duration * static_cast<double>(i) / static_cast<double>(numBuckets);
+        if (manager.play(_buckets[i], phase)) result = true;
+    }
+    return result;
+}
+
+bool AnimationPhaseBuckets::stop(AnimationManager& manager)
+{
+    bool result = false;
+    for (auto& bucket : _buckets)
+    {
+        if (bucket && manager.stop(bucket)) result = true;
+    }
+    return result;
+}
@@ -0,0 +1,104 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/animation/ComputeSkinning.h>
+#include <vsg/commands/Dispatch.h>
+#include <vsg/commands/PipelineBarrier.h>
+#include <vsg/io/Logger.h>
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/ComputePipeline.h>
+#include <vsg/state/DescriptorBuffer.h>
+#include <vsg/vk/Context.h>
+
+using namespace vsg;
+
+ComputeSkinning::ComputeSkinning()
+{
+}
+
+ComputeSkinning::~ComputeSkinning()
+{
+}
+
+bool ComputeSkinning::setup()
+{
+    if (!skinningShaderStage || !sourceVertices || !sourceNormals || !jointIndices || !jointWeights || !jointMatrices)
+    {
+        warn("ComputeSkinning::setup() requires skinningShaderStage, source arrays and jointMatrices to be assigned.");
+        return false;
+    }
+
+    uint32_t vertexCount = static_cast<uint32_t>(sourceVertices->valueCount());
+
+    auto params = uintValue::create(vertexCount);
+
+    skinnedVertices = BufferInfo::create();
+    skinnedNormals = BufferInfo::create();
+
+    auto paramsDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(params)}, 0, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    auto sourceVerticesDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(sourceVertices)}, 1, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto sourceNormalsDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(sourceNormals)}, 2, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto jointIndicesDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(jointIndices)}, 3, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto jointWeightsDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(jointWeights)}, 4, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto jointMatricesDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(jointMatrices)}, 5, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto skinnedVerticesDescriptor = DescriptorBuffer::create(BufferInfoList{skinnedVertices}, 6, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto skinnedNormalsDescriptor = DescriptorBuffer::create(BufferInfoList{skinnedNormals}, 7, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    DescriptorSetLayoutBindings descriptorBindings{
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {5, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {6, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {7, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+
+    auto descriptorSetLayout = DescriptorSetLayout::create(descriptorBindings);
+    auto pipelineLayout = PipelineLayout::create(DescriptorSetLayouts{descriptorSetLayout}, PushConstantRanges{});
+    auto pipeline = ComputePipeline::create(pipelineLayout, skinningShaderStage);
+    auto descriptorSet = DescriptorSet::create(descriptorSetLayout,
+                                               Descriptors{paramsDescriptor, sourceVerticesDescriptor, sourceNormalsDescriptor,
+                                                           jointIndicesDescriptor, jointWeightsDescriptor, jointMatricesDescriptor,
+                                                           skinnedVerticesDescriptor, skinnedNormalsDescriptor});
+
+    children.clear();
+    addChild(BindComputePipeline::create(pipeline));
+    addChild(BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, descriptorSet));
+    addChild(Dispatch::create((vertexCount + workgroupSize - 1) / workgroupSize, 1, 1));
+    addChild(PipelineBarrier::create(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0,
+                                     MemoryBarrier::create(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT)));
+
+    return true;
+}
+
+void ComputeSkinning::compile(Context& context)
+{
+    // allocate the skinned output buffers with combined storage/vertex usage before the descriptors
+    // referencing them are compiled, so the same buffers can be bound as vertex attributes
+    if (sourceVertices && skinnedVertices && !skinnedVertices->buffer)
+    {
+        VkDeviceSize size = sourceVertices->dataSize();
+        skinnedVertices->buffer = createBufferAndMemory(context.device, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        skinnedVertices->offset = 0;
+        skinnedVertices->range = size;
+    }
+    if (sourceNormals && skinnedNormals && !skinnedNormals->buffer)
+    {
+        VkDeviceSize size = sourceNormals->dataSize();
+        skinnedNormals->buffer = createBufferAndMemory(context.device, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        skinnedNormals->offset = 0;
+        skinnedNormals->range = size;
+    }
+
+    Commands::compile(context);
+}
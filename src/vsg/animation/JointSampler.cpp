@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/animation/JointSampler.h>
 #include <vsg/core/compare.h>
 #include <vsg/io/Input.h>
+#include <vsg/maths/transform.h>
 #include <vsg/io/Options.h>
 #include <vsg/io/Output.h>
 #include <vsg/nodes/MatrixTransform.h>
@@ -34,7 +35,8 @@ JointSampler::JointSampler(const JointSampler& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
     jointMatrices(copyop(rhs.jointMatrices)),
     offsetMatrices(rhs.offsetMatrices),
-    subgraph(copyop(rhs.subgraph))
+    subgraph(copyop(rhs.subgraph)),
+    jointDualQuaternions(copyop(rhs.jointDualQuaternions))
 {
 }
 
@@ -46,22 +48,129 @@ int JointSampler::compare(const Object& rhs_object) const
     auto& rhs = static_cast<decltype(*this)>(rhs_object);
     if ((result = compare_pointer(jointMatrices, rhs.jointMatrices)) != 0) return result;
     if ((result = compare_value_container(offsetMatrices, rhs.offsetMatrices)) != 0) return result;
-    return compare_pointer(subgraph, rhs.subgraph);
+    if ((result = compare_pointer(subgraph, rhs.subgraph)) != 0) return result;
+    return compare_pointer(jointDualQuaternions, rhs.jointDualQuaternions);
 }
 
 void JointSampler::update(double)
 {
-    if (!jointMatrices) return;
+    if ((!jointMatrices && !jointDualQuaternions) || !subgraph) return;
 
-    _matrixStack.clear();
-    _matrixStack.push_back(dmat4());
+    if (_flattenedSubgraph != subgraph.get()) flattenSubgraph();
 
-    if (subgraph)
+    const dmat4 identity;
+    bool changed = false;
+    bool dualQuaternionsChanged = false;
+
+    // evaluate the flattened skeleton in one linear pass, parents always precede their children
+    for (size_t i = 0; i < _flattenedNodes.size(); ++i)
     {
-        subgraph->accept(*this);
+        const auto& node = _flattenedNodes[i];
+        const dmat4& parentMatrix = (node.parent >= 0) ? _worldMatrices[node.parent] : identity;
+
+        if (node.localMatrix)
+            _worldMatrices[i] = parentMatrix * (*node.localMatrix);
+        else
+            _worldMatrices[i] = node.transform->transform(parentMatrix);
+
+        if (node.joint >= 0)
+        {
+            mat4 jointMatrix(_worldMatrices[i] * offsetMatrices[node.joint]);
+            if (jointMatrices && !(jointMatrices->at(node.joint) == jointMatrix))
+            {
+                jointMatrices->set(node.joint, jointMatrix);
+                changed = true;
+            }
+
+            if (jointDualQuaternions)
+            {
+                vec3 translation;
+                quat rotation;
+                vec3 scale;
+                decompose(jointMatrix, translation, rotation, scale);
+
+                // real part is the rotation, dual part encodes the translation, dual = 0.5 * t * r
+                quat dual = quat(translation.x, translation.y, translation.z, 0.0f) * rotation * 0.5f;
+
+                vec4 real_part(rotation.x, rotation.y, rotation.z, rotation.w);
+                vec4 dual_part(dual.x, dual.y, dual.z, dual.w);
+
+                size_t index = static_cast<size_t>(node.joint) * 2;
+                if (!(jointDualQuaternions->at(index) == real_part) || !(jointDualQuaternions->at(index + 1) == dual_part))
+                {
+                    jointDualQuaternions->set(index, real_part);
+                    jointDualQuaternions->set(index + 1, dual_part);
+                    dualQuaternionsChanged = true;
+                }
+            }
+        }
     }
 
-    jointMatrices->dirty();
+    // only schedule a transfer when the palettes have actually changed this frame
+    if (changed) jointMatrices->dirty();
+    if (dualQuaternionsChanged) jointDualQuaternions->dirty();
+}
+
+void JointSampler::flattenSubgraph()
+{
+    struct FlattenSubgraph : public Visitor
+    {
+        std::vector<FlattenedNode>& nodes;
+        int32_t parent = -1;
+
+        explicit FlattenSubgraph(std::vector<FlattenedNode>& in_nodes) :
+            nodes(in_nodes) {}
+
+        void apply(Node& node) override
+        {
+            node.traverse(*this);
+        }
+
+        void apply(Transform& transform) override
+        {
+            if (transform.children.empty()) return;
+
+            auto previousParent = parent;
+            parent = static_cast<int32_t>(nodes.size());
+            nodes.push_back(FlattenedNode{previousParent, -1, nullptr, &transform});
+
+            transform.traverse(*this);
+
+            parent = previousParent;
+        }
+
+        void apply(MatrixTransform& mt) override
+        {
+            if (mt.children.empty()) return;
+
+            auto previousParent = parent;
+            parent = static_cast<int32_t>(nodes.size());
+            nodes.push_back(FlattenedNode{previousParent, -1, &mt.matrix, nullptr});
+
+            mt.traverse(*this);
+
+            parent = previousParent;
+        }
+
+        void apply(Joint& joint) override
+        {
+            auto previousParent = parent;
+            parent = static_cast<int32_t>(nodes.size());
+            nodes.push_back(FlattenedNode{previousParent, static_cast<int32_t>(joint.index), &joint.matrix, nullptr});
+
+            joint.traverse(*this);
+
+            parent = previousParent;
+        }
+    };
+
+    _flattenedNodes.clear();
+
+    FlattenSubgraph flatten(_flattenedNodes);
+    subgraph->accept(flatten);
+
+    _worldMatrices.resize(_flattenedNodes.size());
+    _flattenedSubgraph = subgraph.get();
 }
 
 double JointSampler::maxTime() const
@@ -76,6 +185,11 @@ void JointSampler::read(Input& input)
     input.read("jointMatrices", jointMatrices);
     input.readValues("offsetMatrices", offsetMatrices);
     input.read("subgraph", subgraph);
+
+    if (input.version_greater_equal(1, 1, 5))
+    {
+        input.read("jointDualQuaternions", jointDualQuaternions);
+    }
 }
 
 void JointSampler::write(Output& output) const
@@ -84,6 +198,11 @@ void JointSampler::write(Output& output) const
     output.write("jointMatrices", jointMatrices);
     output.writeValues("offsetMatrices", offsetMatrices);
     output.write("subgraph", subgraph);
+
+    if (output.version_greater_equal(1, 1, 5))
+    {
+        output.write("jointDualQuaternions", jointDualQuaternions);
+    }
 }
 
 void JointSampler::apply(Node& node)
@@ -30,6 +30,18 @@ TransformKeyframes::TransformKeyframes()
 {
 }
 
+int TransformKeyframes::compare(const Object& rhs_object) const
+{
+    int result = Object::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    if ((result = compare_value(name, rhs.name)) != 0) return result;
+    if ((result = compare_value_container(positions, rhs.positions)) != 0) return result;
+    if ((result = compare_value_container(rotations, rhs.rotations)) != 0) return result;
+    return compare_value_container(scales, rhs.scales);
+}
+
 void TransformKeyframes::read(Input& input)
 {
     Object::read(input);
@@ -105,7 +117,7 @@ void TransformKeyframes::write(Output& output) const
 }
 
 template<typename T, typename V>
-bool sample(double time, const T& values, V& value)
+bool sample(double time, const T& values, V& value, size_t& cursor)
 {
     if (values.size() == 0) return false;
 
@@ -115,37 +127,56 @@ bool sample(double time, const T& values, V& value)
         return true;
     }
 
-    auto pos_itr = values.begin();
-    if (time <= pos_itr->time)
+    if (time <= values.front().time)
     {
-        value = pos_itr->value;
+        cursor = 1;
+        value = values.front().value;
         return true;
     }
-    else
+
+    if (time >= values.back().time)
     {
-        using value_type = typename T::value_type;
-        pos_itr = std::lower_bound(values.begin(), values.end(), time, [](const value_type& elem, double t) -> bool { return elem.time < t; });
+        cursor = values.size() - 1;
+        value = values.back().value;
+        return true;
+    }
+
+    using value_type = typename T::value_type;
+    auto compareTime = [](const value_type& elem, double t) -> bool { return elem.time < t; };
 
-        if (pos_itr == values.begin())
+    // start the search from the cached cursor, sequential playback usually advances it by at most one
+    // keyframe per sample, falling back to a binary search for large jumps such as loops and seeks
+    const size_t maxLinearSteps = 4;
+    size_t i = (cursor > 0 && cursor < values.size()) ? cursor : 1;
+    if (values[i].time < time)
+    {
+        size_t limit = std::min(values.size() - 1, i + maxLinearSteps);
+        while (i < limit && values[i].time < time) ++i;
+        if (values[i].time < time)
         {
-            value = values.front().value;
-            return true;
+            i = static_cast<size_t>(std::lower_bound(values.begin() + i, values.end(), time, compareTime) - values.begin());
         }
-
-        if (pos_itr == values.end())
+    }
+    else if (values[i - 1].time >= time)
+    {
+        size_t limit = (i > maxLinearSteps) ? i - maxLinearSteps : 1;
+        while (i > limit && values[i - 1].time >= time) --i;
+        if (values[i - 1].time >= time)
         {
-            value = values.back().value;
-            return true;
+            i = static_cast<size_t>(std::lower_bound(values.begin(), values.begin() + i, time, compareTime) - values.begin());
+            if (i == 0) i = 1;
         }
+    }
+    cursor = i;
 
-        auto before_pos_itr = pos_itr - 1;
-        double delta_time = (pos_itr->time - before_pos_itr->time);
-        double r = delta_time != 0.0 ? (time - before_pos_itr->time) / delta_time : 0.5;
+    const auto& before = values[i - 1];
+    const auto& after = values[i];
+    double delta_time = (after.time - before.time);
+    double r = delta_time != 0.0 ? (time - before.time) / delta_time : 0.5;
 
-        value = mix(before_pos_itr->value, pos_itr->value, r);
+    value = mix(before.value, after.value, r);
 
-        return true;
-    }
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,9 +217,9 @@ void TransformSampler::update(double time)
 {
     if (keyframes)
     {
-        sample(time, keyframes->positions, position);
-        sample(time, keyframes->rotations, rotation);
-        sample(time, keyframes->scales, scale);
+        sample(time, keyframes->positions, position, _positionCursor);
+        sample(time, keyframes->rotations, rotation, _rotationCursor);
+        sample(time, keyframes->scales, scale, _scaleCursor);
     }
 
     if (object) object->accept(*this);
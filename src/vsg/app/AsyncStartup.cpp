@@ -0,0 +1,71 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/AsyncStartup.h>
+#include <vsg/io/read.h>
+
+#include <functional>
+
+using namespace vsg;
+
+namespace
+{
+    struct FunctionOperation : public Inherit<Operation, FunctionOperation>
+    {
+        explicit FunctionOperation(std::function<void()> in_function) :
+            function(std::move(in_function)) {}
+
+        std::function<void()> function;
+
+        void run() override { function(); }
+    };
+} // namespace
+
+AsyncStartup::AsyncStartup(uint32_t numThreads) :
+    taskGraph(TaskGraph::create(numThreads))
+{
+}
+
+AsyncStartup::~AsyncStartup()
+{
+    if (taskGraph) taskGraph->stop();
+}
+
+ref_ptr<Task> AsyncStartup::beginDeviceCreation(ref_ptr<Window> window)
+{
+    return taskGraph->add(FunctionOperation::create([window]() {
+        window->getOrCreateDevice();
+    }));
+}
+
+ref_ptr<Task> AsyncStartup::beginLoad(const Paths& filenames, ref_ptr<const Options> options)
+{
+    return taskGraph->add(FunctionOperation::create([this, filenames, options]() {
+        loadedObjects = readShared(filenames, options);
+    }));
+}
+
+ref_ptr<Task> AsyncStartup::begin(ref_ptr<Operation> operation, const std::vector<ref_ptr<Task>>& dependencies)
+{
+    return taskGraph->add(operation, dependencies);
+}
+
+void AsyncStartup::wait()
+{
+    taskGraph->run();
+}
+
+ref_ptr<Object> AsyncStartup::loadedObject(const Path& filename) const
+{
+    auto itr = loadedObjects.find(filename);
+    return (itr != loadedObjects.end()) ? itr->second : ref_ptr<Object>();
+}
@@ -11,16 +11,87 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/app/CommandGraph.h>
+#include <vsg/app/LODPolicy.h>
 #include <vsg/app/RenderGraph.h>
+#include <vsg/app/SecondaryCommandGraph.h>
 #include <vsg/app/View.h>
 #include <vsg/io/DatabasePager.h>
 #include <vsg/state/ViewDependentState.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/ui/ApplicationEvent.h>
 #include <vsg/utils/ShaderSet.h>
 #include <vsg/vk/State.h>
 
+#include <functional>
+
 using namespace vsg;
 
+namespace
+{
+    /// Operation that records a SecondaryCommandGraph on one of the CommandGraph::recordThreads
+    struct RecordSecondaryOperation : public Inherit<Operation, RecordSecondaryOperation>
+    {
+        RecordSecondaryOperation(ref_ptr<SecondaryCommandGraph> in_commandGraph, ref_ptr<RecordedCommandBuffers> in_recordedCommandBuffers, ref_ptr<FrameStamp> in_frameStamp, ref_ptr<DatabasePager> in_databasePager) :
+            commandGraph(in_commandGraph),
+            recordedCommandBuffers(in_recordedCommandBuffers),
+            frameStamp(in_frameStamp),
+            databasePager(in_databasePager)
+        {
+        }
+
+        ref_ptr<SecondaryCommandGraph> commandGraph;
+        ref_ptr<RecordedCommandBuffers> recordedCommandBuffers;
+        ref_ptr<FrameStamp> frameStamp;
+        ref_ptr<DatabasePager> databasePager;
+
+        void run() override
+        {
+            commandGraph->record(recordedCommandBuffers, frameStamp, databasePager);
+        }
+    };
+
+    /// collects a hash of the camera and mask state that shapes a CommandGraph's recording,
+    /// deliberately not descending into the scene subgraph below each View - structural edits
+    /// there are covered by CommandGraph::markRecordingDirty().
+    struct CollectRecordFingerprint : public ConstVisitor
+    {
+        std::size_t hash = 1; // non zero so an unchanged graph never matches the forced dirty value of 0
+
+        void combine(std::size_t value)
+        {
+            hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+        }
+
+        void combine(const dmat4& matrix)
+        {
+            auto ptr = matrix.data();
+            for (size_t i = 0; i < 16; ++i) combine(std::hash<double>{}(ptr[i]));
+        }
+
+        void apply(const Object& object) override
+        {
+            object.traverse(*this);
+        }
+
+        void apply(const RenderGraph& renderGraph) override
+        {
+            combine(std::hash<int64_t>{}((static_cast<int64_t>(renderGraph.renderArea.offset.x) << 32) ^ renderGraph.renderArea.offset.y));
+            combine(std::hash<uint64_t>{}((static_cast<uint64_t>(renderGraph.renderArea.extent.width) << 32) ^ renderGraph.renderArea.extent.height));
+            renderGraph.traverse(*this);
+        }
+
+        void apply(const View& view) override
+        {
+            combine(std::hash<uint32_t>{}(static_cast<uint32_t>(view.mask)));
+            if (view.camera)
+            {
+                if (view.camera->projectionMatrix) combine(view.camera->projectionMatrix->transform());
+                if (view.camera->viewMatrix) combine(view.camera->viewMatrix->transform());
+            }
+        }
+    };
+} // namespace
+
 CommandGraph::CommandGraph()
 {
     CPU_INSTRUMENTATION_L1(instrumentation);
@@ -81,6 +152,36 @@ void CommandGraph::record(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers
         return;
     }
 
+    if (conditionalRecord && !databasePager)
+    {
+        CollectRecordFingerprint fingerprint;
+        traverse(fingerprint);
+
+        if (fingerprint.hash == _lastFingerprint && _lastRecordedCommandBuffer && _lastRecordedCommandBuffer->numDependentSubmissions().load() == 0)
+        {
+            // nothing that shapes the recording has changed, resubmit the previous recording
+            _lastRecordedCommandBuffer->numDependentSubmissions().fetch_add(1);
+            recordedCommandBuffers->add(submitOrder, _lastRecordedCommandBuffer);
+            return;
+        }
+
+        _lastFingerprint = fingerprint.hash;
+    }
+
+    if (recordThreads && !secondaryCommandGraphs.empty())
+    {
+        // dispatch the recording of the secondary command buffers across the recordThreads,
+        // the ExecuteCommands nodes within the subgraph block until the associated recordings have completed.
+        for (auto& secondaryCommandGraph : secondaryCommandGraphs)
+        {
+            secondaryCommandGraph->reset();
+        }
+        for (auto& secondaryCommandGraph : secondaryCommandGraphs)
+        {
+            recordThreads->add(RecordSecondaryOperation::create(secondaryCommandGraph, recordedCommandBuffers, frameStamp, databasePager));
+        }
+    }
+
     // create the RecordTraversal if it isn't already created
     getOrCreateRecordTraversal();
 
@@ -93,7 +194,12 @@ void CommandGraph::record(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers
     recordTraversal->setFrameStamp(frameStamp);
     recordTraversal->setDatabasePager(databasePager);
     recordTraversal->clearBins();
+
+    // reclaim all the per-frame transient allocations from the previous frame in one go,
+    // making sure no container still references the arena before it's released.
     recordTraversal->regionsOfInterest.clear();
+    recordTraversal->regionsOfInterest.shrink_to_fit();
+    if (recordTraversal->frameAllocator) recordTraversal->frameAllocator->release();
 
     ref_ptr<CommandBuffer> commandBuffer;
     for (auto& cb : _commandBuffers)
@@ -118,6 +224,10 @@ void CommandGraph::record(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers
     commandBuffer->numDependentSubmissions().fetch_add(1);
 
     recordTraversal->getState()->_commandBuffer = commandBuffer;
+    recordTraversal->getState()->combineMatrixPushConstants = recordTraversal->useCombinedMatrixPushConstants;
+    recordTraversal->getState()->reset();
+
+    if (recordTraversal->lodPolicy) recordTraversal->lodPolicy->beginFrame();
 
     // or select index when maps to a dormant CommandBuffer
     VkCommandBuffer vk_commandBuffer = *commandBuffer;
@@ -126,7 +236,8 @@ void CommandGraph::record(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers
     // if we are nested within a CommandBuffer already then use VkCommandBufferInheritanceInfo
     VkCommandBufferBeginInfo beginInfo = {};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    // conditional record resubmits previous recordings, so they can't promise one time submission
+    beginInfo.flags = conditionalRecord ? 0 : VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     beginInfo.pInheritanceInfo = nullptr;
 
     vkBeginCommandBuffer(vk_commandBuffer, &beginInfo);
@@ -138,6 +249,8 @@ void CommandGraph::record(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers
 
     vkEndCommandBuffer(vk_commandBuffer);
 
+    if (conditionalRecord) _lastRecordedCommandBuffer = commandBuffer;
+
     recordedCommandBuffers->add(submitOrder, commandBuffer);
 }
 
@@ -16,9 +16,15 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Exception.h>
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
+#include <vsg/nodes/Group.h>
 #include <vsg/state/ViewDependentState.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/utils/ShaderSet.h>
 
+#include <algorithm>
+#include <mutex>
+
 using namespace vsg;
 
 void CompileResult::reset()
@@ -67,7 +73,7 @@ bool CompileResult::requiresViewerUpdate() const
     return false;
 }
 
-CompileManager::CompileManager(Viewer& viewer, ref_ptr<ResourceHints> hints)
+CompileManager::CompileManager(Viewer& viewer, ref_ptr<ResourceHints> hints, size_t in_numCompileTraversals)
 {
     compileTraversals = CompileTraversals::create(viewer.status);
 
@@ -75,14 +81,31 @@ CompileManager::CompileManager(Viewer& viewer, ref_ptr<ResourceHints> hints)
 
     auto ct = CompileTraversal::create(viewer, requirements);
     compileTraversals->add(ct);
-#if 0
-    compileTraversals->add(CompileTraversal::create(*ct));
-    compileTraversals->add(CompileTraversal::create(*ct));
-    compileTraversals->add(CompileTraversal::create(*ct));
-    numCompileTraversals = 4;
-#else
-    numCompileTraversals = 1;
-#endif
+
+    numCompileTraversals = std::max(size_t(1), in_numCompileTraversals);
+    for (size_t i = 1; i < numCompileTraversals; ++i)
+    {
+        compileTraversals->add(CompileTraversal::create(*ct));
+    }
+}
+
+void CompileManager::reserveCompileTraversals(size_t count)
+{
+    if (count <= numCompileTraversals) return;
+
+    // take the existing traversals both to use one as the prototype for the clones and to make sure
+    // none are in flight while the pool is grown
+    auto cts = takeCompileTraversals(numCompileTraversals);
+    if (cts.empty()) return;
+
+    for (size_t i = numCompileTraversals; i < count; ++i)
+    {
+        compileTraversals->add(CompileTraversal::create(*cts.front()));
+    }
+
+    numCompileTraversals = count;
+
+    for (auto& ct : cts) compileTraversals->add(ct);
 }
 
 CompileManager::CompileTraversals::container_type CompileManager::takeCompileTraversals(size_t count)
@@ -100,6 +123,16 @@ CompileManager::CompileTraversals::container_type CompileManager::takeCompileTra
     return cts;
 }
 
+ref_ptr<ResourceHints> CompileManager::accumulatedResourceHints() const
+{
+    std::scoped_lock lock(_accumulatedResourceHintsMutex);
+    if (!_accumulatedResourceHints) return {};
+
+    auto hints = ResourceHints::create();
+    hints->add(*_accumulatedResourceHints);
+    return hints;
+}
+
 void CompileManager::add(ref_ptr<Device> device, const ResourceRequirements& resourceRequirements)
 {
     auto cts = takeCompileTraversals(numCompileTraversals);
@@ -186,6 +219,16 @@ CompileResult CompileManager::compile(ref_ptr<Object> object, ContextSelectionFu
     // if no CompileTraversals are available abort compile
     if (!compileTraversal) return result;
 
+    // accumulate the collected requirements so Viewer::captureResourceHints() can persist them for future runs
+    {
+        auto hints = collectRequirements.createResourceHints();
+        std::scoped_lock lock(_accumulatedResourceHintsMutex);
+        if (!_accumulatedResourceHints)
+            _accumulatedResourceHints = hints;
+        else
+            _accumulatedResourceHints->add(*hints);
+    }
+
     auto run_compile_traversal = [&]() -> void {
         try
         {
@@ -260,3 +303,65 @@ CompileResult CompileManager::compile(ref_ptr<Object> object, ContextSelectionFu
 
     return result;
 }
+
+CompileResult CompileManager::compile(ref_ptr<Object> object, ref_ptr<OperationThreads> operationThreads, ContextSelectionFunction contextSelection)
+{
+    // partition at the top level group, compiling each child subgraph as its own task. Only partition plain
+    // Groups as subclasses like StateGroup carry their own state that must be compiled with their children.
+    auto group = object.cast<Group>();
+    bool partition = operationThreads && group && group->type_info() == typeid(Group) && group->children.size() > 1 && numCompileTraversals > 1;
+
+    if (!partition)
+    {
+        return compile(object, contextSelection);
+    }
+
+    struct CompileOperation : public Operation
+    {
+        CompileOperation(CompileManager& cm, ref_ptr<Object> obj, ContextSelectionFunction cs, CompileResult& cr, std::mutex& m, ref_ptr<Latch> l) :
+            compileManager(cm),
+            object(obj),
+            contextSelection(cs),
+            overallResult(cr),
+            resultMutex(m),
+            latch(l) {}
+
+        void run() override
+        {
+            auto result = compileManager.compile(object, contextSelection);
+            {
+                std::scoped_lock lock(resultMutex);
+                overallResult.add(result);
+            }
+            latch->count_down();
+        }
+
+        CompileManager& compileManager;
+        ref_ptr<Object> object;
+        ContextSelectionFunction contextSelection;
+        CompileResult& overallResult;
+        std::mutex& resultMutex;
+        ref_ptr<Latch> latch;
+    };
+
+    CompileResult overallResult;
+    std::mutex resultMutex;
+
+    // use latch to synchronize this thread with the compile tasks
+    auto latch = Latch::create(group->children.size());
+
+    // add operations, each taking its own CompileTraversal from the pool when run, with the
+    // Vulkan queue submissions serialized by the per Queue mutex.
+    for (auto& child : group->children)
+    {
+        operationThreads->add(ref_ptr<Operation>(new CompileOperation(*this, child, contextSelection, overallResult, resultMutex, latch)));
+    }
+
+    // use this thread to compile subgraphs as well
+    operationThreads->run();
+
+    // wait till all the compile operations have completed
+    latch->wait();
+
+    return overallResult;
+}
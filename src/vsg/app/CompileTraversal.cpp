@@ -21,6 +21,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/commands/Commands.h>
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/Group.h>
+#include <vsg/nodes/OcclusionQueryNode.h>
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/state/MultisampleState.h>
 #include <vsg/state/ViewDependentState.h>
@@ -28,6 +29,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/RenderPass.h>
 #include <vsg/vk/State.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 CompileTraversal::CompileTraversal(const CompileTraversal& ct) :
@@ -204,6 +207,13 @@ void CompileTraversal::add(const Viewer& viewer, const ResourceRequirements& res
             cg->accept(addViews);
         }
     }
+
+    // propagate the viewer's frames in flight setting so that per frame rings compiled for the scene
+    // are sized consistently with the RecordAndSubmitTask's per frame rings
+    for (auto& context : contexts)
+    {
+        context->framesInFlight = std::max(viewer.framesInFlight, 1u);
+    }
 }
 
 void CompileTraversal::addViewDependentState(ViewDependentState& viewDependentState, const ResourceRequirements& resourceRequirements)
@@ -263,6 +273,23 @@ void CompileTraversal::apply(Geometry& geometry)
     geometry.traverse(*this);
 }
 
+void CompileTraversal::apply(OcclusionQueryNode& oqn)
+{
+    CPU_INSTRUMENTATION_L3_NC(instrumentation, "CompileTraversal OcclusionQueryNode", COLOR_COMPILE);
+
+    // size the query pool to cover the frames in flight before RecordTraversal lazily compiles it,
+    // one extra slot so the oldest query polled is never the one being recorded
+    if (oqn.queryPool && !oqn.queryPool->vk())
+    {
+        for (auto& context : contexts)
+        {
+            oqn.queryPool->queryCount = std::max(oqn.queryPool->queryCount, context->framesInFlight + 1);
+        }
+    }
+
+    oqn.traverse(*this);
+}
+
 void CompileTraversal::apply(CommandGraph& commandGraph)
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "CompileTraversal CommandGraph", COLOR_COMPILE);
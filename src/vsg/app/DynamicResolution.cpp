@@ -0,0 +1,129 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/DynamicResolution.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/vk/PhysicalDevice.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace vsg;
+
+DynamicResolution::DynamicResolution(uint32_t numFramesInFlight) :
+    _numSlots(std::max(numFramesInFlight, 2u))
+{
+    _queryPool = QueryPool::create();
+    _queryPool->queryType = VK_QUERY_TYPE_TIMESTAMP;
+    _queryPool->queryCount = _numSlots * 2;
+
+    beginTiming = Timing::create(this, true);
+    endTiming = Timing::create(this, false);
+}
+
+DynamicResolution::~DynamicResolution()
+{
+}
+
+DynamicResolution::Timing::Timing(DynamicResolution* in_dynamicResolution, bool in_begin) :
+    _dynamicResolution(in_dynamicResolution),
+    _begin(in_begin)
+{
+}
+
+void DynamicResolution::Timing::compile(Context& context)
+{
+    _dynamicResolution->_queryPool->compile(context);
+    _dynamicResolution->_device = context.device;
+}
+
+void DynamicResolution::Timing::record(CommandBuffer& commandBuffer) const
+{
+    auto& queryPool = *_dynamicResolution->_queryPool;
+    uint32_t firstQuery = _dynamicResolution->_currentSlot * 2;
+
+    if (_begin)
+    {
+        vkCmdResetQueryPool(commandBuffer, queryPool, firstQuery, 2);
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryPool, firstQuery);
+    }
+    else
+    {
+        vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryPool, firstQuery + 1);
+    }
+}
+
+void DynamicResolution::run()
+{
+    if (!_device) return; // not yet compiled
+
+    // advance to the slot the upcoming record traversal will write its timestamps into
+    if (_framesRecorded > 0) _currentSlot = (_currentSlot + 1) % _numSlots;
+    ++_framesRecorded;
+
+    // read the oldest slot - its frame has had _numSlots-1 frames to complete on the GPU, so on the
+    // common path the results are available without ever blocking on the query
+    if (_framesRecorded <= _numSlots) return;
+
+    uint32_t readSlot = (_currentSlot + 1) % _numSlots;
+    std::vector<uint64_t> timestamps(2);
+    if (_queryPool->getResults(timestamps, readSlot * 2, VK_QUERY_RESULT_64_BIT) != VK_SUCCESS) return;
+    if (timestamps[1] <= timestamps[0]) return;
+
+    double timestampPeriod = static_cast<double>(_device->getPhysicalDevice()->getProperties().limits.timestampPeriod);
+    double measured = static_cast<double>(timestamps[1] - timestamps[0]) * timestampPeriod * 1e-9;
+
+    _gpuFrameTime = (_gpuFrameTime > 0.0) ? (_gpuFrameTime * smoothing + measured * (1.0 - smoothing)) : measured;
+
+    if (targetFrameTime <= 0.0 || _gpuFrameTime <= 0.0) return;
+
+    // GPU time is roughly proportional to the rendered area, so scale each axis by the square root of
+    // the frame time ratio to converge on the target in one step
+    double newScale = static_cast<double>(_scale) * std::sqrt(targetFrameTime * headroom / _gpuFrameTime);
+    newScale = std::min(std::max(newScale, static_cast<double>(minScale)), static_cast<double>(maxScale));
+
+    if (std::abs(newScale - static_cast<double>(_scale)) < deadband * static_cast<double>(_scale)) return;
+
+    _scale = static_cast<float>(newScale);
+    applyScale();
+}
+
+void DynamicResolution::applyScale()
+{
+    uint32_t width = std::max(1u, static_cast<uint32_t>(static_cast<float>(fullExtent.width) * _scale));
+    uint32_t height = std::max(1u, static_cast<uint32_t>(static_cast<float>(fullExtent.height) * _scale));
+
+    if (renderGraph)
+    {
+        renderGraph->renderArea.extent = VkExtent2D{width, height};
+    }
+
+    if (setViewport && !setViewport->viewports.empty())
+    {
+        auto& viewport = setViewport->viewports.front();
+        viewport.width = static_cast<float>(width);
+        viewport.height = static_cast<float>(height);
+    }
+
+    if (setScissor && !setScissor->scissors.empty())
+    {
+        setScissor->scissors.front().extent = VkExtent2D{width, height};
+    }
+
+    if (upscaleBlit && !upscaleBlit->regions.empty())
+    {
+        auto& srcOffset = upscaleBlit->regions.front().srcOffsets[1];
+        srcOffset.x = static_cast<int32_t>(width);
+        srcOffset.y = static_cast<int32_t>(height);
+    }
+}
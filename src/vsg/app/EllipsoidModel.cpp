@@ -13,9 +13,33 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/EllipsoidModel.h>
 #include <vsg/io/Options.h>
 #include <vsg/maths/transform.h>
+#include <vsg/threading/Latch.h>
+
+#include <algorithm>
+#include <functional>
 
 using namespace vsg;
 
+namespace
+{
+    // block of a batch conversion distributed across OperationThreads and joined via a shared Latch
+    struct ConvertBlockOperation : public vsg::Inherit<Operation, ConvertBlockOperation>
+    {
+        ConvertBlockOperation(std::function<void()> in_convert, ref_ptr<Latch> in_latch) :
+            convert(std::move(in_convert)),
+            latch(in_latch) {}
+
+        std::function<void()> convert;
+        ref_ptr<Latch> latch;
+
+        void run() override
+        {
+            convert();
+            latch->count_down();
+        }
+    };
+} // namespace
+
 EllipsoidModel::EllipsoidModel(double rEquator, double rPolar) :
     _radiusEquator(rEquator),
     _radiusPolar(rPolar)
@@ -118,6 +142,80 @@ dvec3 EllipsoidModel::convertECEFToLatLongAltitude(const dvec3& ecef) const
     return dvec3(degrees(latitude), degrees(longitude), height);
 }
 
+void EllipsoidModel::convertLatLongAltitudeToECEF(const dvec3* lla, dvec3* ecef, size_t count) const
+{
+    // hoist the ellipsoid constants out of the loop, keeping the loop body branch free so
+    // compilers can unroll and vectorize the sin/cos/sqrt work across iterations
+    const double radiusEquator = _radiusEquator;
+    const double eccentricitySquared = _eccentricitySquared;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double latitude = radians(lla[i][0]);
+        const double longitude = radians(lla[i][1]);
+        const double height = lla[i][2];
+
+        double sin_latitude = sin(latitude);
+        double cos_latitude = cos(latitude);
+        double N = radiusEquator / sqrt(1.0 - eccentricitySquared * sin_latitude * sin_latitude);
+        ecef[i].set((N + height) * cos_latitude * cos(longitude),
+                    (N + height) * cos_latitude * sin(longitude),
+                    (N * (1 - eccentricitySquared) + height) * sin_latitude);
+    }
+}
+
+void EllipsoidModel::convertECEFToLatLongAltitude(const dvec3* ecef, dvec3* lla, size_t count) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        lla[i] = convertECEFToLatLongAltitude(ecef[i]);
+    }
+}
+
+void EllipsoidModel::convertLatLongAltitudeToECEF(const dvec3* lla, dvec3* ecef, size_t count, ref_ptr<OperationThreads> operationThreads, size_t blockSize) const
+{
+    if (!operationThreads || blockSize == 0 || count <= blockSize)
+    {
+        convertLatLongAltitudeToECEF(lla, ecef, count);
+        return;
+    }
+
+    size_t numBlocks = (count + blockSize - 1) / blockSize;
+    auto latch = Latch::create(numBlocks);
+    for (size_t block = 0; block < numBlocks; ++block)
+    {
+        size_t offset = block * blockSize;
+        size_t blockCount = std::min(blockSize, count - offset);
+        operationThreads->add(ConvertBlockOperation::create([=]() { convertLatLongAltitudeToECEF(lla + offset, ecef + offset, blockCount); }, latch));
+    }
+
+    // help out with the processing of the blocks and wait for all of them to complete
+    operationThreads->run();
+    latch->wait();
+}
+
+void EllipsoidModel::convertECEFToLatLongAltitude(const dvec3* ecef, dvec3* lla, size_t count, ref_ptr<OperationThreads> operationThreads, size_t blockSize) const
+{
+    if (!operationThreads || blockSize == 0 || count <= blockSize)
+    {
+        convertECEFToLatLongAltitude(ecef, lla, count);
+        return;
+    }
+
+    size_t numBlocks = (count + blockSize - 1) / blockSize;
+    auto latch = Latch::create(numBlocks);
+    for (size_t block = 0; block < numBlocks; ++block)
+    {
+        size_t offset = block * blockSize;
+        size_t blockCount = std::min(blockSize, count - offset);
+        operationThreads->add(ConvertBlockOperation::create([=]() { convertECEFToLatLongAltitude(ecef + offset, lla + offset, blockCount); }, latch));
+    }
+
+    // help out with the processing of the blocks and wait for all of them to complete
+    operationThreads->run();
+    latch->wait();
+}
+
 dmat4 EllipsoidModel::computeLocalToWorldTransform(const dvec3& lla) const
 {
     dvec3 ecef = convertLatLongAltitudeToECEF(lla);
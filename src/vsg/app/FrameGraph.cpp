@@ -0,0 +1,222 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/FrameGraph.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/state/ImageView.h>
+
+#include <map>
+#include <vector>
+
+using namespace vsg;
+
+FrameGraph::FrameGraph()
+{
+}
+
+FrameGraph::~FrameGraph()
+{
+}
+
+void FrameGraph::Pass::read(ref_ptr<Image> image, VkPipelineStageFlags stageMask, VkAccessFlags accessMask, VkImageLayout layout)
+{
+    usage.push_back(ResourceUsage{image, {}, stageMask, accessMask, layout, false});
+}
+
+void FrameGraph::Pass::write(ref_ptr<Image> image, VkPipelineStageFlags stageMask, VkAccessFlags accessMask, VkImageLayout layout)
+{
+    usage.push_back(ResourceUsage{image, {}, stageMask, accessMask, layout, true});
+}
+
+void FrameGraph::Pass::read(ref_ptr<Buffer> buffer, VkPipelineStageFlags stageMask, VkAccessFlags accessMask)
+{
+    usage.push_back(ResourceUsage{{}, buffer, stageMask, accessMask, VK_IMAGE_LAYOUT_UNDEFINED, false});
+}
+
+void FrameGraph::Pass::write(ref_ptr<Buffer> buffer, VkPipelineStageFlags stageMask, VkAccessFlags accessMask)
+{
+    usage.push_back(ResourceUsage{{}, buffer, stageMask, accessMask, VK_IMAGE_LAYOUT_UNDEFINED, true});
+}
+
+ref_ptr<FrameGraph::Pass> FrameGraph::addPass(ref_ptr<Node> node)
+{
+    auto pass = Pass::create();
+    pass->node = node;
+    passes.push_back(pass);
+    return pass;
+}
+
+ref_ptr<Group> FrameGraph::build() const
+{
+    size_t numPasses = passes.size();
+
+    // build the dependency edges - pass j depends on earlier pass i when they touch the same resource
+    // and at least one of them writes it, or an image use requires a different layout
+    auto sharesDependency = [](const Pass& earlier, const Pass& later) -> bool {
+        for (auto& eu : earlier.usage)
+        {
+            for (auto& lu : later.usage)
+            {
+                if (eu.image.get() != lu.image.get() || eu.buffer.get() != lu.buffer.get()) continue;
+                if (eu.write || lu.write) return true;
+                if (eu.image && eu.layout != lu.layout) return true;
+            }
+        }
+        return false;
+    };
+
+    std::vector<std::vector<size_t>> dependencies(numPasses);
+    for (size_t j = 0; j < numPasses; ++j)
+    {
+        for (size_t i = 0; i < j; ++i)
+        {
+            if (sharesDependency(*passes[i], *passes[j])) dependencies[j].push_back(i);
+        }
+    }
+
+    // reorder the passes - repeatedly emit the earliest pass whose dependencies have all been emitted,
+    // preferring one that doesn't depend on the most recently emitted pass so that dependent passes are
+    // pushed apart, giving the GPU other work to overlap with while a pass's results are produced.
+    std::vector<size_t> order;
+    order.reserve(numPasses);
+    std::vector<bool> emitted(numPasses, false);
+
+    while (order.size() < numPasses)
+    {
+        size_t selected = numPasses;
+        size_t fallback = numPasses;
+        for (size_t j = 0; j < numPasses; ++j)
+        {
+            if (emitted[j]) continue;
+
+            bool ready = true;
+            bool dependsOnPrevious = false;
+            for (auto i : dependencies[j])
+            {
+                if (!emitted[i]) ready = false;
+                if (!order.empty() && i == order.back()) dependsOnPrevious = true;
+            }
+            if (!ready) continue;
+
+            if (fallback == numPasses) fallback = j;
+            if (!dependsOnPrevious)
+            {
+                selected = j;
+                break;
+            }
+        }
+
+        order.push_back(selected != numPasses ? selected : fallback);
+        emitted[order.back()] = true;
+    }
+
+    // walk the emitted order tracking the state of each resource and computing the minimal barrier each
+    // pass requires. The first use of a resource emits no barrier - the resource is expected to already be
+    // in its first declared layout, arranged at compile time or by the previous frame for cyclic frame graphs.
+    struct ResourceState
+    {
+        bool first = true;
+        VkPipelineStageFlags pendingWriteStageMask = 0; // stages of the last write
+        VkAccessFlags pendingWriteAccessMask = 0;       // access of the last write
+        VkPipelineStageFlags visibleStageMask = 0;      // stages the last write has been made visible to by earlier barriers
+        VkAccessFlags visibleAccessMask = 0;            // access types the last write has been made visible to
+        VkPipelineStageFlags readStageMask = 0;         // stages that have read since the last write
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    };
+    std::map<const Object*, ResourceState> resourceStates;
+
+    auto group = Group::create();
+
+    for (auto passIndex : order)
+    {
+        auto& pass = *passes[passIndex];
+
+        ref_ptr<PipelineBarrier> barrier;
+        auto getBarrier = [&]() -> PipelineBarrier& {
+            if (!barrier)
+            {
+                barrier = PipelineBarrier::create();
+                barrier->srcStageMask = 0;
+                barrier->dstStageMask = 0;
+                barrier->dependencyFlags = 0;
+            }
+            return *barrier;
+        };
+
+        for (auto& usage : pass.usage)
+        {
+            const Object* resource = usage.image ? static_cast<const Object*>(usage.image.get()) : static_cast<const Object*>(usage.buffer.get());
+            if (!resource) continue;
+
+            auto& state = resourceStates[resource];
+            if (state.first)
+            {
+                state.first = false;
+                if (usage.image) state.layout = usage.layout;
+            }
+            else
+            {
+                bool layoutChange = usage.image && state.layout != usage.layout;
+                bool needsVisibility = state.pendingWriteStageMask != 0 &&
+                                       ((usage.stageMask & ~state.visibleStageMask) != 0 || (usage.accessMask & ~state.visibleAccessMask) != 0);
+                bool writeAfterRead = usage.write && state.readStageMask != 0;
+
+                if (layoutChange || needsVisibility || writeAfterRead)
+                {
+                    auto& pb = getBarrier();
+                    VkPipelineStageFlags srcStageMask = state.pendingWriteStageMask;
+                    if (usage.write || layoutChange) srcStageMask |= state.readStageMask;
+                    if (srcStageMask == 0) srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+                    pb.srcStageMask |= srcStageMask;
+                    pb.dstStageMask |= usage.stageMask;
+
+                    if (usage.image)
+                    {
+                        VkImageSubresourceRange subresourceRange{computeAspectFlagsForFormat(usage.image->format), 0, usage.image->mipLevels, 0, usage.image->arrayLayers};
+                        pb.add(ImageMemoryBarrier::create(state.pendingWriteAccessMask, usage.accessMask, state.layout, usage.layout,
+                                                          VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, usage.image, subresourceRange));
+                    }
+                    else
+                    {
+                        pb.add(BufferMemoryBarrier::create(state.pendingWriteAccessMask, usage.accessMask,
+                                                           VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, usage.buffer, 0, VK_WHOLE_SIZE));
+                    }
+
+                    state.visibleStageMask |= usage.stageMask;
+                    state.visibleAccessMask |= usage.accessMask;
+                    state.layout = usage.layout;
+                }
+            }
+
+            // update the tracked state - a write invalidates the visibility of all previous accesses
+            if (usage.write)
+            {
+                state.pendingWriteStageMask = usage.stageMask;
+                state.pendingWriteAccessMask = usage.accessMask;
+                state.visibleStageMask = 0;
+                state.visibleAccessMask = 0;
+                state.readStageMask = 0;
+            }
+            else
+            {
+                state.readStageMask |= usage.stageMask;
+            }
+        }
+
+        if (barrier) group->addChild(barrier);
+        if (pass.node) group->addChild(pass.node);
+    }
+
+    return group;
+}
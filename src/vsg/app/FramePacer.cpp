@@ -0,0 +1,91 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/FramePacer.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+
+#include <thread>
+
+using namespace vsg;
+
+FramePacer::FramePacer(double in_targetFrameDuration) :
+    targetFrameDuration(in_targetFrameDuration)
+{
+}
+
+bool FramePacer::assignRefreshRate(Window& window)
+{
+#if defined(VK_GOOGLE_display_timing)
+    auto device = window.getOrCreateDevice();
+    auto swapchain = window.getOrCreateSwapchain();
+
+    PFN_vkGetRefreshCycleDurationGOOGLE vkGetRefreshCycleDurationGOOGLE = nullptr;
+    device->getProcAddr(vkGetRefreshCycleDurationGOOGLE, "vkGetRefreshCycleDurationGOOGLE");
+    if (!vkGetRefreshCycleDurationGOOGLE)
+    {
+        warn("FramePacer::assignRefreshRate(..) VK_GOOGLE_display_timing extension not available, retaining targetFrameDuration of ", targetFrameDuration);
+        return false;
+    }
+
+    VkRefreshCycleDurationGOOGLE refreshCycleDuration = {};
+    if (VkResult result = vkGetRefreshCycleDurationGOOGLE(*device, *swapchain, &refreshCycleDuration); result != VK_SUCCESS || refreshCycleDuration.refreshDuration == 0)
+    {
+        warn("FramePacer::assignRefreshRate(..) vkGetRefreshCycleDurationGOOGLE() failed. VkResult = ", result);
+        return false;
+    }
+
+    targetFrameDuration = static_cast<double>(refreshCycleDuration.refreshDuration) * 1e-9;
+    return true;
+#else
+    (void)window;
+    return false;
+#endif
+}
+
+void FramePacer::pace()
+{
+    auto now = clock::now();
+
+    if (!_initialized)
+    {
+        // nothing to pace against yet, just establish the cadence from the first frame
+        _nextPresentTime = now + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(targetFrameDuration));
+        _previousPaceEnd = now;
+        _initialized = true;
+        return;
+    }
+
+    // update the smoothed estimate of how long the application takes to produce a frame,
+    // measured from the end of the previous pace() to the start of this one so time slept here is excluded.
+    double workDuration = std::chrono::duration<double>(now - _previousPaceEnd).count();
+    _frameWorkDuration = (_frameWorkDuration > 0.0) ? (_frameWorkDuration * smoothing + workDuration * (1.0 - smoothing)) : workDuration;
+
+    // in latency mode start the frame as late as the work estimate allows, otherwise start one whole frame ahead
+    double leadTime = minimizeLatency ? (_frameWorkDuration + safetyMargin) : targetFrameDuration;
+
+    auto wakeTime = _nextPresentTime - std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(leadTime));
+    if (wakeTime > now)
+    {
+        std::this_thread::sleep_until(wakeTime);
+        now = clock::now();
+    }
+
+    _nextPresentTime += std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(targetFrameDuration));
+    if (_nextPresentTime < now)
+    {
+        // fallen behind the cadence, resynchronize rather than rushing frames to catch up
+        _nextPresentTime = now + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(targetFrameDuration));
+    }
+
+    _previousPaceEnd = clock::now();
+}
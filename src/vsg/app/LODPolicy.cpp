@@ -0,0 +1,77 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/LODPolicy.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace vsg;
+
+LODPolicy::LODPolicy()
+{
+}
+
+LODPolicy::~LODPolicy()
+{
+}
+
+void LODPolicy::beginFrame()
+{
+    if (selectionBudget > 0)
+    {
+        // smooth feedback loop - grow the demotion scale while over budget, decay it back towards 1.0 while under.
+        if (_numSelections > selectionBudget)
+            _scale = std::min(_scale * (1.0 + budgetAdjustmentRate), maxBudgetScale);
+        else
+            _scale = std::max(_scale * (1.0 - budgetAdjustmentRate), 1.0);
+    }
+    else
+    {
+        _scale = 1.0;
+    }
+
+    _numSelections = 0;
+}
+
+int32_t LODPolicy::select(const LOD& lod, double lodDistance)
+{
+    double scaledDistance = lodDistance * _scale;
+    double ratio = lod.bound.r / scaledDistance;
+
+    // quick revalidation - keep the previous frame's selection while the ratio stays within its hysteresis band.
+    int32_t previous = lod.lastSelectedChild.load(std::memory_order_relaxed);
+    if (previous >= 0 && static_cast<size_t>(previous) < lod.children.size())
+    {
+        const auto& child = lod.children[previous];
+        double lower = child.minimumScreenHeightRatio * (1.0 - transitionRatio);
+        double upper = (previous > 0) ? lod.children[previous - 1].minimumScreenHeightRatio * (1.0 + transitionRatio) : std::numeric_limits<double>::max();
+        if (ratio > lower && ratio <= upper)
+        {
+            ++_numSelections;
+            return previous;
+        }
+    }
+
+    for (size_t i = 0; i < lod.children.size(); ++i)
+    {
+        if (ratio > lod.children[i].minimumScreenHeightRatio)
+        {
+            lod.lastSelectedChild.store(static_cast<int32_t>(i), std::memory_order_relaxed);
+            ++_numSelections;
+            return static_cast<int32_t>(i);
+        }
+    }
+
+    lod.lastSelectedChild.store(-1, std::memory_order_relaxed);
+    return -1;
+}
@@ -0,0 +1,201 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/OffscreenRenderer.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/state/ImageInfo.h>
+#include <vsg/state/ImageView.h>
+#include <vsg/vk/PhysicalDevice.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace vsg;
+
+OffscreenRenderer::OffscreenRenderer(ref_ptr<Device> in_device, const VkExtent2D& in_extent, VkFormat in_imageFormat, VkFormat in_depthFormat, uint32_t in_numFrames) :
+    device(in_device),
+    extent(in_extent),
+    imageFormat(in_imageFormat),
+    depthFormat(in_depthFormat)
+{
+    int graphicsFamily = device->getPhysicalDevice()->getQueueFamily(VK_QUEUE_GRAPHICS_BIT);
+    queue = device->getQueue(static_cast<uint32_t>(graphicsFamily));
+
+    // render pass that leaves the color attachment in TRANSFER_SRC_OPTIMAL ready for the readback copy
+    auto colorAttachment = defaultColorAttachment(imageFormat);
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+    auto depthAttachment = defaultDepthAttachment(depthFormat);
+
+    RenderPass::Attachments attachments{colorAttachment, depthAttachment};
+
+    SubpassDescription subpass;
+    subpass.colorAttachments.push_back(AttachmentReference{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
+    subpass.depthStencilAttachments.push_back(AttachmentReference{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL});
+
+    RenderPass::Subpasses subpasses{subpass};
+
+    // ensure the color writes have completed before the readback copy reads the attachment
+    SubpassDependency transferDependency;
+    transferDependency.srcSubpass = 0;
+    transferDependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+    transferDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    transferDependency.dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    transferDependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    transferDependency.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    transferDependency.dependencyFlags = 0;
+
+    RenderPass::Dependencies dependencies{transferDependency};
+
+    _renderPass = RenderPass::create(device.get(), attachments, subpasses, dependencies);
+
+    VkDeviceSize readbackSize = static_cast<VkDeviceSize>(extent.width) * static_cast<VkDeviceSize>(extent.height) * static_cast<VkDeviceSize>(getFormatTraits(imageFormat).size);
+
+    _frames.resize(std::max(in_numFrames, 1u));
+    for (auto& frame : _frames)
+    {
+        auto colorImage = Image::create();
+        colorImage->format = imageFormat;
+        colorImage->extent = VkExtent3D{extent.width, extent.height, 1};
+        colorImage->mipLevels = 1;
+        colorImage->arrayLayers = 1;
+        colorImage->usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        auto colorImageView = createImageView(device.get(), colorImage, VK_IMAGE_ASPECT_COLOR_BIT);
+
+        auto depthImage = Image::create();
+        depthImage->format = depthFormat;
+        depthImage->extent = VkExtent3D{extent.width, extent.height, 1};
+        depthImage->mipLevels = 1;
+        depthImage->arrayLayers = 1;
+        depthImage->usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        auto depthImageView = createImageView(device.get(), depthImage, computeAspectFlagsForFormat(depthFormat));
+
+        frame.colorImage = colorImage;
+        frame.framebuffer = Framebuffer::create(_renderPass, ImageViews{colorImageView, depthImageView}, extent.width, extent.height, 1);
+
+        frame.readbackBuffer = createBufferAndMemory(device.get(), readbackSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        frame.readbackSize = readbackSize;
+
+        auto deviceMemory = frame.readbackBuffer->getDeviceMemory(device->deviceID);
+        deviceMemory->map(frame.readbackBuffer->getMemoryOffset(device->deviceID), readbackSize, 0, &frame.mappedData);
+
+        frame.fence = Fence::create(device.get());
+    }
+
+    readbackCommand = Readback::create(this);
+}
+
+OffscreenRenderer::~OffscreenRenderer()
+{
+    waitForCompletion();
+}
+
+OffscreenRenderer::Readback::Readback(OffscreenRenderer* in_renderer) :
+    _renderer(in_renderer)
+{
+}
+
+void OffscreenRenderer::Readback::record(CommandBuffer& commandBuffer) const
+{
+    auto& frame = _renderer->_frames[_renderer->_currentFrame];
+    auto deviceID = commandBuffer.deviceID;
+
+    VkBufferImageCopy region = {};
+    region.bufferOffset = 0;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource = VkImageSubresourceLayers{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageOffset = VkOffset3D{0, 0, 0};
+    region.imageExtent = VkExtent3D{_renderer->extent.width, _renderer->extent.height, 1};
+
+    vkCmdCopyImageToBuffer(commandBuffer, frame.colorImage->vk(deviceID), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, frame.readbackBuffer->vk(deviceID), 1, &region);
+
+    // make the copy visible to the host before the frame's fence signals
+    VkBufferMemoryBarrier hostReadBarrier = {};
+    hostReadBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    hostReadBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    hostReadBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    hostReadBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostReadBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostReadBarrier.buffer = frame.readbackBuffer->vk(deviceID);
+    hostReadBarrier.offset = 0;
+    hostReadBarrier.size = frame.readbackSize;
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &hostReadBarrier, 0, nullptr);
+}
+
+VkResult OffscreenRenderer::render(ref_ptr<FrameStamp> frameStamp)
+{
+    if (!commandGraph || !renderGraph || !queue)
+    {
+        warn("OffscreenRenderer::render() requires commandGraph, renderGraph and queue to be assigned.");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    auto& frame = _frames[_currentFrame];
+
+    // only block when the whole ring is in flight, completing the oldest frame to recycle its slot
+    if (frame.inFlight)
+    {
+        if (VkResult result = completeFrame(frame); result != VK_SUCCESS) return result;
+    }
+
+    renderGraph->framebuffer = frame.framebuffer;
+
+    auto recordedCommandBuffers = RecordedCommandBuffers::create();
+    commandGraph->record(recordedCommandBuffers, frameStamp);
+
+    std::vector<VkCommandBuffer> vk_commandBuffers;
+    for (auto& recordedCommandBuffer : recordedCommandBuffers->buffers())
+    {
+        if (recordedCommandBuffer->level() == VK_COMMAND_BUFFER_LEVEL_PRIMARY) vk_commandBuffers.push_back(*recordedCommandBuffer);
+
+        frame.fence->dependentCommandBuffers().emplace_back(recordedCommandBuffer);
+    }
+
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = static_cast<uint32_t>(vk_commandBuffers.size());
+    submitInfo.pCommandBuffers = vk_commandBuffers.data();
+
+    frame.frameIndex = _frameCount++;
+    frame.inFlight = true;
+
+    VkResult result = queue->submit(submitInfo, frame.fence);
+
+    _currentFrame = (_currentFrame + 1) % static_cast<uint32_t>(_frames.size());
+
+    return result;
+}
+
+VkResult OffscreenRenderer::completeFrame(Frame& frame)
+{
+    uint64_t timeout = std::numeric_limits<uint64_t>::max();
+    if (VkResult result = frame.fence->wait(timeout); result != VK_SUCCESS) return result;
+
+    if (readbackCallback) readbackCallback->apply(frame.frameIndex, frame.mappedData, frame.readbackSize);
+
+    frame.fence->resetFenceAndDependencies();
+    frame.inFlight = false;
+
+    return VK_SUCCESS;
+}
+
+void OffscreenRenderer::waitForCompletion()
+{
+    for (size_t i = 0; i < _frames.size(); ++i)
+    {
+        auto& frame = _frames[(_currentFrame + i) % _frames.size()];
+        if (frame.inFlight) completeFrame(frame);
+    }
+}
@@ -0,0 +1,158 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/OrderIndependentTransparency.h>
+#include <vsg/commands/ClearImage.h>
+#include <vsg/commands/Draw.h>
+#include <vsg/commands/PipelineBarrier.h>
+#include <vsg/io/Logger.h>
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/ColorBlendState.h>
+#include <vsg/state/DepthStencilState.h>
+#include <vsg/state/DescriptorBuffer.h>
+#include <vsg/state/DescriptorImage.h>
+#include <vsg/state/GraphicsPipeline.h>
+#include <vsg/state/InputAssemblyState.h>
+#include <vsg/state/MultisampleState.h>
+#include <vsg/state/RasterizationState.h>
+#include <vsg/state/VertexInputState.h>
+#include <vsg/state/ViewportState.h>
+#include <vsg/vk/Context.h>
+
+using namespace vsg;
+
+OrderIndependentTransparency::OrderIndependentTransparency()
+{
+}
+
+OrderIndependentTransparency::~OrderIndependentTransparency()
+{
+}
+
+bool OrderIndependentTransparency::setup()
+{
+    if (width == 0 || height == 0 || !fullscreenVertexShaderStage || !resolveFragmentShaderStage)
+    {
+        warn("OrderIndependentTransparency::setup() requires width, height and the resolve shader stages to be assigned.");
+        return false;
+    }
+
+    auto image = Image::create();
+    image->imageType = VK_IMAGE_TYPE_2D;
+    image->format = VK_FORMAT_R32_UINT;
+    image->extent = {width, height, 1};
+    image->mipLevels = 1;
+    image->arrayLayers = 1;
+    image->usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+    headIndexImage = ImageInfo::create(ref_ptr<Sampler>{}, ImageView::create(image, VK_IMAGE_ASPECT_COLOR_BIT), VK_IMAGE_LAYOUT_GENERAL);
+    fragmentNodes = BufferInfo::create();
+    fragmentCounter = BufferInfo::create();
+
+    auto headIndexDescriptor = DescriptorImage::create(headIndexImage, 0, 0, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
+    auto fragmentNodesDescriptor = DescriptorBuffer::create(BufferInfoList{fragmentNodes}, 1, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto fragmentCounterDescriptor = DescriptorBuffer::create(BufferInfoList{fragmentCounter}, 2, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    DescriptorSetLayoutBindings descriptorBindings{
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}};
+
+    descriptorSetLayout = DescriptorSetLayout::create(descriptorBindings);
+    descriptorSet = DescriptorSet::create(descriptorSetLayout, Descriptors{headIndexDescriptor, fragmentNodesDescriptor, fragmentCounterDescriptor});
+
+    // clear sequence, recorded before the render pass: transition the head image to GENERAL discarding
+    // last frame's lists, clear heads to the end of list marker and the allocation counter to zero
+    children.clear();
+
+    addChild(PipelineBarrier::create(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                                     ImageMemoryBarrier::create(VkAccessFlags(0), VK_ACCESS_TRANSFER_WRITE_BIT,
+                                                                VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL,
+                                                                VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+                                                                image, VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1})));
+
+    auto clearHeads = ClearColorImage::create();
+    clearHeads->image = image;
+    clearHeads->imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    clearHeads->color.uint32[0] = 0xffffffff;
+    clearHeads->color.uint32[1] = 0xffffffff;
+    clearHeads->color.uint32[2] = 0xffffffff;
+    clearHeads->color.uint32[3] = 0xffffffff;
+    clearHeads->ranges.push_back(VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1});
+    addChild(clearHeads);
+
+    // the counter buffer is allocated at compile, compile() assigns it before the command is recorded
+    _clearCounter = FillBuffer::create(ref_ptr<Buffer>{}, 0, VK_WHOLE_SIZE, 0);
+    addChild(_clearCounter);
+
+    addChild(PipelineBarrier::create(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                                     MemoryBarrier::create(VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT)));
+
+    // resolve sequence, added by the application as the RenderGraph's last child: make the transparent
+    // pass writes visible within the render pass, then composite each pixel's list with a fullscreen triangle
+    auto depthStencilState = DepthStencilState::create();
+    depthStencilState->depthTestEnable = VK_FALSE;
+    depthStencilState->depthWriteEnable = VK_FALSE;
+
+    auto rasterizationState = RasterizationState::create();
+    rasterizationState->cullMode = VK_CULL_MODE_NONE;
+
+    auto colorBlendState = ColorBlendState::create();
+    colorBlendState->configureAttachments(true);
+
+    GraphicsPipelineStates pipelineStates{
+        VertexInputState::create(),
+        InputAssemblyState::create(),
+        rasterizationState,
+        MultisampleState::create(),
+        colorBlendState,
+        depthStencilState,
+        ViewportState::create(VkExtent2D{width, height})};
+
+    auto pipelineLayout = PipelineLayout::create(DescriptorSetLayouts{descriptorSetLayout}, PushConstantRanges{});
+    auto pipeline = GraphicsPipeline::create(pipelineLayout, ShaderStages{fullscreenVertexShaderStage, resolveFragmentShaderStage}, pipelineStates);
+
+    resolveCommands = Commands::create();
+    resolveCommands->addChild(PipelineBarrier::create(VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_DEPENDENCY_BY_REGION_BIT,
+                                                      MemoryBarrier::create(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT)));
+    resolveCommands->addChild(BindGraphicsPipeline::create(pipeline));
+    resolveCommands->addChild(BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, descriptorSet));
+    resolveCommands->addChild(Draw::create(3, 1, 0, 0));
+
+    return true;
+}
+
+void OrderIndependentTransparency::compile(Context& context)
+{
+    // allocate the device only node and counter buffers before the descriptors referencing them are
+    // compiled. This node is recorded before the RenderGraph so it is also compiled first.
+    if (fragmentNodes && !fragmentNodes->buffer)
+    {
+        VkDeviceSize size = VkDeviceSize(width) * VkDeviceSize(height) * VkDeviceSize(averageLayersPerPixel) * 16;
+        fragmentNodes->buffer = createBufferAndMemory(context.device, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        fragmentNodes->offset = 0;
+        fragmentNodes->range = size;
+    }
+    if (fragmentCounter && !fragmentCounter->buffer)
+    {
+        VkDeviceSize size = sizeof(uint32_t);
+        fragmentCounter->buffer = createBufferAndMemory(context.device, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        fragmentCounter->offset = 0;
+        fragmentCounter->range = size;
+    }
+    if (_clearCounter) _clearCounter->buffer = fragmentCounter->buffer;
+
+    Commands::compile(context);
+
+    // resolveCommands are compiled where they sit in the RenderGraph so the graphics pipeline
+    // picks up the render pass from that Context
+}
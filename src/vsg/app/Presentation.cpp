@@ -28,13 +28,18 @@ VkResult Presentation::present()
 
     std::vector<VkSwapchainKHR> vk_swapchains;
     std::vector<uint32_t> indices;
+    std::vector<VkPresentModeKHR> vk_presentModes;
+    bool presentModesSupported = true;
     for (auto& window : windows)
     {
         size_t imageIndex = window->imageIndex();
         if (window->visible() && imageIndex < window->numFrames())
         {
-            vk_swapchains.emplace_back(*(window->getOrCreateSwapchain()));
+            auto swapchain = window->getOrCreateSwapchain();
+            vk_swapchains.emplace_back(*swapchain);
             indices.emplace_back(static_cast<uint32_t>(imageIndex));
+            vk_presentModes.emplace_back(swapchain->presentMode());
+            if (swapchain->compatiblePresentModes().empty()) presentModesSupported = false;
         }
     }
 
@@ -52,6 +57,21 @@ VkResult Presentation::present()
     presentInfo.pSwapchains = vk_swapchains.data();
     presentInfo.pImageIndices = indices.data();
 
+#if defined(VK_EXT_swapchain_maintenance1)
+    // apply any runtime present mode switches requested via Swapchain::setPresentMode(), only possible when
+    // every presented swapchain was created with a compatible present mode list.
+    VkSwapchainPresentModeInfoEXT presentModeInfo = {};
+    if (presentModesSupported)
+    {
+        presentModeInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODE_INFO_EXT;
+        presentModeInfo.swapchainCount = static_cast<uint32_t>(vk_swapchains.size());
+        presentModeInfo.pPresentModes = vk_presentModes.data();
+        presentInfo.pNext = &presentModeInfo;
+    }
+#else
+    (void)presentModesSupported;
+#endif
+
 #if 0
     debug( "pdo.presentInfo->present(..)");
     debug( "    presentInfo.waitSemaphoreCount = ", presentInfo.waitSemaphoreCount);
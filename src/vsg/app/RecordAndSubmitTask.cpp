@@ -29,23 +29,50 @@ RecordAndSubmitTask::RecordAndSubmitTask(Device* in_device, uint32_t numBuffers)
         _indices.emplace_back(numBuffers); // numBuffers is used to signify unset value
     }
 
+    syncObjectPool = in_device->getSyncObjectPool();
+
     _fences.resize(numBuffers);
     for (uint32_t i = 0; i < numBuffers; ++i)
     {
-        _fences[i] = Fence::create(device);
+        _fences[i] = syncObjectPool->acquireFence();
     }
 
     earlyTransferTask = TransferTask::create(in_device, numBuffers);
-    earlyTransferTaskConsumerCompletedSemaphore = Semaphore::create(in_device);
+    earlyTransferTaskConsumerCompletedSemaphore = syncObjectPool->acquireSemaphore();
 
     lateTransferTask = TransferTask::create(in_device, numBuffers);
-    lateTransferTaskConsumerCompletedSemaphore = Semaphore::create(in_device);
+    lateTransferTaskConsumerCompletedSemaphore = syncObjectPool->acquireSemaphore();
+}
+
+RecordAndSubmitTask::~RecordAndSubmitTask()
+{
+    for (auto& fence : _fences)
+    {
+        syncObjectPool->recycle(fence);
+    }
+
+    syncObjectPool->recycle(earlyTransferTaskConsumerCompletedSemaphore);
+    syncObjectPool->recycle(lateTransferTaskConsumerCompletedSemaphore);
+}
+
+void RecordAndSubmitTask::dependsOn(ref_ptr<RecordAndSubmitTask> producerTask)
+{
+    if (!producerTask || producerTask.get() == this) return;
+
+    if (!producerTask->frameCompletedSemaphore)
+    {
+        producerTask->frameCompletedSemaphore = TimelineSemaphore::create(producerTask->device);
+    }
+
+    waitTasks.emplace_back(producerTask);
 }
 
 void RecordAndSubmitTask::advance()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "RecordAndSubmitTask advance", COLOR_VIEWER);
 
+    ++frameTimelineValue;
+
     if (_currentFrameIndex >= _indices.size())
     {
         // first frame so set to 0
@@ -104,8 +131,16 @@ VkResult RecordAndSubmitTask::start()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "RecordAndSubmitTask start", COLOR_RECORD);
 
-    if (earlyTransferTask) earlyTransferTask->currentTransferCompletedSemaphore = {};
-    if (lateTransferTask) lateTransferTask->currentTransferCompletedSemaphore = {};
+    if (earlyTransferTask)
+    {
+        earlyTransferTask->currentTransferCompletedSemaphore = {};
+        earlyTransferTask->currentTransferTimelineValue = 0;
+    }
+    if (lateTransferTask)
+    {
+        lateTransferTask->currentTransferCompletedSemaphore = {};
+        lateTransferTask->currentTransferTimelineValue = 0;
+    }
 
     auto current_fence = fence();
     if (current_fence->hasDependencies())
@@ -134,6 +169,28 @@ VkResult RecordAndSubmitTask::finish(ref_ptr<RecordedCommandBuffers> recordedCom
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "RecordAndSubmitTask finish", COLOR_RECORD);
 
+    auto current_fence = fence();
+
+    ref_ptr<Submission> submission;
+    if (VkResult result = buildSubmission(recordedCommandBuffers, current_fence, submission); result != VK_SUCCESS) return result;
+
+    if (!submission)
+    {
+        // signal the frame's timeline value from the host so dependent tasks don't stall on a frame with nothing to submit
+        if (frameCompletedSemaphore) frameCompletedSemaphore->signal(frameTimelineValue);
+
+        // nothing to do so return early
+        std::this_thread::sleep_for(std::chrono::milliseconds(16)); // sleep for 1/60th of a second
+        return VK_SUCCESS;
+    }
+
+    return queue->submit(submission->submitInfo, current_fence);
+}
+
+VkResult RecordAndSubmitTask::buildSubmission(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers, Fence* current_fence, ref_ptr<Submission>& submission)
+{
+    CPU_INSTRUMENTATION_L1_NC(instrumentation, "RecordAndSubmitTask buildSubmission", COLOR_RECORD);
+
     if (lateTransferTask)
     {
         if (VkResult result = lateTransferTask->transferDynamicData(); result != VK_SUCCESS) return result;
@@ -141,18 +198,16 @@ VkResult RecordAndSubmitTask::finish(ref_ptr<RecordedCommandBuffers> recordedCom
 
     if (recordedCommandBuffers->empty())
     {
-        // nothing to do so return early
-        std::this_thread::sleep_for(std::chrono::milliseconds(16)); // sleep for 1/60th of a second
+        // nothing to submit
         return VK_SUCCESS;
     }
 
-    // convert VSG CommandBuffer to Vulkan handles and add to the Fence's list of dependent CommandBuffers
-    std::vector<VkCommandBuffer> vk_commandBuffers;
-    std::vector<VkSemaphore> vk_waitSemaphores;
-    std::vector<VkPipelineStageFlags> vk_waitStages;
-    std::vector<VkSemaphore> vk_signalSemaphores;
+    submission = Submission::create();
 
-    auto current_fence = fence();
+    auto& vk_commandBuffers = submission->commandBuffers;
+    auto& vk_waitSemaphores = submission->waitSemaphores;
+    auto& vk_waitStages = submission->waitStages;
+    auto& vk_signalSemaphores = submission->signalSemaphores;
 
     // convert VSG CommandBuffer to Vulkan handles and add to the Fence's list of dependent CommandBuffers
     auto buffers = recordedCommandBuffers->buffers();
@@ -163,7 +218,8 @@ VkResult RecordAndSubmitTask::finish(ref_ptr<RecordedCommandBuffers> recordedCom
         current_fence->dependentCommandBuffers().emplace_back(commandBuffer);
     }
 
-    current_fence->dependentSemaphores() = signalSemaphores;
+    // append rather than assign as the fence may be shared by several tasks batched into a single vkQueueSubmit
+    current_fence->dependentSemaphores().insert(current_fence->dependentSemaphores().end(), signalSemaphores.begin(), signalSemaphores.end());
 
     if (earlyTransferTask && earlyTransferTask->currentTransferCompletedSemaphore)
     {
@@ -205,9 +261,72 @@ VkResult RecordAndSubmitTask::finish(ref_ptr<RecordedCommandBuffers> recordedCom
         vk_signalSemaphores.emplace_back(*(semaphore));
     }
 
-    VkSubmitInfo submitInfo = {};
+    // for TransferTask running in the dedicated transfer queue mode, wait on the timeline value it signalled for this
+    // frame's transfers and signal the value it expects the consumer to set once the transferred data has been used.
+    auto& timelineSubmitInfo = submission->timelineSubmitInfo;
+    auto& vk_waitValues = submission->waitValues;
+    auto& vk_signalValues = submission->signalValues;
+    bool usesTimelineSemaphore = false;
+    auto ensureTimelineValues = [&]() {
+        if (usesTimelineSemaphore) return;
+
+        // values associated with binary semaphores are ignored but the arrays must match the semaphore arrays in size
+        vk_waitValues.assign(vk_waitSemaphores.size(), 0);
+        vk_signalValues.assign(vk_signalSemaphores.size(), 0);
+        usesTimelineSemaphore = true;
+    };
+
+    auto appendTimelineSync = [&](TransferTask& transferTask) {
+        if (!transferTask.timelineSemaphore || transferTask.currentTransferTimelineValue == 0) return;
+
+        ensureTimelineValues();
+
+        vk_waitSemaphores.emplace_back(*transferTask.timelineSemaphore);
+        vk_waitStages.emplace_back(transferTask.timelineSemaphore->pipelineStageFlags());
+        vk_waitValues.push_back(transferTask.currentTransferTimelineValue);
+
+        vk_signalSemaphores.emplace_back(*transferTask.timelineSemaphore);
+        vk_signalValues.push_back(transferTask.currentConsumerTimelineValue);
+    };
+    if (earlyTransferTask) appendTimelineSync(*earlyTransferTask);
+    if (lateTransferTask) appendTimelineSync(*lateTransferTask);
+
+    // wait for the current frame's work from each producer task registered via dependsOn(), so work such as an
+    // async compute task's output is consumed in the right order while the queues overlap all other work.
+    for (auto& waitTask : waitTasks)
+    {
+        auto producerTask = waitTask.ref_ptr();
+        if (!producerTask || !producerTask->frameCompletedSemaphore || producerTask->frameTimelineValue == 0) continue;
+
+        ensureTimelineValues();
+
+        vk_waitSemaphores.emplace_back(*producerTask->frameCompletedSemaphore);
+        vk_waitStages.emplace_back(producerTask->frameCompletedSemaphore->pipelineStageFlags());
+        vk_waitValues.push_back(producerTask->frameTimelineValue);
+    }
+
+    // signal this task's per frame timeline value for any tasks that depend on it
+    if (frameCompletedSemaphore)
+    {
+        ensureTimelineValues();
+
+        vk_signalSemaphores.emplace_back(*frameCompletedSemaphore);
+        vk_signalValues.push_back(frameTimelineValue);
+    }
+
+    auto& submitInfo = submission->submitInfo;
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
+    if (usesTimelineSemaphore)
+    {
+        timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineSubmitInfo.waitSemaphoreValueCount = static_cast<uint32_t>(vk_waitValues.size());
+        timelineSubmitInfo.pWaitSemaphoreValues = vk_waitValues.data();
+        timelineSubmitInfo.signalSemaphoreValueCount = static_cast<uint32_t>(vk_signalValues.size());
+        timelineSubmitInfo.pSignalSemaphoreValues = vk_signalValues.data();
+        submitInfo.pNext = &timelineSubmitInfo;
+    }
+
     submitInfo.waitSemaphoreCount = static_cast<uint32_t>(vk_waitSemaphores.size());
     submitInfo.pWaitSemaphores = vk_waitSemaphores.data();
     submitInfo.pWaitDstStageMask = vk_waitStages.data();
@@ -218,7 +337,7 @@ VkResult RecordAndSubmitTask::finish(ref_ptr<RecordedCommandBuffers> recordedCom
     submitInfo.signalSemaphoreCount = static_cast<uint32_t>(vk_signalSemaphores.size());
     submitInfo.pSignalSemaphores = vk_signalSemaphores.data();
 
-    return queue->submit(submitInfo, current_fence);
+    return VK_SUCCESS;
 }
 
 void RecordAndSubmitTask::assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation)
@@ -11,7 +11,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/animation/Animation.h>
+#include <vsg/animation/AnimationGroup.h>
 #include <vsg/app/CommandGraph.h>
+#include <vsg/app/LODPolicy.h>
 #include <vsg/app/RecordTraversal.h>
 #include <vsg/app/View.h>
 #include <vsg/commands/Command.h>
@@ -27,17 +29,22 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/lighting/SpotLight.h>
 #include <vsg/maths/plane.h>
 #include <vsg/nodes/Bin.h>
+#include <vsg/nodes/CompiledDrawList.h>
 #include <vsg/nodes/CullGroup.h>
 #include <vsg/nodes/CullNode.h>
 #include <vsg/nodes/DepthSorted.h>
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/Group.h>
+#include <vsg/nodes/ImpostorLOD.h>
 #include <vsg/nodes/LOD.h>
 #include <vsg/nodes/Layer.h>
+#include <vsg/nodes/MaskGroup.h>
 #include <vsg/nodes/MatrixTransform.h>
+#include <vsg/nodes/OcclusionQueryNode.h>
 #include <vsg/nodes/PagedLOD.h>
 #include <vsg/nodes/QuadGroup.h>
 #include <vsg/nodes/RegionOfInterest.h>
+#include <vsg/nodes/SpatialIndexGroup.h>
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/nodes/Switch.h>
 #include <vsg/nodes/TileDatabase.h>
@@ -56,7 +63,43 @@ using namespace vsg;
 
 #define INLINE_TRAVERSE 0
 
+namespace
+{
+    // size of the batches used by RecordTraversal::_batchedCullTraverse()
+    constexpr size_t CULL_BATCH_SIZE = 8;
+
+    struct CullBatch
+    {
+        dsphere spheres[CULL_BATCH_SIZE];
+        const Node* nodes[CULL_BATCH_SIZE];
+        size_t count = 0;
+
+        void add(const dsphere& bound, const Node* node)
+        {
+            spheres[count] = bound;
+            nodes[count] = node;
+            ++count;
+        }
+
+        /// test the gathered spheres against the frustum planes, returning a bitmask of the spheres that intersect the frustum
+        uint32_t intersect(const Frustum& frustum) const
+        {
+            uint8_t results[CULL_BATCH_SIZE];
+            vsg::intersect(frustum.face, POLYTOPE_SIZE, spheres, results, count);
+
+            uint32_t result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (results[i]) result |= 1u << i;
+            }
+            return result;
+        }
+    };
+} // namespace
+
 RecordTraversal::RecordTraversal(uint32_t in_maxSlot, std::set<Bin*> in_bins) :
+    frameAllocator(FrameAllocator::create()),
+    regionsOfInterest(FrameAlloc<std::pair<dmat4, const RegionOfInterest*>>(frameAllocator.get())),
     _state(new State(in_maxSlot))
 {
     CPU_INSTRUMENTATION_L1_C(instrumentation, COLOR_RECORD);
@@ -128,6 +171,29 @@ void RecordTraversal::apply(const Group& group)
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "Group", COLOR_RECORD_L2, &group);
 
     //debug("Visiting Group");
+    if (validateTraversal)
+    {
+        auto data_before = group.children.data();
+        auto size_before = group.children.size();
+
+        if (useBatchedCulling)
+            _batchedCullTraverse(data_before, size_before);
+        else
+            group.traverse(*this);
+
+        if (data_before != group.children.data() || size_before != group.children.size())
+        {
+            warn("RecordTraversal::apply(const Group&) children of Group ", &group, " modified mid-traversal.");
+        }
+        return;
+    }
+
+    if (useBatchedCulling)
+    {
+        _batchedCullTraverse(group.children.data(), group.children.size());
+        return;
+    }
+
 #if INLINE_TRAVERSE
     vsg::Group::t_traverse(group, *this);
 #else
@@ -135,6 +201,100 @@ void RecordTraversal::apply(const Group& group)
 #endif
 }
 
+void RecordTraversal::apply(const AnimationGroup& animationGroup)
+{
+    // stamp the group so AnimationManager's visibility gating knows it survived culling this frame
+    if (_frameStamp) animationGroup.lastRecordedFrameIndex.store(_frameStamp->frameCount, std::memory_order_relaxed);
+
+    apply(static_cast<const Group&>(animationGroup));
+}
+
+void RecordTraversal::apply(const SpatialIndexGroup& group)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "SpatialIndexGroup", COLOR_RECORD_L2, &group);
+
+    group.validateIndex();
+
+    auto& indexNodes = group.indexNodes();
+    if (indexNodes.empty())
+    {
+        group.traverse(*this);
+        return;
+    }
+
+    auto& leafChildren = group.leafChildren();
+    auto& children = group.children;
+
+    // walk the bounding volume hierarchy, skipping branches whose bounds fail the view frustum test
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+        const auto& indexNode = indexNodes[stack.back()];
+        stack.pop_back();
+
+        if (!_state->intersect(indexNode.bound)) continue;
+
+        if (indexNode.count > 0)
+        {
+            for (uint32_t i = 0; i < indexNode.count; ++i)
+            {
+                children[leafChildren[indexNode.left + i]]->accept(*this);
+            }
+        }
+        else
+        {
+            stack.push_back(indexNode.left);
+            stack.push_back(indexNode.right);
+        }
+    }
+
+    for (auto childIndex : group.unboundedChildren())
+    {
+        children[childIndex]->accept(*this);
+    }
+}
+
+void RecordTraversal::_batchedCullTraverse(const ref_ptr<Node>* children, size_t count)
+{
+    const auto& frustum = _state->_frustumStack.top();
+
+    CullBatch batch;
+    auto cullBatch = [&]() {
+        uint32_t visible = batch.intersect(frustum);
+        for (size_t i = 0; i < batch.count; ++i)
+        {
+            if ((visible & (1u << i)) != 0) batch.nodes[i]->traverse(*this);
+        }
+        batch.count = 0;
+    };
+
+    for (size_t ci = 0; ci < count; ++ci)
+    {
+        auto& child = children[ci];
+        auto& type = child->type_info();
+        if (type == typeid(CullNode))
+        {
+            batch.add(static_cast<const CullNode*>(child.get())->bound, child.get());
+            if (batch.count == CULL_BATCH_SIZE) cullBatch();
+        }
+        else if (type == typeid(CullGroup))
+        {
+            batch.add(static_cast<const CullGroup*>(child.get())->bound, child.get());
+            if (batch.count == CULL_BATCH_SIZE) cullBatch();
+        }
+        else
+        {
+            // flush any gathered cull nodes before traversing the non cull child so traversal order is preserved
+            if (batch.count > 0) cullBatch();
+            child->accept(*this);
+        }
+    }
+
+    if (batch.count > 0) cullBatch();
+}
+
 void RecordTraversal::apply(const QuadGroup& quadGroup)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "QuadGroup", COLOR_RECORD_L2, &quadGroup);
@@ -160,6 +320,21 @@ void RecordTraversal::apply(const LOD& lod)
         return;
     }
 
+    lodDistance *= _lodScale;
+
+    // skip subgraphs whose projected footprint falls below the View's small feature threshold
+    if (_smallFeatureCullingRatio > 0.0 && sphere.r < lodDistance * _smallFeatureCullingRatio)
+    {
+        return;
+    }
+
+    if (lodPolicy)
+    {
+        auto selectedChild = lodPolicy->select(lod, lodDistance);
+        if (selectedChild >= 0) lod.children[selectedChild].node->accept(*this);
+        return;
+    }
+
     for (auto& child : lod.children)
     {
         auto cutoff = lodDistance * child.minimumScreenHeightRatio;
@@ -172,6 +347,31 @@ void RecordTraversal::apply(const LOD& lod)
     }
 }
 
+void RecordTraversal::apply(const ImpostorLOD& impostorLOD)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "ImpostorLOD", COLOR_RECORD_L2, &impostorLOD);
+
+    const auto& sphere = impostorLOD.bound;
+
+    // check if bounding sphere is in view frustum.
+    auto lodDistance = _state->lodDistance(sphere);
+    if (lodDistance < 0.0)
+    {
+        return;
+    }
+
+    bool childVisible = sphere.r > lodDistance * _lodScale * impostorLOD.minimumScreenHeightRatio;
+    if (impostorLOD.child && (childVisible || !impostorLOD.impostor))
+    {
+        // traverse the full detail child, also used at far range while the impostor has yet to be baked.
+        impostorLOD.child->accept(*this);
+    }
+    else if (impostorLOD.impostor)
+    {
+        impostorLOD.impostor->accept(*this);
+    }
+}
+
 void RecordTraversal::apply(const PagedLOD& plod)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "PagedLOD", COLOR_PAGER, &plod);
@@ -191,6 +391,8 @@ void RecordTraversal::apply(const PagedLOD& plod)
         return;
     }
 
+    lodDistance *= _lodScale;
+
     // check the high res child to see if it's visible
     {
         const auto& child = plod.children[0];
@@ -263,6 +465,16 @@ void RecordTraversal::apply(const CullGroup& cullGroup)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "CullGroup", COLOR_RECORD_L2, &cullGroup);
 
+    if (_smallFeatureCullingRatio > 0.0)
+    {
+        auto lodDistance = _state->lodDistance(cullGroup.bound);
+        if (lodDistance >= 0.0 && cullGroup.bound.r >= lodDistance * _smallFeatureCullingRatio)
+        {
+            cullGroup.traverse(*this);
+        }
+        return;
+    }
+
     if (_state->intersect(cullGroup.bound))
     {
         // debug("Passed node");
@@ -274,6 +486,16 @@ void RecordTraversal::apply(const CullNode& cullNode)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "CullNode", COLOR_RECORD_L2, &cullNode);
 
+    if (_smallFeatureCullingRatio > 0.0)
+    {
+        auto lodDistance = _state->lodDistance(cullNode.bound);
+        if (lodDistance >= 0.0 && cullNode.bound.r >= lodDistance * _smallFeatureCullingRatio)
+        {
+            cullNode.traverse(*this);
+        }
+        return;
+    }
+
     if (_state->intersect(cullNode.bound))
     {
         //debug("Passed node");
@@ -281,6 +503,59 @@ void RecordTraversal::apply(const CullNode& cullNode)
     }
 }
 
+void RecordTraversal::apply(const OcclusionQueryNode& oqn)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "OcclusionQueryNode", COLOR_RECORD_L2, &oqn);
+
+    if (!_state->intersect(oqn.bound)) return;
+
+    if (!oqn.pollQueryAndCheckVisibility()) return;
+
+    auto commandBuffer = getCommandBuffer();
+    auto device = commandBuffer->getDevice();
+    auto extensions = device->getExtensions();
+
+    // lazily create the VkQueryPool for the device doing the recording, and fall back to plain
+    // frustum culled traversal when host query resets aren't available to recycle the query slots
+    oqn.queryPool->compile(device);
+    if (!oqn.queryPool->vk() || !extensions->vkResetQueryPool)
+    {
+        oqn.traverse(*this);
+        return;
+    }
+
+    uint32_t query = oqn.nextQuery();
+    extensions->vkResetQueryPool(*device, *oqn.queryPool, query, 1);
+
+    _state->record();
+    vkCmdBeginQuery(*commandBuffer, *oqn.queryPool, query, 0);
+
+    oqn.traverse(*this);
+
+    _state->record();
+    vkCmdEndQuery(*commandBuffer, *oqn.queryPool, query);
+}
+
+void RecordTraversal::apply(const MaskGroup& group)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "MaskGroup", COLOR_RECORD_L2, &group);
+
+    // single test against the cached union of the subgraph's masks prunes the whole branch
+    if ((traversalMask & (overrideMask | group.mask)) == MASK_OFF) return;
+
+    if (useBatchedCulling)
+    {
+        _batchedCullTraverse(group.children.data(), group.children.size());
+        return;
+    }
+
+#if INLINE_TRAVERSE
+    vsg::Group::t_traverse(group, *this);
+#else
+    group.Group::traverse(*this);
+#endif
+}
+
 void RecordTraversal::apply(const Switch& sw)
 {
     GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "Switch", COLOR_RECORD_L2, &sw);
@@ -301,6 +576,42 @@ void RecordTraversal::apply(const RegionOfInterest& roi)
     regionsOfInterest.emplace_back(_state->modelviewMatrixStack.top(), &roi);
 }
 
+void RecordTraversal::apply(const CompiledDrawList& drawList)
+{
+    GPU_INSTRUMENTATION_L2_NCO(instrumentation, *getCommandBuffer(), "CompiledDrawList", COLOR_RECORD_L2, &drawList);
+
+    // linear replay of the flattened subgraph, no per node virtual dispatch required
+    for (const auto& entry : drawList.entries)
+    {
+        switch (entry.op)
+        {
+        case CompiledDrawList::PUSH_STATE:
+            _state->stateStacks[drawList.stateCommands[entry.index]->slot].push(drawList.stateCommands[entry.index]);
+            _state->dirty = true;
+            break;
+        case CompiledDrawList::POP_STATE:
+            _state->stateStacks[entry.index].pop();
+            _state->dirty = true;
+            break;
+        case CompiledDrawList::PUSH_TRANSFORM:
+            _state->modelviewMatrixStack.push(*drawList.transforms[entry.index]);
+            _state->dirty = true;
+            break;
+        case CompiledDrawList::POP_TRANSFORM:
+            _state->modelviewMatrixStack.pop();
+            _state->dirty = true;
+            break;
+        case CompiledDrawList::RECORD_COMMAND:
+            _state->record();
+            drawList.commands[entry.index]->record(*(_state->_commandBuffer));
+            break;
+        case CompiledDrawList::ACCEPT_NODE:
+            drawList.nodes[entry.index]->accept(*this);
+            break;
+        }
+    }
+}
+
 void RecordTraversal::apply(const DepthSorted& depthSorted)
 {
     CPU_INSTRUMENTATION_L2_NCO(instrumentation, "DepthSorted", COLOR_RECORD_L2, &depthSorted);
@@ -456,7 +767,22 @@ void RecordTraversal::apply(const StateGroup& stateGroup)
     }
     _state->dirty = true;
 
-    stateGroup.traverse(*this);
+    if (validateTraversal)
+    {
+        auto data_before = stateGroup.children.data();
+        auto size_before = stateGroup.children.size();
+
+        stateGroup.traverse(*this);
+
+        if (data_before != stateGroup.children.data() || size_before != stateGroup.children.size())
+        {
+            warn("RecordTraversal::apply(const StateGroup&) children of StateGroup ", &stateGroup, " modified mid-traversal.");
+        }
+    }
+    else
+    {
+        stateGroup.traverse(*this);
+    }
 
     for (auto& command : stateGroup.stateCommands)
     {
@@ -503,6 +829,12 @@ void RecordTraversal::apply(const View& view)
     _state->_commandBuffer->viewID = view.viewID;
     _state->_commandBuffer->viewDependentState = view.viewDependentState.get();
 
+    // apply the View's traversal overrides
+    auto cached_lodScale = _lodScale;
+    auto cached_smallFeatureCullingRatio = _smallFeatureCullingRatio;
+    _lodScale = view.lodScale;
+    _smallFeatureCullingRatio = view.smallFeatureCullingRatio;
+
     // cache the previous bins
     int32_t cached_minimumBinNumber = _minimumBinNumber;
     decltype(_bins) cached_bins;
@@ -539,8 +871,20 @@ void RecordTraversal::apply(const View& view)
     if (view.camera)
     {
         _state->inheritViewForLODScaling = (view.features & INHERIT_VIEWPOINT) != 0;
+        _state->modelviewMatrixStack.relativeToEye = view.relativeToEye;
         _state->setProjectionAndViewMatrix(view.camera->projectionMatrix->transform(), view.camera->viewMatrix->transform());
 
+        // set the dynamic viewport and scissor state so pipelines built with VK_DYNAMIC_STATE_VIEWPORT/
+        // VK_DYNAMIC_STATE_SCISSOR pick up the current dimensions, settings that pipelines with baked in
+        // ViewportState simply ignore. Recorded here so secondary command buffers get their own copy.
+        if (view.camera->viewportState)
+        {
+            auto& viewportState = *view.camera->viewportState;
+            VkCommandBuffer vk_commandBuffer = *(_state->_commandBuffer);
+            if (!viewportState.viewports.empty()) vkCmdSetViewport(vk_commandBuffer, 0, static_cast<uint32_t>(viewportState.viewports.size()), viewportState.viewports.data());
+            if (!viewportState.scissors.empty()) vkCmdSetScissor(vk_commandBuffer, 0, static_cast<uint32_t>(viewportState.scissors.size()), viewportState.scissors.data());
+        }
+
         if (_viewDependentState && _viewDependentState->viewportData && view.camera->viewportState)
         {
             auto& viewportData = _viewDependentState->viewportData;
@@ -568,6 +912,18 @@ void RecordTraversal::apply(const View& view)
         view.traverse(*this);
     }
 
+    if (view.depthPrePass)
+    {
+        // depth pre-pass - replay the opaque bins gathered by the traversal above with the depthPrePassMask
+        // assigned so StateSwitch entries bind depth only pipeline variants, reusing the cull/traversal results.
+        _state->_commandBuffer->traversalMask = view.depthPrePassMask;
+        for (auto& bin : view.bins)
+        {
+            if (bin->sortOrder != Bin::DESCENDING && bin->sortOrder != Bin::DESCENDING_RADIX) bin->accept(*this);
+        }
+        _state->_commandBuffer->traversalMask = traversalMask;
+    }
+
     for (auto& bin : view.bins)
     {
         bin->accept(*this);
@@ -579,6 +935,8 @@ void RecordTraversal::apply(const View& view)
     }
 
     // swap back previous bin setup.
+    _lodScale = cached_lodScale;
+    _smallFeatureCullingRatio = cached_smallFeatureCullingRatio;
     _minimumBinNumber = cached_minimumBinNumber;
     cached_bins.swap(_bins);
     cached_regionsOfInterest.swap(regionsOfInterest);
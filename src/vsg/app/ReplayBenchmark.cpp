@@ -0,0 +1,165 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/ReplayBenchmark.h>
+#include <vsg/io/Logger.h>
+#include <vsg/ui/ApplicationEvent.h>
+#include <vsg/ui/CollectEvents.h>
+#include <vsg/utils/GpuStatsCollector.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+ReplayBenchmark::ReplayBenchmark(ref_ptr<Viewer> in_viewer, ref_ptr<Objects> in_events) :
+    viewer(in_viewer),
+    events(in_events)
+{
+}
+
+void ReplayBenchmark::_start()
+{
+    if (!viewer || !events)
+    {
+        warn("ReplayBenchmark requires both a Viewer and recorded events, nothing to replay.");
+        return;
+    }
+
+    // collect the recorded events, the FrameEvents amongst them carry the captured FrameStamps
+    // whose simulation times drive the replayed frames
+    CollectEvents collectEvents;
+    events->accept(collectEvents);
+
+    for (auto& event : collectEvents.events)
+    {
+        if (auto frameEvent = event.cast<FrameEvent>(); frameEvent && frameEvent->frameStamp)
+        {
+            _simulationTimes.push_back(frameEvent->frameStamp->simulationTime);
+        }
+    }
+
+    if (_simulationTimes.empty())
+    {
+        warn("ReplayBenchmark recorded events contain no FrameEvents, nothing to replay.");
+        return;
+    }
+
+    // retain the whole session so report_json() can cover every replayed frame
+    if (!stats) stats = GpuStatsCollector::create(_simulationTimes.size() + 4);
+    viewer->assignInstrumentation(stats);
+
+    // shift the recorded event times to now so they interleave with the replayed frames
+    auto delta = clock::now() - collectEvents.events.front()->time;
+    _playEvents = PlayEvents::create(events, delta);
+}
+
+bool ReplayBenchmark::advanceToNextFrame()
+{
+    if (!_started)
+    {
+        _started = true;
+        _start();
+    }
+
+    if (!viewer || _frameIndex >= _simulationTimes.size()) return false;
+
+    if (!viewer->advanceToNextFrame(_simulationTimes[_frameIndex])) return false;
+    ++_frameIndex;
+
+    auto& viewer_events = viewer->getEvents();
+
+    // keep the viewer's own FrameEvent, as it marks the new frame to the event handlers, but discard
+    // any polled window input so the replay only sees the recorded session
+    ref_ptr<UIEvent> frameEvent;
+    for (auto& event : viewer_events)
+    {
+        if (event->cast<FrameEvent>()) frameEvent = event;
+    }
+    viewer_events.clear();
+
+    // with no pending viewer events PlayEvents dispatches up to the next recorded FrameEvent, preserving
+    // the capture's event to frame association no matter how fast or slow the replay renders
+    if (_playEvents) _playEvents->dispatchFrameEvents(viewer_events);
+
+    if (frameEvent) viewer_events.push_back(frameEvent);
+
+    return true;
+}
+
+void ReplayBenchmark::report_json(std::ostream& out) const
+{
+    if (!stats)
+    {
+        out << "{}\n";
+        return;
+    }
+
+    auto frames = stats->retainedFrames();
+    size_t first = std::min(warmupFrames, frames.size());
+
+    size_t numFrames = 0;
+    uint64_t totalFrameNs = 0;
+    uint64_t minFrameNs = ~0ull;
+    uint64_t maxFrameNs = 0;
+    std::map<const SourceLocation*, FrameStatsCollector::ScopeStats> cpuScopes;
+    std::map<const SourceLocation*, FrameStatsCollector::ScopeStats> gpuScopes;
+
+    for (size_t i = first; i < frames.size(); ++i)
+    {
+        auto& frame = *frames[i];
+        ++numFrames;
+        totalFrameNs += frame.frameDurationNanoseconds;
+        minFrameNs = std::min(minFrameNs, frame.frameDurationNanoseconds);
+        maxFrameNs = std::max(maxFrameNs, frame.frameDurationNanoseconds);
+
+        for (auto& [sourceLocation, scopeStats] : frame.scopes) cpuScopes[sourceLocation].merge(scopeStats);
+        for (auto& [sourceLocation, scopeStats] : frame.gpuScopes) gpuScopes[sourceLocation].merge(scopeStats);
+    }
+
+    auto write_scopes = [&out, numFrames](const char* label, const std::map<const SourceLocation*, FrameStatsCollector::ScopeStats>& scopes, bool trailingComma) {
+        out << "    \"" << label << "\": {\n";
+        size_t scopeIndex = 0;
+        for (auto& [sourceLocation, scopeStats] : scopes)
+        {
+            const char* scopeName = sourceLocation->name ? sourceLocation->name : sourceLocation->function;
+            out << "      \"" << (scopeName ? scopeName : "unnamed") << "\": {";
+            out << " \"count\": " << scopeStats.count;
+            out << ", \"total_ms\": " << static_cast<double>(scopeStats.totalNanoseconds) * 1e-6;
+            out << ", \"avg_ms_per_frame\": " << (numFrames > 0 ? static_cast<double>(scopeStats.totalNanoseconds) * 1e-6 / static_cast<double>(numFrames) : 0.0);
+            out << ", \"min_ms\": " << static_cast<double>(scopeStats.minNanoseconds) * 1e-6;
+            out << ", \"max_ms\": " << static_cast<double>(scopeStats.maxNanoseconds) * 1e-6;
+            out << " }";
+            if (++scopeIndex < scopes.size()) out << ",";
+            out << "\n";
+        }
+        out << "    }" << (trailingComma ? "," : "") << "\n";
+    };
+
+    out << "{\n  \"summary\": {\n";
+    out << "    \"frames\": " << numFrames << ",\n";
+    out << "    \"warmup_frames_excluded\": " << first << ",\n";
+    if (numFrames > 0)
+    {
+        double avgMs = static_cast<double>(totalFrameNs) * 1e-6 / static_cast<double>(numFrames);
+        out << "    \"frame_ms\": { \"avg\": " << avgMs;
+        out << ", \"min\": " << static_cast<double>(minFrameNs) * 1e-6;
+        out << ", \"max\": " << static_cast<double>(maxFrameNs) * 1e-6 << " },\n";
+        out << "    \"fps\": " << (avgMs > 0.0 ? 1000.0 / avgMs : 0.0) << ",\n";
+    }
+    write_scopes("scopes", cpuScopes, !gpuScopes.empty());
+    if (!gpuScopes.empty()) write_scopes("gpu_scopes", gpuScopes, false);
+    out << "  },\n";
+
+    out << "  \"detail\": ";
+    stats->report_json(out);
+    out << "}\n";
+}
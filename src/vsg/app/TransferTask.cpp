@@ -31,9 +31,19 @@ TransferTask::TransferTask(Device* in_device, uint32_t numBuffers) :
 
     _frames.resize(numBuffers);
 
+    syncObjectPool = in_device->getSyncObjectPool();
+
     //level = Logger::LOGGER_INFO;
 }
 
+TransferTask::~TransferTask()
+{
+    for (auto& frame : _frames)
+    {
+        syncObjectPool->recycle(frame.transferCompleteSemaphore);
+    }
+}
+
 void TransferTask::advance()
 {
     CPU_INSTRUMENTATION_L1(instrumentation);
@@ -69,12 +79,36 @@ bool TransferTask::containsDataToTransfer() const
     return !_dynamicDataMap.empty() || !_dynamicImageInfoSet.empty();
 }
 
+bool TransferTask::containsModifiedData() const
+{
+    auto deviceID = device->deviceID;
+
+    for (const auto& entry : _dynamicDataMap)
+    {
+        for (const auto& offset_bufferInfo : entry.second)
+        {
+            if (offset_bufferInfo.second->requiresCopy(deviceID)) return true;
+        }
+    }
+
+    for (const auto& imageInfo : _dynamicImageInfoSet)
+    {
+        if (imageInfo->requiresCopy(deviceID)) return true;
+    }
+
+    return false;
+}
+
 void TransferTask::assign(const ResourceRequirements::DynamicData& dynamicData)
 {
     CPU_INSTRUMENTATION_L1(instrumentation);
 
     assign(dynamicData.bufferInfos);
     assign(dynamicData.imageInfos);
+
+    // seed the staging size from the collected requirements so the first transfer allocates a right sized buffer up front.
+    VkDeviceSize totalSize = _dynamicDataTotalSize + _dynamicImageTotalSize;
+    if (totalSize > _stagingHighWaterMark) _stagingHighWaterMark = totalSize;
 }
 
 void TransferTask::assign(const BufferInfoList& bufferInfoList)
@@ -138,16 +172,31 @@ void TransferTask::_transferBufferInfos(VkCommandBuffer vk_commandBuffer, Frame&
             {
                 if (bufferInfo->syncModifiedCounts(deviceID))
                 {
+                    // limit the upload to the coalesced dirty range when one has been recorded,
+                    // a size of 0 means no record is available so fall back to the whole buffer.
+                    auto dirtyRange = bufferInfo->data->consumeDirtyRange();
+                    VkDeviceSize dataOffset = dirtyRange.offset;
+                    VkDeviceSize dataSize = dirtyRange.size;
+                    if (dataSize == 0 || dataOffset >= bufferInfo->range)
+                    {
+                        dataOffset = 0;
+                        dataSize = bufferInfo->range;
+                    }
+                    else if (dataSize > bufferInfo->range - dataOffset)
+                    {
+                        dataSize = bufferInfo->range - dataOffset;
+                    }
+
                     // copy data to staging buffer memory
                     char* ptr = reinterpret_cast<char*>(buffer_data) + offset;
-                    std::memcpy(ptr, bufferInfo->data->dataPointer(), bufferInfo->range);
+                    std::memcpy(ptr, reinterpret_cast<const char*>(bufferInfo->data->constDataPointer()) + dataOffset, dataSize);
 
                     // record region
-                    pRegions[regionCount++] = VkBufferCopy{offset, bufferInfo->offset, bufferInfo->range};
+                    pRegions[regionCount++] = VkBufferCopy{offset, bufferInfo->offset + dataOffset, dataSize};
 
                     log(level, "       copying ", bufferInfo, ", ", bufferInfo->data, " to ", (void*)ptr);
 
-                    VkDeviceSize endOfEntry = offset + bufferInfo->range;
+                    VkDeviceSize endOfEntry = offset + dataSize;
                     offset = (/*alignment == 1 ||*/ (endOfEntry % alignment) == 0) ? endOfEntry : ((endOfEntry / alignment) + 1) * alignment;
                 }
 
@@ -276,10 +325,23 @@ void TransferTask::_transferImageInfo(VkCommandBuffer vk_commandBuffer, Frame& f
     // copy data.
     VkFormat sourceFormat = data->properties.format;
     VkFormat targetFormat = imageInfo.imageView->format;
+
+    // VK_EXT_host_image_copy path - for images created with VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT on devices with the extension enabled
+    // the data is written directly from host memory with vkCopyMemoryToImageEXT, bypassing both the staging buffer and the transfer
+    // queue submission. Per texel format conversion and runtime mipmap generation still require the staging path so fall through below.
+    if (sourceFormat == targetFormat || getFormatTraits(sourceFormat).size == getFormatTraits(targetFormat).size)
+    {
+        if (hostTransferImageData(imageInfo.imageView, imageInfo.imageLayout, properties, width, height, depth, mipLevels, mipmapOffsets, data->constDataPointer(), device))
+        {
+            log(level, "    image data copied directly via VK_EXT_host_image_copy.");
+            return;
+        }
+    }
+
     if (sourceFormat == targetFormat)
     {
         log(level, "    sourceFormat and targetFormat compatible.");
-        std::memcpy(ptr, data->dataPointer(), data->dataSize());
+        std::memcpy(ptr, data->constDataPointer(), data->dataSize());
         offset += data->dataSize();
     }
     else
@@ -289,7 +351,7 @@ void TransferTask::_transferImageInfo(VkCommandBuffer vk_commandBuffer, Frame& f
         if (sourceTraits.size == targetTraits.size)
         {
             log(level, "    sourceTraits.size and targetTraits.size compatible.");
-            std::memcpy(ptr, data->dataPointer(), data->dataSize());
+            std::memcpy(ptr, data->constDataPointer(), data->dataSize());
             offset += data->dataSize();
         }
         else
@@ -310,7 +372,7 @@ void TransferTask::_transferImageInfo(VkCommandBuffer vk_commandBuffer, Frame& f
 
             // copy data
             using value_type = uint8_t;
-            const value_type* src_ptr = reinterpret_cast<const value_type*>(data->dataPointer());
+            const value_type* src_ptr = reinterpret_cast<const value_type*>(data->constDataPointer());
 
             value_type* dest_ptr = reinterpret_cast<value_type*>(ptr);
 
@@ -332,8 +394,17 @@ void TransferTask::_transferImageInfo(VkCommandBuffer vk_commandBuffer, Frame& f
         }
     }
 
+    // mipmap generation uses vkCmdBlitImage which is only supported on queue families with graphics capability,
+    // so on a dedicated transfer queue copy any precomputed mipmap levels directly and skip generation of the rest.
+    bool allowMipmapGeneration = !transferQueue || (transferQueue->queueFlags() & VK_QUEUE_GRAPHICS_BIT) != 0;
+    if (!allowMipmapGeneration && mipLevels > 1 && mipmapOffsets.size() <= 1 && !_warnedMipmapGeneration)
+    {
+        warn("TransferTask::_transferImageInfo() transferQueue family does not support vkCmdBlitImage so mipmaps cannot be generated, assign Data with precomputed mipmaps or a graphics capable transferQueue.");
+        _warnedMipmapGeneration = true;
+    }
+
     // transfer data.
-    transferImageData(imageInfo.imageView, imageInfo.imageLayout, properties, width, height, depth, mipLevels, mipmapOffsets, imageStagingBuffer, source_offset, vk_commandBuffer, device);
+    transferImageData(imageInfo.imageView, imageInfo.imageLayout, properties, width, height, depth, mipLevels, mipmapOffsets, imageStagingBuffer, source_offset, vk_commandBuffer, device, allowMipmapGeneration);
 }
 
 VkResult TransferTask::transferDynamicData()
@@ -369,20 +440,31 @@ VkResult TransferTask::transferDynamicData()
         commandBuffer->reset();
     }
 
-    if (!semaphore)
+    if (!semaphore && !timelineSemaphore)
     {
         // signal transfer submission has completed
-        semaphore = Semaphore::create(device, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        semaphore = syncObjectPool->acquireSemaphore(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
     }
 
     VkResult result = VK_SUCCESS;
 
+    // track the largest transfer seen so far so that all the per frame staging buffers settle on the same size
+    if (totalSize > _stagingHighWaterMark) _stagingHighWaterMark = totalSize;
+
     // allocate staging buffer if required
     if (!staging || staging->size < totalSize)
     {
+        // round the allocation up with headroom so that steadily growing dynamic data, such as per frame
+        // skinning matrices, settles on a stable persistently mapped staging buffer after a handful of
+        // reallocations rather than reallocating and remapping each frame slot every time it grows.
+        VkDeviceSize stagingSize = 16 * 1024;
+        while (stagingSize < _stagingHighWaterMark) stagingSize *= 2;
+
         VkMemoryPropertyFlags stagingMemoryPropertiesFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        staging = vsg::createBufferAndMemory(device, totalSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, stagingMemoryPropertiesFlags);
+        staging = vsg::createBufferAndMemory(device, stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, stagingMemoryPropertiesFlags);
 
+        // map the whole buffer once, the mapping is retained for the lifetime of the staging buffer so
+        // each frame's updates are a straight memcpy into buffer_data.
         auto stagingMemory = staging->getDeviceMemory(deviceID);
         buffer_data = nullptr;
         result = stagingMemory->map(staging->getMemoryOffset(deviceID), staging->size, 0, &buffer_data);
@@ -442,12 +524,49 @@ VkResult TransferTask::transferDynamicData()
 
         // set up the vulkan signal sempahore
         std::vector<VkSemaphore> vk_signalSemaphores;
-        vk_signalSemaphores.push_back(*semaphore);
+        if (semaphore) vk_signalSemaphores.push_back(*semaphore);
         for (auto& ss : signalSemaphores)
         {
             vk_signalSemaphores.push_back(*ss);
         }
 
+        // in the dedicated transfer queue mode chain a VkTimelineSemaphoreSubmitInfo that waits for the consumer of this
+        // frame's staging slot to finish with it and signals a new value for the consumer of this transfer to wait on.
+        VkTimelineSemaphoreSubmitInfo timelineSubmitInfo = {};
+        std::vector<uint64_t> vk_waitValues;
+        std::vector<uint64_t> vk_signalValues;
+        if (timelineSemaphore)
+        {
+            currentTransferTimelineValue = _nextTimelineValue++;
+            currentConsumerTimelineValue = _nextTimelineValue++;
+
+            // values associated with binary semaphores are ignored but the arrays must match the semaphore arrays in size
+            vk_waitValues.assign(vk_waitSemaphores.size(), 0);
+            vk_signalValues.assign(vk_signalSemaphores.size(), 0);
+
+            if (frame.consumerTimelineValue != 0)
+            {
+                vk_waitSemaphores.push_back(*timelineSemaphore);
+                vk_waitStages.push_back(VK_PIPELINE_STAGE_TRANSFER_BIT);
+                vk_waitValues.push_back(frame.consumerTimelineValue);
+            }
+            frame.consumerTimelineValue = currentConsumerTimelineValue;
+
+            vk_signalSemaphores.push_back(*timelineSemaphore);
+            vk_signalValues.push_back(currentTransferTimelineValue);
+
+            submitInfo.waitSemaphoreCount = static_cast<uint32_t>(vk_waitSemaphores.size());
+            submitInfo.pWaitSemaphores = vk_waitSemaphores.data();
+            submitInfo.pWaitDstStageMask = vk_waitStages.data();
+
+            timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineSubmitInfo.waitSemaphoreValueCount = static_cast<uint32_t>(vk_waitValues.size());
+            timelineSubmitInfo.pWaitSemaphoreValues = vk_waitValues.data();
+            timelineSubmitInfo.signalSemaphoreValueCount = static_cast<uint32_t>(vk_signalValues.size());
+            timelineSubmitInfo.pSignalSemaphoreValues = vk_signalValues.data();
+            submitInfo.pNext = &timelineSubmitInfo;
+        }
+
         submitInfo.signalSemaphoreCount = static_cast<uint32_t>(vk_signalSemaphores.size());
         submitInfo.pSignalSemaphores = vk_signalSemaphores.data();
 
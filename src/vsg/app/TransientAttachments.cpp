@@ -0,0 +1,162 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/TransientAttachments.h>
+#include <vsg/core/Exception.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+TransientAttachments::TransientAttachments()
+{
+}
+
+TransientAttachments::~TransientAttachments()
+{
+}
+
+void TransientAttachments::add(ref_ptr<Image> image, uint32_t firstPass, uint32_t lastPass)
+{
+    attachments.push_back(Attachment{image, firstPass, lastPass});
+}
+
+void TransientAttachments::compile(Device* device)
+{
+    if (attachments.empty()) return;
+
+    const auto& limits = device->getPhysicalDevice()->getProperties().limits;
+    VkDeviceSize granularity = std::max<VkDeviceSize>(limits.bufferImageGranularity, 1);
+
+    // usage bits that may be combined with VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT
+    const VkImageUsageFlags attachmentOnlyUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+
+    struct Placement
+    {
+        Attachment* attachment = nullptr;
+        VkMemoryRequirements requirements = {};
+        VkDeviceSize offset = 0;
+        bool transient = false;
+    };
+
+    std::vector<Placement> placements;
+    placements.reserve(attachments.size());
+
+    for (auto& attachment : attachments)
+    {
+        if (!attachment.image) continue;
+
+        bool transient = useTransientAttachments && (attachment.image->usage & ~attachmentOnlyUsage) == 0;
+        if (transient) attachment.image->usage |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+
+        attachment.image->compile(device);
+
+        placements.push_back(Placement{&attachment, attachment.image->getMemoryRequirements(device->deviceID), 0, transient});
+    }
+
+    // place the biggest attachments first so smaller ones fill the holes left between them
+    std::sort(placements.begin(), placements.end(), [](const Placement& lhs, const Placement& rhs) { return lhs.requirements.size > rhs.requirements.size; });
+
+    // group the placements into heaps of attachments that can share a memory type, keeping the
+    // transient attachments separate so their heap can come from lazily allocated memory
+    struct Heap
+    {
+        uint32_t memoryTypeBits = 0;
+        VkDeviceSize alignment = 1;
+        VkDeviceSize size = 0;
+        bool transient = false;
+        std::vector<Placement> placements;
+    };
+    std::vector<Heap> heaps;
+
+    auto overlapsLifetime = [](const Attachment& lhs, const Attachment& rhs) -> bool {
+        return !(lhs.lastPass < rhs.firstPass || rhs.lastPass < lhs.firstPass);
+    };
+
+    for (auto& placement : placements)
+    {
+        Heap* heap = nullptr;
+        for (auto& candidate : heaps)
+        {
+            if (candidate.transient == placement.transient && (candidate.memoryTypeBits & placement.requirements.memoryTypeBits) != 0)
+            {
+                heap = &candidate;
+                break;
+            }
+        }
+        if (!heap)
+        {
+            heaps.push_back(Heap{placement.requirements.memoryTypeBits, 1, 0, placement.transient, {}});
+            heap = &heaps.back();
+        }
+
+        heap->memoryTypeBits &= placement.requirements.memoryTypeBits;
+        heap->alignment = std::max(heap->alignment, placement.requirements.alignment);
+
+        // find the lowest offset where the attachment fits without overlapping any placed attachment
+        // whose lifetime overlaps - attachments with disjoint lifetimes are free to alias each other
+        VkDeviceSize alignment = std::max(placement.requirements.alignment, granularity);
+        VkDeviceSize offset = 0;
+        bool conflicted = true;
+        while (conflicted)
+        {
+            conflicted = false;
+            for (auto& placed : heap->placements)
+            {
+                if (!overlapsLifetime(*placed.attachment, *placement.attachment)) continue;
+
+                if (offset < placed.offset + placed.requirements.size && placed.offset < offset + placement.requirements.size)
+                {
+                    offset = ((placed.offset + placed.requirements.size + alignment - 1) / alignment) * alignment;
+                    conflicted = true;
+                }
+            }
+        }
+
+        placement.offset = offset;
+        heap->size = std::max(heap->size, offset + placement.requirements.size);
+        heap->placements.push_back(placement);
+    }
+
+    // allocate each heap and bind the attachments at their computed offsets
+    _totalMemorySize = 0;
+    for (auto& heap : heaps)
+    {
+        VkMemoryRequirements heapRequirements{heap.size, heap.alignment, heap.memoryTypeBits};
+
+        ref_ptr<DeviceMemory> deviceMemory;
+        if (heap.transient)
+        {
+            try
+            {
+                deviceMemory = DeviceMemory::create(device, heapRequirements, VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+            }
+            catch (const Exception&)
+            {
+                // no lazily allocated memory type on this device, fall back to ordinary device local memory
+            }
+        }
+        if (!deviceMemory) deviceMemory = DeviceMemory::create(device, heapRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        for (auto& placement : heap.placements)
+        {
+            if (VkResult result = placement.attachment->image->bind(deviceMemory, placement.offset); result != VK_SUCCESS)
+            {
+                throw Exception{"Error: TransientAttachments::compile(..) failed to bind attachment to aliased DeviceMemory.", result};
+            }
+        }
+
+        _totalMemorySize += heap.size;
+    }
+}
@@ -12,9 +12,32 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/app/UpdateOperations.h>
 #include <vsg/io/Options.h>
+#include <vsg/threading/Latch.h>
+
+#include <set>
 
 using namespace vsg;
 
+namespace
+{
+    // wraps an independent operation so the caller can join all of them via a shared Latch
+    struct JoinedOperation : public vsg::Inherit<Operation, JoinedOperation>
+    {
+        JoinedOperation(ref_ptr<Operation> in_operation, ref_ptr<Latch> in_latch) :
+            operation(in_operation),
+            latch(in_latch) {}
+
+        ref_ptr<Operation> operation;
+        ref_ptr<Latch> latch;
+
+        void run() override
+        {
+            operation->run();
+            latch->count_down();
+        }
+    };
+} // namespace
+
 UpdateOperations::UpdateOperations()
 {
 }
@@ -23,20 +46,20 @@ UpdateOperations::~UpdateOperations()
 {
 }
 
-void UpdateOperations::add(ref_ptr<Operation> op, RunBehavior runBehavior)
+void UpdateOperations::add(ref_ptr<Operation> op, RunBehavior runBehavior, bool independent)
 {
     std::scoped_lock<std::mutex> lock(_updateOperationMutex);
     if (runBehavior == ONE_TIME)
-        _updateOperationsOneTime.push_back(op);
+        _updateOperationsOneTime.push_back(Entry{op, independent});
     else
-        _updateOperationsAllFrames.push_back(op);
+        _updateOperationsAllFrames.push_back(Entry{op, independent});
 }
 
 void UpdateOperations::remove(ref_ptr<Operation> op)
 {
     std::scoped_lock<std::mutex> lock(_updateOperationMutex);
-    _updateOperationsOneTime.remove(op);
-    _updateOperationsAllFrames.remove(op);
+    _updateOperationsOneTime.remove_if([&op](const Entry& entry) { return entry.operation == op; });
+    _updateOperationsAllFrames.remove_if([&op](const Entry& entry) { return entry.operation == op; });
 }
 
 void UpdateOperations::clear()
@@ -46,27 +69,70 @@ void UpdateOperations::clear()
     _updateOperationsAllFrames.clear();
 }
 
+bool UpdateOperations::empty() const
+{
+    std::scoped_lock<std::mutex> lock(_updateOperationMutex);
+    return _updateOperationsOneTime.empty() && _updateOperationsAllFrames.empty();
+}
+
 UpdateOperations::container_type UpdateOperations::getUpdateOperationsOneTime() const
 {
     std::scoped_lock<std::mutex> lock(_updateOperationMutex);
-    return _updateOperationsOneTime;
+    container_type operations;
+    for (auto& entry : _updateOperationsOneTime) operations.push_back(entry.operation);
+    return operations;
 }
 
 UpdateOperations::container_type UpdateOperations::getUpdateOperationsAllFrames() const
 {
     std::scoped_lock<std::mutex> lock(_updateOperationMutex);
-    return _updateOperationsAllFrames;
+    container_type operations;
+    for (auto& entry : _updateOperationsAllFrames) operations.push_back(entry.operation);
+    return operations;
 }
 
 void UpdateOperations::run()
 {
-    container_type updateOperations;
+    std::list<Entry> entries;
 
     {
         std::scoped_lock<std::mutex> lock(_updateOperationMutex);
-        _updateOperationsOneTime.swap(updateOperations);
-        updateOperations.insert(updateOperations.end(), _updateOperationsAllFrames.begin(), _updateOperationsAllFrames.end());
+        _updateOperationsOneTime.swap(entries);
+        entries.insert(entries.end(), _updateOperationsAllFrames.begin(), _updateOperationsAllFrames.end());
+    }
+
+    // coalesce duplicates - the same operation enqueued from multiple systems runs once per frame
+    if (coalesceDuplicates)
+    {
+        std::set<Operation*> seen;
+        entries.remove_if([&seen](const Entry& entry) { return !seen.insert(entry.operation.get()).second; });
+    }
+
+    if (operationThreads)
+    {
+        std::vector<ref_ptr<Operation>> independent;
+        for (auto& entry : entries)
+        {
+            if (entry.independent) independent.push_back(entry.operation);
+        }
+
+        if (!independent.empty())
+        {
+            // distribute the independent operations across the threads, run the ordered ones here,
+            // then help out and join so all updates have completed before returning to Viewer::update()
+            auto latch = Latch::create(independent.size());
+            for (auto& op : independent) operationThreads->add(JoinedOperation::create(op, latch));
+
+            for (auto& entry : entries)
+            {
+                if (!entry.independent) entry.operation->run();
+            }
+
+            operationThreads->run();
+            latch->wait();
+            return;
+        }
     }
 
-    for (auto op : updateOperations) op->run();
+    for (auto& entry : entries) entry.operation->run();
 }
@@ -0,0 +1,140 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/UpdateThread.h>
+#include <vsg/io/Options.h>
+#include <vsg/maths/transform.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+UpdateThread::UpdateThread(ref_ptr<Operation> in_updateOperation, double in_updatesPerSecond, ref_ptr<ActivityStatus> in_status) :
+    updateOperation(in_updateOperation),
+    updatesPerSecond(in_updatesPerSecond),
+    status(in_status)
+{
+    if (!status) status = ActivityStatus::create();
+}
+
+UpdateThread::~UpdateThread()
+{
+    stop();
+}
+
+void UpdateThread::start()
+{
+    if (_thread.joinable()) return;
+
+    // seed the simulation matrices from the scene so the first steps interpolate from the current state
+    simulationMatrices.resize(transforms.size());
+    for (size_t i = 0; i < transforms.size(); ++i)
+    {
+        simulationMatrices[i] = transforms[i]->matrix;
+    }
+
+    status->set(true);
+    _thread = std::thread([this]() { _run(); });
+}
+
+void UpdateThread::stop()
+{
+    status->set(false);
+
+    if (_thread.joinable()) _thread.join();
+}
+
+void UpdateThread::_run()
+{
+    auto period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(updatesPerSecond > 0.0 ? 1.0 / updatesPerSecond : 0.02));
+    auto next = vsg::clock::now() + period;
+
+    while (status->active())
+    {
+        if (updateOperation) updateOperation->run();
+
+        _snapshot();
+
+        auto now = vsg::clock::now();
+        if (next > now)
+        {
+            std::this_thread::sleep_until(next);
+            next += period;
+        }
+        else
+        {
+            // the step overran the period, resync rather than trying to catch up
+            next = now + period;
+        }
+    }
+}
+
+void UpdateThread::_snapshot()
+{
+    // snapshots are immutable once published, so apply() can keep using one it has taken a
+    // reference to while later steps publish their successors
+    auto snapshot = Snapshot::create();
+    snapshot->time = vsg::clock::now();
+
+    snapshot->translations.resize(simulationMatrices.size());
+    snapshot->rotations.resize(simulationMatrices.size());
+    snapshot->scales.resize(simulationMatrices.size());
+
+    for (size_t i = 0; i < simulationMatrices.size(); ++i)
+    {
+        decompose(simulationMatrices[i], snapshot->translations[i], snapshot->rotations[i], snapshot->scales[i]);
+    }
+
+    std::scoped_lock lock(_snapshotMutex);
+    _previous = _latest;
+    _latest = snapshot;
+}
+
+void UpdateThread::apply(clock::time_point time)
+{
+    ref_ptr<Snapshot> latest, previous;
+    {
+        std::scoped_lock lock(_snapshotMutex);
+        latest = _latest;
+        previous = _previous;
+    }
+
+    if (!latest) return;
+
+    if (interpolate && previous && latest->time > previous->time)
+    {
+        double interval = std::chrono::duration<double>(latest->time - previous->time).count();
+        double r = std::clamp(std::chrono::duration<double>(time - previous->time).count() / interval, 0.0, 1.0);
+
+        for (size_t i = 0; i < transforms.size() && i < latest->translations.size() && i < previous->translations.size(); ++i)
+        {
+            transforms[i]->matrix = translate(mix(previous->translations[i], latest->translations[i], r)) *
+                                    rotate(mix(previous->rotations[i], latest->rotations[i], r)) *
+                                    scale(mix(previous->scales[i], latest->scales[i], r));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < transforms.size() && i < latest->translations.size(); ++i)
+        {
+            transforms[i]->matrix = translate(latest->translations[i]) *
+                                    rotate(latest->rotations[i]) *
+                                    scale(latest->scales[i]);
+        }
+    }
+}
+
+void UpdateThread::apply()
+{
+    auto period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(updatesPerSecond > 0.0 ? 1.0 / updatesPerSecond : 0.02));
+    apply(vsg::clock::now() - period);
+}
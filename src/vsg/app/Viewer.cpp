@@ -13,13 +13,21 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/CompileTraversal.h>
 #include <vsg/app/View.h>
 #include <vsg/app/Viewer.h>
+#include <vsg/io/FileSystem.h>
 #include <vsg/io/Logger.h>
+#include <vsg/io/read.h>
+#include <vsg/io/write.h>
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/state/Descriptor.h>
+#include <vsg/threading/Affinity.h>
+#include <vsg/ui/EventPool.h>
+#include <vsg/vk/DestructionQueue.h>
 
+#include <algorithm>
 #include <chrono>
 #include <map>
 #include <set>
+#include <thread>
 
 using namespace vsg;
 
@@ -70,6 +78,30 @@ void Viewer::deviceWaitIdle() const
     }
 }
 
+void Viewer::deferDestruction(ref_ptr<Object> object)
+{
+    if (!object) return;
+
+    // make sure every device with an active task has a queue to park the object on
+    for (auto& task : recordAndSubmitTasks)
+    {
+        if (task->device)
+        {
+            auto& destructionQueue = _destructionQueues[task->device];
+            if (!destructionQueue) destructionQueue = task->device->getDestructionQueue();
+        }
+    }
+
+    // with no tasks nothing is in flight, so let the caller's reference release the object immediately
+    if (_destructionQueues.empty()) return;
+
+    // park the object on every device's queue, as subgraphs may hold resources compiled for each of them
+    for (auto& [device, destructionQueue] : _destructionQueues)
+    {
+        destructionQueue->defer(object);
+    }
+}
+
 void Viewer::addWindow(ref_ptr<Window> window)
 {
     // make sure the addition is unique
@@ -147,9 +179,35 @@ bool Viewer::pollEvents(bool discardPreviousEvents)
         if (window->pollEvents(_events)) result = true;
     }
 
+    if (coalesceEvents && result) vsg::coalesceEvents(_events);
+
     return result;
 }
 
+bool Viewer::requiresRedraw()
+{
+    // explicit requests consume the flag so each requestRedraw() yields a single frame
+    if (_redrawRequested.exchange(false)) return true;
+
+    // pending update operations will modify the scene in the next update()
+    if (updateOperations && !updateOperations->empty()) return true;
+
+    // playing animations modify the scene every frame
+    if (animationManager && !animationManager->animations.empty()) return true;
+
+    for (auto& task : recordAndSubmitTasks)
+    {
+        // database pager still loading, or with newly loaded subgraphs awaiting merge
+        if (task->databasePager && task->databasePager->requiresUpdateSceneGraph()) return true;
+
+        // dynamic data modified since it was last transferred to the GPU
+        if (task->earlyTransferTask && task->earlyTransferTask->containsModifiedData()) return true;
+        if (task->lateTransferTask && task->lateTransferTask->containsModifiedData()) return true;
+    }
+
+    return false;
+}
+
 bool Viewer::advanceToNextFrame(double simulationTime)
 {
     static constexpr SourceLocation s_frame_source_location{"Viewer advanceToNextFrame", VsgFunctionName, __FILE__, __LINE__, COLOR_VIEWER, 1};
@@ -162,8 +220,24 @@ bool Viewer::advanceToNextFrame(double simulationTime)
         return false;
     }
 
+    // delay the start of the frame when pacing against the display refresh
+    if (framePacer) framePacer->pace();
+
     // poll all the windows for events.
-    pollEvents(true);
+    bool newEvents = pollEvents(true);
+
+    if (renderOnDemand)
+    {
+        // block until something marks the scene dirty, continuing to poll the windows so events collected
+        // during the wait are dispatched with the frame that they trigger.
+        while (active() && !newEvents && !requiresRedraw())
+        {
+            std::this_thread::sleep_for(std::chrono::duration<double>(renderOnDemandPollInterval));
+            if (pollEvents(false)) newEvents = true;
+        }
+
+        if (!active()) return false;
+    }
 
     if (!acquireNextFrame()) return false;
 
@@ -282,6 +356,23 @@ void Viewer::compile(ref_ptr<ResourceHints> hints)
         return;
     }
 
+    // when the caller doesn't provide hints, apply any captured by a previous run
+    if (!hints && resourceHintsFilename)
+    {
+        hints = vsg::read_cast<ResourceHints>(resourceHintsFilename);
+
+        // discard cached hints keyed to a scene file that has since changed
+        if (hints && resourceHintsSceneFilename)
+        {
+            std::string cachedStamp;
+            if (!hints->getValue("sceneModificationStamp", cachedStamp) || cachedStamp != fileModificationStamp(resourceHintsSceneFilename))
+            {
+                info("Viewer::compile() scene file ", resourceHintsSceneFilename, " has changed, ignoring cached ResourceHints ", resourceHintsFilename);
+                hints = {};
+            }
+        }
+    }
+
     auto start_tick = clock::now();
 
     bool containsPagedLOD = false;
@@ -331,11 +422,22 @@ void Viewer::compile(ref_ptr<ResourceHints> hints)
         {
             context->commandPool = vsg::CommandPool::create(device, queueFamily, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
             context->graphicsQueue = device->getQueue(queueFamily);
+            context->framesInFlight = std::max(framesInFlight, 1u);
 
             context->reserve(resourceRequirements);
         }
     }
 
+    // capture the collected requirements so captureResourceHints() can persist them for future runs
+    for (auto& dp : deviceResourceMap)
+    {
+        auto capturedHints = dp.second.collectResources.createResourceHints();
+        if (!_capturedResourceHints)
+            _capturedResourceHints = capturedHints;
+        else
+            _capturedResourceHints->add(*capturedHints);
+    }
+
     // assign the viewID's to each View
     for (auto& [const_view, binDetails] : views)
     {
@@ -441,6 +543,39 @@ void Viewer::compile(ref_ptr<ResourceHints> hints)
     debug("Viewer::compile() ", compile_time, "ms");
 }
 
+ref_ptr<ResourceHints> Viewer::captureResourceHints() const
+{
+    auto hints = ResourceHints::create();
+
+    if (_capturedResourceHints) hints->add(*_capturedResourceHints);
+
+    if (compileManager)
+    {
+        if (auto accumulatedHints = compileManager->accumulatedResourceHints()) hints->add(*accumulatedHints);
+    }
+
+    if (hints->empty()) return {};
+
+    return hints;
+}
+
+bool Viewer::writeResourceHints(const Path& filename, ref_ptr<const Options> options)
+{
+    auto path = filename ? filename : resourceHintsFilename;
+    if (!path) return false;
+
+    auto hints = captureResourceHints();
+    if (!hints) return false;
+
+    // key the cache to the scene file so compile() can detect when it goes stale
+    if (resourceHintsSceneFilename)
+    {
+        hints->setValue("sceneModificationStamp", fileModificationStamp(resourceHintsSceneFilename));
+    }
+
+    return vsg::write(hints, path, options);
+}
+
 void Viewer::assignRecordAndSubmitTaskAndPresentation(CommandGraphs in_commandGraphs)
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer assignRecordAndSubmitTaskAndPresentation", COLOR_VIEWER);
@@ -522,7 +657,7 @@ void Viewer::assignRecordAndSubmitTaskAndPresentation(CommandGraphs in_commandGr
             commandGraphs.insert(commandGraphs.end(), primary_commandGraphs.begin(), primary_commandGraphs.end());
         }
 
-        uint32_t numBuffers = 3;
+        uint32_t numBuffers = std::max(framesInFlight, 1u);
 
         auto device = deviceQueueFamily.device;
 
@@ -601,6 +736,26 @@ void Viewer::assignRecordAndSubmitTaskAndPresentation(CommandGraphs in_commandGr
         }
     }
 
+    // CommandGraphs assigned a dedicated compute queueFamily end up in their own RecordAndSubmitTask submitted to
+    // the compute queue, so their work (particles, light clustering, skinning etc.) overlaps the graphics queue's
+    // early passes. Automatically make the graphics tasks on the same device wait, via the compute task's per frame
+    // timeline value, so the compute outputs are consumed in the right order.
+    for (auto& producerTask : recordAndSubmitTasks)
+    {
+        if (!producerTask->queue || (producerTask->queue->queueFlags() & VK_QUEUE_GRAPHICS_BIT) != 0) continue;
+        if ((producerTask->queue->queueFlags() & VK_QUEUE_COMPUTE_BIT) == 0) continue;
+
+        for (auto& consumerTask : recordAndSubmitTasks)
+        {
+            if (consumerTask == producerTask || consumerTask->device != producerTask->device) continue;
+
+            if (consumerTask->queue && (consumerTask->queue->queueFlags() & VK_QUEUE_GRAPHICS_BIT) != 0)
+            {
+                consumerTask->dependsOn(producerTask);
+            }
+        }
+    }
+
     if (needToStartThreading) setupThreading();
 }
 
@@ -650,6 +805,14 @@ void Viewer::setupThreading()
     _frameBlock = FrameBlock::create(status);
     _submissionCompleted = Barrier::create(1 + numValidTasks);
 
+    // each record thread is placed on its own physical performance core, falling back to
+    // leaving threads unpinned once the distinct cores have been used up.
+    uint32_t recordThreadIndex = 0;
+    auto applyThreadAffinity = [&](std::thread& thread) {
+        if (!automaticThreadAffinity) return;
+        if (auto affinity = renderThreadAffinity(recordThreadIndex++)) setAffinity(thread, affinity);
+    };
+
     // set up required threads for each task
     for (auto& task : recordAndSubmitTasks)
     {
@@ -674,6 +837,7 @@ void Viewer::setupThreading()
             };
 
             threads.emplace_back(run, task, _frameBlock, _submissionCompleted, make_string("Viewer run thread"));
+            applyThreadAffinity(threads.back());
         }
         else if (!task->commandGraphs.empty())
         {
@@ -783,11 +947,14 @@ void Viewer::setupThreading()
                     threads.emplace_back(run_primary, sharedData, task->commandGraphs[i], make_string("Viewer primary thread"));
                 else
                     threads.emplace_back(run_secondary, sharedData, task->commandGraphs[i], make_string("Viewer seconary thread ", i));
+
+                applyThreadAffinity(threads.back());
             }
 
             if (task->earlyTransferTask)
             {
                 threads.emplace_back(run_transfer, sharedData, task->earlyTransferTask, make_string("Viewer earlyDynamicData thread"));
+                applyThreadAffinity(threads.back());
             }
         }
     }
@@ -834,6 +1001,9 @@ void Viewer::update()
 
     // run aniamtions
     animationManager->run(_frameStamp);
+
+    // apply the latest snapshot from the decoupled update thread
+    if (updateThread) updateThread->apply();
 }
 
 void Viewer::recordAndSubmit()
@@ -863,10 +1033,75 @@ void Viewer::recordAndSubmit()
     }
     else
     {
-        for (auto& recordAndSubmitTask : recordAndSubmitTasks)
+        // group the tasks by the queue they submit to, preserving task order, so that tasks targeting the same queue
+        // can combine their submissions into a single vkQueueSubmit call rather than paying for one per task.
+        std::vector<std::pair<ref_ptr<Queue>, RecordAndSubmitTasks>> queueTasks;
+        for (auto& task : recordAndSubmitTasks)
         {
-            recordAndSubmitTask->submit(_frameStamp);
+            auto itr = std::find_if(queueTasks.begin(), queueTasks.end(), [&task](const auto& entry) { return entry.first == task->queue; });
+            if (itr != queueTasks.end())
+                itr->second.push_back(task);
+            else
+                queueTasks.emplace_back(task->queue, RecordAndSubmitTasks{task});
         }
+
+        for (auto& [queue, tasks] : queueTasks)
+        {
+            if (tasks.size() == 1)
+            {
+                tasks.front()->submit(_frameStamp);
+                continue;
+            }
+
+            // only a single Fence can be passed to vkQueueSubmit, so the first task's fence collects the dependencies
+            // of the whole batch, and its wait in start() releases the resources of all the batched tasks, so run all
+            // the tasks' start() before any of them record.
+            for (auto& task : tasks)
+            {
+                task->start();
+            }
+
+            std::vector<ref_ptr<RecordedCommandBuffers>> recordedCommandBuffers;
+            for (auto& task : tasks)
+            {
+                if (task->earlyTransferTask) task->earlyTransferTask->transferDynamicData();
+
+                auto taskRecordedCommandBuffers = RecordedCommandBuffers::create();
+                task->record(taskRecordedCommandBuffers, _frameStamp);
+                recordedCommandBuffers.push_back(taskRecordedCommandBuffers);
+            }
+
+            auto batch_fence = tasks.front()->fence();
+            std::vector<ref_ptr<RecordAndSubmitTask::Submission>> submissions;
+            std::vector<VkSubmitInfo> submitInfos;
+            for (size_t i = 0; i < tasks.size(); ++i)
+            {
+                ref_ptr<RecordAndSubmitTask::Submission> submission;
+                tasks[i]->buildSubmission(recordedCommandBuffers[i], batch_fence, submission);
+                if (submission)
+                {
+                    submissions.push_back(submission);
+                    submitInfos.push_back(submission->submitInfo);
+                }
+            }
+
+            if (!submitInfos.empty()) queue->submit(submitInfos, batch_fence);
+        }
+    }
+
+    // hand any objects parked by deferDestruction() over to the devices' queues guarded by this frame's
+    // fences, and destroy the batches from earlier frames whose fences have signaled. Only fences with
+    // dependencies were actually submitted - when tasks batch their submissions into one vkQueueSubmit only
+    // the batch fence guards the frame, and a never submitted fence would never signal.
+    for (auto& [device, destructionQueue] : _destructionQueues)
+    {
+        DestructionQueue::Fences frameFences;
+        for (auto& task : recordAndSubmitTasks)
+        {
+            auto task_fence = task->fence();
+            if (task->device == device && task_fence && task_fence->hasDependencies()) frameFences.emplace_back(ref_ptr<Fence>(task_fence));
+        }
+        destructionQueue->advance(frameFences);
     }
 }
 
@@ -874,6 +1109,13 @@ void Viewer::present()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Viewer present", COLOR_VIEWER);
 
+    if (synchronizedPresentation && presentations.size() > 1)
+    {
+        // wait for every device to finish rendering the frame before any of the presents are issued,
+        // so the swapchain flips of the separate devices land in the same refresh.
+        waitForFences(0, std::numeric_limits<uint64_t>::max());
+    }
+
     for (auto& presentation : presentations)
     {
         presentation->present();
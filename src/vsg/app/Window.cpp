@@ -18,6 +18,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 #include <vsg/maths/color.h>
 #include <vsg/maths/vec4.h>
+#include <vsg/ui/EventPool.h>
 #include <vsg/ui/ApplicationEvent.h>
 #include <vsg/vk/SubmitCommands.h>
 
@@ -39,6 +40,8 @@ Window::Window(ref_ptr<WindowTraits> traits) :
     _clearColor{0.2f, 0.2f, 0.4f, 1.0f},
     _framebufferSamples(VK_SAMPLE_COUNT_1_BIT)
 {
+    eventPool = EventPool::create();
+
     if (_traits && (_traits->swapchainPreferences.surfaceFormat.format == VK_FORMAT_B8G8R8A8_SRGB || _traits->swapchainPreferences.surfaceFormat.format == VK_FORMAT_B8G8R8_SRGB))
     {
         _clearColor = linear_to_sRGB(_clearColor);
@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/commands/ClearAttachments.h>
 #include <vsg/io/Options.h>
 #include <vsg/nodes/StateGroup.h>
+#include <vsg/state/DynamicState.h>
 #include <vsg/vk/Context.h>
 #include <vsg/vk/State.h>
 
@@ -104,14 +105,26 @@ void WindowResizeHandler::apply(vsg::BindGraphicsPipeline& bindPipeline)
         struct ContainsViewport : public ConstVisitor
         {
             bool foundViewport = false;
+            bool dynamicViewport = false;
+            bool dynamicScissor = false;
             void apply(const ViewportState&) override { foundViewport = true; }
+            void apply(const DynamicState& ds) override
+            {
+                for (auto dynamic : ds.dynamicStates)
+                {
+                    if (dynamic == VK_DYNAMIC_STATE_VIEWPORT) dynamicViewport = true;
+                    if (dynamic == VK_DYNAMIC_STATE_SCISSOR) dynamicScissor = true;
+                }
+            }
             bool operator()(const GraphicsPipeline& gp)
             {
                 for (auto& pipelineState : gp.pipelineStates)
                 {
                     pipelineState->accept(*this);
                 }
-                return foundViewport;
+                // pipelines with dynamic viewport and scissor pick the new dimensions up at record
+                // time so, like ones with their own baked in ViewportState, need no recreation
+                return foundViewport || (dynamicViewport && dynamicScissor);
             }
         } containsViewport;
 
@@ -36,6 +36,7 @@ WindowTraits::WindowTraits(const WindowTraits& traits, const CopyOp& copyop) :
     decoration(traits.decoration),
     hdpi(traits.hdpi),
     overrideRedirect(traits.overrideRedirect),
+    dedicatedEventThread(traits.dedicatedEventThread),
     vulkanVersion(traits.vulkanVersion),
     swapchainPreferences(traits.swapchainPreferences),
     depthFormat(traits.depthFormat),
@@ -110,5 +110,9 @@ void BindIndexBuffer::compile(Context& context)
 
 void BindIndexBuffer::record(CommandBuffer& commandBuffer) const
 {
-    vkCmdBindIndexBuffer(commandBuffer, indices->buffer->vk(commandBuffer.deviceID), indices->offset, indexType);
+    VkBuffer vkBuffer = indices->buffer->vk(commandBuffer.deviceID);
+    if (commandBuffer.assignIndexBufferBinding(vkBuffer, indices->offset, indexType))
+    {
+        commandBuffer.dispatch->vkCmdBindIndexBuffer(commandBuffer, vkBuffer, indices->offset, indexType);
+    }
 }
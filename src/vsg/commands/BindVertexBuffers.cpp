@@ -11,6 +11,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/commands/BindVertexBuffers.h>
+#include <vsg/core/ArraySoA.h>
 #include <vsg/core/compare.h>
 #include <vsg/io/Options.h>
 #include <vsg/vk/Context.h>
@@ -43,7 +44,18 @@ void BindVertexBuffers::assignArrays(const DataList& arrayData)
     arrays.reserve(arrayData.size());
     for (auto& data : arrayData)
     {
-        arrays.push_back(BufferInfo::create(data));
+        // expand structure of arrays data into one vertex buffer binding per channel
+        if (auto soa = data.cast<ArraySoA>())
+        {
+            for (size_t c = 0; c < soa->channels.size(); ++c)
+            {
+                arrays.push_back(BufferInfo::create(soa->channelView(c)));
+            }
+        }
+        else
+        {
+            arrays.push_back(BufferInfo::create(data));
+        }
     }
 }
 
@@ -109,5 +121,8 @@ void BindVertexBuffers::compile(Context& context)
 void BindVertexBuffers::record(CommandBuffer& commandBuffer) const
 {
     auto& vkd = _vulkanData[commandBuffer.deviceID];
-    vkCmdBindVertexBuffers(commandBuffer, firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data());
+    if (commandBuffer.assignVertexBufferBindings(firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data()))
+    {
+        commandBuffer.dispatch->vkCmdBindVertexBuffers(commandBuffer, firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data());
+    }
 }
@@ -0,0 +1,135 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/CachedCommands.h>
+#include <vsg/io/Options.h>
+#include <vsg/utils/FindDynamicObjects.h>
+
+using namespace vsg;
+
+CachedCommands::CachedCommands(ref_ptr<SecondaryCommandGraph> in_secondaryCommandGraph) :
+    secondaryCommandGraph(in_secondaryCommandGraph)
+{
+    // the cached command buffer is replayed by every in flight frame so must be recorded for simultaneous use
+    if (secondaryCommandGraph) secondaryCommandGraph->simultaneousUse = true;
+}
+
+CachedCommands::~CachedCommands()
+{
+    // release the holds that keep the SecondaryCommandGraph from re-recording the cached command buffers
+    if (_commandBuffer) _commandBuffer->numDependentSubmissions().fetch_sub(1);
+    for (auto& retired : _retired) retired.commandBuffer->numDependentSubmissions().fetch_sub(1);
+}
+
+void CachedCommands::invalidate()
+{
+    std::scoped_lock lock(_mutex);
+    _invalidate();
+}
+
+void CachedCommands::_invalidate() const
+{
+    if (_commandBuffer)
+    {
+        // keep the retired command buffer's submission count elevated until any in flight replays have completed,
+        // preventing the SecondaryCommandGraph from resetting and re-recording it while the GPU may still be executing it.
+        _retired.push_back(RetiredCommandBuffer{_commandBuffer, retentionFrames});
+        _commandBuffer = {};
+    }
+
+    _trackedData.clear();
+    _trackedCameras.clear();
+}
+
+bool CachedCommands::_subgraphModified() const
+{
+    bool modified = false;
+
+    for (auto& tracked : _trackedData)
+    {
+        if (tracked.data->getModifiedCount(tracked.modifiedCount)) modified = true;
+    }
+
+    for (auto& tracked : _trackedCameras)
+    {
+        if (tracked.camera->viewMatrix && tracked.camera->viewMatrix->transform() != tracked.viewMatrix) modified = true;
+        if (tracked.camera->projectionMatrix && tracked.camera->projectionMatrix->transform() != tracked.projectionMatrix) modified = true;
+    }
+
+    return modified;
+}
+
+void CachedCommands::record(CommandBuffer& commandBuffer) const
+{
+    std::scoped_lock lock(_mutex);
+
+    // release retired command buffers once any in flight replays have had time to complete
+    for (auto itr = _retired.begin(); itr != _retired.end();)
+    {
+        if (itr->framesRemaining > 0) --itr->framesRemaining;
+        if (itr->framesRemaining == 0)
+        {
+            itr->commandBuffer->numDependentSubmissions().fetch_sub(1);
+            itr = _retired.erase(itr);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    if (_commandBuffer && _subgraphModified()) _invalidate();
+
+    if (!_commandBuffer && secondaryCommandGraph)
+    {
+        // capture the subgraph into a secondary command buffer. The CommandBuffer's submission count is incremented
+        // by the record and never registered with a Fence, so the SecondaryCommandGraph's ring won't reuse it until
+        // the cache releases its hold.
+        auto recordedCommandBuffers = RecordedCommandBuffers::create();
+        secondaryCommandGraph->record(recordedCommandBuffers);
+
+        auto buffers = recordedCommandBuffers->buffers();
+        if (!buffers.empty())
+        {
+            _commandBuffer = buffers.front();
+
+            // snapshot the dynamic data within the subgraph so subsequent modifications trigger a re-record
+            auto findDynamicObjects = FindDynamicObjects::create();
+            secondaryCommandGraph->accept(*findDynamicObjects);
+            for (auto& object : findDynamicObjects->dynamicObjects)
+            {
+                if (auto data = object->cast<Data>())
+                {
+                    TrackedData tracked{ref_ptr<const Data>(data), {}};
+                    data->getModifiedCount(tracked.modifiedCount);
+                    _trackedData.push_back(tracked);
+                }
+            }
+
+            // snapshot the view and projection matrices of any Cameras so view parameter changes trigger a re-record
+            auto findCameras = FindCameras::create();
+            secondaryCommandGraph->accept(*findCameras);
+            for (auto& [objectPath, camera] : findCameras->cameras)
+            {
+                _trackedCameras.push_back(TrackedCamera{camera,
+                                                        camera->viewMatrix ? camera->viewMatrix->transform() : dmat4{},
+                                                        camera->projectionMatrix ? camera->projectionMatrix->transform() : dmat4{}});
+            }
+        }
+    }
+
+    if (_commandBuffer)
+    {
+        VkCommandBuffer vk_commandBuffer = *_commandBuffer;
+        vkCmdExecuteCommands(commandBuffer, 1, &vk_commandBuffer);
+    }
+}
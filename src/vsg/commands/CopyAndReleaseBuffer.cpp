@@ -34,7 +34,8 @@ void CopyAndReleaseBuffer::copy(ref_ptr<Data> data, ref_ptr<BufferInfo> dest)
     //debug("CopyAndReleaseImage::copyDirectly() dataSize = ", dataSize);
 
     VkMemoryPropertyFlags memoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    ref_ptr<BufferInfo> stagingBufferInfo = stagingMemoryBufferPools->reserveBuffer(dataSize, alignment, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, memoryPropertyFlags);
+    ref_ptr<BufferInfo> stagingBufferInfo = _recycleStagingBuffer(dataSize, alignment);
+    if (!stagingBufferInfo) stagingBufferInfo = stagingMemoryBufferPools->reserveBuffer(dataSize, alignment, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, memoryPropertyFlags);
     stagingBufferInfo->data = data;
 
     //debug("stagingBufferInfo->buffer ", stagingBufferInfo->buffer.get(), ", ", stagingBufferInfo->offset, ", ", stagingBufferInfo->range, ")");
@@ -46,9 +47,10 @@ void CopyAndReleaseBuffer::copy(ref_ptr<Data> data, ref_ptr<BufferInfo> dest)
     if (!stagingMemory) return;
 
     // copy data to staging memory
-    stagingMemory->copy(imageStagingBuffer->getMemoryOffset(deviceID) + stagingBufferInfo->offset, dataSize, data->dataPointer());
+    stagingMemory->copy(imageStagingBuffer->getMemoryOffset(deviceID) + stagingBufferInfo->offset, dataSize, data->constDataPointer());
 
-    add(stagingBufferInfo, dest);
+    std::scoped_lock lock(_mutex);
+    _pending.push_back(CopyData{stagingBufferInfo, dest, true});
 }
 
 void CopyAndReleaseBuffer::add(ref_ptr<BufferInfo> src, ref_ptr<BufferInfo> dest)
@@ -57,27 +59,69 @@ void CopyAndReleaseBuffer::add(ref_ptr<BufferInfo> src, ref_ptr<BufferInfo> dest
     _pending.push_back(CopyData{src, dest});
 }
 
-void CopyAndReleaseBuffer::CopyData::record(CommandBuffer& commandBuffer) const
+ref_ptr<BufferInfo> CopyAndReleaseBuffer::_recycleStagingBuffer(VkDeviceSize size, VkDeviceSize alignment) const
+{
+    std::scoped_lock lock(_mutex);
+    for (auto itr = _recycledStagingBufferInfos.lower_bound(size); itr != _recycledStagingBufferInfos.end(); ++itr)
+    {
+        // avoid tying up a much larger allocation than the request needs
+        if (itr->first > size * 2) break;
+
+        if ((itr->second->offset % alignment) == 0)
+        {
+            ref_ptr<BufferInfo> bufferInfo = itr->second;
+            _recycledStagingBytes -= itr->first;
+            _recycledStagingBufferInfos.erase(itr);
+            bufferInfo->range = size;
+            return bufferInfo;
+        }
+    }
+    return {};
+}
+
+void CopyAndReleaseBuffer::_addToRecycledStagingBuffers(ref_ptr<BufferInfo> source) const
 {
-    //debug("CopyAndReleaseBuffer::CopyData::record(CommandBuffer& commandBuffer) source.offset = ", source->offset, ", ", destination->offset);
-    VkBufferCopy copyRegion = {};
-    copyRegion.srcOffset = source->offset;
-    copyRegion.dstOffset = destination->offset;
-    copyRegion.size = source->range;
-    vkCmdCopyBuffer(commandBuffer, source->buffer->vk(commandBuffer.deviceID), destination->buffer->vk(commandBuffer.deviceID), 1, &copyRegion);
+    // only staging buffers created by copy() that no one else still references can be safely reused
+    if (maximumRecycledStagingBytes == 0 || !source || !source->buffer || source->referenceCount() != 1) return;
+
+    source->data = {};
+    _recycledStagingBytes += source->range;
+    _recycledStagingBufferInfos.emplace(source->range, source);
+
+    while (_recycledStagingBytes > maximumRecycledStagingBytes && !_recycledStagingBufferInfos.empty())
+    {
+        auto itr = _recycledStagingBufferInfos.begin();
+        _recycledStagingBytes -= itr->first;
+        _recycledStagingBufferInfos.erase(itr);
+    }
 }
 
 void CopyAndReleaseBuffer::record(CommandBuffer& commandBuffer) const
 {
     std::scoped_lock lock(_mutex);
 
+    // the copies recorded two frames ago have completed, so their staging BufferInfos can be
+    // retained for reuse by subsequent copy() calls instead of released back to the memory pools.
+    for (auto& copyData : _readyToClear)
+    {
+        if (copyData.recyclableSource) _addToRecycledStagingBuffers(copyData.source);
+    }
     _readyToClear.clear();
 
     _readyToClear.swap(_completed);
 
+    // batch the pending copies by source/destination buffer pair so that a single vkCmdCopyBuffer
+    // call transfers all the regions between each pair.
+    std::map<std::pair<VkBuffer, VkBuffer>, std::vector<VkBufferCopy>> batchedCopies;
     for (auto& copyData : _pending)
     {
-        copyData.record(commandBuffer);
+        auto& regions = batchedCopies[{copyData.source->buffer->vk(commandBuffer.deviceID), copyData.destination->buffer->vk(commandBuffer.deviceID)}];
+        regions.push_back(VkBufferCopy{copyData.source->offset, copyData.destination->offset, copyData.source->range});
+    }
+
+    for (auto& [buffers, regions] : batchedCopies)
+    {
+        vkCmdCopyBuffer(commandBuffer, buffers.first, buffers.second, static_cast<uint32_t>(regions.size()), regions.data());
     }
 
     _pending.swap(_completed);
@@ -93,7 +93,8 @@ void CopyAndReleaseImage::copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest, uint
         VkDeviceSize imageTotalSize = targetTraits.size * data->valueCount();
         VkDeviceSize alignment = std::max(VkDeviceSize(4), VkDeviceSize(targetTraits.size));
 
-        auto stagingBufferInfo = stagingMemoryBufferPools->reserveBuffer(imageTotalSize, alignment, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, memoryPropertyFlags);
+        auto stagingBufferInfo = _recycleStagingBuffer(imageTotalSize, alignment);
+        if (!stagingBufferInfo) stagingBufferInfo = stagingMemoryBufferPools->reserveBuffer(imageTotalSize, alignment, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, memoryPropertyFlags);
 
         auto deviceID = stagingMemoryBufferPools->device->deviceID;
         ref_ptr<Buffer> imageStagingBuffer(stagingBufferInfo->buffer);
@@ -102,6 +103,7 @@ void CopyAndReleaseImage::copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest, uint
         if (!imageStagingMemory) return;
 
         vsg::CopyAndReleaseImage::CopyData cd(stagingBufferInfo, dest, numMipMapLevels);
+        cd.recyclableSource = true;
         cd.width = data->width();
         cd.height = data->height();
         cd.depth = data->depth();
@@ -115,7 +117,7 @@ void CopyAndReleaseImage::copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest, uint
 
         // copy data
         using value_type = uint8_t;
-        const value_type* src_ptr = reinterpret_cast<const value_type*>(data->dataPointer());
+        const value_type* src_ptr = reinterpret_cast<const value_type*>(data->constDataPointer());
 
         void* buffer_data;
         imageStagingMemory->map(imageStagingBuffer->getMemoryOffset(deviceID) + stagingBufferInfo->offset, imageTotalSize, 0, &buffer_data);
@@ -149,7 +151,8 @@ void CopyAndReleaseImage::_copyDirectly(ref_ptr<Data> data, ref_ptr<ImageInfo> d
     VkDeviceSize alignment = std::max(VkDeviceSize(4), VkDeviceSize(data->valueSize()));
 
     VkMemoryPropertyFlags memoryPropertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    auto stagingBufferInfo = stagingMemoryBufferPools->reserveBuffer(imageTotalSize, alignment, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, memoryPropertyFlags);
+    auto stagingBufferInfo = _recycleStagingBuffer(imageTotalSize, alignment);
+    if (!stagingBufferInfo) stagingBufferInfo = stagingMemoryBufferPools->reserveBuffer(imageTotalSize, alignment, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, memoryPropertyFlags);
     stagingBufferInfo->data = data;
 
     auto deviceID = stagingMemoryBufferPools->device->deviceID;
@@ -159,9 +162,11 @@ void CopyAndReleaseImage::_copyDirectly(ref_ptr<Data> data, ref_ptr<ImageInfo> d
     if (!imageStagingMemory) return;
 
     // copy data to staging memory
-    imageStagingMemory->copy(imageStagingBuffer->getMemoryOffset(deviceID) + stagingBufferInfo->offset, imageTotalSize, data->dataPointer());
+    imageStagingMemory->copy(imageStagingBuffer->getMemoryOffset(deviceID) + stagingBufferInfo->offset, imageTotalSize, data->constDataPointer());
 
-    add(stagingBufferInfo, dest, numMipMapLevels);
+    CopyData cd(stagingBufferInfo, dest, numMipMapLevels);
+    cd.recyclableSource = true;
+    add(cd);
 }
 
 void CopyAndReleaseImage::CopyData::record(CommandBuffer& commandBuffer) const
@@ -169,14 +174,59 @@ void CopyAndReleaseImage::CopyData::record(CommandBuffer& commandBuffer) const
     transferImageData(destination->imageView, destination->imageLayout, layout, width, height, depth, mipLevels, mipmapOffsets, source->buffer, source->offset, commandBuffer.vk(), commandBuffer.getDevice());
 }
 
+ref_ptr<BufferInfo> CopyAndReleaseImage::_recycleStagingBuffer(VkDeviceSize size, VkDeviceSize alignment) const
+{
+    std::scoped_lock lock(_mutex);
+    for (auto itr = _recycledStagingBufferInfos.lower_bound(size); itr != _recycledStagingBufferInfos.end(); ++itr)
+    {
+        // avoid tying up a much larger allocation than the request needs
+        if (itr->first > size * 2) break;
+
+        if ((itr->second->offset % alignment) == 0)
+        {
+            ref_ptr<BufferInfo> bufferInfo = itr->second;
+            _recycledStagingBytes -= itr->first;
+            _recycledStagingBufferInfos.erase(itr);
+            bufferInfo->range = size;
+            return bufferInfo;
+        }
+    }
+    return {};
+}
+
+void CopyAndReleaseImage::_addToRecycledStagingBuffers(ref_ptr<BufferInfo> source) const
+{
+    // only staging buffers created by copy() that no one else still references can be safely reused
+    if (maximumRecycledStagingBytes == 0 || !source || !source->buffer || source->referenceCount() != 1) return;
+
+    source->data = {};
+    _recycledStagingBytes += source->range;
+    _recycledStagingBufferInfos.emplace(source->range, source);
+
+    while (_recycledStagingBytes > maximumRecycledStagingBytes && !_recycledStagingBufferInfos.empty())
+    {
+        auto itr = _recycledStagingBufferInfos.begin();
+        _recycledStagingBytes -= itr->first;
+        _recycledStagingBufferInfos.erase(itr);
+    }
+}
+
 void CopyAndReleaseImage::record(CommandBuffer& commandBuffer) const
 {
     std::scoped_lock lock(_mutex);
 
+    // the copies recorded two frames ago have completed, so their staging BufferInfos can be
+    // retained for reuse by subsequent copy() calls instead of released back to the memory pools.
+    for (auto& copyData : _readyToClear)
+    {
+        if (copyData.recyclableSource) _addToRecycledStagingBuffers(copyData.source);
+    }
     _readyToClear.clear();
 
     _readyToClear.swap(_completed);
 
+    // each image copy requires its own layout transitions and mipmap generation so, unlike buffer
+    // copies, the regions cannot be merged into a single transfer command.
     for (auto& copyData : _pending)
     {
         copyData.record(commandBuffer);
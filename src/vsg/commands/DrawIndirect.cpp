@@ -97,5 +97,5 @@ void DrawIndirect::compile(Context& context)
 
 void DrawIndirect::record(CommandBuffer& commandBuffer) const
 {
-    vkCmdDrawIndirect(commandBuffer, bufferInfo->buffer->vk(commandBuffer.deviceID), bufferInfo->offset, drawCount, stride);
+    commandBuffer.dispatch->vkCmdDrawIndirect(commandBuffer, bufferInfo->buffer->vk(commandBuffer.deviceID), bufferInfo->offset, drawCount, stride);
 }
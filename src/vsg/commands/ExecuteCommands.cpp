@@ -80,5 +80,8 @@ void ExecuteCommands::record(CommandBuffer& commandBuffer) const
     if (!vk_commandBuffers.empty())
     {
         vkCmdExecuteCommands(commandBuffer, static_cast<uint32_t>(vk_commandBuffers.size()), vk_commandBuffers.data());
+
+        // vkCmdExecuteCommands leaves the primary command buffer's bound state undefined
+        commandBuffer.invalidateBufferBindings();
     }
 }
@@ -16,10 +16,65 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#elif defined(_WIN32)
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#endif
+
 using namespace vsg;
 
+namespace
+{
+    // size classes and capacities for the per thread magazines used by ALLOCATOR_TYPE_THREAD_LOCAL
+    constexpr std::size_t MAGAZINE_STRIDE = 16;
+    constexpr std::size_t MAGAZINE_MAX_SIZE = 256;
+    constexpr std::size_t MAGAZINE_NUM_CLASSES = MAGAZINE_MAX_SIZE / MAGAZINE_STRIDE;
+    constexpr std::size_t MAGAZINE_CAPACITY = 64;
+    constexpr std::size_t MAGAZINE_REFILL = MAGAZINE_CAPACITY / 2;
+
+    inline std::size_t magazineClass(std::size_t size) { return (size + MAGAZINE_STRIDE - 1) / MAGAZINE_STRIDE - 1; }
+    inline std::size_t magazineClassSize(std::size_t sizeClass) { return (sizeClass + 1) * MAGAZINE_STRIDE; }
+
+    struct Magazine
+    {
+        Allocator* owner = nullptr;
+
+        struct SizeClass
+        {
+            void* chunks[MAGAZINE_CAPACITY];
+            std::size_t count = 0;
+        };
+        SizeClass sizeClasses[MAGAZINE_NUM_CLASSES];
+
+        ~Magazine()
+        {
+            // return everything still cached to the shared pool when the thread exits
+            if (!owner) return;
+
+            std::vector<std::pair<void*, std::size_t>> allocations;
+            for (std::size_t sc = 0; sc < MAGAZINE_NUM_CLASSES; ++sc)
+            {
+                for (std::size_t i = 0; i < sizeClasses[sc].count; ++i)
+                {
+                    allocations.emplace_back(sizeClasses[sc].chunks[i], magazineClassSize(sc));
+                }
+            }
+            owner->deallocateBatch(allocations);
+        }
+    };
+
+    thread_local Magazine t_magazine;
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // vsg::Allocator
@@ -44,6 +99,8 @@ Allocator::Allocator(std::unique_ptr<Allocator> in_nestedAllocator, size_t in_de
 
 Allocator::~Allocator()
 {
+    stopDeferredDeallocationThread();
+    drainDeferredDeallocations();
 }
 
 std::unique_ptr<Allocator>& Allocator::instance()
@@ -90,6 +147,11 @@ void Allocator::report(std::ostream& out) const
 
 void* Allocator::allocate(std::size_t size, AllocatorAffinity allocatorAffinity)
 {
+    if (allocatorType == ALLOCATOR_TYPE_THREAD_LOCAL)
+    {
+        if (auto ptr = _threadLocalAllocate(size, allocatorAffinity)) return ptr;
+    }
+
     std::scoped_lock<std::mutex> lock(mutex);
 
     // create a MemoryBlocks entry if one doesn't already exist
@@ -131,8 +193,24 @@ void* Allocator::allocate(std::size_t size, AllocatorAffinity allocatorAffinity)
 
 bool Allocator::deallocate(void* ptr, std::size_t size)
 {
+    if (deferDeallocations)
+    {
+        std::scoped_lock<std::mutex> lock(_deferredMutex);
+        _deferredDeallocations.emplace_back(ptr, size);
+        return true;
+    }
+
+    if (allocatorType == ALLOCATOR_TYPE_THREAD_LOCAL)
+    {
+        if (_threadLocalDeallocate(ptr, size)) return true;
+    }
+
     std::scoped_lock<std::mutex> lock(mutex);
+    return _deallocate(ptr, size);
+}
 
+bool Allocator::_deallocate(void* ptr, std::size_t size)
+{
     for (auto& memoryBlocks : allocatorMemoryBlocks)
     {
         if (memoryBlocks)
@@ -164,6 +242,121 @@ bool Allocator::deallocate(void* ptr, std::size_t size)
     return false;
 }
 
+void* Allocator::_threadLocalAllocate(std::size_t size, AllocatorAffinity allocatorAffinity)
+{
+    if (size == 0 || size > MAGAZINE_MAX_SIZE) return nullptr;
+
+    auto& magazine = t_magazine;
+    if (!magazine.owner)
+        magazine.owner = this;
+    else if (magazine.owner != this)
+        return nullptr;
+
+    auto& sizeClass = magazine.sizeClasses[magazineClass(size)];
+    if (sizeClass.count > 0) return sizeClass.chunks[--sizeClass.count];
+
+    // magazine empty, refill from the shared pool in a single lock acquisition
+    auto chunkSize = magazineClassSize(magazineClass(size));
+
+    std::scoped_lock<std::mutex> lock(mutex);
+
+    if (size_t(allocatorAffinity) >= allocatorMemoryBlocks.size()) return nullptr;
+
+    auto& memoryBlocks = allocatorMemoryBlocks[allocatorAffinity];
+    if (!memoryBlocks) return nullptr;
+
+    for (std::size_t i = 0; i < MAGAZINE_REFILL; ++i)
+    {
+        auto ptr = memoryBlocks->allocate(chunkSize);
+        if (!ptr) break;
+        sizeClass.chunks[sizeClass.count++] = ptr;
+    }
+
+    if (sizeClass.count == 0) return nullptr;
+    return sizeClass.chunks[--sizeClass.count];
+}
+
+bool Allocator::_threadLocalDeallocate(void* ptr, std::size_t size)
+{
+    if (size == 0 || size > MAGAZINE_MAX_SIZE) return false;
+
+    auto& magazine = t_magazine;
+    if (!magazine.owner)
+        magazine.owner = this;
+    else if (magazine.owner != this)
+        return false;
+
+    auto sc = magazineClass(size);
+    auto& sizeClass = magazine.sizeClasses[sc];
+
+    // magazine full, flush a batch back to the shared pool in a single lock acquisition
+    if (sizeClass.count == MAGAZINE_CAPACITY)
+    {
+        std::vector<std::pair<void*, std::size_t>> allocations;
+        allocations.reserve(MAGAZINE_REFILL);
+
+        auto chunkSize = magazineClassSize(sc);
+        for (std::size_t i = 0; i < MAGAZINE_REFILL; ++i)
+        {
+            allocations.emplace_back(sizeClass.chunks[--sizeClass.count], chunkSize);
+        }
+        deallocateBatch(allocations);
+    }
+
+    sizeClass.chunks[sizeClass.count++] = ptr;
+    return true;
+}
+
+size_t Allocator::deallocateBatch(const std::vector<std::pair<void*, std::size_t>>& allocations)
+{
+    if (allocations.empty()) return 0;
+
+    std::scoped_lock<std::mutex> lock(mutex);
+
+    size_t count = 0;
+    for (const auto& [ptr, size] : allocations)
+    {
+        if (_deallocate(ptr, size)) ++count;
+    }
+    return count;
+}
+
+size_t Allocator::drainDeferredDeallocations()
+{
+    std::vector<std::pair<void*, std::size_t>> allocations;
+    {
+        std::scoped_lock<std::mutex> lock(_deferredMutex);
+        allocations.swap(_deferredDeallocations);
+    }
+
+    return deallocateBatch(allocations);
+}
+
+void Allocator::startDeferredDeallocationThread(uint32_t interval_milliseconds)
+{
+    if (_drainThreadActive) return;
+
+    _drainThreadActive = true;
+    _drainThread = std::thread([this, interval_milliseconds]() {
+        std::mutex sleepMutex;
+        std::unique_lock<std::mutex> sleepLock(sleepMutex);
+        while (_drainThreadActive)
+        {
+            drainDeferredDeallocations();
+            _drainCV.wait_for(sleepLock, std::chrono::milliseconds(interval_milliseconds));
+        }
+    });
+}
+
+void Allocator::stopDeferredDeallocationThread()
+{
+    if (!_drainThreadActive) return;
+
+    _drainThreadActive = false;
+    _drainCV.notify_all();
+    _drainThread.join();
+}
+
 size_t Allocator::deleteEmptyMemoryBlocks()
 {
     std::scoped_lock<std::mutex> lock(mutex);
@@ -255,6 +448,27 @@ void Allocator::setBlockSize(AllocatorAffinity allocatorAffinity, size_t blockSi
     }
 }
 
+void Allocator::setBlockPlacement(AllocatorAffinity allocatorAffinity, int numaNode, bool useHugePages)
+{
+    std::scoped_lock<std::mutex> lock(mutex);
+
+    if (size_t(allocatorAffinity) < allocatorMemoryBlocks.size())
+    {
+        allocatorMemoryBlocks[allocatorAffinity]->numaNode = numaNode;
+        allocatorMemoryBlocks[allocatorAffinity]->useHugePages = useHugePages;
+    }
+    else
+    {
+        auto name = make_string("MemoryBlocks_", allocatorAffinity);
+        size_t blockSize = 1024 * 1024; // Megabyte
+
+        allocatorMemoryBlocks.resize(allocatorAffinity + 1);
+        allocatorMemoryBlocks[allocatorAffinity].reset(new MemoryBlocks(this, name, blockSize, default_alignment));
+        allocatorMemoryBlocks[allocatorAffinity]->numaNode = numaNode;
+        allocatorMemoryBlocks[allocatorAffinity]->useHugePages = useHugePages;
+    }
+}
+
 void Allocator::setMemoryTracking(int mt)
 {
     memoryTracking = mt;
@@ -274,18 +488,74 @@ void Allocator::setMemoryTracking(int mt)
 //
 // vsg::Allocator::MemoryBlock
 //
-Allocator::MemoryBlock::MemoryBlock(size_t blockSize, int memoryTracking, size_t in_alignment) :
+Allocator::MemoryBlock::MemoryBlock(size_t blockSize, int memoryTracking, size_t in_alignment, int in_numaNode, bool in_useHugePages) :
     memorySlots(blockSize, memoryTracking),
-    alignment(in_alignment)
+    alignment(in_alignment),
+    numaNode(in_numaNode),
+    useHugePages(in_useHugePages)
 {
     block_alignment = std::max(alignment, alignof(std::max_align_t));
     block_alignment = std::max(block_alignment, size_t{16});
 
-    memory = static_cast<uint8_t*>(operator new (blockSize, std::align_val_t{block_alignment}));
+    // when a placement policy is requested back the block with a platform memory mapping so it can be
+    // NUMA bound and/or huge page backed, falling back to operator new when the platform can't oblige.
+    if (numaNode >= 0 || useHugePages)
+    {
+#if defined(__linux__)
+        void* addr = mmap(nullptr, blockSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr != MAP_FAILED)
+        {
+#    if defined(MADV_HUGEPAGE)
+            if (useHugePages) madvise(addr, blockSize, MADV_HUGEPAGE);
+#    endif
+#    if defined(SYS_mbind)
+            if (numaNode >= 0)
+            {
+                unsigned long nodemask = 1ul << numaNode;
+                const int MPOL_BIND_policy = 2;
+                syscall(SYS_mbind, addr, blockSize, MPOL_BIND_policy, &nodemask, sizeof(nodemask) * 8, 0);
+            }
+#    endif
+            memory = static_cast<uint8_t*>(addr);
+            mappedSize = blockSize;
+        }
+#elif defined(_WIN32)
+        DWORD allocationType = MEM_RESERVE | MEM_COMMIT;
+        size_t mappingSize = blockSize;
+        if (useHugePages)
+        {
+            if (size_t largePageSize = GetLargePageMinimum(); largePageSize > 0)
+            {
+                allocationType |= MEM_LARGE_PAGES;
+                mappingSize = ((blockSize + largePageSize - 1) / largePageSize) * largePageSize;
+            }
+        }
+
+        void* addr = (numaNode >= 0) ? VirtualAllocExNuma(GetCurrentProcess(), nullptr, mappingSize, allocationType, PAGE_READWRITE, static_cast<DWORD>(numaNode))
+                                     : VirtualAlloc(nullptr, mappingSize, allocationType, PAGE_READWRITE);
+
+        // large page allocation requires SeLockMemoryPrivilege, retry with regular pages when it fails
+        if (!addr && (allocationType & MEM_LARGE_PAGES) != 0)
+        {
+            allocationType &= ~MEM_LARGE_PAGES;
+            addr = (numaNode >= 0) ? VirtualAllocExNuma(GetCurrentProcess(), nullptr, blockSize, allocationType, PAGE_READWRITE, static_cast<DWORD>(numaNode))
+                                   : VirtualAlloc(nullptr, blockSize, allocationType, PAGE_READWRITE);
+            mappingSize = blockSize;
+        }
+
+        if (addr)
+        {
+            memory = static_cast<uint8_t*>(addr);
+            mappedSize = mappingSize;
+        }
+#endif
+    }
+
+    if (!memory) memory = static_cast<uint8_t*>(operator new (blockSize, std::align_val_t{block_alignment}));
 
     if (memorySlots.memoryTracking & MEMORY_TRACKING_REPORT_ACTIONS)
     {
-        info("MemoryBlock(", blockSize, ") allocated memory");
+        info("MemoryBlock(", blockSize, ") allocated memory, numaNode = ", numaNode, ", useHugePages = ", useHugePages, ", mapped = ", (mappedSize != 0));
     }
 }
 
@@ -296,7 +566,18 @@ Allocator::MemoryBlock::~MemoryBlock()
         info("MemoryBlock::~MemoryBlock(", memorySlots.totalMemorySize(), ") freed memory");
     }
 
-    operator delete (memory, std::align_val_t{block_alignment});
+    if (mappedSize != 0)
+    {
+#if defined(__linux__)
+        munmap(memory, mappedSize);
+#elif defined(_WIN32)
+        VirtualFree(memory, 0, MEM_RELEASE);
+#endif
+    }
+    else
+    {
+        operator delete (memory, std::align_val_t{block_alignment});
+    }
 }
 
 void* Allocator::MemoryBlock::allocate(std::size_t size)
@@ -370,7 +651,7 @@ void* Allocator::MemoryBlocks::allocate(std::size_t size)
 
     size_t new_blockSize = std::max(size, blockSize);
 
-    auto block = std::make_shared<MemoryBlock>(new_blockSize, parent->memoryTracking, alignment);
+    auto block = std::make_shared<MemoryBlock>(new_blockSize, parent->memoryTracking, alignment, numaNode, useHugePages);
     latestMemoryBlock = block;
 
     auto ptr = block->allocate(size);
@@ -0,0 +1,175 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/core/ArraySoA.h>
+#include <vsg/io/Input.h>
+#include <vsg/io/Options.h>
+#include <vsg/io/Output.h>
+
+#include <cstring>
+
+using namespace vsg;
+
+ArraySoA::ArraySoA()
+{
+}
+
+ArraySoA::ArraySoA(const ArraySoA& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    channels(rhs.channels),
+    _numValues(rhs._numValues)
+{
+    _totalSize = _computeLayout();
+    if (_totalSize != 0 && rhs._data)
+    {
+        _data = _allocate(_totalSize);
+        std::memcpy(_data, rhs._data, _totalSize);
+    }
+    dirty();
+}
+
+ArraySoA::ArraySoA(uint32_t numValues, const Channels& in_channels, Properties in_properties) :
+    channels(in_channels),
+    _numValues(numValues)
+{
+    properties = in_properties;
+
+    _totalSize = _computeLayout();
+    if (_totalSize != 0) _data = _allocate(_totalSize);
+    dirty();
+}
+
+ArraySoA::~ArraySoA()
+{
+    _delete();
+}
+
+size_t ArraySoA::_computeLayout()
+{
+    size_t offset = 0;
+    for (auto& channel : channels)
+    {
+        // 16 byte align each channel so SIMD loads over the packed values are aligned
+        offset = (offset + 15) & ~size_t(15);
+        channel.offset = offset;
+        offset += size_t(channel.valueSize) * _numValues;
+    }
+    return offset;
+}
+
+uint8_t* ArraySoA::_allocate(size_t size) const
+{
+    if (size == 0)
+        return nullptr;
+    else if (properties.allocatorType == ALLOCATOR_TYPE_NEW_DELETE)
+        return new uint8_t[size];
+    else if (properties.allocatorType == ALLOCATOR_TYPE_MALLOC_FREE)
+        return static_cast<uint8_t*>(std::malloc(size));
+    else
+        return static_cast<uint8_t*>(vsg::allocate(size, ALLOCATOR_AFFINITY_DATA));
+}
+
+void ArraySoA::_delete()
+{
+    if (_data)
+    {
+        if (properties.allocatorType == ALLOCATOR_TYPE_NEW_DELETE)
+            delete[] _data;
+        else if (properties.allocatorType == ALLOCATOR_TYPE_MALLOC_FREE)
+            std::free(_data);
+        else if (properties.allocatorType != 0)
+            vsg::deallocate(_data);
+    }
+}
+
+size_t ArraySoA::valueSize() const
+{
+    size_t size = 0;
+    for (const auto& channel : channels) size += channel.valueSize;
+    return size;
+}
+
+void* ArraySoA::dataRelease()
+{
+    void* ptr = _data;
+    _data = nullptr;
+    _numValues = 0;
+    _totalSize = 0;
+    return ptr;
+}
+
+int ArraySoA::compare(const Object& rhs_object) const
+{
+    int result = Data::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    if ((result = compare_value(_numValues, rhs._numValues)) != 0) return result;
+    if ((result = compare_value_container(channels, rhs.channels)) != 0) return result;
+
+    if (_data == rhs._data) return 0;
+    if (!_data) return -1;
+    if (!rhs._data) return 1;
+    return std::memcmp(_data, rhs._data, _totalSize);
+}
+
+void ArraySoA::read(Input& input)
+{
+    Data::read(input);
+
+    _delete();
+    _data = nullptr;
+
+    input.read("numValues", _numValues);
+
+    channels.resize(input.readValue<uint32_t>("channels"));
+    for (auto& channel : channels)
+    {
+        input.readValue<uint32_t>("format", channel.format);
+        input.read("valueSize", channel.valueSize);
+    }
+
+    _totalSize = _computeLayout();
+    if (_totalSize != 0)
+    {
+        _data = _allocate(_totalSize);
+        input.read(_totalSize, _data);
+    }
+    dirty();
+}
+
+void ArraySoA::write(Output& output) const
+{
+    Data::write(output);
+
+    output.write("numValues", _numValues);
+
+    output.writeValue<uint32_t>("channels", channels.size());
+    for (const auto& channel : channels)
+    {
+        output.writeValue<uint32_t>("format", channel.format);
+        output.write("valueSize", channel.valueSize);
+    }
+
+    if (_totalSize != 0) output.write(_totalSize, _data);
+}
+
+ref_ptr<Data> ArraySoA::channelView(size_t channelIndex)
+{
+    auto& channel = channels[channelIndex];
+
+    auto view = ubyteArray::create(ref_ptr<Data>(this), static_cast<uint32_t>(channel.offset), 1, channel.valueSize * _numValues);
+    view->properties.format = channel.format;
+    view->properties.dataVariance = properties.dataVariance;
+    return view;
+}
@@ -21,6 +21,7 @@ using namespace vsg;
 
 Auxiliary::Auxiliary(Object* object) :
     _referenceCount(0),
+    _connection(CONNECTED),
     _connectedObject(object)
 {
     //vsg::debug("Auxiliary::Auxiliary(Object = ", object, ") ", this);
@@ -54,26 +55,44 @@ void Auxiliary::unref_nodelete() const
 
 bool Auxiliary::signalConnectedObjectToBeDeleted()
 {
-    std::scoped_lock<std::mutex> guard(_mutex);
+    // claim the connection - clear the CONNECTED flag once no resolves are in flight, any resolve
+    // announced after the flag is cleared fails without touching the object. Resolves use
+    // Object::try_ref() which never increments a zero reference count, so once the count has
+    // reached zero observers cannot resurrect the object and deletion is safe.
+    unsigned int expected = CONNECTED;
+    while (!_connection.compare_exchange_weak(expected, 0u, std::memory_order_acq_rel))
+    {
+        if ((expected & CONNECTED) == 0) break; // already disconnected
+        expected = CONNECTED;                   // resolves in flight, wait for them to complete
+    }
 
-    if (_connectedObject && _connectedObject->referenceCount() > 0)
+    auto object = _connectedObject.exchange(nullptr, std::memory_order_acq_rel);
+    if (object && object->referenceCount() > 0)
     {
+        // the object regained a reference through a raw pointer between the count reaching zero
+        // and the connection being claimed, so reconnect and keep it alive.
+        _connectedObject.store(object, std::memory_order_release);
+        _connection.store(CONNECTED, std::memory_order_release);
+
         // return false, the object should not be deleted
         return false;
     }
 
-    // disconnect this Auxiliary object from the ConnectedObject
-    _connectedObject = nullptr;
-
     // return true, the object should be deleted
     return true;
 }
 
 void Auxiliary::resetConnectedObject()
 {
-    std::scoped_lock<std::mutex> guard(_mutex);
+    // claim the connection so any in flight resolves complete before the object is disconnected
+    unsigned int expected = CONNECTED;
+    while (!_connection.compare_exchange_weak(expected, 0u, std::memory_order_acq_rel))
+    {
+        if ((expected & CONNECTED) == 0) break; // already disconnected
+        expected = CONNECTED;                   // resolves in flight, wait for them to complete
+    }
 
-    _connectedObject = nullptr;
+    _connectedObject.store(nullptr, std::memory_order_release);
 }
 
 int Auxiliary::compare(const Auxiliary& rhs) const
@@ -553,6 +553,10 @@ void ConstVisitor::apply(const PagedLOD& value)
 {
     apply(static_cast<const Node&>(value));
 }
+void ConstVisitor::apply(const ImpostorLOD& value)
+{
+    apply(static_cast<const Node&>(value));
+}
 void ConstVisitor::apply(const StateGroup& value)
 {
     apply(static_cast<const Group&>(value));
@@ -561,10 +565,22 @@ void ConstVisitor::apply(const CullGroup& value)
 {
     apply(static_cast<const Group&>(value));
 }
+void ConstVisitor::apply(const MaskGroup& value)
+{
+    apply(static_cast<const Group&>(value));
+}
+void ConstVisitor::apply(const SpatialIndexGroup& value)
+{
+    apply(static_cast<const Group&>(value));
+}
 void ConstVisitor::apply(const CullNode& value)
 {
     apply(static_cast<const Node&>(value));
 }
+void ConstVisitor::apply(const OcclusionQueryNode& value)
+{
+    apply(static_cast<const CullNode&>(value));
+}
 void ConstVisitor::apply(const Transform& value)
 {
     apply(static_cast<const Group&>(value));
@@ -629,6 +645,10 @@ void ConstVisitor::apply(const RegionOfInterest& value)
 {
     apply(static_cast<const Node&>(value));
 }
+void ConstVisitor::apply(const CompiledDrawList& value)
+{
+    apply(static_cast<const Node&>(value));
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 //
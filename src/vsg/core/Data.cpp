@@ -67,10 +67,47 @@ int Data::compare(const Object& rhs_object) const
     // if both empty then they must be equal
     if (dataSize() == 0) return 0;
 
-    // use memcpy to compare the contents of the data
+    // compare cached content hashes so repeated comparisons against unequal data short-circuit
+    // without rereading whole buffers
+    uint64_t lhs_hash = contentHash();
+    uint64_t rhs_hash = rhs.contentHash();
+    if (lhs_hash < rhs_hash) return -1;
+    if (lhs_hash > rhs_hash) return 1;
+
+    // matching hashes, confirm with a full comparison of the contents of the data
     return std::memcmp(dataPointer(), rhs.dataPointer(), dataSize());
 }
 
+uint64_t Data::contentHash() const
+{
+    uint64_t hash = _contentHash.load(std::memory_order_acquire);
+    if (hash != 0 && _contentHashCount.load(std::memory_order_acquire) == _modifiedCount.count) return hash;
+
+    hash = 0xcbf29ce484222325ULL;
+    auto hashBytes = [&hash](const void* ptr, std::size_t size) {
+        auto bytes = static_cast<const uint8_t*>(ptr);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ULL;
+        }
+    };
+
+    hashBytes(&properties.format, sizeof(properties.format));
+    hashBytes(&properties.stride, sizeof(properties.stride));
+
+    auto size = dataSize();
+    hashBytes(&size, sizeof(size));
+    if (size > 0) hashBytes(dataPointer(), size);
+
+    if (hash == 0) hash = 1; // reserve 0 as the not yet computed sentinel
+
+    _contentHashCount.store(_modifiedCount.count, std::memory_order_release);
+    _contentHash.store(hash, std::memory_order_release);
+
+    return hash;
+}
+
 void Data::read(Input& input)
 {
     Object::read(input);
@@ -19,6 +19,27 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 using namespace vsg;
 
+namespace
+{
+    inline uint32_t highestBitSet(uint64_t bits)
+    {
+        uint32_t result = 0;
+        while (bits >>= 1) ++result;
+        return result;
+    }
+
+    inline uint32_t lowestBitSet(uint64_t bits)
+    {
+        uint32_t result = 0;
+        while ((bits & 1) == 0)
+        {
+            bits >>= 1;
+            ++result;
+        }
+        return result;
+    }
+} // namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // MemorySlots
@@ -31,16 +52,25 @@ MemorySlots::MemorySlots(size_t availableMemorySize, int in_memoryTracking) :
         info("MemorySlots::MemorySlots(", availableMemorySize, ") ", this);
     }
 
-    insertAvailableSlot(0, availableMemorySize);
+    _freeLists.assign(NUM_BINS, INVALID_SLOT);
 
     _totalMemorySize = availableMemorySize;
+
+    if (availableMemorySize > 0)
+    {
+        uint32_t slotIndex = _acquireSlot();
+        _slots[slotIndex].offset = 0;
+        _slots[slotIndex].size = availableMemorySize;
+        _firstPhysical = slotIndex;
+        _pushFree(slotIndex);
+    }
 }
 
 MemorySlots::~MemorySlots()
 {
     if (memoryTracking & MEMORY_TRACKING_REPORT_ACTIONS)
     {
-        if (_availableMemory.size() == 1)
+        if (_numReservedSlots == 0)
         {
             info("MemorySlots::~MemorySlots() ", this, ", all slots restored correctly.");
         }
@@ -56,88 +86,184 @@ MemorySlots::~MemorySlots()
     }
 }
 
-size_t MemorySlots::totalAvailableSize() const
+uint32_t MemorySlots::_binIndex(size_t size) const
 {
-    size_t totalSize = 0;
-    for (const auto& sizeOffset : _availableMemory)
-    {
-        totalSize += sizeOffset.first;
-    }
-    return totalSize;
+    if (size < SECOND_LEVEL_COUNT) return static_cast<uint32_t>(size);
+
+    uint32_t fl = highestBitSet(size);
+    uint32_t group = fl - SECOND_LEVEL_BITS + 1;
+    uint32_t sl = static_cast<uint32_t>(size >> (fl - SECOND_LEVEL_BITS)) & (SECOND_LEVEL_COUNT - 1);
+    return group * SECOND_LEVEL_COUNT + sl;
 }
 
-size_t MemorySlots::totalReservedSize() const
+uint32_t MemorySlots::_binIndexCeil(size_t size) const
 {
-    size_t totalSize = 0;
-    for (const auto& sizeOffset : _reservedMemory)
+    // small sizes map one to one so every slot in the bin is exactly the requested size
+    if (size < SECOND_LEVEL_COUNT) return static_cast<uint32_t>(size);
+
+    // round up to the next bin boundary so that every slot in the returned bin is big enough
+    uint32_t fl = highestBitSet(size);
+    size_t rounded = size + ((size_t(1) << (fl - SECOND_LEVEL_BITS)) - 1);
+    return _binIndex(rounded);
+}
+
+uint32_t MemorySlots::_findFreeBin(uint32_t fromBin) const
+{
+    if (fromBin >= NUM_BINS) return INVALID_BIN;
+
+    uint32_t group = fromBin / SECOND_LEVEL_COUNT;
+    uint32_t sl = fromBin % SECOND_LEVEL_COUNT;
+
+    uint32_t slBits = _secondLevelBitmaps[group] & (~0u << sl);
+    if (slBits) return group * SECOND_LEVEL_COUNT + lowestBitSet(slBits);
+
+    uint64_t flBits = (group + 1 < FIRST_LEVEL_COUNT) ? (_firstLevelBitmap & (~uint64_t(0) << (group + 1))) : 0;
+    if (!flBits) return INVALID_BIN;
+
+    group = lowestBitSet(flBits);
+    return group * SECOND_LEVEL_COUNT + lowestBitSet(_secondLevelBitmaps[group]);
+}
+
+uint32_t MemorySlots::_acquireSlot()
+{
+    if (_unusedSlots != INVALID_SLOT)
     {
-        totalSize += sizeOffset.second;
+        uint32_t slotIndex = _unusedSlots;
+        _unusedSlots = _slots[slotIndex].nextFree;
+        _slots[slotIndex] = {};
+        return slotIndex;
     }
-    return totalSize;
+
+    _slots.emplace_back();
+    return static_cast<uint32_t>(_slots.size() - 1);
 }
 
-bool MemorySlots::check() const
+void MemorySlots::_recycleSlot(uint32_t slotIndex)
+{
+    _slots[slotIndex].nextFree = _unusedSlots;
+    _unusedSlots = slotIndex;
+}
+
+void MemorySlots::_pushFree(uint32_t slotIndex)
 {
-    if (_availableMemory.size() != _offsetSizes.size())
+    Slot& slot = _slots[slotIndex];
+    uint32_t bin = _binIndex(slot.size);
+
+    slot.free = true;
+    slot.prevFree = INVALID_SLOT;
+    slot.nextFree = _freeLists[bin];
+    if (slot.nextFree != INVALID_SLOT) _slots[slot.nextFree].prevFree = slotIndex;
+    _freeLists[bin] = slotIndex;
+
+    _firstLevelBitmap |= uint64_t(1) << (bin / SECOND_LEVEL_COUNT);
+    _secondLevelBitmaps[bin / SECOND_LEVEL_COUNT] |= 1u << (bin % SECOND_LEVEL_COUNT);
+
+    _totalAvailableSize += slot.size;
+    ++_numAvailableSlots;
+}
+
+void MemorySlots::_popFree(uint32_t slotIndex)
+{
+    Slot& slot = _slots[slotIndex];
+    uint32_t bin = _binIndex(slot.size);
+
+    if (slot.prevFree != INVALID_SLOT)
+        _slots[slot.prevFree].nextFree = slot.nextFree;
+    else
+        _freeLists[bin] = slot.nextFree;
+    if (slot.nextFree != INVALID_SLOT) _slots[slot.nextFree].prevFree = slot.prevFree;
+
+    if (_freeLists[bin] == INVALID_SLOT)
     {
-        warn("MemorySlots::check() _availableMemory.size() ", _availableMemory.size(), " != _offsetSizes.size() ", _offsetSizes.size());
+        uint32_t group = bin / SECOND_LEVEL_COUNT;
+        _secondLevelBitmaps[group] &= ~(1u << (bin % SECOND_LEVEL_COUNT));
+        if (_secondLevelBitmaps[group] == 0) _firstLevelBitmap &= ~(uint64_t(1) << group);
     }
 
-    size_t availableSize = 0;
-    for (auto& offsetSize : _offsetSizes)
+    slot.free = false;
+    slot.prevFree = INVALID_SLOT;
+    slot.nextFree = INVALID_SLOT;
+
+    _totalAvailableSize -= slot.size;
+    --_numAvailableSlots;
+}
+
+size_t MemorySlots::maximumAvailableSpace() const
+{
+    if (_firstLevelBitmap == 0) return 0;
+
+    uint32_t group = highestBitSet(_firstLevelBitmap);
+    uint32_t bin = group * SECOND_LEVEL_COUNT + highestBitSet(_secondLevelBitmaps[group]);
+
+    size_t maximumSize = 0;
+    for (uint32_t slotIndex = _freeLists[bin]; slotIndex != INVALID_SLOT; slotIndex = _slots[slotIndex].nextFree)
     {
-        availableSize += offsetSize.second;
+        maximumSize = std::max(maximumSize, _slots[slotIndex].size);
     }
+    return maximumSize;
+}
 
+bool MemorySlots::check() const
+{
+    size_t availableSize = 0;
     size_t reservedSize = 0;
-    for (auto& offsetSize : _reservedMemory)
+    size_t availableCount = 0;
+    size_t reservedCount = 0;
+    size_t nextOffset = 0;
+    bool previousFree = false;
+    bool correct = true;
+
+    for (uint32_t slotIndex = _firstPhysical; slotIndex != INVALID_SLOT; slotIndex = _slots[slotIndex].nextPhysical)
     {
-        reservedSize += offsetSize.second;
+        const Slot& slot = _slots[slotIndex];
+        if (slot.offset != nextOffset)
+        {
+            warn("MemorySlots::check() ", this, " slot offset (", slot.offset, ") != expected offset (", nextOffset, ")");
+            correct = false;
+        }
+        if (slot.free && previousFree)
+        {
+            warn("MemorySlots::check() ", this, " adjacent free slots not coalesced at offset ", slot.offset);
+            correct = false;
+        }
+
+        if (slot.free)
+        {
+            availableSize += slot.size;
+            ++availableCount;
+        }
+        else
+        {
+            reservedSize += slot.size;
+            ++reservedCount;
+        }
+
+        nextOffset = slot.offset + slot.size;
+        previousFree = slot.free;
     }
 
-    size_t computedSize = availableSize + reservedSize;
-    if (computedSize != _totalMemorySize)
+    if (nextOffset != _totalMemorySize || availableSize != _totalAvailableSize || reservedSize != _totalReservedSize ||
+        availableCount != _numAvailableSlots || reservedCount != _numReservedSlots || reservedCount != _reservedSlots.size())
     {
-        warn("MemorySlots::check() ", this, " failed, computedSize (", computedSize, ") != _totalMemorySize (", _totalMemorySize, ")");
+        warn("MemorySlots::check() ", this, " failed, computedSize (", availableSize + reservedSize, ") != _totalMemorySize (", _totalMemorySize, ")");
         warn_stream([&](auto& fout) { report(fout); });
 
         return false;
     }
 
-    return true;
+    return correct;
 }
 
 void MemorySlots::report(std::ostream& out) const
 {
     out << "MemorySlots::report() " << this << std::endl;
-    for (auto& [offset, size] : _offsetSizes)
-    {
-        out << "    available " << offset << ", " << size << std::endl;
-    }
-
-    for (auto& [offset, size] : _reservedMemory)
-    {
-        out << "    reserved " << std::dec << offset << ", " << size << std::endl;
-    }
-}
+    out << "    total = " << _totalMemorySize << ", reserved = " << _totalReservedSize << " in " << _numReservedSlots
+        << " slots, available = " << _totalAvailableSize << " in " << _numAvailableSlots << " slots" << std::endl;
 
-void MemorySlots::insertAvailableSlot(size_t offset, size_t size)
-{
-    _offsetSizes.emplace(offset, size);
-    _availableMemory.emplace(size, offset);
-}
-
-void MemorySlots::removeAvailableSlot(size_t offset, size_t size)
-{
-    _offsetSizes.erase(offset);
-    auto end = _availableMemory.upper_bound(size);
-    for (auto itr = _availableMemory.lower_bound(size); itr != end; ++itr)
+    for (uint32_t slotIndex = _firstPhysical; slotIndex != INVALID_SLOT; slotIndex = _slots[slotIndex].nextPhysical)
     {
-        if (itr->second == offset)
-        {
-            _availableMemory.erase(itr);
-            break;
-        }
+        const Slot& slot = _slots[slotIndex];
+        out << "    " << (slot.free ? "available " : "reserved ") << slot.offset << ", " << slot.size << std::endl;
     }
 }
 
@@ -150,55 +276,98 @@ MemorySlots::OptionalOffset MemorySlots::reserve(size_t size, size_t alignment)
 
     if (full()) return OptionalOffset(false, 0);
 
-    auto itr = _availableMemory.lower_bound(size);
-    while (itr != _availableMemory.end())
+    size_t alignedStart = 0;
+    auto alignedFit = [&](const Slot& slot) -> bool {
+        alignedStart = ((slot.offset + alignment - 1) / alignment) * alignment;
+        return (alignedStart + size) <= (slot.offset + slot.size);
+    };
+
+    // any slot of at least size + alignment - 1 bytes is guaranteed to hold an aligned allocation,
+    // so a couple of bitmap scans finds a suitable bin and its head slot is taken without searching.
+    uint32_t slotIndex = INVALID_SLOT;
+    uint32_t bin = _findFreeBin(_binIndexCeil(size + alignment - 1));
+    if (bin != INVALID_BIN)
     {
-        size_t slotSize = itr->first;
-        size_t slotStart = itr->second;
-        size_t slotEnd = slotStart + slotSize;
-        size_t alignedStart = ((slotStart + alignment - 1) / alignment) * alignment;
-        size_t alignedEnd = alignedStart + size;
-        if (alignedEnd <= slotEnd) // slot big enough
+        slotIndex = _freeLists[bin];
+        alignedFit(_slots[slotIndex]);
+    }
+    else
+    {
+        // rare fallback when memory is nearly exhausted - a slot between size and size + alignment - 1
+        // bytes may still satisfy the alignment, so scan the few remaining candidate bins for one.
+        for (bin = _findFreeBin(_binIndex(size)); bin != INVALID_BIN; bin = _findFreeBin(bin + 1))
         {
-            // remove available slot
-            removeAvailableSlot(slotStart, slotSize);
-
-            if (slotStart < alignedStart) // space before newly reserved slot
+            for (uint32_t candidate = _freeLists[bin]; candidate != INVALID_SLOT; candidate = _slots[candidate].nextFree)
             {
-                insertAvailableSlot(slotStart, alignedStart - slotStart);
+                if (_slots[candidate].size >= size && alignedFit(_slots[candidate]))
+                {
+                    slotIndex = candidate;
+                    break;
+                }
             }
+            if (slotIndex != INVALID_SLOT) break;
+        }
+    }
 
-            if (alignedEnd < slotEnd) // space after newly reserved slot
-            {
-                slotStart = alignedEnd;
-                insertAvailableSlot(slotStart, slotEnd - slotStart);
-            }
+    if (slotIndex == INVALID_SLOT)
+    {
+        if (memoryTracking & MEMORY_TRACKING_CHECK_ACTIONS) check();
 
-            // record and return reserved slot
-            _reservedMemory.emplace(alignedStart, size);
+        if (memoryTracking & MEMORY_TRACKING_REPORT_ACTIONS)
+        {
+            info("MemorySlots::reserve(", size, ", ", alignment, ") ", this, " no suitable slots found");
+        }
+        return {false, 0};
+    }
 
-            if (memoryTracking & MEMORY_TRACKING_REPORT_ACTIONS)
-            {
-                info("MemorySlots::reserve(", size, ", ", alignment, ") ", this, " allocated [", alignedStart, ", ", size, "]");
-            }
+    _popFree(slotIndex);
 
-            if (memoryTracking & MEMORY_TRACKING_CHECK_ACTIONS) check();
+    size_t slotStart = _slots[slotIndex].offset;
+    size_t slotEnd = slotStart + _slots[slotIndex].size;
+    size_t alignedEnd = alignedStart + size;
 
-            return {true, alignedStart};
-        }
-        else // slot not big enough so advance to the next slot
-        {
-            ++itr;
-        }
+    if (slotStart < alignedStart) // space before newly reserved slot
+    {
+        uint32_t gapIndex = _acquireSlot();
+        _slots[gapIndex].offset = slotStart;
+        _slots[gapIndex].size = alignedStart - slotStart;
+        _slots[gapIndex].prevPhysical = _slots[slotIndex].prevPhysical;
+        _slots[gapIndex].nextPhysical = slotIndex;
+        if (_slots[slotIndex].prevPhysical != INVALID_SLOT)
+            _slots[_slots[slotIndex].prevPhysical].nextPhysical = gapIndex;
+        else
+            _firstPhysical = gapIndex;
+        _slots[slotIndex].prevPhysical = gapIndex;
+        _pushFree(gapIndex);
     }
 
-    if (memoryTracking & MEMORY_TRACKING_CHECK_ACTIONS) check();
+    if (alignedEnd < slotEnd) // space after newly reserved slot
+    {
+        uint32_t remainderIndex = _acquireSlot();
+        _slots[remainderIndex].offset = alignedEnd;
+        _slots[remainderIndex].size = slotEnd - alignedEnd;
+        _slots[remainderIndex].prevPhysical = slotIndex;
+        _slots[remainderIndex].nextPhysical = _slots[slotIndex].nextPhysical;
+        if (_slots[slotIndex].nextPhysical != INVALID_SLOT) _slots[_slots[slotIndex].nextPhysical].prevPhysical = remainderIndex;
+        _slots[slotIndex].nextPhysical = remainderIndex;
+        _pushFree(remainderIndex);
+    }
+
+    // the slot node is reused to record the reserved allocation, keeping its place in the physical list
+    _slots[slotIndex].offset = alignedStart;
+    _slots[slotIndex].size = size;
+    _reservedSlots.emplace(alignedStart, slotIndex);
+    _totalReservedSize += size;
+    ++_numReservedSlots;
 
     if (memoryTracking & MEMORY_TRACKING_REPORT_ACTIONS)
     {
-        info("MemorySlots::reserve(", size, ", ", alignment, ") ", this, " no suitable slots found");
+        info("MemorySlots::reserve(", size, ", ", alignment, ") ", this, " allocated [", alignedStart, ", ", size, "]");
     }
-    return {false, 0};
+
+    if (memoryTracking & MEMORY_TRACKING_CHECK_ACTIONS) check();
+
+    return {true, alignedStart};
 }
 
 bool MemorySlots::release(size_t offset, size_t size)
@@ -208,75 +377,60 @@ bool MemorySlots::release(size_t offset, size_t size)
         info("\nMemorySlots::release(", offset, ", ", size, ") ", this);
     }
 
-    auto itr = _reservedMemory.find(offset);
-    if (itr == _reservedMemory.end())
+    auto itr = _reservedSlots.find(offset);
+    if (itr == _reservedSlots.end())
     {
         // entry isn't in reserved slots
         return false;
     }
 
-    if (size != itr->second)
+    uint32_t slotIndex = itr->second;
+
+    if (size != _slots[slotIndex].size)
     {
         if (memoryTracking & MEMORY_TRACKING_REPORT_ACTIONS)
         {
-            info("    reserved slot different size = ", size, ", itr->second = ", itr->second);
+            info("    reserved slot different size = ", size, ", recorded size = ", _slots[slotIndex].size);
         }
 
-        size = itr->second;
+        size = _slots[slotIndex].size;
     }
 
-    // remove from reserved list
-    _reservedMemory.erase(itr);
+    // remove from reserved slots
+    _reservedSlots.erase(itr);
+    _totalReservedSize -= size;
+    --_numReservedSlots;
 
-    if (_offsetSizes.empty())
-    {
-        insertAvailableSlot(offset, size);
-
-        if (memoryTracking & MEMORY_TRACKING_CHECK_ACTIONS) check();
+    size_t slotStart = _slots[slotIndex].offset;
+    size_t slotEnd = slotStart + size;
 
-        return true;
-    }
-
-    size_t slotStart = offset;
-    size_t slotEnd = offset + size;
-
-    auto next_slot_itr = _offsetSizes.lower_bound(slotStart);
-    if (next_slot_itr != _offsetSizes.end())
+    // the physical neighbours always abut the released slot, so coalescing needs no searching
+    uint32_t prevIndex = _slots[slotIndex].prevPhysical;
+    if (prevIndex != INVALID_SLOT && _slots[prevIndex].free)
     {
-        if (next_slot_itr != _offsetSizes.begin())
-        {
-            auto prev_slot_itr = next_slot_itr;
-            --prev_slot_itr;
-
-            size_t prev_slotEnd = prev_slot_itr->first + prev_slot_itr->second;
-            if (prev_slotEnd == slotStart)
-            {
-                // previous slot abuts with the one being released so remove it.
-                slotStart = prev_slot_itr->first;
-                removeAvailableSlot(prev_slot_itr->first, prev_slot_itr->second);
-            }
-        }
-
-        if (next_slot_itr->first == slotEnd)
-        {
-            // next available slot abuts released so extend new slot and remove previous next available slot
-            slotEnd = next_slot_itr->first + next_slot_itr->second;
-            removeAvailableSlot(next_slot_itr->first, next_slot_itr->second);
-        }
+        slotStart = _slots[prevIndex].offset;
+        _popFree(prevIndex);
+        _slots[slotIndex].prevPhysical = _slots[prevIndex].prevPhysical;
+        if (_slots[prevIndex].prevPhysical != INVALID_SLOT)
+            _slots[_slots[prevIndex].prevPhysical].nextPhysical = slotIndex;
+        else
+            _firstPhysical = slotIndex;
+        _recycleSlot(prevIndex);
     }
-    else
+
+    uint32_t nextIndex = _slots[slotIndex].nextPhysical;
+    if (nextIndex != INVALID_SLOT && _slots[nextIndex].free)
     {
-        auto prev_slot_itr = _offsetSizes.rbegin();
-        size_t prev_slotEnd = prev_slot_itr->first + prev_slot_itr->second;
-        if (prev_slotEnd == slotStart)
-        {
-            // previous slot abuts with the one being released so remove it.
-            slotStart = prev_slot_itr->first;
-            removeAvailableSlot(prev_slot_itr->first, prev_slot_itr->second);
-        }
+        slotEnd = _slots[nextIndex].offset + _slots[nextIndex].size;
+        _popFree(nextIndex);
+        _slots[slotIndex].nextPhysical = _slots[nextIndex].nextPhysical;
+        if (_slots[nextIndex].nextPhysical != INVALID_SLOT) _slots[_slots[nextIndex].nextPhysical].prevPhysical = slotIndex;
+        _recycleSlot(nextIndex);
     }
 
-    insertAvailableSlot(slotStart, slotEnd - slotStart);
+    _slots[slotIndex].offset = slotStart;
+    _slots[slotIndex].size = slotEnd - slotStart;
+    _pushFree(slotIndex);
 
     if (memoryTracking & MEMORY_TRACKING_CHECK_ACTIONS) check();
 
@@ -44,7 +44,8 @@ Object::Object(const Object& rhs, const CopyOp& copyop) :
     if (rhs._auxiliary && rhs._auxiliary->getConnectedObject() == &rhs)
     {
         // the rhs's auxiliary is uniquely attached to it, so we need to create our own and copy its ObjectMap across
-        auto& userObjects = getOrCreateAuxiliary()->userObjects;
+        auto auxiliary = getOrCreateAuxiliary();
+        auto& userObjects = auxiliary->userObjects;
         userObjects = rhs._auxiliary->userObjects;
         if (copyop.duplicate)
         {
@@ -53,6 +54,7 @@ Object::Object(const Object& rhs, const CopyOp& copyop) :
                 itr->second = copyop(itr->second);
             }
         }
+        auxiliary->rebuildTokenObjects();
     }
 }
 
@@ -65,8 +67,9 @@ Object& Object::operator=(const Object& rhs)
     if (rhs._auxiliary)
     {
         // the rhs's auxiliary is uniquely attached to it, so we need to create our own and copy its ObjectMap across
-        auto& userObjects = getOrCreateAuxiliary()->userObjects;
-        userObjects = rhs._auxiliary->userObjects;
+        auto auxiliary = getOrCreateAuxiliary();
+        auxiliary->userObjects = rhs._auxiliary->userObjects;
+        auxiliary->rebuildTokenObjects();
     }
 
     return *this;
@@ -142,12 +145,14 @@ void Object::read(Input& input)
     auto numObjects = input.readValue<uint32_t>("userObjects");
     if (numObjects > 0)
     {
-        auto& objectMap = getOrCreateAuxiliary()->userObjects;
+        auto auxiliary = getOrCreateAuxiliary();
+        auto& objectMap = auxiliary->userObjects;
         for (; numObjects > 0; --numObjects)
         {
             std::string key = input.readValue<std::string>("key");
             input.readObject("object", objectMap[key]);
         }
+        auxiliary->rebuildTokenObjects();
     }
 }
 
@@ -203,7 +208,44 @@ void Object::removeObject(const std::string& key)
 {
     if (_auxiliary)
     {
-        _auxiliary->userObjects.erase(key);
+        _auxiliary->removeObject(key);
+    }
+}
+
+void Object::setObject(const Token& token, ref_ptr<Object> object)
+{
+    getOrCreateAuxiliary()->setObject(token, object);
+}
+
+Object* Object::getObject(const Token& token)
+{
+    if (!_auxiliary) return nullptr;
+    return _auxiliary->getObject(token);
+}
+
+const Object* Object::getObject(const Token& token) const
+{
+    if (!_auxiliary) return nullptr;
+    return _auxiliary->getObject(token);
+}
+
+ref_ptr<Object> Object::getRefObject(const Token& token)
+{
+    if (!_auxiliary) return {};
+    return _auxiliary->getRefObject(token);
+}
+
+ref_ptr<const Object> Object::getRefObject(const Token& token) const
+{
+    if (!_auxiliary) return {};
+    return _auxiliary->getRefObject(token);
+}
+
+void Object::removeObject(const Token& token)
+{
+    if (_auxiliary)
+    {
+        _auxiliary->removeObject(token);
     }
 }
 
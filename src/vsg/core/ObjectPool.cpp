@@ -0,0 +1,87 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Allocator.h>
+#include <vsg/core/ObjectPool.h>
+
+using namespace vsg;
+
+ObjectPool::ObjectPool()
+{
+}
+
+ObjectPool::~ObjectPool()
+{
+    clear();
+}
+
+ObjectPool& ObjectPool::instance()
+{
+    static ObjectPool s_objectPool;
+    return s_objectPool;
+}
+
+void* ObjectPool::take(std::size_t size)
+{
+    if (!enabled || size > maxObjectSize) return nullptr;
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto itr = _freeLists.find(size);
+    if (itr == _freeLists.end() || itr->second.empty()) return nullptr;
+
+    auto ptr = itr->second.back();
+    itr->second.pop_back();
+    return ptr;
+}
+
+bool ObjectPool::recycle(void* ptr, std::size_t size)
+{
+    if (!enabled || size == 0 || size > maxObjectSize) return false;
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto& freeList = _freeLists[size];
+    if (freeList.size() >= maxObjectsPerSize) return false;
+
+    freeList.push_back(ptr);
+    return true;
+}
+
+std::size_t ObjectPool::clear()
+{
+    std::map<std::size_t, std::vector<void*>> freeLists;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        freeLists.swap(_freeLists);
+    }
+
+    std::size_t count = 0;
+    for (auto& [size, freeList] : freeLists)
+    {
+        for (auto ptr : freeList) vsg::deallocate(ptr, size);
+        count += freeList.size();
+    }
+    return count;
+}
+
+std::size_t ObjectPool::totalRecycledSize() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    std::size_t total = 0;
+    for (const auto& [size, freeList] : _freeLists)
+    {
+        total += size * freeList.size();
+    }
+    return total;
+}
@@ -0,0 +1,76 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Token.h>
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+using namespace vsg;
+
+namespace
+{
+    // process-wide intern table, names stored in a deque so references handed out by Token::name() remain stable
+    struct TokenTable
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, uint32_t> indices;
+        std::deque<std::string> names;
+
+        static TokenTable& instance()
+        {
+            static TokenTable s_table;
+            return s_table;
+        }
+    };
+} // namespace
+
+Token::Token(const std::string& name)
+{
+    auto& table = TokenTable::instance();
+    std::scoped_lock lock(table.mutex);
+
+    if (auto itr = table.indices.find(name); itr != table.indices.end())
+    {
+        _index = itr->second;
+    }
+    else
+    {
+        _index = static_cast<uint32_t>(table.names.size());
+        table.names.push_back(name);
+        table.indices[name] = _index;
+    }
+}
+
+const std::string& Token::name() const
+{
+    static const std::string s_invalid_name;
+    if (_index == invalid_index) return s_invalid_name;
+
+    auto& table = TokenTable::instance();
+    std::scoped_lock lock(table.mutex);
+    return table.names[_index];
+}
+
+Token Token::find(const std::string& name)
+{
+    auto& table = TokenTable::instance();
+    std::scoped_lock lock(table.mutex);
+
+    Token token;
+    if (auto itr = table.indices.find(name); itr != table.indices.end())
+    {
+        token._index = itr->second;
+    }
+    return token;
+}
@@ -553,6 +553,10 @@ void Visitor::apply(PagedLOD& value)
 {
     apply(static_cast<Node&>(value));
 }
+void Visitor::apply(ImpostorLOD& value)
+{
+    apply(static_cast<Node&>(value));
+}
 void Visitor::apply(StateGroup& value)
 {
     apply(static_cast<Group&>(value));
@@ -561,10 +565,22 @@ void Visitor::apply(CullGroup& value)
 {
     apply(static_cast<Group&>(value));
 }
+void Visitor::apply(MaskGroup& value)
+{
+    apply(static_cast<Group&>(value));
+}
+void Visitor::apply(SpatialIndexGroup& value)
+{
+    apply(static_cast<Group&>(value));
+}
 void Visitor::apply(CullNode& value)
 {
     apply(static_cast<Node&>(value));
 }
+void Visitor::apply(OcclusionQueryNode& value)
+{
+    apply(static_cast<CullNode&>(value));
+}
 void Visitor::apply(Transform& value)
 {
     apply(static_cast<Group&>(value));
@@ -629,6 +645,10 @@ void Visitor::apply(RegionOfInterest& value)
 {
     apply(static_cast<Node&>(value));
 }
+void Visitor::apply(CompiledDrawList& value)
+{
+    apply(static_cast<Node&>(value));
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -0,0 +1,223 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Archive.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/MappedData.h>
+#include <vsg/io/Options.h>
+#include <vsg/io/VSG.h>
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+using namespace vsg;
+
+namespace
+{
+    // file layout: header { magic, indexOffset, numEntries }, entry data blocks, central directory
+    // at indexOffset holding numEntries of { uint32 keyLength, key characters, uint64 offset, uint64 size }.
+    const char archiveMagic[8] = {'v', 's', 'g', 'a', 'r', 'c', 'h', '1'};
+    constexpr size_t archiveHeaderSize = sizeof(archiveMagic) + 2 * sizeof(uint64_t);
+} // namespace
+
+Archive::Archive() :
+    _native(VSG::create())
+{
+}
+
+Archive::Archive(const Path& archiveFilename) :
+    Archive()
+{
+    open(archiveFilename);
+}
+
+bool Archive::open(const Path& archiveFilename)
+{
+    _entries.clear();
+
+    _mappedData = MappedData::map(archiveFilename);
+    if (!_mappedData)
+    {
+        warn("Archive::open(", archiveFilename, ") unable to map file.");
+        return false;
+    }
+
+    auto base = static_cast<const uint8_t*>(_mappedData->constDataPointer());
+    size_t fileSize = _mappedData->dataSize();
+
+    if (fileSize < archiveHeaderSize || std::memcmp(base, archiveMagic, sizeof(archiveMagic)) != 0)
+    {
+        warn("Archive::open(", archiveFilename, ") not an archive file.");
+        _mappedData = {};
+        return false;
+    }
+
+    uint64_t indexOffset = 0;
+    uint64_t numEntries = 0;
+    std::memcpy(&indexOffset, base + sizeof(archiveMagic), sizeof(indexOffset));
+    std::memcpy(&numEntries, base + sizeof(archiveMagic) + sizeof(indexOffset), sizeof(numEntries));
+
+    if (indexOffset < archiveHeaderSize || indexOffset > fileSize)
+    {
+        warn("Archive::open(", archiveFilename, ") invalid central directory offset.");
+        _mappedData = {};
+        return false;
+    }
+
+    const uint8_t* ptr = base + indexOffset;
+    const uint8_t* end = base + fileSize;
+
+    _entries.reserve(numEntries);
+
+    for (uint64_t i = 0; i < numEntries; ++i)
+    {
+        uint32_t keyLength = 0;
+        if (ptr + sizeof(keyLength) > end) break;
+        std::memcpy(&keyLength, ptr, sizeof(keyLength));
+        ptr += sizeof(keyLength);
+
+        if (ptr + keyLength + 2 * sizeof(uint64_t) > end) break;
+        std::string key(reinterpret_cast<const char*>(ptr), keyLength);
+        ptr += keyLength;
+
+        Entry entry;
+        std::memcpy(&entry.offset, ptr, sizeof(entry.offset));
+        ptr += sizeof(entry.offset);
+        std::memcpy(&entry.size, ptr, sizeof(entry.size));
+        ptr += sizeof(entry.size);
+
+        if (entry.offset + entry.size <= fileSize) _entries[key] = entry;
+    }
+
+    if (_entries.size() != numEntries)
+    {
+        warn("Archive::open(", archiveFilename, ") truncated central directory, read ", _entries.size(), " of ", numEntries, " entries.");
+        _entries.clear();
+        _mappedData = {};
+        return false;
+    }
+
+    return true;
+}
+
+ref_ptr<Object> Archive::read(const Path& filename, ref_ptr<const Options> options) const
+{
+    if (!_mappedData) return {};
+
+    auto itr = _entries.find(filename.string());
+    if (itr == _entries.end()) return {};
+
+    const auto& entry = itr->second;
+    const uint8_t* ptr = static_cast<const uint8_t*>(_mappedData->constDataPointer()) + entry.offset;
+
+    auto local_options = options ? Options::create(*options) : Options::create();
+    local_options->extensionHint = lowerCaseFileExtension(filename);
+
+    // try the native VSG formats first as tile databases are predominantly .vsgb
+    if (auto object = _native->read(ptr, entry.size, local_options)) return object;
+
+    for (auto& readerWriter : local_options->readerWriters)
+    {
+        // Archive itself doesn't implement the memory based read so can safely be included
+        if (auto object = readerWriter->read(ptr, entry.size, local_options)) return object;
+    }
+
+    return {};
+}
+
+bool Archive::create(const Path& archiveFilename)
+{
+    _entries.clear();
+    _mappedData = {};
+
+    _output.open(archiveFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!_output) return false;
+
+    // placeholder header, rewritten by close() once the central directory position is known
+    uint64_t indexOffset = 0;
+    uint64_t numEntries = 0;
+    _output.write(archiveMagic, sizeof(archiveMagic));
+    _output.write(reinterpret_cast<const char*>(&indexOffset), sizeof(indexOffset));
+    _output.write(reinterpret_cast<const char*>(&numEntries), sizeof(numEntries));
+
+    return _output.good();
+}
+
+bool Archive::add(const Path& key, const Path& sourceFilename)
+{
+    std::ifstream fin(sourceFilename, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!fin) return false;
+
+    auto size = fin.tellg();
+    fin.seekg(0, std::ios::beg);
+
+    std::vector<char> buffer(static_cast<size_t>(size));
+    fin.read(buffer.data(), size);
+    if (fin.fail()) return false;
+
+    return add(key, buffer.data(), static_cast<uint64_t>(size));
+}
+
+bool Archive::add(const Path& key, const Object* object, ref_ptr<const Options> options)
+{
+    if (!_output.is_open() || !object) return false;
+
+    auto local_options = options ? Options::create(*options) : Options::create();
+    local_options->extensionHint = ".vsgb";
+
+    std::ostringstream str(std::ios::out | std::ios::binary);
+    if (!_native->write(object, str, local_options)) return false;
+
+    auto contents = str.str();
+    return add(key, contents.data(), static_cast<uint64_t>(contents.size()));
+}
+
+bool Archive::add(const Path& key, const void* ptr, uint64_t size)
+{
+    if (!_output.is_open()) return false;
+
+    Entry entry;
+    entry.offset = static_cast<uint64_t>(_output.tellp());
+    entry.size = size;
+
+    _output.write(static_cast<const char*>(ptr), static_cast<std::streamsize>(size));
+    if (_output.fail()) return false;
+
+    _entries[key.string()] = entry;
+    return true;
+}
+
+bool Archive::close()
+{
+    if (!_output.is_open()) return false;
+
+    uint64_t indexOffset = static_cast<uint64_t>(_output.tellp());
+    uint64_t numEntries = _entries.size();
+
+    for (const auto& [key, entry] : _entries)
+    {
+        uint32_t keyLength = static_cast<uint32_t>(key.size());
+        _output.write(reinterpret_cast<const char*>(&keyLength), sizeof(keyLength));
+        _output.write(key.data(), keyLength);
+        _output.write(reinterpret_cast<const char*>(&entry.offset), sizeof(entry.offset));
+        _output.write(reinterpret_cast<const char*>(&entry.size), sizeof(entry.size));
+    }
+
+    _output.seekp(sizeof(archiveMagic), std::ios::beg);
+    _output.write(reinterpret_cast<const char*>(&indexOffset), sizeof(indexOffset));
+    _output.write(reinterpret_cast<const char*>(&numEntries), sizeof(numEntries));
+
+    bool good = _output.good();
+    _output.close();
+    return good;
+}
@@ -0,0 +1,134 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/observer_ptr.h>
+#include <vsg/io/AsyncReader.h>
+#include <vsg/io/Options.h>
+#include <vsg/io/read.h>
+
+using namespace vsg;
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// ReadRequest
+//
+ReadRequest::ReadRequest(const Path& in_filename, ref_ptr<const Options> in_options, Completion in_completion) :
+    filename(in_filename),
+    options(in_options),
+    completion(in_completion)
+{
+}
+
+bool ReadRequest::completed() const
+{
+    std::scoped_lock lock(_mutex);
+    return _completed;
+}
+
+ref_ptr<Object> ReadRequest::wait()
+{
+    std::unique_lock lock(_mutex);
+    while (!_completed) _cv.wait(lock);
+    return object;
+}
+
+void ReadRequest::complete(ref_ptr<Object> result)
+{
+    {
+        std::scoped_lock lock(_mutex);
+        object = result;
+        _completed = true;
+    }
+
+    if (completion) completion(*this);
+
+    _cv.notify_all();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// AsyncReader
+//
+namespace
+{
+    struct ReadOperation : public Inherit<Operation, ReadOperation>
+    {
+        ReadOperation(ref_ptr<ReadRequest> in_request, ref_ptr<ReaderWriter> in_readerWriter, AsyncReader& in_reader) :
+            request(in_request),
+            readerWriter(in_readerWriter),
+            reader(&in_reader)
+        {
+        }
+
+        ref_ptr<ReadRequest> request;
+        ref_ptr<ReaderWriter> readerWriter;
+        observer_ptr<AsyncReader> reader;
+
+        void run() override
+        {
+            if (readerWriter)
+                readerWriter->readAsync(request);
+            else
+                request->complete(vsg::read(request->filename, request->options));
+
+            if (auto ref_reader = reader.ref_ptr()) ref_reader->requestCompleted();
+        }
+    };
+} // namespace
+
+AsyncReader::AsyncReader(uint32_t numThreads, ref_ptr<ActivityStatus> in_status) :
+    operationThreads(OperationThreads::create(numThreads, in_status, true))
+{
+}
+
+AsyncReader::AsyncReader(ref_ptr<OperationThreads> in_operationThreads) :
+    operationThreads(in_operationThreads)
+{
+}
+
+ref_ptr<ReadRequest> AsyncReader::read(const Path& filename, ref_ptr<const Options> options, ReadRequest::Completion completion)
+{
+    auto request = ReadRequest::create(filename, options, completion);
+    read(request);
+    return request;
+}
+
+void AsyncReader::read(ref_ptr<ReadRequest> request)
+{
+    if (!request) return;
+
+    _pendingRequests.fetch_add(1, std::memory_order_relaxed);
+
+    auto operation = ReadOperation::create(request, readerWriter, *this);
+    if (operationThreads)
+        operationThreads->add(operation);
+    else
+        operation->run();
+}
+
+void AsyncReader::requestCompleted()
+{
+    if (_pendingRequests.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        std::scoped_lock lock(_waitMutex);
+        _waitCV.notify_all();
+    }
+}
+
+void AsyncReader::wait()
+{
+    std::unique_lock lock(_waitMutex);
+    while (_pendingRequests.load(std::memory_order_acquire) > 0)
+    {
+        _waitCV.wait_for(lock, std::chrono::milliseconds(100));
+    }
+}
@@ -15,13 +15,56 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/ReaderWriter.h>
 
 #include <cstring>
+#include <vector>
 
 using namespace vsg;
 
-BinaryInput::BinaryInput(std::istream& input, ref_ptr<ObjectFactory> in_objectFactory, ref_ptr<const Options> in_options) :
+BinaryInput::BinaryInput(std::istream& input, ref_ptr<ObjectFactory> in_objectFactory, ref_ptr<const Options> in_options, ref_ptr<Data> in_mappedData) :
     Input(in_objectFactory, in_options),
-    _input(input)
+    _input(input),
+    _mappedData(in_mappedData)
 {
+    if (in_options) codec = in_options->compressionCodec;
+}
+
+void BinaryInput::_readBlock(void* ptr, size_t bytes)
+{
+    uint64_t compressedSize = 0;
+    _input.read(reinterpret_cast<char*>(&compressedSize), sizeof(compressedSize));
+
+    if (compressedSize == 0)
+    {
+        // block was incompressible and stored raw
+        _input.read(static_cast<char*>(ptr), bytes);
+        return;
+    }
+
+    std::vector<uint8_t> buffer(compressedSize);
+    _input.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(compressedSize));
+    if (_input.fail()) return;
+
+    if (!codec->decompress(buffer.data(), compressedSize, ptr, bytes))
+    {
+        warn("BinaryInput::_readBlock() failed to decompress block of ", compressedSize, " bytes.");
+        _input.setstate(std::ios_base::failbit);
+    }
+}
+
+ref_ptr<Data> BinaryInput::mappedStorage(size_t size, size_t alignment, size_t& offset)
+{
+    if (!_mappedData || codec) return {};
+
+    auto position = _input.tellg();
+    if (position < 0) return {};
+
+    offset = static_cast<size_t>(position);
+    if (alignment != 0 && (offset % alignment) != 0) return {};
+
+    // advance the read position past the aliased bytes
+    _input.seekg(static_cast<std::istream::off_type>(size), std::ios_base::cur);
+    if (_input.fail()) return {};
+
+    return _mappedData;
 }
 
 void BinaryInput::_read(std::string& value)
@@ -96,6 +139,47 @@ vsg::ref_ptr<vsg::Object> BinaryInput::read()
     {
         return itr->second;
     }
+    else if (version_greater_equal(1, 1, 5))
+    {
+        // tokenized class names, the string itself is only present on the token's first occurrence and
+        // its creation function is resolved against the ObjectFactory once per file.
+        uint32_t token = readValue<uint32_t>(nullptr);
+
+        if (token == _classNameTable.size())
+        {
+            auto& new_entry = _classNameTable.emplace_back();
+            new_entry.className = readValue<std::string>(nullptr);
+
+            const auto& createMap = objectFactory->getCreateMap();
+            if (auto citr = createMap.find(new_entry.className); citr != createMap.end()) new_entry.createFunction = citr->second;
+        }
+        else if (token > _classNameTable.size())
+        {
+            warn("BinaryInput::read() invalid class name token : ", token);
+            return objectIDMap[id] = {};
+        }
+
+        auto& entry = _classNameTable[token];
+        if (entry.className != "nullptr")
+        {
+            ref_ptr<Object> object;
+            if (entry.createFunction) object = entry.createFunction();
+            objectIDMap[id] = object;
+            if (object)
+            {
+                object->read(*this);
+            }
+            else
+            {
+                warn("Unable to create instance of class : ", entry.className);
+            }
+            return object;
+        }
+        else
+        {
+            return objectIDMap[id] = {};
+        }
+    }
     else
     {
         std::string className = readValue<std::string>(nullptr);
@@ -14,12 +14,33 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/io/BinaryOutput.h>
 
+#include <vector>
+
 using namespace vsg;
 
 BinaryOutput::BinaryOutput(std::ostream& output, ref_ptr<const Options> in_options) :
     Output(in_options),
     _output(output)
 {
+    if (in_options) codec = in_options->compressionCodec;
+}
+
+void BinaryOutput::_writeBlock(const void* ptr, size_t bytes)
+{
+    std::vector<uint8_t> buffer(codec->compressBound(bytes));
+    uint64_t compressedSize = codec->compress(ptr, bytes, buffer.data(), buffer.size());
+    if (compressedSize == 0 || compressedSize >= bytes)
+    {
+        // incompressible block, store it raw with a compressedSize of 0 marking the absence of compression
+        compressedSize = 0;
+        _output.write(reinterpret_cast<const char*>(&compressedSize), sizeof(compressedSize));
+        _output.write(static_cast<const char*>(ptr), bytes);
+    }
+    else
+    {
+        _output.write(reinterpret_cast<const char*>(&compressedSize), sizeof(compressedSize));
+        _output.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(compressedSize));
+    }
 }
 
 void BinaryOutput::_write(const std::string& str)
@@ -81,6 +102,22 @@ void BinaryOutput::write(size_t num, const Path* value)
     }
 }
 
+void BinaryOutput::_writeClassName(const char* className)
+{
+    if (auto itr = _classNameTokens.find(className); itr != _classNameTokens.end())
+    {
+        _output.write(reinterpret_cast<const char*>(&itr->second), sizeof(itr->second));
+        return;
+    }
+
+    // first occurrence of the class name, write the newly assigned token followed by the string itself
+    uint32_t token = static_cast<uint32_t>(_classNameTokens.size());
+    _classNameTokens[className] = token;
+
+    _output.write(reinterpret_cast<const char*>(&token), sizeof(token));
+    _write(std::string(className));
+}
+
 void BinaryOutput::write(const vsg::Object* object)
 {
     if (auto itr = objectIDMap.find(object); itr != objectIDMap.end())
@@ -95,6 +132,14 @@ void BinaryOutput::write(const vsg::Object* object)
     objectIDMap[object] = id;
 
     _output.write(reinterpret_cast<const char*>(&id), sizeof(id));
+
+    if (version_greater_equal(1, 1, 5))
+    {
+        _writeClassName(object ? object->className() : "nullptr");
+        if (object) object->write(*this);
+        return;
+    }
+
     if (object)
     {
         _write(std::string(object->className()));
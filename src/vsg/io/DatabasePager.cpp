@@ -10,15 +10,119 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/commands/BindIndexBuffer.h>
+#include <vsg/commands/BindVertexBuffers.h>
 #include <vsg/io/DatabasePager.h>
 #include <vsg/io/Logger.h>
 #include <vsg/io/ReaderWriter.h>
 #include <vsg/io/read.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/state/DescriptorBuffer.h>
+#include <vsg/state/DescriptorImage.h>
+#include <vsg/threading/Affinity.h>
 #include <vsg/threading/atomics.h>
 #include <vsg/ui/ApplicationEvent.h>
 
+#include <cmath>
+
 using namespace vsg;
 
+namespace
+{
+    /// estimate the memory footprint of a loaded subgraph - each unique Data is counted once for its
+    /// CPU allocation and once again for the device local copy the compile traversal uploads, which is
+    /// what dominates tile memory use. Object overheads are ignored as noise against the array/texture data.
+    struct ComputeSubgraphFootprint : public Inherit<ConstVisitor, ComputeSubgraphFootprint>
+    {
+        std::set<const Data*> visited;
+        std::size_t bytes = 0;
+
+        void apply(const Object& object) override { object.traverse(*this); }
+
+        void apply(const Data& data) override
+        {
+            if (visited.insert(&data).second) bytes += 2 * data.dataSize();
+        }
+
+        void apply(const BufferInfo& info) override
+        {
+            if (info.data) info.data->accept(*this);
+        }
+
+        void apply(const Image& image) override
+        {
+            if (image.data) image.data->accept(*this);
+        }
+
+        void apply(const ImageView& imageView) override
+        {
+            if (imageView.image) imageView.image->accept(*this);
+        }
+
+        void apply(const ImageInfo& info) override
+        {
+            if (info.imageView) info.imageView->accept(*this);
+        }
+
+        void apply(const DescriptorBuffer& db) override
+        {
+            for (auto& info : db.bufferInfoList)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const DescriptorImage& di) override
+        {
+            for (auto& info : di.imageInfoList)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const BindIndexBuffer& bib) override
+        {
+            if (bib.indices) bib.indices->accept(*this);
+        }
+
+        void apply(const BindVertexBuffers& bvb) override
+        {
+            for (auto& info : bvb.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const VertexDraw& vd) override
+        {
+            for (auto& info : vd.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const VertexIndexDraw& vid) override
+        {
+            for (auto& info : vid.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+            if (vid.indices) vid.indices->accept(*this);
+        }
+
+        void apply(const Geometry& geometry) override
+        {
+            for (auto& info : geometry.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+            if (geometry.indices) geometry.indices->accept(*this);
+        }
+    };
+} // namespace
+
 /////////////////////////////////////////////////////////////////////////
 //
 // DatabasePager
@@ -88,6 +192,29 @@ ref_ptr<PagedLOD> DatabaseQueue::take_when_available()
     return plod;
 }
 
+DatabaseQueue::Nodes DatabaseQueue::take_stale(uint64_t frameCount, uint64_t maxFrameDelta)
+{
+    std::scoped_lock lock(_mutex);
+    Nodes stale;
+    for (auto itr = _queue.begin(); itr != _queue.end();)
+    {
+        uint64_t frameLastUsed = std::max((*itr)->frameHighResLastUsed.load(), (*itr)->framePrefetchLastUsed.load());
+        uint64_t frameDelta = frameCount - frameLastUsed;
+        if (frameDelta > maxFrameDelta)
+            stale.splice(stale.end(), _queue, itr++);
+        else
+            ++itr;
+    }
+    return stale;
+}
+
+void DatabaseQueue::add_front(Nodes& nodes)
+{
+    std::scoped_lock lock(_mutex);
+    _queue.splice(_queue.begin(), nodes);
+    _cv.notify_one();
+}
+
 DatabaseQueue::Nodes DatabaseQueue::take_all(CompileResult& cr)
 {
     std::scoped_lock lock(_mutex);
@@ -98,6 +225,18 @@ DatabaseQueue::Nodes DatabaseQueue::take_all(CompileResult& cr)
     return nodes;
 }
 
+bool DatabaseQueue::empty() const
+{
+    std::scoped_lock lock(_mutex);
+    return _queue.empty();
+}
+
+size_t DatabaseQueue::size() const
+{
+    std::scoped_lock lock(_mutex);
+    return _queue.size();
+}
+
 /////////////////////////////////////////////////////////////////////////
 //
 // DatabasePager
@@ -109,6 +248,7 @@ DatabasePager::DatabasePager()
     culledPagedLODs = CulledPagedLODs::create();
 
     _requestQueue = DatabaseQueue::create(_status);
+    _toCompileQueue = DatabaseQueue::create(_status);
     _toMergeQueue = DatabaseQueue::create(_status);
 
     pagedLODContainer = PagedLODContainer::create(4000);
@@ -124,6 +264,11 @@ DatabasePager::~DatabasePager()
     {
         thread.join();
     }
+
+    for (auto& thread : _compileThreads)
+    {
+        thread.join();
+    }
 }
 
 void DatabasePager::assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation)
@@ -133,12 +278,24 @@ void DatabasePager::assignInstrumentation(ref_ptr<Instrumentation> in_instrument
 
 void DatabasePager::start()
 {
-    int numReadThreads = 4;
+    if (minReadThreads == 0) minReadThreads = 1;
+    if (maxReadThreads < minReadThreads) maxReadThreads = minReadThreads;
+    if (minCompileThreads == 0) minCompileThreads = 1;
+    if (maxCompileThreads < minCompileThreads) maxCompileThreads = minCompileThreads;
+
+    // launch the full pools and start with the historical defaults active, updateThreadScaling()
+    // then grows/shrinks the active counts within the configured bounds as the workload develops
+    _activeReadThreads.exchange(std::min(std::max(4u, minReadThreads), maxReadThreads));
+    _activeCompileThreads.exchange(std::min(std::max(2u, minCompileThreads), maxCompileThreads));
+
+    // give each compile thread its own compile Context/staging pool so tile uploads are recorded and
+    // submitted concurrently on the compile threads rather than serializing on a shared traversal
+    if (compileManager) compileManager->reserveCompileTraversals(static_cast<size_t>(maxCompileThreads));
 
     //
-    // set up read thread(s)
+    // set up the I/O bound read thread(s)
     //
-    auto read = [](ref_ptr<DatabaseQueue> requestQueue, ref_ptr<ActivityStatus> status, DatabasePager& databasePager, const std::string& threadName) {
+    auto read = [](ref_ptr<DatabaseQueue> requestQueue, ref_ptr<ActivityStatus> status, DatabasePager& databasePager, const std::string& threadName, uint32_t slot) {
         debug("Started DatabaseThread read thread");
 
         auto local_instrumentation = shareOrDuplicateForThreadSafety(databasePager.instrumentation);
@@ -146,12 +303,20 @@ void DatabasePager::start()
 
         while (status->active())
         {
+            // threads above the current adaptive pool size park, staying ready for regrowth
+            if (slot >= databasePager._activeReadThreads.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+
             auto plod = requestQueue->take_when_available();
             if (plod)
             {
                 CPU_INSTRUMENTATION_L1_NC(databasePager.instrumentation, "DatabasePager read", COLOR_PAGER);
 
-                uint64_t frameDelta = databasePager.frameCount - plod->frameHighResLastUsed.load();
+                uint64_t frameLastUsed = std::max(plod->frameHighResLastUsed.load(), plod->framePrefetchLastUsed.load());
+                uint64_t frameDelta = databasePager.frameCount - frameLastUsed;
                 if (frameDelta > 1 || !compare_exchange(plod->requestStatus, PagedLOD::ReadRequest, PagedLOD::Reading))
                 {
                     // debug("Expire read request");
@@ -159,7 +324,17 @@ void DatabasePager::start()
                     continue;
                 }
 
-                auto read_object = vsg::read(plod->filename, plod->options);
+                auto before_read = clock::now();
+
+                // check the second chance cache first, restoring from RAM is much cheaper than a filesystem reload
+                ref_ptr<Object> read_object;
+                if (databasePager.retainedTileCache) read_object = databasePager.retainedTileCache->take(plod->filename);
+                if (!read_object) read_object = vsg::read(plod->filename, plod->options);
+
+                // sample the read latency for the adaptive sizing of the read pool
+                databasePager._readTimeNanoseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - before_read).count());
+                ++databasePager._readSampleCount;
+
                 auto subgraph = read_object.cast<Node>();
 
                 if (subgraph && compare_exchange(plod->requestStatus, PagedLOD::Reading, PagedLOD::Compiling))
@@ -169,19 +344,8 @@ void DatabasePager::start()
                         plod->pending = subgraph;
                     }
 
-                    // compile plod
-                    if (auto result = databasePager.compileManager->compile(subgraph))
-                    {
-                        plod->requestStatus.exchange(PagedLOD::MergeRequest);
-
-                        // move to the merge queue;
-                        databasePager._toMergeQueue->add(plod, result);
-                    }
-                    else
-                    {
-                        debug("Failed to compile ", plod, " ", plod->filename);
-                        databasePager.requestDiscarded(plod);
-                    }
+                    // hand over to the compile threads so heavy compiles don't stall reads and slow reads don't idle the compilers
+                    databasePager._toCompileQueue->add(plod);
                 }
                 else
                 {
@@ -197,9 +361,82 @@ void DatabasePager::start()
         debug("Finished DatabaseThread read thread");
     };
 
-    for (int i = 0; i < numReadThreads; ++i)
+    //
+    // set up the CPU/GPU bound compile thread(s)
+    //
+    auto compile = [](ref_ptr<DatabaseQueue> compileQueue, ref_ptr<ActivityStatus> status, DatabasePager& databasePager, const std::string& threadName, uint32_t slot) {
+        debug("Started DatabaseThread compile thread");
+
+        auto local_instrumentation = shareOrDuplicateForThreadSafety(databasePager.instrumentation);
+        if (local_instrumentation) local_instrumentation->setThreadName(threadName);
+
+        while (status->active())
+        {
+            if (slot >= databasePager._activeCompileThreads.load())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+
+            auto plod = compileQueue->take_when_available();
+            if (plod)
+            {
+                CPU_INSTRUMENTATION_L1_NC(databasePager.instrumentation, "DatabasePager compile", COLOR_PAGER);
+
+                ref_ptr<Node> subgraph;
+                {
+                    std::scoped_lock<std::mutex> lock(databasePager.pendingPagedLODMutex);
+                    subgraph = plod->pending;
+                }
+
+                if (!subgraph)
+                {
+                    databasePager.requestDiscarded(plod);
+                    continue;
+                }
+
+                // account the tile's memory footprint off the main thread so the byte budgeted
+                // expiry in updateSceneGraph() only has to sum the cached per tile values
+                auto footprint = ComputeSubgraphFootprint::create();
+                subgraph->accept(*footprint);
+                plod->highResBytes.exchange(footprint->bytes);
+
+                // compile plod
+                if (auto result = databasePager.compileManager->compile(subgraph))
+                {
+                    plod->requestStatus.exchange(PagedLOD::MergeRequest);
+
+                    // move to the merge queue;
+                    databasePager._toMergeQueue->add(plod, result);
+                }
+                else
+                {
+                    debug("Failed to compile ", plod, " ", plod->filename);
+                    databasePager.requestDiscarded(plod);
+                }
+            }
+        }
+        debug("Finished DatabaseThread compile thread");
+    };
+
+    for (uint32_t i = 0; i < maxReadThreads; ++i)
+    {
+        _readThreads.emplace_back(read, std::ref(_requestQueue), std::ref(_status), std::ref(*this), make_string("DatabasePager read thread ", i), i);
+
+        if (automaticThreadAffinity)
+        {
+            if (auto affinity = pagerThreadAffinity()) setAffinity(_readThreads.back(), affinity);
+        }
+    }
+
+    for (uint32_t i = 0; i < maxCompileThreads; ++i)
     {
-        _readThreads.emplace_back(read, std::ref(_requestQueue), std::ref(_status), std::ref(*this), make_string("DatabasePager thread ", i));
+        _compileThreads.emplace_back(compile, std::ref(_toCompileQueue), std::ref(_status), std::ref(*this), make_string("DatabasePager compile thread ", i), i);
+
+        if (automaticThreadAffinity)
+        {
+            if (auto affinity = pagerThreadAffinity()) setAffinity(_compileThreads.back(), affinity);
+        }
     }
 }
 
@@ -238,41 +475,125 @@ void DatabasePager::requestDiscarded(PagedLOD* plod)
     plod->requestCount.exchange(0);
     plod->requestStatus.exchange(PagedLOD::NoRequest);
     plod->pending = {};
+    plod->highResBytes.exchange(0);
     --numActiveRequests;
 }
 
+void DatabasePager::updateThreadScaling()
+{
+    if (_readThreads.empty()) return;
+
+    uint64_t frame = frameCount.load();
+    if (frame < _lastScalingFrame + threadScalingInterval) return;
+    _lastScalingFrame = frame;
+
+    uint32_t samples = _readSampleCount.exchange(0);
+    uint64_t nanoseconds = _readTimeNanoseconds.exchange(0);
+
+    size_t requestDepth = _requestQueue->size();
+    size_t compileDepth = _toCompileQueue->size();
+    size_t mergeBacklog = _toMergeQueue->size();
+
+    // don't grow the pools while the merge stage is the bottleneck, extra loads would only deepen the backlog
+    size_t mergeBacklogLimit = (maximumTilesMergedPerFrame != 0) ? static_cast<size_t>(maximumTilesMergedPerFrame) * 4 : 64;
+    bool mergeSaturated = mergeBacklog > mergeBacklogLimit;
+
+    // size the read pool with Little's law - the threads required to clear the backlog within targetDrainTime
+    // at the measured average read latency - stepping one thread per interval for stability
+    uint32_t readTarget = _activeReadThreads.load();
+    if (requestDepth == 0 && samples == 0)
+    {
+        if (++_readIdleIntervals >= 2 && readTarget > minReadThreads) --readTarget;
+    }
+    else
+    {
+        _readIdleIntervals = 0;
+
+        double averageLatency = (samples > 0) ? static_cast<double>(nanoseconds) * 1e-9 / static_cast<double>(samples) : 0.05;
+        double drainTime = (targetDrainTime > 0.0) ? targetDrainTime : 1.0;
+        uint32_t required = static_cast<uint32_t>(std::ceil(static_cast<double>(requestDepth) * averageLatency / drainTime));
+
+        if (required > readTarget && readTarget < maxReadThreads && !mergeSaturated)
+            ++readTarget;
+        else if (required + 1 < readTarget && readTarget > minReadThreads)
+            --readTarget;
+    }
+
+    // size the compile pool directly from its queue depth as the compile stage is throughput rather than latency bound
+    uint32_t compileTarget = _activeCompileThreads.load();
+    if (compileDepth == 0)
+    {
+        if (++_compileIdleIntervals >= 2 && compileTarget > minCompileThreads) --compileTarget;
+    }
+    else
+    {
+        _compileIdleIntervals = 0;
+        if (compileDepth > compileTarget && compileTarget < maxCompileThreads && !mergeSaturated) ++compileTarget;
+    }
+
+    if (readTarget != _activeReadThreads.load() || compileTarget != _activeCompileThreads.load())
+    {
+        debug("DatabasePager::updateThreadScaling() readTarget = ", readTarget, ", compileTarget = ", compileTarget,
+              ", requestDepth = ", requestDepth, ", compileDepth = ", compileDepth, ", mergeBacklog = ", mergeBacklog);
+    }
+
+    _activeReadThreads.exchange(readTarget);
+    _activeCompileThreads.exchange(compileTarget);
+}
+
+bool DatabasePager::requiresUpdateSceneGraph() const
+{
+    return numActiveRequests.load() != 0 || !_toMergeQueue->empty();
+}
+
 void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
 {
     CPU_INSTRUMENTATION_L1(instrumentation);
 
     frameCount.exchange(frameStamp ? frameStamp->frameCount : 0);
 
+    updateThreadScaling();
+
+    if (cancelStaleRequests)
+    {
+        // cancel queued read requests for tiles that have gone off screen so read bandwidth goes to what is visible now.
+        // requests taken by the read threads before this point are expired by the read threads' own frameDelta check.
+        for (auto& plod : _requestQueue->take_stale(frameCount, 1))
+        {
+            debug("DatabasePager::updateSceneGraph() cancelling stale request ", plod, " ", plod->filename);
+            requestDiscarded(plod);
+        }
+    }
+
     auto nodes = _toMergeQueue->take_all(cr);
 
     if (culledPagedLODs)
     {
-        auto previous_statusList_count = pagedLODContainer->activeList.count;
         auto& elements = pagedLODContainer->elements;
 
         for (auto& plod : culledPagedLODs->highresCulled)
         {
-            if ((plod->index != 0) && (elements[plod->index].list == &(pagedLODContainer->activeList)) && !plod->highResActive(frameCount))
+            auto slot = pagedLODContainer->slot(plod);
+            if ((slot != 0) && (elements[slot].status == PagedLODContainer::ACTIVE) && !plod->highResActive(frameCount))
             {
                 pagedLODContainer->inactive(plod);
             }
         }
 
-        auto& activeList = pagedLODContainer->activeList;
-        for (uint32_t index = activeList.head; index != 0;)
+        // scan the dense array of active slots, retiring any whose high res subgraphs haven't been used recently.
+        auto& activeSlots = pagedLODContainer->activeSlots;
+        for (size_t i = 0; i < activeSlots.size();)
         {
-            auto& element = elements[index];
-            index = element.next;
-
+            auto& element = elements[activeSlots[i]];
             if (!element.plod->highResActive(frameCount))
             {
-                // debug("   active to inactive ", index);
+                // inactive() swap removes the slot, replacing activeSlots[i] with the previous back entry, so don't advance i
                 pagedLODContainer->inactive(element.plod.get());
             }
+            else
+            {
+                ++i;
+            }
         }
 
         // debug("  newly active nodes:");
@@ -282,42 +603,65 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
             pagedLODContainer->active(plod);
         }
 
-        auto after_statusList_count = pagedLODContainer->activeList.count;
-
-        if (after_statusList_count > previous_statusList_count)
-        {
-            // debug("previous_statusList_count = ", previous_statusList_count, ", after_statusList_count = ", after_statusList_count, ", culledPagedLODs->newHighresRequired = ", culledPagedLODs->newHighresRequired.size());
-        }
-
         culledPagedLODs->clear();
 
         // set the number of PagedLOD to expire
-        uint32_t total = pagedLODContainer->activeList.count + pagedLODContainer->inactiveList.count;
+        uint32_t total = static_cast<uint32_t>(pagedLODContainer->activeSlots.size() + pagedLODContainer->inactiveSlots.size());
 
-        debug("DatabasePager : activeList.count = ", pagedLODContainer->activeList.count, ", inactiveList.count = ", pagedLODContainer->inactiveList.count, ", total = ", total);
+        debug("DatabasePager : activeSlots.size() = ", pagedLODContainer->activeSlots.size(), ", inactiveSlots.size() = ", pagedLODContainer->inactiveSlots.size(), ", total = ", total, ", residentBytes = ", pagedLODContainer->residentBytes);
 
-        if ((nodes.size() + total) > targetMaxNumPagedLODWithHighResSubgraphs)
+        // bytes about to be merged this frame count against the byte budget so the expiry makes room for them
+        std::size_t mergeBytes = 0;
+        if (targetMaxPagedLODMemory != 0)
         {
-            uint32_t numPagedLODHighRestSubgraphsToRemove = (static_cast<uint32_t>(nodes.size()) + total) - targetMaxNumPagedLODWithHighResSubgraphs;
-            uint32_t targetNumInactive = (numPagedLODHighRestSubgraphsToRemove < pagedLODContainer->inactiveList.count) ? (pagedLODContainer->inactiveList.count - numPagedLODHighRestSubgraphsToRemove) : 0;
+            for (auto& plod : nodes) mergeBytes += plod->highResBytes.load();
+        }
 
-            debug("Need to remove, inactive count = ", pagedLODContainer->inactiveList.count, ", target = ", targetNumInactive);
+        auto overByteBudget = [&]() -> bool {
+            return targetMaxPagedLODMemory != 0 && (mergeBytes + pagedLODContainer->residentBytes) > targetMaxPagedLODMemory;
+        };
 
-            for (uint32_t index = pagedLODContainer->inactiveList.head; (index != 0) && (pagedLODContainer->inactiveList.count > targetNumInactive);)
+        if (((nodes.size() + total) > targetMaxNumPagedLODWithHighResSubgraphs) || overByteBudget())
+        {
+            uint32_t inactiveCount = static_cast<uint32_t>(pagedLODContainer->inactiveSlots.size());
+            uint32_t targetNumInactive = inactiveCount;
+            if ((nodes.size() + total) > targetMaxNumPagedLODWithHighResSubgraphs)
             {
-                auto& element = elements[index];
-                index = element.next;
+                uint32_t numPagedLODHighRestSubgraphsToRemove = (static_cast<uint32_t>(nodes.size()) + total) - targetMaxNumPagedLODWithHighResSubgraphs;
+                targetNumInactive = (numPagedLODHighRestSubgraphsToRemove < inactiveCount) ? (inactiveCount - numPagedLODHighRestSubgraphsToRemove) : 0;
+            }
+
+            debug("Need to remove, inactive count = ", inactiveCount, ", target = ", targetNumInactive, ", mergeBytes = ", mergeBytes);
 
+            // inactiveSlots are in approximately the order they became inactive, so walking from the
+            // front expires the least recently traversed tiles first. remove() lowers residentBytes,
+            // so the byte budget check naturally terminates the scan once enough has been freed.
+            auto& inactiveSlots = pagedLODContainer->inactiveSlots;
+            for (size_t i = 0; (i < inactiveSlots.size()) && ((inactiveSlots.size() > targetNumInactive) || overByteBudget());)
+            {
+                auto& element = elements[inactiveSlots[i]];
                 if (compare_exchange(element.plod->requestStatus, PagedLOD::NoRequest, PagedLOD::DeleteRequest))
                 {
                     ref_ptr<PagedLOD> plod = element.plod;
+                    if (retainedTileCache && plod->children[0].node)
+                    {
+                        // half the footprint estimate is the CPU side of the subgraph, which is what the
+                        // retained entry keeps alive until the cache's background thread has serialized it
+                        retainedTileCache->retain(plod->filename, plod->children[0].node, plod->options, plod->highResBytes.load() / 2);
+                    }
                     plod->children[0].node = nullptr;
                     plod->requestCount.exchange(0);
                     plod->requestStatus.exchange(PagedLOD::NoRequest);
                     plod->pending = {};
+                    plod->highResBytes.exchange(0);
+                    // remove() swap removes the slot, replacing inactiveSlots[i] with the previous back entry, so don't advance i
                     pagedLODContainer->remove(plod);
                     debug("    trimming ", plod, " ", plod->filename);
                 }
+                else
+                {
+                    ++i;
+                }
             }
         }
     }
@@ -331,8 +675,17 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
 #endif
 
         debug("DatabasePager::updateSceneGraph() nodes to merge : nodes.size() = ", nodes.size(), ", ", numActiveRequests.load());
-        for (auto& plod : nodes)
+
+        uint32_t numMerged = 0;
+        auto start_tick = clock::now();
+
+        auto itr = nodes.begin();
+        for (; itr != nodes.end(); ++itr)
         {
+            if (maximumTilesMergedPerFrame != 0 && numMerged >= maximumTilesMergedPerFrame) break;
+            if (maximumTimeMergingPerFrame != 0.0 && std::chrono::duration<double>(clock::now() - start_tick).count() >= maximumTimeMergingPerFrame) break;
+
+            auto& plod = *itr;
             if (compare_exchange(plod->requestStatus, PagedLOD::MergeRequest, PagedLOD::Merging))
             {
                 debug("   Merged ", plod->filename, " after ", plod->requestCount.load(), " priority ", plod->priority.load(), " ", frameCount - plod->frameHighResLastUsed.load(), " plod = ", plod);
@@ -345,8 +698,18 @@ void DatabasePager::updateSceneGraph(FrameStamp* frameStamp, CompileResult& cr)
 
                 plod->requestStatus.exchange(PagedLOD::NoRequest);
             }
+            ++numMerged;
+        }
+        numActiveRequests -= numMerged;
+
+        if (itr != nodes.end())
+        {
+            // merge budget exhausted, return the remaining nodes to the merge queue for subsequent frames
+            debug("DatabasePager::updateSceneGraph() merge budget reached after ", numMerged, " tiles, requeuing ", nodes.size() - numMerged, " tiles");
+            DatabaseQueue::Nodes remaining;
+            remaining.splice(remaining.end(), nodes, itr, nodes.end());
+            _toMergeQueue->add_front(remaining);
         }
-        numActiveRequests -= static_cast<uint32_t>(nodes.size());
     }
     else
     {
@@ -0,0 +1,113 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/DirectoryCache.h>
+#include <vsg/io/Options.h>
+
+using namespace vsg;
+
+namespace
+{
+    // split a path into its containing directory and the filename within it
+    std::pair<Path, std::string> splitPath(const Path& path)
+    {
+        std::string full = path.string();
+        auto pos = full.find_last_of("/\\");
+        if (pos == std::string::npos) return {Path("."), full};
+        return {Path(full.substr(0, (pos == 0) ? 1 : pos)), full.substr(pos + 1)};
+    }
+} // namespace
+
+DirectoryCache::DirectoryCache()
+{
+}
+
+DirectoryCache::DirectoryEntry& DirectoryCache::getDirectory(const Path& directory)
+{
+    auto key = directory.string();
+    auto itr = _directories.find(key);
+
+    if (itr != _directories.end())
+    {
+        if (timeToLive <= 0.0) return itr->second;
+
+        auto age = std::chrono::duration<double>(std::chrono::steady_clock::now() - itr->second.timeLoaded).count();
+        if (age < timeToLive) return itr->second;
+    }
+    else
+    {
+        itr = _directories.emplace(key, DirectoryEntry{}).first;
+    }
+
+    auto& entry = itr->second;
+    entry.timeLoaded = std::chrono::steady_clock::now();
+    entry.files.clear();
+
+    for (const auto& name : getDirectoryContents(directory))
+    {
+        entry.files.insert(name.string());
+    }
+
+    return entry;
+}
+
+bool DirectoryCache::fileExists(const Path& path)
+{
+    auto [directory, name] = splitPath(path);
+
+    std::scoped_lock lock(_mutex);
+    auto& entry = getDirectory(directory);
+    return entry.files.count(name) != 0;
+}
+
+Path DirectoryCache::findFile(const Path& filename, const Paths& paths)
+{
+    for (const auto& path : paths)
+    {
+        Path fullpath = path / filename;
+        if (fileExists(fullpath))
+        {
+            return fullpath;
+        }
+    }
+    return {};
+}
+
+Path DirectoryCache::findFile(const Path& filename, const Options* options)
+{
+    // mirrors the semantics of vsg::findFile(filename, options), with existence checks served from the cache
+    if (options && !options->paths.empty())
+    {
+        if (options->checkFilenameHint == Options::CHECK_ORIGINAL_FILENAME_EXISTS_FIRST && fileExists(filename)) return filename;
+
+        if (auto path = findFile(filename, options->paths)) return path;
+
+        if (options->checkFilenameHint == Options::CHECK_ORIGINAL_FILENAME_EXISTS_LAST && fileExists(filename))
+            return filename;
+        else
+            return {};
+    }
+
+    return fileExists(filename) ? filename : Path();
+}
+
+void DirectoryCache::clear()
+{
+    std::scoped_lock lock(_mutex);
+    _directories.clear();
+}
+
+void DirectoryCache::invalidate(const Path& directory)
+{
+    std::scoped_lock lock(_mutex);
+    _directories.erase(directory.string());
+}
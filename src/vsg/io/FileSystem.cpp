@@ -10,6 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/io/DirectoryCache.h>
 #include <vsg/io/FileSystem.h>
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
@@ -133,6 +134,22 @@ FileType vsg::fileType(const Path& path)
         return FILE_NOT_FOUND;
 }
 
+std::string vsg::fileModificationStamp(const Path& path)
+{
+#if defined(_MSC_VER) || defined(__MINGW32__)
+    struct __stat64 stbuf;
+    if (_wstat64(path.c_str(), &stbuf) != 0) return {};
+#elif defined(__APPLE__)
+    struct stat stbuf;
+    if (stat(path.c_str(), &stbuf) != 0) return {};
+#else
+    struct stat64 stbuf;
+    if (stat64(path.c_str(), &stbuf) != 0) return {};
+#endif
+
+    return std::to_string(static_cast<long long>(stbuf.st_size)) + ":" + std::to_string(static_cast<long long>(stbuf.st_mtime));
+}
+
 bool vsg::fileExists(const Path& path)
 {
 #if defined(_MSC_VER) || defined(__MINGW32__)
@@ -162,6 +179,9 @@ Path vsg::findFile(const Path& filename, const Options* options)
         // if Options has a findFileCallback use it
         if (options->findFileCallback) return options->findFileCallback(filename, options);
 
+        // if Options has a directoryCache serve the search from its cached directory listings
+        if (options->directoryCache) return options->directoryCache->findFile(filename, options);
+
         if (!options->paths.empty())
         {
             // if appropriate use the filename directly if it exists.
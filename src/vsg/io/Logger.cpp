@@ -318,6 +318,112 @@ void ThreadLogger::fatal_implementation(const std::string_view& message)
     fprintf(stderr, "%s%.*s\n", fatalPrefix.c_str(), static_cast<int>(message.length()), message.data());
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// AsyncLogger
+//
+AsyncLogger::AsyncLogger(ref_ptr<Logger> in_delegate, size_t queueSize) :
+    delegate(in_delegate ? in_delegate : ref_ptr<Logger>(StdLogger::create()))
+{
+    // filtering is done by the AsyncLogger's own level before messages are enqueued
+    delegate->level = LOGGER_ALL;
+
+    _queue = LockFreeQueue<Message*>::create(queueSize);
+    _thread = std::thread(&AsyncLogger::_run, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    _active.exchange(false);
+    _sleepCV.notify_all();
+    if (_thread.joinable()) _thread.join();
+}
+
+void AsyncLogger::_enqueue(Level msg_level, const std::string_view& message)
+{
+    auto msg = new Message{msg_level, std::string(message)};
+    _pending.fetch_add(1);
+    if (_queue->push(msg))
+    {
+        _sleepCV.notify_one();
+    }
+    else
+    {
+        // ring momentarily full, write through the delegate on the calling thread rather than drop the message
+        delegate->log(msg->msg_level, std::string_view(msg->text));
+        delete msg;
+        _pending.fetch_sub(1);
+    }
+}
+
+void AsyncLogger::_wait()
+{
+    std::unique_lock lock(_drainMutex);
+    while (_pending.load() != 0)
+    {
+        _drainCV.wait_for(lock, std::chrono::milliseconds(10));
+    }
+}
+
+void AsyncLogger::_run()
+{
+    while (_active.load())
+    {
+        if (auto msg = _queue->pop())
+        {
+            delegate->log(msg->msg_level, std::string_view(msg->text));
+            delete msg;
+            if (_pending.fetch_sub(1) == 1) _drainCV.notify_all();
+        }
+        else
+        {
+            std::unique_lock lock(_sleepMutex);
+            if (_active.load() && _queue->empty()) _sleepCV.wait_for(lock, std::chrono::milliseconds(100));
+        }
+    }
+
+    // drain any messages left when stopping
+    while (auto msg = _queue->pop())
+    {
+        delegate->log(msg->msg_level, std::string_view(msg->text));
+        delete msg;
+        if (_pending.fetch_sub(1) == 1) _drainCV.notify_all();
+    }
+}
+
+void AsyncLogger::flush()
+{
+    _wait();
+    delegate->flush();
+}
+
+void AsyncLogger::debug_implementation(const std::string_view& message)
+{
+    _enqueue(LOGGER_DEBUG, message);
+}
+
+void AsyncLogger::info_implementation(const std::string_view& message)
+{
+    _enqueue(LOGGER_INFO, message);
+}
+
+void AsyncLogger::warn_implementation(const std::string_view& message)
+{
+    _enqueue(LOGGER_WARN, message);
+}
+
+void AsyncLogger::error_implementation(const std::string_view& message)
+{
+    _enqueue(LOGGER_ERROR, message);
+}
+
+void AsyncLogger::fatal_implementation(const std::string_view& message)
+{
+    // preserve ordering then write synchronously so the delegate's exception propagates on the calling thread
+    _wait();
+    delegate->log(LOGGER_FATAL, message);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // NullLogger
@@ -0,0 +1,98 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/MappedData.h>
+
+#if defined(_WIN32)
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+using namespace vsg;
+
+MappedData::MappedData(void* ptr, size_t size) :
+    _ptr(ptr),
+    _size(size)
+{
+    // the mapping is read only until written, treat it as fixed data that never needs transferring twice
+    properties.allocatorType = ALLOCATOR_TYPE_NO_DELETE;
+}
+
+MappedData::~MappedData()
+{
+#if defined(_WIN32)
+    if (_ptr) UnmapViewOfFile(_ptr);
+#else
+    if (_ptr) munmap(_ptr, _size);
+#endif
+}
+
+ref_ptr<MappedData> MappedData::map(const Path& filename)
+{
+#if defined(_WIN32)
+    HANDLE fileHandle = CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) return {};
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        return {};
+    }
+
+    HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!mappingHandle)
+    {
+        CloseHandle(fileHandle);
+        return {};
+    }
+
+    void* ptr = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+
+    // the view keeps its own references, the handles can be closed immediately
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+
+    if (!ptr) return {};
+
+    return ref_ptr<MappedData>(new MappedData(ptr, static_cast<size_t>(fileSize.QuadPart)));
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return {};
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+        return {};
+    }
+
+    size_t size = static_cast<size_t>(fileStat.st_size);
+
+    // private copy-on-write mapping, writes touch private pages rather than the file
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+    // the mapping keeps its own reference, the file descriptor can be closed immediately
+    close(fd);
+
+    if (ptr == MAP_FAILED) return {};
+
+    return ref_ptr<MappedData>(new MappedData(ptr, size));
+#endif
+}
@@ -0,0 +1,191 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/MemoryBinaryInput.h>
+#include <vsg/io/ReaderWriter.h>
+#include <vsg/io/convert_utf.h>
+
+using namespace vsg;
+
+MemoryBinaryInput::MemoryBinaryInput(const uint8_t* ptr, size_t size, ref_ptr<ObjectFactory> in_objectFactory, ref_ptr<const Options> in_options, ref_ptr<Data> in_mappedData) :
+    Input(in_objectFactory, in_options),
+    _begin(ptr),
+    _ptr(ptr),
+    _end(ptr + size),
+    _mappedData(in_mappedData)
+{
+    if (in_options) codec = in_options->compressionCodec;
+
+    if (_mappedData)
+    {
+        _mappedOffset = static_cast<size_t>(_begin - static_cast<const uint8_t*>(_mappedData->constDataPointer()));
+    }
+}
+
+void MemoryBinaryInput::_readBlock(void* ptr, size_t bytes)
+{
+    uint64_t compressedSize = 0;
+    _readBytes(&compressedSize, sizeof(compressedSize));
+
+    if (compressedSize == 0)
+    {
+        // block was incompressible and stored raw
+        _readBytes(ptr, bytes);
+        return;
+    }
+
+    if (static_cast<size_t>(_end - _ptr) < compressedSize)
+    {
+        _ptr = _end;
+        _failed = true;
+        return;
+    }
+
+    // decompress directly from the cursor, no intermediate buffer required
+    if (!codec->decompress(_ptr, compressedSize, ptr, bytes))
+    {
+        warn("MemoryBinaryInput::_readBlock() failed to decompress block of ", compressedSize, " bytes.");
+        _failed = true;
+    }
+
+    _ptr += compressedSize;
+}
+
+ref_ptr<Data> MemoryBinaryInput::mappedStorage(size_t size, size_t alignment, size_t& offset)
+{
+    if (!_mappedData || codec) return {};
+
+    if (static_cast<size_t>(_end - _ptr) < size) return {};
+
+    offset = _mappedOffset + position();
+    if (alignment != 0 && (offset % alignment) != 0) return {};
+
+    // advance the cursor past the aliased bytes
+    _ptr += size;
+
+    return _mappedData;
+}
+
+void MemoryBinaryInput::_read(std::string& value)
+{
+    uint32_t size = readValue<uint32_t>(nullptr);
+
+    value.resize(size, 0);
+    _readBytes(value.data(), size);
+}
+
+void MemoryBinaryInput::_read(std::wstring& value)
+{
+    std::string string_value;
+    _read(string_value);
+    convert_utf(string_value, value);
+}
+
+void MemoryBinaryInput::read(size_t num, std::string* value)
+{
+    for (; num > 0; --num, ++value)
+    {
+        _read(*value);
+    }
+}
+
+void MemoryBinaryInput::read(size_t num, std::wstring* value)
+{
+    for (; num > 0; --num, ++value)
+    {
+        _read(*value);
+    }
+}
+
+void MemoryBinaryInput::read(size_t num, Path* value)
+{
+    for (; num > 0; --num, ++value)
+    {
+        std::string str_value;
+        _read(str_value);
+        *value = str_value;
+    }
+}
+
+vsg::ref_ptr<vsg::Object> MemoryBinaryInput::read()
+{
+    ObjectID id = objectID();
+
+    if (auto itr = objectIDMap.find(id); itr != objectIDMap.end())
+    {
+        return itr->second;
+    }
+    else if (version_greater_equal(1, 1, 5))
+    {
+        // tokenized class names, the string itself is only present on the token's first occurrence and
+        // its creation function is resolved against the ObjectFactory once per file.
+        uint32_t token = readValue<uint32_t>(nullptr);
+
+        if (token == _classNameTable.size())
+        {
+            auto& new_entry = _classNameTable.emplace_back();
+            new_entry.className = readValue<std::string>(nullptr);
+
+            const auto& createMap = objectFactory->getCreateMap();
+            if (auto citr = createMap.find(new_entry.className); citr != createMap.end()) new_entry.createFunction = citr->second;
+        }
+        else if (token > _classNameTable.size())
+        {
+            warn("MemoryBinaryInput::read() invalid class name token : ", token);
+            return objectIDMap[id] = {};
+        }
+
+        auto& entry = _classNameTable[token];
+        if (entry.className != "nullptr")
+        {
+            ref_ptr<Object> object;
+            if (entry.createFunction) object = entry.createFunction();
+            objectIDMap[id] = object;
+            if (object)
+            {
+                object->read(*this);
+            }
+            else
+            {
+                warn("Unable to create instance of class : ", entry.className);
+            }
+            return object;
+        }
+        else
+        {
+            return objectIDMap[id] = {};
+        }
+    }
+    else
+    {
+        std::string className = readValue<std::string>(nullptr);
+        if (className != "nullptr")
+        {
+            auto object = objectFactory->create(className.c_str());
+            objectIDMap[id] = object;
+            if (object)
+            {
+                object->read(*this);
+            }
+            else
+            {
+                warn("Unable to create instance of class : ", className);
+            }
+            return object;
+        }
+        else
+        {
+            return objectIDMap[id] = {};
+        }
+    }
+}
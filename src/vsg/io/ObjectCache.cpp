@@ -0,0 +1,264 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/BindIndexBuffer.h>
+#include <vsg/commands/BindVertexBuffers.h>
+#include <vsg/core/compare.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/ObjectCache.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/state/DescriptorBuffer.h>
+#include <vsg/state/DescriptorImage.h>
+
+#include <set>
+
+using namespace vsg;
+
+namespace
+{
+    /// estimate the CPU memory footprint of a cached object - each unique Data is counted once for its
+    /// allocation, which is what dominates the size of loaded textures and models. Object overheads are
+    /// ignored as noise against the array/texture data.
+    struct ComputeCachedObjectFootprint : public Inherit<ConstVisitor, ComputeCachedObjectFootprint>
+    {
+        std::set<const Data*> visited;
+        std::size_t bytes = 0;
+
+        void apply(const Object& object) override { object.traverse(*this); }
+
+        void apply(const Data& data) override
+        {
+            if (visited.insert(&data).second) bytes += data.dataSize();
+        }
+
+        void apply(const BufferInfo& info) override
+        {
+            if (info.data) info.data->accept(*this);
+        }
+
+        void apply(const Image& image) override
+        {
+            if (image.data) image.data->accept(*this);
+        }
+
+        void apply(const ImageView& imageView) override
+        {
+            if (imageView.image) imageView.image->accept(*this);
+        }
+
+        void apply(const ImageInfo& info) override
+        {
+            if (info.imageView) info.imageView->accept(*this);
+        }
+
+        void apply(const DescriptorBuffer& db) override
+        {
+            for (auto& info : db.bufferInfoList)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const DescriptorImage& di) override
+        {
+            for (auto& info : di.imageInfoList)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const BindIndexBuffer& bib) override
+        {
+            if (bib.indices) bib.indices->accept(*this);
+        }
+
+        void apply(const BindVertexBuffers& bvb) override
+        {
+            for (auto& info : bvb.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const VertexDraw& vd) override
+        {
+            for (auto& info : vd.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+        }
+
+        void apply(const VertexIndexDraw& vid) override
+        {
+            for (auto& info : vid.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+            if (vid.indices) vid.indices->accept(*this);
+        }
+
+        void apply(const Geometry& geometry) override
+        {
+            for (auto& info : geometry.arrays)
+            {
+                if (info) info->accept(*this);
+            }
+            if (geometry.indices) geometry.indices->accept(*this);
+        }
+    };
+} // namespace
+
+ObjectCache::ObjectCache(std::size_t in_maxCachedBytes) :
+    maxCachedBytes(in_maxCachedBytes)
+{
+}
+
+bool ObjectCache::KeyCompare::operator()(const Key& lhs, const Key& rhs) const
+{
+    if (lhs.filename < rhs.filename) return true;
+    if (rhs.filename < lhs.filename) return false;
+    return compare_pointer(lhs.options, rhs.options) < 0;
+}
+
+ref_ptr<ObjectCache::Item> ObjectCache::_getOrCreateItem(const Key& key)
+{
+    auto itr = _items.find(key);
+    if (itr == _items.end())
+    {
+        itr = _items.emplace(key, Item::create()).first;
+        itr->second->lruItr = _lru.insert(_lru.end(), key);
+    }
+    else
+    {
+        // refresh the entry's position in the LRU list
+        _lru.splice(_lru.end(), _lru, itr->second->lruItr);
+    }
+    return itr->second;
+}
+
+ref_ptr<Object> ObjectCache::getOrLoad(const Path& filename, ref_ptr<const Options> options, const LoadFunction& loadFunction)
+{
+    Key key{filename, options};
+
+    ref_ptr<Item> item;
+    {
+        std::scoped_lock lock(_mutex);
+        item = _getOrCreateItem(key);
+    }
+
+    // take the per entry mutex so concurrent reads of the same file collapse into a single load,
+    // with the other callers blocking here until the loading thread has assigned the object.
+    std::scoped_lock itemLock(item->mutex);
+    if (item->loaded) return item->object;
+
+    item->object = loadFunction();
+    item->loaded = true;
+
+    std::size_t bytes = 0;
+    if (item->object)
+    {
+        auto footprint = ComputeCachedObjectFootprint::create();
+        item->object->accept(*footprint);
+        bytes = footprint->bytes;
+    }
+
+    {
+        std::scoped_lock lock(_mutex);
+
+        // the entry may have been evicted or replaced while the load was in flight, in which case
+        // this item is no longer tracked and its bytes must not be accounted to the cache.
+        auto itr = _items.find(key);
+        if (itr != _items.end() && itr->second == item)
+        {
+            if (item->object)
+            {
+                item->bytes = bytes;
+                _cachedBytes += bytes;
+                _evict();
+            }
+            else
+            {
+                // failed load, don't retain the entry so subsequent calls retry
+                _lru.erase(item->lruItr);
+                _items.erase(itr);
+            }
+        }
+    }
+
+    return item->object;
+}
+
+ref_ptr<Object> ObjectCache::get(const Path& filename, ref_ptr<const Options> options)
+{
+    ref_ptr<Item> item;
+    {
+        std::scoped_lock lock(_mutex);
+        auto itr = _items.find(Key{filename, options});
+        if (itr == _items.end()) return {};
+
+        _lru.splice(_lru.end(), _lru, itr->second->lruItr);
+        item = itr->second;
+    }
+
+    // waits for any in flight load of the entry to complete
+    std::scoped_lock itemLock(item->mutex);
+    return item->object;
+}
+
+void ObjectCache::remove(const Path& filename)
+{
+    std::scoped_lock lock(_mutex);
+    for (auto itr = _items.begin(); itr != _items.end();)
+    {
+        if (itr->first.filename == filename)
+        {
+            _cachedBytes -= itr->second->bytes;
+            _lru.erase(itr->second->lruItr);
+            itr = _items.erase(itr);
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+}
+
+std::size_t ObjectCache::cachedBytes() const
+{
+    std::scoped_lock lock(_mutex);
+    return _cachedBytes;
+}
+
+void ObjectCache::clear()
+{
+    std::scoped_lock lock(_mutex);
+    _items.clear();
+    _lru.clear();
+    _cachedBytes = 0;
+}
+
+void ObjectCache::_evict()
+{
+    while (_cachedBytes > maxCachedBytes && !_lru.empty())
+    {
+        auto itr = _items.find(_lru.front());
+        if (itr != _items.end())
+        {
+            debug("ObjectCache evicting ", itr->first.filename, ", bytes = ", itr->second->bytes);
+            _cachedBytes -= itr->second->bytes;
+            _items.erase(itr);
+        }
+        _lru.pop_front();
+    }
+}
@@ -68,6 +68,7 @@ ObjectFactory::ObjectFactory()
     // arrays
     add<vsg::byteArray>();
     add<vsg::ubyteArray>();
+    add<vsg::ArraySoA>();
     add<vsg::shortArray>();
     add<vsg::ushortArray>();
     add<vsg::intArray>();
@@ -171,9 +172,14 @@ ObjectFactory::ObjectFactory()
     add<vsg::QuadGroup>();
     add<vsg::StateGroup>();
     add<vsg::CullGroup>();
+    add<vsg::MaskGroup>();
+    add<vsg::SpatialIndexGroup>();
     add<vsg::CullNode>();
+    add<vsg::OcclusionQueryNode>();
     add<vsg::LOD>();
     add<vsg::PagedLOD>();
+    add<vsg::LazyLoadNode>();
+    add<vsg::ImpostorLOD>();
     add<vsg::AbsoluteTransform>();
     add<vsg::MatrixTransform>();
     add<vsg::Geometry>();
@@ -197,6 +203,7 @@ ObjectFactory::ObjectFactory()
     add<vsg::HardShadows>();
     add<vsg::SoftShadows>();
     add<vsg::PercentageCloserSoftShadows>();
+    add<vsg::RayTracedShadows>();
 
     // vulkan objects
     add<vsg::BindGraphicsPipeline>();
@@ -230,8 +237,10 @@ ObjectFactory::ObjectFactory()
     add<vsg::ViewDescriptorSetLayout>();
     add<vsg::DescriptorImage>();
     add<vsg::DescriptorBuffer>();
+    add<vsg::DynamicUniformRing>();
     add<vsg::Sampler>();
     add<vsg::PushConstants>();
+    add<vsg::PushDescriptorSet>();
     add<vsg::ResourceHints>();
     add<vsg::StateSwitch>();
 
@@ -10,6 +10,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/io/CompressionCodec.h>
+#include <vsg/io/DirectoryCache.h>
+#include <vsg/io/ObjectCache.h>
 #include <vsg/io/Options.h>
 #include <vsg/io/ReaderWriter.h>
 #include <vsg/state/DescriptorSetLayout.h>
@@ -39,12 +42,17 @@ Options::Options()
 Options::Options(const Options& options) :
     Inherit(),
     sharedObjects(options.sharedObjects),
+    objectCache(options.objectCache),
     readerWriters(options.readerWriters),
+    readerWriterDispatch(options.readerWriterDispatch),
     operationThreads(options.operationThreads),
     checkFilenameHint(options.checkFilenameHint),
     paths(options.paths),
     findFileCallback(options.findFileCallback),
+    directoryCache(options.directoryCache),
     fileCache(options.fileCache),
+    shaderCacheDirectory(options.shaderCacheDirectory),
+    textureCacheDirectory(options.textureCacheDirectory),
     extensionHint(options.extensionHint),
     mapRGBtoRGBAHint(options.mapRGBtoRGBAHint),
     sceneCoordinateConvention(options.sceneCoordinateConvention),
@@ -53,11 +61,16 @@ Options::Options(const Options& options) :
     inheritedState(options.inheritedState),
     instrumentation(options.instrumentation),
     findDynamicObjects(options.findDynamicObjects),
-    propagateDynamicObjects(options.propagateDynamicObjects)
+    propagateDynamicObjects(options.propagateDynamicObjects),
+    compressionCodec(options.compressionCodec)
 {
     getOrCreateAuxiliary();
     // copy any meta data.
-    if (options.getAuxiliary()) getAuxiliary()->userObjects = options.getAuxiliary()->userObjects;
+    if (options.getAuxiliary())
+    {
+        getAuxiliary()->userObjects = options.getAuxiliary()->userObjects;
+        getAuxiliary()->rebuildTokenObjects();
+    }
 }
 
 Options::~Options()
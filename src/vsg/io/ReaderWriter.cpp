@@ -10,11 +10,21 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/io/AsyncReader.h>
 #include <vsg/io/ReaderWriter.h>
 #include <vsg/utils/CommandLine.h>
 
+#include <cstdio>
+#include <cstring>
+
 using namespace vsg;
 
+void ReaderWriter::readAsync(ref_ptr<ReadRequest> request) const
+{
+    if (!request) return;
+    request->complete(read(request->filename, request->options));
+}
+
 void CompositeReaderWriter::add(ref_ptr<ReaderWriter> reader)
 {
     readerWriters.emplace_back(reader);
@@ -104,3 +114,98 @@ bool CompositeReaderWriter::getFeatures(Features& features) const
     }
     return result;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ReaderWriterDispatch
+//
+ReaderWriterDispatch::ReaderWriterDispatch(const ReaderWriters& in_readerWriters) :
+    readerWriters(in_readerWriters)
+{
+    for (auto& readerWriter : readerWriters)
+    {
+        ReaderWriter::Features features;
+        if (readerWriter->getFeatures(features))
+        {
+            for (auto& [ext, mask] : features.extensionFeatureMap)
+            {
+                // first ReaderWriter advertising an extension wins, matching chain order
+                if ((mask & ReaderWriter::READ_FILENAME) != 0) _extensionMap.emplace(ext, readerWriter);
+            }
+            for (auto& signature : features.signatures)
+            {
+                if (!signature.empty()) _signatures.emplace_back(signature, readerWriter);
+            }
+        }
+    }
+}
+
+ReaderWriterDispatch::~ReaderWriterDispatch()
+{
+}
+
+ref_ptr<Object> ReaderWriterDispatch::read(const Path& filename, ref_ptr<const Options> options) const
+{
+    ref_ptr<ReaderWriter> dispatched;
+
+    auto ext = lowerCaseFileExtension(filename);
+    if (ext)
+    {
+        if (auto itr = _extensionMap.find(ext); itr != _extensionMap.end())
+        {
+            dispatched = itr->second;
+        }
+        else
+        {
+            std::scoped_lock lock(_mutex);
+            if (auto mitr = _memoizedExtensionMap.find(ext); mitr != _memoizedExtensionMap.end()) dispatched = mitr->second;
+        }
+    }
+
+    if (!dispatched && !_signatures.empty())
+    {
+        // identify content from its leading bytes when the extension doesn't dispatch
+        char leading[16] = {};
+        size_t count = 0;
+        if (auto filepath = findFile(filename, options.get()))
+        {
+            if (auto file = vsg::fopen(filepath, "rb"))
+            {
+                count = std::fread(leading, 1, sizeof(leading), file);
+                std::fclose(file);
+            }
+        }
+
+        for (auto& [signature, readerWriter] : _signatures)
+        {
+            if (signature.size() <= count && std::memcmp(signature.data(), leading, signature.size()) == 0)
+            {
+                dispatched = readerWriter;
+                break;
+            }
+        }
+    }
+
+    if (dispatched)
+    {
+        if (auto object = dispatched->read(filename, options)) return object;
+    }
+
+    // fall back to trialling the chain, memoizing which ReaderWriter handles the extension
+    for (auto& readerWriter : readerWriters)
+    {
+        if (readerWriter == dispatched) continue;
+
+        if (auto object = readerWriter->read(filename, options))
+        {
+            if (ext)
+            {
+                std::scoped_lock lock(_mutex);
+                _memoizedExtensionMap[ext] = readerWriter;
+            }
+            return object;
+        }
+    }
+
+    return {};
+}
@@ -0,0 +1,183 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/RetainedTileCache.h>
+#include <vsg/io/VSG.h>
+
+#include <sstream>
+
+using namespace vsg;
+
+RetainedTileCache::RetainedTileCache(std::size_t in_maxRetainedBytes) :
+    maxRetainedBytes(in_maxRetainedBytes)
+{
+    _vsgReaderWriter = VSG::create();
+}
+
+RetainedTileCache::~RetainedTileCache()
+{
+    {
+        std::scoped_lock lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if (_thread.joinable()) _thread.join();
+}
+
+void RetainedTileCache::retain(const Path& filename, ref_ptr<Node> subgraph, ref_ptr<const Options> options, std::size_t bytesHint)
+{
+    if (!subgraph || !filename) return;
+
+    std::scoped_lock lock(_mutex);
+
+    // start the background serialization thread on first use
+    if (!_thread.joinable()) _thread = std::thread([this]() { _run(); });
+
+    auto itr = _entries.find(filename);
+    if (itr != _entries.end())
+    {
+        _retainedBytes -= itr->second.bytes;
+        _lru.erase(itr->second.lruItr);
+    }
+    else
+    {
+        itr = _entries.emplace(filename, Entry{}).first;
+    }
+
+    auto& entry = itr->second;
+    entry.subgraph = subgraph;
+    entry.options = options;
+    entry.blob.clear();
+    entry.bytes = bytesHint;
+    entry.lruItr = _lru.insert(_lru.end(), filename);
+    _retainedBytes += bytesHint;
+
+    _pending.push_back(filename);
+    _evict();
+
+    _cv.notify_one();
+}
+
+ref_ptr<Node> RetainedTileCache::take(const Path& filename)
+{
+    Entry entry;
+    {
+        std::scoped_lock lock(_mutex);
+
+        auto itr = _entries.find(filename);
+        if (itr == _entries.end()) return {};
+
+        entry = std::move(itr->second);
+        _retainedBytes -= entry.bytes;
+        _lru.erase(entry.lruItr);
+        _entries.erase(itr);
+    }
+
+    // tiles the background thread hasn't serialized yet are handed straight back
+    if (entry.subgraph) return entry.subgraph;
+
+    debug("RetainedTileCache::take() deserializing ", filename, ", blob size = ", entry.blob.size());
+
+    auto read_options = entry.options ? Options::create(*entry.options) : Options::create();
+    read_options->extensionHint = ".vsgb";
+    read_options->compressionCodec = codec;
+
+    auto object = _vsgReaderWriter->read(reinterpret_cast<const uint8_t*>(entry.blob.data()), entry.blob.size(), read_options);
+    return object.cast<Node>();
+}
+
+std::size_t RetainedTileCache::retainedBytes() const
+{
+    std::scoped_lock lock(_mutex);
+    return _retainedBytes;
+}
+
+void RetainedTileCache::clear()
+{
+    std::scoped_lock lock(_mutex);
+    _entries.clear();
+    _lru.clear();
+    _pending.clear();
+    _retainedBytes = 0;
+}
+
+void RetainedTileCache::_run()
+{
+    debug("Started RetainedTileCache serialization thread");
+
+    std::unique_lock lock(_mutex);
+    while (true)
+    {
+        _cv.wait(lock, [this]() { return _stop || !_pending.empty(); });
+        if (_stop) break;
+
+        auto filename = _pending.front();
+        _pending.pop_front();
+
+        auto itr = _entries.find(filename);
+        if (itr == _entries.end() || !itr->second.subgraph) continue; // evicted or taken in the meantime
+
+        auto subgraph = itr->second.subgraph;
+        auto tile_options = itr->second.options;
+
+        lock.unlock();
+
+        // serialize outside the lock so retain()/take() calls aren't blocked behind the write
+        auto write_options = tile_options ? Options::create(*tile_options) : Options::create();
+        write_options->extensionHint = ".vsgb";
+        write_options->compressionCodec = codec;
+
+        std::ostringstream ostr(std::ios::out | std::ios::binary);
+        _vsgReaderWriter->write(subgraph, ostr, write_options);
+        auto blob = ostr.str();
+
+        lock.lock();
+
+        itr = _entries.find(filename);
+        if (itr == _entries.end() || itr->second.subgraph != subgraph) continue; // evicted or re-retained while serializing
+
+        if (blob.empty())
+        {
+            warn("RetainedTileCache failed to serialize ", filename);
+            _retainedBytes -= itr->second.bytes;
+            _lru.erase(itr->second.lruItr);
+            _entries.erase(itr);
+            continue;
+        }
+
+        auto& entry = itr->second;
+        entry.subgraph = {};
+        _retainedBytes = _retainedBytes - entry.bytes + blob.size();
+        entry.bytes = blob.size();
+        entry.blob = std::move(blob);
+
+        _evict();
+    }
+
+    debug("Finished RetainedTileCache serialization thread");
+}
+
+void RetainedTileCache::_evict()
+{
+    while (_retainedBytes > maxRetainedBytes && !_lru.empty())
+    {
+        auto itr = _entries.find(_lru.front());
+        if (itr != _entries.end())
+        {
+            debug("RetainedTileCache evicting ", itr->first, ", bytes = ", itr->second.bytes);
+            _retainedBytes -= itr->second.bytes;
+            _entries.erase(itr);
+        }
+        _lru.pop_front();
+    }
+}
@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/BinaryInput.h>
 #include <vsg/io/BinaryOutput.h>
 #include <vsg/io/Logger.h>
+#include <vsg/io/MappedData.h>
+#include <vsg/io/MemoryBinaryInput.h>
 #include <vsg/io/VSG.h>
 #include <vsg/io/mem_stream.h>
 
@@ -100,6 +102,37 @@ vsg::ref_ptr<vsg::Object> VSG::read(const vsg::Path& filename, ref_ptr<const Opt
     vsg::Path filenameToUse = findFile(filename, options);
     if (!filenameToUse) return {};
 
+    if (memoryMapFiles)
+    {
+        if (auto mappedData = MappedData::map(filenameToUse))
+        {
+            mem_stream fin(static_cast<const uint8_t*>(mappedData->constDataPointer()), mappedData->dataSize());
+
+            auto [type, version] = readHeader(fin);
+            if (type == BINARY)
+            {
+                // parse directly from the mapped memory, bypassing the istream/streambuf protocol
+                auto base = static_cast<const uint8_t*>(mappedData->constDataPointer());
+                auto headerSize = static_cast<size_t>(fin.tellg());
+
+                vsg::MemoryBinaryInput input(base + headerSize, mappedData->dataSize() - headerSize, _objectFactory, options, mappedData);
+                input.filename = filenameToUse;
+                input.version = version;
+                return input.readObject("Root");
+            }
+            else if (type == ASCII)
+            {
+                vsg::AsciiInput input(fin, _objectFactory, options);
+                input.filename = filenameToUse;
+                input.version = version;
+                return input.readObject("Root");
+            }
+
+            return {};
+        }
+        // fall through to stream based reading when the file could not be mapped
+    }
+
     std::ifstream fin(filenameToUse, std::ios::in | std::ios::binary);
     if (!fin) return {};
 
@@ -153,7 +186,25 @@ vsg::ref_ptr<vsg::Object> VSG::read(const uint8_t* ptr, size_t size, vsg::ref_pt
     if (options && !compatibleExtension(options, ".vsgb", ".vsgt")) return {};
 
     mem_stream fin(ptr, size);
-    return read(fin, options);
+
+    auto [type, version] = readHeader(fin);
+    if (type == BINARY)
+    {
+        // parse directly from the memory block, bypassing the istream/streambuf protocol
+        auto headerSize = static_cast<size_t>(fin.tellg());
+
+        vsg::MemoryBinaryInput input(ptr + headerSize, size - headerSize, _objectFactory, options);
+        input.version = version;
+        return input.readObject("Root");
+    }
+    else if (type == ASCII)
+    {
+        vsg::AsciiInput input(fin, _objectFactory, options);
+        input.version = version;
+        return input.readObject("Root");
+    }
+
+    return {};
 }
 
 bool VSG::write(const vsg::Object* object, const vsg::Path& filename, ref_ptr<const Options> options) const
@@ -242,5 +293,7 @@ bool VSG::getFeatures(Features& features) const
 {
     features.extensionFeatureMap[".vsgb"] = static_cast<FeatureMask>(READ_FILENAME | READ_ISTREAM | READ_MEMORY | WRITE_FILENAME | WRITE_OSTREAM);
     features.extensionFeatureMap[".vsgt"] = static_cast<FeatureMask>(READ_FILENAME | READ_ISTREAM | READ_MEMORY | WRITE_FILENAME | WRITE_OSTREAM);
+    features.signatures.push_back("#vsga");
+    features.signatures.push_back("#vsgb");
     return true;
 }
@@ -10,6 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/io/ObjectCache.h>
 #include <vsg/io/VSG.h>
 #include <vsg/io/glsl.h>
 #include <vsg/io/read.h>
@@ -21,6 +22,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/utils/PropagateDynamicObjects.h>
 #include <vsg/utils/SharedObjects.h>
 
+#include <mutex>
+
 using namespace vsg;
 
 ref_ptr<Object> vsg::read(const Path& filename, ref_ptr<const Options> options)
@@ -28,6 +31,11 @@ ref_ptr<Object> vsg::read(const Path& filename, ref_ptr<const Options> options)
     CPU_INSTRUMENTATION_L1_NC(options ? options->instrumentation.get() : nullptr, "read", COLOR_READ);
 
     auto read_file = [&]() -> ref_ptr<Object> {
+        if (options && options->readerWriterDispatch)
+        {
+            return options->readerWriterDispatch->read(filename, options);
+        }
+
         if (options && !options->readerWriters.empty())
         {
             for (auto& readerWriter : options->readerWriters)
@@ -67,15 +75,32 @@ ref_ptr<Object> vsg::read(const Path& filename, ref_ptr<const Options> options)
         }
     };
 
+    // consult the ObjectCache before dispatching to the ReaderWriters, so repeated reads of the same
+    // file return the cached instance and concurrent reads collapse into a single load. Cache hits
+    // still pass through the dynamic object duplication below so each caller gets its own copies of
+    // any dynamic state.
+    auto cached_read_file = [&]() -> ref_ptr<Object> {
+        if (options && options->objectCache)
+        {
+            return options->objectCache->getOrLoad(filename, options, read_file);
+        }
+        return read_file();
+    };
+
     if (options && options->sharedObjects && options->sharedObjects->suitable(filename))
     {
         auto loadedObject = LoadedObject::create(filename, options);
 
         options->sharedObjects->share(loadedObject, [&](auto load) {
-            load->object = read_file();
+            load->object = cached_read_file();
 
             if (load->object && options && options->findDynamicObjects && options->propagateDynamicObjects)
             {
+                // the find and propogate visitors on Options are stateful and may be shared between
+                // concurrent reads, so serialize their use.
+                static std::mutex s_dynamicObjectsMutex;
+                std::scoped_lock lock(s_dynamicObjectsMutex);
+
                 // invoke the find and propogate visitiors to collate all the dynamic objects that will need to be cloned.
                 options->findDynamicObjects->dynamicObjects.clear();
                 load->object->accept(*(options->findDynamicObjects));
@@ -105,7 +130,7 @@ ref_ptr<Object> vsg::read(const Path& filename, ref_ptr<const Options> options)
     }
     else
     {
-        return read_file();
+        return cached_read_file();
     }
 }
 
@@ -180,6 +205,21 @@ PathObjects vsg::read(const Paths& filenames, ref_ptr<const Options> options)
     return entries;
 }
 
+PathObjects vsg::readShared(const Paths& filenames, ref_ptr<const Options> options)
+{
+    CPU_INSTRUMENTATION_L1_NC(options ? options->instrumentation.get() : nullptr, "readShared", COLOR_READ);
+
+    // reuse the caller's SharedObjects when assigned, otherwise share a temporary one across the batch
+    if (!options || !options->sharedObjects)
+    {
+        auto batch_options = options ? Options::create(*options) : Options::create();
+        batch_options->sharedObjects = SharedObjects::create();
+        return read(filenames, batch_options);
+    }
+
+    return read(filenames, options);
+}
+
 ref_ptr<Object> vsg::read(std::istream& fin, ref_ptr<const Options> options)
 {
     CPU_INSTRUMENTATION_L1_NC(options ? options->instrumentation.get() : nullptr, "read", COLOR_READ);
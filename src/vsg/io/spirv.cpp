@@ -129,5 +129,6 @@ bool spirv::write(const vsg::Object* object, const vsg::Path& filename, vsg::ref
 bool spirv::getFeatures(Features& features) const
 {
     features.extensionFeatureMap[".spv"] = static_cast<vsg::ReaderWriter::FeatureMask>(vsg::ReaderWriter::READ_FILENAME | vsg::ReaderWriter::WRITE_FILENAME);
+    features.signatures.push_back(std::string("\x03\x02\x23\x07", 4)); // SPIR-V magic number, little endian
     return true;
 }
@@ -34,6 +34,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/RasterizationState.h>
 #include <vsg/state/VertexInputState.h>
 #include <vsg/state/material.h>
+#include <vsg/threading/Latch.h>
 #include <vsg/ui/UIEvent.h>
 #include <vsg/utils/ComputeBounds.h>
 #include <vsg/vk/ResourceRequirements.h>
@@ -137,7 +138,59 @@ vsg::ref_ptr<vsg::Object> tile::read(const vsg::Path& filename, vsg::ref_ptr<con
 
         vsg::debug("read(", filename, ") -> tile_info = ", tile_info, ", x = ", x, ", y = ", y, ", z = ", lod, ", tile = ", this, ", settings =  ", settings);
 
-        return read_subtile(x, y, lod, options);
+        // check the cache first so revisiting an area reattaches recently expired tiles rather than reloading them
+        if (settings->tileCacheByteLimit > 0)
+        {
+            if (auto cached = _getCachedTile(filename))
+            {
+                std::scoped_lock<std::mutex> lock(statsMutex);
+                numTilesFromCache += 1;
+                return cached;
+            }
+        }
+
+        uint64_t estimatedBytes = 0;
+        auto subtile = read_subtile(x, y, lod, options, estimatedBytes);
+
+        if (settings->tileCacheByteLimit > 0 && subtile && !subtile.cast<vsg::ReadError>())
+        {
+            _addToCache(filename, subtile, estimatedBytes);
+        }
+
+        return subtile;
+    }
+}
+
+vsg::ref_ptr<vsg::Object> tile::_getCachedTile(const vsg::Path& filename) const
+{
+    std::scoped_lock<std::mutex> lock(_cacheMutex);
+
+    auto itr = _tileCache.find(filename);
+    if (itr == _tileCache.end()) return {};
+
+    // move the entry to the front of the most recently used list
+    _cacheMRU.splice(_cacheMRU.begin(), _cacheMRU, itr->second.mru_itr);
+
+    return itr->second.object;
+}
+
+void tile::_addToCache(const vsg::Path& filename, vsg::ref_ptr<vsg::Object> object, uint64_t bytes) const
+{
+    std::scoped_lock<std::mutex> lock(_cacheMutex);
+
+    if (_tileCache.count(filename) != 0) return;
+
+    _cacheMRU.push_front(filename);
+    _tileCache[filename] = CacheEntry{object, bytes, _cacheMRU.begin()};
+    _cacheTotalBytes += bytes;
+
+    // evict the least recently used tiles until back under budget, always keeping the newest entry
+    while (_cacheTotalBytes > settings->tileCacheByteLimit && _cacheMRU.size() > 1)
+    {
+        auto tail = _tileCache.find(_cacheMRU.back());
+        _cacheTotalBytes -= tail->second.bytes;
+        _tileCache.erase(tail);
+        _cacheMRU.pop_back();
     }
 }
 
@@ -202,7 +255,7 @@ vsg::ref_ptr<vsg::Object> tile::read_root(vsg::ref_ptr<const vsg::Options> optio
     return group;
 }
 
-vsg::ref_ptr<vsg::Object> tile::read_subtile(uint32_t x, uint32_t y, uint32_t lod, vsg::ref_ptr<const vsg::Options> options) const
+vsg::ref_ptr<vsg::Object> tile::read_subtile(uint32_t x, uint32_t y, uint32_t lod, vsg::ref_ptr<const vsg::Options> options, uint64_t& estimatedBytes) const
 {
     CPU_INSTRUMENTATION_L2_NC(options ? options->instrumentation.get() : nullptr, "tile read_subtile", COLOR_READ);
 
@@ -235,46 +288,119 @@ vsg::ref_ptr<vsg::Object> tile::read_subtile(uint32_t x, uint32_t y, uint32_t lo
         }
     }
 
-    auto pathObjects = vsg::read(tiles, options);
+    // issue the subtile fetches/decodes concurrently so the per tile latency approaches the slowest
+    // fetch rather than the sum of all four, using the internal load threads unless the caller has
+    // already assigned their own operationThreads for vsg::read() to distribute the reads across.
+    auto load_options = options;
+    if (_loadThreads && (!options || !options->operationThreads))
+    {
+        auto threaded_options = options ? vsg::Options::create(*options) : vsg::Options::create();
+        threaded_options->operationThreads = _loadThreads;
+        load_options = threaded_options;
+    }
+
+    auto pathObjects = vsg::read(tiles, load_options);
 
     if (pathObjects.size() == 4)
     {
+        struct Subtile
+        {
+            TileID tileID;
+            vsg::ref_ptr<vsg::Data> imageTile;
+            vsg::ref_ptr<vsg::Node> node;
+            vsg::dsphere bound;
+        };
+
+        std::vector<Subtile> subtiles;
+        subtiles.reserve(pathObjects.size());
         for (auto& [tilePath, object] : pathObjects)
         {
-            auto imageTile = object.cast<vsg::Data>();
-            if (imageTile)
+            if (auto imageTile = object.cast<vsg::Data>())
             {
-                auto& tileID = pathToTileID[tilePath];
-                auto tile_extents = computeTileExtents(tileID.local_x, tileID.local_y, local_lod);
-                auto tile_node = createTile(tile_extents, imageTile);
-                if (tile_node)
+                subtiles.push_back(Subtile{pathToTileID[tilePath], imageTile, {}, {}});
+            }
+        }
+
+        // local operation that builds the geometry and bound of a single subtile
+        struct AssembleOperation : public Operation
+        {
+            AssembleOperation(const tile* t, Subtile& s, uint32_t lvl, ref_ptr<Latch> l) :
+                tileReader(t),
+                subtile(s),
+                level(lvl),
+                latch(l) {}
+
+            void run() override
+            {
+                auto tile_extents = tileReader->computeTileExtents(subtile.tileID.local_x, subtile.tileID.local_y, level);
+                subtile.node = tileReader->createTile(tile_extents, subtile.imageTile);
+                if (subtile.node)
                 {
                     vsg::ComputeBounds computeBound;
-                    tile_node->accept(computeBound);
+                    subtile.node->accept(computeBound);
                     auto& bb = computeBound.bounds;
-                    vsg::dsphere bound((bb.min.x + bb.max.x) * 0.5, (bb.min.y + bb.max.y) * 0.5, (bb.min.z + bb.max.z) * 0.5, vsg::length(bb.max - bb.min) * 0.5);
+                    subtile.bound = vsg::dsphere((bb.min.x + bb.max.x) * 0.5, (bb.min.y + bb.max.y) * 0.5, (bb.min.z + bb.max.z) * 0.5, vsg::length(bb.max - bb.min) * 0.5);
+                }
+                if (latch) latch->count_down();
+            }
+
+            const tile* tileReader;
+            Subtile& subtile;
+            uint32_t level;
+            ref_ptr<Latch> latch;
+        };
 
-                    if (local_lod < settings->maxLevel)
-                    {
-                        auto plod = vsg::PagedLOD::create();
-                        plod->bound = bound;
-                        plod->children[0] = vsg::PagedLOD::Child{settings->lodTransitionScreenHeightRatio, {}}; // external child visible when its bound occupies more than 1/4 of the height of the window
-                        plod->children[1] = vsg::PagedLOD::Child{0.0, tile_node};                               // visible always
-                        plod->filename = vsg::make_string(tileID.local_x, " ", tileID.local_y, " ", local_lod, ".tile");
-                        plod->options = Options::create_if(options, *options);
-
-                        vsg::debug("plod->filename ", plod->filename);
-
-                        group->addChild(plod);
-                    }
-                    else
-                    {
-                        auto cullGroup = vsg::CullGroup::create();
-                        cullGroup->bound = bound;
-                        cullGroup->addChild(tile_node);
-
-                        group->addChild(cullGroup);
-                    }
+        if (_loadThreads && subtiles.size() > 1)
+        {
+            // assemble the subtile geometry in parallel, helping out and joining before moving on
+            auto latch = Latch::create(static_cast<int>(subtiles.size()));
+            for (auto& subtile : subtiles)
+            {
+                _loadThreads->add(ref_ptr<Operation>(new AssembleOperation(this, subtile, local_lod, latch)));
+            }
+
+            _loadThreads->run();
+            latch->wait();
+        }
+        else
+        {
+            for (auto& subtile : subtiles)
+            {
+                AssembleOperation(this, subtile, local_lod, {}).run();
+            }
+        }
+
+        for (auto& subtile : subtiles)
+        {
+            // estimate of the memory retained by the subtile for the tile cache accounting,
+            // the decoded image plus the generated grid of vertices, normals, texcoords and indices
+            estimatedBytes += subtile.imageTile->dataSize() + 48 * 1024;
+
+            auto& tileID = subtile.tileID;
+            auto& tile_node = subtile.node;
+            auto& bound = subtile.bound;
+            if (tile_node)
+            {
+                if (local_lod < settings->maxLevel)
+                {
+                    auto plod = vsg::PagedLOD::create();
+                    plod->bound = bound;
+                    plod->children[0] = vsg::PagedLOD::Child{settings->lodTransitionScreenHeightRatio, {}}; // external child visible when its bound occupies more than 1/4 of the height of the window
+                    plod->children[1] = vsg::PagedLOD::Child{0.0, tile_node};                               // visible always
+                    plod->filename = vsg::make_string(tileID.local_x, " ", tileID.local_y, " ", local_lod, ".tile");
+                    plod->options = Options::create_if(options, *options);
+
+                    vsg::debug("plod->filename ", plod->filename);
+
+                    group->addChild(plod);
+                }
+                else
+                {
+                    auto cullGroup = vsg::CullGroup::create();
+                    cullGroup->bound = bound;
+                    cullGroup->addChild(tile_node);
+
+                    group->addChild(cullGroup);
                 }
             }
         }
@@ -302,6 +428,12 @@ void tile::init(vsg::ref_ptr<const vsg::Options> options)
 {
     CPU_INSTRUMENTATION_L2_NC(options ? options->instrumentation.get() : nullptr, "tile init", COLOR_READ);
 
+    // threads used to fetch, decode and assemble the subtiles of each tile concurrently
+    if (settings->concurrentLoadThreads > 0)
+    {
+        _loadThreads = OperationThreads::create(settings->concurrentLoadThreads);
+    }
+
     if (settings->shaderSet)
     {
         _shaderSet = settings->shaderSet;
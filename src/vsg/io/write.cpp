@@ -14,8 +14,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/glsl.h>
 #include <vsg/io/spirv.h>
 #include <vsg/io/write.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/FindDynamicObjects.h>
+#include <vsg/utils/PropagateDynamicObjects.h>
 #include <vsg/utils/SharedObjects.h>
 
+#include <mutex>
+
 using namespace vsg;
 
 bool vsg::write(ref_ptr<Object> object, const Path& filename, ref_ptr<const Options> options)
@@ -66,3 +71,98 @@ bool vsg::write(ref_ptr<Object> object, const Path& filename, ref_ptr<const Opti
 
     return fileWritten;
 }
+
+namespace
+{
+    struct AsyncWriteOperation : public Inherit<Operation, AsyncWriteOperation>
+    {
+        AsyncWriteOperation(ref_ptr<Object> in_object, const Path& in_filename, ref_ptr<const Options> in_options, ref_ptr<AsyncWrite> in_result) :
+            object(in_object),
+            filename(in_filename),
+            options(in_options),
+            result(in_result) {}
+
+        ref_ptr<Object> object;
+        Path filename;
+        ref_ptr<const Options> options;
+        ref_ptr<AsyncWrite> result;
+
+        void run() override
+        {
+            result->fileWritten = vsg::write(object, filename, options);
+            result->latch->count_down();
+        }
+    };
+
+    // snapshot the dynamic parts of a subgraph so the caller can continue updating it while the write proceeds.
+    ref_ptr<Object> snapshotDynamicObjects(ref_ptr<Object> object, ref_ptr<const Options> options)
+    {
+        std::set<const Object*> dynamicObjects;
+
+        if (options && options->findDynamicObjects && options->propagateDynamicObjects)
+        {
+            // the find and propogate visitors on Options are stateful and may be shared between
+            // concurrent reads and writes, so serialize their use.
+            static std::mutex s_dynamicObjectsMutex;
+            std::scoped_lock lock(s_dynamicObjectsMutex);
+
+            options->findDynamicObjects->dynamicObjects.clear();
+            object->accept(*(options->findDynamicObjects));
+
+            options->propagateDynamicObjects->dynamicObjects.swap(options->findDynamicObjects->dynamicObjects);
+            object->accept(*(options->propagateDynamicObjects));
+
+            dynamicObjects.swap(options->propagateDynamicObjects->dynamicObjects);
+        }
+        else
+        {
+            auto findDynamicObjects = FindDynamicObjects::create();
+            object->accept(*findDynamicObjects);
+
+            auto propagateDynamicObjects = PropagateDynamicObjects::create();
+            propagateDynamicObjects->dynamicObjects.swap(findDynamicObjects->dynamicObjects);
+            object->accept(*propagateDynamicObjects);
+
+            dynamicObjects.swap(propagateDynamicObjects->dynamicObjects);
+        }
+
+        if (dynamicObjects.empty()) return object;
+
+        vsg::CopyOp copyop;
+        copyop.copyOnWriteData = true;
+        auto duplicate = copyop.duplicate = new vsg::Duplicate;
+        for (auto& dynamicObject : dynamicObjects)
+        {
+            duplicate->insert(dynamicObject);
+        }
+
+        return copyop(object);
+    }
+} // namespace
+
+ref_ptr<AsyncWrite> vsg::writeAsync(ref_ptr<Object> object, const Path& filename, ref_ptr<const Options> options)
+{
+    CPU_INSTRUMENTATION_L1_NC(options ? options->instrumentation.get() : nullptr, "writeAsync", COLOR_WRITE);
+
+    auto result = AsyncWrite::create();
+
+    // clone the dynamic parts of the subgraph, using copy-on-write Data so that unmodified
+    // arrays are aliased rather than copied, leaving the snapshot cheap to take.
+    ref_ptr<Object> snapshot = object ? snapshotDynamicObjects(object, options) : object;
+
+    ref_ptr<OperationThreads> operationThreads;
+    if (options) operationThreads = options->operationThreads;
+
+    if (operationThreads)
+    {
+        operationThreads->add(AsyncWriteOperation::create(snapshot, filename, options, result));
+    }
+    else
+    {
+        // no threads available so carry out the write on the caller's thread before returning.
+        result->fileWritten = vsg::write(snapshot, filename, options);
+        result->latch->count_down();
+    }
+
+    return result;
+}
@@ -23,7 +23,11 @@ ShadowSettings::ShadowSettings(uint32_t in_shadowMapCount) :
 
 ShadowSettings::ShadowSettings(const ShadowSettings& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
-    shadowMapCount(rhs.shadowMapCount)
+    shadowMapCount(rhs.shadowMapCount),
+    cacheShadowMaps(rhs.cacheShadowMaps),
+    castShadowMask(rhs.castShadowMask),
+    lodScale(rhs.lodScale),
+    minimumShadowCasterSizeInPixels(rhs.minimumShadowCasterSizeInPixels)
 {
 }
 
@@ -33,15 +37,35 @@ int ShadowSettings::compare(const Object& rhs_object) const
     if (result != 0) return result;
 
     auto& rhs = static_cast<decltype(*this)>(rhs_object);
-    return compare_value(shadowMapCount, rhs.shadowMapCount);
+    if ((result = compare_value(shadowMapCount, rhs.shadowMapCount))) return result;
+    if ((result = compare_value(cacheShadowMaps, rhs.cacheShadowMaps))) return result;
+    if ((result = compare_value(castShadowMask, rhs.castShadowMask))) return result;
+    if ((result = compare_value(lodScale, rhs.lodScale))) return result;
+    return compare_value(minimumShadowCasterSizeInPixels, rhs.minimumShadowCasterSizeInPixels);
 }
 
 void ShadowSettings::read(Input& input)
 {
     input.read("shadowMapCount", shadowMapCount);
+
+    if (input.version_greater_equal(1, 1, 5))
+    {
+        input.read("cacheShadowMaps", cacheShadowMaps);
+        input.read("castShadowMask", castShadowMask);
+        input.read("lodScale", lodScale);
+        input.read("minimumShadowCasterSizeInPixels", minimumShadowCasterSizeInPixels);
+    }
 }
 
 void ShadowSettings::write(Output& output) const
 {
     output.write("shadowMapCount", shadowMapCount);
+
+    if (output.version_greater_equal(1, 1, 5))
+    {
+        output.write("cacheShadowMaps", cacheShadowMaps);
+        output.write("castShadowMask", castShadowMask);
+        output.write("lodScale", lodScale);
+        output.write("minimumShadowCasterSizeInPixels", minimumShadowCasterSizeInPixels);
+    }
 }
@@ -0,0 +1,208 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/quat.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace vsg;
+
+namespace
+{
+
+#if defined(__AVX__) || defined(__SSE2__)
+
+    inline float horizontal_sum(__m128 v)
+    {
+        __m128 sum = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+        return _mm_cvtss_f32(sum);
+    }
+
+    template<class Ratio>
+    void nlerp_impl(size_t count, const quat* from, const quat* to, Ratio ratio, quat* result)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            __m128 f = _mm_loadu_ps(from[i].data());
+            __m128 t = _mm_loadu_ps(to[i].data());
+
+            // hemisphere correction so each pair interpolates along the shorter arc
+            if (horizontal_sum(_mm_mul_ps(f, t)) < 0.0f) t = _mm_sub_ps(_mm_setzero_ps(), t);
+
+            float r = ratio(i);
+            __m128 v = _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(1.0f - r)), _mm_mul_ps(t, _mm_set1_ps(r)));
+
+            float inverse_len = 1.0f / std::sqrt(horizontal_sum(_mm_mul_ps(v, v)));
+            _mm_storeu_ps(result[i].data(), _mm_mul_ps(v, _mm_set1_ps(inverse_len)));
+        }
+    }
+
+    template<class Ratio>
+    void slerp_impl(size_t count, const quat* from, const quat* to, Ratio ratio, quat* result)
+    {
+        const float epsilon = std::numeric_limits<float>::epsilon();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            __m128 f = _mm_loadu_ps(from[i].data());
+            __m128 t = _mm_loadu_ps(to[i].data());
+
+            float cosomega = horizontal_sum(_mm_mul_ps(f, t));
+            if (cosomega < 0.0f)
+            {
+                cosomega = -cosomega;
+                t = _mm_sub_ps(_mm_setzero_ps(), t);
+            }
+
+            float r = ratio(i);
+            float scale_from, scale_to;
+            if ((1.0f - cosomega) > epsilon)
+            {
+                float omega = std::acos(cosomega);
+                float sinomega = std::sin(omega);
+                scale_from = std::sin((1.0f - r) * omega) / sinomega;
+                scale_to = std::sin(r * omega) / sinomega;
+            }
+            else
+            {
+                // quaternions are very close so just linearly interpolate
+                scale_from = 1.0f - r;
+                scale_to = r;
+            }
+
+            __m128 v = _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(scale_from)), _mm_mul_ps(t, _mm_set1_ps(scale_to)));
+            _mm_storeu_ps(result[i].data(), v);
+        }
+    }
+
+#elif defined(__ARM_NEON)
+
+    inline float horizontal_sum(float32x4_t v)
+    {
+#    if defined(__aarch64__)
+        return vaddvq_f32(v);
+#    else
+        float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+        sum = vpadd_f32(sum, sum);
+        return vget_lane_f32(sum, 0);
+#    endif
+    }
+
+    template<class Ratio>
+    void nlerp_impl(size_t count, const quat* from, const quat* to, Ratio ratio, quat* result)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            float32x4_t f = vld1q_f32(from[i].data());
+            float32x4_t t = vld1q_f32(to[i].data());
+
+            // hemisphere correction so each pair interpolates along the shorter arc
+            if (horizontal_sum(vmulq_f32(f, t)) < 0.0f) t = vnegq_f32(t);
+
+            float r = ratio(i);
+            float32x4_t v = vmlaq_n_f32(vmulq_n_f32(f, 1.0f - r), t, r);
+
+            float inverse_len = 1.0f / std::sqrt(horizontal_sum(vmulq_f32(v, v)));
+            vst1q_f32(result[i].data(), vmulq_n_f32(v, inverse_len));
+        }
+    }
+
+    template<class Ratio>
+    void slerp_impl(size_t count, const quat* from, const quat* to, Ratio ratio, quat* result)
+    {
+        const float epsilon = std::numeric_limits<float>::epsilon();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            float32x4_t f = vld1q_f32(from[i].data());
+            float32x4_t t = vld1q_f32(to[i].data());
+
+            float cosomega = horizontal_sum(vmulq_f32(f, t));
+            if (cosomega < 0.0f)
+            {
+                cosomega = -cosomega;
+                t = vnegq_f32(t);
+            }
+
+            float r = ratio(i);
+            float scale_from, scale_to;
+            if ((1.0f - cosomega) > epsilon)
+            {
+                float omega = std::acos(cosomega);
+                float sinomega = std::sin(omega);
+                scale_from = std::sin((1.0f - r) * omega) / sinomega;
+                scale_to = std::sin(r * omega) / sinomega;
+            }
+            else
+            {
+                // quaternions are very close so just linearly interpolate
+                scale_from = 1.0f - r;
+                scale_to = r;
+            }
+
+            float32x4_t v = vmlaq_n_f32(vmulq_n_f32(f, scale_from), t, scale_to);
+            vst1q_f32(result[i].data(), v);
+        }
+    }
+
+#else
+
+    template<class Ratio>
+    void nlerp_impl(size_t count, const quat* from, const quat* to, Ratio ratio, quat* result)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            quat f = from[i];
+            quat t = to[i];
+
+            // hemisphere correction so each pair interpolates along the shorter arc
+            if (dot(f, t) < 0.0f) t = t * -1.0f;
+
+            float r = ratio(i);
+            result[i] = normalize((f * (1.0f - r)) + (t * r));
+        }
+    }
+
+    template<class Ratio>
+    void slerp_impl(size_t count, const quat* from, const quat* to, Ratio ratio, quat* result)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            result[i] = mix(from[i], to[i], ratio(i));
+        }
+    }
+
+#endif
+
+} // namespace
+
+void vsg::nlerp(size_t count, const quat* from, const quat* to, const float* r, quat* result)
+{
+    nlerp_impl(count, from, to, [r](size_t i) { return r[i]; }, result);
+}
+
+void vsg::nlerp(size_t count, const quat* from, const quat* to, float r, quat* result)
+{
+    nlerp_impl(count, from, to, [r](size_t) { return r; }, result);
+}
+
+void vsg::slerp(size_t count, const quat* from, const quat* to, const float* r, quat* result)
+{
+    slerp_impl(count, from, to, [r](size_t i) { return r[i]; }, result);
+}
+
+void vsg::slerp(size_t count, const quat* from, const quat* to, float r, quat* result)
+{
+    slerp_impl(count, from, to, [r](size_t) { return r; }, result);
+}
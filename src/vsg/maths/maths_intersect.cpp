@@ -0,0 +1,188 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/plane.h>
+
+#if defined(__AVX__)
+#    include <immintrin.h>
+#elif defined(__SSE2__)
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace vsg;
+
+namespace
+{
+    /// scalar fallback used for platforms without SIMD support and for the tail of batches that don't fill a full SIMD width
+    template<typename T>
+    void t_intersect(const t_plane<T>* planes, std::size_t numPlanes, const t_sphere<T>* spheres, uint8_t* results, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            results[i] = intersect(planes, planes + numPlanes, spheres[i]) ? 1 : 0;
+        }
+    }
+} // namespace
+
+void vsg::intersect(const plane* planes, std::size_t numPlanes, const sphere* spheres, uint8_t* results, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if defined(__AVX__) || defined(__SSE2__)
+    for (; i + 4 <= count; i += 4)
+    {
+        // transpose the (x, y, z, radius) of the next four spheres into structure of arrays form
+        __m128 x = _mm_loadu_ps(spheres[i].value);
+        __m128 y = _mm_loadu_ps(spheres[i + 1].value);
+        __m128 z = _mm_loadu_ps(spheres[i + 2].value);
+        __m128 radius = _mm_loadu_ps(spheres[i + 3].value);
+        _MM_TRANSPOSE4_PS(x, y, z, radius);
+
+        __m128 negative_radius = _mm_sub_ps(_mm_setzero_ps(), radius);
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (std::size_t p = 0; p < numPlanes; ++p)
+        {
+            const auto& face = planes[p];
+            __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(face[0]), x),
+                                             _mm_mul_ps(_mm_set1_ps(face[1]), y)),
+                                  _mm_add_ps(_mm_mul_ps(_mm_set1_ps(face[2]), z),
+                                             _mm_set1_ps(face[3])));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(d, negative_radius));
+        }
+
+        int mask = _mm_movemask_ps(inside);
+        results[i] = (mask & 1) ? 1 : 0;
+        results[i + 1] = (mask & 2) ? 1 : 0;
+        results[i + 2] = (mask & 4) ? 1 : 0;
+        results[i + 3] = (mask & 8) ? 1 : 0;
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 4 <= count; i += 4)
+    {
+        // de-interleave the (x, y, z, radius) of the next four spheres into structure of arrays form
+        float32x4x4_t soa = vld4q_f32(spheres[i].value);
+        float32x4_t negative_radius = vnegq_f32(soa.val[3]);
+
+        uint32x4_t inside = vdupq_n_u32(~0u);
+        for (std::size_t p = 0; p < numPlanes; ++p)
+        {
+            const auto& face = planes[p];
+            float32x4_t d = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(face[3]), soa.val[2], face[2]), soa.val[1], face[1]), soa.val[0], face[0]);
+            inside = vandq_u32(inside, vcgeq_f32(d, negative_radius));
+        }
+
+        results[i] = vgetq_lane_u32(inside, 0) ? 1 : 0;
+        results[i + 1] = vgetq_lane_u32(inside, 1) ? 1 : 0;
+        results[i + 2] = vgetq_lane_u32(inside, 2) ? 1 : 0;
+        results[i + 3] = vgetq_lane_u32(inside, 3) ? 1 : 0;
+    }
+#endif
+
+    t_intersect(planes, numPlanes, spheres + i, results + i, count - i);
+}
+
+void vsg::intersect(const dplane* planes, std::size_t numPlanes, const dsphere* spheres, uint8_t* results, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if defined(__AVX__)
+    for (; i + 4 <= count; i += 4)
+    {
+        // transpose the (x, y, z, radius) of the next four spheres into structure of arrays form
+        __m256d s0 = _mm256_loadu_pd(spheres[i].value);
+        __m256d s1 = _mm256_loadu_pd(spheres[i + 1].value);
+        __m256d s2 = _mm256_loadu_pd(spheres[i + 2].value);
+        __m256d s3 = _mm256_loadu_pd(spheres[i + 3].value);
+        __m256d t0 = _mm256_unpacklo_pd(s0, s1);
+        __m256d t1 = _mm256_unpackhi_pd(s0, s1);
+        __m256d t2 = _mm256_unpacklo_pd(s2, s3);
+        __m256d t3 = _mm256_unpackhi_pd(s2, s3);
+        __m256d x = _mm256_permute2f128_pd(t0, t2, 0x20);
+        __m256d y = _mm256_permute2f128_pd(t1, t3, 0x20);
+        __m256d z = _mm256_permute2f128_pd(t0, t2, 0x31);
+        __m256d negative_radius = _mm256_sub_pd(_mm256_setzero_pd(), _mm256_permute2f128_pd(t1, t3, 0x31));
+
+        __m256d inside = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        for (std::size_t p = 0; p < numPlanes; ++p)
+        {
+            const auto& face = planes[p];
+            __m256d d = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(face[0]), x),
+                                                    _mm256_mul_pd(_mm256_set1_pd(face[1]), y)),
+                                      _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(face[2]), z),
+                                                    _mm256_set1_pd(face[3])));
+            inside = _mm256_and_pd(inside, _mm256_cmp_pd(d, negative_radius, _CMP_GE_OQ));
+        }
+
+        int mask = _mm256_movemask_pd(inside);
+        results[i] = (mask & 1) ? 1 : 0;
+        results[i + 1] = (mask & 2) ? 1 : 0;
+        results[i + 2] = (mask & 4) ? 1 : 0;
+        results[i + 3] = (mask & 8) ? 1 : 0;
+    }
+#elif defined(__SSE2__)
+    for (; i + 2 <= count; i += 2)
+    {
+        // transpose the (x, y, z, radius) of the next two spheres into structure of arrays form
+        __m128d a0 = _mm_loadu_pd(spheres[i].value);
+        __m128d a1 = _mm_loadu_pd(spheres[i].value + 2);
+        __m128d b0 = _mm_loadu_pd(spheres[i + 1].value);
+        __m128d b1 = _mm_loadu_pd(spheres[i + 1].value + 2);
+        __m128d x = _mm_unpacklo_pd(a0, b0);
+        __m128d y = _mm_unpackhi_pd(a0, b0);
+        __m128d z = _mm_unpacklo_pd(a1, b1);
+        __m128d negative_radius = _mm_sub_pd(_mm_setzero_pd(), _mm_unpackhi_pd(a1, b1));
+
+        __m128d inside = _mm_castsi128_pd(_mm_set1_epi32(-1));
+        for (std::size_t p = 0; p < numPlanes; ++p)
+        {
+            const auto& face = planes[p];
+            __m128d d = _mm_add_pd(_mm_add_pd(_mm_mul_pd(_mm_set1_pd(face[0]), x),
+                                              _mm_mul_pd(_mm_set1_pd(face[1]), y)),
+                                   _mm_add_pd(_mm_mul_pd(_mm_set1_pd(face[2]), z),
+                                              _mm_set1_pd(face[3])));
+            inside = _mm_and_pd(inside, _mm_cmpge_pd(d, negative_radius));
+        }
+
+        int mask = _mm_movemask_pd(inside);
+        results[i] = (mask & 1) ? 1 : 0;
+        results[i + 1] = (mask & 2) ? 1 : 0;
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 2 <= count; i += 2)
+    {
+        // zip the (x, y, z, radius) of the next two spheres into structure of arrays form
+        float64x2_t a0 = vld1q_f64(spheres[i].value);
+        float64x2_t a1 = vld1q_f64(spheres[i].value + 2);
+        float64x2_t b0 = vld1q_f64(spheres[i + 1].value);
+        float64x2_t b1 = vld1q_f64(spheres[i + 1].value + 2);
+        float64x2_t x = vzip1q_f64(a0, b0);
+        float64x2_t y = vzip2q_f64(a0, b0);
+        float64x2_t z = vzip1q_f64(a1, b1);
+        float64x2_t negative_radius = vnegq_f64(vzip2q_f64(a1, b1));
+
+        uint64x2_t inside = vdupq_n_u64(~0ull);
+        for (std::size_t p = 0; p < numPlanes; ++p)
+        {
+            const auto& face = planes[p];
+            float64x2_t d = vfmaq_f64(vfmaq_f64(vfmaq_f64(vdupq_n_f64(face[3]), vdupq_n_f64(face[2]), z), vdupq_n_f64(face[1]), y), vdupq_n_f64(face[0]), x);
+            inside = vandq_u64(inside, vcgeq_f64(d, negative_radius));
+        }
+
+        results[i] = vgetq_lane_u64(inside, 0) ? 1 : 0;
+        results[i + 1] = vgetq_lane_u64(inside, 1) ? 1 : 0;
+    }
+#endif
+
+    t_intersect(planes, numPlanes, spheres + i, results + i, count - i);
+}
@@ -368,6 +368,159 @@ dsphere vsg::computeFrustumBound(const dmat4& m)
     return t_computeFrustumBound<double>(m);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// batch transform
+//
+template<class M, class V>
+void t_transform(const M& matrix, const V* src, V* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dst[i] = matrix * src[i];
+    }
+}
+
+#if defined(__AVX__) || defined(__SSE2__)
+
+void vsg::transform(const mat4& matrix, const vec3* src, vec3* dst, size_t count)
+{
+    const __m128 c0 = _mm_loadu_ps(matrix.value[0].data());
+    const __m128 c1 = _mm_loadu_ps(matrix.value[1].data());
+    const __m128 c2 = _mm_loadu_ps(matrix.value[2].data());
+    const __m128 c3 = _mm_loadu_ps(matrix.value[3].data());
+
+    alignas(16) float v[4];
+    for (size_t i = 0; i < count; ++i)
+    {
+        __m128 p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(src[i].x)),
+                                         _mm_mul_ps(c1, _mm_set1_ps(src[i].y))),
+                              _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(src[i].z)), c3));
+        _mm_store_ps(v, p);
+        float inv = 1.0f / v[3];
+        dst[i].set(v[0] * inv, v[1] * inv, v[2] * inv);
+    }
+}
+
+void vsg::transform(const mat4& matrix, const vec4* src, vec4* dst, size_t count)
+{
+    const __m128 c0 = _mm_loadu_ps(matrix.value[0].data());
+    const __m128 c1 = _mm_loadu_ps(matrix.value[1].data());
+    const __m128 c2 = _mm_loadu_ps(matrix.value[2].data());
+    const __m128 c3 = _mm_loadu_ps(matrix.value[3].data());
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        __m128 p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(src[i].x)),
+                                         _mm_mul_ps(c1, _mm_set1_ps(src[i].y))),
+                              _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(src[i].z)),
+                                         _mm_mul_ps(c3, _mm_set1_ps(src[i].w))));
+        _mm_storeu_ps(dst[i].data(), p);
+    }
+}
+
+#elif defined(__ARM_NEON)
+
+void vsg::transform(const mat4& matrix, const vec3* src, vec3* dst, size_t count)
+{
+    const float32x4_t c0 = vld1q_f32(matrix.value[0].data());
+    const float32x4_t c1 = vld1q_f32(matrix.value[1].data());
+    const float32x4_t c2 = vld1q_f32(matrix.value[2].data());
+    const float32x4_t c3 = vld1q_f32(matrix.value[3].data());
+
+    alignas(16) float v[4];
+    for (size_t i = 0; i < count; ++i)
+    {
+        float32x4_t p = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(c3, c0, src[i].x), c1, src[i].y), c2, src[i].z);
+        vst1q_f32(v, p);
+        float inv = 1.0f / v[3];
+        dst[i].set(v[0] * inv, v[1] * inv, v[2] * inv);
+    }
+}
+
+void vsg::transform(const mat4& matrix, const vec4* src, vec4* dst, size_t count)
+{
+    const float32x4_t c0 = vld1q_f32(matrix.value[0].data());
+    const float32x4_t c1 = vld1q_f32(matrix.value[1].data());
+    const float32x4_t c2 = vld1q_f32(matrix.value[2].data());
+    const float32x4_t c3 = vld1q_f32(matrix.value[3].data());
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        float32x4_t p = vmulq_n_f32(c0, src[i].x);
+        p = vmlaq_n_f32(p, c1, src[i].y);
+        p = vmlaq_n_f32(p, c2, src[i].z);
+        p = vmlaq_n_f32(p, c3, src[i].w);
+        vst1q_f32(dst[i].data(), p);
+    }
+}
+
+#else
+
+void vsg::transform(const mat4& matrix, const vec3* src, vec3* dst, size_t count)
+{
+    t_transform(matrix, src, dst, count);
+}
+
+void vsg::transform(const mat4& matrix, const vec4* src, vec4* dst, size_t count)
+{
+    t_transform(matrix, src, dst, count);
+}
+
+#endif
+
+#if defined(__AVX__)
+
+void vsg::transform(const dmat4& matrix, const dvec3* src, dvec3* dst, size_t count)
+{
+    const __m256d c0 = _mm256_loadu_pd(matrix.value[0].data());
+    const __m256d c1 = _mm256_loadu_pd(matrix.value[1].data());
+    const __m256d c2 = _mm256_loadu_pd(matrix.value[2].data());
+    const __m256d c3 = _mm256_loadu_pd(matrix.value[3].data());
+
+    alignas(32) double v[4];
+    for (size_t i = 0; i < count; ++i)
+    {
+        __m256d p = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(c0, _mm256_set1_pd(src[i].x)),
+                                                _mm256_mul_pd(c1, _mm256_set1_pd(src[i].y))),
+                                  _mm256_add_pd(_mm256_mul_pd(c2, _mm256_set1_pd(src[i].z)), c3));
+        _mm256_store_pd(v, p);
+        double inv = 1.0 / v[3];
+        dst[i].set(v[0] * inv, v[1] * inv, v[2] * inv);
+    }
+}
+
+void vsg::transform(const dmat4& matrix, const dvec4* src, dvec4* dst, size_t count)
+{
+    const __m256d c0 = _mm256_loadu_pd(matrix.value[0].data());
+    const __m256d c1 = _mm256_loadu_pd(matrix.value[1].data());
+    const __m256d c2 = _mm256_loadu_pd(matrix.value[2].data());
+    const __m256d c3 = _mm256_loadu_pd(matrix.value[3].data());
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        __m256d p = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(c0, _mm256_set1_pd(src[i].x)),
+                                                _mm256_mul_pd(c1, _mm256_set1_pd(src[i].y))),
+                                  _mm256_add_pd(_mm256_mul_pd(c2, _mm256_set1_pd(src[i].z)),
+                                                _mm256_mul_pd(c3, _mm256_set1_pd(src[i].w))));
+        _mm256_storeu_pd(dst[i].data(), p);
+    }
+}
+
+#else
+
+void vsg::transform(const dmat4& matrix, const dvec3* src, dvec3* dst, size_t count)
+{
+    t_transform(matrix, src, dst, count);
+}
+
+void vsg::transform(const dmat4& matrix, const dvec4* src, dvec4* dst, size_t count)
+{
+    t_transform(matrix, src, dst, count);
+}
+
+#endif
+
 bool vsg::transform(CoordinateConvention source, CoordinateConvention destination, dmat4& matrix)
 {
     if (source == destination || source == CoordinateConvention::NO_PREFERENCE || destination == CoordinateConvention::NO_PREFERENCE) return false;
@@ -0,0 +1,120 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/packed.h>
+
+#include <cmath>
+#include <cstring>
+
+using namespace vsg;
+
+uint16_t vsg::floatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    uint32_t em = bits & 0x7fffffffu;
+
+    if (em >= 0x47800000u)
+    {
+        // NaN maps to a quiet half NaN, everything else too large for half maps to infinity
+        if (em > 0x7f800000u) return sign | 0x7e00u;
+        return sign | 0x7c00u;
+    }
+
+    if (em < 0x38800000u)
+    {
+        // maps to a subnormal half or to zero
+        if (em < 0x33800000u) return sign;
+
+        uint32_t mantissa = (em & 0x7fffffu) | 0x800000u;
+        uint32_t shift = 126u - (em >> 23);
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t midpoint = 1u << (shift - 1u);
+        if (remainder > midpoint || (remainder == midpoint && (half & 1u))) ++half;
+        return sign | static_cast<uint16_t>(half);
+    }
+
+    // normal value, round the 13 discarded mantissa bits to nearest even,
+    // a carry out of the mantissa correctly increments the exponent field
+    uint32_t half = (((em >> 23) - 112u) << 10) | ((em >> 13) & 0x3ffu);
+    uint32_t remainder = em & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) ++half;
+    return sign | static_cast<uint16_t>(half);
+}
+
+float vsg::halfToFloat(uint16_t value)
+{
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+    uint32_t em = value & 0x7fffu;
+
+    uint32_t bits;
+    if (em >= 0x7c00u)
+    {
+        // infinity or NaN
+        bits = sign | 0x7f800000u | ((em & 0x3ffu) << 13);
+    }
+    else if (em >= 0x0400u)
+    {
+        // normal value
+        bits = sign | (((em >> 10) + 112u) << 23) | ((em & 0x3ffu) << 13);
+    }
+    else if (em != 0u)
+    {
+        // subnormal half, renormalize for the wider float exponent range
+        uint32_t mantissa = em;
+        uint32_t exponent = 113u;
+        while ((mantissa & 0x400u) == 0u)
+        {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+    else
+    {
+        bits = sign;
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+uint32_t vsg::packSnorm_A2B10G10R10(const vec4& value)
+{
+    auto pack = [](float component, float scale, uint32_t mask) -> uint32_t {
+        return static_cast<uint32_t>(static_cast<int32_t>(std::round(clamp(component, -1.0f, 1.0f) * scale))) & mask;
+    };
+
+    return (pack(value.w, 1.0f, 0x3u) << 30) |
+           (pack(value.z, 511.0f, 0x3ffu) << 20) |
+           (pack(value.y, 511.0f, 0x3ffu) << 10) |
+           pack(value.x, 511.0f, 0x3ffu);
+}
+
+vec4 vsg::unpackSnorm_A2B10G10R10(uint32_t value)
+{
+    // shift each component up to the top of the int32 then back down to sign extend it
+    auto unpack10 = [](uint32_t bits) -> float {
+        int32_t signedValue = static_cast<int32_t>(bits << 22) >> 22;
+        return std::max(static_cast<float>(signedValue) / 511.0f, -1.0f);
+    };
+
+    int32_t w = static_cast<int32_t>(value) >> 30;
+    return vec4(unpack10(value & 0x3ffu),
+                unpack10((value >> 10) & 0x3ffu),
+                unpack10((value >> 20) & 0x3ffu),
+                std::max(static_cast<float>(w), -1.0f));
+}
@@ -0,0 +1,58 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/meshshaders/MeshletDraw.h>
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/DescriptorBuffer.h>
+
+using namespace vsg;
+
+MeshletDraw::MeshletDraw()
+{
+}
+
+MeshletDraw::~MeshletDraw()
+{
+}
+
+bool MeshletDraw::setup()
+{
+    if (!meshletData || meshletData->numMeshlets() == 0 || !pipelineLayout)
+    {
+        warn("MeshletDraw::setup() requires meshletData and pipelineLayout to be assigned.");
+        return false;
+    }
+
+    if (firstSet >= pipelineLayout->setLayouts.size())
+    {
+        warn("MeshletDraw::setup() pipelineLayout does not provide a DescriptorSetLayout for set ", firstSet, ".");
+        return false;
+    }
+
+    auto meshletsDescriptor = DescriptorBuffer::create(meshletData->meshlets, 0, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto vertexIndicesDescriptor = DescriptorBuffer::create(meshletData->meshletVertexIndices, 1, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto triangleIndicesDescriptor = DescriptorBuffer::create(meshletData->meshletTriangleIndices, 2, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto positionsDescriptor = DescriptorBuffer::create(meshletData->positions, 3, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    auto descriptorSet = DescriptorSet::create(pipelineLayout->setLayouts[firstSet], Descriptors{meshletsDescriptor, vertexIndicesDescriptor, triangleIndicesDescriptor, positionsDescriptor});
+
+    uint32_t numMeshlets = meshletData->numMeshlets();
+    uint32_t groupCountX = (numMeshlets + taskWorkgroupSize - 1) / taskWorkgroupSize;
+
+    children.clear();
+    addChild(BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, firstSet, descriptorSet));
+    addChild(DrawMeshTasks::create(groupCountX, 1u, 1u));
+
+    return true;
+}
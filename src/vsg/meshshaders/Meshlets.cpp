@@ -0,0 +1,173 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/maths/box.h>
+#include <vsg/maths/transform.h>
+#include <vsg/meshshaders/Meshlets.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+using namespace vsg;
+
+MeshletData::MeshletData()
+{
+}
+
+ref_ptr<MeshletData> vsg::buildMeshlets(ref_ptr<vec3Array> positions, ref_ptr<Data> indices, uint32_t maxVertices, uint32_t maxTriangles)
+{
+    if (!positions || !indices) return {};
+
+    auto ushortIndices = indices.cast<ushortArray>();
+    auto uintIndices = indices.cast<uintArray>();
+    if (!ushortIndices && !uintIndices)
+    {
+        warn("vsg::buildMeshlets() unsupported index type, ushortArray or uintArray required.");
+        return {};
+    }
+
+    auto index = [&](uint32_t i) -> uint32_t {
+        return ushortIndices ? static_cast<uint32_t>(ushortIndices->at(i)) : uintIndices->at(i);
+    };
+
+    uint32_t numTriangles = static_cast<uint32_t>(indices->valueCount()) / 3;
+
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> meshletVertexIndices;
+    std::vector<uint32_t> meshletTriangleIndices;
+
+    // state of the meshlet currently being packed
+    std::map<uint32_t, uint32_t> localIndices;
+    Meshlet meshlet;
+
+    auto flush = [&]() {
+        if (meshlet.triangleCount == 0) return;
+
+        // compute the bounding sphere of the cluster's vertices
+        dbox bounds;
+        for (uint32_t vi = 0; vi < meshlet.vertexCount; ++vi)
+        {
+            bounds.add(dvec3(positions->at(meshletVertexIndices[meshlet.vertexOffset + vi])));
+        }
+        dvec3 center = (bounds.min + bounds.max) * 0.5;
+        double radius = 0.0;
+        for (uint32_t vi = 0; vi < meshlet.vertexCount; ++vi)
+        {
+            radius = std::max(radius, length(dvec3(positions->at(meshletVertexIndices[meshlet.vertexOffset + vi])) - center));
+        }
+
+        // compute the normal cone - the average of the face normals and the worst case deviation from it
+        dvec3 coneAxis(0.0, 0.0, 0.0);
+        std::vector<dvec3> faceNormals(meshlet.triangleCount);
+        for (uint32_t ti = 0; ti < meshlet.triangleCount; ++ti)
+        {
+            uint32_t packed = meshletTriangleIndices[meshlet.triangleOffset + ti];
+            auto v0 = dvec3(positions->at(meshletVertexIndices[meshlet.vertexOffset + (packed & 0xff)]));
+            auto v1 = dvec3(positions->at(meshletVertexIndices[meshlet.vertexOffset + ((packed >> 8) & 0xff)]));
+            auto v2 = dvec3(positions->at(meshletVertexIndices[meshlet.vertexOffset + ((packed >> 16) & 0xff)]));
+
+            auto normal = cross(v1 - v0, v2 - v0);
+            auto len = length(normal);
+            faceNormals[ti] = (len > 0.0) ? normal / len : dvec3(0.0, 0.0, 0.0);
+            coneAxis += faceNormals[ti];
+        }
+
+        double axisLength = length(coneAxis);
+        double minDot = -1.0;
+        if (axisLength > 0.0)
+        {
+            coneAxis /= axisLength;
+            minDot = 1.0;
+            for (auto& normal : faceNormals) minDot = std::min(minDot, dot(coneAxis, normal));
+        }
+
+        meshlet.boundingSphere.set(static_cast<float>(center.x), static_cast<float>(center.y), static_cast<float>(center.z), static_cast<float>(radius));
+
+        // cutoff of 1.0 marks clusters that span too wide a range of normals to ever be cone culled
+        float cutoff = (minDot > 0.0) ? static_cast<float>(std::sqrt(1.0 - minDot * minDot)) : 1.0f;
+        meshlet.coneAxisCutoff.set(static_cast<float>(coneAxis.x), static_cast<float>(coneAxis.y), static_cast<float>(coneAxis.z), cutoff);
+
+        meshlets.push_back(meshlet);
+
+        localIndices.clear();
+        meshlet = {};
+        meshlet.vertexOffset = static_cast<uint32_t>(meshletVertexIndices.size());
+        meshlet.triangleOffset = static_cast<uint32_t>(meshletTriangleIndices.size());
+    };
+
+    for (uint32_t ti = 0; ti < numTriangles; ++ti)
+    {
+        uint32_t i0 = index(ti * 3);
+        uint32_t i1 = index(ti * 3 + 1);
+        uint32_t i2 = index(ti * 3 + 2);
+
+        // count how many new vertices the triangle would add to the cluster
+        uint32_t newVertices = 0;
+        if (localIndices.count(i0) == 0) ++newVertices;
+        if (localIndices.count(i1) == 0) ++newVertices;
+        if (localIndices.count(i2) == 0) ++newVertices;
+
+        if (meshlet.vertexCount + newVertices > maxVertices || meshlet.triangleCount + 1 > maxTriangles) flush();
+
+        auto localIndex = [&](uint32_t globalIndex) -> uint32_t {
+            auto itr = localIndices.find(globalIndex);
+            if (itr != localIndices.end()) return itr->second;
+
+            uint32_t li = meshlet.vertexCount++;
+            localIndices[globalIndex] = li;
+            meshletVertexIndices.push_back(globalIndex);
+            return li;
+        };
+
+        uint32_t l0 = localIndex(i0);
+        uint32_t l1 = localIndex(i1);
+        uint32_t l2 = localIndex(i2);
+
+        meshletTriangleIndices.push_back(l0 | (l1 << 8) | (l2 << 16));
+        ++meshlet.triangleCount;
+    }
+    flush();
+
+    if (meshlets.empty()) return {};
+
+    auto meshletData = MeshletData::create();
+    meshletData->positions = positions;
+
+    meshletData->meshlets = MeshletArray::create(static_cast<uint32_t>(meshlets.size()));
+    std::copy(meshlets.begin(), meshlets.end(), meshletData->meshlets->begin());
+
+    meshletData->meshletVertexIndices = uintArray::create(static_cast<uint32_t>(meshletVertexIndices.size()));
+    std::copy(meshletVertexIndices.begin(), meshletVertexIndices.end(), meshletData->meshletVertexIndices->begin());
+
+    meshletData->meshletTriangleIndices = uintArray::create(static_cast<uint32_t>(meshletTriangleIndices.size()));
+    std::copy(meshletTriangleIndices.begin(), meshletTriangleIndices.end(), meshletData->meshletTriangleIndices->begin());
+
+    return meshletData;
+}
+
+ref_ptr<MeshletData> vsg::buildMeshlets(const VertexIndexDraw& vid, uint32_t maxVertices, uint32_t maxTriangles)
+{
+    if (vid.arrays.empty() || !vid.indices) return {};
+
+    auto positions = vid.arrays[0]->data.cast<vec3Array>();
+    if (!positions)
+    {
+        warn("vsg::buildMeshlets() VertexIndexDraw::arrays[0] is not a vec3Array.");
+        return {};
+    }
+
+    return buildMeshlets(positions, vid.indices->data, maxVertices, maxTriangles);
+}
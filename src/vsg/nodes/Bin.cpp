@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/State.h>
 
 #include <algorithm>
+#include <cstring>
 
 using namespace vsg;
 
@@ -107,6 +108,60 @@ void Bin::add(State* state, double value, const Node* node)
     _elements.push_back(element);
 }
 
+void Bin::_radixSort(bool descending) const
+{
+    size_t count = _binElements.size();
+    if (count < 2) return;
+
+    _radixPacked.resize(count);
+    _radixScratch.resize(count);
+
+    // pack the quantized depth key into the high 32 bits and the element index into the low 32 bits,
+    // remapping the float bits so that unsigned comparison matches float ordering.
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &_binElements[i].first, sizeof(bits));
+        bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        if (descending) bits = ~bits;
+        _radixPacked[i] = (static_cast<uint64_t>(bits) << 32) | _binElements[i].second;
+    }
+
+    // four stable counting sort passes over the key bytes
+    for (uint32_t shift = 32; shift < 64; shift += 8)
+    {
+        size_t histogram[256] = {};
+        for (size_t i = 0; i < count; ++i) ++histogram[(_radixPacked[i] >> shift) & 0xff];
+
+        size_t sum = 0;
+        for (auto& entry : histogram)
+        {
+            size_t start = sum;
+            sum += entry;
+            entry = start;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            _radixScratch[histogram[(_radixPacked[i] >> shift) & 0xff]++] = _radixPacked[i];
+        }
+
+        _radixPacked.swap(_radixScratch);
+    }
+
+    // unpack the sorted keys and indices back into _binElements
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits = static_cast<uint32_t>(_radixPacked[i] >> 32);
+        if (descending) bits = ~bits;
+        bits = (bits & 0x80000000u) ? (bits & 0x7fffffffu) : ~bits;
+
+        float key;
+        std::memcpy(&key, &bits, sizeof(key));
+        _binElements[i] = {key, static_cast<uint32_t>(_radixPacked[i] & 0xffffffffu)};
+    }
+}
+
 void Bin::traverse(RecordTraversal& rt) const
 {
     //debug("Bin::traverse(RecordTraversal& visitor) ", sortOrder, " ", _binElements.size());
@@ -121,6 +176,25 @@ void Bin::traverse(RecordTraversal& rt) const
     case (DESCENDING):
         std::sort(_binElements.begin(), _binElements.end(), [](const KeyIndex& lhs, const KeyIndex& rhs) { return rhs.first < lhs.first; });
         break;
+    case (ASCENDING_RADIX):
+        _radixSort(false);
+        break;
+    case (DESCENDING_RADIX):
+        _radixSort(true);
+        break;
+    case (STATE_SORT):
+        // group elements that share the same state commands together so that State's bind elision skips the
+        // redundant pipeline and descriptor set re-binds between consecutive elements. The comparison orders
+        // the per element state command runs lexicographically by pointer, which is arbitrary but consistent,
+        // with stable_sort preserving the traversal order within each group.
+        std::stable_sort(_binElements.begin(), _binElements.end(), [this](const KeyIndex& lhs, const KeyIndex& rhs) {
+            const auto& le = _elements[lhs.second];
+            const auto& re = _elements[rhs.second];
+            const auto* lbegin = _stateCommands.data() + le.stateCommandIndex;
+            const auto* rbegin = _stateCommands.data() + re.stateCommandIndex;
+            return std::lexicographical_compare(lbegin, lbegin + le.stateCommandCount, rbegin, rbegin + re.stateCommandCount);
+        });
+        break;
     case (NO_SORT):
         break;
     }
@@ -153,15 +227,16 @@ void Bin::traverse(RecordTraversal& rt) const
             uint32_t endIndex = element.stateCommandIndex + element.stateCommandCount;
             for (uint32_t i = element.stateCommandIndex; i < endIndex; ++i)
             {
-                auto command = _stateCommands[i];
+                auto& command = _stateCommands[i];
                 state->stateStacks[command->slot].push(command);
             }
+            state->dirty = true;
 
             element.child->accept(rt);
 
             for (uint32_t i = element.stateCommandIndex; i < endIndex; ++i)
             {
-                auto command = _stateCommands[i];
+                auto& command = _stateCommands[i];
                 state->stateStacks[command->slot].pop();
             }
         }
@@ -0,0 +1,120 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/ConstVisitor.h>
+#include <vsg/nodes/Commands.h>
+#include <vsg/nodes/CompiledDrawList.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/nodes/QuadGroup.h>
+#include <vsg/nodes/StateGroup.h>
+
+using namespace vsg;
+
+namespace
+{
+    /// one time traversal that flattens the static parts of a subgraph into CompiledDrawList entries,
+    /// falling back to ACCEPT_NODE entries for node types that require per frame evaluation.
+    struct BuildDrawList : public ConstVisitor
+    {
+        explicit BuildDrawList(CompiledDrawList& in_drawList) :
+            drawList(in_drawList) {}
+
+        CompiledDrawList& drawList;
+
+        // dynamic node fallback - retain the node for normal traversal during replay
+        void apply(const Node& node) override
+        {
+            drawList.entries.push_back({CompiledDrawList::ACCEPT_NODE, static_cast<uint32_t>(drawList.nodes.size())});
+            drawList.nodes.emplace_back(&node);
+        }
+
+        // static structural nodes are flattened away
+        void apply(const Group& group) override { group.traverse(*this); }
+        void apply(const QuadGroup& quadGroup) override { quadGroup.traverse(*this); }
+
+        // cull nodes within a static draw list are flattened conservatively, the whole
+        // CompiledDrawList is expected to be placed under a CullNode/CullGroup if required.
+        void apply(const CullNode& cullNode) override { cullNode.traverse(*this); }
+        void apply(const CullGroup& cullGroup) override { cullGroup.traverse(*this); }
+
+        void apply(const StateGroup& stateGroup) override
+        {
+            for (auto& command : stateGroup.stateCommands)
+            {
+                drawList.entries.push_back({CompiledDrawList::PUSH_STATE, static_cast<uint32_t>(drawList.stateCommands.size())});
+                drawList.stateCommands.emplace_back(command);
+            }
+
+            stateGroup.traverse(*this);
+
+            for (auto itr = stateGroup.stateCommands.rbegin(); itr != stateGroup.stateCommands.rend(); ++itr)
+            {
+                drawList.entries.push_back({CompiledDrawList::POP_STATE, static_cast<uint32_t>((*itr)->slot)});
+            }
+        }
+
+        void apply(const Transform& transform) override
+        {
+            drawList.entries.push_back({CompiledDrawList::PUSH_TRANSFORM, static_cast<uint32_t>(drawList.transforms.size())});
+            drawList.transforms.emplace_back(&transform);
+
+            transform.traverse(*this);
+
+            drawList.entries.push_back({CompiledDrawList::POP_TRANSFORM, 0});
+        }
+
+        void apply(const Commands& commands) override
+        {
+            for (auto& command : commands.children)
+            {
+                drawList.entries.push_back({CompiledDrawList::RECORD_COMMAND, static_cast<uint32_t>(drawList.commands.size())});
+                drawList.commands.emplace_back(command);
+            }
+        }
+
+        void apply(const Command& command) override
+        {
+            drawList.entries.push_back({CompiledDrawList::RECORD_COMMAND, static_cast<uint32_t>(drawList.commands.size())});
+            drawList.commands.emplace_back(&command);
+        }
+    };
+} // namespace
+
+CompiledDrawList::CompiledDrawList()
+{
+}
+
+CompiledDrawList::CompiledDrawList(ref_ptr<Node> in_subgraph) :
+    subgraph(in_subgraph)
+{
+    compile();
+}
+
+CompiledDrawList::~CompiledDrawList()
+{
+}
+
+void CompiledDrawList::compile()
+{
+    entries.clear();
+    stateCommands.clear();
+    transforms.clear();
+    commands.clear();
+    nodes.clear();
+
+    if (!subgraph) return;
+
+    BuildDrawList buildDrawList(*this);
+    subgraph->accept(buildDrawList);
+}
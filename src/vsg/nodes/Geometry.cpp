@@ -178,11 +178,18 @@ void Geometry::record(CommandBuffer& commandBuffer) const
 
     VkCommandBuffer cmdBuffer{commandBuffer};
 
-    vkCmdBindVertexBuffers(cmdBuffer, firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data());
+    if (commandBuffer.assignVertexBufferBindings(firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data()))
+    {
+        commandBuffer.dispatch->vkCmdBindVertexBuffers(cmdBuffer, firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data());
+    }
 
     if (indices)
     {
-        vkCmdBindIndexBuffer(cmdBuffer, indices->buffer->vk(commandBuffer.deviceID), indices->offset, indexType);
+        VkBuffer vkIndexBuffer = indices->buffer->vk(commandBuffer.deviceID);
+        if (commandBuffer.assignIndexBufferBinding(vkIndexBuffer, indices->offset, indexType))
+        {
+            commandBuffer.dispatch->vkCmdBindIndexBuffer(cmdBuffer, vkIndexBuffer, indices->offset, indexType);
+        }
     }
 
     for (auto& command : commands)
@@ -0,0 +1,315 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Dispatch.h>
+#include <vsg/commands/PipelineBarrier.h>
+#include <vsg/maths/plane.h>
+#include <vsg/nodes/IndirectDrawCollection.h>
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/ComputePipeline.h>
+#include <vsg/state/DescriptorBuffer.h>
+#include <vsg/vk/Context.h>
+
+#include <cstring>
+
+using namespace vsg;
+
+IndirectDrawCollection::IndirectDrawCollection()
+{
+}
+
+IndirectDrawCollection::IndirectDrawCollection(const std::vector<ref_ptr<VertexIndexDraw>>& draws)
+{
+    assign(draws);
+}
+
+IndirectDrawCollection::~IndirectDrawCollection()
+{
+}
+
+bool IndirectDrawCollection::assign(const std::vector<ref_ptr<VertexIndexDraw>>& draws)
+{
+    arrays.clear();
+    indices = {};
+    commands = {};
+    bounds = {};
+    drawCount = 0;
+    cullParams = {};
+    _vulkanData.clear();
+    _sourceCommands = {};
+    _culledCommands = {};
+    _boundsInfo = {};
+    _cullCommands = {};
+
+    if (draws.empty()) return false;
+
+    auto& first = draws.front();
+    size_t numArrays = first->arrays.size();
+    if (numArrays == 0 || !first->indices || !first->indices->data) return false;
+
+    uint32_t indexValueSize = first->indices->data->valueSize();
+    if (indexValueSize != 2 && indexValueSize != 4) return false;
+
+    std::vector<uint32_t> valueSizes(numArrays);
+    for (size_t j = 0; j < numArrays; ++j)
+    {
+        if (!first->arrays[j] || !first->arrays[j]->data) return false;
+        valueSizes[j] = static_cast<uint32_t>(first->arrays[j]->data->valueSize());
+    }
+
+    // validate that all the draws share the same array and index layouts, and compute the totals
+    size_t totalVertices = 0;
+    size_t totalIndices = 0;
+    for (auto& draw : draws)
+    {
+        if (draw->arrays.size() != numArrays || !draw->indices || !draw->indices->data) return false;
+        if (draw->indices->data->valueSize() != indexValueSize) return false;
+
+        if (!draw->arrays[0] || !draw->arrays[0]->data) return false;
+        size_t vertexCount = draw->arrays[0]->data->valueCount();
+        for (size_t j = 0; j < numArrays; ++j)
+        {
+            if (!draw->arrays[j] || !draw->arrays[j]->data) return false;
+            if (draw->arrays[j]->data->valueSize() != valueSizes[j] || draw->arrays[j]->data->valueCount() != vertexCount) return false;
+        }
+
+        totalVertices += vertexCount;
+        totalIndices += draw->indices->data->valueCount();
+    }
+
+    // merge each array slot byte wise - the vertex input layout comes from the graphics pipeline so only
+    // the per vertex stride needs to be preserved by the packing
+    for (size_t j = 0; j < numArrays; ++j)
+    {
+        auto merged = ubyteArray::create(static_cast<uint32_t>(totalVertices * valueSizes[j]));
+        size_t offset = 0;
+        for (auto& draw : draws)
+        {
+            size_t size = draw->arrays[0]->data->valueCount() * valueSizes[j];
+            std::memcpy(reinterpret_cast<char*>(merged->dataPointer()) + offset, draw->arrays[j]->data->dataPointer(), size);
+            offset += size;
+        }
+        arrays.push_back(BufferInfo::create(merged));
+    }
+
+    auto mergedIndices = ubyteArray::create(static_cast<uint32_t>(totalIndices * indexValueSize));
+    indexType = (indexValueSize == 2) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    {
+        size_t offset = 0;
+        for (auto& draw : draws)
+        {
+            size_t size = draw->indices->data->valueCount() * indexValueSize;
+            std::memcpy(reinterpret_cast<char*>(mergedIndices->dataPointer()) + offset, draw->indices->data->dataPointer(), size);
+            offset += size;
+        }
+    }
+    indices = BufferInfo::create(mergedIndices);
+
+    // pack the draw parameters, offsetting each draw's first index and vertex by its position in the
+    // merged buffers, and compute the per draw bounding spheres used by the optional GPU cull pass
+    commands = DrawIndexedIndirectCommandArray::create(static_cast<uint32_t>(draws.size()));
+    bounds = vec4Array::create(static_cast<uint32_t>(draws.size()));
+
+    uint32_t vertexBase = 0;
+    uint32_t indexBase = 0;
+    for (size_t i = 0; i < draws.size(); ++i)
+    {
+        auto& draw = draws[i];
+        uint32_t drawIndexCount = static_cast<uint32_t>(draw->indices->data->valueCount());
+
+        DrawIndexedIndirectCommand cmd;
+        cmd.indexCount = (draw->indexCount != 0) ? draw->indexCount : drawIndexCount;
+        cmd.instanceCount = (draw->instanceCount != 0) ? draw->instanceCount : 1;
+        cmd.firstIndex = indexBase + draw->firstIndex;
+        cmd.vertexOffset = static_cast<int32_t>(vertexBase) + static_cast<int32_t>(draw->vertexOffset);
+        cmd.firstInstance = draw->firstInstance;
+        commands->set(i, cmd);
+
+        vec4 sphere(0.0f, 0.0f, 0.0f, -1.0f);
+        if (auto positions = draw->arrays[0]->data->cast<vec3Array>(); positions && positions->valueCount() > 0)
+        {
+            vec3 minimum = positions->at(0);
+            vec3 maximum = positions->at(0);
+            for (auto& v : *positions)
+            {
+                if (v.x < minimum.x) minimum.x = v.x;
+                if (v.y < minimum.y) minimum.y = v.y;
+                if (v.z < minimum.z) minimum.z = v.z;
+                if (v.x > maximum.x) maximum.x = v.x;
+                if (v.y > maximum.y) maximum.y = v.y;
+                if (v.z > maximum.z) maximum.z = v.z;
+            }
+            vec3 center = (minimum + maximum) * 0.5f;
+            sphere.set(center.x, center.y, center.z, length(maximum - minimum) * 0.5f);
+        }
+        bounds->set(i, sphere);
+
+        vertexBase += static_cast<uint32_t>(draw->arrays[0]->data->valueCount());
+        indexBase += drawIndexCount;
+    }
+
+    drawCount = static_cast<uint32_t>(draws.size());
+    _sourceCommands = BufferInfo::create(commands);
+
+    return true;
+}
+
+void IndirectDrawCollection::_createCullResources()
+{
+    // default frustum planes with zero normal and positive distance keep every draw visible until
+    // setFrustum() is called
+    cullParams = vec4Array::create(7);
+    cullParams->properties.dataVariance = DYNAMIC_DATA;
+    for (uint32_t i = 0; i < 6; ++i) cullParams->set(i, vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    cullParams->set(6, vec4(static_cast<float>(drawCount), 0.0f, 0.0f, 0.0f));
+
+    _boundsInfo = BufferInfo::create(bounds);
+    _culledCommands = BufferInfo::create();
+
+    auto paramsDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(cullParams)}, 0, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    auto sourceDescriptor = DescriptorBuffer::create(BufferInfoList{_sourceCommands}, 1, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto boundsDescriptor = DescriptorBuffer::create(BufferInfoList{_boundsInfo}, 2, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto culledDescriptor = DescriptorBuffer::create(BufferInfoList{_culledCommands}, 3, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    DescriptorSetLayoutBindings descriptorBindings{
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+
+    auto descriptorSetLayout = DescriptorSetLayout::create(descriptorBindings);
+    auto pipelineLayout = PipelineLayout::create(DescriptorSetLayouts{descriptorSetLayout}, PushConstantRanges{});
+    auto pipeline = ComputePipeline::create(pipelineLayout, cullShaderStage);
+    auto descriptorSet = DescriptorSet::create(descriptorSetLayout, Descriptors{paramsDescriptor, sourceDescriptor, boundsDescriptor, culledDescriptor});
+
+    _cullCommands = Commands::create();
+    _cullCommands->addChild(BindComputePipeline::create(pipeline));
+    _cullCommands->addChild(BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, descriptorSet));
+    _cullCommands->addChild(Dispatch::create((drawCount + workgroupSize - 1) / workgroupSize, 1, 1));
+    _cullCommands->addChild(PipelineBarrier::create(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0,
+                                                    MemoryBarrier::create(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT)));
+}
+
+ref_ptr<Commands> IndirectDrawCollection::createCullCommands()
+{
+    if (!cullShaderStage || !commands) return {};
+    if (!_cullCommands) _createCullResources();
+    return _cullCommands;
+}
+
+void IndirectDrawCollection::setFrustum(const dmat4& projectionViewMatrix)
+{
+    if (!cullParams) return;
+
+    const dplane unitPlanes[6] = {
+        dplane(1.0, 0.0, 0.0, 1.0),   // left
+        dplane(-1.0, 0.0, 0.0, 1.0),  // right
+        dplane(0.0, -1.0, 0.0, 1.0),  // bottom
+        dplane(0.0, 1.0, 0.0, 1.0),   // top
+        dplane(0.0, 0.0, 1.0, 0.0),   // far
+        dplane(0.0, 0.0, -1.0, 1.0)}; // near
+
+    for (uint32_t i = 0; i < 6; ++i)
+    {
+        auto plane = unitPlanes[i] * projectionViewMatrix;
+        auto len = length(plane.n);
+        if (len != 0.0) plane.vec /= len;
+        cullParams->set(i, vec4(static_cast<float>(plane[0]), static_cast<float>(plane[1]), static_cast<float>(plane[2]), static_cast<float>(plane[3])));
+    }
+    cullParams->set(6, vec4(static_cast<float>(drawCount), 0.0f, 0.0f, 0.0f));
+    cullParams->dirty();
+}
+
+void IndirectDrawCollection::compile(Context& context)
+{
+    if (arrays.empty() || !indices || !commands)
+    {
+        // IndirectDrawCollection does not contain required arrays, indices and commands
+        return;
+    }
+
+    auto deviceID = context.deviceID;
+
+    bool requiresCreateAndCopy = indices->requiresCopy(deviceID);
+    if (!requiresCreateAndCopy)
+    {
+        for (auto& array : arrays)
+        {
+            if (array->requiresCopy(deviceID))
+            {
+                requiresCreateAndCopy = true;
+                break;
+            }
+        }
+    }
+
+    if (requiresCreateAndCopy)
+    {
+        BufferInfoList combinedBufferInfos(arrays);
+        combinedBufferInfos.push_back(indices);
+        createBufferAndTransferData(context, combinedBufferInfos, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE);
+    }
+
+    assignVulkanArrayData(deviceID, arrays, _vulkanData[deviceID]);
+
+    if (cullShaderStage && !_cullCommands) _createCullResources();
+
+    // the packed commands are read as a storage buffer by the cull pass, otherwise consumed directly as
+    // the indirect buffer
+    VkBufferUsageFlags commandsUsage = VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    if (_cullCommands) commandsUsage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    if (_sourceCommands->requiresCopy(deviceID))
+    {
+        createBufferAndTransferData(context, {_sourceCommands}, commandsUsage, VK_SHARING_MODE_EXCLUSIVE);
+    }
+
+    if (_cullCommands)
+    {
+        if (_boundsInfo->requiresCopy(deviceID))
+        {
+            createBufferAndTransferData(context, {_boundsInfo}, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE);
+        }
+
+        if (!_culledCommands->buffer)
+        {
+            VkDeviceSize size = commands->dataSize();
+            _culledCommands->buffer = createBufferAndMemory(context.device, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+            _culledCommands->offset = 0;
+            _culledCommands->range = size;
+        }
+
+        // compile the cull pass here so it is ready even when only the collection itself sits in a
+        // compile traversed graph
+        _cullCommands->compile(context);
+    }
+}
+
+void IndirectDrawCollection::record(CommandBuffer& commandBuffer) const
+{
+    auto& vkd = _vulkanData[commandBuffer.deviceID];
+
+    VkCommandBuffer cmdBuffer{commandBuffer};
+
+    if (commandBuffer.assignVertexBufferBindings(firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data()))
+    {
+        commandBuffer.dispatch->vkCmdBindVertexBuffers(cmdBuffer, firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data());
+    }
+
+    VkBuffer vkIndexBuffer = indices->buffer->vk(commandBuffer.deviceID);
+    if (commandBuffer.assignIndexBufferBinding(vkIndexBuffer, indices->offset, indexType))
+    {
+        commandBuffer.dispatch->vkCmdBindIndexBuffer(cmdBuffer, vkIndexBuffer, indices->offset, indexType);
+    }
+
+    const auto& indirect = _cullCommands ? _culledCommands : _sourceCommands;
+    commandBuffer.dispatch->vkCmdDrawIndexedIndirect(cmdBuffer, indirect->buffer->vk(commandBuffer.deviceID), indirect->offset, drawCount, sizeof(VkDrawIndexedIndirectCommand));
+}
@@ -11,6 +11,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/core/Allocator.h>
+#include <vsg/core/ObjectPool.h>
 #include <vsg/io/Options.h>
 #include <vsg/nodes/Node.h>
 
@@ -31,6 +32,7 @@ Node::~Node()
 
 void* Node::operator new(std::size_t count)
 {
+    if (auto ptr = ObjectPool::instance().take(count)) return ptr;
     return vsg::allocate(count, vsg::ALLOCATOR_AFFINITY_NODES);
 }
 
@@ -38,3 +40,9 @@ void Node::operator delete(void* ptr)
 {
     vsg::deallocate(ptr);
 }
+
+void Node::operator delete(void* ptr, std::size_t size)
+{
+    if (ObjectPool::instance().recycle(ptr, size)) return;
+    vsg::deallocate(ptr, size);
+}
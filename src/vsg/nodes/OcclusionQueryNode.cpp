@@ -0,0 +1,99 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/nodes/OcclusionQueryNode.h>
+
+using namespace vsg;
+
+OcclusionQueryNode::OcclusionQueryNode() :
+    queryPool(QueryPool::create())
+{
+    queryPool->queryType = VK_QUERY_TYPE_OCCLUSION;
+    queryPool->queryCount = 4; // one slot per frame in flight plus one, grown by CompileTraversal to match the viewer
+}
+
+OcclusionQueryNode::OcclusionQueryNode(const OcclusionQueryNode& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    queryPool(QueryPool::create()),
+    visibilityThreshold(rhs.visibilityThreshold),
+    culledRetestFrames(rhs.culledRetestFrames)
+{
+    queryPool->queryType = rhs.queryPool->queryType;
+    queryPool->queryCount = rhs.queryPool->queryCount;
+}
+
+OcclusionQueryNode::OcclusionQueryNode(const dsphere& in_bound, Node* in_child) :
+    Inherit(in_bound, in_child),
+    queryPool(QueryPool::create())
+{
+    queryPool->queryType = VK_QUERY_TYPE_OCCLUSION;
+    queryPool->queryCount = 4;
+}
+
+OcclusionQueryNode::~OcclusionQueryNode()
+{
+}
+
+int OcclusionQueryNode::compare(const Object& rhs_object) const
+{
+    int result = CullNode::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    if ((result = compare_value(visibilityThreshold, rhs.visibilityThreshold)) != 0) return result;
+    return compare_value(culledRetestFrames, rhs.culledRetestFrames);
+}
+
+void OcclusionQueryNode::read(Input& input)
+{
+    CullNode::read(input);
+
+    input.read("visibilityThreshold", visibilityThreshold);
+    input.read("culledRetestFrames", culledRetestFrames);
+
+    _queryIndex = 0;
+    _framesSinceCulled = 0;
+    _culled = false;
+}
+
+void OcclusionQueryNode::write(Output& output) const
+{
+    CullNode::write(output);
+
+    output.write("visibilityThreshold", visibilityThreshold);
+    output.write("culledRetestFrames", culledRetestFrames);
+}
+
+bool OcclusionQueryNode::pollQueryAndCheckVisibility() const
+{
+    if (_culled)
+    {
+        // skip the subgraph until the retest interval has elapsed, then record it again to refresh the query
+        if (++_framesSinceCulled < culledRetestFrames) return false;
+
+        _culled = false;
+        return true;
+    }
+
+    // the slot about to be reused is the oldest in flight query, poll it without waiting,
+    // treating an unavailable result as visible so the subgraph is never culled on stale data
+    _results.resize(1);
+    if (queryPool->getResults(_results, _queryIndex, 0) == VK_SUCCESS && _results[0] <= visibilityThreshold)
+    {
+        _culled = true;
+        _framesSinceCulled = 0;
+        return false;
+    }
+
+    return true;
+}
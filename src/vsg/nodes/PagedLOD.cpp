@@ -16,9 +16,6 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 using namespace vsg;
 
-#define PRINT_CONTAINER 0
-#define CHECK_CONTAINER 0
-
 //static std::atomic_uint s_numPagedLODS{0};
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,6 +102,7 @@ void PagedLOD::write(Output& output) const
     output.write("child.node", children[1].node);
 }
 
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // PagedLODContainer
@@ -112,336 +110,132 @@ void PagedLOD::write(Output& output) const
 PagedLODContainer::PagedLODContainer(uint32_t maxNumPagedLOD) :
     elements(1)
 {
-    availableList.name = "availableList";
-    activeList.name = "activeList";
-    inactiveList.name = "inactiveList";
-
-    resize(std::max(maxNumPagedLOD, 10u));
+    uint32_t capacity = std::max(maxNumPagedLOD, 10u);
+    elements.reserve(capacity + 1);
+    freeSlots.reserve(capacity);
+    activeSlots.reserve(capacity);
+    inactiveSlots.reserve(capacity);
 }
 
-void PagedLODContainer::resize(uint32_t new_size)
+uint32_t PagedLODContainer::slot(const PagedLOD* plod) const
 {
-    // note first entry in elements is the null entry, so have to add/take away 1 when accounting for it.
-    uint32_t original_size = static_cast<uint32_t>(elements.size()) - 1;
-    elements.resize(new_size + 1);
-
-    uint32_t i = 1 + original_size;
-    uint32_t previous = availableList.tail;
-
-    if (availableList.head == 0)
-    {
-        availableList.head = i;
-    }
+    auto s = static_cast<uint32_t>(plod->index & 0xffffffff);
+    if (s == 0 || s >= elements.size()) return 0;
+    if (elements[s].generation != static_cast<uint32_t>(plod->index >> 32)) return 0;
+    return s;
+}
 
-    if (availableList.tail > 0)
+uint32_t PagedLODContainer::_acquireSlot(const PagedLOD* plod)
+{
+    uint32_t s;
+    if (!freeSlots.empty())
     {
-        elements[availableList.tail].next = i;
+        s = freeSlots.back();
+        freeSlots.pop_back();
     }
-
-    for (; i < new_size; ++i)
+    else
     {
-        auto& element = elements[i];
-        element.previous = previous;
-        element.next = i + 1;
-        element.list = &availableList;
-        previous = i;
+        s = static_cast<uint32_t>(elements.size());
+        elements.emplace_back();
     }
 
-    // set up tail
-    elements[i].previous = previous;
-    elements[i].next = 0;
-    elements[i].list = &availableList;
-
-    availableList.tail = i;
-
-    availableList.count += (new_size - original_size);
-
-#if PRINT_CONTAINER
-    debug("PagedLODContainer::resize(", new_size, ")");
-    debug_stream([&](auto& fout) { print(fout); });
-#endif
+    auto& element = elements[s];
+    element.plod = const_cast<PagedLOD*>(plod);
+    plod->index = (static_cast<uint64_t>(element.generation) << 32) | s;
+    return s;
 }
 
-void PagedLODContainer::resize()
+void PagedLODContainer::_refreshBytes(Element& element)
 {
-    uint32_t original_size = static_cast<uint32_t>(elements.size() - 1);
-    uint32_t new_size = original_size * 2;
-    resize(new_size);
+    // the footprint is assigned by the pager's read threads when a load completes, so resync the
+    // slot's accounted bytes whenever the slot changes state
+    std::size_t bytes = element.plod ? element.plod->highResBytes.load() : 0;
+    residentBytes = residentBytes - element.bytes + bytes;
+    element.bytes = bytes;
 }
 
-void PagedLODContainer::print(std::ostream& fout)
+void PagedLODContainer::_eraseDense(std::vector<uint32_t>& denseSlots, Element& element)
 {
-    uint32_t total_size = static_cast<uint32_t>(elements.size());
-    fout << "    PagedLODContainer::print() elements.size() = " << total_size << std::endl;
-    fout << "        availableList, " << &availableList << ", head  = " << availableList.head << ", tail = " << availableList.tail << " count = " << availableList.count << std::endl;
-    fout << "        activeList, " << &activeList << ", head  = " << activeList.head << ", tail = " << activeList.tail << " count = " << activeList.count << std::endl;
-    fout << "        inactiveList = " << &inactiveList << ", head  = " << inactiveList.head << ", tail = " << inactiveList.tail << " count = " << inactiveList.count << std::endl;
-
-    for (unsigned i = 0; i < total_size; ++i)
-    {
-        auto& element = elements[i];
-        fout << "         element[" << i << "] plod = " << element.plod.get() << ", previous =" << element.previous << ", next = " << element.next << ", list = ";
-        if (element.list)
-            fout << element.list->name;
-        else
-            fout << " unassigned";
-        fout << std::endl;
-    }
-}
-
-void PagedLODContainer::_move(const PagedLOD* plod, List* targetList)
-{
-    if (plod->index == 0)
-    {
-#if PRINT_CONTAINER
-        debug("plod not yet assigned, assigning to ", targetList->name);
-#endif
-        // resize if there are no available empty elements.
-        if (availableList.head == 0)
-        {
-            resize();
-        }
-
-        // take the first element from availableList and move head to next item.
-        uint32_t index = availableList.head;
-        auto& element = elements[availableList.head];
-        if (availableList.head == availableList.tail)
-        {
-            availableList.head = 0;
-            availableList.tail = 0;
-        }
-        else
-        {
-            availableList.head = element.next;
-        }
-
-        if (element.next > 0)
-        {
-            auto& next_element = elements[element.next];
-            next_element.previous = 0;
-        }
-
-        // place element at the end of the active list.
-        if (targetList->tail > 0)
-        {
-            auto& previous_element = elements[targetList->tail];
-            previous_element.next = index;
-        }
-
-        if (targetList->head == 0)
-        {
-            targetList->head = index;
-        }
-
-        element.previous = targetList->tail;
-        element.next = 0;
-        element.list = targetList;
-        targetList->tail = index;
-
-        // assign index to PagedLOD
-        plod->index = index;
-        element.plod = const_cast<PagedLOD*>(plod);
-
-        --(availableList.count);
-        ++(targetList->count);
-
-        return;
-    }
-
-    auto& element = elements[plod->index];
-    List* previousList = element.list;
-
-    if (previousList == targetList)
-    {
-#if PRINT_CONTAINER
-        debug("PagedLODContainer::move(", plod, ") index = ", plod->index, ", already in ", targetList->name);
-#endif
-        return;
-    }
-
-#if PRINT_CONTAINER
-    debug("PagedLODContainer::move(", plod, ") index = ", plod->index, ", moving from ", previousList->name, " to ", targetList->name);
-#endif
-
-    // remove from inactiveList
-
-    if (element.previous > 0) elements[element.previous].next = element.next;
-    if (element.next > 0) elements[element.next].previous = element.previous;
-
-    // if this element is tail on inactive list then shift it back
-    if (previousList->head == plod->index)
-    {
-#if PRINT_CONTAINER
-        debug("   removing head from ", previousList->name);
-#endif
-        previousList->head = element.next;
-    }
-
-    if (previousList->tail == plod->index)
-    {
-#if PRINT_CONTAINER
-        debug("   removing tail from ", previousList->name);
-#endif
-        previousList->tail = element.previous;
-    }
-
-    element.list = targetList;
-    element.previous = targetList->tail;
-    element.next = 0;
-
-    // add to end of activeList tail
-    if (targetList->head == 0)
-    {
-#if PRINT_CONTAINER
-        debug("   setting ", targetList->name, ".head to", plod->index);
-#endif
-        targetList->head = plod->index;
-    }
-
-    if (targetList->tail > 0)
-    {
-#if PRINT_CONTAINER
-        debug("   moving ", targetList->name, ".tail to ", plod->index);
-#endif
-        elements[targetList->tail].next = plod->index;
-    }
-    targetList->tail = plod->index;
-
-    --(previousList->count);
-    ++(targetList->count);
+    uint32_t last = denseSlots.back();
+    denseSlots[element.denseIndex] = last;
+    elements[last].denseIndex = element.denseIndex;
+    denseSlots.pop_back();
 }
 
 void PagedLODContainer::active(const PagedLOD* plod)
 {
-    debug("Moving to activeList", plod, ", ", plod->index);
+    debug("Moving to activeSlots ", plod, ", ", plod->index);
 
-    _move(plod, &activeList);
+    uint32_t s = slot(plod);
+    if (s == 0) s = _acquireSlot(plod);
 
-#if PRINT_CONTAINER
-    debug_stream([&](auto& fout) { check(); print(fout); });
-#endif
+    auto& element = elements[s];
+    _refreshBytes(element);
+    if (element.status == ACTIVE) return;
+    if (element.status == INACTIVE) _eraseDense(inactiveSlots, element);
+
+    element.status = ACTIVE;
+    element.denseIndex = static_cast<uint32_t>(activeSlots.size());
+    activeSlots.push_back(s);
 }
 
 void PagedLODContainer::inactive(const PagedLOD* plod)
 {
-    debug("Moving to inactiveList", plod, ", ", plod->index);
+    debug("Moving to inactiveSlots ", plod, ", ", plod->index);
+
+    uint32_t s = slot(plod);
+    if (s == 0) s = _acquireSlot(plod);
 
-    _move(plod, &inactiveList);
+    auto& element = elements[s];
+    _refreshBytes(element);
+    if (element.status == INACTIVE) return;
+    if (element.status == ACTIVE) _eraseDense(activeSlots, element);
 
-#if PRINT_CONTAINER
-    debug_stream([&](std::ostream& fout) { check(); print(fout); });
-#endif
+    element.status = INACTIVE;
+    element.denseIndex = static_cast<uint32_t>(inactiveSlots.size());
+    inactiveSlots.push_back(s);
 }
 
 void PagedLODContainer::remove(PagedLOD* plod)
 {
-    debug("Remove and make available to availableList", plod, ", ", plod->index);
+    debug("Remove and make slot available ", plod, ", ", plod->index);
 
-    if (plod->index == 0)
+    uint32_t s = slot(plod);
+    if (s == 0)
     {
         warn("PagedLODContainer::remove() plod not assigned so ignore");
-        check();
         return;
     }
 
-    _move(plod, &availableList);
+    auto& element = elements[s];
+    if (element.status == ACTIVE)
+        _eraseDense(activeSlots, element);
+    else if (element.status == INACTIVE)
+        _eraseDense(inactiveSlots, element);
 
-    // reset element and plod
-    auto& element = elements[plod->index];
+    // invalidate any outstanding handles to this slot before making it available for reuse
+    residentBytes -= element.bytes;
+    element.bytes = 0;
+    element.status = AVAILABLE;
+    element.plod = {};
+    ++element.generation;
     plod->index = 0;
-    element.plod = nullptr;
-
-#if PRINT_CONTAINER
-    check();
-#endif
-#if CHECK_CONTAINER
-    info_stream([&](std::ostream& fout) { print(fout); });
-#endif
+
+    freeSlots.push_back(s);
 }
 
-bool PagedLODContainer::check(const List& list)
+void PagedLODContainer::print(std::ostream& fout)
 {
-    if (list.head == 0)
-    {
-        // we have an empty list
-        if (list.tail == 0)
-        {
-            if (list.count == 0) return true;
-            warn("list ", list.name, " has a head==0 and tail==0 but length is ", list.count);
-            return false;
-        }
-
-        warn("list ", list.name, " has a head==0, but tail is non zero");
-        return false;
-    }
-
-    const auto& head_element = elements[list.head];
-    if (head_element.previous != 0)
-    {
-        warn("list ", list.name, " has a head.previous that is non zero ", head_element.previous);
-        return false;
-    }
+    fout << "    PagedLODContainer::print() elements.size() = " << elements.size() << std::endl;
+    fout << "        activeSlots.size() = " << activeSlots.size() << std::endl;
+    fout << "        inactiveSlots.size() = " << inactiveSlots.size() << std::endl;
+    fout << "        freeSlots.size() = " << freeSlots.size() << std::endl;
+    fout << "        residentBytes = " << residentBytes << std::endl;
 
-    const auto& tail_element = elements[list.tail];
-    if (tail_element.next != 0)
-    {
-        warn("list ", list.name, " has a tail.next that is non zero ", tail_element.next);
-        return false;
-    }
-
-    uint32_t count = 0;
-    for (uint32_t i = list.head; i > 0 && count < elements.size();)
+    const char* statusNames[] = {"AVAILABLE", "ACTIVE", "INACTIVE"};
+    for (size_t i = 0; i < elements.size(); ++i)
     {
         auto& element = elements[i];
-        if (element.previous == 0)
-        {
-            if (i != list.head)
-            {
-                warn("list ", list.name, " non head element ", i, " has a previous==0");
-                return false;
-            }
-        }
-        else
-        {
-            auto& previous_element = elements[element.previous];
-            if (previous_element.next != i)
-            {
-                warn("list ", list.name, " element = ", i, ", element.previous = ", element.previous, ", does not match to previous.next = ", previous_element.next);
-                return false;
-            }
-        }
-
-        if (element.next == 0)
-        {
-            if (i != list.tail)
-            {
-                warn("list ", list.name, " non tail element ", i, " has a next==0");
-                return false;
-            }
-        }
-        else
-        {
-            auto& next_element = elements[element.next];
-            if (next_element.previous != i)
-            {
-                warn("list ", list.name, " element = ", i, ", element.next = ", element.next, ", does not match to next.previous = ", next_element.previous);
-                return false;
-            }
-        }
-
-        ++count;
-
-        i = element.next;
+        fout << "         element[" << i << "] plod = " << element.plod.get() << ", generation = " << element.generation << ", denseIndex = " << element.denseIndex << ", status = " << statusNames[element.status] << std::endl;
     }
-
-    if (count == list.count) return true;
-    return false;
-}
-
-bool PagedLODContainer::check()
-{
-    bool result1 = check(availableList);
-    bool result2 = check(activeList);
-    bool result3 = check(inactiveList);
-    return result1 && result2 && result3;
 }
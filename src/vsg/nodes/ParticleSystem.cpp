@@ -0,0 +1,108 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Dispatch.h>
+#include <vsg/commands/PipelineBarrier.h>
+#include <vsg/io/Logger.h>
+#include <vsg/nodes/ParticleSystem.h>
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/ComputePipeline.h>
+#include <vsg/state/DescriptorBuffer.h>
+#include <vsg/vk/Context.h>
+
+using namespace vsg;
+
+ParticleSystem::ParticleSystem()
+{
+}
+
+ParticleSystem::~ParticleSystem()
+{
+}
+
+bool ParticleSystem::setup()
+{
+    if (maxParticles == 0 || !updateShaderStage || !emitterParameters)
+    {
+        warn("ParticleSystem::setup() requires maxParticles, updateShaderStage and emitterParameters to be assigned.");
+        return false;
+    }
+
+    particles = BufferInfo::create();
+    drawCommand = BufferInfo::create();
+
+    auto emitterDescriptor = DescriptorBuffer::create(BufferInfoList{BufferInfo::create(emitterParameters)}, 0, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    auto particlesDescriptor = DescriptorBuffer::create(BufferInfoList{particles}, 1, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    auto drawCommandDescriptor = DescriptorBuffer::create(BufferInfoList{drawCommand}, 2, 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    DescriptorSetLayoutBindings descriptorBindings{
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+
+    auto descriptorSetLayout = DescriptorSetLayout::create(descriptorBindings);
+    auto pipelineLayout = PipelineLayout::create(DescriptorSetLayouts{descriptorSetLayout}, PushConstantRanges{});
+    auto pipeline = ComputePipeline::create(pipelineLayout, updateShaderStage);
+    auto descriptorSet = DescriptorSet::create(descriptorSetLayout, Descriptors{emitterDescriptor, particlesDescriptor, drawCommandDescriptor});
+
+    // reset the draw command so the update dispatch only accumulates instanceCount - vertexCount in the
+    // first uint, then instanceCount/firstVertex/firstInstance cleared to zero. The buffers are allocated
+    // at compile, compile() assigns them before the commands are recorded.
+    children.clear();
+
+    _writeVertexCount = FillBuffer::create(ref_ptr<Buffer>{}, 0, sizeof(uint32_t), vertexCount);
+    addChild(_writeVertexCount);
+
+    _clearCounts = FillBuffer::create(ref_ptr<Buffer>{}, sizeof(uint32_t), 3 * sizeof(uint32_t), 0);
+    addChild(_clearCounts);
+
+    addChild(PipelineBarrier::create(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                                     MemoryBarrier::create(VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT)));
+
+    addChild(BindComputePipeline::create(pipeline));
+    addChild(BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, descriptorSet));
+    addChild(Dispatch::create((maxParticles + workgroupSize - 1) / workgroupSize, 1, 1));
+
+    addChild(PipelineBarrier::create(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0,
+                                     MemoryBarrier::create(VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT)));
+
+    drawIndirect = DrawIndirect::create();
+    drawIndirect->bufferInfo = drawCommand;
+    drawIndirect->drawCount = 1;
+    drawIndirect->stride = 0;
+
+    return true;
+}
+
+void ParticleSystem::compile(Context& context)
+{
+    // allocate the device only particle pool and draw command before the descriptors referencing them
+    // are compiled. This node is recorded before the render graphs so it is also compiled first.
+    if (particles && !particles->buffer)
+    {
+        VkDeviceSize size = VkDeviceSize(maxParticles) * VkDeviceSize(particleStride);
+        particles->buffer = createBufferAndMemory(context.device, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        particles->offset = 0;
+        particles->range = size;
+    }
+    if (drawCommand && !drawCommand->buffer)
+    {
+        VkDeviceSize size = sizeof(VkDrawIndirectCommand);
+        drawCommand->buffer = createBufferAndMemory(context.device, size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        drawCommand->offset = 0;
+        drawCommand->range = size;
+    }
+    if (_writeVertexCount) _writeVertexCount->buffer = drawCommand->buffer;
+    if (_clearCounts) _clearCounts->buffer = drawCommand->buffer;
+
+    Commands::compile(context);
+}
@@ -0,0 +1,140 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/compare.h>
+#include <vsg/io/Input.h>
+#include <vsg/io/Output.h>
+#include <vsg/maths/box.h>
+#include <vsg/nodes/SpatialIndexGroup.h>
+#include <vsg/utils/ComputeBounds.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+SpatialIndexGroup::SpatialIndexGroup(size_t numChildren) :
+    Inherit(numChildren)
+{
+}
+
+SpatialIndexGroup::SpatialIndexGroup(const SpatialIndexGroup& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    maxChildrenPerLeaf(rhs.maxChildrenPerLeaf)
+{
+}
+
+SpatialIndexGroup::~SpatialIndexGroup()
+{
+}
+
+int SpatialIndexGroup::compare(const Object& rhs_object) const
+{
+    int result = Group::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    return compare_value(maxChildrenPerLeaf, rhs.maxChildrenPerLeaf);
+}
+
+void SpatialIndexGroup::read(Input& input)
+{
+    Group::read(input);
+
+    input.read("maxChildrenPerLeaf", maxChildrenPerLeaf);
+
+    invalidate();
+}
+
+void SpatialIndexGroup::write(Output& output) const
+{
+    Group::write(output);
+
+    output.write("maxChildrenPerLeaf", maxChildrenPerLeaf);
+}
+
+void SpatialIndexGroup::build() const
+{
+    _indexNodes.clear();
+    _leafChildren.clear();
+    _unboundedChildren.clear();
+    _dirty = false;
+
+    // compute a bounding sphere for each child, setting aside children without computable bounds
+    std::vector<dsphere> bounds(children.size());
+    _leafChildren.reserve(children.size());
+    for (uint32_t i = 0; i < children.size(); ++i)
+    {
+        ComputeBounds computeBounds;
+        children[i]->accept(computeBounds);
+
+        auto& bb = computeBounds.bounds;
+        if (bb.valid())
+        {
+            bounds[i].set((bb.min + bb.max) * 0.5, length(bb.max - bb.min) * 0.5);
+            _leafChildren.push_back(i);
+        }
+        else
+        {
+            _unboundedChildren.push_back(i);
+        }
+    }
+
+    if (_leafChildren.empty()) return;
+
+    _indexNodes.reserve(2 * _leafChildren.size());
+    _build(0, static_cast<uint32_t>(_leafChildren.size()), bounds);
+}
+
+uint32_t SpatialIndexGroup::_build(uint32_t first, uint32_t count, const std::vector<dsphere>& bounds) const
+{
+    uint32_t nodeIndex = static_cast<uint32_t>(_indexNodes.size());
+    _indexNodes.emplace_back();
+
+    // compute the box enclosing the child spheres in the range
+    dbox box;
+    for (uint32_t i = first; i < first + count; ++i)
+    {
+        const auto& bound = bounds[_leafChildren[i]];
+        box.add(bound.center - dvec3(bound.radius, bound.radius, bound.radius));
+        box.add(bound.center + dvec3(bound.radius, bound.radius, bound.radius));
+    }
+
+    _indexNodes[nodeIndex].bound.set((box.min + box.max) * 0.5, length(box.max - box.min) * 0.5);
+
+    if (count <= maxChildrenPerLeaf)
+    {
+        auto& leaf = _indexNodes[nodeIndex];
+        leaf.left = first;
+        leaf.count = count;
+        return nodeIndex;
+    }
+
+    // split at the median along the axis with the largest extent
+    auto extent = box.max - box.min;
+    uint32_t axis = 0;
+    if (extent.y > extent[axis]) axis = 1;
+    if (extent.z > extent[axis]) axis = 2;
+
+    uint32_t mid = count / 2;
+    auto begin = _leafChildren.begin() + first;
+    std::nth_element(begin, begin + mid, begin + count, [&bounds, axis](uint32_t lhs, uint32_t rhs) { return bounds[lhs].center[axis] < bounds[rhs].center[axis]; });
+
+    // recursion may reallocate _indexNodes so assign through the index afterwards
+    uint32_t leftIndex = _build(first, mid, bounds);
+    uint32_t rightIndex = _build(first + mid, count - mid, bounds);
+
+    auto& indexNode = _indexNodes[nodeIndex];
+    indexNode.left = leftIndex;
+    indexNode.right = rightIndex;
+
+    return nodeIndex;
+}
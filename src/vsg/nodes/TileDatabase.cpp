@@ -40,7 +40,9 @@ TileDatabaseSettings::TileDatabaseSettings(const TileDatabaseSettings& rhs, cons
     terrainLayer(rhs.terrainLayer),
     mipmapLevelsHint(rhs.mipmapLevelsHint),
     lighting(rhs.lighting),
-    shaderSet(copyop(rhs.shaderSet))
+    shaderSet(copyop(rhs.shaderSet)),
+    concurrentLoadThreads(rhs.concurrentLoadThreads),
+    tileCacheByteLimit(rhs.tileCacheByteLimit)
 {
 }
 
@@ -62,7 +64,9 @@ int TileDatabaseSettings::compare(const Object& rhs_object) const
     if ((result = compare_value(terrainLayer, rhs.terrainLayer)) != 0) return result;
     if ((result = compare_value(mipmapLevelsHint, rhs.mipmapLevelsHint)) != 0) return result;
     if ((result = compare_value(lighting, rhs.lighting)) != 0) return result;
-    return compare_pointer(shaderSet, rhs.shaderSet);
+    if ((result = compare_pointer(shaderSet, rhs.shaderSet)) != 0) return result;
+    if ((result = compare_value(concurrentLoadThreads, rhs.concurrentLoadThreads)) != 0) return result;
+    return compare_value(tileCacheByteLimit, rhs.tileCacheByteLimit);
 }
 
 void TileDatabaseSettings::read(vsg::Input& input)
@@ -147,6 +147,9 @@ void VertexDraw::record(CommandBuffer& commandBuffer) const
 
     VkCommandBuffer cmdBuffer{commandBuffer};
 
-    vkCmdBindVertexBuffers(cmdBuffer, firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data());
-    vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    if (commandBuffer.assignVertexBufferBindings(firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data()))
+    {
+        commandBuffer.dispatch->vkCmdBindVertexBuffers(cmdBuffer, firstBinding, static_cast<uint32_t>(vkd.vkBuffers.size()), vkd.vkBuffers.data(), vkd.offsets.data());
+    }
+    commandBuffer.dispatch->vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
 }
@@ -19,6 +19,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Exception.h>
 #include <vsg/core/observer_ptr.h>
 #include <vsg/io/Logger.h>
+#include <vsg/ui/EventPool.h>
 #include <vsg/ui/KeyEvent.h>
 #include <vsg/ui/TouchEvent.h>
 
@@ -409,7 +410,7 @@ bool Android_Window::handleAndroidInputEvent(AInputEvent* anEvent)
                     bufferedEvents.emplace_back(vsg::TouchDownEvent::create(this, historical_event_time, x, y, id));
                     break;
                 case AMOTION_EVENT_ACTION_MOVE:
-                    bufferedEvents.emplace_back(vsg::TouchMoveEvent::create(this, historical_event_time, x, y, id));
+                    bufferedEvents.emplace_back(eventPool->acquireTouchMoveEvent(this, historical_event_time, x, y, id));
                     break;
                 case AMOTION_EVENT_ACTION_UP:
                 case AMOTION_EVENT_ACTION_CANCEL: // for now just treat cancel as up
@@ -438,7 +439,7 @@ bool Android_Window::handleAndroidInputEvent(AInputEvent* anEvent)
                 break;
             case AMOTION_EVENT_ACTION_MOVE:
                 vsg::debug("touch move event = id: ", id, " - xy: ", x, ", ", y);
-                bufferedEvents.emplace_back(vsg::TouchMoveEvent::create(this, event_time, x, y, id));
+                bufferedEvents.emplace_back(eventPool->acquireTouchMoveEvent(this, event_time, x, y, id));
                 break;
             case AMOTION_EVENT_ACTION_UP:
             case AMOTION_EVENT_ACTION_CANCEL: // for now just treat cancel as up
@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Exception.h>
 #include <vsg/core/observer_ptr.h>
 #include <vsg/io/Logger.h>
+#include <vsg/ui/EventPool.h>
 #include <vsg/ui/KeyEvent.h>
 #include <vsg/ui/PointerEvent.h>
 #include <vsg/ui/TouchEvent.h>
@@ -895,7 +896,7 @@ bool MacOS_Window::handleNSEvent(NSEvent* anEvent)
                 case NSEventTypeRightMouseDragged:
                 case NSEventTypeOtherMouseDragged:
                 {
-                    bufferedEvents.emplace_back(vsg::MoveEvent::create(this, getEventTime([anEvent timestamp]), pos.x, contentRect.size.height - pos.y, vsg::ButtonMask(buttonMask)));
+                    bufferedEvents.emplace_back(eventPool->acquireMoveEvent(this, getEventTime([anEvent timestamp]), pos.x, contentRect.size.height - pos.y, vsg::ButtonMask(buttonMask)));
                     break;
                 }
                 case NSEventTypeLeftMouseDown:
@@ -974,7 +975,7 @@ bool MacOS_Window::handleNSEvent(NSEvent* anEvent)
         // scrollWheel events
         case NSEventTypeScrollWheel:
         {
-            bufferedEvents.emplace_back(vsg::ScrollWheelEvent::create(this, getEventTime([anEvent timestamp]), vsg::vec3([anEvent deltaX], [anEvent deltaY], [anEvent deltaZ])));
+            bufferedEvents.emplace_back(eventPool->acquireScrollWheelEvent(this, getEventTime([anEvent timestamp]), vsg::vec3([anEvent deltaX], [anEvent deltaY], [anEvent deltaZ])));
             return true;
         }
 
@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
 #include <vsg/platform/win32/Win32_Window.h>
+#include <vsg/ui/EventPool.h>
 #include <vsg/ui/ScrollWheelEvent.h>
 
 using namespace vsg;
@@ -568,7 +569,7 @@ bool Win32_Window::handleWin32Messages(UINT msg, WPARAM wParam, LPARAM lParam)
         int32_t mx = GET_X_LPARAM(lParam);
         int32_t my = GET_Y_LPARAM(lParam);
 
-        bufferedEvents.emplace_back(vsg::MoveEvent::create(this, event_time, mx, my, getButtonMask(wParam)));
+        bufferedEvents.emplace_back(eventPool->acquireMoveEvent(this, event_time, mx, my, getButtonMask(wParam)));
         return true;
     }
     break;
@@ -601,7 +602,7 @@ bool Win32_Window::handleWin32Messages(UINT msg, WPARAM wParam, LPARAM lParam)
     }
     break;
     case WM_MOUSEWHEEL: {
-        bufferedEvents.emplace_back(vsg::ScrollWheelEvent::create(this, event_time, GET_WHEEL_DELTA_WPARAM(wParam) < 0 ? vec3(0.0f, -1.0f, 0.0f) : vec3(0.0f, 1.0f, 0.0f)));
+        bufferedEvents.emplace_back(eventPool->acquireScrollWheelEvent(this, event_time, GET_WHEEL_DELTA_WPARAM(wParam) < 0 ? vec3(0.0f, -1.0f, 0.0f) : vec3(0.0f, 1.0f, 0.0f)));
         return true;
     }
     case WM_MOVE: {
@@ -14,6 +14,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Logger.h>
 #include <vsg/platform/xcb/Xcb_Window.h>
 #include <vsg/ui/ApplicationEvent.h>
+#include <vsg/ui/EventPool.h>
 #include <vsg/ui/PointerEvent.h>
 #include <vsg/ui/ScrollWheelEvent.h>
 
@@ -510,10 +511,19 @@ Xcb_Window::Xcb_Window(vsg::ref_ptr<WindowTraits> traits) :
 
     traits->nativeWindow = _window;
     traits->systemConnection = _connection;
+
+    // optionally drain xcb events on a dedicated thread so the frame loop's pollEvents()
+    // just splices an already filled queue rather than making xcb calls
+    if (traits->dedicatedEventThread)
+    {
+        _startEventThread();
+    }
 }
 
 Xcb_Window::~Xcb_Window()
 {
+    _stopEventThread();
+
     // detach Vulkan objects
     clear();
 
@@ -571,19 +581,14 @@ namespace
     }
 }
 
-bool Xcb_Window::pollEvents(UIEvents& events)
+void Xcb_Window::_handleXcbEvent(xcb_generic_event_t* event, vsg::UIEvents& destination)
 {
-    xcb_generic_event_t* event;
-    int i = 0;
-    while ((event = xcb_poll_for_event(_connection)))
+    uint8_t response_type = event->response_type & ~0x80;
+    switch (response_type)
     {
-        ++i;
-        uint8_t response_type = event->response_type & ~0x80;
-        switch (response_type)
-        {
         case (XCB_DESTROY_NOTIFY): {
             vsg::clock::time_point event_time = vsg::clock::now();
-            bufferedEvents.emplace_back(vsg::TerminateEvent::create(event_time));
+            destination.emplace_back(vsg::TerminateEvent::create(event_time));
             break;
         }
         case (XCB_UNMAP_NOTIFY): {
@@ -610,12 +615,12 @@ bool Xcb_Window::pollEvents(UIEvents& events)
         }
         case (XCB_FOCUS_IN): {
             vsg::clock::time_point event_time = vsg::clock::now();
-            bufferedEvents.emplace_back(vsg::FocusInEvent::create(this, event_time));
+            destination.emplace_back(vsg::FocusInEvent::create(this, event_time));
             break;
         }
         case (XCB_FOCUS_OUT): {
             vsg::clock::time_point event_time = vsg::clock::now();
-            bufferedEvents.emplace_back(vsg::FocusOutEvent::create(this, event_time));
+            destination.emplace_back(vsg::FocusOutEvent::create(this, event_time));
             break;
         }
         case (XCB_ENTER_NOTIFY): {
@@ -637,7 +642,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             vsgXcb::getWindowGeometry(_connection, _window, x, y, width, height);
 
             bool previousConfigureEventsIsEqual = false;
-            for (auto previousEvent : events)
+            for (auto previousEvent : destination)
             {
                 vsg::ConfigureWindowEvent* cwe = dynamic_cast<vsg::ConfigureWindowEvent*>(previousEvent.get());
                 if (cwe)
@@ -649,7 +654,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             if (!previousConfigureEventsIsEqual)
             {
                 vsg::clock::time_point event_time = vsg::clock::now();
-                bufferedEvents.emplace_back(vsg::ConfigureWindowEvent::create(this, event_time, x, y, width, height));
+                destination.emplace_back(vsg::ConfigureWindowEvent::create(this, event_time, x, y, width, height));
                 _extent2D.width = width;
                 _extent2D.height = height;
             }
@@ -660,7 +665,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             auto expose = reinterpret_cast<const xcb_expose_event_t*>(event);
 
             vsg::clock::time_point event_time = vsg::clock::now();
-            bufferedEvents.emplace_back(vsg::ExposeWindowEvent::create(this, event_time, expose->x, expose->y, expose->width, expose->height));
+            destination.emplace_back(vsg::ExposeWindowEvent::create(this, event_time, expose->x, expose->y, expose->width, expose->height));
 
             break;
         }
@@ -670,7 +675,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             if (client_message->data.data32[0] == _wmDeleteWindow)
             {
                 vsg::clock::time_point event_time = vsg::clock::now();
-                bufferedEvents.emplace_back(vsg::CloseWindowEvent::create(this, event_time));
+                destination.emplace_back(vsg::CloseWindowEvent::create(this, event_time));
             }
             break;
         }
@@ -682,7 +687,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             vsg::KeySymbol keySymbolModified = _keyboard->getKeySymbol(key_press->detail, key_press->state);
             vsg::KeyModifier keyModifier = _keyboard->getKeyModifier(keySymbol, key_press->state, true);
 
-            bufferedEvents.emplace_back(vsg::KeyPressEvent::create(this, event_time, keySymbol, keySymbolModified, keyModifier, 0));
+            destination.emplace_back(vsg::KeyPressEvent::create(this, event_time, keySymbol, keySymbolModified, keyModifier, 0));
 
             break;
         }
@@ -694,7 +699,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             vsg::KeySymbol keySymbolModified = _keyboard->getKeySymbol(key_release->detail, key_release->state);
             vsg::KeyModifier keyModifier = _keyboard->getKeyModifier(keySymbol, key_release->state, false);
 
-            bufferedEvents.emplace_back(vsg::KeyReleaseEvent::create(this, event_time, keySymbol, keySymbolModified, keyModifier, 0));
+            destination.emplace_back(vsg::KeyReleaseEvent::create(this, event_time, keySymbol, keySymbolModified, keyModifier, 0));
 
             break;
         }
@@ -708,11 +713,11 @@ bool Xcb_Window::pollEvents(UIEvents& events)
                 // X11/Xcb treat scroll wheel up/down as button 4 and 5 so handle these as such
                 if (button_press->detail == 4)
                 {
-                    bufferedEvents.emplace_back(vsg::ScrollWheelEvent::create(this, event_time, vsg::vec3(0.0f, 1.0f, 0.0f)));
+                    destination.emplace_back(eventPool->acquireScrollWheelEvent(this, event_time, vsg::vec3(0.0f, 1.0f, 0.0f)));
                 }
                 else if (button_press->detail == 5)
                 {
-                    bufferedEvents.emplace_back(vsg::ScrollWheelEvent::create(this, event_time, vsg::vec3(0.0f, -1.0f, 0.0f)));
+                    destination.emplace_back(eventPool->acquireScrollWheelEvent(this, event_time, vsg::vec3(0.0f, -1.0f, 0.0f)));
                 }
                 else
                 {
@@ -724,7 +729,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
 
                     uint16_t pressedButtonMask = BUTTON_MASK_1 << (button-1);
                     uint16_t newButtonMask = maskButtons(button_press->state) | pressedButtonMask;
-                    bufferedEvents.emplace_back(vsg::ButtonPressEvent::create(this, event_time, button_press->event_x, button_press->event_y, vsg::ButtonMask(newButtonMask), button));
+                    destination.emplace_back(vsg::ButtonPressEvent::create(this, event_time, button_press->event_x, button_press->event_y, vsg::ButtonMask(newButtonMask), button));
                 }
             }
 
@@ -746,7 +751,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
 
                 uint16_t releasedButtonMask = BUTTON_MASK_1 << (button-1);
                 uint16_t newButtonMask = maskButtons(button_release->state) & ~releasedButtonMask;
-                bufferedEvents.emplace_back(vsg::ButtonReleaseEvent::create(this, event_time, button_release->event_x, button_release->event_y, vsg::ButtonMask(newButtonMask), button));
+                destination.emplace_back(vsg::ButtonReleaseEvent::create(this, event_time, button_release->event_x, button_release->event_y, vsg::ButtonMask(newButtonMask), button));
             }
 
             break;
@@ -756,7 +761,7 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             if (motion_notify->same_screen)
             {
                 vsg::clock::time_point event_time = _first_xcb_time_point + std::chrono::milliseconds(motion_notify->time - _first_xcb_timestamp);
-                bufferedEvents.emplace_back(vsg::MoveEvent::create(this, event_time, motion_notify->event_x, motion_notify->event_y, vsg::ButtonMask(maskButtons(motion_notify->state))));
+                destination.emplace_back(eventPool->acquireMoveEvent(this, event_time, motion_notify->event_x, motion_notify->event_y, vsg::ButtonMask(maskButtons(motion_notify->state))));
             }
 
             break;
@@ -769,17 +774,74 @@ bool Xcb_Window::pollEvents(UIEvents& events)
             //debug("generic_event->event_type = ", generic_event->event_type);
             break;
         }
-        default: {
-            warn("xcb_event type not handled, response_type = ", static_cast<int>(response_type));
-            break;
-        }
+    default: {
+        warn("xcb_event type not handled, response_type = ", static_cast<int>(response_type));
+        break;
+    }
+    }
+}
+
+bool Xcb_Window::pollEvents(UIEvents& events)
+{
+    if (_eventThreadActive)
+    {
+        // the dedicated event thread has already drained the xcb queue, so just take over its events
+        std::scoped_lock<std::mutex> lock(_eventThreadMutex);
+        bufferedEvents.splice(bufferedEvents.end(), _eventThreadEvents);
+    }
+    else
+    {
+        xcb_generic_event_t* event;
+        while ((event = xcb_poll_for_event(_connection)))
+        {
+            _handleXcbEvent(event, bufferedEvents);
+            free(event);
         }
-        free(event);
     }
 
     return Window::pollEvents(events);
 }
 
+void Xcb_Window::_startEventThread()
+{
+    _eventThreadActive = true;
+    _eventThread = std::thread([this]() {
+        xcb_generic_event_t* event;
+        while (_eventThreadActive && (event = xcb_wait_for_event(_connection)))
+        {
+            std::scoped_lock<std::mutex> lock(_eventThreadMutex);
+            _handleXcbEvent(event, _eventThreadEvents);
+            free(event);
+
+            // drain any further queued events while we hold the lock
+            while ((event = xcb_poll_for_event(_connection)))
+            {
+                _handleXcbEvent(event, _eventThreadEvents);
+                free(event);
+            }
+        }
+        _eventThreadActive = false;
+    });
+}
+
+void Xcb_Window::_stopEventThread()
+{
+    if (!_eventThread.joinable()) return;
+
+    _eventThreadActive = false;
+
+    // send a no-op client message so the blocking xcb_wait_for_event() call returns
+    xcb_client_message_event_t wakeup = {};
+    wakeup.response_type = XCB_CLIENT_MESSAGE;
+    wakeup.format = 32;
+    wakeup.window = _window;
+    wakeup.type = _wmProtocols;
+    xcb_send_event(_connection, false, _window, XCB_EVENT_MASK_NO_EVENT, reinterpret_cast<const char*>(&wakeup));
+    xcb_flush(_connection);
+
+    _eventThread.join();
+}
+
 void Xcb_Window::resize()
 {
     xcb_get_geometry_reply_t* geometry_reply = xcb_get_geometry_reply(_connection, xcb_get_geometry(_connection, _window), nullptr);
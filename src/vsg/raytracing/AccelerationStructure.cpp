@@ -55,6 +55,9 @@ void AccelerationStructure::compile(Context& context)
 {
     auto extensions = context.device->getExtensions();
 
+    if (allowUpdate) _accelerationStructureBuildGeometryInfo.flags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
+    if (allowCompaction) _accelerationStructureBuildGeometryInfo.flags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
+
     VkAccelerationStructureBuildSizesInfoKHR accelerationStructureBuildSizesInfo{};
     accelerationStructureBuildSizesInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR;
     extensions->vkGetAccelerationStructureBuildSizesKHR(
@@ -64,8 +67,26 @@ void AccelerationStructure::compile(Context& context)
         _geometryPrimitiveCounts.data(),
         &accelerationStructureBuildSizesInfo);
 
-    _buffer = vsg::createBufferAndMemory(context.device, accelerationStructureBuildSizesInfo.accelerationStructureSize,
-                                         VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    const VkBufferUsageFlags bufferUsage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    // suballocate the backing storage from the device memory pools so that many acceleration structures
+    // share larger buffers/memory allocations, acceleration structure offsets must be a multiple of 256
+    if (context.deviceMemoryBufferPools)
+    {
+        _bufferInfo = context.deviceMemoryBufferPools->reserveBuffer(accelerationStructureBuildSizesInfo.accelerationStructureSize, 256, bufferUsage, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+
+    if (_bufferInfo)
+    {
+        _buffer = _bufferInfo->buffer;
+        _accelerationStructureInfo.offset = _bufferInfo->offset;
+    }
+    else
+    {
+        // fall back to a dedicated buffer and memory allocation
+        _buffer = vsg::createBufferAndMemory(context.device, accelerationStructureBuildSizesInfo.accelerationStructureSize,
+                                             bufferUsage, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
 
     _accelerationStructureInfo.buffer = _buffer->vk(context.deviceID);
     _accelerationStructureInfo.size = accelerationStructureBuildSizesInfo.accelerationStructureSize;
@@ -78,6 +99,7 @@ void AccelerationStructure::compile(Context& context)
         _handle = extensions->vkGetAccelerationStructureDeviceAddressKHR(*context.device, &deviceAddressInfo);
 
         _requiredBuildScratchSize = accelerationStructureBuildSizesInfo.buildScratchSize;
+        _requiredUpdateScratchSize = accelerationStructureBuildSizesInfo.updateScratchSize;
         context.scratchBufferSize = std::max(_requiredBuildScratchSize, context.scratchBufferSize);
     }
     else
@@ -85,3 +107,13 @@ void AccelerationStructure::compile(Context& context)
         throw Exception{"Error: vsg::AccelerationStructure::compile(...) failed to create AccelerationStructure.", result};
     }
 }
+
+ref_ptr<BuildAccelerationStructureCommand> AccelerationStructure::createUpdateCommand()
+{
+    if (!_accelerationStructure || !allowUpdate) return {};
+
+    auto command = BuildAccelerationStructureCommand::create(_device, _accelerationStructureBuildGeometryInfo, _accelerationStructure, _geometryPrimitiveCounts);
+    command->_accelerationStructureInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+    command->_accelerationStructureInfo.srcAccelerationStructure = _accelerationStructure;
+    return command;
+}
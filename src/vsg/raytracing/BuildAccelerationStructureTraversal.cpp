@@ -10,8 +10,11 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <algorithm>
+
 #include <vsg/io/Options.h>
 #include <vsg/raytracing/BuildAccelerationStructureTraversal.h>
+#include <vsg/vk/Context.h>
 
 using namespace vsg;
 
@@ -88,3 +91,45 @@ void BuildAccelerationStructureTraversal::createGeometryInstance(BottomLevelAcce
 
     tlas->geometryInstances.push_back(geominst);
 }
+
+ref_ptr<Commands> BuildAccelerationStructureTraversal::createUpdateCommands()
+{
+    if (_updateCommands) return _updateCommands;
+
+    // collect the refit commands, bottom level structures first so the top level refit sees their updated state,
+    // and size the shared scratch buffer to the largest requirement
+    std::vector<ref_ptr<BuildAccelerationStructureCommand>> updateCommands;
+    VkDeviceSize scratchSize = 0;
+
+    auto addUpdateCommand = [&](AccelerationStructure& as) {
+        if (auto command = as.createUpdateCommand())
+        {
+            updateCommands.push_back(command);
+            scratchSize = std::max(scratchSize, as.requiredUpdateScratchSize());
+        }
+    };
+
+    for (auto& [vid, blas] : _vertexIndexDrawBlasMap) addUpdateCommand(*blas);
+    for (auto& [geometry, blas] : _geometryBlasMap) addUpdateCommand(*blas);
+    if (tlas) addUpdateCommand(*tlas);
+
+    if (updateCommands.empty()) return {};
+
+    // a single scratch buffer can be shared between the refits as each BuildAccelerationStructureCommand
+    // records an acceleration structure build to build memory barrier after its build call
+    if (scratchSize > 0)
+    {
+        _updateScratchBuffer = createBufferAndMemory(_device, scratchSize,
+                                                     VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+                                                     VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+
+    _updateCommands = Commands::create();
+    for (auto& command : updateCommands)
+    {
+        command->setScratchBuffer(_updateScratchBuffer);
+        _updateCommands->addChild(command);
+    }
+
+    return _updateCommands;
+}
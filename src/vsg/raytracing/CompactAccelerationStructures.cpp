@@ -0,0 +1,162 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/raytracing/CompactAccelerationStructures.h>
+#include <vsg/state/QueryPool.h>
+#include <vsg/vk/SubmitCommands.h>
+
+using namespace vsg;
+
+CompactAccelerationStructures::CompactAccelerationStructures(Device* device, ref_ptr<Queue> in_queue) :
+    _device(device),
+    _queue(in_queue)
+{
+    memoryBufferPools = MemoryBufferPools::create("AccelerationStructure_CompactionPools", _device);
+}
+
+void CompactAccelerationStructures::add(ref_ptr<AccelerationStructure> accelerationStructure)
+{
+    if (!accelerationStructure || !accelerationStructure->allowCompaction) return;
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _pending.push_back(accelerationStructure);
+}
+
+bool CompactAccelerationStructures::pending() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return !_pending.empty();
+}
+
+void CompactAccelerationStructures::run()
+{
+    // take the next batch of structures to compact
+    std::vector<ref_ptr<AccelerationStructure>> batch;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        while (!_pending.empty() && batch.size() < maxCompactionsPerRun)
+        {
+            batch.push_back(_pending.front());
+            _pending.pop_front();
+        }
+    }
+
+    if (batch.empty()) return;
+
+    auto extensions = _device->getExtensions();
+    if (!extensions->vkCmdWriteAccelerationStructuresPropertiesKHR || !extensions->vkCmdCopyAccelerationStructureKHR)
+    {
+        warn("CompactAccelerationStructures::run() acceleration structure compaction functions not available.");
+        return;
+    }
+
+    if (!_commandPool) _commandPool = CommandPool::create(_device, _queue->queueFamilyIndex(), VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+    if (!_fence) _fence = Fence::create(_device);
+
+    uint32_t count = static_cast<uint32_t>(batch.size());
+
+    std::vector<VkAccelerationStructureKHR> sources(count);
+    for (uint32_t i = 0; i < count; ++i) sources[i] = *batch[i];
+
+    const uint64_t timeout = 1000000000;
+
+    // query the compacted sizes of the batch
+    auto queryPool = QueryPool::create(_device.get(), VkQueryPoolCreateFlags{0}, VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, count, VkQueryPipelineStatisticFlags{0});
+
+    _fence->reset();
+    submitCommandsToQueue(_commandPool, _fence, timeout, _queue, [&](CommandBuffer& commandBuffer) {
+        vkCmdResetQueryPool(commandBuffer, *queryPool, 0, count);
+        extensions->vkCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, count, sources.data(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, *queryPool, 0);
+    });
+
+    std::vector<uint64_t> compactedSizes(count);
+    if (queryPool->getResults(compactedSizes) != VK_SUCCESS)
+    {
+        warn("CompactAccelerationStructures::run() failed to read compacted sizes, requeuing batch.");
+        std::scoped_lock<std::mutex> lock(_mutex);
+        for (auto& accelerationStructure : batch) _pending.push_back(accelerationStructure);
+        return;
+    }
+
+    // create the compacted structures in storage suballocated from the pools
+    struct CompactedStructure
+    {
+        VkAccelerationStructureKHR accelerationStructure = VK_NULL_HANDLE;
+        VkAccelerationStructureCreateInfoKHR info = {};
+        ref_ptr<BufferInfo> bufferInfo;
+    };
+
+    const VkBufferUsageFlags bufferUsage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    std::vector<CompactedStructure> compacted(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        auto& destination = compacted[i];
+        destination.bufferInfo = memoryBufferPools->reserveBuffer(compactedSizes[i], 256, bufferUsage, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        if (!destination.bufferInfo)
+        {
+            warn("CompactAccelerationStructures::run() failed to reserve compacted storage, skipping structure.");
+            continue;
+        }
+
+        destination.info = batch[i]->_accelerationStructureInfo;
+        destination.info.buffer = destination.bufferInfo->buffer->vk(_device->deviceID);
+        destination.info.offset = destination.bufferInfo->offset;
+        destination.info.size = compactedSizes[i];
+
+        if (VkResult result = extensions->vkCreateAccelerationStructureKHR(*_device, &destination.info, nullptr, &destination.accelerationStructure); result != VK_SUCCESS)
+        {
+            warn("CompactAccelerationStructures::run() failed to create compacted acceleration structure. VkResult = ", result);
+            destination.bufferInfo->release();
+            destination.bufferInfo = {};
+        }
+    }
+
+    // copy into the compacted structures
+    _fence->reset();
+    submitCommandsToQueue(_commandPool, _fence, timeout, _queue, [&](CommandBuffer& commandBuffer) {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (!compacted[i].accelerationStructure) continue;
+
+            VkCopyAccelerationStructureInfoKHR copyInfo{};
+            copyInfo.sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR;
+            copyInfo.src = sources[i];
+            copyInfo.dst = compacted[i].accelerationStructure;
+            copyInfo.mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR;
+            extensions->vkCmdCopyAccelerationStructureKHR(commandBuffer, &copyInfo);
+        }
+    });
+
+    // release the original structures and storage and swap in the compacted replacements
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (!compacted[i].accelerationStructure) continue;
+
+        auto& accelerationStructure = *batch[i];
+
+        extensions->vkDestroyAccelerationStructureKHR(*_device, accelerationStructure._accelerationStructure, nullptr);
+        if (accelerationStructure._bufferInfo) accelerationStructure._bufferInfo->release();
+
+        accelerationStructure._accelerationStructure = compacted[i].accelerationStructure;
+        accelerationStructure._accelerationStructureInfo = compacted[i].info;
+        accelerationStructure._bufferInfo = compacted[i].bufferInfo;
+        accelerationStructure._buffer = compacted[i].bufferInfo->buffer;
+
+        VkAccelerationStructureDeviceAddressInfoKHR deviceAddressInfo{};
+        deviceAddressInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
+        deviceAddressInfo.accelerationStructure = accelerationStructure._accelerationStructure;
+        accelerationStructure._handle = extensions->vkGetAccelerationStructureDeviceAddressKHR(*_device, &deviceAddressInfo);
+    }
+}
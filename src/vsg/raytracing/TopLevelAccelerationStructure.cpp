@@ -56,25 +56,47 @@ void TopLevelAccelerationStructure::compile(Context& context)
     auto instanceBufferInfo = vsg::createBufferAndTransferData(context, dataList, VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR, VK_SHARING_MODE_EXCLUSIVE);
     _instanceBuffer = instanceBufferInfo[0].buffer;
 #else
-    auto instanceBufferInfo = vsg::createHostVisibleBuffer(context.device, dataList, VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR, VK_SHARING_MODE_EXCLUSIVE);
-    vsg::copyDataListToBuffers(context.device, instanceBufferInfo);
-    _instanceBuffer = instanceBufferInfo[0]->buffer;
+    _instanceBufferInfo = vsg::createHostVisibleBuffer(context.device, dataList, VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR, VK_SHARING_MODE_EXCLUSIVE);
+    vsg::copyDataListToBuffers(context.device, _instanceBufferInfo);
+    _instanceBuffer = _instanceBufferInfo[0]->buffer;
 #endif
     auto extensions = _device->getExtensions();
     VkBufferDeviceAddressInfo bufferDeviceAddressInfo{VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO, nullptr, _instanceBuffer->vk(context.deviceID)};
-    VkAccelerationStructureGeometryKHR accelerationStructureGeometry{};
-    accelerationStructureGeometry.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
-    accelerationStructureGeometry.geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR;
-    accelerationStructureGeometry.flags = VK_GEOMETRY_OPAQUE_BIT_KHR;
-    accelerationStructureGeometry.geometry.instances.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR;
-    accelerationStructureGeometry.geometry.instances.arrayOfPointers = VK_FALSE;
-    accelerationStructureGeometry.geometry.instances.data.deviceAddress = extensions->vkGetBufferDeviceAddressKHR(*context.device, &bufferDeviceAddressInfo);
+
+    // keep the geometry struct as a member so the build geometry info remains valid for update commands
+    // created after compile
+    _accelerationStructureGeometry = {};
+    _accelerationStructureGeometry.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
+    _accelerationStructureGeometry.geometryType = VK_GEOMETRY_TYPE_INSTANCES_KHR;
+    _accelerationStructureGeometry.flags = VK_GEOMETRY_OPAQUE_BIT_KHR;
+    _accelerationStructureGeometry.geometry.instances.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR;
+    _accelerationStructureGeometry.geometry.instances.arrayOfPointers = VK_FALSE;
+    _accelerationStructureGeometry.geometry.instances.data.deviceAddress = extensions->vkGetBufferDeviceAddressKHR(*context.device, &bufferDeviceAddressInfo);
 
     _accelerationStructureBuildGeometryInfo.geometryCount = 1;
-    _accelerationStructureBuildGeometryInfo.pGeometries = &accelerationStructureGeometry;
+    _accelerationStructureBuildGeometryInfo.pGeometries = &_accelerationStructureGeometry;
     _geometryPrimitiveCounts = {static_cast<uint32_t>(_instances->valueCount())};
 
     Inherit::compile(context);
 
     context.buildAccelerationStructureCommands.push_back(BuildAccelerationStructureCommand::create(context.device, _accelerationStructureBuildGeometryInfo, _accelerationStructure, _geometryPrimitiveCounts));
 }
+
+bool TopLevelAccelerationStructure::updateInstances()
+{
+    if (!_instances || _instanceBufferInfo.empty()) return false;
+
+    if (geometryInstances.size() != _instances->valueCount())
+    {
+        warn("TopLevelAccelerationStructure::updateInstances() instance count has changed, a full compile is required.");
+        return false;
+    }
+
+    for (uint32_t i = 0; i < geometryInstances.size(); i++)
+    {
+        _instances->set(i, *geometryInstances[i]);
+    }
+
+    vsg::copyDataListToBuffers(_device, _instanceBufferInfo);
+    return true;
+}
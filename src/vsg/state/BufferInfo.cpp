@@ -132,7 +132,7 @@ void BufferInfo::copyDataToBuffer(uint32_t deviceID)
         }
 
         char* ptr = reinterpret_cast<char*>(buffer_data);
-        std::memcpy(ptr, data->dataPointer(), data->dataSize());
+        std::memcpy(ptr, data->constDataPointer(), data->dataSize());
 
         dm->unmap();
     }
@@ -160,7 +160,7 @@ ref_ptr<BufferInfo> vsg::copyDataToStagingBuffer(Context& context, const Data* d
     if (!imageStagingMemory) return {};
 
     // copy data to staging memory
-    imageStagingMemory->copy(imageStagingBuffer->getMemoryOffset(context.deviceID) + stagingBufferInfo->offset, imageTotalSize, data->dataPointer());
+    imageStagingMemory->copy(imageStagingBuffer->getMemoryOffset(context.deviceID) + stagingBufferInfo->offset, imageTotalSize, data->constDataPointer());
 
     debug("Creating imageStagingBuffer and memory size = ", imageTotalSize);
 
@@ -299,7 +299,10 @@ bool vsg::createBufferAndTransferData(Context& context, const BufferInfoList& bu
         const Data* data = bufferInfo->data;
         if (data)
         {
-            std::memcpy(ptr + bufferInfo->offset - deviceBufferInfo->offset, data->dataPointer(), data->dataSize());
+            std::memcpy(ptr + bufferInfo->offset - deviceBufferInfo->offset, data->constDataPointer(), data->dataSize());
+
+            // schedule the CPU side copy to be unreffed once the transfer is confirmed complete
+            if (data->properties.dataVariance == STATIC_DATA_UNREF_AFTER_TRANSFER) context.bufferInfosToRelease.push_back(bufferInfo);
         }
         bufferInfo->parent = deviceBufferInfo;
     }
@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 #include <vsg/state/ComputePipeline.h>
 #include <vsg/vk/Context.h>
+#include <vsg/vk/PipelineCache.h>
 
 using namespace vsg;
 
@@ -108,7 +109,8 @@ ComputePipeline::Implementation::Implementation(Context& context, Device* device
     pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
     pipelineInfo.pNext = nullptr;
 
-    if (VkResult result = vkCreateComputePipelines(*device, VK_NULL_HANDLE, 1, &pipelineInfo, _device->getAllocationCallbacks(), &_pipeline); result != VK_SUCCESS)
+    VkPipelineCache pipelineCache = device->pipelineCache ? device->pipelineCache->vk() : VK_NULL_HANDLE;
+    if (VkResult result = vkCreateComputePipelines(*device, pipelineCache, 1, &pipelineInfo, _device->getAllocationCallbacks(), &_pipeline); result != VK_SUCCESS)
     {
         throw Exception{"Error: vsg::ComputePipeline failed to create VkPipeline.", result};
     }
@@ -158,7 +160,7 @@ void BindComputePipeline::write(Output& output) const
 
 void BindComputePipeline::record(CommandBuffer& commandBuffer) const
 {
-    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline->vk(commandBuffer.deviceID));
+    commandBuffer.dispatch->vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline->vk(commandBuffer.deviceID));
     commandBuffer.setCurrentPipelineLayout(pipeline->layout);
 }
 
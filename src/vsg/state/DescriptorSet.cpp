@@ -135,21 +135,9 @@ DescriptorSet::Implementation::~Implementation()
 
 void DescriptorSet::Implementation::assign(Context& context, const Descriptors& in_descriptors)
 {
-    if (in_descriptors.empty()) return;
-
-    VkWriteDescriptorSet* descriptorWrites = context.scratchMemory->allocate<VkWriteDescriptorSet>(in_descriptors.size());
-
-    for (size_t i = 0; i < in_descriptors.size(); ++i)
-    {
-        in_descriptors[i]->assignTo(context, descriptorWrites[i]);
-        descriptorWrites[i].dstSet = _descriptorSet;
-    }
-
-    auto device = _descriptorPool->getDevice();
-    vkUpdateDescriptorSets(*device, static_cast<uint32_t>(in_descriptors.size()), descriptorWrites, 0, nullptr);
-
-    // clean up scratch memory so it can be reused.
-    context.scratchMemory->release();
+    // accumulate the writes in the Context so that all the descriptor sets compiled in a traversal are
+    // applied in a single vkUpdateDescriptorSets call when the Context flushes, rather than one call per set.
+    context.batchDescriptorWrites(_descriptorSet, in_descriptors);
 }
 
 void DescriptorSet::Implementation::recycle(ref_ptr<DescriptorSet::Implementation>& dsi)
@@ -29,7 +29,9 @@ DescriptorSetLayout::DescriptorSetLayout()
 
 DescriptorSetLayout::DescriptorSetLayout(const DescriptorSetLayout& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
-    bindings(rhs.bindings)
+    bindings(rhs.bindings),
+    flags(rhs.flags),
+    bindingFlags(rhs.bindingFlags)
 {
 }
 
@@ -68,7 +70,9 @@ int DescriptorSetLayout::compare(const Object& rhs_object) const
     if (result != 0) return result;
 
     auto& rhs = static_cast<decltype(*this)>(rhs_object);
-    return compare_value_container(bindings, rhs.bindings);
+    if ((result = compare_value_container(bindings, rhs.bindings))) return result;
+    if ((result = compare_value(flags, rhs.flags))) return result;
+    return compare_value_container(bindingFlags, rhs.bindingFlags);
 }
 
 void DescriptorSetLayout::read(Input& input)
@@ -84,6 +88,12 @@ void DescriptorSetLayout::read(Input& input)
         input.read("descriptorCount", dslb.descriptorCount);
         input.readValue<uint32_t>("stageFlags", dslb.stageFlags);
     }
+
+    if (input.version_greater_equal(1, 1, 5))
+    {
+        input.readValue<uint32_t>("flags", flags);
+        input.readValues("bindingFlags", bindingFlags);
+    }
 }
 
 void DescriptorSetLayout::write(Output& output) const
@@ -99,26 +109,42 @@ void DescriptorSetLayout::write(Output& output) const
         output.write("descriptorCount", dslb.descriptorCount);
         output.writeValue<uint32_t>("stageFlags", dslb.stageFlags);
     }
+
+    if (output.version_greater_equal(1, 1, 5))
+    {
+        output.writeValue<uint32_t>("flags", flags);
+        output.writeValues("bindingFlags", bindingFlags);
+    }
 }
 
 void DescriptorSetLayout::compile(Context& context)
 {
-    if (!_implementation[context.deviceID]) _implementation[context.deviceID] = DescriptorSetLayout::Implementation::create(context.device, bindings);
+    if (!_implementation[context.deviceID]) _implementation[context.deviceID] = DescriptorSetLayout::Implementation::create(context.device, bindings, flags, bindingFlags);
 }
 
 //////////////////////////////////////
 //
 // DescriptorSetLayout::Implementation
 //
-DescriptorSetLayout::Implementation::Implementation(Device* device, const DescriptorSetLayoutBindings& descriptorSetLayoutBindings) :
+DescriptorSetLayout::Implementation::Implementation(Device* device, const DescriptorSetLayoutBindings& descriptorSetLayoutBindings, VkDescriptorSetLayoutCreateFlags descriptorSetLayoutCreateFlags, const std::vector<VkDescriptorBindingFlags>& descriptorBindingFlags) :
     _device(device)
 {
     VkDescriptorSetLayoutCreateInfo layoutInfo = {};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.flags = descriptorSetLayoutCreateFlags;
     layoutInfo.bindingCount = static_cast<uint32_t>(descriptorSetLayoutBindings.size());
     layoutInfo.pBindings = descriptorSetLayoutBindings.data();
     layoutInfo.pNext = nullptr;
 
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo = {};
+    if (!descriptorBindingFlags.empty())
+    {
+        bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        bindingFlagsInfo.bindingCount = static_cast<uint32_t>(descriptorBindingFlags.size());
+        bindingFlagsInfo.pBindingFlags = descriptorBindingFlags.data();
+        layoutInfo.pNext = &bindingFlagsInfo;
+    }
+
     if (VkResult result = vkCreateDescriptorSetLayout(*device, &layoutInfo, _device->getAllocationCallbacks(), &_descriptorSetLayout); result != VK_SUCCESS)
     {
         throw Exception{"Error: Failed to create DescriptorSetLayout.", result};
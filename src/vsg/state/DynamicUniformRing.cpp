@@ -0,0 +1,161 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Exception.h>
+#include <vsg/core/compare.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/state/DynamicUniformRing.h>
+#include <vsg/vk/Context.h>
+
+#include <cstring>
+
+using namespace vsg;
+
+DynamicUniformRing::DynamicUniformRing(uint32_t in_dstBinding, VkDeviceSize in_blockSize, VkDeviceSize in_bytesPerFrame, uint32_t in_framesInFlight) :
+    Inherit(in_dstBinding, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC),
+    blockSize(in_blockSize),
+    bytesPerFrame(in_bytesPerFrame),
+    framesInFlight(in_framesInFlight)
+{
+}
+
+DynamicUniformRing::~DynamicUniformRing()
+{
+    for (uint32_t deviceID = 0; deviceID < _deviceData.size(); ++deviceID)
+    {
+        auto& deviceData = _deviceData[deviceID];
+        if (deviceData.mapped && deviceData.buffer)
+        {
+            if (auto deviceMemory = deviceData.buffer->getDeviceMemory(deviceID)) deviceMemory->unmap();
+        }
+    }
+}
+
+int DynamicUniformRing::compare(const Object& rhs_object) const
+{
+    int result = Descriptor::compare(rhs_object);
+    if (result != 0) return result;
+
+    const auto& rhs = static_cast<decltype(*this)>(rhs_object);
+
+    if ((result = compare_value(blockSize, rhs.blockSize)) != 0) return result;
+    if ((result = compare_value(bytesPerFrame, rhs.bytesPerFrame)) != 0) return result;
+    return compare_value(framesInFlight, rhs.framesInFlight);
+}
+
+void DynamicUniformRing::read(Input& input)
+{
+    Descriptor::read(input);
+
+    input.readValue<uint64_t>("blockSize", blockSize);
+    input.readValue<uint64_t>("bytesPerFrame", bytesPerFrame);
+    input.read("framesInFlight", framesInFlight);
+}
+
+void DynamicUniformRing::write(Output& output) const
+{
+    Descriptor::write(output);
+
+    output.writeValue<uint64_t>("blockSize", blockSize);
+    output.writeValue<uint64_t>("bytesPerFrame", bytesPerFrame);
+    output.write("framesInFlight", framesInFlight);
+}
+
+void DynamicUniformRing::compile(Context& context)
+{
+    auto& deviceData = _deviceData[context.deviceID];
+    if (deviceData.buffer) return;
+
+    // adopt the viewer's frames in flight when the ring hasn't been sized explicitly
+    if (framesInFlight == 0) framesInFlight = context.framesInFlight;
+
+    // round the blockSize and per frame region up to the offset alignment so every frame region
+    // starts on a valid dynamic offset, and the descriptor's range covers whole allocations.
+    blockSize = ((blockSize + _alignment - 1) / _alignment) * _alignment;
+    bytesPerFrame = ((bytesPerFrame + _alignment - 1) / _alignment) * _alignment;
+
+    VkDeviceSize totalSize = bytesPerFrame * framesInFlight;
+
+    deviceData.buffer = createBufferAndMemory(context.device, totalSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_SHARING_MODE_EXCLUSIVE,
+                                              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    auto deviceMemory = deviceData.buffer->getDeviceMemory(context.deviceID);
+    void* pData = nullptr;
+    if (deviceMemory->map(deviceData.buffer->getMemoryOffset(context.deviceID), totalSize, 0, &pData) == VK_SUCCESS)
+    {
+        deviceData.mapped = static_cast<uint8_t*>(pData);
+    }
+    else
+    {
+        deviceData.buffer = {};
+        throw Exception{"Error: DynamicUniformRing::compile(..) failed to map uniform ring buffer memory.", VK_ERROR_MEMORY_MAP_FAILED};
+    }
+}
+
+void DynamicUniformRing::assignTo(Context& context, VkWriteDescriptorSet& wds) const
+{
+    Descriptor::assignTo(context, wds);
+
+    auto& deviceData = _deviceData[context.deviceID];
+    if (!deviceData.buffer)
+    {
+        warn("DynamicUniformRing::assignTo(..) called before compile(..), no buffer to assign.");
+        return;
+    }
+
+    auto pBufferInfo = context.scratchMemory->allocate<VkDescriptorBufferInfo>(1);
+    wds.descriptorCount = 1;
+    wds.pBufferInfo = pBufferInfo;
+
+    // the dynamic offset recorded per draw selects the block, so the descriptor itself always
+    // addresses the start of the buffer with a range of a single block.
+    pBufferInfo[0].buffer = deviceData.buffer->vk(context.deviceID);
+    pBufferInfo[0].offset = 0;
+    pBufferInfo[0].range = blockSize;
+}
+
+void DynamicUniformRing::advanceFrame()
+{
+    if (framesInFlight == 0) return; // not yet compiled, no frame regions to cycle through
+
+    _frameIndex = (_frameIndex + 1) % framesInFlight;
+    _frameOrigin = _frameIndex * bytesPerFrame;
+    _cursor.store(0);
+}
+
+uint32_t DynamicUniformRing::write(const void* data, VkDeviceSize size)
+{
+    if (size > blockSize)
+    {
+        warn("DynamicUniformRing::write(..) size ", size, " exceeds blockSize ", blockSize, ", data truncated.");
+        size = blockSize;
+    }
+
+    VkDeviceSize allocationSize = ((size + _alignment - 1) / _alignment) * _alignment;
+    VkDeviceSize offset = _cursor.fetch_add(allocationSize);
+
+    // the descriptor's range is blockSize, so the last valid offset must leave a whole block
+    // within the frame's region.
+    if (offset + blockSize > bytesPerFrame)
+    {
+        warn("DynamicUniformRing::write(..) frame region exhausted, increase bytesPerFrame.");
+        return 0;
+    }
+
+    for (auto& deviceData : _deviceData)
+    {
+        if (deviceData.mapped) std::memcpy(deviceData.mapped + _frameOrigin + offset, data, size);
+    }
+
+    return static_cast<uint32_t>(_frameOrigin + offset);
+}
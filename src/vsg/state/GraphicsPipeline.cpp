@@ -17,6 +17,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/GraphicsPipeline.h>
 #include <vsg/state/ViewportState.h>
 #include <vsg/vk/Context.h>
+#include <vsg/vk/PipelineCache.h>
 
 using namespace vsg;
 
@@ -118,6 +119,11 @@ void GraphicsPipeline::read(Input& input)
     input.readObjects("stages", stages);
     input.readObjects("pipelineStates", pipelineStates);
     input.read("subpass", subpass);
+
+    if (input.version_greater_equal(1, 1, 5))
+    {
+        input.readValue<uint32_t>("flags", flags);
+    }
 }
 
 void GraphicsPipeline::write(Output& output) const
@@ -128,6 +134,11 @@ void GraphicsPipeline::write(Output& output) const
     output.writeObjects("stages", stages);
     output.writeObjects("pipelineStates", pipelineStates);
     output.write("subpass", subpass);
+
+    if (output.version_greater_equal(1, 1, 5))
+    {
+        output.writeValue<uint32_t>("flags", flags);
+    }
 }
 
 void GraphicsPipeline::compile(Context& context)
@@ -180,7 +191,16 @@ void GraphicsPipeline::compile(Context& context)
         mergeGraphicsPipelineStates(context.mask, combined_pipelineStates, pipelineStates);
         mergeGraphicsPipelineStates(context.mask, combined_pipelineStates, context.overridePipelineStates);
 
-        _implementation[viewID] = GraphicsPipeline::Implementation::create(context, context.device, context.renderPass, layout, stages, combined_pipelineStates, subpass);
+        VkPipelineCreateFlags pipelineCreateFlags = flags;
+        VkPipeline basePipelineHandle = VK_NULL_HANDLE;
+        if (basePipeline && basePipeline != this)
+        {
+            basePipeline->compile(context);
+            basePipelineHandle = basePipeline->vk(viewID);
+            pipelineCreateFlags |= VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+        }
+
+        _implementation[viewID] = GraphicsPipeline::Implementation::create(context, context.device, context.renderPass, layout, stages, combined_pipelineStates, subpass, pipelineCreateFlags, basePipelineHandle);
     }
 }
 
@@ -188,15 +208,17 @@ void GraphicsPipeline::compile(Context& context)
 //
 // GraphicsPipeline::Implementation
 //
-GraphicsPipeline::Implementation::Implementation(Context& context, Device* device, const RenderPass* renderPass, const PipelineLayout* pipelineLayout, const ShaderStages& shaderStages, const GraphicsPipelineStates& pipelineStates, uint32_t subpass) :
+GraphicsPipeline::Implementation::Implementation(Context& context, Device* device, const RenderPass* renderPass, const PipelineLayout* pipelineLayout, const ShaderStages& shaderStages, const GraphicsPipelineStates& pipelineStates, uint32_t subpass, VkPipelineCreateFlags pipelineCreateFlags, VkPipeline basePipelineHandle) :
     _device(device)
 {
     VkGraphicsPipelineCreateInfo pipelineInfo = {};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.flags = pipelineCreateFlags;
     pipelineInfo.layout = pipelineLayout->vk(device->deviceID);
     pipelineInfo.renderPass = *renderPass;
     pipelineInfo.subpass = subpass;
-    pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+    pipelineInfo.basePipelineHandle = basePipelineHandle;
+    pipelineInfo.basePipelineIndex = -1;
     pipelineInfo.pNext = nullptr;
 
     auto shaderStageCreateInfo = context.scratchMemory->allocate<VkPipelineShaderStageCreateInfo>(shaderStages.size());
@@ -221,7 +243,8 @@ GraphicsPipeline::Implementation::Implementation(Context& context, Device* devic
         pipelineState->apply(context, pipelineInfo);
     }
 
-    VkResult result = vkCreateGraphicsPipelines(*device, VK_NULL_HANDLE, 1, &pipelineInfo, _device->getAllocationCallbacks(), &_pipeline);
+    VkPipelineCache pipelineCache = device->pipelineCache ? device->pipelineCache->vk() : VK_NULL_HANDLE;
+    VkResult result = vkCreateGraphicsPipelines(*device, pipelineCache, 1, &pipelineInfo, _device->getAllocationCallbacks(), &_pipeline);
 
     context.scratchMemory->release();
 
@@ -275,7 +298,7 @@ void BindGraphicsPipeline::write(Output& output) const
 
 void BindGraphicsPipeline::record(CommandBuffer& commandBuffer) const
 {
-    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->vk(commandBuffer.viewID));
+    commandBuffer.dispatch->vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->vk(commandBuffer.viewID));
     commandBuffer.setCurrentPipelineLayout(pipeline->layout);
 }
 
@@ -140,7 +140,8 @@ int Image::compare(const Object& rhs_object) const
     if ((result = compare_value(usage, rhs.usage))) return result;
     if ((result = compare_value(sharingMode, rhs.sharingMode))) return result;
     if ((result = compare_value_container(queueFamilyIndices, rhs.queueFamilyIndices))) return result;
-    return compare_value(initialLayout, rhs.initialLayout);
+    if ((result = compare_value(initialLayout, rhs.initialLayout))) return result;
+    return compare_value(externalMemoryHandleTypes, rhs.externalMemoryHandleTypes);
 }
 
 VkResult Image::bind(DeviceMemory* deviceMemory, VkDeviceSize memoryOffset)
@@ -159,6 +160,24 @@ VkResult Image::bind(DeviceMemory* deviceMemory, VkDeviceSize memoryOffset)
 VkResult Image::allocateAndBindMemory(Device* device, VkMemoryPropertyFlags memoryProperties, void* pNextAllocInfo)
 {
     auto memRequirements = getMemoryRequirements(device->deviceID);
+
+    // exportable images get a dedicated allocation with the export info chained in, as external
+    // consumers import the whole VkDeviceMemory
+    VkMemoryDedicatedAllocateInfo dedicatedAllocateInfo = {};
+    VkExportMemoryAllocateInfo exportAllocateInfo = {};
+    if (externalMemoryHandleTypes != 0)
+    {
+        dedicatedAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        dedicatedAllocateInfo.pNext = pNextAllocInfo;
+        dedicatedAllocateInfo.image = _vulkanData[device->deviceID].image;
+
+        exportAllocateInfo.sType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+        exportAllocateInfo.pNext = &dedicatedAllocateInfo;
+        exportAllocateInfo.handleTypes = externalMemoryHandleTypes;
+
+        pNextAllocInfo = &exportAllocateInfo;
+    }
+
     auto memory = DeviceMemory::create(device, memRequirements, memoryProperties, pNextAllocInfo);
     auto [allocated, offset] = memory->reserve(memRequirements.size);
     if (!allocated)
@@ -177,6 +196,18 @@ VkMemoryRequirements Image::getMemoryRequirements(uint32_t deviceID) const
     return memRequirements;
 }
 
+std::vector<VkSparseImageMemoryRequirements> Image::getSparseMemoryRequirements(uint32_t deviceID) const
+{
+    const VulkanData& vd = _vulkanData[deviceID];
+
+    uint32_t count = 0;
+    vkGetImageSparseMemoryRequirements(*vd.device, vd.image, &count, nullptr);
+
+    std::vector<VkSparseImageMemoryRequirements> sparseMemoryRequirements(count);
+    vkGetImageSparseMemoryRequirements(*vd.device, vd.image, &count, sparseMemoryRequirements.data());
+    return sparseMemoryRequirements;
+}
+
 void Image::compile(Device* device)
 {
     auto& vd = _vulkanData[device->deviceID];
@@ -199,6 +230,14 @@ void Image::compile(Device* device)
     info.pQueueFamilyIndices = queueFamilyIndices.data();
     info.initialLayout = initialLayout;
 
+    VkExternalMemoryImageCreateInfo externalMemoryImageCreateInfo = {};
+    if (externalMemoryHandleTypes != 0)
+    {
+        externalMemoryImageCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+        externalMemoryImageCreateInfo.handleTypes = externalMemoryHandleTypes;
+        info.pNext = &externalMemoryImageCreateInfo;
+    }
+
     vd.device = device;
 
     vd.requiresDataCopy = data.valid();
@@ -216,6 +255,22 @@ void Image::compile(Context& context)
 
     compile(context.device);
 
+    // sparse images must not be bound with vkBindImageMemory, their pages are bound
+    // through vkQueueBindSparse by the application or a SparseImageManager
+    if (sparse())
+    {
+        vd.requiresDataCopy = false;
+        return;
+    }
+
+    // exportable images can't be suballocated from the shared pools, they need their own dedicated exportable allocation
+    if (externalMemoryHandleTypes != 0)
+    {
+        vd.requiresDataCopy = data.valid();
+        allocateAndBindMemory(context.device);
+        return;
+    }
+
     VkMemoryRequirements memRequirements;
     vkGetImageMemoryRequirements(*vd.device, vd.image, &memRequirements);
 
@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 #include <vsg/state/ImageView.h>
 #include <vsg/vk/Context.h>
+#include <vsg/vk/DeviceExtensions.h>
 
 using namespace vsg;
 
@@ -200,7 +201,7 @@ ref_ptr<ImageView> vsg::createImageView(Device* device, ref_ptr<Image> image, Vk
     return imageView;
 }
 
-void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetImageLayout, Data::Properties properties, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, const Data::MipmapOffsets& mipmapOffsets, ref_ptr<Buffer> stagingBuffer, VkDeviceSize stagingBufferOffset, VkCommandBuffer commandBuffer, vsg::Device* device)
+void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetImageLayout, Data::Properties properties, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, const Data::MipmapOffsets& mipmapOffsets, ref_ptr<Buffer> stagingBuffer, VkDeviceSize stagingBufferOffset, VkCommandBuffer commandBuffer, vsg::Device* device, bool allowMipmapGeneration)
 {
     ref_ptr<Image> textureImage(imageView->image);
     auto aspectMask = imageView->subresourceRange.aspectMask;
@@ -241,7 +242,7 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
     const auto valueSize = properties.stride; // data->valueSize();
 
     bool useDataMipmaps = (mipLevels > 1) && (mipmapOffsets.size() > 1);
-    bool generateMipmaps = (mipLevels > 1) && (mipmapOffsets.size() <= 1);
+    bool generateMipmaps = (mipLevels > 1) && (mipmapOffsets.size() <= 1) && allowMipmapGeneration;
 
     auto vk_textureImage = textureImage->vk(device->deviceID);
 
@@ -443,3 +444,167 @@ void vsg::transferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetIm
                              1, &postCopyBarrier);
     }
 }
+
+bool vsg::hostTransferImageData(ref_ptr<ImageView> imageView, VkImageLayout targetImageLayout, Data::Properties properties, uint32_t width, uint32_t height, uint32_t depth, uint32_t mipLevels, const Data::MipmapOffsets& mipmapOffsets, const void* sourceData, vsg::Device* device)
+{
+    auto extensions = device->getExtensions();
+    if (!extensions->vkCopyMemoryToImageEXT || !extensions->vkTransitionImageLayoutEXT) return false;
+
+    ref_ptr<Image> textureImage(imageView->image);
+    if ((textureImage->usage & VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT) == 0) return false;
+
+    // host copies cannot use vkCmdBlitImage so mipmap generation is not possible, require a single mip level or precomputed mipmaps.
+    if ((mipLevels > 1) && (mipmapOffsets.size() <= 1)) return false;
+
+    auto aspectMask = imageView->subresourceRange.aspectMask;
+
+    uint32_t faceWidth = width;
+    uint32_t faceHeight = height;
+    uint32_t faceDepth = depth;
+    uint32_t arrayLayers = 1;
+
+    switch (imageView->viewType)
+    {
+    case (VK_IMAGE_VIEW_TYPE_CUBE):
+        arrayLayers = faceDepth;
+        faceDepth = 1;
+        break;
+    case (VK_IMAGE_VIEW_TYPE_1D_ARRAY):
+        arrayLayers = faceHeight * faceDepth;
+        faceHeight = 1;
+        faceDepth = 1;
+        break;
+    case (VK_IMAGE_VIEW_TYPE_2D_ARRAY):
+        arrayLayers = faceDepth;
+        faceDepth = 1;
+        break;
+    case (VK_IMAGE_VIEW_TYPE_CUBE_ARRAY):
+        arrayLayers = faceDepth;
+        faceDepth = 1;
+        break;
+    default:
+        break;
+    }
+
+    uint32_t destWidth = faceWidth * properties.blockWidth;
+    uint32_t destHeight = faceHeight * properties.blockHeight;
+    uint32_t destDepth = faceDepth * properties.blockDepth;
+
+    const auto valueSize = properties.stride;
+
+    bool useDataMipmaps = (mipLevels > 1) && (mipmapOffsets.size() > 1);
+
+    auto vk_textureImage = textureImage->vk(device->deviceID);
+    const uint8_t* src_ptr = reinterpret_cast<const uint8_t*>(sourceData);
+
+    std::vector<VkMemoryToImageCopyEXT> regions;
+
+    if (useDataMipmaps)
+    {
+        size_t offset = 0u;
+        regions.resize(mipLevels * arrayLayers);
+
+        uint32_t mipWidth = destWidth;
+        uint32_t mipHeight = destHeight;
+        uint32_t mipDepth = destDepth;
+
+        for (uint32_t mipLevel = 0; mipLevel < mipLevels; ++mipLevel)
+        {
+            const size_t faceSize = static_cast<size_t>(faceWidth * faceHeight * faceDepth * valueSize);
+
+            for (uint32_t face = 0; face < arrayLayers; ++face)
+            {
+                auto& region = regions[mipLevel * arrayLayers + face];
+                region.sType = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+                region.pNext = nullptr;
+                region.pHostPointer = src_ptr + offset;
+                region.memoryRowLength = 0;
+                region.memoryImageHeight = 0;
+                region.imageSubresource.aspectMask = aspectMask;
+                region.imageSubresource.mipLevel = mipLevel;
+                region.imageSubresource.baseArrayLayer = face;
+                region.imageSubresource.layerCount = 1;
+                region.imageOffset = {0, 0, 0};
+                region.imageExtent = {mipWidth, mipHeight, mipDepth};
+
+                offset += faceSize;
+            }
+
+            if (mipWidth > 1) mipWidth /= 2;
+            if (mipHeight > 1) mipHeight /= 2;
+            if (mipDepth > 1) mipDepth /= 2;
+            if (faceWidth > 1) faceWidth /= 2;
+            if (faceHeight > 1) faceHeight /= 2;
+            if (faceDepth > 1) faceDepth /= 2;
+        }
+    }
+    else
+    {
+        regions.resize(arrayLayers);
+
+        const size_t faceSize = static_cast<size_t>(faceWidth * faceHeight * faceDepth * valueSize);
+        for (auto face = 0u; face < arrayLayers; face++)
+        {
+            auto& region = regions[face];
+            region.sType = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+            region.pNext = nullptr;
+            region.pHostPointer = src_ptr + face * faceSize;
+            region.memoryRowLength = 0;
+            region.memoryImageHeight = 0;
+            region.imageSubresource.aspectMask = aspectMask;
+            region.imageSubresource.mipLevel = 0;
+            region.imageSubresource.baseArrayLayer = face;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset = {0, 0, 0};
+            region.imageExtent = {destWidth, destHeight, destDepth};
+        }
+    }
+
+    // transition to VK_IMAGE_LAYOUT_GENERAL, the layout the extension mandates support for as a host copy destination.
+    VkHostImageLayoutTransitionInfoEXT transition = {};
+    transition.sType = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT;
+    transition.image = vk_textureImage;
+    transition.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    transition.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    transition.subresourceRange.aspectMask = aspectMask;
+    transition.subresourceRange.baseMipLevel = 0;
+    transition.subresourceRange.levelCount = mipLevels;
+    transition.subresourceRange.baseArrayLayer = 0;
+    transition.subresourceRange.layerCount = arrayLayers;
+
+    VkResult result = extensions->vkTransitionImageLayoutEXT(device->vk(), 1, &transition);
+    if (result != VK_SUCCESS)
+    {
+        warn("hostTransferImageData() vkTransitionImageLayoutEXT(..) failed, result = ", result);
+        return false;
+    }
+
+    VkCopyMemoryToImageInfoEXT copyInfo = {};
+    copyInfo.sType = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT;
+    copyInfo.dstImage = vk_textureImage;
+    copyInfo.dstImageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    copyInfo.regionCount = static_cast<uint32_t>(regions.size());
+    copyInfo.pRegions = regions.data();
+
+    result = extensions->vkCopyMemoryToImageEXT(device->vk(), &copyInfo);
+    if (result != VK_SUCCESS)
+    {
+        warn("hostTransferImageData() vkCopyMemoryToImageEXT(..) failed, result = ", result);
+        return false;
+    }
+
+    if (targetImageLayout != VK_IMAGE_LAYOUT_GENERAL)
+    {
+        transition.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+        transition.newLayout = targetImageLayout;
+
+        result = extensions->vkTransitionImageLayoutEXT(device->vk(), 1, &transition);
+        if (result != VK_SUCCESS)
+        {
+            warn("hostTransferImageData() vkTransitionImageLayoutEXT(..) failed, result = ", result);
+            return false;
+        }
+    }
+
+    return true;
+}
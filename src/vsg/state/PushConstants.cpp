@@ -53,5 +53,5 @@ void PushConstants::write(Output& output) const
 
 void PushConstants::record(CommandBuffer& commandBuffer) const
 {
-    vkCmdPushConstants(commandBuffer, commandBuffer.getCurrentPipelineLayout(), stageFlags, offset, static_cast<uint32_t>(data->dataSize()), data->dataPointer());
+    commandBuffer.dispatch->vkCmdPushConstants(commandBuffer, commandBuffer.getCurrentPipelineLayout(), stageFlags, offset, static_cast<uint32_t>(data->dataSize()), data->constDataPointer());
 }
@@ -0,0 +1,144 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/compare.h>
+#include <vsg/io/Options.h>
+#include <vsg/state/PushDescriptorSet.h>
+#include <vsg/vk/Context.h>
+#include <vsg/vk/DeviceExtensions.h>
+
+using namespace vsg;
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// PushDescriptorSet
+//
+PushDescriptorSet::PushDescriptorSet() :
+    pipelineBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS),
+    firstSet(0)
+{
+}
+
+PushDescriptorSet::PushDescriptorSet(const PushDescriptorSet& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    pipelineBindPoint(rhs.pipelineBindPoint),
+    layout(copyop(rhs.layout)),
+    firstSet(rhs.firstSet),
+    descriptors(copyop(rhs.descriptors))
+{
+}
+
+int PushDescriptorSet::compare(const Object& rhs_object) const
+{
+    int result = StateCommand::compare(rhs_object);
+    if (result != 0) return result;
+
+    auto& rhs = static_cast<decltype(*this)>(rhs_object);
+
+    if ((result = compare_value(pipelineBindPoint, rhs.pipelineBindPoint))) return result;
+    if ((result = compare_pointer(layout, rhs.layout))) return result;
+    if ((result = compare_value(firstSet, rhs.firstSet))) return result;
+    return compare_pointer_container(descriptors, rhs.descriptors);
+}
+
+void PushDescriptorSet::read(Input& input)
+{
+    _vulkanData.clear();
+
+    StateCommand::read(input);
+
+    input.readValue<uint32_t>("pipelineBindPoint", pipelineBindPoint);
+    input.readObject("layout", layout);
+    input.read("firstSet", firstSet);
+    input.readObjects("descriptors", descriptors);
+}
+
+void PushDescriptorSet::write(Output& output) const
+{
+    StateCommand::write(output);
+
+    output.writeValue<uint32_t>("pipelineBindPoint", pipelineBindPoint);
+    output.writeObject("layout", layout);
+    output.write("firstSet", firstSet);
+    output.writeObjects("descriptors", descriptors);
+}
+
+void PushDescriptorSet::compile(Context& context)
+{
+    auto& vkd = _vulkanData[context.deviceID];
+
+    // no need to compile if already compiled
+    if (vkd._vkPipelineLayout != 0 && vkd._writes.size() == descriptors.size()) return;
+
+    layout->compile(context);
+    vkd._vkPipelineLayout = layout->vk(context.deviceID);
+
+    for (auto& descriptor : descriptors) descriptor->compile(context);
+
+    // build the VkWriteDescriptorSet entries in scratch memory using the standard Descriptor::assignTo() path
+    auto scratchWrites = context.scratchMemory->allocate<VkWriteDescriptorSet>(descriptors.size());
+    for (size_t i = 0; i < descriptors.size(); ++i)
+    {
+        descriptors[i]->assignTo(context, scratchWrites[i]);
+    }
+
+    // count the descriptor info entries up front so the copies below don't reallocate and invalidate the cached pointers
+    size_t numBufferInfos = 0;
+    size_t numImageInfos = 0;
+    size_t numTexelBufferViews = 0;
+    for (size_t i = 0; i < descriptors.size(); ++i)
+    {
+        const auto& wds = scratchWrites[i];
+        if (wds.pBufferInfo) numBufferInfos += wds.descriptorCount;
+        if (wds.pImageInfo) numImageInfos += wds.descriptorCount;
+        if (wds.pTexelBufferView) numTexelBufferViews += wds.descriptorCount;
+    }
+
+    // copy the writes and the info arrays they point to into per device storage that outlives the scratch memory,
+    // so record() can pass them straight to vkCmdPushDescriptorSetKHR
+    vkd._writes.assign(scratchWrites, scratchWrites + descriptors.size());
+    vkd._bufferInfos.clear();
+    vkd._bufferInfos.reserve(numBufferInfos);
+    vkd._imageInfos.clear();
+    vkd._imageInfos.reserve(numImageInfos);
+    vkd._texelBufferViews.clear();
+    vkd._texelBufferViews.reserve(numTexelBufferViews);
+
+    for (auto& wds : vkd._writes)
+    {
+        if (wds.pBufferInfo)
+        {
+            auto itr = vkd._bufferInfos.insert(vkd._bufferInfos.end(), wds.pBufferInfo, wds.pBufferInfo + wds.descriptorCount);
+            wds.pBufferInfo = &(*itr);
+        }
+        if (wds.pImageInfo)
+        {
+            auto itr = vkd._imageInfos.insert(vkd._imageInfos.end(), wds.pImageInfo, wds.pImageInfo + wds.descriptorCount);
+            wds.pImageInfo = &(*itr);
+        }
+        if (wds.pTexelBufferView)
+        {
+            auto itr = vkd._texelBufferViews.insert(vkd._texelBufferViews.end(), wds.pTexelBufferView, wds.pTexelBufferView + wds.descriptorCount);
+            wds.pTexelBufferView = &(*itr);
+        }
+    }
+
+    context.scratchMemory->release();
+}
+
+void PushDescriptorSet::record(CommandBuffer& commandBuffer) const
+{
+    auto& vkd = _vulkanData[commandBuffer.deviceID];
+    auto extensions = commandBuffer.getDevice()->getExtensions();
+    extensions->vkCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, vkd._vkPipelineLayout, firstSet,
+                                          static_cast<uint32_t>(vkd._writes.size()), vkd._writes.data());
+}
@@ -13,6 +13,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Options.h>
 #include <vsg/state/ResourceHints.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 ResourceHints::ResourceHints()
@@ -23,6 +25,28 @@ ResourceHints::~ResourceHints()
 {
 }
 
+void ResourceHints::add(const ResourceHints& rhs)
+{
+    maxSlot = std::max(maxSlot, rhs.maxSlot);
+    numDescriptorSets += rhs.numDescriptorSets;
+
+    for (const auto& poolSize : rhs.descriptorPoolSizes)
+    {
+        auto itr = std::find_if(descriptorPoolSizes.begin(), descriptorPoolSizes.end(), [&poolSize](const VkDescriptorPoolSize& ps) { return ps.type == poolSize.type; });
+        if (itr != descriptorPoolSizes.end())
+            itr->descriptorCount += poolSize.descriptorCount;
+        else
+            descriptorPoolSizes.push_back(poolSize);
+    }
+
+    minimumBufferSize = std::max(minimumBufferSize, rhs.minimumBufferSize);
+    minimumDeviceMemorySize = std::max(minimumDeviceMemorySize, rhs.minimumDeviceMemorySize);
+
+    numLightsRange = {std::max(numLightsRange.x, rhs.numLightsRange.x), std::max(numLightsRange.y, rhs.numLightsRange.y)};
+    numShadowMapsRange = {std::max(numShadowMapsRange.x, rhs.numShadowMapsRange.x), std::max(numShadowMapsRange.y, rhs.numShadowMapsRange.y)};
+    shadowMapSize = {std::max(shadowMapSize.x, rhs.shadowMapSize.x), std::max(shadowMapSize.y, rhs.shadowMapSize.y)};
+}
+
 void ResourceHints::read(Input& input)
 {
     Object::read(input);
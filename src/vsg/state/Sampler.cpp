@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/state/Sampler.h>
 #include <vsg/vk/Context.h>
 
+#include <cstring>
+
 using namespace vsg;
 
 Sampler::Sampler()
@@ -100,7 +102,10 @@ void Sampler::compile(Context& context)
     samplerInfo->borderColor = borderColor;
     samplerInfo->unnormalizedCoordinates = unnormalizedCoordinates;
 
-    _implementation[context.deviceID] = Implementation::create(context.device, *samplerInfo);
+    if (context.device->samplerCache)
+        _implementation[context.deviceID] = context.device->samplerCache->getOrCreate(context.device, *samplerInfo);
+    else
+        _implementation[context.deviceID] = Implementation::create(context.device, *samplerInfo);
 }
 
 Sampler::Implementation::Implementation(Device* device, const VkSamplerCreateInfo& createSamplerInfo) :
@@ -119,3 +124,62 @@ Sampler::Implementation::~Implementation()
         vkDestroySampler(*_device, _sampler, _device->getAllocationCallbacks());
     }
 }
+
+//////////////////////////////////////
+//
+// SamplerCache
+//
+SamplerCache::SamplerCache()
+{
+}
+
+SamplerCache::~SamplerCache()
+{
+}
+
+bool SamplerCache::Key::operator<(const Key& rhs) const
+{
+    return std::memcmp(this, &rhs, sizeof(Key)) < 0;
+}
+
+ref_ptr<Sampler::Implementation> SamplerCache::getOrCreate(Device* device, const VkSamplerCreateInfo& createSamplerInfo)
+{
+    Key key;
+    key.flags = createSamplerInfo.flags;
+    key.magFilter = createSamplerInfo.magFilter;
+    key.minFilter = createSamplerInfo.minFilter;
+    key.mipmapMode = createSamplerInfo.mipmapMode;
+    key.addressModeU = createSamplerInfo.addressModeU;
+    key.addressModeV = createSamplerInfo.addressModeV;
+    key.addressModeW = createSamplerInfo.addressModeW;
+    key.mipLodBias = createSamplerInfo.mipLodBias;
+    key.anisotropyEnable = createSamplerInfo.anisotropyEnable;
+    key.maxAnisotropy = createSamplerInfo.maxAnisotropy;
+    key.compareEnable = createSamplerInfo.compareEnable;
+    key.compareOp = createSamplerInfo.compareOp;
+    key.minLod = createSamplerInfo.minLod;
+    key.maxLod = createSamplerInfo.maxLod;
+    key.borderColor = createSamplerInfo.borderColor;
+    key.unnormalizedCoordinates = createSamplerInfo.unnormalizedCoordinates;
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto& entry = _samplers[key];
+    if (ref_ptr<Sampler::Implementation> implementation = entry) return implementation;
+
+    auto implementation = Sampler::Implementation::create(device, createSamplerInfo);
+    entry = implementation;
+    return implementation;
+}
+
+std::size_t SamplerCache::size() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    std::size_t count = 0;
+    for (auto& [key, entry] : _samplers)
+    {
+        if (ref_ptr<Sampler::Implementation> implementation = entry) ++count;
+    }
+    return count;
+}
@@ -184,7 +184,7 @@ void ShaderStage::apply(Context& context, VkPipelineShaderStageCreateInfo& stage
         for (auto& [id, data] : specializationConstants)
         {
             mapEntries[i++] = VkSpecializationMapEntry{id, offset, data->dataSize()};
-            std::memcpy(packedData + offset, static_cast<uint8_t*>(data->dataPointer()), data->dataSize());
+            std::memcpy(packedData + offset, static_cast<const uint8_t*>(data->constDataPointer()), data->dataSize());
             offset += static_cast<uint32_t>(data->dataSize());
         }
 
@@ -21,11 +21,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/lighting/HardShadows.h>
 #include <vsg/lighting/PercentageCloserSoftShadows.h>
 #include <vsg/lighting/PointLight.h>
+#include <vsg/lighting/RayTracedShadows.h>
 #include <vsg/lighting/SoftShadows.h>
 #include <vsg/lighting/SpotLight.h>
 #include <vsg/nodes/RegionOfInterest.h>
 #include <vsg/state/DescriptorImage.h>
 #include <vsg/state/ViewDependentState.h>
+#include <vsg/utils/FindDynamicObjects.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 #include <vsg/utils/ShaderSet.h>
 #include <vsg/vk/Context.h>
@@ -298,6 +300,69 @@ void ViewDependentState::init(ResourceRequirements& requirements)
     viewportDataBufferInfo = BufferInfo::create(viewportData.get());
     descriptorConfigurator->assignDescriptor("viewportData", BufferInfoList{viewportDataBufferInfo});
 
+    if (view && !view->eyeOffsets.empty())
+    {
+        eyeMatricesData = mat4Array::create(static_cast<uint32_t>(view->eyeOffsets.size()));
+        eyeMatricesData->properties.dataVariance = DYNAMIC_DATA_TRANSFER_AFTER_RECORD;
+        eyeMatricesBufferInfo = BufferInfo::create(eyeMatricesData.get());
+        descriptorConfigurator->assignDescriptor("eyeMatrices", BufferInfoList{eyeMatricesBufferInfo});
+    }
+
+    if (clusteredLighting)
+    {
+        uint32_t numClusters = clusterGridWidth * clusterGridHeight * clusterGridDepth;
+
+        clusterGridData = vec4Array::create(2);
+        clusterGridData->properties.dataVariance = DYNAMIC_DATA_TRANSFER_AFTER_RECORD;
+        clusterGridDataBufferInfo = BufferInfo::create(clusterGridData.get());
+        descriptorConfigurator->assignDescriptor("clusterGridData", BufferInfoList{clusterGridDataBufferInfo});
+
+        clusterLightIndices = uintArray::create(numClusters * (maxLightsPerCluster + 1));
+        clusterLightIndices->properties.dataVariance = DYNAMIC_DATA_TRANSFER_AFTER_RECORD;
+        clusterLightIndicesBufferInfo = BufferInfo::create(clusterLightIndices.get());
+        descriptorConfigurator->assignDescriptor("clusterLightIndices", BufferInfoList{clusterLightIndicesBufferInfo});
+    }
+
+    // set up the ray traced shadow/ambient occlusion mask when any of the view's lights select the
+    // ray traced backend
+    bool rayTracedShadows = false;
+    if ((view->features & (RECORD_LIGHTS | RECORD_SHADOW_MAPS)) != 0)
+    {
+        for (auto& light : viewDetails.lights)
+        {
+            if (auto shadowSettings = getActiveShadowSettings(light); shadowSettings && shadowSettings->cast<RayTracedShadows>()) rayTracedShadows = true;
+        }
+    }
+
+    auto shadowAOMaskSampler = Sampler::create();
+    shadowAOMaskSampler->minFilter = VK_FILTER_LINEAR;
+    shadowAOMaskSampler->magFilter = VK_FILTER_LINEAR;
+    shadowAOMaskSampler->mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    shadowAOMaskSampler->addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    shadowAOMaskSampler->addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    shadowAOMaskSampler->addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+
+    if (rayTracedShadows)
+    {
+        auto maskImage = createShadowImage(shadowAOMaskSize.x, shadowAOMaskSize.y, 1, VK_FORMAT_R8G8_UNORM, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+
+        // the mask is written as a storage image by the ray pass and sampled by the main pass
+        shadowAOMaskImageInfo = ImageInfo::create(shadowAOMaskSampler, ImageView::create(maskImage), VK_IMAGE_LAYOUT_GENERAL);
+        descriptorConfigurator->assignTexture("shadowAOMask", ImageInfoList{shadowAOMaskImageInfo});
+    }
+    else
+    {
+        // fallback to a fully lit/unoccluded 1x1 mask when the ray traced shadow pass is not active
+        Properties properties;
+        properties.format = VK_FORMAT_R8G8_UNORM;
+        auto maskData = ubvec2Array2D::create(1, 1, ubvec2(255, 255), properties);
+        auto maskImage = Image::create(maskData);
+        maskImage->usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+
+        shadowAOMaskImageInfo = ImageInfo::create(shadowAOMaskSampler, ImageView::create(maskImage), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        descriptorConfigurator->assignTexture("shadowAOMask", ImageInfoList{shadowAOMaskImageInfo});
+    }
+
     // set up ShadowMaps
     auto shadowMapDirectSampler = Sampler::create();
     shadowMapDirectSampler->minFilter = VK_FILTER_NEAREST;
@@ -379,14 +444,20 @@ void ViewDependentState::init(ResourceRequirements& requirements)
         }
     }
 
-    // if not active then don't enable shadow maps
+    // if not active then don't enable the pre render pass
+    if (maxShadowMaps == 0 && !rayShadowCommands) return;
+
+    preRenderCommandGraph = CommandGraph::create();
+    preRenderCommandGraph->submitOrder = -1;
+
+    // application supplied ray pass writing the shadowAOMask
+    if (rayShadowCommands) preRenderCommandGraph->addChild(rayShadowCommands);
+
+    // if no lights require shadow maps then don't enable them
     if (maxShadowMaps == 0) return;
 
     // create a switch to toggle on/off the render to texture subgraphs for each shadowmap layer
     preRenderSwitch = Switch::create();
-
-    preRenderCommandGraph = CommandGraph::create();
-    preRenderCommandGraph->submitOrder = -1;
     preRenderCommandGraph->addChild(preRenderSwitch);
 
     auto tcon = TraverseChildrenOfNode::create(view);
@@ -429,18 +500,22 @@ void ViewDependentState::compile(Context& context)
 {
     if (compiled) return;
     compiled = true;
+    _previousValid = false;
 
     CPU_INSTRUMENTATION_L1_NC(context.instrumentation, "ViewDependentState compile", COLOR_COMPILE);
 
     descriptorSet->compile(context);
 
-    if ((view->features & RECORD_SHADOW_MAPS) != 0 && preRenderCommandGraph && !preRenderCommandGraph->device)
+    if (preRenderCommandGraph && !preRenderCommandGraph->device)
     {
         preRenderCommandGraph->device = context.device;
 
         // TODO
         preRenderCommandGraph->queueFamily = 0;
+    }
 
+    if ((view->features & RECORD_SHADOW_MAPS) != 0 && preRenderCommandGraph && !shadowMaps.empty() && !shadowMaps.front().renderGraph->framebuffer)
+    {
         auto extent = shadowDepthImage->extent;
 
         shadowDepthImage->compile(context);
@@ -528,6 +603,28 @@ void ViewDependentState::compile(Context& context)
     }
 }
 
+void ViewDependentState::invalidateCachedShadowMaps()
+{
+    for (auto& shadowMap : shadowMaps)
+    {
+        shadowMap.rendered = false;
+    }
+    _checkedForDynamicCasters = false;
+    _previousValid = false;
+}
+
+bool ViewDependentState::containsDynamicCasters() const
+{
+    if (!_checkedForDynamicCasters)
+    {
+        auto findDynamicObjects = FindDynamicObjects::create();
+        view->traverse(*findDynamicObjects);
+        _containsDynamicCasters = !findDynamicObjects->dynamicObjects.empty();
+        _checkedForDynamicCasters = true;
+    }
+    return _containsDynamicCasters;
+}
+
 void ViewDependentState::clear()
 {
     //debug("ViewDependentState::clear() bufferIndex = ", bufferIndex);
@@ -544,6 +641,18 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
     //GPU_INSTRUMENTATION_L1_NC(rt.instrumentation, *rt.getCommandBuffer(), "ViewDependentState", COLOR_RECORD_L1);
     CPU_INSTRUMENTATION_L1_NC(rt.instrumentation, "ViewDependentState", COLOR_RECORD_L1);
 
+    // upload the per eye multiview matrices so vertex shaders can select them with gl_ViewIndex
+    if (eyeMatricesData)
+    {
+        auto eye_itr = eyeMatricesData->begin();
+        for (auto& offset : view->eyeOffsets)
+        {
+            if (eye_itr == eyeMatricesData->end()) break;
+            (*eye_itr++) = mat4(offset);
+        }
+        eyeMatricesData->dirty();
+    }
+
     if ((view->features & RECORD_SHADOW_MAPS) == 0) return;
 
     // useful reference : https://learn.microsoft.com/en-us/windows/win32/dxtecharts/cascaded-shadow-maps
@@ -562,7 +671,9 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
     // https://github.com/vsgopenmw-dev/vsgopenmw/blob/master/files/shaders/lib/view/shadow.glsl
 
     bool requiresPerRenderShadowMaps = false;
+    bool deferredCachedUpdates = false;
     uint32_t shadowMapIndex = 0;
+    uint32_t cachedShadowMapUpdates = 0;
     uint32_t numShadowMaps = static_cast<uint32_t>(shadowMaps.size());
     if (preRenderSwitch)
         preRenderSwitch->setAllChildren(false);
@@ -673,6 +784,48 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
         }
     }
 
+    // build a signature of the inputs that the light data, shadow cascades and cluster grid are
+    // derived from - when it matches the previous frame all the derived data is still valid, so the
+    // rewrite and upload of lightData and the cascade recomputation can be skipped entirely,
+    // reducing the per frame cost for static lights and a static camera to the comparison below.
+    const double signatureNear = n;
+    const double signatureFar = f;
+    _lightRecords.clear();
+    _lightRecords.reserve(ambientLights.size() + directionalLights.size() + pointLights.size() + spotLights.size() + 4);
+    auto recordLights = [&](const auto& lights) {
+        _lightRecords.push_back(LightRecord{nullptr, static_cast<uint32_t>(lights.size()), {}});
+        for (auto& [mv, light] : lights) _lightRecords.push_back(LightRecord{light, light->modifiedCount.count, mv});
+    };
+    recordLights(ambientLights);
+    recordLights(directionalLights);
+    recordLights(pointLights);
+    recordLights(spotLights);
+
+    if (_previousValid && projectionMatrix == _previousProjection && viewMatrix == _previousView &&
+        signatureNear == _previousNear && signatureFar == _previousFar && _lightRecords == _previousLightRecords)
+    {
+        // nothing feeding the light data or shadow cascades has changed, so reapply the steady state
+        // shadow map switch settings and re-record just the shadow maps that render every frame.
+        bool steadyStateRequiresShadowMaps = false;
+        for (uint32_t i = 0; i < numShadowMaps && i < static_cast<uint32_t>(_steadyStateShadowMapMasks.size()); ++i)
+        {
+            preRenderSwitch->children[i].mask = _steadyStateShadowMapMasks[i];
+            if (_steadyStateShadowMapMasks[i] != MASK_OFF) steadyStateRequiresShadowMaps = true;
+        }
+
+        if ((steadyStateRequiresShadowMaps || rayShadowCommands) && preRenderCommandGraph)
+        {
+            if (rt.instrumentation && !preRenderCommandGraph->instrumentation)
+            {
+                preRenderCommandGraph->instrumentation = shareOrDuplicateForThreadSafety(rt.instrumentation);
+            }
+            preRenderCommandGraph->accept(rt);
+        }
+        return;
+    }
+
+    _steadyStateShadowMapMasks.assign(numShadowMaps, MASK_OFF);
+
     // set up the light data
     auto light_itr = lightData->begin();
     lightData->dirty();
@@ -722,9 +875,6 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
 
         if (activeNumShadowMaps == 0) continue;
 
-        // set up shadow map rendering backend
-        requiresPerRenderShadowMaps = true;
-
         // compute directional light space
         // light direction in world coords
         auto light_direction = normalize(light->direction * (inverse_3x3(mv * inverse_viewMatrix)));
@@ -753,8 +903,12 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
         }
 
         auto updateCamera = [&](double clip_near_z, double clip_far_z, const dmat4& clipToWorld) -> void {
-            const auto& shadowMap = shadowMaps[shadowMapIndex];
-            preRenderSwitch->children[shadowMapIndex].mask = MASK_ALL;
+            auto& shadowMap = shadowMaps[shadowMapIndex];
+
+            // apply the light's shadow traversal overrides to the shadow view
+            shadowMap.view->mask = shadowSettings->castShadowMask;
+            shadowMap.view->lodScale = shadowSettings->lodScale;
+            shadowMap.view->smallFeatureCullingRatio = (shadowSettings->minimumShadowCasterSizeInPixels > 0.0 && shadowDepthImage) ? shadowSettings->minimumShadowCasterSizeInPixels / static_cast<double>(shadowDepthImage->extent.height) : 0.0;
 
             const auto& camera = shadowMap.view->camera;
             auto lookAt = camera->viewMatrix.cast<LookAt>();
@@ -781,6 +935,40 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
 
             dmat4 shadowMapProjView = camera->projectionMatrix->transform() * camera->viewMatrix->transform();
 
+            // when the light opts in to shadow map caching reuse the previous depth map while the shadow map
+            // projection is unchanged and the scene contains no dynamic casters, rationing re-renders of stale
+            // maps by maxCachedShadowMapUpdatesPerFrame so the cost of camera movement is spread across frames
+            bool reuseCachedShadowMap = false;
+            if (shadowSettings->cacheShadowMaps && shadowMap.rendered && !containsDynamicCasters())
+            {
+                if (shadowMap.cachedProjView == shadowMapProjView)
+                    reuseCachedShadowMap = true;
+                else if (maxCachedShadowMapUpdatesPerFrame != 0 && cachedShadowMapUpdates >= maxCachedShadowMapUpdatesPerFrame)
+                {
+                    // rationed - reuse the stale map this frame but refresh it on a subsequent frame
+                    reuseCachedShadowMap = true;
+                    deferredCachedUpdates = true;
+                }
+                else
+                    ++cachedShadowMapUpdates;
+            }
+
+            if (reuseCachedShadowMap)
+            {
+                preRenderSwitch->children[shadowMapIndex].mask = MASK_OFF;
+                _steadyStateShadowMapMasks[shadowMapIndex] = MASK_OFF;
+            }
+            else
+            {
+                preRenderSwitch->children[shadowMapIndex].mask = MASK_ALL;
+                shadowMap.cachedProjView = shadowMapProjView;
+                shadowMap.rendered = true;
+                requiresPerRenderShadowMaps = true;
+
+                // on subsequent unchanged frames a cacheable map can be reused, others re-render each frame
+                _steadyStateShadowMapMasks[shadowMapIndex] = (shadowSettings->cacheShadowMaps && !containsDynamicCasters()) ? MASK_OFF : MASK_ALL;
+            }
+
             dmat4 shadowMapTM = scale(0.5, 0.5, 1.0) * translate(1.0, 1.0, shadowMapBias) * shadowMapProjView * inverse_viewMatrix;
 
             // convert tex gen matrix to float matrix and assign to light data
@@ -882,9 +1070,6 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
 
         if (activeNumShadowMaps == 0) continue;
 
-        // set up shadow map rendering backend
-        requiresPerRenderShadowMaps = true;
-
         // compute spot light space
         // light direction in world coords
         auto light_direction = normalize(light->direction * (inverse_3x3(mv * inverse_viewMatrix)));
@@ -917,8 +1102,12 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
         auto light_intensity = light->intensity;
 
         auto updateCamera = [&](double clip_near_z, double clip_far_z, const dmat4& clipToWorld) -> void {
-            const auto& shadowMap = shadowMaps[shadowMapIndex];
-            preRenderSwitch->children[shadowMapIndex].mask = MASK_ALL;
+            auto& shadowMap = shadowMaps[shadowMapIndex];
+
+            // apply the light's shadow traversal overrides to the shadow view
+            shadowMap.view->mask = shadowSettings->castShadowMask;
+            shadowMap.view->lodScale = shadowSettings->lodScale;
+            shadowMap.view->smallFeatureCullingRatio = (shadowSettings->minimumShadowCasterSizeInPixels > 0.0 && shadowDepthImage) ? shadowSettings->minimumShadowCasterSizeInPixels / static_cast<double>(shadowDepthImage->extent.height) : 0.0;
 
             const auto& camera = shadowMap.view->camera;
             auto lookAt = camera->viewMatrix.cast<LookAt>();
@@ -956,6 +1145,38 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
 
             dmat4 shadowMapProjView = camera->projectionMatrix->transform() * camera->viewMatrix->transform();
 
+            // reuse or refresh the cached depth map on the same terms as the directional light path above
+            bool reuseCachedShadowMap = false;
+            if (shadowSettings->cacheShadowMaps && shadowMap.rendered && !containsDynamicCasters())
+            {
+                if (shadowMap.cachedProjView == shadowMapProjView)
+                    reuseCachedShadowMap = true;
+                else if (maxCachedShadowMapUpdatesPerFrame != 0 && cachedShadowMapUpdates >= maxCachedShadowMapUpdatesPerFrame)
+                {
+                    // rationed - reuse the stale map this frame but refresh it on a subsequent frame
+                    reuseCachedShadowMap = true;
+                    deferredCachedUpdates = true;
+                }
+                else
+                    ++cachedShadowMapUpdates;
+            }
+
+            if (reuseCachedShadowMap)
+            {
+                preRenderSwitch->children[shadowMapIndex].mask = MASK_OFF;
+                _steadyStateShadowMapMasks[shadowMapIndex] = MASK_OFF;
+            }
+            else
+            {
+                preRenderSwitch->children[shadowMapIndex].mask = MASK_ALL;
+                shadowMap.cachedProjView = shadowMapProjView;
+                shadowMap.rendered = true;
+                requiresPerRenderShadowMaps = true;
+
+                // on subsequent unchanged frames a cacheable map can be reused, others re-render each frame
+                _steadyStateShadowMapMasks[shadowMapIndex] = (shadowSettings->cacheShadowMaps && !containsDynamicCasters()) ? MASK_OFF : MASK_ALL;
+            }
+
             dmat4 shadowMapTM = scale(0.5, 0.5, 1.0 + shadowMapBias) * translate(1.0, 1.0, 0.0) * shadowMapProjView * inverse_viewMatrix;
 
             // convert tex gen matrix to float matrix and assign to light data
@@ -1017,7 +1238,18 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
         }
     }
 
-    if (requiresPerRenderShadowMaps && preRenderCommandGraph)
+    if (clusteredLighting && clusterLightIndices) updateClusters(projectionMatrix, n, f);
+
+    // snapshot the inputs used this frame so subsequent unchanged frames can take the fast path,
+    // unless rationed cached shadow map updates were deferred and still need refreshing next frame
+    _previousLightRecords.swap(_lightRecords);
+    _previousProjection = projectionMatrix;
+    _previousView = viewMatrix;
+    _previousNear = signatureNear;
+    _previousFar = signatureFar;
+    _previousValid = !deferredCachedUpdates;
+
+    if ((requiresPerRenderShadowMaps || rayShadowCommands) && preRenderCommandGraph)
     {
         if (rt.instrumentation && !preRenderCommandGraph->instrumentation)
         {
@@ -1029,8 +1261,95 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
     }
 }
 
+void ViewDependentState::updateClusters(const dmat4& projectionMatrix, double nearDistance, double farDistance)
+{
+    const uint32_t stride = maxLightsPerCluster + 1;
+    const uint32_t numClusters = clusterGridWidth * clusterGridHeight * clusterGridDepth;
+
+    for (uint32_t c = 0; c < numClusters; ++c) clusterLightIndices->at(c * stride) = 0;
+
+    // logarithmic depth slicing, slice = floor(log(eye_distance / nearDistance) * sliceScale)
+    const double sliceScale = static_cast<double>(clusterGridDepth) / std::log(farDistance / nearDistance);
+
+    clusterGridData->at(0).set(static_cast<float>(clusterGridWidth), static_cast<float>(clusterGridHeight), static_cast<float>(clusterGridDepth), static_cast<float>(maxLightsPerCluster));
+    clusterGridData->at(1).set(static_cast<float>(sliceScale), static_cast<float>(nearDistance), static_cast<float>(farDistance), 0.0f);
+    clusterGridData->dirty();
+    clusterLightIndices->dirty();
+
+    auto binLight = [&](uint32_t lightIndex, const dvec3& eye_position, double radius) {
+        double light_near = -eye_position.z - radius;
+        double light_far = -eye_position.z + radius;
+        if (light_far <= nearDistance || light_near >= farDistance) return;
+
+        light_near = std::max(light_near, nearDistance);
+        light_far = std::min(light_far, farDistance);
+
+        uint32_t firstSlice = static_cast<uint32_t>(std::max(0.0, std::floor(std::log(light_near / nearDistance) * sliceScale)));
+        uint32_t lastSlice = std::min(clusterGridDepth - 1, static_cast<uint32_t>(std::floor(std::log(light_far / nearDistance) * sliceScale)));
+
+        // project the clamped eye space bounding box of the light's sphere of influence to find the overlapped tiles
+        dbox ndcBounds;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            dvec4 p = projectionMatrix * dvec4(eye_position.x + ((corner & 1) ? radius : -radius),
+                                               eye_position.y + ((corner & 2) ? radius : -radius),
+                                               -((corner & 4) ? light_far : light_near),
+                                               1.0);
+            if (p.w > 0.0) ndcBounds.add(p.xyz / p.w);
+        }
+        if (!ndcBounds) return;
+
+        const double tileWidth = 2.0 / static_cast<double>(clusterGridWidth);
+        const double tileHeight = 2.0 / static_cast<double>(clusterGridHeight);
+
+        int32_t firstX = static_cast<int32_t>(std::floor((ndcBounds.min.x + 1.0) / tileWidth));
+        int32_t lastX = static_cast<int32_t>(std::floor((ndcBounds.max.x + 1.0) / tileWidth));
+        int32_t firstY = static_cast<int32_t>(std::floor((ndcBounds.min.y + 1.0) / tileHeight));
+        int32_t lastY = static_cast<int32_t>(std::floor((ndcBounds.max.y + 1.0) / tileHeight));
+        if (lastX < 0 || firstX >= static_cast<int32_t>(clusterGridWidth) || lastY < 0 || firstY >= static_cast<int32_t>(clusterGridHeight)) return;
+
+        uint32_t clampedFirstX = static_cast<uint32_t>(std::max(firstX, 0));
+        uint32_t clampedLastX = std::min(static_cast<uint32_t>(std::max(lastX, 0)), clusterGridWidth - 1);
+        uint32_t clampedFirstY = static_cast<uint32_t>(std::max(firstY, 0));
+        uint32_t clampedLastY = std::min(static_cast<uint32_t>(std::max(lastY, 0)), clusterGridHeight - 1);
+
+        for (uint32_t z = firstSlice; z <= lastSlice; ++z)
+        {
+            for (uint32_t y = clampedFirstY; y <= clampedLastY; ++y)
+            {
+                for (uint32_t x = clampedFirstX; x <= clampedLastX; ++x)
+                {
+                    uint32_t cluster = (z * clusterGridHeight + y) * clusterGridWidth + x;
+                    auto& count = clusterLightIndices->at(cluster * stride);
+                    if (count < maxLightsPerCluster)
+                    {
+                        clusterLightIndices->at(cluster * stride + 1 + count) = lightIndex;
+                        ++count;
+                    }
+                }
+            }
+        }
+    };
+
+    // point lights are indexed first with spot lights following on, matching the packing order of lightData
+    uint32_t lightIndex = 0;
+    for (auto& [mv, light] : pointLights)
+    {
+        auto eye_position = mv * light->position;
+        double radius = (light->radius > 0.0) ? light->radius : std::sqrt(light->intensity / minClusterLuminance);
+        binLight(lightIndex++, eye_position, radius);
+    }
+
+    for (auto& [mv, light] : spotLights)
+    {
+        auto eye_position = mv * light->position;
+        double radius = (light->radius > 0.0) ? light->radius : std::sqrt(light->intensity / minClusterLuminance);
+        binLight(lightIndex++, eye_position, radius);
+    }
+}
+
 void ViewDependentState::bindDescriptorSets(CommandBuffer& commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet)
 {
     auto vk = descriptorSet->vk(commandBuffer.deviceID);
-    vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, 1, &vk, 0, nullptr);
+    commandBuffer.dispatch->vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, 1, &vk, 0, nullptr);
 }
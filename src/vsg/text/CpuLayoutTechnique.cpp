@@ -10,6 +10,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/app/CompileManager.h>
+#include <vsg/app/UpdateOperations.h>
 #include <vsg/commands/BindIndexBuffer.h>
 #include <vsg/commands/BindVertexBuffers.h>
 #include <vsg/commands/Commands.h>
@@ -32,12 +34,94 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 #include <vsg/utils/SharedObjects.h>
 
+#include <type_traits>
+
 using namespace vsg;
 
+namespace
+{
+    // rebuilds the text on a worker thread into a fresh technique, compiles the result when a
+    // CompileManager is available, then hands the swap back to Viewer::update() so the live
+    // subgraph is only replaced at a frame safe point
+    struct AsyncTextSetup : public Inherit<Operation, AsyncTextSetup>
+    {
+        ref_ptr<CpuLayoutTechnique> technique;
+        ref_ptr<Text> text;
+        ref_ptr<TextGroup> textGroup;
+        uint32_t minimumAllocation = 0;
+        ref_ptr<const Options> options;
+
+        struct SwapIn : public Inherit<Operation, SwapIn>
+        {
+            ref_ptr<CpuLayoutTechnique> technique;
+            ref_ptr<CpuLayoutTechnique> workerTechnique;
+
+            void run() override { technique->swapIn(*workerTechnique); }
+        };
+
+        void run() override
+        {
+            auto workerTechnique = CpuLayoutTechnique::create();
+            if (text)
+                workerTechnique->setup(text.get(), minimumAllocation, options);
+            else if (textGroup)
+                workerTechnique->setup(textGroup.get(), minimumAllocation, options);
+
+            if (!workerTechnique->scenegraph) return;
+
+            if (technique->compileManager) technique->compileManager->compile(workerTechnique->scenegraph);
+
+            auto swap = SwapIn::create();
+            swap->technique = technique;
+            swap->workerTechnique = workerTechnique;
+            technique->updateOperations->add(swap);
+        }
+    };
+} // namespace
+
+CpuLayoutTechnique::~CpuLayoutTechnique()
+{
+}
+
+void CpuLayoutTechnique::swapIn(CpuLayoutTechnique& workerTechnique)
+{
+    textExtents = workerTechnique.textExtents;
+    scenegraph = workerTechnique.scenegraph;
+
+    vertices = workerTechnique.vertices;
+    colors = workerTechnique.colors;
+    outlineColors = workerTechnique.outlineColors;
+    outlineWidths = workerTechnique.outlineWidths;
+    texcoords = workerTechnique.texcoords;
+    centerAndAutoScaleDistances = workerTechnique.centerAndAutoScaleDistances;
+    indices = workerTechnique.indices;
+    drawIndexed = workerTechnique.drawIndexed;
+
+    bindVertexBuffers = workerTechnique.bindVertexBuffers;
+    bindIndexBuffer = workerTechnique.bindIndexBuffer;
+
+    _singleColor = workerTechnique._singleColor;
+    _singleOutlineColor = workerTechnique._singleOutlineColor;
+    _singleOutlineWidth = workerTechnique._singleOutlineWidth;
+    _singleCenterAutoScaleDistance = workerTechnique._singleCenterAutoScaleDistance;
+    _billboard = workerTechnique._billboard;
+}
+
 void CpuLayoutTechnique::setup(Text* text, uint32_t minimumAllocation, ref_ptr<const Options> options)
 {
     if (!text || !(text->text) || !text->font || !text->layout) return;
 
+    if (operationThreads && updateOperations)
+    {
+        auto op = AsyncTextSetup::create();
+        op->technique = ref_ptr<CpuLayoutTechnique>(this);
+        op->text = ref_ptr<Text>(text);
+        op->minimumAllocation = minimumAllocation;
+        op->options = options;
+        operationThreads->add(op);
+        return;
+    }
+
     const auto& font = text->font;
     auto& layout = text->layout;
     auto shaderSet = text->shaderSet ? text->shaderSet : createTextShaderSet(options);
@@ -57,6 +141,17 @@ void CpuLayoutTechnique::setup(TextGroup* textGroup, uint32_t minimumAllocation,
 {
     if (!textGroup || textGroup->children.empty()) return;
 
+    if (operationThreads && updateOperations)
+    {
+        auto op = AsyncTextSetup::create();
+        op->technique = ref_ptr<CpuLayoutTechnique>(this);
+        op->textGroup = ref_ptr<TextGroup>(textGroup);
+        op->minimumAllocation = minimumAllocation;
+        op->options = options;
+        operationThreads->add(op);
+        return;
+    }
+
     const auto& font = textGroup->font;
     auto shaderSet = textGroup->shaderSet ? textGroup->shaderSet : createTextShaderSet(options);
 
@@ -89,7 +184,8 @@ ref_ptr<Node> CpuLayoutTechnique::createRenderingSubgraph(ref_ptr<ShaderSet> sha
 {
     if (quads.empty()) return {};
 
-    ref_ptr<StateGroup> stategroup;
+    // reuse the existing rendering subgraph and update its buffers in place when possible
+    ref_ptr<StateGroup> stategroup = scenegraph.cast<StateGroup>();
 
     vec4 color = quads.front().colors[0];
     vec4 outlineColor = quads.front().outlineColors[0];
@@ -110,6 +206,26 @@ ref_ptr<Node> CpuLayoutTechnique::createRenderingSubgraph(ref_ptr<ShaderSet> sha
         if (quad.centerAndAutoScaleDistance != centerAndAutoScaleDistance) singleCenterAutoScaleDistance = false;
     }
 
+    // a change in the uniform/per vertex granularity of the attribute arrays or the billboard define makes the
+    // existing arrays and pipeline incompatible, so discard them and rebuild the subgraph from scratch
+    if (stategroup && (singleColor != _singleColor || singleOutlineColor != _singleOutlineColor || singleOutlineWidth != _singleOutlineWidth || singleCenterAutoScaleDistance != _singleCenterAutoScaleDistance || billboard != _billboard))
+    {
+        stategroup = {};
+        vertices = {};
+        colors = {};
+        outlineColors = {};
+        outlineWidths = {};
+        texcoords = {};
+        centerAndAutoScaleDistances = {};
+        indices = {};
+    }
+
+    _singleColor = singleColor;
+    _singleOutlineColor = singleOutlineColor;
+    _singleOutlineWidth = singleOutlineWidth;
+    _singleCenterAutoScaleDistance = singleCenterAutoScaleDistance;
+    _billboard = billboard;
+
     uint32_t num_quads = std::max(static_cast<uint32_t>(quads.size()), minimumAllocation);
     uint32_t num_vertices = num_quads * 4;
     uint32_t num_colors = singleColor ? 1 : num_vertices;
@@ -117,12 +233,20 @@ ref_ptr<Node> CpuLayoutTechnique::createRenderingSubgraph(ref_ptr<ShaderSet> sha
     uint32_t num_outlineWidths = singleOutlineWidth ? 1 : num_vertices;
     uint32_t num_centerAndAutoScaleDistances = billboard ? (singleCenterAutoScaleDistance ? 1 : num_vertices) : 0;
 
-    if (!vertices || num_vertices > vertices->size()) vertices = vec3Array::create(num_vertices);
-    if (!colors || num_colors > colors->size()) colors = vec4Array::create(num_colors);
-    if (!outlineColors || num_outlineColors > outlineColors->size()) outlineColors = vec4Array::create(num_outlineColors);
-    if (!outlineWidths || num_outlineWidths > outlineWidths->size()) outlineWidths = floatArray::create(num_outlineWidths);
-    if (!texcoords || num_vertices > texcoords->size()) texcoords = vec3Array::create(num_vertices);
-    if (billboard && (!centerAndAutoScaleDistances || num_centerAndAutoScaleDistances > centerAndAutoScaleDistances->size())) centerAndAutoScaleDistances = vec4Array::create(num_centerAndAutoScaleDistances);
+    auto allocateArray = [](auto& array, uint32_t requiredSize, bool& recreated) {
+        if (array && requiredSize <= array->size()) return;
+        array = std::remove_reference_t<decltype(array)>::element_type::create(requiredSize);
+        array->properties.dataVariance = DYNAMIC_DATA;
+        recreated = true;
+    };
+
+    bool arraysRecreated = false;
+    allocateArray(vertices, num_vertices, arraysRecreated);
+    allocateArray(colors, num_colors, arraysRecreated);
+    allocateArray(outlineColors, num_outlineColors, arraysRecreated);
+    allocateArray(outlineWidths, num_outlineWidths, arraysRecreated);
+    allocateArray(texcoords, num_vertices, arraysRecreated);
+    if (billboard) allocateArray(centerAndAutoScaleDistances, num_centerAndAutoScaleDistances, arraysRecreated);
 
     uint32_t vi = 0;
 
@@ -186,6 +310,8 @@ ref_ptr<Node> CpuLayoutTechnique::createRenderingSubgraph(ref_ptr<ShaderSet> sha
     uint32_t num_indices = num_quads * 6;
     if (!indices || num_indices > indices->valueCount())
     {
+        arraysRecreated = true;
+
         if (num_vertices > 65536) // check if requires uint or ushort indices
         {
             auto ui_indices = uintArray::create(num_indices);
@@ -231,6 +357,12 @@ ref_ptr<Node> CpuLayoutTechnique::createRenderingSubgraph(ref_ptr<ShaderSet> sha
     else
         drawIndexed->indexCount = static_cast<uint32_t>(quads.size() * 6);
 
+    // recreated arrays invalidate the buffers bound by an existing subgraph, so rebuild it
+    if (stategroup && arraysRecreated)
+    {
+        stategroup = {};
+    }
+
     // create StateGroup as the root of the scene/command graph to hold the GraphicsPipeline, and binding of Descriptors to decorate the whole graph
     if (!stategroup)
     {
@@ -295,9 +427,14 @@ ref_ptr<Node> CpuLayoutTechnique::createRenderingSubgraph(ref_ptr<ShaderSet> sha
     }
     else
     {
-        info("TODO : CpuLayoutTechnique::setup(), does not yet support updates. Consider using GpuLayoutTechnique instead.");
-        // bindVertexBuffers->copyDataToBuffers();
-        // bindIndexBuffer->copyDataToBuffers();
+        // existing subgraph, pipeline and buffer bindings retained - schedule transfer of the rewritten
+        // arrays through the dynamic data path
+        vertices->dirty();
+        texcoords->dirty();
+        colors->dirty();
+        outlineColors->dirty();
+        outlineWidths->dirty();
+        if (centerAndAutoScaleDistances) centerAndAutoScaleDistances->dirty();
     }
 
     return stategroup;
@@ -13,6 +13,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/text/TextLayout.h>
 #include <vsg/utils/SharedObjects.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 Font::Font()
@@ -57,6 +59,21 @@ void Font::write(Output& output) const
     }
 }
 
+void Font::setGlyphIndexForCharcode(uint32_t charcode, uint32_t glyphIndex)
+{
+    if (!charmap || charcode >= charmap->size())
+    {
+        // the charmap is only read on the CPU during layout so can be reallocated freely,
+        // grow by at least a factor of two to amortize the cost of repeated additions
+        uint32_t newSize = std::max(charcode + 1, charmap ? 2 * static_cast<uint32_t>(charmap->size()) : 256u);
+        auto newCharmap = uintArray::create(newSize, 0u);
+        if (charmap) std::copy(charmap->begin(), charmap->end(), newCharmap->begin());
+        charmap = newCharmap;
+    }
+
+    charmap->set(charcode, glyphIndex);
+}
+
 void Font::createFontImages()
 {
     if (!atlasImageInfo)
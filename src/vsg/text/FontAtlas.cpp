@@ -0,0 +1,133 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/text/FontAtlas.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+FontAtlas::FontAtlas(uint32_t width, uint32_t height, uint32_t maxGlyphs)
+{
+    atlas = ubyteArray2D::create(width, height, uint8_t(0), Data::Properties{VK_FORMAT_R8_UNORM});
+    atlas->properties.dataVariance = DYNAMIC_DATA;
+
+    glyphMetrics = GlyphMetricsArray::create(std::max(maxGlyphs, 1u));
+    glyphMetrics->properties.dataVariance = DYNAMIC_DATA;
+
+    // glyph 0 is the default glyph used for charcodes without an entry in a Font's charmap
+    glyphMetrics->at(0) = {};
+}
+
+FontAtlas::~FontAtlas()
+{
+}
+
+uint32_t FontAtlas::addGlyph(GlyphMetrics metrics, const ubyteArray2D& bitmap)
+{
+    if (numGlyphs >= static_cast<uint32_t>(glyphMetrics->valueCount()))
+    {
+        warn("FontAtlas::addGlyph() glyphMetrics capacity of ", glyphMetrics->valueCount(), " exhausted, unable to add glyph.");
+        return 0;
+    }
+
+    uint32_t requiredWidth = bitmap.width() + 2 * padding;
+    uint32_t requiredHeight = bitmap.height() + 2 * padding;
+
+    // start a new shelf when the glyph doesn't fit on the current one
+    if (_shelfX + requiredWidth > atlas->width())
+    {
+        _shelfY += _shelfHeight;
+        _shelfX = 0;
+        _shelfHeight = 0;
+    }
+
+    if (requiredWidth > atlas->width() || _shelfY + requiredHeight > atlas->height())
+    {
+        warn("FontAtlas::addGlyph() atlas of size ", atlas->width(), "x", atlas->height(), " exhausted, unable to pack glyph.");
+        return 0;
+    }
+
+    uint32_t x = _shelfX + padding;
+    uint32_t y = _shelfY + padding;
+
+    for (uint32_t row = 0; row < bitmap.height(); ++row)
+    {
+        for (uint32_t column = 0; column < bitmap.width(); ++column)
+        {
+            atlas->at(x + column, y + row) = bitmap.at(column, row);
+        }
+    }
+
+    _shelfX += requiredWidth;
+    if (requiredHeight > _shelfHeight) _shelfHeight = requiredHeight;
+
+    metrics.uvrect.set(static_cast<float>(x) / static_cast<float>(atlas->width()),
+                       static_cast<float>(y) / static_cast<float>(atlas->height()),
+                       static_cast<float>(x + bitmap.width()) / static_cast<float>(atlas->width()),
+                       static_cast<float>(y + bitmap.height()) / static_cast<float>(atlas->height()));
+
+    uint32_t glyphIndex = numGlyphs++;
+    glyphMetrics->at(glyphIndex) = metrics;
+
+    // schedule transfer of the new texels and metrics to the GPU
+    atlas->dirty();
+    glyphMetrics->dirty();
+
+    return glyphIndex;
+}
+
+void FontAtlas::assign(Font& font)
+{
+    if (!sharedObjects) sharedObjects = SharedObjects::create();
+
+    if (!atlasImageInfo)
+    {
+        auto sampler = Sampler::create();
+        sampler->magFilter = VK_FILTER_LINEAR;
+        sampler->minFilter = VK_FILTER_LINEAR;
+        // mipmaps are not regenerated when dynamic data is transferred, so sample the base level only
+        sampler->mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        sampler->maxLod = 0.0f;
+        sampler->addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+        sampler->addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+        sampler->addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+        sampler->borderColor = VK_BORDER_COLOR_INT_TRANSPARENT_BLACK;
+        atlasImageInfo = ImageInfo::create(sampler, atlas);
+    }
+    if (!glyphImageInfo)
+    {
+        auto glyphMetricSampler = Sampler::create();
+        glyphMetricSampler->magFilter = VK_FILTER_NEAREST;
+        glyphMetricSampler->minFilter = VK_FILTER_NEAREST;
+        glyphMetricSampler->mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        glyphMetricSampler->addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        glyphMetricSampler->addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        glyphMetricSampler->addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        glyphMetricSampler->unnormalizedCoordinates = VK_TRUE;
+
+        uint32_t stride = sizeof(vec4);
+        uint32_t numVec4PerGlyph = static_cast<uint32_t>(sizeof(GlyphMetrics) / sizeof(vec4));
+        uint32_t capacity = static_cast<uint32_t>(glyphMetrics->valueCount());
+
+        auto glyphMetricsProxy = vec4Array2D::create(glyphMetrics, 0, stride, numVec4PerGlyph, capacity,
+                                                     Data::Properties{VK_FORMAT_R32G32B32A32_SFLOAT});
+        glyphImageInfo = ImageInfo::create(glyphMetricSampler, glyphMetricsProxy);
+    }
+
+    font.atlas = atlas;
+    font.glyphMetrics = glyphMetrics;
+    font.sharedObjects = sharedObjects;
+    font.atlasImageInfo = atlasImageInfo;
+    font.glyphImageInfo = glyphImageInfo;
+}
@@ -72,10 +72,11 @@ void GpuLayoutTechnique::setup(Text* text, uint32_t minimumAllocation, ref_ptr<c
         {
             size = requiredSize;
 
-            if (textArray && requiredSize < static_cast<uint32_t>(textArray->valueCount()))
+            // reuse the existing allocation when the new text fits, leaving it to the caller to dirty
+            // the array only when codepoints have actually changed
+            if (textArray && requiredSize <= static_cast<uint32_t>(textArray->valueCount()))
             {
                 allocatedSize = static_cast<uint32_t>(textArray->valueCount());
-                textArray->dirty();
                 return;
             }
 
@@ -138,11 +139,16 @@ void GpuLayoutTechnique::setup(Text* text, uint32_t minimumAllocation, ref_ptr<c
         }
     };
 
+    auto previousTextArray = textArray;
+
     ConvertString convert(*(text->font), textArray, textArrayUpdated, minimumAllocation);
     text->text->accept(convert);
 
     if (convert.allocatedSize == 0) return;
 
+    // only schedule a transfer of the glyph indices when codepoints have actually changed
+    if (textArrayUpdated && textArray == previousTextArray) textArray->dirty();
+
     uint32_t num_quads = convert.size;
 
     // set up the layout data in a form digestible by the GPU.
@@ -165,8 +171,6 @@ void GpuLayoutTechnique::setup(Text* text, uint32_t minimumAllocation, ref_ptr<c
 
         billboard = standardLayout->billboard;
         assignValue(layoutStruct.billboardAutoScaleDistance, standardLayout->billboardAutoScaleDistance, textLayoutUpdated);
-
-        layoutValue->dirty();
     }
 
     // assign alignment offset
@@ -174,6 +178,9 @@ void GpuLayoutTechnique::setup(Text* text, uint32_t minimumAllocation, ref_ptr<c
     assignValue(layoutStruct.horizontalAlignment, alignment.x, textLayoutUpdated);
     assignValue(layoutStruct.verticalAlignment, alignment.y, textLayoutUpdated);
 
+    // only schedule a transfer of the layout settings when they have actually changed
+    if (textLayoutUpdated) layoutValue->dirty();
+
     if (!vertices)
     {
         vertices = vec3Array::create(4);
@@ -193,6 +200,16 @@ void GpuLayoutTechnique::setup(Text* text, uint32_t minimumAllocation, ref_ptr<c
 
     ref_ptr<StateGroup> stateGroup = scenegraph.cast<StateGroup>();
 
+    // if the text has outgrown its allocation the descriptors bound in the existing StateGroup still reference
+    // the previous textArray, so rebuild the subgraph. Assign a suitable minimumAllocation to avoid this for
+    // dynamically updated labels.
+    if (stateGroup && textArray != previousTextArray)
+    {
+        stateGroup = {};
+        scenegraph = {};
+        bindVertexBuffers = {};
+    }
+
     // create StateGroup as the root of the scene/command graph to hold the GraphicsPipeline, and binding of Descriptors to decorate the whole graph
     if (!stateGroup)
     {
@@ -246,9 +263,6 @@ void GpuLayoutTechnique::setup(Text* text, uint32_t minimumAllocation, ref_ptr<c
         drawCommands->addChild(draw);
         stateGroup->addChild(drawCommands);
     }
-    else
-    {
-    }
 }
 void GpuLayoutTechnique::setup(TextGroup* textGroup, uint32_t minimumAllocation, ref_ptr<const Options> options)
 {
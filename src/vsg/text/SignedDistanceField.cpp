@@ -0,0 +1,186 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/text/SignedDistanceField.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace vsg;
+
+namespace
+{
+    // 8SSEDT distance transform grid, storing per texel the offset to the nearest texel of the opposite set
+    struct DistanceGrid
+    {
+        int32_t width = 0;
+        int32_t height = 0;
+        std::vector<ivec2> delta;
+        ivec2 border; // value returned for out of bounds lookups
+
+        DistanceGrid(int32_t in_width, int32_t in_height, const ivec2& initial, const ivec2& in_border) :
+            width(in_width),
+            height(in_height),
+            delta(static_cast<size_t>(in_width) * static_cast<size_t>(in_height), initial),
+            border(in_border) {}
+
+        ivec2 get(int32_t x, int32_t y) const
+        {
+            if (x < 0 || y < 0 || x >= width || y >= height) return border;
+            return delta[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)];
+        }
+
+        void set(int32_t x, int32_t y, const ivec2& d)
+        {
+            delta[static_cast<size_t>(y) * static_cast<size_t>(width) + static_cast<size_t>(x)] = d;
+        }
+
+        static int64_t lengthSq(const ivec2& d)
+        {
+            return static_cast<int64_t>(d.x) * static_cast<int64_t>(d.x) + static_cast<int64_t>(d.y) * static_cast<int64_t>(d.y);
+        }
+
+        void propagate(int32_t x, int32_t y, ivec2& best, int32_t ox, int32_t oy) const
+        {
+            ivec2 candidate = get(x + ox, y + oy);
+            candidate.x += ox;
+            candidate.y += oy;
+            if (lengthSq(candidate) < lengthSq(best)) best = candidate;
+        }
+
+        void computePasses()
+        {
+            // forward pass
+            for (int32_t y = 0; y < height; ++y)
+            {
+                for (int32_t x = 0; x < width; ++x)
+                {
+                    ivec2 best = get(x, y);
+                    propagate(x, y, best, -1, 0);
+                    propagate(x, y, best, 0, -1);
+                    propagate(x, y, best, -1, -1);
+                    propagate(x, y, best, 1, -1);
+                    set(x, y, best);
+                }
+                for (int32_t x = width - 1; x >= 0; --x)
+                {
+                    ivec2 best = get(x, y);
+                    propagate(x, y, best, 1, 0);
+                    set(x, y, best);
+                }
+            }
+
+            // backward pass
+            for (int32_t y = height - 1; y >= 0; --y)
+            {
+                for (int32_t x = width - 1; x >= 0; --x)
+                {
+                    ivec2 best = get(x, y);
+                    propagate(x, y, best, 1, 0);
+                    propagate(x, y, best, 0, 1);
+                    propagate(x, y, best, -1, 1);
+                    propagate(x, y, best, 1, 1);
+                    set(x, y, best);
+                }
+                for (int32_t x = 0; x < width; ++x)
+                {
+                    ivec2 best = get(x, y);
+                    propagate(x, y, best, -1, 0);
+                    set(x, y, best);
+                }
+            }
+        }
+
+        float distance(int32_t x, int32_t y) const
+        {
+            return std::sqrt(static_cast<float>(lengthSq(get(x, y))));
+        }
+    };
+} // namespace
+
+ref_ptr<ubyteArray2D> vsg::generateSignedDistanceField(const ubyteArray2D& coverage, float spreadInTexels)
+{
+    int32_t width = static_cast<int32_t>(coverage.width());
+    int32_t height = static_cast<int32_t>(coverage.height());
+    if (width == 0 || height == 0) return {};
+
+    const ivec2 zero(0, 0);
+    const ivec2 unreached(width + height, width + height);
+
+    // outside grid tracks the distance to the nearest inside texel, out of bounds texels are outside
+    DistanceGrid outside(width, height, unreached, unreached);
+    // inside grid tracks the distance to the nearest outside texel
+    DistanceGrid inside(width, height, unreached, zero);
+
+    for (int32_t y = 0; y < height; ++y)
+    {
+        for (int32_t x = 0; x < width; ++x)
+        {
+            if (coverage.at(static_cast<uint32_t>(x), static_cast<uint32_t>(y)) >= 128)
+            {
+                outside.set(x, y, zero);
+            }
+            else
+            {
+                inside.set(x, y, zero);
+            }
+        }
+    }
+
+    outside.computePasses();
+    inside.computePasses();
+
+    auto sdf = ubyteArray2D::create(static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+                                    Data::Properties{VK_FORMAT_R8_UNORM});
+    sdf->properties = coverage.properties;
+    sdf->properties.format = VK_FORMAT_R8_UNORM;
+
+    for (int32_t y = 0; y < height; ++y)
+    {
+        for (int32_t x = 0; x < width; ++x)
+        {
+            // positive outside the glyph, negative inside, mapped so the glyph edge lands on 0.5
+            float signedDistance = outside.distance(x, y) - inside.distance(x, y);
+            float value = 0.5f - signedDistance / (2.0f * spreadInTexels);
+            if (value < 0.0f)
+                value = 0.0f;
+            else if (value > 1.0f)
+                value = 1.0f;
+            sdf->at(static_cast<uint32_t>(x), static_cast<uint32_t>(y)) = static_cast<uint8_t>(value * 255.0f + 0.5f);
+        }
+    }
+
+    return sdf;
+}
+
+void vsg::convertFontToSignedDistanceField(Font& font, float spreadInTexels)
+{
+    bool signedDistanceField = false;
+    if (font.getValue("signedDistanceField", signedDistanceField) && signedDistanceField) return;
+
+    auto coverage = font.atlas.cast<ubyteArray2D>();
+    if (!coverage)
+    {
+        warn("vsg::convertFontToSignedDistanceField() requires a single channel ubyteArray2D atlas, unable to convert.");
+        return;
+    }
+
+    auto sdf = generateSignedDistanceField(*coverage, spreadInTexels);
+    if (!sdf) return;
+
+    font.atlas = sdf;
+    font.setValue("signedDistanceField", true);
+
+    // invalidate any ImageInfo created against the previous atlas so descriptors are rebuilt against the converted one
+    font.atlasImageInfo = {};
+}
@@ -12,6 +12,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/threading/Affinity.h>
 
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
 #ifdef _WIN32
 
 #    include <process.h>
@@ -152,3 +158,274 @@ void vsg::setAffinity(const Affinity& affinity)
 }
 
 #endif
+
+//
+// CPU topology discovery
+//
+#if defined(_WIN32)
+
+static vsg::CpuTopology discoverCpuTopology()
+{
+    vsg::CpuTopology topology;
+
+    uint32_t numProcessors = std::thread::hardware_concurrency();
+    topology.logicalCpus.resize(numProcessors);
+    for (uint32_t cpu = 0; cpu < numProcessors; ++cpu) topology.logicalCpus[cpu].cpu = cpu;
+
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+    std::vector<char> buffer(length);
+    if (length == 0 || !GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length)) return topology;
+
+    std::vector<BYTE> efficiencyClasses(numProcessors, 0);
+    BYTE maxEfficiencyClass = 0;
+    uint32_t physicalCore = 0;
+
+    auto forEachCpuInGroupMask = [&numProcessors](const GROUP_AFFINITY& groupMask, auto callback) {
+        uint32_t base = static_cast<uint32_t>(groupMask.Group) * 64;
+        for (uint32_t bit = 0; bit < 64; ++bit)
+        {
+            if ((groupMask.Mask & (KAFFINITY(1) << bit)) != 0 && (base + bit) < numProcessors) callback(base + bit);
+        }
+    };
+
+    const char* ptr = buffer.data();
+    const char* end = buffer.data() + length;
+    while (ptr < end)
+    {
+        auto info = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(ptr);
+        if (info->Relationship == RelationProcessorCore)
+        {
+            for (WORD g = 0; g < std::max<WORD>(info->Processor.GroupCount, 1); ++g)
+            {
+                forEachCpuInGroupMask(info->Processor.GroupMask[g], [&](uint32_t cpu) {
+                    topology.logicalCpus[cpu].physicalCore = physicalCore;
+                    efficiencyClasses[cpu] = info->Processor.EfficiencyClass;
+                });
+            }
+            maxEfficiencyClass = std::max(maxEfficiencyClass, info->Processor.EfficiencyClass);
+            ++physicalCore;
+        }
+        else if (info->Relationship == RelationNumaNode)
+        {
+            forEachCpuInGroupMask(info->NumaNode.GroupMask, [&](uint32_t cpu) {
+                topology.logicalCpus[cpu].numaNode = info->NumaNode.NodeNumber;
+            });
+        }
+        ptr += info->Size;
+    }
+
+    // the highest efficiency class reported by the OS is the performance core class
+    for (auto& entry : topology.logicalCpus) entry.performanceCore = (efficiencyClasses[entry.cpu] == maxEfficiencyClass);
+
+    return topology;
+}
+
+#elif defined(__linux__) && !defined(__ANDROID__)
+
+static bool readValue(const std::string& path, uint32_t& value)
+{
+    std::ifstream fin(path);
+    if (!fin) return false;
+    fin >> value;
+    return !fin.fail();
+}
+
+/// parse a sysfs cpulist such as "0-3,8-11" into the individual cpu ids
+static std::vector<uint32_t> parseCpuList(const std::string& path)
+{
+    std::vector<uint32_t> cpus;
+
+    std::ifstream fin(path);
+    if (!fin) return cpus;
+
+    std::string line;
+    std::getline(fin, line);
+
+    std::stringstream str(line);
+    while (str.good())
+    {
+        uint32_t first = 0;
+        str >> first;
+        if (str.fail()) break;
+
+        uint32_t last = first;
+        if (str.peek() == '-')
+        {
+            str.ignore(1);
+            str >> last;
+        }
+
+        for (uint32_t cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+
+        if (str.peek() == ',') str.ignore(1);
+    }
+    return cpus;
+}
+
+static vsg::CpuTopology discoverCpuTopology()
+{
+    vsg::CpuTopology topology;
+
+    uint32_t numProcessors = std::thread::hardware_concurrency();
+
+    std::vector<uint32_t> maxFrequencies(numProcessors, 0);
+    uint32_t highestFrequency = 0;
+
+    // map the kernel's (package, core) pairs to sequential physical core ids
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> physicalCoreIds;
+
+    for (uint32_t cpu = 0; cpu < numProcessors; ++cpu)
+    {
+        std::string prefix = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+
+        vsg::CpuTopology::LogicalCpu entry;
+        entry.cpu = cpu;
+
+        uint32_t coreId = cpu;
+        uint32_t packageId = 0;
+        readValue(prefix + "/topology/core_id", coreId);
+        readValue(prefix + "/topology/physical_package_id", packageId);
+
+        auto key = std::pair<uint32_t, uint32_t>(packageId, coreId);
+        auto itr = physicalCoreIds.find(key);
+        if (itr == physicalCoreIds.end()) itr = physicalCoreIds.insert({key, static_cast<uint32_t>(physicalCoreIds.size())}).first;
+        entry.physicalCore = itr->second;
+
+        readValue(prefix + "/cpufreq/cpuinfo_max_freq", maxFrequencies[cpu]);
+        highestFrequency = std::max(highestFrequency, maxFrequencies[cpu]);
+
+        topology.logicalCpus.push_back(entry);
+    }
+
+    for (uint32_t node = 0;; ++node)
+    {
+        auto cpus = parseCpuList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (cpus.empty()) break;
+
+        for (auto cpu : cpus)
+        {
+            if (cpu < numProcessors) topology.logicalCpus[cpu].numaNode = node;
+        }
+    }
+
+    // classify hybrid P/E cores by maximum frequency - efficiency cores top out well below the
+    // performance cores, while favored-core turbo differences between P cores stay within the margin.
+    if (highestFrequency > 0)
+    {
+        for (auto& entry : topology.logicalCpus)
+        {
+            entry.performanceCore = (maxFrequencies[entry.cpu] >= (highestFrequency * 3) / 4);
+        }
+    }
+
+    return topology;
+}
+
+#else
+
+static vsg::CpuTopology discoverCpuTopology()
+{
+    // flat fallback - every logical cpu treated as its own physical performance core on a single node
+    vsg::CpuTopology topology;
+
+    uint32_t numProcessors = std::thread::hardware_concurrency();
+    topology.logicalCpus.resize(numProcessors);
+    for (uint32_t cpu = 0; cpu < numProcessors; ++cpu)
+    {
+        topology.logicalCpus[cpu].cpu = cpu;
+        topology.logicalCpus[cpu].physicalCore = cpu;
+    }
+
+    return topology;
+}
+
+#endif
+
+const vsg::CpuTopology& vsg::CpuTopology::get()
+{
+    static CpuTopology s_topology = discoverCpuTopology();
+    return s_topology;
+}
+
+bool vsg::CpuTopology::hybrid() const
+{
+    bool hasPerformance = false;
+    bool hasEfficiency = false;
+    for (auto& entry : logicalCpus)
+    {
+        if (entry.performanceCore)
+            hasPerformance = true;
+        else
+            hasEfficiency = true;
+    }
+    return hasPerformance && hasEfficiency;
+}
+
+std::vector<uint32_t> vsg::CpuTopology::distinctPerformanceCores() const
+{
+    std::vector<uint32_t> cpus;
+    std::set<uint32_t> seenCores;
+    for (auto& entry : logicalCpus)
+    {
+        if (entry.performanceCore && seenCores.insert(entry.physicalCore).second) cpus.push_back(entry.cpu);
+    }
+    return cpus;
+}
+
+std::vector<uint32_t> vsg::CpuTopology::efficiencyCores() const
+{
+    std::vector<uint32_t> cpus;
+    bool isHybrid = hybrid();
+    for (auto& entry : logicalCpus)
+    {
+        if (!isHybrid || !entry.performanceCore) cpus.push_back(entry.cpu);
+    }
+    return cpus;
+}
+
+std::vector<uint32_t> vsg::CpuTopology::cpusForNumaNode(uint32_t numaNode) const
+{
+    std::vector<uint32_t> cpus;
+    for (auto& entry : logicalCpus)
+    {
+        if (entry.numaNode == numaNode) cpus.push_back(entry.cpu);
+    }
+    return cpus;
+}
+
+vsg::Affinity vsg::renderThreadAffinity(uint32_t threadIndex)
+{
+    const auto& topology = CpuTopology::get();
+
+    auto cores = topology.distinctPerformanceCores();
+    if (threadIndex >= cores.size()) return {};
+
+    // pin to all SMT siblings of the selected physical core so the OS can still balance within it
+    uint32_t selectedCpu = cores[threadIndex];
+    uint32_t physicalCore = 0;
+    for (auto& entry : topology.logicalCpus)
+    {
+        if (entry.cpu == selectedCpu) physicalCore = entry.physicalCore;
+    }
+
+    Affinity affinity;
+    for (auto& entry : topology.logicalCpus)
+    {
+        if (entry.physicalCore == physicalCore) affinity.cpus.insert(entry.cpu);
+    }
+    return affinity;
+}
+
+vsg::Affinity vsg::pagerThreadAffinity()
+{
+    const auto& topology = CpuTopology::get();
+    if (!topology.hybrid()) return {};
+
+    Affinity affinity;
+    for (auto& entry : topology.logicalCpus)
+    {
+        if (!entry.performanceCore) affinity.cpus.insert(entry.cpu);
+    }
+    return affinity;
+}
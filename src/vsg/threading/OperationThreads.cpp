@@ -15,26 +15,59 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 using namespace vsg;
 
-OperationThreads::OperationThreads(uint32_t numThreads, ref_ptr<ActivityStatus> in_status) :
-    status(in_status)
+OperationThreads::OperationThreads(uint32_t numThreads, ref_ptr<ActivityStatus> in_status, bool in_useWorkStealing) :
+    status(in_status),
+    useWorkStealing(in_useWorkStealing)
 {
     if (!status) status = ActivityStatus::create();
     queue = OperationQueue::create(status);
 
-    auto run = [](ref_ptr<OperationQueue> q, ref_ptr<ActivityStatus> thread_status) {
-        while (thread_status->active())
+    if (useWorkStealing)
+    {
+        localQueues.reserve(numThreads);
+        for (uint32_t i = 0; i < numThreads; ++i)
         {
-            ref_ptr<Operation> operation = q->take_when_available();
-            if (operation)
+            localQueues.push_back(LocalQueue::create());
+        }
+
+        auto run_stealing = [](OperationThreads* operationThreads, size_t index) {
+            auto thread_status = operationThreads->status;
+            while (thread_status->active())
             {
-                operation->run();
+                if (auto operation = operationThreads->_takeOrSteal(index))
+                {
+                    operation->run();
+                }
+                else
+                {
+                    std::unique_lock lock(operationThreads->_sleepMutex);
+                    operationThreads->_sleepCV.wait_for(lock, std::chrono::milliseconds(100));
+                }
             }
-        }
-    };
+        };
 
-    for (size_t i = 0; i < numThreads; ++i)
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back(run_stealing, this, i);
+        }
+    }
+    else
     {
-        threads.emplace_back(run, queue, status);
+        auto run = [](ref_ptr<OperationQueue> q, ref_ptr<ActivityStatus> thread_status) {
+            while (thread_status->active())
+            {
+                ref_ptr<Operation> operation = q->take_when_available();
+                if (operation)
+                {
+                    operation->run();
+                }
+            }
+        };
+
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back(run, queue, status);
+        }
     }
 }
 
@@ -43,8 +76,41 @@ OperationThreads::~OperationThreads()
     stop();
 }
 
+ref_ptr<Operation> OperationThreads::_takeOrSteal(size_t index)
+{
+    // local ring first, then the shared overflow queue, then steal from the neighbours' rings
+    if (index < localQueues.size())
+    {
+        if (auto operation = localQueues[index]->pop()) return operation;
+    }
+
+    if (auto operation = queue->take()) return operation;
+
+    for (size_t i = 1; i < localQueues.size(); ++i)
+    {
+        if (auto operation = localQueues[(index + i) % localQueues.size()]->pop()) return operation;
+    }
+
+    return {};
+}
+
+void OperationThreads::_notify()
+{
+    _sleepCV.notify_one();
+}
+
 void OperationThreads::run()
 {
+    if (useWorkStealing)
+    {
+        // use an index one past the worker threads so stealing cycles through all the local rings
+        while (ref_ptr<Operation> operation = _takeOrSteal(localQueues.size()))
+        {
+            operation->run();
+        }
+        return;
+    }
+
     while (ref_ptr<Operation> operation = queue->take())
     {
         operation->run();
@@ -55,6 +121,8 @@ void OperationThreads::stop()
 {
     status->set(false);
 
+    _sleepCV.notify_all();
+
     for (auto& thread : threads)
     {
         thread.join();
@@ -0,0 +1,210 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/threading/TaskGraph.h>
+
+using namespace vsg;
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Task
+//
+Task::Task(ref_ptr<Operation> in_operation) :
+    operation(in_operation)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// TaskGraph
+//
+TaskGraph::TaskGraph(uint32_t numThreads, ref_ptr<ActivityStatus> in_status) :
+    status(in_status)
+{
+    if (!status) status = ActivityStatus::create();
+
+    if (numThreads == 0) numThreads = 1;
+
+    _deques.reserve(numThreads);
+    for (uint32_t i = 0; i < numThreads; ++i)
+    {
+        _deques.push_back(std::make_unique<WorkerDeque>());
+    }
+
+    auto run_worker = [](TaskGraph* taskGraph, size_t index) {
+        auto thread_status = taskGraph->status;
+        while (thread_status->active())
+        {
+            if (auto task = taskGraph->_takeOrSteal(index))
+            {
+                taskGraph->_runTask(task, index);
+            }
+            else
+            {
+                std::unique_lock lock(taskGraph->_sleepMutex);
+                taskGraph->_sleepCV.wait_for(lock, std::chrono::milliseconds(100));
+            }
+        }
+    };
+
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back(run_worker, this, i);
+    }
+}
+
+TaskGraph::~TaskGraph()
+{
+    stop();
+}
+
+ref_ptr<Task> TaskGraph::add(ref_ptr<Operation> operation, const std::vector<ref_ptr<Task>>& dependencies)
+{
+    auto task = Task::create(operation);
+
+    _pendingTasks.fetch_add(1, std::memory_order_relaxed);
+
+    // hold one extra count while the edges are registered so a dependency that completes mid
+    // registration cannot release the task before all its edges are in place
+    task->_remainingDependencies.store(1, std::memory_order_relaxed);
+
+    for (auto& dependency : dependencies)
+    {
+        if (!dependency) continue;
+
+        // registration and the dependency's completion are serialized by its _edgeMutex,
+        // so each incomplete dependency is counted exactly once however the two interleave
+        std::scoped_lock lock(dependency->_edgeMutex);
+        if (!dependency->_completed.load(std::memory_order_relaxed))
+        {
+            task->_remainingDependencies.fetch_add(1, std::memory_order_relaxed);
+            dependency->_successors.push_back(task);
+        }
+    }
+
+    if (task->_remainingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        auto index = _nextDeque.fetch_add(1, std::memory_order_relaxed) % _deques.size();
+        _enqueue(task, index);
+    }
+
+    return task;
+}
+
+void TaskGraph::_enqueue(ref_ptr<Task> task, size_t index)
+{
+    {
+        std::scoped_lock lock(_deques[index]->mutex);
+        _deques[index]->tasks.push_back(task);
+    }
+    _sleepCV.notify_one();
+}
+
+ref_ptr<Task> TaskGraph::_takeOrSteal(size_t index)
+{
+    // back of our own deque first for locality, then steal from the front of the neighbours' deques
+    if (index < _deques.size())
+    {
+        auto& ours = *_deques[index];
+        std::scoped_lock lock(ours.mutex);
+        if (!ours.tasks.empty())
+        {
+            auto task = ours.tasks.back();
+            ours.tasks.pop_back();
+            return task;
+        }
+    }
+
+    for (size_t i = 1; i <= _deques.size(); ++i)
+    {
+        auto& victim = *_deques[(index + i) % _deques.size()];
+        std::scoped_lock lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            auto task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return task;
+        }
+    }
+
+    return {};
+}
+
+void TaskGraph::_runTask(ref_ptr<Task> task, size_t index)
+{
+    if (task->operation) task->operation->run();
+
+    std::vector<ref_ptr<Task>> successors;
+    {
+        std::scoped_lock lock(task->_edgeMutex);
+        task->_completed.store(true, std::memory_order_release);
+        successors.swap(task->_successors);
+    }
+
+    for (auto& successor : successors)
+    {
+        if (successor->_remainingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // enqueue locally so the continuation runs on the thread whose caches hold its inputs
+            _enqueue(successor, index < _deques.size() ? index : 0);
+        }
+    }
+
+    if (_pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        std::scoped_lock lock(_waitMutex);
+        _waitCV.notify_all();
+    }
+}
+
+void TaskGraph::run()
+{
+    // use an index one past the worker threads so stealing cycles through all the deques
+    while (_pendingTasks.load(std::memory_order_acquire) > 0 && status->active())
+    {
+        if (auto task = _takeOrSteal(_deques.size()))
+        {
+            _runTask(task, _deques.size());
+        }
+        else
+        {
+            // tasks are in flight on the workers, wait for a completion to release more work or finish
+            std::unique_lock lock(_waitMutex);
+            _waitCV.wait_for(lock, std::chrono::milliseconds(1));
+        }
+    }
+}
+
+void TaskGraph::wait()
+{
+    std::unique_lock lock(_waitMutex);
+    while (_pendingTasks.load(std::memory_order_acquire) > 0 && status->active())
+    {
+        _waitCV.wait_for(lock, std::chrono::milliseconds(100));
+    }
+}
+
+void TaskGraph::stop()
+{
+    status->set(false);
+
+    _sleepCV.notify_all();
+    _waitCV.notify_all();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    threads.clear();
+}
@@ -0,0 +1,105 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/ui/EventPool.h>
+
+using namespace vsg;
+
+EventPool::EventPool(size_t in_poolSize) :
+    poolSize(in_poolSize)
+{
+}
+
+ref_ptr<MoveEvent> EventPool::acquireMoveEvent(Window* window, time_point time, int32_t x, int32_t y, ButtonMask mask)
+{
+    auto event = _acquire(_moveEvents, _nextMoveEvent);
+    event->window = window;
+    event->time = time;
+    event->handled = false;
+    event->x = x;
+    event->y = y;
+    event->mask = mask;
+    return event;
+}
+
+ref_ptr<ScrollWheelEvent> EventPool::acquireScrollWheelEvent(Window* window, time_point time, const vec3& delta)
+{
+    auto event = _acquire(_scrollWheelEvents, _nextScrollWheelEvent);
+    event->window = window;
+    event->time = time;
+    event->handled = false;
+    event->delta = delta;
+    return event;
+}
+
+ref_ptr<TouchMoveEvent> EventPool::acquireTouchMoveEvent(Window* window, time_point time, uint32_t x, uint32_t y, uint32_t id)
+{
+    auto event = _acquire(_touchMoveEvents, _nextTouchMoveEvent);
+    event->window = window;
+    event->time = time;
+    event->handled = false;
+    event->x = x;
+    event->y = y;
+    event->id = id;
+    return event;
+}
+
+size_t vsg::coalesceEvents(UIEvents& events)
+{
+    size_t removed = 0;
+
+    auto prev = events.end();
+    for (auto itr = events.begin(); itr != events.end(); ++itr)
+    {
+        bool merged = false;
+
+        // only immediately adjacent events of the same type are considered, so an intervening
+        // press/release or key event flushes the run and ordering is preserved
+        if (prev != events.end() && (*prev)->type_info() == (*itr)->type_info())
+        {
+            const auto& type = (*itr)->type_info();
+            if (type == typeid(MoveEvent))
+            {
+                auto current = static_cast<MoveEvent*>(itr->get());
+                auto previous = static_cast<MoveEvent*>(prev->get());
+                merged = (previous->window == current->window) && (previous->mask == current->mask);
+            }
+            else if (type == typeid(ScrollWheelEvent))
+            {
+                auto current = static_cast<ScrollWheelEvent*>(itr->get());
+                auto previous = static_cast<ScrollWheelEvent*>(prev->get());
+                if (previous->window == current->window)
+                {
+                    current->delta += previous->delta;
+                    merged = true;
+                }
+            }
+            else if (type == typeid(TouchMoveEvent))
+            {
+                auto current = static_cast<TouchMoveEvent*>(itr->get());
+                auto previous = static_cast<TouchMoveEvent*>(prev->get());
+                merged = (previous->window == current->window) && (previous->id == current->id);
+            }
+        }
+
+        if (merged)
+        {
+            events.erase(prev);
+            ++removed;
+        }
+
+        prev = itr;
+    }
+
+    return removed;
+}
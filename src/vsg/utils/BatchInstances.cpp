@@ -0,0 +1,170 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/MatrixTransform.h>
+#include <vsg/utils/BatchInstances.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+BatchInstances::BatchInstances()
+{
+}
+
+void BatchInstances::apply(Group& group)
+{
+    for (auto& child : group.children)
+    {
+        Occurrence occurrence;
+        if (_matchInstanceSubgraph(group, child, occurrence))
+        {
+            _candidates[{occurrence.draw.get(), occurrence.stateGroup}].push_back(occurrence);
+        }
+        else
+        {
+            child->accept(*this);
+        }
+    }
+}
+
+void BatchInstances::apply(Transform& transform)
+{
+    // a Transform subclass we can't inspect has an unknown matrix, so nothing beneath it can be hoisted
+    bool previous_pathBatchable = _pathBatchable;
+    _pathBatchable = false;
+
+    apply(static_cast<Group&>(transform));
+
+    _pathBatchable = previous_pathBatchable;
+}
+
+void BatchInstances::apply(MatrixTransform& mt)
+{
+    // reached when the MatrixTransform is not itself part of a candidate subgraph - accumulate its matrix
+    // and look for candidates amongst its children. A dynamic transform invalidates the matrices of all
+    // candidates beneath it, as they would be baked with a stale value.
+    bool previous_pathBatchable = _pathBatchable;
+    dmat4 previous_matrix = _matrix;
+
+    if (dynamic(&mt) || mt.type_info() != typeid(MatrixTransform))
+        _pathBatchable = false;
+    else
+        _matrix = _matrix * mt.matrix;
+
+    apply(static_cast<Group&>(mt));
+
+    _pathBatchable = previous_pathBatchable;
+    _matrix = previous_matrix;
+}
+
+bool BatchInstances::_matchInstanceSubgraph(Group& parent, const ref_ptr<Node>& subgraphRoot, Occurrence& occurrence) const
+{
+    if (!_pathBatchable) return false;
+
+    occurrence.parent = &parent;
+    occurrence.subgraphRoot = subgraphRoot;
+    occurrence.matrix = _matrix;
+
+    // walk the chain of single child MatrixTransform/Group/StateGroup nodes leading to a VertexIndexDraw
+    Node* node = subgraphRoot.get();
+    while (node)
+    {
+        const auto& type = node->type_info();
+        if (type == typeid(VertexIndexDraw))
+        {
+            occurrence.draw = ref_ptr<VertexIndexDraw>(static_cast<VertexIndexDraw*>(node));
+            return true;
+        }
+        else if (type == typeid(MatrixTransform))
+        {
+            auto mt = static_cast<MatrixTransform*>(node);
+            if (mt->children.size() != 1) return false;
+            if (dynamic(mt)) occurrence.dynamic = true;
+            occurrence.matrix = occurrence.matrix * mt->matrix;
+            node = mt->children[0].get();
+        }
+        else if (type == typeid(StateGroup))
+        {
+            auto stateGroup = static_cast<StateGroup*>(node);
+            if (stateGroup->children.size() != 1 || occurrence.stateGroup) return false;
+            occurrence.stateGroup = stateGroup;
+            node = stateGroup->children[0].get();
+        }
+        else if (type == typeid(Group))
+        {
+            auto group = static_cast<Group*>(node);
+            if (group->children.size() != 1) return false;
+            node = group->children[0].get();
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+uint32_t BatchInstances::batch(ref_ptr<Group> attachPoint)
+{
+    uint32_t numMerged = 0;
+    for (auto& [key, occurrences] : _candidates)
+    {
+        if (occurrences.size() < static_cast<size_t>(minimumInstances)) continue;
+
+        // hoist the per instance transforms into a mat4 array, one matrix per replaced subgraph
+        auto transforms = mat4Array::create(static_cast<uint32_t>(occurrences.size()));
+        bool dynamicInstances = false;
+        for (size_t i = 0; i < occurrences.size(); ++i)
+        {
+            transforms->set(i, mat4(occurrences[i].matrix));
+            if (occurrences[i].dynamic) dynamicInstances = true;
+        }
+        if (dynamicInstances) transforms->properties.dataVariance = DYNAMIC_DATA;
+
+        // clone the draw, sharing the geometry arrays and appending the instance array as an extra vertex buffer
+        auto instancedDraw = VertexIndexDraw::create(*occurrences.front().draw);
+        instancedDraw->arrays.push_back(BufferInfo::create(transforms));
+        instancedDraw->instanceCount = static_cast<uint32_t>(occurrences.size());
+        instancedDraw->firstInstance = 0;
+
+        // remove the original subgraphs from their parents
+        for (auto& occurrence : occurrences)
+        {
+            auto& children = occurrence.parent->children;
+            if (auto itr = std::find(children.begin(), children.end(), occurrence.subgraphRoot); itr != children.end())
+            {
+                children.erase(itr);
+            }
+        }
+
+        // attach the instanced draw, carrying over the state commands of the replaced subgraph's StateGroup
+        if (auto sourceStateGroup = occurrences.front().stateGroup)
+        {
+            auto stateGroup = StateGroup::create();
+            stateGroup->stateCommands = sourceStateGroup->stateCommands;
+            stateGroup->prototypeArrayState = sourceStateGroup->prototypeArrayState;
+            stateGroup->addChild(instancedDraw);
+            attachPoint->addChild(stateGroup);
+        }
+        else
+        {
+            attachPoint->addChild(instancedDraw);
+        }
+
+        instancedDraws.push_back(InstancedDraw{instancedDraw, transforms});
+        ++numMerged;
+    }
+
+    _candidates.clear();
+    return numMerged;
+}
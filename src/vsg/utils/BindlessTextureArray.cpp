@@ -0,0 +1,73 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/utils/BindlessTextureArray.h>
+
+using namespace vsg;
+
+BindlessTextureArray::BindlessTextureArray(uint32_t in_maxTextures, uint32_t in_set, uint32_t in_binding) :
+    maxTextures(in_maxTextures),
+    set(in_set),
+    binding(in_binding),
+    defaultSampler(Sampler::create()),
+    descriptor(DescriptorImage::create(ImageInfoList{}, in_binding, 0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER))
+{
+}
+
+BindlessTextureArray::~BindlessTextureArray()
+{
+}
+
+void BindlessTextureArray::assignTo(ShaderSet& shaderSet, const std::string& name, const std::string& define, VkShaderStageFlags stageFlags) const
+{
+    shaderSet.addDescriptorBinding(name, define, set, binding, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maxTextures, stageFlags, {}, VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT);
+}
+
+uint32_t BindlessTextureArray::addTexture(ref_ptr<Data> textureData, ref_ptr<Sampler> sampler)
+{
+    if (!sampler) sampler = defaultSampler;
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto key = std::make_pair(static_cast<const Data*>(textureData.get()), static_cast<const Sampler*>(sampler.get()));
+    if (auto itr = _textureIndices.find(key); itr != _textureIndices.end()) return itr->second;
+
+    if (descriptor->imageInfoList.size() >= maxTextures)
+    {
+        warn("BindlessTextureArray::addTexture(..) texture array full, maxTextures = ", maxTextures, ", texture not added.");
+        return 0;
+    }
+
+    auto index = static_cast<uint32_t>(descriptor->imageInfoList.size());
+    descriptor->imageInfoList.push_back(ImageInfo::create(sampler, textureData));
+    _textureIndices[key] = index;
+
+    return index;
+}
+
+uint32_t BindlessTextureArray::addTexture(ref_ptr<ImageInfo> imageInfo)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    if (descriptor->imageInfoList.size() >= maxTextures)
+    {
+        warn("BindlessTextureArray::addTexture(..) texture array full, maxTextures = ", maxTextures, ", texture not added.");
+        return 0;
+    }
+
+    auto index = static_cast<uint32_t>(descriptor->imageInfoList.size());
+    descriptor->imageInfoList.push_back(imageInfo);
+
+    return index;
+}
@@ -67,7 +67,13 @@ ref_ptr<StateGroup> Builder::createStateGroup(const StateInfo& stateInfo)
 
     // set up graphics pipeline
     DescriptorSetLayoutBindings descriptorBindings;
-    if (stateInfo.image)
+    if (stateInfo.imageInfo)
+    {
+        graphicsPipelineConfig->assignTexture("diffuseMap", ImageInfoList{stateInfo.imageInfo});
+
+        if (stateInfo.greyscale) defines.insert("VSG_GREYSCALE_DIFFUSE_MAP");
+    }
+    else if (stateInfo.image)
     {
         auto sampler = Sampler::create();
         sampler->addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
@@ -200,6 +206,7 @@ vsg::ref_ptr<vsg::Data> Builder::instancePositions(const GeometryInfo& info, uin
     if (info.positions && info.positions->dataAvailable())
     {
         instanceCount = static_cast<uint32_t>(info.positions->valueCount());
+        if (info.dynamic) info.positions->properties.dataVariance = DYNAMIC_DATA;
         return info.positions;
     }
     return {};
@@ -207,10 +214,15 @@ vsg::ref_ptr<vsg::Data> Builder::instancePositions(const GeometryInfo& info, uin
 
 vsg::ref_ptr<vsg::Data> Builder::instanceColors(const GeometryInfo& info, uint32_t instanceCount)
 {
+    ref_ptr<Data> colors;
     if (info.colors && (info.colors->valueCount() == instanceCount))
-        return info.colors;
+        colors = info.colors;
     else
-        return vec4Array::create(instanceCount, info.color);
+        colors = vec4Array::create(instanceCount, info.color);
+
+    if (info.dynamic) colors->properties.dataVariance = DYNAMIC_DATA;
+
+    return colors;
 }
 
 vec3 Builder::y_texcoord(const StateInfo& info) const
@@ -230,8 +242,15 @@ ref_ptr<Node> Builder::decorateAndCompileIfRequired(const GeometryInfo& info, co
 {
     ref_ptr<Node> subgraph = node;
 
+    // when instance positions have been assigned make sure the pipeline is set up to consume them
+    StateInfo localStateInfo = stateInfo;
+    if (info.positions && !stateInfo.billboard && !stateInfo.instance_positions_vec3 && info.positions.cast<vec3Array>())
+    {
+        localStateInfo.instance_positions_vec3 = true;
+    }
+
     // create StateGroup as the root of the scene/command graph to hold the GraphicsPipeline, and binding of Descriptors to decorate the whole graph
-    if (auto stateGroup = createStateGroup(stateInfo))
+    if (auto stateGroup = createStateGroup(localStateInfo))
     {
         stateGroup->addChild(node);
         subgraph = stateGroup;
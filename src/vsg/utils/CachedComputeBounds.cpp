@@ -0,0 +1,121 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/utils/CachedComputeBounds.h>
+
+using namespace vsg;
+
+CachedComputeBounds::CachedComputeBounds(ref_ptr<ArrayState> initialArrayState) :
+    Inherit(initialArrayState)
+{
+}
+
+void CachedComputeBounds::reset()
+{
+    bounds = {};
+    matrixStack.clear();
+    ushort_indices = {};
+    uint_indices = {};
+
+    for (auto& [key, entry] : _cache) entry.used = false;
+}
+
+void CachedComputeBounds::clearCache()
+{
+    _cache.clear();
+}
+
+void CachedComputeBounds::prune()
+{
+    for (auto itr = _cache.begin(); itr != _cache.end();)
+    {
+        if (itr->second.used)
+            ++itr;
+        else
+            itr = _cache.erase(itr);
+    }
+}
+
+void CachedComputeBounds::applyDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    auto& arrayState = *arrayStateStack.back();
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    uint32_t endVertex = firstVertex + vertexCount;
+
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        auto vertices = arrayState.vertexArray(instanceIndex);
+        if (!vertices) continue;
+
+        DrawKey key{vertices.get(), nullptr, firstVertex, vertexCount};
+        auto& entry = _cache[key];
+        if (!entry.vertices || entry.vertices->differentModifiedCount(entry.verticesModified))
+        {
+            entry.vertices = vertices;
+            entry.vertices->getModifiedCount(entry.verticesModified);
+
+            entry.localBounds = {};
+            for (uint32_t i = firstVertex; i < endVertex; ++i)
+            {
+                entry.localBounds.add(dvec3(vertices->at(i)));
+            }
+        }
+
+        entry.used = true;
+        if (entry.localBounds.valid()) add(entry.localBounds);
+    }
+}
+
+void CachedComputeBounds::applyDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    if (!ushort_indices && !uint_indices) return;
+
+    auto& arrayState = *arrayStateStack.back();
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    uint32_t endIndex = firstIndex + indexCount;
+    const Data* indices = ushort_indices ? static_cast<const Data*>(ushort_indices.get()) : static_cast<const Data*>(uint_indices.get());
+
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        auto vertices = arrayState.vertexArray(instanceIndex);
+        if (!vertices) continue;
+
+        DrawKey key{vertices.get(), indices, firstIndex, indexCount};
+        auto& entry = _cache[key];
+        if (!entry.vertices || entry.vertices->differentModifiedCount(entry.verticesModified) || entry.indices->differentModifiedCount(entry.indicesModified))
+        {
+            entry.vertices = vertices;
+            entry.vertices->getModifiedCount(entry.verticesModified);
+            entry.indices = ref_ptr<const Data>(indices);
+            entry.indices->getModifiedCount(entry.indicesModified);
+
+            entry.localBounds = {};
+            if (ushort_indices)
+            {
+                for (uint32_t i = firstIndex; i < endIndex; ++i)
+                {
+                    entry.localBounds.add(dvec3(vertices->at(ushort_indices->at(i))));
+                }
+            }
+            else
+            {
+                for (uint32_t i = firstIndex; i < endIndex; ++i)
+                {
+                    entry.localBounds.add(dvec3(vertices->at(uint_indices->at(i))));
+                }
+            }
+        }
+
+        entry.used = true;
+        if (entry.localBounds.valid()) add(entry.localBounds);
+    }
+}
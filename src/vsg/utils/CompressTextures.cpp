@@ -0,0 +1,525 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array2D.h>
+#include <vsg/io/FileSystem.h>
+#include <vsg/io/VSG.h>
+#include <vsg/state/BindDescriptorSet.h>
+#include <vsg/state/DescriptorImage.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/CompressTextures.h>
+
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+using namespace vsg;
+
+namespace
+{
+    bool powerOfTwo(uint32_t value)
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+
+    uint16_t to565(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    }
+
+    void from565(uint16_t c, int32_t rgb[3])
+    {
+        int32_t r = (c >> 11) & 0x1f;
+        int32_t g = (c >> 5) & 0x3f;
+        int32_t b = c & 0x1f;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    // gather a 4x4 block of pixels, replicating the edge for levels smaller than a block
+    void extractBlock(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t numComponents, uint32_t blockX, uint32_t blockY, uint8_t block[16][4])
+    {
+        for (uint32_t y = 0; y < 4; ++y)
+        {
+            uint32_t sy = std::min(blockY * 4 + y, height - 1);
+            for (uint32_t x = 0; x < 4; ++x)
+            {
+                uint32_t sx = std::min(blockX * 4 + x, width - 1);
+                const uint8_t* source = pixels + (static_cast<size_t>(sy) * width + sx) * numComponents;
+                for (uint32_t c = 0; c < numComponents; ++c) block[y * 4 + x][c] = source[c];
+            }
+        }
+    }
+
+    // range fit BC1 color block - per channel min/max endpoints quantized to 565,
+    // each pixel mapped to the nearest of the four palette entries
+    void encodeColorBlock(const uint8_t block[16][4], uint8_t* out)
+    {
+        uint8_t minimum[3] = {255, 255, 255};
+        uint8_t maximum[3] = {0, 0, 0};
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                minimum[c] = std::min(minimum[c], block[i][c]);
+                maximum[c] = std::max(maximum[c], block[i][c]);
+            }
+        }
+
+        uint16_t c0 = to565(maximum[0], maximum[1], maximum[2]);
+        uint16_t c1 = to565(minimum[0], minimum[1], minimum[2]);
+        if (c0 < c1) std::swap(c0, c1);
+
+        out[0] = static_cast<uint8_t>(c0 & 0xff);
+        out[1] = static_cast<uint8_t>(c0 >> 8);
+        out[2] = static_cast<uint8_t>(c1 & 0xff);
+        out[3] = static_cast<uint8_t>(c1 >> 8);
+
+        if (c0 == c1)
+        {
+            out[4] = out[5] = out[6] = out[7] = 0;
+            return;
+        }
+
+        int32_t palette[4][3];
+        from565(c0, palette[0]);
+        from565(c1, palette[1]);
+        for (uint32_t c = 0; c < 3; ++c)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+
+        for (uint32_t y = 0; y < 4; ++y)
+        {
+            uint8_t row = 0;
+            for (uint32_t x = 0; x < 4; ++x)
+            {
+                const uint8_t* pixel = block[y * 4 + x];
+                int32_t bestDistance = std::numeric_limits<int32_t>::max();
+                uint8_t bestIndex = 0;
+                for (uint8_t p = 0; p < 4; ++p)
+                {
+                    int32_t dr = palette[p][0] - pixel[0];
+                    int32_t dg = palette[p][1] - pixel[1];
+                    int32_t db = palette[p][2] - pixel[2];
+                    int32_t distance = dr * dr + dg * dg + db * db;
+                    if (distance < bestDistance)
+                    {
+                        bestDistance = distance;
+                        bestIndex = p;
+                    }
+                }
+                row |= static_cast<uint8_t>(bestIndex << (x * 2));
+            }
+            out[4 + y] = row;
+        }
+    }
+
+    // range fit BC4 single channel block - min/max endpoints with the 8 entry interpolated palette
+    void encodeAlphaBlock(const uint8_t block[16][4], uint32_t component, uint8_t* out)
+    {
+        uint8_t minimum = 255;
+        uint8_t maximum = 0;
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            minimum = std::min(minimum, block[i][component]);
+            maximum = std::max(maximum, block[i][component]);
+        }
+
+        out[0] = maximum;
+        out[1] = minimum;
+
+        if (maximum == minimum)
+        {
+            std::memset(out + 2, 0, 6);
+            return;
+        }
+
+        int32_t palette[8];
+        palette[0] = maximum;
+        palette[1] = minimum;
+        for (int32_t i = 2; i < 8; ++i) palette[i] = ((8 - i) * maximum + (i - 1) * minimum) / 7;
+
+        uint64_t bits = 0;
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            int32_t value = block[i][component];
+            int32_t bestDistance = std::numeric_limits<int32_t>::max();
+            uint64_t bestIndex = 0;
+            for (int32_t p = 0; p < 8; ++p)
+            {
+                int32_t distance = std::abs(palette[p] - value);
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    bestIndex = static_cast<uint64_t>(p);
+                }
+            }
+            bits |= bestIndex << (3 * i);
+        }
+        for (uint32_t i = 0; i < 6; ++i) out[2 + i] = static_cast<uint8_t>((bits >> (8 * i)) & 0xff);
+    }
+
+    // box filter downsample, averaging the source footprint of each destination pixel
+    void downsample(const std::vector<uint8_t>& source, uint32_t sourceWidth, uint32_t sourceHeight, uint32_t numComponents,
+                    std::vector<uint8_t>& destination, uint32_t destinationWidth, uint32_t destinationHeight)
+    {
+        destination.resize(static_cast<size_t>(destinationWidth) * destinationHeight * numComponents);
+        uint32_t stepX = sourceWidth / destinationWidth;
+        uint32_t stepY = sourceHeight / destinationHeight;
+        uint32_t samples = stepX * stepY;
+        for (uint32_t y = 0; y < destinationHeight; ++y)
+        {
+            for (uint32_t x = 0; x < destinationWidth; ++x)
+            {
+                uint8_t* out = destination.data() + (static_cast<size_t>(y) * destinationWidth + x) * numComponents;
+                for (uint32_t c = 0; c < numComponents; ++c)
+                {
+                    uint32_t total = 0;
+                    for (uint32_t sy = 0; sy < stepY; ++sy)
+                    {
+                        for (uint32_t sx = 0; sx < stepX; ++sx)
+                        {
+                            total += source[((static_cast<size_t>(y) * stepY + sy) * sourceWidth + (x * stepX + sx)) * numComponents + c];
+                        }
+                    }
+                    out[c] = static_cast<uint8_t>(total / samples);
+                }
+            }
+        }
+    }
+
+    Path textureCacheFilename(const Path& cacheDirectory, uint64_t hash, VkFormat targetFormat)
+    {
+        std::ostringstream str;
+        str << "texture_" << std::hex << std::setw(16) << std::setfill('0') << hash << "_" << std::dec << static_cast<uint32_t>(targetFormat) << ".vsgb";
+        return cacheDirectory / str.str();
+    }
+
+} // namespace
+
+VkFormat vsg::selectCompressedFormat(const Data& image)
+{
+    if (image.dimensions() != 2 || image.depth() != 1) return VK_FORMAT_UNDEFINED;
+    if (image.properties.maxNumMipmaps > 1 || image.properties.blockWidth != 1 || image.properties.blockHeight != 1) return VK_FORMAT_UNDEFINED;
+
+    uint32_t width = image.width();
+    uint32_t height = image.height();
+    if (width < 4 || height < 4 || !powerOfTwo(width) || !powerOfTwo(height)) return VK_FORMAT_UNDEFINED;
+
+    auto format = image.properties.format;
+    if (image.is_compatible(typeid(ubyteArray2D)))
+    {
+        if (format == VK_FORMAT_R8_UNORM || format == VK_FORMAT_UNDEFINED) return VK_FORMAT_BC4_UNORM_BLOCK;
+    }
+    else if (image.is_compatible(typeid(ubvec2Array2D)))
+    {
+        if (format == VK_FORMAT_R8G8_UNORM || format == VK_FORMAT_UNDEFINED) return VK_FORMAT_BC5_UNORM_BLOCK;
+    }
+    else if (image.is_compatible(typeid(ubvec4Array2D)))
+    {
+        bool srgb = (format == VK_FORMAT_R8G8B8A8_SRGB);
+        if (!srgb && format != VK_FORMAT_R8G8B8A8_UNORM && format != VK_FORMAT_UNDEFINED) return VK_FORMAT_UNDEFINED;
+
+        auto pixels = static_cast<const ubvec4*>(image.dataPointer());
+        bool opaque = true;
+        for (size_t i = 0, count = static_cast<size_t>(width) * height; i < count; ++i)
+        {
+            if (pixels[i].a != 255)
+            {
+                opaque = false;
+                break;
+            }
+        }
+
+        if (opaque) return srgb ? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+        return srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK;
+    }
+
+    return VK_FORMAT_UNDEFINED;
+}
+
+ref_ptr<Data> vsg::compressImage(const Data& image, VkFormat targetFormat, bool generateMipmaps)
+{
+    uint32_t numComponents = 0;
+    if (image.is_compatible(typeid(ubyteArray2D)))
+        numComponents = 1;
+    else if (image.is_compatible(typeid(ubvec2Array2D)))
+        numComponents = 2;
+    else if (image.is_compatible(typeid(ubvec4Array2D)))
+        numComponents = 4;
+    else
+        return {};
+
+    bool color = false;
+    bool alpha = false;
+    switch (targetFormat)
+    {
+    case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+    case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        if (numComponents != 4) return {};
+        color = true;
+        break;
+    case VK_FORMAT_BC3_UNORM_BLOCK:
+    case VK_FORMAT_BC3_SRGB_BLOCK:
+        if (numComponents != 4) return {};
+        color = true;
+        alpha = true;
+        break;
+    case VK_FORMAT_BC4_UNORM_BLOCK:
+        if (numComponents != 1) return {};
+        break;
+    case VK_FORMAT_BC5_UNORM_BLOCK:
+        if (numComponents != 2) return {};
+        break;
+    default:
+        return {};
+    }
+
+    uint32_t width = image.width();
+    uint32_t height = image.height();
+    if (image.dimensions() != 2 || image.depth() != 1) return {};
+    if (width < 4 || height < 4 || !powerOfTwo(width) || !powerOfTwo(height)) return {};
+
+    uint32_t numMipmaps = 1;
+    if (generateMipmaps)
+    {
+        for (uint32_t dimension = std::max(width, height); dimension > 1; dimension /= 2) ++numMipmaps;
+    }
+
+    // build the raw mip chain, then encode each level into consecutive runs of blocks matching
+    // the layout expected by Data::computeMipmapOffsets()
+    std::vector<std::vector<uint8_t>> levels(numMipmaps);
+    auto source = static_cast<const uint8_t*>(image.dataPointer());
+    levels[0].assign(source, source + static_cast<size_t>(width) * height * numComponents);
+
+    uint32_t levelWidth = width;
+    uint32_t levelHeight = height;
+    for (uint32_t level = 1; level < numMipmaps; ++level)
+    {
+        uint32_t nextWidth = std::max(1u, levelWidth / 2);
+        uint32_t nextHeight = std::max(1u, levelHeight / 2);
+        downsample(levels[level - 1], levelWidth, levelHeight, numComponents, levels[level], nextWidth, nextHeight);
+        levelWidth = nextWidth;
+        levelHeight = nextHeight;
+    }
+
+    uint32_t blocksWide = width / 4;
+    uint32_t blocksHigh = height / 4;
+    size_t totalBlocks = 0;
+    for (uint32_t level = 0; level < numMipmaps; ++level)
+    {
+        totalBlocks += static_cast<size_t>(std::max(1u, blocksWide >> level)) * std::max(1u, blocksHigh >> level);
+    }
+
+    size_t blockSize = (color && !alpha) || targetFormat == VK_FORMAT_BC4_UNORM_BLOCK ? sizeof(block64) : sizeof(block128);
+
+    Properties properties(targetFormat);
+    properties.blockWidth = 4;
+    properties.blockHeight = 4;
+    properties.maxNumMipmaps = static_cast<uint8_t>(numMipmaps);
+    properties.origin = image.properties.origin;
+    properties.imageViewType = image.properties.imageViewType;
+
+    auto memory = static_cast<uint8_t*>(vsg::allocate(totalBlocks * blockSize, ALLOCATOR_AFFINITY_DATA));
+
+    uint8_t* out = memory;
+    levelWidth = width;
+    levelHeight = height;
+    for (uint32_t level = 0; level < numMipmaps; ++level)
+    {
+        uint32_t levelBlocksWide = std::max(1u, blocksWide >> level);
+        uint32_t levelBlocksHigh = std::max(1u, blocksHigh >> level);
+        for (uint32_t blockY = 0; blockY < levelBlocksHigh; ++blockY)
+        {
+            for (uint32_t blockX = 0; blockX < levelBlocksWide; ++blockX)
+            {
+                uint8_t block[16][4];
+                extractBlock(levels[level].data(), levelWidth, levelHeight, numComponents, blockX, blockY, block);
+
+                switch (targetFormat)
+                {
+                case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+                case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+                    encodeColorBlock(block, out);
+                    break;
+                case VK_FORMAT_BC3_UNORM_BLOCK:
+                case VK_FORMAT_BC3_SRGB_BLOCK:
+                    encodeAlphaBlock(block, 3, out);
+                    encodeColorBlock(block, out + 8);
+                    break;
+                case VK_FORMAT_BC4_UNORM_BLOCK:
+                    encodeAlphaBlock(block, 0, out);
+                    break;
+                case VK_FORMAT_BC5_UNORM_BLOCK:
+                    encodeAlphaBlock(block, 0, out);
+                    encodeAlphaBlock(block, 1, out + 8);
+                    break;
+                default:
+                    break;
+                }
+                out += blockSize;
+            }
+        }
+        levelWidth = std::max(1u, levelWidth / 2);
+        levelHeight = std::max(1u, levelHeight / 2);
+    }
+
+    if (blockSize == sizeof(block64)) return block64Array2D::create(blocksWide, blocksHigh, reinterpret_cast<block64*>(memory), properties);
+    return block128Array2D::create(blocksWide, blocksHigh, reinterpret_cast<block128*>(memory), properties);
+}
+
+CompressTextures::CompressTextures()
+{
+}
+
+void CompressTextures::apply(Object& object)
+{
+    object.traverse(*this);
+}
+
+void CompressTextures::apply(StateGroup& stateGroup)
+{
+    auto collectDescriptorSet = [&](const DescriptorSet* descriptorSet) {
+        if (!descriptorSet) return;
+        for (auto& descriptor : descriptorSet->descriptors)
+        {
+            if (auto descriptorImage = descriptor.cast<DescriptorImage>())
+            {
+                for (auto& imageInfo : descriptorImage->imageInfoList)
+                {
+                    if (imageInfo) _collect(*imageInfo);
+                }
+            }
+        }
+    };
+
+    for (auto& stateCommand : stateGroup.stateCommands)
+    {
+        if (auto bindDescriptorSet = stateCommand.cast<BindDescriptorSet>())
+        {
+            collectDescriptorSet(bindDescriptorSet->descriptorSet);
+        }
+        else if (auto bindDescriptorSets = stateCommand.cast<BindDescriptorSets>())
+        {
+            for (auto& descriptorSet : bindDescriptorSets->descriptorSets) collectDescriptorSet(descriptorSet);
+        }
+    }
+
+    stateGroup.traverse(*this);
+}
+
+void CompressTextures::_collect(ImageInfo& imageInfo)
+{
+    if (!imageInfo.imageView || !imageInfo.imageView->image) return;
+
+    auto& data = imageInfo.imageView->image->data;
+    if (!data || data->dynamic()) return;
+
+    auto targetFormat = selectCompressedFormat(*data);
+    if (targetFormat == VK_FORMAT_UNDEFINED) return;
+
+    auto& job = _jobs[data.get()];
+    job.source = data;
+    job.targetFormat = targetFormat;
+    job.imageInfos.emplace_back(&imageInfo);
+}
+
+void CompressTextures::finish()
+{
+    Path cacheDirectory = options ? options->textureCacheDirectory : Path();
+
+    // fetch previously encoded results from the on disk cache, keyed by content hash and format
+    std::vector<Job*> pending;
+    VSG io;
+    for (auto& [data, job] : _jobs)
+    {
+        if (cacheDirectory)
+        {
+            uint64_t hash = job.source->contentHash();
+            hash = (hash ^ static_cast<uint64_t>(job.targetFormat)) * 0x100000001b3UL;
+            hash = (hash ^ (generateMipmaps ? 1u : 0u)) * 0x100000001b3UL;
+
+            if (auto filename = textureCacheFilename(cacheDirectory, hash, job.targetFormat); fileExists(filename))
+            {
+                if (auto cached = io.read(filename, {}).cast<Data>(); cached && cached->properties.format == job.targetFormat)
+                {
+                    job.result = cached;
+                    continue;
+                }
+            }
+        }
+        pending.push_back(&job);
+    }
+
+    // encode each unique image once, in parallel when operationThreads are available
+    if (operationThreads && pending.size() > 1)
+    {
+        struct EncodeOperation : public Inherit<Operation, EncodeOperation>
+        {
+            EncodeOperation(Job* in_job, bool in_generateMipmaps, ref_ptr<Latch> in_latch) :
+                job(in_job), generateMipmaps(in_generateMipmaps), latch(in_latch) {}
+
+            void run() override
+            {
+                job->result = compressImage(*job->source, job->targetFormat, generateMipmaps);
+                latch->count_down();
+            }
+
+            Job* job;
+            bool generateMipmaps;
+            ref_ptr<Latch> latch;
+        };
+
+        auto latch = Latch::create(pending.size());
+        for (auto* job : pending) operationThreads->add(ref_ptr<Operation>(new EncodeOperation(job, generateMipmaps, latch)));
+
+        // use this thread to encode as well, then wait for all the encodes to complete
+        operationThreads->run();
+        latch->wait();
+    }
+    else
+    {
+        for (auto* job : pending) job->result = compressImage(*job->source, job->targetFormat, generateMipmaps);
+    }
+
+    if (cacheDirectory && !pending.empty())
+    {
+        vsg::makeDirectory(cacheDirectory);
+        for (auto* job : pending)
+        {
+            if (!job->result) continue;
+            uint64_t hash = job->source->contentHash();
+            hash = (hash ^ static_cast<uint64_t>(job->targetFormat)) * 0x100000001b3UL;
+            hash = (hash ^ (generateMipmaps ? 1u : 0u)) * 0x100000001b3UL;
+            io.write(job->result, textureCacheFilename(cacheDirectory, hash, job->targetFormat), {});
+        }
+    }
+
+    // rebuild the Image/ImageView around the compressed data so the extents, format and
+    // mipLevels derived from the original data are recomputed
+    for (auto& [data, job] : _jobs)
+    {
+        if (!job.result) continue;
+        for (auto& imageInfo : job.imageInfos)
+        {
+            imageInfo->imageView = ImageView::create(Image::create(job.result));
+            imageInfo->computeNumMipMapLevels();
+            ++numCompressed;
+        }
+    }
+
+    _jobs.clear();
+}
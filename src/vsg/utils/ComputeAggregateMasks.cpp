@@ -0,0 +1,77 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/nodes/Layer.h>
+#include <vsg/nodes/MaskGroup.h>
+#include <vsg/nodes/Switch.h>
+#include <vsg/utils/ComputeAggregateMasks.h>
+
+using namespace vsg;
+
+ComputeAggregateMasks::ComputeAggregateMasks()
+{
+}
+
+Mask ComputeAggregateMasks::_aggregate(Node& node)
+{
+    Mask previous_mask = _mask;
+    _mask = MASK_OFF;
+
+    node.accept(*this);
+
+    Mask result = _mask;
+    _mask = previous_mask;
+    return result;
+}
+
+void ComputeAggregateMasks::apply(Node&)
+{
+    // content without a mask of its own is reachable by every traversalMask
+    _mask |= MASK_ALL;
+}
+
+void ComputeAggregateMasks::apply(Group& group)
+{
+    for (auto& child : group.children) _mask |= _aggregate(*child);
+}
+
+void ComputeAggregateMasks::apply(MaskGroup& maskGroup)
+{
+    Mask mask = MASK_OFF;
+    for (auto& child : maskGroup.children) mask |= _aggregate(*child);
+
+    maskGroup.mask = mask;
+    ++numMasksBaked;
+
+    _mask |= mask;
+}
+
+void ComputeAggregateMasks::apply(Switch& sw)
+{
+    // a traversal only reaches a child when its mask matches both the child's mask and the masks within
+    for (auto& child : sw.children)
+    {
+        if (child.mask != MASK_OFF) _mask |= (child.mask & _aggregate(*child.node));
+    }
+}
+
+void ComputeAggregateMasks::apply(Layer& layer)
+{
+    if (layer.mask != MASK_OFF && layer.child) _mask |= (layer.mask & _aggregate(*layer.child));
+}
+
+void ComputeAggregateMasks::apply(CullNode& cullNode)
+{
+    _mask |= _aggregate(*cullNode.child);
+}
@@ -15,6 +15,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/commands/Commands.h>
 #include <vsg/commands/Draw.h>
 #include <vsg/commands/DrawIndexed.h>
+#include <vsg/core/parallel.h>
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
 #include <vsg/nodes/CullGroup.h>
@@ -196,14 +197,27 @@ void ComputeBounds::applyDraw(uint32_t firstVertex, uint32_t vertexCount, uint32
     dmat4 matrix;
     if (!matrixStack.empty()) matrix = matrixStack.back();
 
+    auto combine = [](dbox lhs, const dbox& rhs) -> dbox {
+        if (rhs.valid()) lhs.add(rhs);
+        return lhs;
+    };
+
     for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
     {
         if (auto vertices = arrayState.vertexArray(instanceIndex))
         {
-            for (uint32_t i = firstVertex; i < endVertex; ++i)
-            {
-                bounds.add(matrix * dvec3(vertices->at(i)));
-            }
+            auto result = parallel_reduce(
+                operationThreads, firstVertex, endVertex, dbox(), [&](size_t begin, size_t end) {
+                    dbox partial;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        partial.add(matrix * dvec3(vertices->at(i)));
+                    }
+                    return partial;
+                },
+                combine);
+
+            if (result.valid()) bounds.add(result);
         }
     }
 }
@@ -216,16 +230,29 @@ void ComputeBounds::applyDrawIndexed(uint32_t firstIndex, uint32_t indexCount, u
     dmat4 matrix;
     if (!matrixStack.empty()) matrix = matrixStack.back();
 
+    auto combine = [](dbox lhs, const dbox& rhs) -> dbox {
+        if (rhs.valid()) lhs.add(rhs);
+        return lhs;
+    };
+
     if (ushort_indices)
     {
         for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
         {
             if (auto vertices = arrayState.vertexArray(instanceIndex))
             {
-                for (uint32_t i = firstIndex; i < endIndex; ++i)
-                {
-                    bounds.add(matrix * dvec3(vertices->at(ushort_indices->at(i))));
-                }
+                auto result = parallel_reduce(
+                    operationThreads, firstIndex, endIndex, dbox(), [&](size_t begin, size_t end) {
+                        dbox partial;
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            partial.add(matrix * dvec3(vertices->at(ushort_indices->at(i))));
+                        }
+                        return partial;
+                    },
+                    combine);
+
+                if (result.valid()) bounds.add(result);
             }
         }
     }
@@ -235,10 +262,18 @@ void ComputeBounds::applyDrawIndexed(uint32_t firstIndex, uint32_t indexCount, u
         {
             if (auto vertices = arrayState.vertexArray(instanceIndex))
             {
-                for (uint32_t i = firstIndex; i < endIndex; ++i)
-                {
-                    bounds.add(matrix * dvec3(vertices->at(uint_indices->at(i))));
-                }
+                auto result = parallel_reduce(
+                    operationThreads, firstIndex, endIndex, dbox(), [&](size_t begin, size_t end) {
+                        dbox partial;
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            partial.add(matrix * dvec3(vertices->at(uint_indices->at(i))));
+                        }
+                        return partial;
+                    },
+                    combine);
+
+                if (result.valid()) bounds.add(result);
             }
         }
     }
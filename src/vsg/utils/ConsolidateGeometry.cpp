@@ -0,0 +1,366 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Draw.h>
+#include <vsg/commands/DrawIndexed.h>
+#include <vsg/core/parallel.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/state/GraphicsPipeline.h>
+#include <vsg/state/InputAssemblyState.h>
+#include <vsg/utils/ConsolidateGeometry.h>
+
+#include <cstring>
+
+using namespace vsg;
+
+namespace
+{
+    ref_ptr<Command> convertGeometry(Geometry& geometry)
+    {
+        if (geometry.commands.size() != 1) return {};
+
+        if (auto draw = geometry.commands.front().cast<Draw>(); draw && !geometry.indices)
+        {
+            auto vertexDraw = VertexDraw::create();
+            vertexDraw->firstBinding = geometry.firstBinding;
+            vertexDraw->arrays = geometry.arrays;
+            vertexDraw->vertexCount = draw->vertexCount;
+            vertexDraw->instanceCount = draw->instanceCount;
+            vertexDraw->firstVertex = draw->firstVertex;
+            vertexDraw->firstInstance = draw->firstInstance;
+            return vertexDraw;
+        }
+
+        if (auto drawIndexed = geometry.commands.front().cast<DrawIndexed>(); drawIndexed && geometry.indices)
+        {
+            auto vertexIndexDraw = VertexIndexDraw::create();
+            vertexIndexDraw->firstBinding = geometry.firstBinding;
+            vertexIndexDraw->arrays = geometry.arrays;
+            vertexIndexDraw->assignIndices(geometry.indices->data);
+            vertexIndexDraw->indexCount = drawIndexed->indexCount;
+            vertexIndexDraw->instanceCount = drawIndexed->instanceCount;
+            vertexIndexDraw->firstIndex = drawIndexed->firstIndex;
+            vertexIndexDraw->vertexOffset = drawIndexed->vertexOffset;
+            vertexIndexDraw->firstInstance = drawIndexed->firstInstance;
+            return vertexIndexDraw;
+        }
+
+        return {};
+    }
+
+    // merging concatenated vertices is only meaningful for list topologies without primitive restart,
+    // and only when the StateGroup itself binds the pipeline so the topology is known
+    bool mergeableTopology(const StateGroup& stateGroup)
+    {
+        for (auto& stateCommand : stateGroup.stateCommands)
+        {
+            auto bindGraphicsPipeline = stateCommand.cast<BindGraphicsPipeline>();
+            if (!bindGraphicsPipeline || !bindGraphicsPipeline->pipeline) continue;
+
+            for (auto& pipelineState : bindGraphicsPipeline->pipeline->pipelineStates)
+            {
+                if (auto inputAssemblyState = pipelineState.cast<InputAssemblyState>())
+                {
+                    if (inputAssemblyState->primitiveRestartEnable) return false;
+                    return inputAssemblyState->topology == VK_PRIMITIVE_TOPOLOGY_POINT_LIST ||
+                           inputAssemblyState->topology == VK_PRIMITIVE_TOPOLOGY_LINE_LIST ||
+                           inputAssemblyState->topology == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+                }
+            }
+        }
+        return false;
+    }
+
+    VkDeviceSize arrayStride(const Data* data)
+    {
+        return data->properties.stride != 0 ? VkDeviceSize(data->properties.stride) : VkDeviceSize(data->valueSize());
+    }
+
+    // byte level concatenation of the source ranges, the vertex layout is owned by the pipeline's
+    // VertexInputState so the merged array only needs to carry the raw data. The destination offsets
+    // are precomputed so the per range copies are independent and can run across the OperationThreads.
+    ref_ptr<Data> concatenate(ref_ptr<OperationThreads> operationThreads, const std::vector<std::pair<const Data*, std::pair<VkDeviceSize, VkDeviceSize>>>& ranges)
+    {
+        std::vector<VkDeviceSize> offsets(ranges.size());
+        VkDeviceSize totalSize = 0;
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            offsets[i] = totalSize;
+            totalSize += ranges[i].second.second;
+        }
+
+        auto merged = ubyteArray::create(totalSize);
+        parallel_for(
+            operationThreads, 0, ranges.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    auto& [data, range] = ranges[i];
+                    std::memcpy(merged->dataPointer(offsets[i]), static_cast<const uint8_t*>(data->dataPointer()) + range.first, range.second);
+                }
+            },
+            1);
+        return merged;
+    }
+} // namespace
+
+ConsolidateGeometry::ConsolidateGeometry()
+{
+}
+
+bool ConsolidateGeometry::_mergeable(const Data* data) const
+{
+    return data && !data->dynamic() && !dynamic(data);
+}
+
+void ConsolidateGeometry::apply(Group& group)
+{
+    group.traverse(*this);
+
+    for (auto& child : group.children)
+    {
+        if (auto geometry = child.cast<Geometry>())
+        {
+            if (auto converted = convertGeometry(*geometry))
+            {
+                child = converted;
+                ++numConverted;
+            }
+        }
+    }
+}
+
+void ConsolidateGeometry::apply(StateGroup& stateGroup)
+{
+    apply(static_cast<Group&>(stateGroup));
+
+    if (mergeDraws && stateGroup.children.size() > 1 && mergeableTopology(stateGroup))
+    {
+        _mergeVertexIndexDraws(stateGroup);
+        _mergeVertexDraws(stateGroup);
+    }
+}
+
+void ConsolidateGeometry::_mergeVertexIndexDraws(StateGroup& stateGroup)
+{
+    auto& children = stateGroup.children;
+
+    auto candidate = [&](Node* node) -> VertexIndexDraw* {
+        auto vid = dynamic_cast<VertexIndexDraw*>(node);
+        if (!vid || dynamic(vid)) return nullptr;
+        if (vid->instanceCount != 1 || vid->firstInstance != 0) return nullptr;
+        if (vid->arrays.empty() || !vid->indices || !_mergeable(vid->indices->data)) return nullptr;
+        for (auto& array : vid->arrays)
+        {
+            if (!array || !_mergeable(array->data)) return nullptr;
+        }
+        return vid;
+    };
+
+    auto compatible = [](const VertexIndexDraw* lhs, const VertexIndexDraw* rhs) -> bool {
+        if (lhs->firstBinding != rhs->firstBinding || lhs->arrays.size() != rhs->arrays.size()) return false;
+        for (size_t i = 0; i < lhs->arrays.size(); ++i)
+        {
+            const auto* lhs_data = lhs->arrays[i]->data.get();
+            const auto* rhs_data = rhs->arrays[i]->data.get();
+            if (lhs_data->valueSize() != rhs_data->valueSize()) return false;
+            if (lhs_data->properties.format != rhs_data->properties.format) return false;
+            if (lhs_data->properties.stride != rhs_data->properties.stride) return false;
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+        auto first = candidate(children[i].get());
+        if (!first) continue;
+
+        std::vector<size_t> indices{i};
+        std::vector<VertexIndexDraw*> draws{first};
+        for (size_t j = i + 1; j < children.size(); ++j)
+        {
+            if (auto vid = candidate(children[j].get()); vid && compatible(first, vid))
+            {
+                indices.push_back(j);
+                draws.push_back(vid);
+            }
+        }
+        if (draws.size() < 2) continue;
+
+        // concatenate the complete vertex arrays as the indices may address any vertex
+        DataList mergedArrays;
+        for (size_t arrayIndex = 0; arrayIndex < first->arrays.size(); ++arrayIndex)
+        {
+            std::vector<std::pair<const Data*, std::pair<VkDeviceSize, VkDeviceSize>>> ranges;
+            for (auto draw : draws)
+            {
+                const auto* data = draw->arrays[arrayIndex]->data.get();
+                ranges.push_back({data, {0, data->dataSize()}});
+            }
+            mergedArrays.push_back(concatenate(operationThreads, ranges));
+        }
+
+        uint32_t totalVertices = 0;
+        uint32_t totalIndices = 0;
+        for (auto draw : draws)
+        {
+            totalVertices += static_cast<uint32_t>(draw->arrays.front()->data->valueCount());
+            totalIndices += draw->indexCount;
+        }
+
+        // rebase each draw's index range by its vertex base within the concatenated arrays,
+        // widening to 32bit indices when the merged vertex count requires it
+        ref_ptr<Data> mergedIndices;
+        uint16_t* dest16 = nullptr;
+        uint32_t* dest32 = nullptr;
+        if (totalVertices <= 65536)
+        {
+            auto indexArray = ushortArray::create(totalIndices);
+            dest16 = indexArray->data();
+            mergedIndices = indexArray;
+        }
+        else
+        {
+            auto indexArray = uintArray::create(totalIndices);
+            dest32 = indexArray->data();
+            mergedIndices = indexArray;
+        }
+
+        // precompute each draw's destination offset and vertex base so the per draw rebasing
+        // is independent and can run across the OperationThreads
+        std::vector<uint32_t> indexOffsets(draws.size());
+        std::vector<uint32_t> vertexBases(draws.size());
+        uint32_t indexOffset = 0;
+        uint32_t vertexBase = 0;
+        for (size_t d = 0; d < draws.size(); ++d)
+        {
+            indexOffsets[d] = indexOffset;
+            vertexBases[d] = vertexBase;
+            indexOffset += draws[d]->indexCount;
+            vertexBase += static_cast<uint32_t>(draws[d]->arrays.front()->data->valueCount());
+        }
+
+        parallel_for(
+            operationThreads, 0, draws.size(), [&](size_t begin, size_t end) {
+                for (size_t d = begin; d < end; ++d)
+                {
+                    auto draw = draws[d];
+                    const auto* indexData = draw->indices->data.get();
+                    bool sourceIs16bit = indexData->valueSize() == 2;
+                    const auto* source16 = static_cast<const uint16_t*>(indexData->dataPointer());
+                    const auto* source32 = static_cast<const uint32_t*>(indexData->dataPointer());
+
+                    for (uint32_t index = 0; index < draw->indexCount; ++index)
+                    {
+                        uint32_t value = sourceIs16bit ? source16[draw->firstIndex + index] : source32[draw->firstIndex + index];
+                        value += draw->vertexOffset + vertexBases[d];
+                        if (dest16)
+                            dest16[indexOffsets[d] + index] = static_cast<uint16_t>(value);
+                        else
+                            dest32[indexOffsets[d] + index] = value;
+                    }
+                }
+            },
+            1);
+
+        auto merged = VertexIndexDraw::create();
+        merged->firstBinding = first->firstBinding;
+        merged->assignArrays(mergedArrays);
+        merged->assignIndices(mergedIndices);
+        merged->indexCount = totalIndices;
+        merged->instanceCount = 1;
+
+        children[i] = merged;
+        for (auto itr = indices.rbegin(); itr != indices.rend() && *itr != i; ++itr)
+        {
+            children.erase(children.begin() + *itr);
+        }
+        numMerged += static_cast<uint32_t>(draws.size() - 1);
+    }
+}
+
+void ConsolidateGeometry::_mergeVertexDraws(StateGroup& stateGroup)
+{
+    auto& children = stateGroup.children;
+
+    auto candidate = [&](Node* node) -> VertexDraw* {
+        auto vd = dynamic_cast<VertexDraw*>(node);
+        if (!vd || dynamic(vd)) return nullptr;
+        if (vd->instanceCount != 1 || vd->firstInstance != 0) return nullptr;
+        if (vd->arrays.empty()) return nullptr;
+        for (auto& array : vd->arrays)
+        {
+            if (!array || !_mergeable(array->data)) return nullptr;
+        }
+        return vd;
+    };
+
+    auto compatible = [](const VertexDraw* lhs, const VertexDraw* rhs) -> bool {
+        if (lhs->firstBinding != rhs->firstBinding || lhs->arrays.size() != rhs->arrays.size()) return false;
+        for (size_t i = 0; i < lhs->arrays.size(); ++i)
+        {
+            const auto* lhs_data = lhs->arrays[i]->data.get();
+            const auto* rhs_data = rhs->arrays[i]->data.get();
+            if (lhs_data->valueSize() != rhs_data->valueSize()) return false;
+            if (lhs_data->properties.format != rhs_data->properties.format) return false;
+            if (lhs_data->properties.stride != rhs_data->properties.stride) return false;
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+        auto first = candidate(children[i].get());
+        if (!first) continue;
+
+        std::vector<size_t> indices{i};
+        std::vector<VertexDraw*> draws{first};
+        for (size_t j = i + 1; j < children.size(); ++j)
+        {
+            if (auto vd = candidate(children[j].get()); vd && compatible(first, vd))
+            {
+                indices.push_back(j);
+                draws.push_back(vd);
+            }
+        }
+        if (draws.size() < 2) continue;
+
+        // only the drawn range of each array is carried over, the merged draw covers the concatenation
+        DataList mergedArrays;
+        for (size_t arrayIndex = 0; arrayIndex < first->arrays.size(); ++arrayIndex)
+        {
+            std::vector<std::pair<const Data*, std::pair<VkDeviceSize, VkDeviceSize>>> ranges;
+            for (auto draw : draws)
+            {
+                const auto* data = draw->arrays[arrayIndex]->data.get();
+                auto stride = arrayStride(data);
+                ranges.push_back({data, {VkDeviceSize(draw->firstVertex) * stride, VkDeviceSize(draw->vertexCount) * stride}});
+            }
+            mergedArrays.push_back(concatenate(operationThreads, ranges));
+        }
+
+        uint32_t totalVertices = 0;
+        for (auto draw : draws) totalVertices += draw->vertexCount;
+
+        auto merged = VertexDraw::create();
+        merged->firstBinding = first->firstBinding;
+        merged->assignArrays(mergedArrays);
+        merged->vertexCount = totalVertices;
+        merged->instanceCount = 1;
+
+        children[i] = merged;
+        for (auto itr = indices.rbegin(); itr != indices.rend() && *itr != i; ++itr)
+        {
+            children.erase(children.begin() + *itr);
+        }
+        numMerged += static_cast<uint32_t>(draws.size() - 1);
+    }
+}
@@ -0,0 +1,79 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/AbsoluteTransform.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/nodes/MatrixTransform.h>
+#include <vsg/utils/FlattenStaticTransforms.h>
+
+using namespace vsg;
+
+FlattenStaticTransforms::FlattenStaticTransforms()
+{
+}
+
+void FlattenStaticTransforms::apply(Group& group)
+{
+    for (auto& child : group.children)
+    {
+        // bake static MatrixTransform children in place, replacing them with an AbsoluteTransform
+        // that holds the precomputed absolute matrix and adopts the transform's children.
+        if (_pathStatic && child->type_info() == typeid(MatrixTransform) && !dynamic(child.get()))
+        {
+            auto mt = static_cast<MatrixTransform*>(child.get());
+
+            auto absoluteTransform = AbsoluteTransform::create(_matrix * mt->matrix);
+            absoluteTransform->subgraphRequiresLocalFrustum = mt->subgraphRequiresLocalFrustum;
+            absoluteTransform->children = mt->children;
+
+            child = absoluteTransform;
+            ++numTransformsBaked;
+
+            dmat4 previous_matrix = _matrix;
+            _matrix = absoluteTransform->matrix;
+            absoluteTransform->traverse(*this);
+            _matrix = previous_matrix;
+        }
+        else
+        {
+            child->accept(*this);
+        }
+    }
+}
+
+void FlattenStaticTransforms::apply(Transform& transform)
+{
+    // a Transform subclass we can't inspect must be treated as dynamic, so nothing beneath it can be baked
+    bool previous_pathStatic = _pathStatic;
+    _pathStatic = false;
+
+    transform.traverse(*this);
+
+    _pathStatic = previous_pathStatic;
+}
+
+void FlattenStaticTransforms::apply(MatrixTransform& mt)
+{
+    // reached without a rewritable Group parent, or on a dynamic path - just track the state for the subgraph
+    bool previous_pathStatic = _pathStatic;
+    dmat4 previous_matrix = _matrix;
+
+    if (dynamic(&mt) || mt.type_info() != typeid(MatrixTransform))
+        _pathStatic = false;
+    else
+        _matrix = _matrix * mt.matrix;
+
+    mt.traverse(*this);
+
+    _pathStatic = previous_pathStatic;
+    _matrix = previous_matrix;
+}
@@ -0,0 +1,247 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/utils/FrameStatsCollector.h>
+
+#include <cstring>
+#include <ostream>
+
+using namespace vsg;
+
+namespace
+{
+    inline uint64_t now_nanoseconds()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(vsg::clock::now().time_since_epoch()).count());
+    }
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// FrameStatsCollector::ScopeStats
+//
+void FrameStatsCollector::ScopeStats::add(uint64_t durationNanoseconds)
+{
+    ++count;
+    totalNanoseconds += durationNanoseconds;
+    if (durationNanoseconds < minNanoseconds) minNanoseconds = durationNanoseconds;
+    if (durationNanoseconds > maxNanoseconds) maxNanoseconds = durationNanoseconds;
+
+    size_t bin = 0;
+    for (uint64_t value = durationNanoseconds; value >>= 1;) ++bin;
+    if (bin >= numHistogramBins) bin = numHistogramBins - 1;
+    ++histogram[bin];
+}
+
+void FrameStatsCollector::ScopeStats::merge(const ScopeStats& rhs)
+{
+    count += rhs.count;
+    totalNanoseconds += rhs.totalNanoseconds;
+    if (rhs.minNanoseconds < minNanoseconds) minNanoseconds = rhs.minNanoseconds;
+    if (rhs.maxNanoseconds > maxNanoseconds) maxNanoseconds = rhs.maxNanoseconds;
+    for (size_t bin = 0; bin < numHistogramBins; ++bin) histogram[bin] += rhs.histogram[bin];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// FrameStatsCollector::FrameStats
+//
+const FrameStatsCollector::ScopeStats* FrameStatsCollector::FrameStats::find(const char* name) const
+{
+    if (!name) return nullptr;
+
+    for (auto& [sourceLocation, stats] : scopes)
+    {
+        const char* scopeName = sourceLocation->name ? sourceLocation->name : sourceLocation->function;
+        if (scopeName && std::strcmp(scopeName, name) == 0) return &stats;
+    }
+    return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// FrameStatsCollector
+//
+FrameStatsCollector::FrameStatsCollector(size_t in_framesToKeep, size_t in_eventsPerThread) :
+    framesToKeep(in_framesToKeep),
+    _eventsPerThread(in_eventsPerThread)
+{
+}
+
+FrameStatsCollector::~FrameStatsCollector()
+{
+}
+
+FrameStatsCollector::ThreadEvents& FrameStatsCollector::threadEvents() const
+{
+    // cache the per thread ring buffer so that after the first scope on a thread the hot path is lock free
+    struct Cache
+    {
+        const FrameStatsCollector* collector = nullptr;
+        ThreadEvents* events = nullptr;
+    };
+    static thread_local Cache s_cache;
+
+    if (s_cache.collector == this && s_cache.events) return *s_cache.events;
+
+    std::scoped_lock lock(_threadsMutex);
+    auto& events = _threads[std::this_thread::get_id()];
+    if (!events) events = std::make_unique<ThreadEvents>(_eventsPerThread);
+
+    s_cache = Cache{this, events.get()};
+    return *events;
+}
+
+void FrameStatsCollector::setThreadName(const std::string& name) const
+{
+    std::scoped_lock lock(_threadsMutex);
+    _threadNames[std::this_thread::get_id()] = name;
+}
+
+void FrameStatsCollector::enterFrame(const SourceLocation*, uint64_t&, FrameStamp& frameStamp) const
+{
+    auto frameTime = vsg::clock::now();
+
+    // aggregate the events recorded since the previous enterFrame() into the stats for the frame just completed
+    auto stats = FrameStats::create();
+    stats->frameCount = (frameStamp.frameCount > 0) ? frameStamp.frameCount - 1 : 0;
+    stats->time = frameTime;
+    if (_frameStarted) stats->frameDurationNanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(frameTime - _frameStartTime).count());
+
+    {
+        std::scoped_lock lock(_threadsMutex);
+        for (auto& [thread_id, events] : _threads)
+        {
+            uint64_t head = events->head.load(std::memory_order_acquire);
+            for (; events->tail != head; ++events->tail)
+            {
+                auto& event = events->events[events->tail % events->events.size()];
+                stats->scopes[event.sourceLocation].add(event.durationNanoseconds);
+            }
+            stats->droppedEvents += events->dropped.exchange(0, std::memory_order_relaxed);
+        }
+    }
+
+    {
+        std::scoped_lock lock(_framesMutex);
+        if (_frameStarted)
+        {
+            _frames.push_back(stats);
+            while (_frames.size() > framesToKeep) _frames.pop_front();
+        }
+    }
+
+    _frameStartTime = frameTime;
+    _frameStarted = true;
+}
+
+void FrameStatsCollector::leaveFrame(const SourceLocation*, uint64_t&, FrameStamp&) const
+{
+}
+
+void FrameStatsCollector::enter(const SourceLocation* sl, uint64_t& reference, const Object*) const
+{
+    if (!sl || sl->level > maxLevel)
+    {
+        reference = 0;
+        return;
+    }
+    reference = now_nanoseconds();
+}
+
+void FrameStatsCollector::leave(const SourceLocation* sl, uint64_t& reference, const Object*) const
+{
+    if (reference == 0) return;
+    threadEvents().push(sl, now_nanoseconds() - reference);
+}
+
+void FrameStatsCollector::enterCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer&) const
+{
+    enter(sl, reference);
+}
+
+void FrameStatsCollector::leaveCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer&) const
+{
+    leave(sl, reference);
+}
+
+void FrameStatsCollector::enter(const SourceLocation* sl, uint64_t& reference, CommandBuffer&, const Object*) const
+{
+    enter(sl, reference);
+}
+
+void FrameStatsCollector::leave(const SourceLocation* sl, uint64_t& reference, CommandBuffer&, const Object*) const
+{
+    leave(sl, reference);
+}
+
+void FrameStatsCollector::finish() const
+{
+}
+
+ref_ptr<FrameStatsCollector::FrameStats> FrameStatsCollector::frameStats(size_t framesAgo) const
+{
+    std::scoped_lock lock(_framesMutex);
+    if (framesAgo >= _frames.size()) return {};
+    return _frames[_frames.size() - 1 - framesAgo];
+}
+
+std::vector<ref_ptr<FrameStatsCollector::FrameStats>> FrameStatsCollector::retainedFrames() const
+{
+    std::scoped_lock lock(_framesMutex);
+    return std::vector<ref_ptr<FrameStats>>(_frames.begin(), _frames.end());
+}
+
+void FrameStatsCollector::report_json(std::ostream& out) const
+{
+    auto frames = retainedFrames();
+
+    out << "{\n  \"frames\": [\n";
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        auto& frame = *frames[i];
+        out << "    {\n";
+        out << "      \"frame\": " << frame.frameCount << ",\n";
+        out << "      \"duration_ms\": " << static_cast<double>(frame.frameDurationNanoseconds) * 1e-6 << ",\n";
+        out << "      \"dropped_events\": " << frame.droppedEvents << ",\n";
+
+        auto write_scopes = [&out](const char* label, const std::map<const SourceLocation*, ScopeStats>& scopes, bool trailingComma) {
+            out << "      \"" << label << "\": {\n";
+            size_t scopeIndex = 0;
+            for (auto& [sourceLocation, stats] : scopes)
+            {
+                const char* scopeName = sourceLocation->name ? sourceLocation->name : sourceLocation->function;
+                out << "        \"" << (scopeName ? scopeName : "unnamed") << "\": {";
+                out << " \"count\": " << stats.count;
+                out << ", \"total_ms\": " << static_cast<double>(stats.totalNanoseconds) * 1e-6;
+                out << ", \"min_ms\": " << static_cast<double>(stats.minNanoseconds) * 1e-6;
+                out << ", \"max_ms\": " << static_cast<double>(stats.maxNanoseconds) * 1e-6;
+                out << ", \"histogram\": [";
+                for (size_t bin = 0; bin < numHistogramBins; ++bin)
+                {
+                    if (bin > 0) out << ", ";
+                    out << stats.histogram[bin];
+                }
+                out << "] }";
+                if (++scopeIndex < scopes.size()) out << ",";
+                out << "\n";
+            }
+            out << "      }" << (trailingComma ? "," : "") << "\n";
+        };
+
+        write_scopes("scopes", frame.scopes, !frame.gpuScopes.empty());
+        if (!frame.gpuScopes.empty()) write_scopes("gpu_scopes", frame.gpuScopes, false);
+        out << "    }" << (i + 1 < frames.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
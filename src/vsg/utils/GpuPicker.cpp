@@ -0,0 +1,301 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/state/ImageView.h>
+#include <vsg/utils/GpuPicker.h>
+#include <vsg/vk/PhysicalDevice.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace vsg;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+// AssignObjectIDs
+//
+void AssignObjectIDs::apply(Object& object)
+{
+    _objectPath.emplace_back(&object);
+    object.traverse(*this);
+    _objectPath.pop_back();
+}
+
+void AssignObjectIDs::apply(Geometry& geometry)
+{
+    assign(geometry);
+}
+
+void AssignObjectIDs::apply(VertexDraw& vd)
+{
+    assign(vd);
+}
+
+void AssignObjectIDs::apply(VertexIndexDraw& vid)
+{
+    assign(vid);
+}
+
+void AssignObjectIDs::assign(Node& node)
+{
+    _objectPath.emplace_back(&node);
+
+    // objectID 0 is reserved for the cleared background so IDs start at 1
+    uint32_t objectID = static_cast<uint32_t>(objectPaths.size()) + 1;
+    node.setValue("objectID", objectID);
+    objectPaths.push_back(_objectPath);
+
+    _objectPath.pop_back();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+//
+// GpuPicker
+//
+GpuPicker::GpuPicker(ref_ptr<Device> in_device, uint32_t in_extent, VkFormat in_depthFormat) :
+    device(in_device),
+    extent(std::max(in_extent, 1u)),
+    depthFormat(in_depthFormat)
+{
+    const VkFormat idFormat = VK_FORMAT_R32_UINT;
+
+    int graphicsFamily = device->getPhysicalDevice()->getQueueFamily(VK_QUEUE_GRAPHICS_BIT);
+    queue = device->getQueue(static_cast<uint32_t>(graphicsFamily));
+
+    // render pass that leaves the ID attachment in TRANSFER_SRC_OPTIMAL ready for the readback copy
+    auto colorAttachment = defaultColorAttachment(idFormat);
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+    auto depthAttachment = defaultDepthAttachment(depthFormat);
+
+    RenderPass::Attachments attachments{colorAttachment, depthAttachment};
+
+    SubpassDescription subpass;
+    subpass.colorAttachments.push_back(AttachmentReference{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
+    subpass.depthStencilAttachments.push_back(AttachmentReference{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL});
+
+    RenderPass::Subpasses subpasses{subpass};
+
+    // ensure the ID writes have completed before the readback copy reads the attachment
+    SubpassDependency transferDependency;
+    transferDependency.srcSubpass = 0;
+    transferDependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+    transferDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    transferDependency.dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    transferDependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    transferDependency.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    transferDependency.dependencyFlags = 0;
+
+    RenderPass::Dependencies dependencies{transferDependency};
+
+    _renderPass = RenderPass::create(device.get(), attachments, subpasses, dependencies);
+
+    _idImage = Image::create();
+    _idImage->format = idFormat;
+    _idImage->extent = VkExtent3D{extent, extent, 1};
+    _idImage->mipLevels = 1;
+    _idImage->arrayLayers = 1;
+    _idImage->usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    auto idImageView = createImageView(device.get(), _idImage, VK_IMAGE_ASPECT_COLOR_BIT);
+
+    auto depthImage = Image::create();
+    depthImage->format = depthFormat;
+    depthImage->extent = VkExtent3D{extent, extent, 1};
+    depthImage->mipLevels = 1;
+    depthImage->arrayLayers = 1;
+    depthImage->usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    auto depthImageView = createImageView(device.get(), depthImage, computeAspectFlagsForFormat(depthFormat));
+
+    _framebuffer = Framebuffer::create(_renderPass, ImageViews{idImageView, depthImageView}, extent, extent, 1);
+
+    _readbackSize = static_cast<VkDeviceSize>(extent) * static_cast<VkDeviceSize>(extent) * sizeof(uint32_t);
+    _readbackBuffer = createBufferAndMemory(device.get(), _readbackSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    auto deviceMemory = _readbackBuffer->getDeviceMemory(device->deviceID);
+    deviceMemory->map(_readbackBuffer->getMemoryOffset(device->deviceID), _readbackSize, 0, &_mappedData);
+
+    _fence = Fence::create(device.get());
+
+    pickCamera = Camera::create();
+    pickCamera->viewportState = ViewportState::create(0, 0, extent, extent);
+
+    renderGraph = RenderGraph::create();
+    renderGraph->framebuffer = _framebuffer;
+    renderGraph->renderArea = VkRect2D{VkOffset2D{0, 0}, VkExtent2D{extent, extent}};
+
+    // clear the ID attachment to the reserved background ID 0, and the depth to the far plane of the reverse depth convention
+    VkClearValue idClear = {};
+    idClear.color.uint32[0] = 0;
+    VkClearValue depthClear = {};
+    depthClear.depthStencil = VkClearDepthStencilValue{0.0f, 0};
+    renderGraph->clearValues = ClearValues{idClear, depthClear};
+
+    commandGraph = CommandGraph::create(device, graphicsFamily);
+    commandGraph->addChild(renderGraph);
+    commandGraph->addChild(Readback::create(this));
+}
+
+GpuPicker::~GpuPicker()
+{
+    if (_inFlight) _fence->wait(std::numeric_limits<uint64_t>::max());
+}
+
+GpuPicker::Readback::Readback(GpuPicker* in_picker) :
+    _picker(in_picker)
+{
+}
+
+void GpuPicker::Readback::record(CommandBuffer& commandBuffer) const
+{
+    auto deviceID = commandBuffer.deviceID;
+
+    VkBufferImageCopy region = {};
+    region.bufferOffset = 0;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource = VkImageSubresourceLayers{VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageOffset = VkOffset3D{0, 0, 0};
+    region.imageExtent = VkExtent3D{_picker->extent, _picker->extent, 1};
+
+    vkCmdCopyImageToBuffer(commandBuffer, _picker->_idImage->vk(deviceID), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, _picker->_readbackBuffer->vk(deviceID), 1, &region);
+
+    // make the copy visible to the host before the fence signals
+    VkBufferMemoryBarrier hostReadBarrier = {};
+    hostReadBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    hostReadBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    hostReadBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    hostReadBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostReadBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    hostReadBarrier.buffer = _picker->_readbackBuffer->vk(deviceID);
+    hostReadBarrier.offset = 0;
+    hostReadBarrier.size = _picker->_readbackSize;
+
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &hostReadBarrier, 0, nullptr);
+}
+
+void GpuPicker::assignObjectIDs(Node& scene)
+{
+    auto assignVisitor = AssignObjectIDs::create();
+    scene.accept(*assignVisitor);
+    _objectPaths = std::move(assignVisitor->objectPaths);
+}
+
+RefObjectPath GpuPicker::objectPath(uint32_t objectID) const
+{
+    if (objectID == 0 || objectID > _objectPaths.size()) return {};
+    return _objectPaths[objectID - 1];
+}
+
+VkResult GpuPicker::submitPick(ref_ptr<Camera> camera, double x, double y, ref_ptr<FrameStamp> frameStamp)
+{
+    if (!camera || !camera->projectionMatrix || !camera->viewMatrix)
+    {
+        warn("GpuPicker::submitPick() requires a camera with projection and view matrices assigned.");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    // complete any previous pick still in flight before reusing the framebuffer and readback buffer
+    if (_inFlight) completePick();
+
+    // narrow the projection so the extent x extent pixel window around the cursor fills the pick viewport,
+    // the Vulkan equivalent of the classic gluPickMatrix
+    auto viewport = camera->getViewport();
+    double ndc_x = ((x - viewport.x) / viewport.width) * 2.0 - 1.0;
+    double ndc_y = ((y - viewport.y) / viewport.height) * 2.0 - 1.0;
+    double scale_x = viewport.width / static_cast<double>(extent);
+    double scale_y = viewport.height / static_cast<double>(extent);
+
+    dmat4 pickMatrix = translate(-ndc_x * scale_x, -ndc_y * scale_y, 0.0) * scale(scale_x, scale_y, 1.0);
+
+    pickCamera->projectionMatrix = RelativeProjection::create(pickMatrix, camera->projectionMatrix);
+    pickCamera->viewMatrix = camera->viewMatrix;
+
+    auto recordedCommandBuffers = RecordedCommandBuffers::create();
+    commandGraph->record(recordedCommandBuffers, frameStamp);
+
+    std::vector<VkCommandBuffer> vk_commandBuffers;
+    for (auto& recordedCommandBuffer : recordedCommandBuffers->buffers())
+    {
+        if (recordedCommandBuffer->level() == VK_COMMAND_BUFFER_LEVEL_PRIMARY) vk_commandBuffers.push_back(*recordedCommandBuffer);
+
+        _fence->dependentCommandBuffers().emplace_back(recordedCommandBuffer);
+    }
+
+    VkSubmitInfo submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = static_cast<uint32_t>(vk_commandBuffers.size());
+    submitInfo.pCommandBuffers = vk_commandBuffers.data();
+
+    _inFlight = true;
+
+    return queue->submit(submitInfo, _fence);
+}
+
+std::vector<uint32_t> GpuPicker::completePick()
+{
+    if (!_inFlight) return {};
+
+    uint64_t timeout = std::numeric_limits<uint64_t>::max();
+    if (VkResult result = _fence->wait(timeout); result != VK_SUCCESS)
+    {
+        warn("GpuPicker::completePick() vkWaitForFences failed, result = ", result);
+        return {};
+    }
+
+    _fence->resetFenceAndDependencies();
+    _inFlight = false;
+
+    // gather the non zero IDs ordered by their distance from the centre of the pick window
+    const uint32_t* ids = static_cast<const uint32_t*>(_mappedData);
+
+    std::vector<std::pair<uint32_t, uint32_t>> hits;
+    int32_t size = static_cast<int32_t>(extent);
+    for (int32_t row = 0; row < size; ++row)
+    {
+        for (int32_t column = 0; column < size; ++column)
+        {
+            uint32_t id = ids[row * size + column];
+            if (id == 0) continue;
+
+            // doubled coordinates relative to the centre keep the distance metric integral for odd and even extents
+            int32_t dx = 2 * column - (size - 1);
+            int32_t dy = 2 * row - (size - 1);
+            hits.emplace_back(static_cast<uint32_t>(dx * dx + dy * dy), id);
+        }
+    }
+
+    std::stable_sort(hits.begin(), hits.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    std::vector<uint32_t> uniqueIDs;
+    for (auto& [distance, id] : hits)
+    {
+        if (std::find(uniqueIDs.begin(), uniqueIDs.end(), id) == uniqueIDs.end()) uniqueIDs.push_back(id);
+    }
+
+    return uniqueIDs;
+}
+
+RefObjectPath GpuPicker::pick(ref_ptr<Camera> camera, double x, double y)
+{
+    if (VkResult result = submitPick(camera, x, y); result != VK_SUCCESS) return {};
+
+    auto ids = completePick();
+    if (ids.empty()) return {};
+
+    return objectPath(ids.front());
+}
@@ -0,0 +1,178 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/utils/GpuStatsCollector.h>
+#include <vsg/vk/CommandBuffer.h>
+
+using namespace vsg;
+
+GpuStatsCollector::GpuStatsCollector(size_t in_framesToKeep, size_t in_eventsPerThread, uint32_t in_timestampsPerFrame, size_t in_framesBuffered) :
+    Inherit(in_framesToKeep, in_eventsPerThread),
+    timestampsPerFrame(in_timestampsPerFrame),
+    _frameQueries(std::max(in_framesBuffered, size_t(2)))
+{
+}
+
+GpuStatsCollector::~GpuStatsCollector()
+{
+}
+
+ref_ptr<GpuStatsCollector::DeviceQueries> GpuStatsCollector::deviceQueries(CommandBuffer& commandBuffer) const
+{
+    auto deviceID = commandBuffer.deviceID;
+    auto& frameQueries = _frameQueries[_queryFrameIndex];
+
+    std::scoped_lock lock(_queriesMutex);
+
+    if (deviceID >= frameQueries.perDevice.size()) frameQueries.perDevice.resize(deviceID + 1);
+
+    auto& queries = frameQueries.perDevice[deviceID];
+    if (!queries)
+    {
+        auto device = commandBuffer.getDevice();
+        const auto& limits = device->getPhysicalDevice()->getProperties().limits;
+        if (!limits.timestampComputeAndGraphics)
+        {
+            warn("GpuStatsCollector disabled, timestamps not supported by device.");
+            return {};
+        }
+
+        queries = DeviceQueries::create();
+        queries->device = device;
+        queries->queryPool = QueryPool::create(device, VkQueryPoolCreateFlags{0}, VK_QUERY_TYPE_TIMESTAMP, timestampsPerFrame, VkQueryPipelineStatisticFlags{0});
+        queries->sourceLocations.resize(timestampsPerFrame);
+        queries->timestamps.resize(timestampsPerFrame);
+        queries->nanosecondsPerTick = static_cast<double>(limits.timestampPeriod);
+    }
+    else if (!queries->queryPool)
+    {
+        // device previously reported no timestamp support
+        return {};
+    }
+
+    return queries;
+}
+
+void GpuStatsCollector::enterFrame(const SourceLocation* sl, uint64_t& reference, FrameStamp& frameStamp) const
+{
+    Inherit::enterFrame(sl, reference, frameStamp);
+
+    // advance to the oldest frame slot, resolve the queries recorded for it framesBuffered frames ago,
+    // then reuse the slot for the queries of the frame now starting.
+    _queryFrameIndex = (_queryFrameIndex + 1) % _frameQueries.size();
+
+    auto& frameQueries = _frameQueries[_queryFrameIndex];
+    if (frameQueries.active) resolve(frameQueries);
+
+    frameQueries.frameCount = frameStamp.frameCount;
+    frameQueries.active = true;
+}
+
+void GpuStatsCollector::resolve(FrameQueries& frameQueries) const
+{
+    frameQueries.active = false;
+
+    for (auto& queries : frameQueries.perDevice)
+    {
+        if (!queries || !queries->queryPool) continue;
+
+        auto count = std::min(queries->queryIndex.exchange(0), static_cast<uint32_t>(queries->timestamps.size()));
+        if (count < 2) continue;
+
+        // read back without the WAIT bit so a slow frame never stalls the viewer thread,
+        // with framesBuffered frames between write and read the results should already be available.
+        VkResult result = vkGetQueryPoolResults(queries->device->vk(), queries->queryPool->vk(), 0, count,
+                                                count * sizeof(uint64_t), queries->timestamps.data(), sizeof(uint64_t),
+                                                VK_QUERY_RESULT_64_BIT);
+        if (result != VK_SUCCESS)
+        {
+            if (result != VK_NOT_READY) info("GpuStatsCollector::resolve() vkGetQueryPoolResults() failed. VkResult = ", result);
+            continue;
+        }
+
+        queries->queryPool->reset();
+
+        // attach the GPU durations to the retained FrameStats for the frame the queries were recorded in
+        std::scoped_lock lock(_framesMutex);
+        for (auto itr = _frames.rbegin(); itr != _frames.rend(); ++itr)
+        {
+            if ((*itr)->frameCount != frameQueries.frameCount) continue;
+
+            auto& frameStats = *(*itr);
+            for (uint32_t i = 0; i + 1 < count; i += 2)
+            {
+                auto durationTicks = (queries->timestamps[i + 1] > queries->timestamps[i]) ? (queries->timestamps[i + 1] - queries->timestamps[i]) : 0;
+                frameStats.gpuScopes[queries->sourceLocations[i]].add(static_cast<uint64_t>(static_cast<double>(durationTicks) * queries->nanosecondsPerTick));
+            }
+            break;
+        }
+    }
+}
+
+void GpuStatsCollector::enter(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer, const Object*) const
+{
+    reference = 0;
+    if (!sl || sl->level > gpuMaxLevel) return;
+
+    auto queries = deviceQueries(commandBuffer);
+    if (!queries) return;
+
+    // allocate a pair of timestamps per scope so enter/leave results are always adjacent
+    auto index = queries->queryIndex.fetch_add(2);
+    if (index + 1 >= queries->timestamps.size())
+    {
+        queries->queryIndex.fetch_sub(2);
+        return;
+    }
+
+    queries->sourceLocations[index] = sl;
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queries->queryPool->vk(), index);
+
+    // pack deviceID and query index into the reference so leave() can write the matching timestamp
+    reference = (static_cast<uint64_t>(commandBuffer.deviceID) << 32) | static_cast<uint64_t>(index + 1);
+}
+
+void GpuStatsCollector::leave(const SourceLocation*, uint64_t& reference, CommandBuffer& commandBuffer, const Object*) const
+{
+    if (reference == 0) return;
+
+    auto deviceID = static_cast<uint32_t>(reference >> 32);
+    auto index = static_cast<uint32_t>(reference & 0xffffffff);
+
+    auto& frameQueries = _frameQueries[_queryFrameIndex];
+    if (deviceID >= frameQueries.perDevice.size()) return;
+
+    auto& queries = frameQueries.perDevice[deviceID];
+    if (!queries || !queries->queryPool) return;
+
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queries->queryPool->vk(), index);
+}
+
+void GpuStatsCollector::enterCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer) const
+{
+    enter(sl, reference, commandBuffer);
+}
+
+void GpuStatsCollector::leaveCommandBuffer(const SourceLocation* sl, uint64_t& reference, CommandBuffer& commandBuffer) const
+{
+    leave(sl, reference, commandBuffer);
+}
+
+void GpuStatsCollector::finish() const
+{
+    for (auto& frameQueries : _frameQueries)
+    {
+        if (frameQueries.active) resolve(frameQueries);
+    }
+}
@@ -14,11 +14,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
 #include <vsg/nodes/StateGroup.h>
+#include <vsg/state/PushDescriptorSet.h>
 #include <vsg/state/ViewDependentState.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 #include <vsg/utils/SharedObjects.h>
 #include <vsg/vk/Context.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 struct AssignGraphicsPipelineStates : public vsg::Visitor
@@ -215,6 +218,27 @@ bool DescriptorConfigurator::assignDescriptor(const std::string& name, const Buf
     return false;
 }
 
+bool DescriptorConfigurator::assignCustomDescriptor(const std::string& name, ref_ptr<Descriptor> descriptor)
+{
+    if (!descriptor) return false;
+
+    if (auto& descriptorBinding = shaderSet->getDescriptorBinding(name))
+    {
+        assigned.insert(name);
+
+        // set up bindings
+        if (!descriptorBinding.define.empty()) defines.insert(descriptorBinding.define);
+
+        // adopt the ShaderSet's binding number so the set layout and the descriptor's write stay in sync, but keep
+        // the descriptor's own type so a VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC descriptor can be assigned to a
+        // binding declared with the non dynamic type - the shader side uniform block declaration is the same.
+        descriptor->dstBinding = descriptorBinding.binding;
+
+        return assignDescriptor(descriptorBinding.set, descriptorBinding.binding, descriptor->descriptorType, descriptorBinding.descriptorCount, descriptorBinding.stageFlags, descriptor);
+    }
+    return false;
+}
+
 bool DescriptorConfigurator::assignDescriptor(uint32_t set, uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags, ref_ptr<Descriptor> descriptor)
 {
     if (auto currentSize = descriptorSets.size(); set >= currentSize)
@@ -391,6 +415,7 @@ void GraphicsPipelineConfigurator::reset()
 {
     pipelineStates.clear();
     shaderHints->defines.clear();
+    specializationConstants.clear();
     if (descriptorConfigurator) descriptorConfigurator->reset();
 
     _assignShaderSetSettings();
@@ -488,6 +513,12 @@ bool GraphicsPipelineConfigurator::assignDescriptor(const std::string& name, con
     return descriptorConfigurator->assignDescriptor(name, bufferInfoList, dstArrayElement);
 }
 
+bool GraphicsPipelineConfigurator::assignCustomDescriptor(const std::string& name, ref_ptr<Descriptor> descriptor)
+{
+    if (!descriptorConfigurator) descriptorConfigurator = DescriptorConfigurator::create(shaderSet);
+    return descriptorConfigurator->assignCustomDescriptor(name, descriptor);
+}
+
 int GraphicsPipelineConfigurator::compare(const Object& rhs_object) const
 {
     int result = Object::compare(rhs_object);
@@ -504,9 +535,27 @@ int GraphicsPipelineConfigurator::compare(const Object& rhs_object) const
     if ((result = compare_pointer(shaderHints, rhs.shaderHints))) return result;
     if ((result = compare_pointer_container(inheritedState, rhs.inheritedState))) return result;
 
+    if ((result = compare_value(specializationConstants.size(), rhs.specializationConstants.size()))) return result;
+    for (auto lhs_itr = specializationConstants.begin(), rhs_itr = rhs.specializationConstants.begin(); lhs_itr != specializationConstants.end(); ++lhs_itr, ++rhs_itr)
+    {
+        if ((result = compare_value(lhs_itr->first, rhs_itr->first))) return result;
+        if ((result = compare_pointer(lhs_itr->second, rhs_itr->second))) return result;
+    }
+
     return compare_pointer(descriptorConfigurator, rhs.descriptorConfigurator);
 }
 
+bool GraphicsPipelineConfigurator::assignSpecializationConstant(const std::string& name, ref_ptr<Data> value)
+{
+    auto& binding = shaderSet->getSpecializationConstantBinding(name);
+    if (!binding) return false;
+
+    specializationConstants[binding.constantID] = value ? value : binding.defaultValue;
+    if (!binding.define.empty()) shaderHints->defines.insert(binding.define);
+
+    return true;
+}
+
 void GraphicsPipelineConfigurator::assignInheritedState(const StateCommands& stateCommands)
 {
     inheritedState = stateCommands;
@@ -590,10 +639,115 @@ void GraphicsPipelineConfigurator::init()
     }
 
     layout = shaderSet->createPipelineLayout(shaderHints->defines);
-    graphicsPipeline = GraphicsPipeline::create(layout, shaderSet->getShaderStages(shaderHints), pipelineStates, subpass);
+
+    // flag the layouts of any sets selected for the push descriptor path, as required by VK_KHR_push_descriptor
+    for (auto set : pushDescriptorSets)
+    {
+        if (set < layout->setLayouts.size()) layout->setLayouts[set]->flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+    }
+
+    if (dynamicViewportAndScissor)
+    {
+        // make the viewport and scissor dynamic so window resizes only need to update the View's
+        // camera ViewportState rather than recreate the pipeline
+        ref_ptr<DynamicState> dynamic;
+        for (auto& pipelineState : pipelineStates)
+        {
+            if ((dynamic = pipelineState.cast<DynamicState>())) break;
+        }
+        if (!dynamic)
+        {
+            dynamic = DynamicState::create();
+            pipelineStates.push_back(dynamic);
+        }
+
+        auto addUnique = [&dynamic](VkDynamicState state) {
+            if (std::find(dynamic->dynamicStates.begin(), dynamic->dynamicStates.end(), state) == dynamic->dynamicStates.end()) dynamic->dynamicStates.push_back(state);
+        };
+        addUnique(VK_DYNAMIC_STATE_VIEWPORT);
+        addUnique(VK_DYNAMIC_STATE_SCISSOR);
+    }
+
+    auto shaderStages = shaderSet->getShaderStages(shaderHints);
+
+    // fold the ShaderSet declared specialization constants, overridden per material by
+    // assignSpecializationConstant(), into the stages. The shared variant stages are cloned rather than
+    // modified so every specialization of a define combination reuses the same SPIR-V module.
+    ShaderStage::SpecializationConstants mergedConstants;
+    for (auto& binding : shaderSet->specializationConstantBindings)
+    {
+        if (binding.defaultValue && (binding.define.empty() || shaderHints->defines.count(binding.define) != 0))
+        {
+            mergedConstants[binding.constantID] = binding.defaultValue;
+        }
+    }
+    for (auto& [constantID, value] : specializationConstants) mergedConstants[constantID] = value;
+
+    if (!mergedConstants.empty())
+    {
+        ShaderStages specializedStages;
+        specializedStages.reserve(shaderStages.size());
+        for (auto& stage : shaderStages)
+        {
+            auto specialized = ShaderStage::create();
+            specialized->flags = stage->flags;
+            specialized->stage = stage->stage;
+            specialized->module = stage->module;
+            specialized->entryPointName = stage->entryPointName;
+            specialized->specializationConstants = stage->specializationConstants;
+            for (auto& [constantID, value] : mergedConstants) specialized->specializationConstants[constantID] = value;
+            specializedStages.push_back(specialized);
+        }
+        shaderStages.swap(specializedStages);
+    }
+
+    graphicsPipeline = GraphicsPipeline::create(layout, shaderStages, pipelineStates, subpass);
+
+    // link pipeline variants created from the same ShaderSet as derivatives of the first, hinting to drivers
+    // that compilation work can be reused when new material variants stream in mid session
+    graphicsPipeline->basePipeline = shaderSet->getOrAssignBasePipeline(graphicsPipeline);
+
     bindGraphicsPipeline = vsg::BindGraphicsPipeline::create(graphicsPipeline);
 }
 
+void GraphicsPipelineConfigurator::enableDepthPrePass(Mask depthPrePassMask, Mask mainPassMask)
+{
+    if (!graphicsPipeline) init();
+
+    // default the main pass mask to the complement of the pre-pass mask so the depth only variant
+    // is the only child selected while the CommandBuffer's traversalMask is set to depthPrePassMask
+    if (mainPassMask == MASK_OFF) mainPassMask = ~depthPrePassMask;
+
+    // depth only variant reuses the vertex processing stages, dropping the fragment stage
+    ShaderStages depthStages;
+    for (auto& stage : graphicsPipeline->stages)
+    {
+        if (stage->stage != VK_SHADER_STAGE_FRAGMENT_BIT) depthStages.push_back(stage);
+    }
+
+    // replace the ColorBlendState with one that disables all color writes
+    VkPipelineColorBlendAttachmentState disableColorWrites = {};
+    disableColorWrites.blendEnable = VK_FALSE;
+    disableColorWrites.colorWriteMask = 0;
+
+    GraphicsPipelineStates depthPipelineStates;
+    for (auto& ps : graphicsPipeline->pipelineStates)
+    {
+        if (!ps->cast<ColorBlendState>()) depthPipelineStates.push_back(ps);
+    }
+    depthPipelineStates.push_back(ColorBlendState::create(ColorBlendState::ColorBlendAttachments{disableColorWrites}));
+
+    depthGraphicsPipeline = GraphicsPipeline::create(layout, depthStages, depthPipelineStates, subpass);
+
+    // the depth variant only differs in color writes/fragment stage so hint to drivers that compilation can be shared
+    depthGraphicsPipeline->basePipeline = graphicsPipeline;
+
+    pipelineStateSwitch = StateSwitch::create();
+    pipelineStateSwitch->slot = bindGraphicsPipeline->slot;
+    pipelineStateSwitch->add(depthPrePassMask, BindGraphicsPipeline::create(depthGraphicsPipeline));
+    pipelineStateSwitch->add(mainPassMask, bindGraphicsPipeline);
+}
+
 bool GraphicsPipelineConfigurator::copyTo(StateCommands& stateCommands, ref_ptr<SharedObjects> sharedObjects)
 {
     bool stateAssigned = false;
@@ -619,7 +773,10 @@ bool GraphicsPipelineConfigurator::copyTo(StateCommands& stateCommands, ref_ptr<
             sharedObjects->share(bindGraphicsPipeline);
         }
 
-        stateCommands.push_back(bindGraphicsPipeline);
+        if (pipelineStateSwitch)
+            stateCommands.push_back(pipelineStateSwitch);
+        else
+            stateCommands.push_back(bindGraphicsPipeline);
         stateAssigned = true;
     }
 
@@ -629,24 +786,41 @@ bool GraphicsPipelineConfigurator::copyTo(StateCommands& stateCommands, ref_ptr<
         {
             if (auto ds = descriptorConfigurator->descriptorSets[set])
             {
-                auto bindDescriptorSet = BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, static_cast<uint32_t>(set), ds);
+                ref_ptr<StateCommand> descriptorStateCommand;
+                if (pushDescriptorSets.count(static_cast<uint32_t>(set)) != 0)
+                {
+                    // push descriptor path, writes the descriptors directly into the command buffer so no DescriptorSet needs to be allocated
+                    descriptorStateCommand = PushDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, static_cast<uint32_t>(set), ds->descriptors);
+                }
+                else
+                {
+                    descriptorStateCommand = BindDescriptorSet::create(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, static_cast<uint32_t>(set), ds);
+                }
 
                 bool dsUnique = true;
                 for (auto& sc : inheritedState)
                 {
-                    if (compare_pointer(sc, bindDescriptorSet) == 0) dsUnique = false;
+                    if (compare_pointer(sc, descriptorStateCommand) == 0) dsUnique = false;
                 }
 
                 if (dsUnique)
                 {
                     if (sharedObjects)
                     {
-                        sharedObjects->share(ds->setLayout);
-                        sharedObjects->share(ds);
-                        sharedObjects->share(bindDescriptorSet);
+                        if (auto bindDescriptorSet = descriptorStateCommand.cast<BindDescriptorSet>())
+                        {
+                            sharedObjects->share(ds->setLayout);
+                            sharedObjects->share(ds);
+                            sharedObjects->share(bindDescriptorSet);
+                            descriptorStateCommand = bindDescriptorSet;
+                        }
+                        else
+                        {
+                            sharedObjects->share(descriptorStateCommand);
+                        }
                     }
 
-                    stateCommands.push_back(bindDescriptorSet);
+                    stateCommands.push_back(descriptorStateCommand);
                     stateAssigned = true;
                 }
             }
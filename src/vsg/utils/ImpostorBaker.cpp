@@ -0,0 +1,170 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/Camera.h>
+#include <vsg/app/ProjectionMatrix.h>
+#include <vsg/app/View.h>
+#include <vsg/app/ViewMatrix.h>
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/state/ImageView.h>
+#include <vsg/utils/ImpostorBaker.h>
+#include <vsg/vk/Framebuffer.h>
+#include <vsg/vk/RenderPass.h>
+
+using namespace vsg;
+
+ImpostorBaker::ImpostorBaker()
+{
+}
+
+ImpostorBaker::~ImpostorBaker()
+{
+}
+
+ref_ptr<ImageInfo> ImpostorBaker::createAtlas(Device* device) const
+{
+    auto image = Image::create();
+    image->imageType = VK_IMAGE_TYPE_2D;
+    image->format = colorFormat;
+    image->extent = VkExtent3D{atlasSize, atlasSize, 1};
+    image->mipLevels = 1;
+    image->arrayLayers = 1;
+    image->samples = VK_SAMPLE_COUNT_1_BIT;
+    image->tiling = VK_IMAGE_TILING_OPTIMAL;
+    image->usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    image->initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    image->sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    auto imageView = createImageView(device, image, VK_IMAGE_ASPECT_COLOR_BIT);
+
+    auto sampler = Sampler::create();
+    sampler->addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    sampler->addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+
+    return ImageInfo::create(sampler, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+ref_ptr<RenderGraph> ImpostorBaker::createBakeRenderGraph(Device* device, ref_ptr<ImageInfo> atlas, ref_ptr<Node> subgraph, const dsphere& bound) const
+{
+    auto depthImage = Image::create();
+    depthImage->imageType = VK_IMAGE_TYPE_2D;
+    depthImage->format = depthFormat;
+    depthImage->extent = VkExtent3D{atlasSize, atlasSize, 1};
+    depthImage->mipLevels = 1;
+    depthImage->arrayLayers = 1;
+    depthImage->samples = VK_SAMPLE_COUNT_1_BIT;
+    depthImage->tiling = VK_IMAGE_TILING_OPTIMAL;
+    depthImage->usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    depthImage->initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    depthImage->sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    auto depthImageView = createImageView(device, depthImage, VK_IMAGE_ASPECT_DEPTH_BIT);
+
+    // set up the RenderPass to leave the color attachment in a layout ready for sampling by the impostor quad
+    auto colorAttachment = defaultColorAttachment(colorFormat);
+    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    auto depthAttachment = defaultDepthAttachment(depthFormat);
+
+    RenderPass::Attachments attachments{colorAttachment, depthAttachment};
+
+    SubpassDescription subpass;
+    subpass.colorAttachments.push_back(AttachmentReference{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
+    subpass.depthStencilAttachments.push_back(AttachmentReference{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL});
+
+    RenderPass::Subpasses subpasses{subpass};
+
+    // make sure any previous reads of the atlas complete before it's written, and the write completes before the impostor quad samples it
+    SubpassDependency preDependency;
+    preDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+    preDependency.dstSubpass = 0;
+    preDependency.srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    preDependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    preDependency.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    preDependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+    SubpassDependency postDependency;
+    postDependency.srcSubpass = 0;
+    postDependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+    postDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    postDependency.dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    postDependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    postDependency.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+    RenderPass::Dependencies dependencies{preDependency, postDependency};
+
+    auto renderPass = RenderPass::create(device, attachments, subpasses, dependencies);
+
+    auto framebuffer = Framebuffer::create(renderPass, ImageViews{atlas->imageView, depthImageView}, atlasSize, atlasSize, 1);
+
+    // orthographic camera fitted to the bound, looking along the +y axis so the bake matches the cylindrical billboard orientation
+    auto lookAt = LookAt::create(bound.center + dvec3(0.0, -2.0 * bound.radius, 0.0), bound.center, dvec3(0.0, 0.0, 1.0));
+    auto ortho = Orthographic::create(-bound.radius, bound.radius, -bound.radius, bound.radius, bound.radius, 3.0 * bound.radius);
+    auto camera = Camera::create(ortho, lookAt, ViewportState::create(VkExtent2D{atlasSize, atlasSize}));
+
+    auto view = View::create(camera);
+    view->addChild(subgraph);
+
+    auto renderGraph = RenderGraph::create();
+    renderGraph->framebuffer = framebuffer;
+    renderGraph->renderArea.offset = {0, 0};
+    renderGraph->renderArea.extent = VkExtent2D{atlasSize, atlasSize};
+    renderGraph->setClearValues(VkClearColorValue{{0.0f, 0.0f, 0.0f, 0.0f}});
+    renderGraph->addChild(view);
+
+    return renderGraph;
+}
+
+ref_ptr<Node> ImpostorBaker::createImpostor(ref_ptr<ImageInfo> atlas, const dsphere& bound)
+{
+    if (!builder)
+    {
+        builder = Builder::create();
+        builder->options = options;
+    }
+
+    float diameter = static_cast<float>(2.0 * bound.radius);
+
+    GeometryInfo geomInfo;
+    geomInfo.dx.set(diameter, 0.0f, 0.0f);
+    geomInfo.dy.set(0.0f, 0.0f, diameter);
+    geomInfo.dz.set(0.0f, -1.0f, 0.0f);
+    geomInfo.positions = vec4Array::create({vec4(static_cast<float>(bound.center.x), static_cast<float>(bound.center.y), static_cast<float>(bound.center.z), 0.0f)});
+
+    StateInfo stateInfo;
+    stateInfo.lighting = false;
+    stateInfo.blending = true;
+    stateInfo.billboard = true;
+    stateInfo.imageInfo = atlas;
+
+    return builder->createQuad(geomInfo, stateInfo);
+}
+
+ref_ptr<CommandGraph> ImpostorBaker::bake(ref_ptr<ImpostorLOD> impostorLOD, ref_ptr<Device> device, int queueFamily)
+{
+    if (!impostorLOD || !impostorLOD->child)
+    {
+        warn("ImpostorBaker::bake() requires an ImpostorLOD with a child subgraph assigned.");
+        return {};
+    }
+
+    auto atlas = createAtlas(device);
+    auto renderGraph = createBakeRenderGraph(device, atlas, impostorLOD->child, impostorLOD->bound);
+
+    impostorLOD->impostor = createImpostor(atlas, impostorLOD->bound);
+
+    auto commandGraph = CommandGraph::create(device, queueFamily);
+    commandGraph->addChild(renderGraph);
+
+    return commandGraph;
+}
@@ -22,6 +22,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/LOD.h>
 #include <vsg/nodes/PagedLOD.h>
+#include <vsg/nodes/SpatialIndexGroup.h>
 #include <vsg/nodes/StateGroup.h>
 #include <vsg/nodes/Transform.h>
 #include <vsg/nodes/VertexDraw.h>
@@ -130,6 +131,53 @@ void Intersector::apply(const CullGroup& cn)
     if (intersects(cn.bound)) cn.traverse(*this);
 }
 
+void Intersector::apply(const SpatialIndexGroup& group)
+{
+    PushPopNode ppn(_nodePath, &group);
+
+    group.validateIndex();
+
+    auto& indexNodes = group.indexNodes();
+    if (indexNodes.empty())
+    {
+        group.traverse(*this);
+        return;
+    }
+
+    auto& leafChildren = group.leafChildren();
+    auto& children = group.children;
+
+    // walk the bounding volume hierarchy, skipping branches whose bounds fail the intersection test
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty())
+    {
+        const auto& indexNode = indexNodes[stack.back()];
+        stack.pop_back();
+
+        if (!intersects(indexNode.bound)) continue;
+
+        if (indexNode.count > 0)
+        {
+            for (uint32_t i = 0; i < indexNode.count; ++i)
+            {
+                children[leafChildren[indexNode.left + i]]->accept(*this);
+            }
+        }
+        else
+        {
+            stack.push_back(indexNode.left);
+            stack.push_back(indexNode.right);
+        }
+    }
+
+    for (auto childIndex : group.unboundedChildren())
+    {
+        children[childIndex]->accept(*this);
+    }
+}
+
 void Intersector::apply(const DepthSorted& cn)
 {
     PushPopNode ppn(_nodePath, &cn);
@@ -259,6 +259,12 @@ bool LineSegmentIntersector::intersectDraw(uint32_t firstVertex, uint32_t vertex
         TriangleIntersector<double> triIntersector(*this, ls.start, ls.end, arrayState.vertexArray(instanceIndex));
         if (!triIntersector.vertices) return false;
 
+        if (ref_ptr<TriangleBVH> bvh; bvhCache && (bvh = bvhCache->getOrBuild(triIntersector.vertices, {}, {}, firstVertex, vertexCount)))
+        {
+            bvh->intersect(ls.start, ls.end, [&triIntersector](uint32_t i0, uint32_t i1, uint32_t i2) { triIntersector.intersect(i0, i1, i2); });
+            continue;
+        }
+
         uint32_t endVertex = int((firstVertex + vertexCount) / 3.0f) * 3;
 
         for (uint32_t i = firstVertex; i < endVertex; i += 3)
@@ -286,6 +292,12 @@ bool LineSegmentIntersector::intersectDrawIndexed(uint32_t firstIndex, uint32_t
 
         triIntersector.instanceIndex = instanceIndex;
 
+        if (ref_ptr<TriangleBVH> bvh; bvhCache && (bvh = bvhCache->getOrBuild(triIntersector.vertices, ushort_indices, uint_indices, firstIndex, indexCount)))
+        {
+            bvh->intersect(ls.start, ls.end, [&triIntersector](uint32_t i0, uint32_t i1, uint32_t i2) { triIntersector.intersect(i0, i1, i2); });
+            continue;
+        }
+
         uint32_t endIndex = int((firstIndex + indexCount) / 3.0f) * 3;
 
         if (ushort_indices)
@@ -0,0 +1,134 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/utils/MemoryBudgetMonitor.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+MemoryBudgetMonitor::MemoryBudgetMonitor(ref_ptr<Device> in_device) :
+    device(in_device)
+{
+}
+
+bool MemoryBudgetMonitor::supported() const
+{
+    return device && device->getPhysicalDevice() && device->getPhysicalDevice()->supportsMemoryBudget();
+}
+
+void MemoryBudgetMonitor::update()
+{
+    if (!supported()) return;
+
+    budgets = device->getPhysicalDevice()->getMemoryBudgets();
+
+    deviceLocalPressure = 0.0;
+    for (const auto& heap : budgets)
+    {
+        if ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0 && heap.budget > 0)
+        {
+            double pressure = static_cast<double>(heap.usage) / static_cast<double>(heap.budget);
+            if (pressure > deviceLocalPressure) deviceLocalPressure = pressure;
+        }
+    }
+
+    if (deviceLocalPressure > pressureThreshold)
+    {
+        if (!underPressure)
+        {
+            underPressure = true;
+            warn("MemoryBudgetMonitor device local heap usage at ", static_cast<int>(deviceLocalPressure * 100.0), "% of budget, engaging reactive memory policies.");
+        }
+
+        _applyPressurePolicies();
+    }
+    else if (underPressure && deviceLocalPressure < recoveryThreshold)
+    {
+        underPressure = false;
+        _restoreBudgets();
+
+        info("MemoryBudgetMonitor device local heap usage back at ", static_cast<int>(deviceLocalPressure * 100.0), "% of budget, restored original memory budgets.");
+    }
+}
+
+void MemoryBudgetMonitor::_applyPressurePolicies()
+{
+    if (databasePager && databasePager->targetMaxPagedLODMemory > 0)
+    {
+        if (_originalPagedLODMemory == 0) _originalPagedLODMemory = databasePager->targetMaxPagedLODMemory;
+
+        auto minimum = static_cast<std::size_t>(static_cast<double>(_originalPagedLODMemory) * minimumBudgetFraction);
+        auto shrunk = static_cast<std::size_t>(static_cast<double>(databasePager->targetMaxPagedLODMemory) * shrinkFactor);
+        databasePager->targetMaxPagedLODMemory = std::max(shrunk, minimum);
+    }
+
+    const VkDeviceSize minimumBlockSize = 1024 * 1024;
+    for (auto& pools : memoryBufferPools)
+    {
+        if (!pools) continue;
+
+        auto& original = _originalPoolSizes[pools.get()];
+        if (original.minimumBufferSize == 0)
+        {
+            original.minimumBufferSize = pools->minimumBufferSize;
+            original.minimumDeviceMemorySize = pools->minimumDeviceMemorySize;
+        }
+
+        // cap the growth granularity of the pools so new blocks allocate in smaller steps while
+        // over budget, and hand back any blocks the paging churn has left fully idle.
+        pools->minimumBufferSize = std::max(pools->minimumBufferSize / 2, minimumBlockSize);
+        pools->minimumDeviceMemorySize = std::max(pools->minimumDeviceMemorySize / 2, minimumBlockSize);
+
+        pools->releaseEmptyPools();
+    }
+}
+
+void MemoryBudgetMonitor::_restoreBudgets()
+{
+    if (databasePager && _originalPagedLODMemory > 0)
+    {
+        databasePager->targetMaxPagedLODMemory = _originalPagedLODMemory;
+        _originalPagedLODMemory = 0;
+    }
+
+    for (auto& pools : memoryBufferPools)
+    {
+        if (!pools) continue;
+
+        auto itr = _originalPoolSizes.find(pools.get());
+        if (itr != _originalPoolSizes.end())
+        {
+            pools->minimumBufferSize = itr->second.minimumBufferSize;
+            pools->minimumDeviceMemorySize = itr->second.minimumDeviceMemorySize;
+        }
+    }
+
+    _originalPoolSizes.clear();
+}
+
+void MemoryBudgetMonitor::report(std::ostream& out) const
+{
+    const double Mb = 1024.0 * 1024.0;
+
+    out << "MemoryBudgetMonitor::report() deviceLocalPressure = " << deviceLocalPressure << ", underPressure = " << underPressure << std::endl;
+    for (const auto& heap : budgets)
+    {
+        out << "    heap " << heap.heapIndex
+            << ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0 ? " (device local)" : "")
+            << " usage = " << static_cast<double>(heap.usage) / Mb << " Mb"
+            << ", budget = " << static_cast<double>(heap.budget) / Mb << " Mb"
+            << ", size = " << static_cast<double>(heap.size) / Mb << " Mb" << std::endl;
+    }
+}
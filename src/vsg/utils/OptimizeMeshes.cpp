@@ -0,0 +1,340 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/vec3.h>
+#include <vsg/state/GraphicsPipeline.h>
+#include <vsg/state/InputAssemblyState.h>
+#include <vsg/utils/OptimizeMeshes.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace vsg;
+
+namespace
+{
+    // reordering triangles is only meaningful for triangle lists without primitive restart,
+    // and only when the StateGroup itself binds the pipeline so the topology is known
+    bool triangleListTopology(const StateGroup& stateGroup)
+    {
+        for (auto& stateCommand : stateGroup.stateCommands)
+        {
+            auto bindGraphicsPipeline = stateCommand.cast<BindGraphicsPipeline>();
+            if (!bindGraphicsPipeline || !bindGraphicsPipeline->pipeline) continue;
+
+            for (auto& pipelineState : bindGraphicsPipeline->pipeline->pipelineStates)
+            {
+                if (auto inputAssemblyState = pipelineState.cast<InputAssemblyState>())
+                {
+                    return inputAssemblyState->topology == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST &&
+                           !inputAssemblyState->primitiveRestartEnable;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Tipsify (Sander, Nehab & Barczak 2007) - emit the triangles around a fanning vertex, then
+    // fan from the candidate vertex with the most recent cache entry that will still be resident,
+    // falling back to the dead end stack and then input order when the neighbourhood is exhausted.
+    std::vector<uint32_t> reorderForVertexCache(const std::vector<uint32_t>& indices, uint32_t vertexCount, uint32_t cacheSize)
+    {
+        uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+        // per vertex adjacency lists of incident triangles
+        std::vector<uint32_t> valence(vertexCount, 0);
+        for (auto index : indices) ++valence[index];
+
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (uint32_t v = 0; v < vertexCount; ++v) offsets[v + 1] = offsets[v] + valence[v];
+
+        std::vector<uint32_t> adjacency(indices.size());
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (uint32_t t = 0; t < triangleCount; ++t)
+            {
+                adjacency[fill[indices[t * 3]]++] = t;
+                adjacency[fill[indices[t * 3 + 1]]++] = t;
+                adjacency[fill[indices[t * 3 + 2]]++] = t;
+            }
+        }
+
+        std::vector<uint32_t> liveTriangles(valence);
+        std::vector<uint32_t> cacheTime(vertexCount, 0);
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<uint32_t> deadEndStack;
+        std::vector<uint32_t> candidates;
+
+        std::vector<uint32_t> reordered;
+        reordered.reserve(indices.size());
+
+        uint32_t time = cacheSize + 1;
+        uint32_t cursor = 0;
+        int64_t fanning = vertexCount > 0 ? 0 : -1;
+
+        while (fanning >= 0)
+        {
+            candidates.clear();
+
+            for (uint32_t i = offsets[fanning]; i < offsets[fanning + 1]; ++i)
+            {
+                uint32_t triangle = adjacency[i];
+                if (emitted[triangle]) continue;
+                emitted[triangle] = true;
+
+                for (uint32_t corner = 0; corner < 3; ++corner)
+                {
+                    uint32_t vertex = indices[triangle * 3 + corner];
+                    reordered.push_back(vertex);
+                    deadEndStack.push_back(vertex);
+                    candidates.push_back(vertex);
+                    --liveTriangles[vertex];
+                    if (time - cacheTime[vertex] > cacheSize) cacheTime[vertex] = time++;
+                }
+            }
+
+            // pick the candidate that will still be in the cache after its remaining triangles are emitted
+            int64_t next = -1;
+            int64_t bestPriority = -1;
+            for (auto vertex : candidates)
+            {
+                if (liveTriangles[vertex] == 0) continue;
+                int64_t priority = 0;
+                if (time - cacheTime[vertex] + 2 * liveTriangles[vertex] <= cacheSize) priority = static_cast<int64_t>(time - cacheTime[vertex]);
+                if (priority > bestPriority)
+                {
+                    bestPriority = priority;
+                    next = vertex;
+                }
+            }
+
+            if (next < 0)
+            {
+                while (!deadEndStack.empty())
+                {
+                    uint32_t vertex = deadEndStack.back();
+                    deadEndStack.pop_back();
+                    if (liveTriangles[vertex] > 0)
+                    {
+                        next = vertex;
+                        break;
+                    }
+                }
+            }
+
+            if (next < 0)
+            {
+                while (cursor < vertexCount)
+                {
+                    if (liveTriangles[cursor] > 0)
+                    {
+                        next = cursor;
+                        break;
+                    }
+                    ++cursor;
+                }
+            }
+
+            fanning = next;
+        }
+
+        return reordered;
+    }
+
+    // sort fixed size runs of cache optimized triangles so clusters facing away from the mesh
+    // centre, which tend to be drawn over by nearer outward facing surfaces, are emitted last
+    void reorderForOverdraw(std::vector<uint32_t>& indices, const vec3Array& positions, uint32_t clusterSize)
+    {
+        uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+        if (clusterSize == 0 || triangleCount <= clusterSize) return;
+
+        dvec3 meshCentroid(0.0, 0.0, 0.0);
+        for (auto& position : positions) meshCentroid += dvec3(position.x, position.y, position.z);
+        meshCentroid /= static_cast<double>(positions.size());
+
+        struct Cluster
+        {
+            uint32_t firstTriangle = 0;
+            uint32_t triangleCount = 0;
+            double key = 0.0;
+        };
+
+        std::vector<Cluster> clusters;
+        for (uint32_t firstTriangle = 0; firstTriangle < triangleCount; firstTriangle += clusterSize)
+        {
+            Cluster cluster;
+            cluster.firstTriangle = firstTriangle;
+            cluster.triangleCount = std::min(clusterSize, triangleCount - firstTriangle);
+
+            dvec3 centroid(0.0, 0.0, 0.0);
+            dvec3 normal(0.0, 0.0, 0.0);
+            for (uint32_t t = cluster.firstTriangle; t < cluster.firstTriangle + cluster.triangleCount; ++t)
+            {
+                const auto& v0 = positions[indices[t * 3]];
+                const auto& v1 = positions[indices[t * 3 + 1]];
+                const auto& v2 = positions[indices[t * 3 + 2]];
+                centroid += dvec3((v0.x + v1.x + v2.x) / 3.0, (v0.y + v1.y + v2.y) / 3.0, (v0.z + v1.z + v2.z) / 3.0);
+                normal += cross(dvec3(v1.x - v0.x, v1.y - v0.y, v1.z - v0.z), dvec3(v2.x - v0.x, v2.y - v0.y, v2.z - v0.z));
+            }
+            centroid /= static_cast<double>(cluster.triangleCount);
+
+            auto outward = centroid - meshCentroid;
+            auto outwardLength = length(outward);
+            auto normalLength = length(normal);
+            cluster.key = (outwardLength > 0.0 && normalLength > 0.0) ? dot(outward / outwardLength, normal / normalLength) : 0.0;
+
+            clusters.push_back(cluster);
+        }
+
+        std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& lhs, const Cluster& rhs) { return lhs.key > rhs.key; });
+
+        std::vector<uint32_t> sorted;
+        sorted.reserve(indices.size());
+        for (auto& cluster : clusters)
+        {
+            auto first = indices.begin() + cluster.firstTriangle * 3;
+            sorted.insert(sorted.end(), first, first + cluster.triangleCount * 3);
+        }
+        indices.swap(sorted);
+    }
+
+} // namespace
+
+OptimizeMeshes::OptimizeMeshes()
+{
+}
+
+void OptimizeMeshes::apply(Node& node)
+{
+    node.traverse(*this);
+}
+
+void OptimizeMeshes::apply(StateGroup& stateGroup)
+{
+    bool previous = _triangleList;
+    _triangleList = triangleListTopology(stateGroup);
+
+    stateGroup.traverse(*this);
+
+    _triangleList = previous;
+}
+
+void OptimizeMeshes::apply(VertexIndexDraw& vid)
+{
+    if (_triangleList && _optimizable(vid)) _optimize(vid);
+}
+
+bool OptimizeMeshes::_optimizable(const VertexIndexDraw& vid) const
+{
+    if (vid.arrays.empty() || !vid.indices || !vid.indices->data) return false;
+
+    // only draws that address their whole index array with a zero vertexOffset can be rewritten,
+    // reordering shared or partially addressed buffers would corrupt the other draws over them
+    if (vid.firstIndex != 0 || vid.vertexOffset != 0) return false;
+    if (vid.indexCount != vid.indices->data->valueCount() || vid.indexCount % 3 != 0) return false;
+
+    auto indexData = vid.indices->data.get();
+    if (!indexData->is_compatible(typeid(ushortArray)) && !indexData->is_compatible(typeid(uintArray))) return false;
+    if (indexData->dynamic() || dynamic(indexData)) return false;
+
+    for (auto& array : vid.arrays)
+    {
+        if (!array || !array->data) return false;
+        if (array->data->dynamic() || dynamic(array->data.get())) return false;
+    }
+
+    return true;
+}
+
+void OptimizeMeshes::_optimize(VertexIndexDraw& vid)
+{
+    uint32_t vertexCount = static_cast<uint32_t>(vid.arrays.front()->data->valueCount());
+    if (vertexCount == 0) return;
+
+    // widen the indices for processing
+    std::vector<uint32_t> indices;
+    indices.reserve(vid.indexCount);
+    if (auto ushortIndices = vid.indices->data.cast<ushortArray>())
+    {
+        for (auto index : *ushortIndices) indices.push_back(index);
+    }
+    else if (auto uintIndices = vid.indices->data.cast<uintArray>())
+    {
+        indices.assign(uintIndices->begin(), uintIndices->end());
+    }
+
+    for (auto index : indices)
+    {
+        if (index >= vertexCount) return;
+    }
+
+    if (optimizeVertexCache)
+    {
+        indices = reorderForVertexCache(indices, vertexCount, std::max(cacheSize, 3u));
+    }
+
+    if (optimizeOverdraw)
+    {
+        if (auto positions = vid.arrays.front()->data.cast<vec3Array>())
+        {
+            reorderForOverdraw(indices, *positions, clusterSize);
+        }
+    }
+
+    if (optimizeVertexFetch)
+    {
+        // remap vertices into first use order so vertex fetch walks memory linearly,
+        // unreferenced vertices are appended in their original order
+        const uint32_t unused = ~0u;
+        std::vector<uint32_t> remap(vertexCount, unused);
+        uint32_t nextVertex = 0;
+        for (auto& index : indices)
+        {
+            if (remap[index] == unused) remap[index] = nextVertex++;
+            index = remap[index];
+        }
+        for (auto& entry : remap)
+        {
+            if (entry == unused) entry = nextVertex++;
+        }
+
+        for (auto& array : vid.arrays)
+        {
+            auto data = array->data.get();
+            if (data->valueCount() != vertexCount) continue;
+
+            auto valueSize = data->valueSize();
+            if (data->properties.stride != 0 && data->properties.stride != static_cast<uint32_t>(valueSize)) continue;
+
+            auto destination = static_cast<uint8_t*>(data->dataPointer());
+            std::vector<uint8_t> source(destination, destination + vertexCount * valueSize);
+            for (uint32_t v = 0; v < vertexCount; ++v)
+            {
+                std::memcpy(destination + remap[v] * valueSize, source.data() + v * valueSize, valueSize);
+            }
+        }
+    }
+
+    // write the reordered indices back in place
+    if (auto ushortIndices = vid.indices->data.cast<ushortArray>())
+    {
+        auto itr = ushortIndices->begin();
+        for (auto index : indices) *(itr++) = static_cast<uint16_t>(index);
+    }
+    else if (auto uintIndices = vid.indices->data.cast<uintArray>())
+    {
+        auto itr = uintIndices->begin();
+        for (auto index : indices) *(itr++) = index;
+    }
+
+    ++numOptimized;
+}
@@ -0,0 +1,120 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/utils/PackAttributes.h>
+
+using namespace vsg;
+
+ref_ptr<Data> vsg::packHalf(const Data& array)
+{
+    if (auto floats = array.cast<floatArray>())
+    {
+        auto packed = ushortArray::create(floats->size());
+        packed->properties.format = VK_FORMAT_R16_SFLOAT;
+        auto itr = packed->begin();
+        for (auto value : *floats) *(itr++) = floatToHalf(value);
+        return packed;
+    }
+
+    if (auto vec2s = array.cast<vec2Array>())
+    {
+        auto packed = usvec2Array::create(vec2s->size());
+        packed->properties.format = VK_FORMAT_R16G16_SFLOAT;
+        auto itr = packed->begin();
+        for (auto& value : *vec2s) *(itr++) = usvec2(floatToHalf(value.x), floatToHalf(value.y));
+        return packed;
+    }
+
+    if (auto vec3s = array.cast<vec3Array>())
+    {
+        auto packed = usvec4Array::create(vec3s->size());
+        packed->properties.format = VK_FORMAT_R16G16B16A16_SFLOAT;
+        auto itr = packed->begin();
+        for (auto& value : *vec3s) *(itr++) = usvec4(floatToHalf(value.x), floatToHalf(value.y), floatToHalf(value.z), 0);
+        return packed;
+    }
+
+    if (auto vec4s = array.cast<vec4Array>())
+    {
+        auto packed = usvec4Array::create(vec4s->size());
+        packed->properties.format = VK_FORMAT_R16G16B16A16_SFLOAT;
+        auto itr = packed->begin();
+        for (auto& value : *vec4s) *(itr++) = usvec4(floatToHalf(value.x), floatToHalf(value.y), floatToHalf(value.z), floatToHalf(value.w));
+        return packed;
+    }
+
+    return {};
+}
+
+ref_ptr<Data> vsg::packUnorm16(const Data& array)
+{
+    if (auto floats = array.cast<floatArray>())
+    {
+        auto packed = ushortArray::create(floats->size());
+        packed->properties.format = VK_FORMAT_R16_UNORM;
+        auto itr = packed->begin();
+        for (auto value : *floats) *(itr++) = packUnorm16(value);
+        return packed;
+    }
+
+    if (auto vec2s = array.cast<vec2Array>())
+    {
+        auto packed = usvec2Array::create(vec2s->size());
+        packed->properties.format = VK_FORMAT_R16G16_UNORM;
+        auto itr = packed->begin();
+        for (auto& value : *vec2s) *(itr++) = usvec2(packUnorm16(value.x), packUnorm16(value.y));
+        return packed;
+    }
+
+    if (auto vec3s = array.cast<vec3Array>())
+    {
+        auto packed = usvec4Array::create(vec3s->size());
+        packed->properties.format = VK_FORMAT_R16G16B16A16_UNORM;
+        auto itr = packed->begin();
+        for (auto& value : *vec3s) *(itr++) = usvec4(packUnorm16(value.x), packUnorm16(value.y), packUnorm16(value.z), 0);
+        return packed;
+    }
+
+    if (auto vec4s = array.cast<vec4Array>())
+    {
+        auto packed = usvec4Array::create(vec4s->size());
+        packed->properties.format = VK_FORMAT_R16G16B16A16_UNORM;
+        auto itr = packed->begin();
+        for (auto& value : *vec4s) *(itr++) = usvec4(packUnorm16(value.x), packUnorm16(value.y), packUnorm16(value.z), packUnorm16(value.w));
+        return packed;
+    }
+
+    return {};
+}
+
+ref_ptr<Data> vsg::packSnorm_A2B10G10R10(const Data& array)
+{
+    if (auto vec3s = array.cast<vec3Array>())
+    {
+        auto packed = uintArray::create(vec3s->size());
+        packed->properties.format = VK_FORMAT_A2B10G10R10_SNORM_PACK32;
+        auto itr = packed->begin();
+        for (auto& value : *vec3s) *(itr++) = packSnorm_A2B10G10R10(vec4(value.x, value.y, value.z, 0.0f));
+        return packed;
+    }
+
+    if (auto vec4s = array.cast<vec4Array>())
+    {
+        auto packed = uintArray::create(vec4s->size());
+        packed->properties.format = VK_FORMAT_A2B10G10R10_SNORM_PACK32;
+        auto itr = packed->begin();
+        for (auto& value : *vec4s) *(itr++) = packSnorm_A2B10G10R10(value);
+        return packed;
+    }
+
+    return {};
+}
@@ -0,0 +1,104 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Group.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/ParallelComputeBounds.h>
+
+using namespace vsg;
+
+namespace
+{
+    struct ComputeBoundsOperation : public Inherit<Operation, ComputeBoundsOperation>
+    {
+        ComputeBoundsOperation(ref_ptr<ComputeBounds> in_computeBounds, const Node* in_subgraph, ref_ptr<Latch> in_latch) :
+            computeBounds(in_computeBounds),
+            subgraph(in_subgraph),
+            latch(in_latch) {}
+
+        ref_ptr<ComputeBounds> computeBounds;
+        const Node* subgraph;
+        ref_ptr<Latch> latch;
+
+        void run() override
+        {
+            subgraph->accept(*computeBounds);
+            latch->count_down();
+        }
+    };
+} // namespace
+
+ParallelComputeBounds::ParallelComputeBounds(ref_ptr<OperationThreads> in_operationThreads, ref_ptr<ArrayState> initialArrayState) :
+    Inherit(initialArrayState),
+    operationThreads(in_operationThreads)
+{
+}
+
+void ParallelComputeBounds::apply(const Group& group)
+{
+    if (!operationThreads || group.children.size() < minimumChildrenForFanOut)
+    {
+        group.traverse(*this);
+        return;
+    }
+
+    // gather the subtree roots to hand out, expanding nested plain Groups so there are enough tasks for the threads to balance
+    size_t targetTasks = (operationThreads->threads.size() + 1) * 4;
+    std::vector<const Node*> subgraphs;
+    subgraphs.reserve(group.children.size());
+    for (auto& child : group.children) subgraphs.push_back(child.get());
+
+    bool expanded = true;
+    while (subgraphs.size() < targetTasks && expanded)
+    {
+        expanded = false;
+        std::vector<const Node*> expandedSubgraphs;
+        expandedSubgraphs.reserve(subgraphs.size() * 2);
+        for (auto node : subgraphs)
+        {
+            if (node->type_info() == typeid(Group))
+            {
+                for (auto& child : static_cast<const Group*>(node)->children) expandedSubgraphs.push_back(child.get());
+                expanded = true;
+            }
+            else
+            {
+                expandedSubgraphs.push_back(node);
+            }
+        }
+        subgraphs.swap(expandedSubgraphs);
+    }
+
+    // each subtree gets its own ComputeBounds seeded with the current traversal state so the
+    // operations can run independently, with the results unioned once they have all completed.
+    auto latch = Latch::create(subgraphs.size());
+    std::vector<ref_ptr<ComputeBoundsOperation>> operations;
+    operations.reserve(subgraphs.size());
+    for (auto node : subgraphs)
+    {
+        auto computeBounds = ComputeBounds::create(arrayStateStack.back()->cloneArrayState());
+        computeBounds->useNodeBounds = useNodeBounds;
+        computeBounds->matrixStack = matrixStack;
+        operations.push_back(ComputeBoundsOperation::create(computeBounds, node, latch));
+    }
+
+    operationThreads->add(operations.begin(), operations.end());
+
+    // help process operations while waiting for the worker threads to finish
+    operationThreads->run();
+    latch->wait();
+
+    for (auto& operation : operations)
+    {
+        if (operation->computeBounds->bounds.valid()) bounds.add(operation->computeBounds->bounds);
+    }
+}
@@ -0,0 +1,126 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Group.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/ParallelLineSegmentIntersector.h>
+
+using namespace vsg;
+
+namespace
+{
+    struct IntersectionOperation : public Inherit<Operation, IntersectionOperation>
+    {
+        IntersectionOperation(ref_ptr<LineSegmentIntersector> in_intersector, const Node* in_subgraph, ref_ptr<Latch> in_latch) :
+            intersector(in_intersector),
+            subgraph(in_subgraph),
+            latch(in_latch) {}
+
+        ref_ptr<LineSegmentIntersector> intersector;
+        const Node* subgraph;
+        ref_ptr<Latch> latch;
+
+        void run() override
+        {
+            subgraph->accept(*intersector);
+            latch->count_down();
+        }
+    };
+} // namespace
+
+ParallelLineSegmentIntersector::ParallelLineSegmentIntersector(const dvec3& s, const dvec3& e, ref_ptr<OperationThreads> in_operationThreads, ref_ptr<ArrayState> initialArrayData) :
+    Inherit(s, e, initialArrayData),
+    operationThreads(in_operationThreads)
+{
+}
+
+ParallelLineSegmentIntersector::ParallelLineSegmentIntersector(const Camera& camera, int32_t x, int32_t y, ref_ptr<OperationThreads> in_operationThreads, ref_ptr<ArrayState> initialArrayData) :
+    Inherit(camera, x, y, initialArrayData),
+    operationThreads(in_operationThreads)
+{
+}
+
+void ParallelLineSegmentIntersector::apply(const Group& group)
+{
+    if (!operationThreads || group.children.size() < minimumChildrenForFanOut)
+    {
+        _nodePath.push_back(&group);
+        group.traverse(*this);
+        _nodePath.pop_back();
+        return;
+    }
+
+    _nodePath.push_back(&group);
+
+    // gather the subtree roots to hand out, expanding nested plain Groups so there are enough tasks
+    // for the threads to balance, tracking the node path down to each subtree for the results.
+    struct Subgraph
+    {
+        const Node* node;
+        NodePath path;
+    };
+
+    size_t targetTasks = (operationThreads->threads.size() + 1) * 4;
+    std::vector<Subgraph> subgraphs;
+    subgraphs.reserve(group.children.size());
+    for (auto& child : group.children) subgraphs.push_back(Subgraph{child.get(), _nodePath});
+
+    bool expanded = true;
+    while (subgraphs.size() < targetTasks && expanded)
+    {
+        expanded = false;
+        std::vector<Subgraph> expandedSubgraphs;
+        expandedSubgraphs.reserve(subgraphs.size() * 2);
+        for (auto& subgraph : subgraphs)
+        {
+            if (subgraph.node->type_info() == typeid(Group))
+            {
+                auto path = subgraph.path;
+                path.push_back(subgraph.node);
+                for (auto& child : static_cast<const Group*>(subgraph.node)->children) expandedSubgraphs.push_back(Subgraph{child.get(), path});
+                expanded = true;
+            }
+            else
+            {
+                expandedSubgraphs.push_back(subgraph);
+            }
+        }
+        subgraphs.swap(expandedSubgraphs);
+    }
+
+    // each subtree gets its own intersector seeded with the current line segment stack, array state
+    // and node path so the operations can run independently, with the intersections merged at the end.
+    auto latch = Latch::create(subgraphs.size());
+    std::vector<ref_ptr<IntersectionOperation>> operations;
+    operations.reserve(subgraphs.size());
+    const auto& worldLineSegment = _lineSegmentStack.front();
+    for (auto& subgraph : subgraphs)
+    {
+        auto intersector = ParallelLineSegmentIntersector::create(worldLineSegment.start, worldLineSegment.end, ref_ptr<OperationThreads>{}, arrayStateStack.back()->cloneArrayState());
+        intersector->_lineSegmentStack = _lineSegmentStack;
+        intersector->_nodePath = subgraph.path;
+        operations.push_back(IntersectionOperation::create(intersector, subgraph.node, latch));
+    }
+
+    operationThreads->add(operations.begin(), operations.end());
+
+    // help process operations while waiting for the worker threads to finish
+    operationThreads->run();
+    latch->wait();
+
+    for (auto& operation : operations)
+    {
+        intersections.insert(intersections.end(), operation->intersector->intersections.begin(), operation->intersector->intersections.end());
+    }
+
+    _nodePath.pop_back();
+}
@@ -0,0 +1,279 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/nodes/Transform.h>
+#include <vsg/utils/PolytopeIntersector.h>
+
+using namespace vsg;
+
+PolytopeIntersector::PolytopeIntersector(const Polytope& polytope, ref_ptr<ArrayState> initialArrayData) :
+    Inherit(initialArrayData)
+{
+    _polytopeStack.push_back(Polytopes{polytope});
+}
+
+PolytopeIntersector::PolytopeIntersector(const Camera& camera, double xMin, double yMin, double xMax, double yMax, ref_ptr<ArrayState> initialArrayData) :
+    Inherit(initialArrayData)
+{
+    auto viewport = camera.getViewport();
+
+    // map the window space rectangle into normalized device coordinates
+    double ndc_xMin = (viewport.width > 0) ? (2.0 * (std::min(xMin, xMax) - viewport.x) / viewport.width - 1.0) : -1.0;
+    double ndc_xMax = (viewport.width > 0) ? (2.0 * (std::max(xMin, xMax) - viewport.x) / viewport.width - 1.0) : 1.0;
+    double ndc_yMin = (viewport.height > 0) ? (2.0 * (std::min(yMin, yMax) - viewport.y) / viewport.height - 1.0) : -1.0;
+    double ndc_yMax = (viewport.height > 0) ? (2.0 * (std::max(yMin, yMax) - viewport.y) / viewport.height - 1.0) : 1.0;
+
+    // clip space planes bounding the selection rectangle, normals pointing inwards
+    Polytope clipPolytope{
+        dplane(1.0, 0.0, 0.0, -ndc_xMin),  // left
+        dplane(-1.0, 0.0, 0.0, ndc_xMax),  // right
+        dplane(0.0, 1.0, 0.0, -ndc_yMin),  // bottom
+        dplane(0.0, -1.0, 0.0, ndc_yMax),  // top
+        dplane(0.0, 0.0, 1.0, 0.0),        // near
+        dplane(0.0, 0.0, -1.0, 1.0)};      // far
+
+    // transform the clip space planes into world space, plane * M maps a plane through the frame M projects into
+    dmat4 worldToClip = camera.projectionMatrix->transform() * camera.viewMatrix->transform();
+
+    Polytope worldPolytope;
+    worldPolytope.reserve(clipPolytope.size());
+    for (const auto& pl : clipPolytope) worldPolytope.push_back(pl * worldToClip);
+
+    _polytopeStack.push_back(Polytopes{worldPolytope});
+}
+
+void PolytopeIntersector::addPolytope(const Polytope& polytope)
+{
+    _polytopeStack.front().push_back(polytope);
+}
+
+PolytopeIntersector::Intersection::Intersection(const dvec3& in_localIntersection, const dvec3& in_worldIntersection, const dmat4& in_localToWorld, const NodePath& in_nodePath, const DataList& in_arrays, const std::vector<uint32_t>& in_indices, uint32_t in_instanceIndex, uint32_t in_polytopeIndex) :
+    localIntersection(in_localIntersection),
+    worldIntersection(in_worldIntersection),
+    localToWorld(in_localToWorld),
+    nodePath(in_nodePath),
+    arrays(in_arrays),
+    indices(in_indices),
+    instanceIndex(in_instanceIndex),
+    polytopeIndex(in_polytopeIndex)
+{
+}
+
+ref_ptr<PolytopeIntersector::Intersection> PolytopeIntersector::add(const dvec3& coord, const std::vector<uint32_t>& indices, uint32_t instanceIndex, uint32_t polytopeIndex)
+{
+    auto localToWorld = computeTransform(_nodePath);
+    auto intersection = Intersection::create(coord, localToWorld * coord, localToWorld, _nodePath, arrayStateStack.back()->arrays, indices, instanceIndex, polytopeIndex);
+    intersections.emplace_back(intersection);
+
+    return intersection;
+}
+
+void PolytopeIntersector::pushTransform(const Transform& transform)
+{
+    auto& l2wStack = localToWorldStack();
+    auto& w2lStack = worldToLocalStack();
+
+    dmat4 localToWorld = l2wStack.empty() ? transform.transform(dmat4{}) : transform.transform(l2wStack.back());
+    dmat4 worldToLocal = inverse(localToWorld);
+
+    l2wStack.push_back(localToWorld);
+    w2lStack.push_back(worldToLocal);
+
+    // plane * localToWorld maps each reference frame plane into the new local frame
+    const auto& referencePolytopes = _polytopeStack.front();
+    Polytopes localPolytopes;
+    localPolytopes.reserve(referencePolytopes.size());
+    for (const auto& polytope : referencePolytopes)
+    {
+        Polytope local;
+        local.reserve(polytope.size());
+        for (const auto& pl : polytope) local.push_back(pl * localToWorld);
+        localPolytopes.push_back(std::move(local));
+    }
+    _polytopeStack.push_back(std::move(localPolytopes));
+}
+
+void PolytopeIntersector::popTransform()
+{
+    _polytopeStack.pop_back();
+    localToWorldStack().pop_back();
+    worldToLocalStack().pop_back();
+}
+
+bool PolytopeIntersector::intersects(const dsphere& bs)
+{
+    if (!bs.valid()) return false;
+
+    for (const auto& polytope : _polytopeStack.back())
+    {
+        if (intersect(polytope, bs)) return true;
+    }
+    return false;
+}
+
+bool PolytopeIntersector::_triangleInside(const dvec3& v0, const dvec3& v1, const dvec3& v2, const Polytope& polytope, dvec3& centroid)
+{
+    // Sutherland-Hodgman clip of the triangle against each plane, an empty polygon means wholly outside
+    std::vector<dvec3> polygon{v0, v1, v2};
+    std::vector<dvec3> clipped;
+
+    for (const auto& pl : polytope)
+    {
+        clipped.clear();
+        for (size_t i = 0; i < polygon.size(); ++i)
+        {
+            const dvec3& current = polygon[i];
+            const dvec3& next = polygon[(i + 1) % polygon.size()];
+            double d_current = distance(pl, current);
+            double d_next = distance(pl, next);
+
+            if (d_current >= 0.0) clipped.push_back(current);
+            if ((d_current >= 0.0) != (d_next >= 0.0))
+            {
+                double r = d_current / (d_current - d_next);
+                clipped.push_back(current + (next - current) * r);
+            }
+        }
+
+        polygon.swap(clipped);
+        if (polygon.empty()) return false;
+    }
+
+    centroid = {};
+    for (const auto& v : polygon) centroid += v;
+    centroid /= double(polygon.size());
+    return true;
+}
+
+bool PolytopeIntersector::intersectDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    auto& arrayState = *arrayStateStack.back();
+    if (vertexCount == 0) return false;
+
+    const auto& polytopes = _polytopeStack.back();
+
+    size_t previous_size = intersections.size();
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        auto vertices = arrayState.vertexArray(instanceIndex);
+        if (!vertices) continue;
+
+        if (arrayState.topology == VK_PRIMITIVE_TOPOLOGY_POINT_LIST)
+        {
+            for (uint32_t i = firstVertex; i < firstVertex + vertexCount; ++i)
+            {
+                dvec3 v(vertices->at(i));
+                for (uint32_t polytopeIndex = 0; polytopeIndex < polytopes.size(); ++polytopeIndex)
+                {
+                    bool inside = true;
+                    for (const auto& pl : polytopes[polytopeIndex])
+                    {
+                        if (distance(pl, v) < 0.0)
+                        {
+                            inside = false;
+                            break;
+                        }
+                    }
+                    if (inside) add(v, {i}, instanceIndex, polytopeIndex);
+                }
+            }
+            continue;
+        }
+
+        if (arrayState.topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || vertexCount < 3) continue;
+
+        auto intersectTriangle = [&](uint32_t polytopeIndex, uint32_t i0, uint32_t i1, uint32_t i2) {
+            dvec3 centroid;
+            if (_triangleInside(dvec3(vertices->at(i0)), dvec3(vertices->at(i1)), dvec3(vertices->at(i2)), polytopes[polytopeIndex], centroid))
+            {
+                add(centroid, {i0, i1, i2}, instanceIndex, polytopeIndex);
+            }
+        };
+
+        ref_ptr<TriangleBVH> bvh;
+        if (bvhCache) bvh = bvhCache->getOrBuild(vertices, {}, {}, firstVertex, vertexCount);
+
+        for (uint32_t polytopeIndex = 0; polytopeIndex < polytopes.size(); ++polytopeIndex)
+        {
+            if (bvh)
+            {
+                bvh->intersectPolytope(polytopes[polytopeIndex], [&](uint32_t i0, uint32_t i1, uint32_t i2) { intersectTriangle(polytopeIndex, i0, i1, i2); });
+            }
+            else
+            {
+                uint32_t endVertex = ((firstVertex + vertexCount) / 3) * 3;
+                for (uint32_t i = firstVertex; i < endVertex; i += 3)
+                {
+                    intersectTriangle(polytopeIndex, i, i + 1, i + 2);
+                }
+            }
+        }
+    }
+
+    return intersections.size() != previous_size;
+}
+
+bool PolytopeIntersector::intersectDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    auto& arrayState = *arrayStateStack.back();
+    if (arrayState.topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || indexCount < 3) return false;
+
+    const auto& polytopes = _polytopeStack.back();
+
+    size_t previous_size = intersections.size();
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        auto vertices = arrayState.vertexArray(instanceIndex);
+        if (!vertices) continue;
+
+        auto intersectTriangle = [&](uint32_t polytopeIndex, uint32_t i0, uint32_t i1, uint32_t i2) {
+            dvec3 centroid;
+            if (_triangleInside(dvec3(vertices->at(i0)), dvec3(vertices->at(i1)), dvec3(vertices->at(i2)), polytopes[polytopeIndex], centroid))
+            {
+                add(centroid, {i0, i1, i2}, instanceIndex, polytopeIndex);
+            }
+        };
+
+        ref_ptr<TriangleBVH> bvh;
+        if (bvhCache) bvh = bvhCache->getOrBuild(vertices, ushort_indices, uint_indices, firstIndex, indexCount);
+
+        for (uint32_t polytopeIndex = 0; polytopeIndex < polytopes.size(); ++polytopeIndex)
+        {
+            if (bvh)
+            {
+                bvh->intersectPolytope(polytopes[polytopeIndex], [&](uint32_t i0, uint32_t i1, uint32_t i2) { intersectTriangle(polytopeIndex, i0, i1, i2); });
+                continue;
+            }
+
+            uint32_t endIndex = ((firstIndex + indexCount) / 3) * 3;
+            if (ushort_indices)
+            {
+                for (uint32_t i = firstIndex; i < endIndex; i += 3)
+                {
+                    intersectTriangle(polytopeIndex, ushort_indices->at(i), ushort_indices->at(i + 1), ushort_indices->at(i + 2));
+                }
+            }
+            else if (uint_indices)
+            {
+                for (uint32_t i = firstIndex; i < endIndex; i += 3)
+                {
+                    intersectTriangle(polytopeIndex, uint_indices->at(i), uint_indices->at(i + 1), uint_indices->at(i + 2));
+                }
+            }
+        }
+    }
+
+    return intersections.size() != previous_size;
+}
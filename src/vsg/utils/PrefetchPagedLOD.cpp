@@ -0,0 +1,120 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/PagedLOD.h>
+#include <vsg/threading/atomics.h>
+#include <vsg/utils/PrefetchPagedLOD.h>
+
+using namespace vsg;
+
+/////////////////////////////////////////////////////////////////////////
+//
+// PrefetchPagedLOD
+//
+PrefetchPagedLOD::PrefetchPagedLOD(ref_ptr<Camera> in_camera, ref_ptr<DatabasePager> in_databasePager, const dmat4& viewMatrix, int in_loadLevels) :
+    LoadPagedLOD(in_camera, in_loadLevels),
+    databasePager(in_databasePager)
+{
+    // replace the camera's view matrix set up by LoadPagedLOD with the specified, typically predicted, view matrix
+    modelviewMatrixStack.pop();
+    modelviewMatrixStack.emplace(viewMatrix);
+
+    _frustumStack.pop();
+    pushFrustum();
+}
+
+void PrefetchPagedLOD::apply(PagedLOD& plod)
+{
+    const auto& bs = plod.bound;
+
+    // check if plod bounding sphere is in view frustum.
+    if (level >= loadLevels || !intersect(_frustumStack.top(), bs)) return;
+
+    auto [distance, rf] = computeDistanceAndRF(bs);
+
+    const auto& child = plod.children[0];
+    auto cutoff = child.minimumScreenHeightRatio * distance;
+    bool child_visible = rf > cutoff;
+    if (!child_visible) return;
+
+    if (child.node)
+    {
+        // high res child already available so look for nested PagedLOD within it
+        ++level;
+        child.node->accept(*this);
+        --level;
+    }
+    else if (databasePager)
+    {
+        // keep the speculative request alive through the DatabasePager's staleness checks
+        plod.framePrefetchLastUsed.exchange(databasePager->frameCount);
+
+        auto priority = (cutoff > 0.0) ? priorityScale * (rf / cutoff) : priorityScale;
+        exchange_if_greater(plod.priority, priority);
+
+        auto previousRequestCount = plod.requestCount.fetch_add(1);
+        if (previousRequestCount == 0)
+        {
+            // we are the first request so tell the databasePager about it
+            databasePager->request(ref_ptr<PagedLOD>(&plod));
+            ++numTiles;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+//
+// DatabasePrefetcher
+//
+DatabasePrefetcher::DatabasePrefetcher(ref_ptr<Camera> in_camera, ref_ptr<DatabasePager> in_databasePager, ref_ptr<Node> in_scene) :
+    camera(in_camera),
+    databasePager(in_databasePager),
+    scene(in_scene)
+{
+}
+
+void DatabasePrefetcher::update(const FrameStamp& frameStamp)
+{
+    if (!camera || !databasePager || !scene) return;
+
+    auto view = camera->viewMatrix->transform();
+
+    if (!_hasPrevious)
+    {
+        _previousView = view;
+        _previousTime = frameStamp.time;
+        _hasPrevious = true;
+        return;
+    }
+
+    double deltaTime = std::chrono::duration<double>(frameStamp.time - _previousTime).count();
+
+    // world space eye positions taken from the inverse view matrices
+    auto eye = inverse(view) * dvec3(0.0, 0.0, 0.0);
+    auto previousEye = inverse(_previousView) * dvec3(0.0, 0.0, 0.0);
+
+    _previousView = view;
+    _previousTime = frameStamp.time;
+
+    if (deltaTime <= 0.0) return;
+
+    auto lookAheadDelta = (eye - previousEye) * (lookAheadTime / deltaTime);
+    if (length2(lookAheadDelta) == 0.0) return;
+
+    // the camera translated by lookAheadDelta in world space, keeping the current orientation
+    dmat4 predictedView = view * translate(-lookAheadDelta);
+
+    PrefetchPagedLOD prefetch(camera, databasePager, predictedView, loadLevels);
+    prefetch.priorityScale = priorityScale;
+    scene->accept(prefetch);
+}
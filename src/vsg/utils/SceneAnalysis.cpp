@@ -0,0 +1,276 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Command.h>
+#include <vsg/io/Options.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/nodes/InstrumentationNode.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/nodes/PagedLOD.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/Transform.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/utils/SceneAnalysis.h>
+
+#include <algorithm>
+#include <ostream>
+
+using namespace vsg;
+
+// heuristic per node record cost weights in arbitrary units, roughly proportional to the work each node
+// type does in RecordTraversal - matrix push/pop and push constants for transforms, bounding sphere tests
+// for cull nodes, state stack pushes for state commands and command buffer writes for draw commands.
+namespace
+{
+    constexpr double cost_node = 1.0;
+    constexpr double cost_child = 0.5;
+    constexpr double cost_transform = 6.0;
+    constexpr double cost_cull = 3.0;
+    constexpr double cost_lod = 4.0;
+    constexpr double cost_pagedLOD = 6.0;
+    constexpr double cost_stateGroup = 2.0;
+    constexpr double cost_stateCommand = 4.0;
+    constexpr double cost_command = 8.0;
+    constexpr double cost_draw = 10.0;
+    constexpr double cost_geometry = 12.0;
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// SceneAnalysis
+//
+SceneAnalysis::SceneAnalysis()
+{
+}
+
+void SceneAnalysis::applyNode(const Object& object, double selfCost)
+{
+    ++numNodes;
+    ++typeCounts[object.className()];
+    totalCost += selfCost;
+
+    double savedCost = _currentCost;
+    _currentCost = selfCost;
+
+    object.traverse(*this);
+
+    double subtreeCost = _currentCost;
+    if (collectSubgraphCosts)
+    {
+        if (auto node = object.cast<Node>()) subgraphCosts[node] = subtreeCost;
+    }
+
+    _currentCost = savedCost + subtreeCost;
+}
+
+void SceneAnalysis::apply(const Object& object)
+{
+    applyNode(object, cost_node);
+}
+
+void SceneAnalysis::apply(const Node& node)
+{
+    applyNode(node, cost_node);
+}
+
+void SceneAnalysis::apply(const Group& group)
+{
+    ++numGroups;
+    totalGroupChildren += group.children.size();
+    applyNode(group, cost_node + cost_child * static_cast<double>(group.children.size()));
+}
+
+void SceneAnalysis::apply(const StateGroup& stateGroup)
+{
+    ++numGroups;
+    ++numStateGroups;
+    totalGroupChildren += stateGroup.children.size();
+
+    // stateCommands are visited by the traversal so their counts and costs are attributed by apply(const StateCommand&)
+    applyNode(stateGroup, cost_stateGroup + cost_child * static_cast<double>(stateGroup.children.size()));
+}
+
+void SceneAnalysis::apply(const Transform& transform)
+{
+    ++numGroups;
+    ++numTransforms;
+    totalGroupChildren += transform.children.size();
+
+    if (_transformDepth >= transformDepthHistogram.size()) transformDepthHistogram.resize(_transformDepth + 1, 0);
+    ++transformDepthHistogram[_transformDepth];
+
+    ++_transformDepth;
+    applyNode(transform, cost_transform + cost_child * static_cast<double>(transform.children.size()));
+    --_transformDepth;
+}
+
+void SceneAnalysis::apply(const CullNode& cullNode)
+{
+    ++numCullNodes;
+    applyNode(cullNode, cost_cull);
+}
+
+void SceneAnalysis::apply(const CullGroup& cullGroup)
+{
+    ++numGroups;
+    ++numCullNodes;
+    totalGroupChildren += cullGroup.children.size();
+    applyNode(cullGroup, cost_cull + cost_child * static_cast<double>(cullGroup.children.size()));
+}
+
+void SceneAnalysis::apply(const LOD& lod)
+{
+    applyNode(lod, cost_lod);
+}
+
+void SceneAnalysis::apply(const PagedLOD& plod)
+{
+    applyNode(plod, cost_pagedLOD);
+}
+
+void SceneAnalysis::apply(const Command& command)
+{
+    ++numCommands;
+    applyNode(command, cost_command);
+}
+
+void SceneAnalysis::apply(const StateCommand& stateCommand)
+{
+    ++numStateCommands;
+    applyNode(stateCommand, cost_stateCommand);
+}
+
+void SceneAnalysis::apply(const Geometry& geometry)
+{
+    ++numCommands;
+    applyNode(geometry, cost_geometry);
+}
+
+void SceneAnalysis::apply(const VertexDraw& vd)
+{
+    ++numCommands;
+    applyNode(vd, cost_draw);
+}
+
+void SceneAnalysis::apply(const VertexIndexDraw& vid)
+{
+    ++numCommands;
+    applyNode(vid, cost_draw);
+}
+
+void SceneAnalysis::report(std::ostream& out, size_t topK) const
+{
+    out << "SceneAnalysis::report()\n";
+    out << "    nodes = " << numNodes << ", groups = " << numGroups << ", transforms = " << numTransforms
+        << ", stateGroups = " << numStateGroups << ", cullNodes = " << numCullNodes << "\n";
+    out << "    commands = " << numCommands << ", stateCommands = " << numStateCommands << "\n";
+    out << "    average children per group = " << averageChildrenPerGroup() << "\n";
+    out << "    estimated record cost = " << totalCost << "\n";
+
+    out << "    node counts by type:\n";
+    for (auto& [typeName, count] : typeCounts)
+    {
+        out << "        " << typeName << " = " << count << "\n";
+    }
+
+    out << "    transform depth distribution:\n";
+    for (size_t depth = 0; depth < transformDepthHistogram.size(); ++depth)
+    {
+        out << "        depth " << depth << " = " << transformDepthHistogram[depth] << "\n";
+    }
+
+    if (!subgraphCosts.empty())
+    {
+        std::vector<std::pair<double, const Node*>> ranked;
+        ranked.reserve(subgraphCosts.size());
+        for (auto& [node, cost] : subgraphCosts) ranked.emplace_back(cost, node);
+        std::sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+        out << "    most expensive subgraphs:\n";
+        for (size_t i = 0; i < ranked.size() && i < topK; ++i)
+        {
+            out << "        " << ranked[i].second->className() << " cost = " << ranked[i].first
+                << " (" << (totalCost > 0.0 ? 100.0 * ranked[i].first / totalCost : 0.0) << "%)\n";
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// InstrumentExpensiveSubgraphs
+//
+InstrumentExpensiveSubgraphs::InstrumentExpensiveSubgraphs()
+{
+}
+
+void InstrumentExpensiveSubgraphs::instrument(ref_ptr<Node> scene)
+{
+    insertedNodes.clear();
+    _selected.clear();
+
+    if (!scene) return;
+
+    SceneAnalysis analysis;
+    scene->accept(analysis);
+
+    std::vector<std::pair<double, const Node*>> candidates;
+    candidates.reserve(analysis.subgraphCosts.size());
+    for (auto& [node, cost] : analysis.subgraphCosts)
+    {
+        if (node == scene.get()) continue;
+
+        // near root nodes dominate by construction, skip them so topK slots go to the interesting subgraphs
+        if (analysis.totalCost > 0.0 && cost > analysis.totalCost * maxCostFraction) continue;
+
+        candidates.emplace_back(cost, node);
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    for (size_t i = 0; i < candidates.size() && _selected.size() < topK; ++i)
+    {
+        _selected.insert(candidates[i].second);
+    }
+
+    scene->accept(*this);
+}
+
+ref_ptr<Node> InstrumentExpensiveSubgraphs::wrapIfSelected(ref_ptr<Node> node)
+{
+    if (!node || _selected.count(node.get()) == 0) return {};
+
+    auto instrumentationNode = InstrumentationNode::create(node);
+    instrumentationNode->setName(std::string(node->className()) + "_" + std::to_string(insertedNodes.size()));
+    instrumentationNode->setLevel(level);
+    insertedNodes.push_back(instrumentationNode);
+    return instrumentationNode;
+}
+
+void InstrumentExpensiveSubgraphs::apply(Group& group)
+{
+    for (auto& child : group.children)
+    {
+        if (auto wrapped = wrapIfSelected(child))
+        {
+            // selected subgraphs are wrapped and not descended into, so nested selections resolve to the outermost
+            child = wrapped;
+        }
+        else if (child)
+        {
+            child->accept(*this);
+        }
+    }
+}
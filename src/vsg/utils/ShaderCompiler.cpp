@@ -26,6 +26,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #endif
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 
 #ifndef VK_API_VERSION_MAJOR
@@ -54,6 +55,63 @@ static void s_finalizeProcess()
     }
 }
 
+namespace
+{
+    // FNV-1a 64bit hash used to key the on-disk SPIR-V cache
+    inline uint64_t hashBytes(uint64_t hash, const void* ptr, size_t size)
+    {
+        auto data = static_cast<const uint8_t*>(ptr);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash = (hash ^ data[i]) * 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    inline uint64_t hashString(uint64_t hash, const std::string& str)
+    {
+        return hashBytes(hash, str.data(), str.size());
+    }
+
+    template<typename T>
+    inline uint64_t hashValue(uint64_t hash, T value)
+    {
+        return hashBytes(hash, &value, sizeof(T));
+    }
+
+    vsg::Path shaderCacheFilename(const vsg::Path& cacheDirectory, uint64_t hash, size_t index)
+    {
+        std::ostringstream str;
+        str << std::hex << std::setw(16) << std::setfill('0') << hash << "_" << std::dec << index << ".spv";
+        return cacheDirectory / str.str();
+    }
+
+    bool readCachedSpirv(vsg::ShaderModule::SPIRV& code, const vsg::Path& filename)
+    {
+        std::ifstream fin(filename, std::ios::ate | std::ios::binary);
+        if (!fin.is_open()) return false;
+
+        size_t fileSize = fin.tellg();
+        if (fileSize == 0 || (fileSize % sizeof(vsg::ShaderModule::SPIRV::value_type)) != 0) return false;
+
+        code.resize(fileSize / sizeof(vsg::ShaderModule::SPIRV::value_type));
+
+        fin.seekg(0);
+        fin.read(reinterpret_cast<char*>(code.data()), fileSize);
+
+        return fin.good();
+    }
+
+    bool writeCachedSpirv(const vsg::ShaderModule::SPIRV& code, const vsg::Path& filename)
+    {
+        std::ofstream fout(filename, std::ios::binary);
+        if (!fout.is_open()) return false;
+
+        fout.write(reinterpret_cast<const char*>(code.data()), code.size() * sizeof(vsg::ShaderModule::SPIRV::value_type));
+
+        return fout.good();
+    }
+} // namespace
 #endif
 
 std::string debugFormatShaderSource(const std::string& source)
@@ -121,6 +179,67 @@ bool ShaderCompiler::compile(ShaderStages& shaders, const std::vector<std::strin
         return "";
     };
 
+    // prepare the final shader sources up front so they can be hashed for the on-disk SPIR-V cache
+    // as well as handed to glslang on a cache miss.
+    std::vector<std::string> finalShaderSources;
+    finalShaderSources.reserve(shaders.size());
+
+    auto version = vsgGetVersion();
+    uint64_t cacheHash = hashValue(0xcbf29ce484222325ULL, version);
+
+    for (auto& vsg_shader : shaders)
+    {
+        auto settings = vsg_shader->module->hints ? vsg_shader->module->hints : defaults;
+
+        std::string finalShaderSource = vsg::insertIncludes(vsg_shader->module->source, options);
+
+        std::vector<std::string> combinedDefines(defines);
+        for (auto& define : settings->defines) combinedDefines.push_back(define);
+        if (!combinedDefines.empty()) finalShaderSource = combineSourceAndDefines(finalShaderSource, combinedDefines);
+
+        // the compiled SPIR-V depends upon the stage, the compile settings and the preprocessed source,
+        // and as the stages are linked as a single program all of them contribute to the one cache key.
+        cacheHash = hashValue(cacheHash, vsg_shader->stage);
+        cacheHash = hashValue(cacheHash, settings->vulkanVersion);
+        cacheHash = hashValue(cacheHash, settings->clientInputVersion);
+        cacheHash = hashValue(cacheHash, settings->language);
+        cacheHash = hashValue(cacheHash, settings->defaultVersion);
+        cacheHash = hashValue(cacheHash, settings->target);
+        cacheHash = hashValue(cacheHash, settings->forwardCompatible);
+        cacheHash = hashValue(cacheHash, settings->generateDebugInfo);
+        cacheHash = hashString(cacheHash, finalShaderSource);
+
+        finalShaderSources.push_back(std::move(finalShaderSource));
+    }
+
+    Path cacheDirectory = options ? options->shaderCacheDirectory : Path();
+    if (cacheDirectory)
+    {
+        // check the cache for previously compiled SPIR-V for all the stages before invoking glslang.
+        std::vector<ShaderModule::SPIRV> cachedCode(shaders.size());
+        bool allCached = true;
+        for (size_t i = 0; i < shaders.size(); ++i)
+        {
+            if (!readCachedSpirv(cachedCode[i], shaderCacheFilename(cacheDirectory, cacheHash, i)))
+            {
+                allCached = false;
+                break;
+            }
+        }
+
+        if (allCached)
+        {
+            for (size_t i = 0; i < shaders.size(); ++i)
+            {
+                shaders[i]->module->code.swap(cachedCode[i]);
+            }
+
+            debug("ShaderCompiler::compile() loaded ", shaders.size(), " shader stage(s) from cache, hash = ", cacheHash);
+
+            return true;
+        }
+    }
+
     using StageShaderMap = std::map<EShLanguage, ref_ptr<ShaderStage>>;
     using TShaders = std::list<std::unique_ptr<glslang::TShader>>;
     TShaders tshaders;
@@ -130,6 +249,7 @@ bool ShaderCompiler::compile(ShaderStages& shaders, const std::vector<std::strin
     StageShaderMap stageShaderMap;
     std::unique_ptr<glslang::TProgram> program(new glslang::TProgram);
 
+    size_t shaderIndex = 0;
     for (auto& vsg_shader : shaders)
     {
         EShLanguage envStage = EShLangCount;
@@ -202,11 +322,7 @@ bool ShaderCompiler::compile(ShaderStages& shaders, const std::vector<std::strin
         shader->setEnvClient(glslang::EShClientVulkan, targetClientVersion);
         shader->setEnvTarget(glslang::EShTargetSpv, targetLanguageVersion);
 
-        std::string finalShaderSource = vsg::insertIncludes(vsg_shader->module->source, options);
-
-        std::vector<std::string> combinedDefines(defines);
-        for (auto& define : settings->defines) combinedDefines.push_back(define);
-        if (!combinedDefines.empty()) finalShaderSource = combineSourceAndDefines(finalShaderSource, combinedDefines);
+        const std::string& finalShaderSource = finalShaderSources[shaderIndex++];
 
         const char* str = finalShaderSource.c_str();
         shader->setStrings(&str, 1);
@@ -288,6 +404,19 @@ bool ShaderCompiler::compile(ShaderStages& shaders, const std::vector<std::strin
         }
     }
 
+    if (cacheDirectory)
+    {
+        // populate the cache with the newly compiled SPIR-V, quietly skipping on any file errors.
+        vsg::makeDirectory(cacheDirectory);
+        for (size_t i = 0; i < shaders.size(); ++i)
+        {
+            if (!shaders[i]->module->code.empty())
+            {
+                writeCachedSpirv(shaders[i]->module->code, shaderCacheFilename(cacheDirectory, cacheHash, i));
+            }
+        }
+    }
+
     return true;
 }
 #else
@@ -28,6 +28,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/utils/ShaderSet.h>
 #include <vsg/vk/Context.h>
 
+#include <algorithm>
+
 #include "shaders/flat_ShaderSet.cpp"
 #include "shaders/pbr_ShaderSet.cpp"
 #include "shaders/phong_ShaderSet.cpp"
@@ -64,7 +66,8 @@ int DescriptorBinding::compare(const DescriptorBinding& rhs) const
     if ((result = compare_value(descriptorType, rhs.descriptorType))) return result;
     if ((result = compare_value(descriptorCount, rhs.descriptorCount))) return result;
     if ((result = compare_value(stageFlags, rhs.stageFlags))) return result;
-    return compare_pointer(data, rhs.data);
+    if ((result = compare_pointer(data, rhs.data))) return result;
+    return compare_value(bindingFlags, rhs.bindingFlags);
 }
 
 int PushConstantRange::compare(const PushConstantRange& rhs) const
@@ -78,6 +81,20 @@ int PushConstantRange::compare(const PushConstantRange& rhs) const
     return compare_region(range, range, rhs.range);
 }
 
+int SpecializationConstantBinding::compare(const SpecializationConstantBinding& rhs) const
+{
+    if (name < rhs.name) return -1;
+    if (name > rhs.name) return 1;
+
+    if (define < rhs.define) return -1;
+    if (define > rhs.define) return 1;
+
+    int result = compare_value(constantID, rhs.constantID);
+    if (result) return result;
+
+    return compare_pointer(defaultValue, rhs.defaultValue);
+}
+
 int DefinesArrayState::compare(const DefinesArrayState& rhs) const
 {
     int result = compare_container(defines, rhs.defines);
@@ -186,11 +203,21 @@ void ShaderSet::addDescriptorBinding(const std::string& name, const std::string&
     descriptorBindings.push_back(DescriptorBinding{name, define, set, binding, descriptorType, descriptorCount, stageFlags, data});
 }
 
+void ShaderSet::addDescriptorBinding(const std::string& name, const std::string& define, uint32_t set, uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags, ref_ptr<Data> data, VkDescriptorBindingFlags bindingFlags)
+{
+    descriptorBindings.push_back(DescriptorBinding{name, define, set, binding, descriptorType, descriptorCount, stageFlags, data, bindingFlags});
+}
+
 void ShaderSet::addPushConstantRange(const std::string& name, const std::string& define, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size)
 {
     pushConstantRanges.push_back(vsg::PushConstantRange{name, define, VkPushConstantRange{stageFlags, offset, size}});
 }
 
+void ShaderSet::addSpecializationConstantBinding(const std::string& name, const std::string& define, uint32_t constantID, ref_ptr<Data> defaultValue)
+{
+    specializationConstantBindings.push_back(SpecializationConstantBinding{name, define, constantID, defaultValue});
+}
+
 const AttributeBinding& ShaderSet::getAttributeBinding(const std::string& name) const
 {
     for (auto& binding : attributeBindings)
@@ -227,6 +254,24 @@ const DescriptorBinding& ShaderSet::getDescriptorBinding(const std::string& name
     return _nullDescriptorBinding;
 }
 
+SpecializationConstantBinding& ShaderSet::getSpecializationConstantBinding(const std::string& name)
+{
+    for (auto& binding : specializationConstantBindings)
+    {
+        if (binding.name == name) return binding;
+    }
+    return _nullSpecializationConstantBinding;
+}
+
+const SpecializationConstantBinding& ShaderSet::getSpecializationConstantBinding(const std::string& name) const
+{
+    for (auto& binding : specializationConstantBindings)
+    {
+        if (binding.name == name) return binding;
+    }
+    return _nullSpecializationConstantBinding;
+}
+
 ref_ptr<ArrayState> ShaderSet::getSuitableArrayState(const std::set<std::string>& defines) const
 {
     // not all defines are relevant to the provided ArrayState
@@ -288,6 +333,58 @@ ShaderStages ShaderSet::getShaderStages(ref_ptr<ShaderCompileSettings> scs)
     return new_stages;
 }
 
+std::vector<std::set<std::string>> ShaderSet::enumerateDefineCombinations(size_t maxCombinations) const
+{
+    // collect the distinct defines declared by the bindings and optionalDefines
+    std::vector<std::string> defines;
+    auto addDefine = [&defines](const std::string& define) {
+        if (!define.empty() && std::find(defines.begin(), defines.end(), define) == defines.end()) defines.push_back(define);
+    };
+    for (const auto& binding : attributeBindings) addDefine(binding.define);
+    for (const auto& binding : descriptorBindings) addDefine(binding.define);
+    for (const auto& define : optionalDefines) addDefine(define);
+
+    // bound the combinatorial space
+    const size_t maxDefines = 16;
+    if (defines.size() > maxDefines) defines.resize(maxDefines);
+
+    // enumerate subsets in order of increasing number of enabled defines so that simpler,
+    // more likely variants are generated first when capped by maxCombinations
+    std::vector<std::set<std::string>> combinations;
+    auto numDefines = defines.size();
+    for (size_t k = 0; k <= numDefines && combinations.size() < maxCombinations; ++k)
+    {
+        std::vector<bool> selector(numDefines, false);
+        std::fill(selector.begin(), selector.begin() + k, true);
+        do
+        {
+            std::set<std::string> combination;
+            for (size_t i = 0; i < numDefines; ++i)
+            {
+                if (selector[i]) combination.insert(defines[i]);
+            }
+            combinations.push_back(std::move(combination));
+            if (combinations.size() >= maxCombinations) break;
+        } while (std::prev_permutation(selector.begin(), selector.end()));
+    }
+
+    return combinations;
+}
+
+ref_ptr<GraphicsPipeline> ShaderSet::getOrAssignBasePipeline(ref_ptr<GraphicsPipeline> pipeline)
+{
+    std::scoped_lock<std::mutex> lock(mutex);
+
+    ref_ptr<GraphicsPipeline> base = _basePipeline;
+    if (base && base != pipeline) return base;
+
+    // adopt the passed in pipeline as the base that later variants derive from
+    pipeline->flags |= VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT;
+    _basePipeline = pipeline;
+
+    return {};
+}
+
 int ShaderSet::compare(const Object& rhs_object) const
 {
     int result = Object::compare(rhs_object);
@@ -298,6 +395,7 @@ int ShaderSet::compare(const Object& rhs_object) const
     if ((result = compare_container(attributeBindings, rhs.attributeBindings))) return result;
     if ((result = compare_container(descriptorBindings, rhs.descriptorBindings))) return result;
     if ((result = compare_container(pushConstantRanges, rhs.pushConstantRanges))) return result;
+    if ((result = compare_container(specializationConstantBindings, rhs.specializationConstantBindings))) return result;
     if ((result = compare_container(definesArrayStates, rhs.definesArrayStates))) return result;
     if ((result = compare_container(optionalDefines, rhs.optionalDefines))) return result;
     return compare_pointer_container(defaultGraphicsPipelineStates, rhs.defaultGraphicsPipelineStates);
@@ -337,6 +435,11 @@ void ShaderSet::read(Input& input)
         input.read("descriptorCount", binding.descriptorCount);
         input.readValue<uint32_t>("stageFlags", binding.stageFlags);
         input.readObject("data", binding.data);
+
+        if (input.version_greater_equal(1, 1, 5))
+        {
+            input.readValue<uint32_t>("bindingFlags", binding.bindingFlags);
+        }
     }
 
     auto num_pushConstantRanges = input.readValue<uint32_t>("pushConstantRanges");
@@ -350,6 +453,19 @@ void ShaderSet::read(Input& input)
         input.read("size", pcr.range.size);
     }
 
+    if (input.version_greater_equal(1, 1, 5))
+    {
+        auto num_specializationConstantBindings = input.readValue<uint32_t>("specializationConstantBindings");
+        specializationConstantBindings.resize(num_specializationConstantBindings);
+        for (auto& scb : specializationConstantBindings)
+        {
+            input.read("name", scb.name);
+            input.read("define", scb.define);
+            input.read("constantID", scb.constantID);
+            input.readObject("defaultValue", scb.defaultValue);
+        }
+    }
+
     auto num_definesArrayStates = input.readValue<uint32_t>("definesArrayStates");
     definesArrayStates.resize(num_definesArrayStates);
     for (auto& das : definesArrayStates)
@@ -415,6 +531,11 @@ void ShaderSet::write(Output& output) const
         output.write("descriptorCount", binding.descriptorCount);
         output.writeValue<uint32_t>("stageFlags", binding.stageFlags);
         output.writeObject("data", binding.data);
+
+        if (output.version_greater_equal(1, 1, 5))
+        {
+            output.writeValue<uint32_t>("bindingFlags", binding.bindingFlags);
+        }
     }
 
     output.writeValue<uint32_t>("pushConstantRanges", pushConstantRanges.size());
@@ -427,6 +548,18 @@ void ShaderSet::write(Output& output) const
         output.write("size", pcr.range.size);
     }
 
+    if (output.version_greater_equal(1, 1, 5))
+    {
+        output.writeValue<uint32_t>("specializationConstantBindings", specializationConstantBindings.size());
+        for (auto& scb : specializationConstantBindings)
+        {
+            output.write("name", scb.name);
+            output.write("define", scb.define);
+            output.write("constantID", scb.constantID);
+            output.writeObject("defaultValue", scb.defaultValue);
+        }
+    }
+
     output.writeValue<uint32_t>("definesArrayStates", definesArrayStates.size());
     for (auto& das : definesArrayStates)
     {
@@ -532,6 +665,8 @@ ref_ptr<DescriptorSetLayout> ShaderSet::createDescriptorSetLayout(const std::set
     }
 
     DescriptorSetLayoutBindings bindings;
+    std::vector<VkDescriptorBindingFlags> bindingFlags;
+    bool bindingFlagsRequired = false;
     for (auto& binding : descriptorBindings)
     {
         if (binding.set == set)
@@ -539,11 +674,15 @@ ref_ptr<DescriptorSetLayout> ShaderSet::createDescriptorSetLayout(const std::set
             if (binding.define.empty() || defines.count(binding.define) > 0)
             {
                 bindings.push_back(VkDescriptorSetLayoutBinding{binding.binding, binding.descriptorType, binding.descriptorCount, binding.stageFlags, nullptr});
+                bindingFlags.push_back(binding.bindingFlags);
+                if (binding.bindingFlags != 0) bindingFlagsRequired = true;
             }
         }
     }
 
-    return DescriptorSetLayout::create(bindings);
+    auto dsl = DescriptorSetLayout::create(bindings);
+    if (bindingFlagsRequired) dsl->bindingFlags = bindingFlags;
+    return dsl;
 }
 
 bool ShaderSet::compatiblePipelineLayout(const PipelineLayout& layout, const std::set<std::string>& defines) const
@@ -0,0 +1,95 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/utils/GraphicsPipelineConfigurator.h>
+#include <vsg/utils/ShaderSetWarmup.h>
+
+using namespace vsg;
+
+ShaderSetWarmup::ShaderSetWarmup(ref_ptr<CompileManager> in_compileManager, ref_ptr<ActivityStatus> in_status) :
+    compileManager(in_compileManager),
+    status(in_status)
+{
+}
+
+void ShaderSetWarmup::add(ref_ptr<ShaderSet> shaderSet)
+{
+    if (!shaderSet) return;
+
+    std::scoped_lock lock(_mutex);
+    _shaderSets.push_back(shaderSet);
+}
+
+void ShaderSetWarmup::schedule(ref_ptr<OperationThreads> operationThreads)
+{
+    if (operationThreads) operationThreads->add(ref_ptr<Operation>(this));
+}
+
+void ShaderSetWarmup::run()
+{
+    if (!compileManager) return;
+
+    std::vector<ref_ptr<ShaderSet>> shaderSets;
+    {
+        std::scoped_lock lock(_mutex);
+        shaderSets.swap(_shaderSets);
+    }
+
+    for (auto& shaderSet : shaderSets)
+    {
+        if (status && !status->active()) return;
+        warmup(shaderSet);
+    }
+}
+
+void ShaderSetWarmup::warmup(ref_ptr<ShaderSet> shaderSet)
+{
+    auto combinations = shaderSet->enumerateDefineCombinations(maxVariantsPerShaderSet);
+
+    for (auto& combination : combinations)
+    {
+        if (status && !status->active()) return;
+
+        auto graphicsPipelineConfig = GraphicsPipelineConfigurator::create(shaderSet);
+
+        // enable the vertex arrays for attribute bindings active in this variant so the pipeline's
+        // vertex input state matches the inputs the shader variant consumes
+        for (const auto& binding : shaderSet->attributeBindings)
+        {
+            if (binding.define.empty() || combination.count(binding.define) != 0)
+            {
+                uint32_t stride = binding.data ? binding.data->stride() : 0;
+                graphicsPipelineConfig->enableArray(binding.name, VK_VERTEX_INPUT_RATE_VERTEX, stride, binding.format);
+            }
+        }
+
+        // remaining defines, descriptor related ones included, are consumed by the shader compile
+        // and by createPipelineLayout() when init() sets up the pipeline
+        for (const auto& define : combination)
+        {
+            graphicsPipelineConfig->shaderHints->defines.insert(define);
+        }
+
+        graphicsPipelineConfig->init();
+
+        if (graphicsPipelineConfig->bindGraphicsPipeline)
+        {
+            auto result = compileManager->compile(graphicsPipelineConfig->bindGraphicsPipeline);
+            if (!result)
+            {
+                debug("ShaderSetWarmup::warmup() unable to compile pipeline variant for ", shaderSet->className());
+            }
+        }
+    }
+}
@@ -1,10 +1,102 @@
 
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
+#include <vsg/state/DescriptorSetLayout.h>
+#include <vsg/state/Sampler.h>
+#include <vsg/state/ShaderStage.h>
 #include <vsg/utils/SharedObjects.h>
 
+#include <cstring>
+
 using namespace vsg;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// HashVisitor
+//
+void HashVisitor::hashBytes(const void* data, std::size_t size)
+{
+    auto ptr = static_cast<const uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= ptr[i];
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+void HashVisitor::hashString(const std::string& str)
+{
+    hashBytes(str.data(), str.size());
+}
+
+void HashVisitor::apply(const Object& object)
+{
+    auto name = object.className();
+    hashBytes(name, std::strlen(name));
+
+    // frequently deduplicated leaf types that the visitor can't dispatch directly are hashed here by the
+    // settings their compare() implementations treat as the identity
+    if (auto sampler = object.cast<Sampler>())
+    {
+        hashBytes(&sampler->flags, sizeof(sampler->flags));
+        hashBytes(&sampler->magFilter, sizeof(sampler->magFilter));
+        hashBytes(&sampler->minFilter, sizeof(sampler->minFilter));
+        hashBytes(&sampler->mipmapMode, sizeof(sampler->mipmapMode));
+        hashBytes(&sampler->addressModeU, sizeof(sampler->addressModeU));
+        hashBytes(&sampler->addressModeV, sizeof(sampler->addressModeV));
+        hashBytes(&sampler->addressModeW, sizeof(sampler->addressModeW));
+        hashBytes(&sampler->mipLodBias, sizeof(sampler->mipLodBias));
+        hashBytes(&sampler->anisotropyEnable, sizeof(sampler->anisotropyEnable));
+        hashBytes(&sampler->maxAnisotropy, sizeof(sampler->maxAnisotropy));
+        hashBytes(&sampler->compareEnable, sizeof(sampler->compareEnable));
+        hashBytes(&sampler->compareOp, sizeof(sampler->compareOp));
+        hashBytes(&sampler->minLod, sizeof(sampler->minLod));
+        hashBytes(&sampler->maxLod, sizeof(sampler->maxLod));
+        hashBytes(&sampler->borderColor, sizeof(sampler->borderColor));
+        hashBytes(&sampler->unnormalizedCoordinates, sizeof(sampler->unnormalizedCoordinates));
+    }
+    else if (auto descriptorSetLayout = object.cast<DescriptorSetLayout>())
+    {
+        for (auto& binding : descriptorSetLayout->bindings)
+        {
+            hashBytes(&binding.binding, sizeof(binding.binding));
+            hashBytes(&binding.descriptorType, sizeof(binding.descriptorType));
+            hashBytes(&binding.descriptorCount, sizeof(binding.descriptorCount));
+            hashBytes(&binding.stageFlags, sizeof(binding.stageFlags));
+        }
+    }
+}
+
+void HashVisitor::apply(const Data& data)
+{
+    auto name = data.className();
+    hashBytes(name, std::strlen(name));
+
+    // reuse the Data's cached whole-content hash, computed once per object and revalidated
+    // against its ModifiedCount
+    auto contentHash = data.contentHash();
+    hashBytes(&contentHash, sizeof(contentHash));
+}
+
+void HashVisitor::apply(const ShaderStage& shaderStage)
+{
+    auto name = shaderStage.className();
+    hashBytes(name, std::strlen(name));
+
+    hashBytes(&shaderStage.stage, sizeof(shaderStage.stage));
+    hashString(shaderStage.entryPointName);
+
+    if (shaderStage.module)
+    {
+        hashString(shaderStage.module->source);
+        if (!shaderStage.module->code.empty()) hashBytes(shaderStage.module->code.data(), shaderStage.module->code.size() * sizeof(uint32_t));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// SharedObjects
+//
 SharedObjects::SharedObjects() :
     suitableForSharing(SuitableForSharing::create())
 {
@@ -14,6 +106,27 @@ SharedObjects::~SharedObjects()
 {
 }
 
+SharedObjects::Bucket& SharedObjects::_bucket(const Object& object) const
+{
+    // LoadedObjects are routed by filename so that share(), contains(), add() and remove() agree on the
+    // bucket regardless of whether the entry has been loaded yet
+    uint64_t hash;
+    if (auto loadedObject = object.cast<LoadedObject>())
+    {
+        HashVisitor hv;
+        hv.hashString(loadedObject->filename.string());
+        hash = hv.hash;
+    }
+    else
+    {
+        HashVisitor hv;
+        object.accept(hv);
+        hash = hv.hash;
+    }
+
+    return _buckets[hash % numBuckets];
+}
+
 bool SharedObjects::suitable(const Path& filename) const
 {
     return excludedExtensions.count(vsg::lowerCaseFileExtension(filename)) == 0;
@@ -21,39 +134,43 @@ bool SharedObjects::suitable(const Path& filename) const
 
 bool SharedObjects::contains(const Path& filename, ref_ptr<const Options> options) const
 {
-    std::scoped_lock<std::recursive_mutex> lock(_mutex);
+    auto key = LoadedObject::create(filename, options);
+
+    auto& bucket = _bucket(*key);
+    std::scoped_lock<std::mutex> lock(bucket.mutex);
 
     auto loadedObject_id = std::type_index(typeid(LoadedObject));
-    auto itr = _sharedObjects.find(loadedObject_id);
-    if (itr == _sharedObjects.end()) return false;
+    auto itr = bucket.sharedObjects.find(loadedObject_id);
+    if (itr == bucket.sharedObjects.end()) return false;
 
     auto& loadedObjects = itr->second;
-    auto key = LoadedObject::create(filename, options);
     return loadedObjects.find(key) != loadedObjects.end();
 }
 
 void SharedObjects::add(ref_ptr<Object> object, const Path& filename, ref_ptr<const Options> options)
 {
-    std::scoped_lock<std::recursive_mutex> lock(_mutex);
+    auto key = LoadedObject::create(filename, options, object);
 
-    auto loadedObject_id = std::type_index(typeid(LoadedObject));
-    auto& loadedObjects = _sharedObjects[loadedObject_id];
+    auto& bucket = _bucket(*key);
+    std::scoped_lock<std::mutex> lock(bucket.mutex);
 
-    auto key = LoadedObject::create(filename, options, object);
+    auto loadedObject_id = std::type_index(typeid(LoadedObject));
+    auto& loadedObjects = bucket.sharedObjects[loadedObject_id];
     loadedObjects.insert(key);
 }
 
 bool SharedObjects::remove(const Path& filename, ref_ptr<const Options> options)
 {
-    std::scoped_lock<std::recursive_mutex> lock(_mutex);
+    auto key = LoadedObject::create(filename, options);
+
+    auto& bucket = _bucket(*key);
+    std::scoped_lock<std::mutex> lock(bucket.mutex);
 
     auto loadedObject_id = std::type_index(typeid(LoadedObject));
-    auto itr = _sharedObjects.find(loadedObject_id);
-    if (itr == _sharedObjects.end()) return false;
+    auto itr = bucket.sharedObjects.find(loadedObject_id);
+    if (itr == bucket.sharedObjects.end()) return false;
 
     auto& loadedObjects = itr->second;
-
-    auto key = LoadedObject::create(filename, options);
     if (auto lo_itr = loadedObjects.find(key); lo_itr != loadedObjects.end())
     {
         loadedObjects.erase(lo_itr);
@@ -69,24 +186,32 @@ void SharedObjects::clear()
 {
     std::scoped_lock<std::recursive_mutex> lock(_mutex);
     _defaults.clear();
-    _sharedObjects.clear();
+
+    for (auto& bucket : _buckets)
+    {
+        std::scoped_lock<std::mutex> bucketLock(bucket.mutex);
+        bucket.sharedObjects.clear();
+    }
 }
 
 void SharedObjects::prune()
 {
+    // pruning needs a consistent view across all the buckets, so hold every bucket lock for the duration
     std::scoped_lock<std::recursive_mutex> lock(_mutex);
+    for (auto& bucket : _buckets) bucket.mutex.lock();
 
     auto loadedObject_id = std::type_index(typeid(LoadedObject));
 
     // record observer pointers for each LoadedObject object so we can clear them to prevent local references keeping them from being pruned
-    auto& loadedObjects = _sharedObjects[loadedObject_id];
-    std::vector<observer_ptr<Object>> observedLoadedObjects(loadedObjects.size());
-    auto observedLoadedObject_itr = observedLoadedObjects.begin();
-    for (auto& object : loadedObjects)
+    std::vector<observer_ptr<Object>> observedLoadedObjects;
+    for (auto& bucket : _buckets)
     {
-        auto& loadedObject = static_cast<LoadedObject&>(*object);
-        *(observedLoadedObject_itr++) = loadedObject.object;
-        loadedObject.object = {};
+        for (auto& object : bucket.sharedObjects[loadedObject_id])
+        {
+            auto& loadedObject = static_cast<LoadedObject&>(*object);
+            observedLoadedObjects.emplace_back(loadedObject.object);
+            loadedObject.object = {};
+        }
     }
 
     // record observer pointers for each shared default object so we can clear them to prevent local references keeping them from being pruned
@@ -103,40 +228,47 @@ void SharedObjects::prune()
     do
     {
         prunedObjects = false;
-        for (auto itr = _sharedObjects.begin(); itr != _sharedObjects.end(); ++itr)
+        for (auto& bucket : _buckets)
         {
-            auto id = itr->first;
-            if (id != loadedObject_id)
+            for (auto itr = bucket.sharedObjects.begin(); itr != bucket.sharedObjects.end(); ++itr)
             {
-                auto& objects = itr->second;
-                for (auto object_itr = itr->second.begin(); object_itr != itr->second.end();)
+                auto id = itr->first;
+                if (id != loadedObject_id)
                 {
-                    if ((*object_itr)->referenceCount() == 1)
+                    auto& objects = itr->second;
+                    for (auto object_itr = itr->second.begin(); object_itr != itr->second.end();)
                     {
-                        object_itr = objects.erase(object_itr);
-                        prunedObjects = true;
-                    }
-                    else
-                    {
-                        ++object_itr;
+                        if ((*object_itr)->referenceCount() == 1)
+                        {
+                            object_itr = objects.erase(object_itr);
+                            prunedObjects = true;
+                        }
+                        else
+                        {
+                            ++object_itr;
+                        }
                     }
                 }
             }
         }
     } while (prunedObjects);
 
-    observedLoadedObject_itr = observedLoadedObjects.begin();
-    for (auto object_itr = loadedObjects.begin(); object_itr != loadedObjects.end();)
+    auto observedLoadedObject_itr = observedLoadedObjects.begin();
+    for (auto& bucket : _buckets)
     {
-        auto& loadedObject = static_cast<LoadedObject&>(*(*object_itr));
-        loadedObject.object = *(observedLoadedObject_itr++);
-        if (!loadedObject.object)
-        {
-            object_itr = loadedObjects.erase(object_itr);
-        }
-        else
+        auto& loadedObjects = bucket.sharedObjects[loadedObject_id];
+        for (auto object_itr = loadedObjects.begin(); object_itr != loadedObjects.end();)
         {
-            ++object_itr;
+            auto& loadedObject = static_cast<LoadedObject&>(*(*object_itr));
+            loadedObject.object = *(observedLoadedObject_itr++);
+            if (!loadedObject.object)
+            {
+                object_itr = loadedObjects.erase(object_itr);
+            }
+            else
+            {
+                ++object_itr;
+            }
         }
     }
 
@@ -150,11 +282,15 @@ void SharedObjects::prune()
             _defaults[std::type_index(typeid(object))] = defaultObject;
         }
     }
+
+    for (auto& bucket : _buckets) bucket.mutex.unlock();
 }
 
 void SharedObjects::report(std::ostream& out)
 {
     std::scoped_lock<std::recursive_mutex> lock(_mutex);
+    for (auto& bucket : _buckets) bucket.mutex.lock();
+
     out << "SharedObjects::report(..) " << this << std::endl;
     out << "SharedObjects::_defaults " << _defaults.size() << std::endl;
     for (auto& [type, object] : _defaults)
@@ -162,16 +298,23 @@ void SharedObjects::report(std::ostream& out)
         out << "    " << type.name() << ", object = " << object << " " << object->referenceCount() << std::endl;
     }
 
-    out << "SharedObjects::_sharedObjects " << SharedObjects::_sharedObjects.size() << std::endl;
-    for (auto& [type, objects] : _sharedObjects)
+    out << "SharedObjects::_buckets " << numBuckets << std::endl;
+    for (std::size_t i = 0; i < numBuckets; ++i)
     {
-        out << "    " << type.name() << ", objects = " << objects.size() << std::endl;
-        for (auto& object : objects)
+        auto& bucket = _buckets[i];
+        out << "    bucket " << i << ", types = " << bucket.sharedObjects.size() << std::endl;
+        for (auto& [type, objects] : bucket.sharedObjects)
         {
-            out << "        object = " << object << " "
-                << " " << object->referenceCount() << std::endl;
+            out << "        " << type.name() << ", objects = " << objects.size() << std::endl;
+            for (auto& object : objects)
+            {
+                out << "            object = " << object << " "
+                    << " " << object->referenceCount() << std::endl;
+            }
         }
     }
+
+    for (auto& bucket : _buckets) bucket.mutex.unlock();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,275 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/nodes/Transform.h>
+#include <vsg/utils/SphereIntersector.h>
+
+using namespace vsg;
+
+SphereIntersector::SphereIntersector(const dvec3& center, double radius, ref_ptr<ArrayState> initialArrayData) :
+    Inherit(initialArrayData)
+{
+    _sphereStack.push_back(Spheres{dsphere(center, radius)});
+}
+
+SphereIntersector::SphereIntersector(const dsphere& sphere, ref_ptr<ArrayState> initialArrayData) :
+    Inherit(initialArrayData)
+{
+    _sphereStack.push_back(Spheres{sphere});
+}
+
+void SphereIntersector::addSphere(const dsphere& sphere)
+{
+    _sphereStack.front().push_back(sphere);
+}
+
+SphereIntersector::Intersection::Intersection(const dvec3& in_localIntersection, const dvec3& in_worldIntersection, double in_distance, const dmat4& in_localToWorld, const NodePath& in_nodePath, const DataList& in_arrays, const std::vector<uint32_t>& in_indices, uint32_t in_instanceIndex, uint32_t in_sphereIndex) :
+    localIntersection(in_localIntersection),
+    worldIntersection(in_worldIntersection),
+    distance(in_distance),
+    localToWorld(in_localToWorld),
+    nodePath(in_nodePath),
+    arrays(in_arrays),
+    indices(in_indices),
+    instanceIndex(in_instanceIndex),
+    sphereIndex(in_sphereIndex)
+{
+}
+
+ref_ptr<SphereIntersector::Intersection> SphereIntersector::add(const dvec3& coord, double distance, const std::vector<uint32_t>& indices, uint32_t instanceIndex, uint32_t sphereIndex)
+{
+    auto localToWorld = computeTransform(_nodePath);
+    auto intersection = Intersection::create(coord, localToWorld * coord, distance, localToWorld, _nodePath, arrayStateStack.back()->arrays, indices, instanceIndex, sphereIndex);
+    intersections.emplace_back(intersection);
+
+    return intersection;
+}
+
+double SphereIntersector::_radiusScale(const dmat4& worldToLocal)
+{
+    // conservative bound for non uniform scales - the longest image of the world space basis vectors
+    double sx = length(dvec3(worldToLocal(0, 0), worldToLocal(0, 1), worldToLocal(0, 2)));
+    double sy = length(dvec3(worldToLocal(1, 0), worldToLocal(1, 1), worldToLocal(1, 2)));
+    double sz = length(dvec3(worldToLocal(2, 0), worldToLocal(2, 1), worldToLocal(2, 2)));
+    return std::max(sx, std::max(sy, sz));
+}
+
+void SphereIntersector::pushTransform(const Transform& transform)
+{
+    auto& l2wStack = localToWorldStack();
+    auto& w2lStack = worldToLocalStack();
+
+    dmat4 localToWorld = l2wStack.empty() ? transform.transform(dmat4{}) : transform.transform(l2wStack.back());
+    dmat4 worldToLocal = inverse(localToWorld);
+
+    l2wStack.push_back(localToWorld);
+    w2lStack.push_back(worldToLocal);
+
+    double radiusScale = _radiusScale(worldToLocal);
+
+    const auto& referenceSpheres = _sphereStack.front();
+    Spheres localSpheres;
+    localSpheres.reserve(referenceSpheres.size());
+    for (const auto& sphere : referenceSpheres)
+    {
+        localSpheres.push_back(dsphere(worldToLocal * sphere.center, sphere.radius * radiusScale));
+    }
+    _sphereStack.push_back(std::move(localSpheres));
+}
+
+void SphereIntersector::popTransform()
+{
+    _sphereStack.pop_back();
+    localToWorldStack().pop_back();
+    worldToLocalStack().pop_back();
+}
+
+bool SphereIntersector::intersects(const dsphere& bs)
+{
+    if (!bs.valid()) return false;
+
+    for (const auto& sphere : _sphereStack.back())
+    {
+        double r = sphere.radius + bs.radius;
+        if (length2(sphere.center - bs.center) <= r * r) return true;
+    }
+    return false;
+}
+
+dvec3 SphereIntersector::_closestPointOnTriangle(const dvec3& p, const dvec3& v0, const dvec3& v1, const dvec3& v2)
+{
+    // Ericson, Real-Time Collision Detection, closest point on triangle via barycentric regions
+    dvec3 ab = v1 - v0;
+    dvec3 ac = v2 - v0;
+    dvec3 ap = p - v0;
+
+    double d1 = dot(ab, ap);
+    double d2 = dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0) return v0;
+
+    dvec3 bp = p - v1;
+    double d3 = dot(ab, bp);
+    double d4 = dot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3) return v1;
+
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+    {
+        double v = d1 / (d1 - d3);
+        return v0 + ab * v;
+    }
+
+    dvec3 cp = p - v2;
+    double d5 = dot(ab, cp);
+    double d6 = dot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6) return v2;
+
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+    {
+        double w = d2 / (d2 - d6);
+        return v0 + ac * w;
+    }
+
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+    {
+        double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return v1 + (v2 - v1) * w;
+    }
+
+    double denom = 1.0 / (va + vb + vc);
+    double v = vb * denom;
+    double w = vc * denom;
+    return v0 + ab * v + ac * w;
+}
+
+bool SphereIntersector::intersectDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    auto& arrayState = *arrayStateStack.back();
+    if (vertexCount == 0) return false;
+
+    const auto& spheres = _sphereStack.back();
+
+    size_t previous_size = intersections.size();
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        auto vertices = arrayState.vertexArray(instanceIndex);
+        if (!vertices) continue;
+
+        if (arrayState.topology == VK_PRIMITIVE_TOPOLOGY_POINT_LIST)
+        {
+            for (uint32_t i = firstVertex; i < firstVertex + vertexCount; ++i)
+            {
+                dvec3 v(vertices->at(i));
+                for (uint32_t sphereIndex = 0; sphereIndex < spheres.size(); ++sphereIndex)
+                {
+                    const auto& sphere = spheres[sphereIndex];
+                    double d2 = length2(v - sphere.center);
+                    if (d2 <= sphere.radius * sphere.radius) add(v, std::sqrt(d2), {i}, instanceIndex, sphereIndex);
+                }
+            }
+            continue;
+        }
+
+        if (arrayState.topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || vertexCount < 3) continue;
+
+        auto intersectTriangle = [&](uint32_t sphereIndex, uint32_t i0, uint32_t i1, uint32_t i2) {
+            const auto& sphere = spheres[sphereIndex];
+            dvec3 closest = _closestPointOnTriangle(sphere.center, dvec3(vertices->at(i0)), dvec3(vertices->at(i1)), dvec3(vertices->at(i2)));
+            double d2 = length2(closest - sphere.center);
+            if (d2 <= sphere.radius * sphere.radius)
+            {
+                add(closest, std::sqrt(d2), {i0, i1, i2}, instanceIndex, sphereIndex);
+            }
+        };
+
+        ref_ptr<TriangleBVH> bvh;
+        if (bvhCache) bvh = bvhCache->getOrBuild(vertices, {}, {}, firstVertex, vertexCount);
+
+        for (uint32_t sphereIndex = 0; sphereIndex < spheres.size(); ++sphereIndex)
+        {
+            if (bvh)
+            {
+                bvh->intersectSphere(spheres[sphereIndex].center, spheres[sphereIndex].radius, [&](uint32_t i0, uint32_t i1, uint32_t i2) { intersectTriangle(sphereIndex, i0, i1, i2); });
+            }
+            else
+            {
+                uint32_t endVertex = ((firstVertex + vertexCount) / 3) * 3;
+                for (uint32_t i = firstVertex; i < endVertex; i += 3)
+                {
+                    intersectTriangle(sphereIndex, i, i + 1, i + 2);
+                }
+            }
+        }
+    }
+
+    return intersections.size() != previous_size;
+}
+
+bool SphereIntersector::intersectDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    auto& arrayState = *arrayStateStack.back();
+    if (arrayState.topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || indexCount < 3) return false;
+
+    const auto& spheres = _sphereStack.back();
+
+    size_t previous_size = intersections.size();
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        auto vertices = arrayState.vertexArray(instanceIndex);
+        if (!vertices) continue;
+
+        auto intersectTriangle = [&](uint32_t sphereIndex, uint32_t i0, uint32_t i1, uint32_t i2) {
+            const auto& sphere = spheres[sphereIndex];
+            dvec3 closest = _closestPointOnTriangle(sphere.center, dvec3(vertices->at(i0)), dvec3(vertices->at(i1)), dvec3(vertices->at(i2)));
+            double d2 = length2(closest - sphere.center);
+            if (d2 <= sphere.radius * sphere.radius)
+            {
+                add(closest, std::sqrt(d2), {i0, i1, i2}, instanceIndex, sphereIndex);
+            }
+        };
+
+        ref_ptr<TriangleBVH> bvh;
+        if (bvhCache) bvh = bvhCache->getOrBuild(vertices, ushort_indices, uint_indices, firstIndex, indexCount);
+
+        for (uint32_t sphereIndex = 0; sphereIndex < spheres.size(); ++sphereIndex)
+        {
+            if (bvh)
+            {
+                bvh->intersectSphere(spheres[sphereIndex].center, spheres[sphereIndex].radius, [&](uint32_t i0, uint32_t i1, uint32_t i2) { intersectTriangle(sphereIndex, i0, i1, i2); });
+                continue;
+            }
+
+            uint32_t endIndex = ((firstIndex + indexCount) / 3) * 3;
+            if (ushort_indices)
+            {
+                for (uint32_t i = firstIndex; i < endIndex; i += 3)
+                {
+                    intersectTriangle(sphereIndex, ushort_indices->at(i), ushort_indices->at(i + 1), ushort_indices->at(i + 2));
+                }
+            }
+            else if (uint_indices)
+            {
+                for (uint32_t i = firstIndex; i < endIndex; i += 3)
+                {
+                    intersectTriangle(sphereIndex, uint_indices->at(i), uint_indices->at(i + 1), uint_indices->at(i + 2));
+                }
+            }
+        }
+    }
+
+    return intersections.size() != previous_size;
+}
@@ -0,0 +1,215 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/utils/TriangleBVH.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+namespace
+{
+    constexpr uint32_t maxTrianglesPerLeaf = 8;
+    constexpr uint32_t maxDepth = 30;
+
+    struct Builder
+    {
+        const vec3Array& vertices;
+        std::vector<uint32_t> triangles; // vertex index triplets, reordered in place during the build
+        std::vector<vec3> centroids;     // one per triangle, indexed by the triangle's original position
+        std::vector<uint32_t> order;     // triangle order, permuted by the splits
+
+        explicit Builder(const vec3Array& in_vertices) :
+            vertices(in_vertices) {}
+
+        box triangleBounds(uint32_t triangle) const
+        {
+            box bounds;
+            bounds.add(vertices[triangles[triangle * 3]]);
+            bounds.add(vertices[triangles[triangle * 3 + 1]]);
+            bounds.add(vertices[triangles[triangle * 3 + 2]]);
+            return bounds;
+        }
+
+        uint32_t buildNode(TriangleBVH& bvh, uint32_t first, uint32_t count, uint32_t depth)
+        {
+            uint32_t nodeIndex = static_cast<uint32_t>(bvh.nodes.size());
+            bvh.nodes.emplace_back();
+
+            box bounds;
+            box centroidBounds;
+            for (uint32_t i = first; i < first + count; ++i)
+            {
+                bounds.add(triangleBounds(order[i]));
+                centroidBounds.add(centroids[order[i]]);
+            }
+            bvh.nodes[nodeIndex].bounds = bounds;
+
+            if (count <= maxTrianglesPerLeaf || depth >= maxDepth)
+            {
+                makeLeaf(bvh, nodeIndex, first, count);
+                return nodeIndex;
+            }
+
+            // split at the midpoint of the widest axis of the centroid bounds
+            vec3 extent = centroidBounds.max - centroidBounds.min;
+            int axis = 0;
+            if (extent.y > extent.x) axis = 1;
+            if (extent.z > extent[axis]) axis = 2;
+
+            float splitValue = (centroidBounds.min[axis] + centroidBounds.max[axis]) * 0.5f;
+
+            auto begin = order.begin() + first;
+            auto end = begin + count;
+            auto middle = std::partition(begin, end, [&](uint32_t triangle) { return centroids[triangle][axis] < splitValue; });
+
+            // degenerate distribution, fall back to a median split to keep the tree balanced
+            if (middle == begin || middle == end)
+            {
+                middle = begin + count / 2;
+                std::nth_element(begin, middle, end, [&](uint32_t lhs, uint32_t rhs) { return centroids[lhs][axis] < centroids[rhs][axis]; });
+            }
+
+            uint32_t leftCount = static_cast<uint32_t>(middle - begin);
+
+            uint32_t leftChild = buildNode(bvh, first, leftCount, depth + 1);
+            buildNode(bvh, first + leftCount, count - leftCount, depth + 1);
+
+            bvh.nodes[nodeIndex].index = leftChild;
+            bvh.nodes[nodeIndex].count = 0;
+            return nodeIndex;
+        }
+
+        void makeLeaf(TriangleBVH& bvh, uint32_t nodeIndex, uint32_t first, uint32_t count)
+        {
+            bvh.nodes[nodeIndex].index = static_cast<uint32_t>(bvh.triangleIndices.size() / 3);
+            bvh.nodes[nodeIndex].count = count;
+            for (uint32_t i = first; i < first + count; ++i)
+            {
+                bvh.triangleIndices.push_back(triangles[order[i] * 3]);
+                bvh.triangleIndices.push_back(triangles[order[i] * 3 + 1]);
+                bvh.triangleIndices.push_back(triangles[order[i] * 3 + 2]);
+            }
+        }
+    };
+} // namespace
+
+ref_ptr<TriangleBVH> TriangleBVH::build(ref_ptr<const vec3Array> vertices,
+                                        ref_ptr<const ushortArray> ushort_indices, ref_ptr<const uintArray> uint_indices,
+                                        uint32_t firstIndex, uint32_t indexCount)
+{
+    if (!vertices || indexCount < 3) return {};
+
+    uint32_t numTriangles = indexCount / 3;
+
+    Builder builder(*vertices);
+    builder.triangles.reserve(size_t(numTriangles) * 3);
+
+    if (ushort_indices)
+    {
+        for (uint32_t i = firstIndex; i + 2 < firstIndex + numTriangles * 3; i += 3)
+        {
+            builder.triangles.push_back(ushort_indices->at(i));
+            builder.triangles.push_back(ushort_indices->at(i + 1));
+            builder.triangles.push_back(ushort_indices->at(i + 2));
+        }
+    }
+    else if (uint_indices)
+    {
+        for (uint32_t i = firstIndex; i + 2 < firstIndex + numTriangles * 3; i += 3)
+        {
+            builder.triangles.push_back(uint_indices->at(i));
+            builder.triangles.push_back(uint_indices->at(i + 1));
+            builder.triangles.push_back(uint_indices->at(i + 2));
+        }
+    }
+    else
+    {
+        for (uint32_t i = firstIndex; i + 2 < firstIndex + numTriangles * 3; i += 3)
+        {
+            builder.triangles.push_back(i);
+            builder.triangles.push_back(i + 1);
+            builder.triangles.push_back(i + 2);
+        }
+    }
+
+    builder.centroids.resize(numTriangles);
+    builder.order.resize(numTriangles);
+    const float third = 1.0f / 3.0f;
+    for (uint32_t triangle = 0; triangle < numTriangles; ++triangle)
+    {
+        const vec3& v0 = vertices->at(builder.triangles[triangle * 3]);
+        const vec3& v1 = vertices->at(builder.triangles[triangle * 3 + 1]);
+        const vec3& v2 = vertices->at(builder.triangles[triangle * 3 + 2]);
+        builder.centroids[triangle] = (v0 + v1 + v2) * third;
+        builder.order[triangle] = triangle;
+    }
+
+    auto bvh = TriangleBVH::create();
+    bvh->nodes.reserve(size_t(numTriangles) / (maxTrianglesPerLeaf / 2) + 1);
+    bvh->triangleIndices.reserve(size_t(numTriangles) * 3);
+
+    builder.buildNode(*bvh, 0, numTriangles, 0);
+
+    return bvh;
+}
+
+TriangleBVHCache::TriangleBVHCache()
+{
+}
+
+ref_ptr<TriangleBVH> TriangleBVHCache::getOrBuild(ref_ptr<const vec3Array> vertices,
+                                                  ref_ptr<const ushortArray> ushort_indices, ref_ptr<const uintArray> uint_indices,
+                                                  uint32_t firstIndex, uint32_t indexCount)
+{
+    if (!vertices || (indexCount / 3) < minimumTriangles) return {};
+
+    const Data* indices = ushort_indices ? static_cast<const Data*>(ushort_indices.get()) : static_cast<const Data*>(uint_indices.get());
+    Key key{vertices.get(), indices, firstIndex, indexCount};
+
+    std::scoped_lock lock(_mutex);
+
+    auto& entry = _entries[key];
+    bool rebuild = !entry.bvh;
+    if (vertices->getModifiedCount(entry.verticesModified)) rebuild = true;
+    if (indices && indices->getModifiedCount(entry.indicesModified)) rebuild = true;
+
+    if (rebuild)
+    {
+        entry.bvh = TriangleBVH::build(vertices, ushort_indices, uint_indices, firstIndex, indexCount);
+        entry.vertices = vertices;
+        entry.indices = indices;
+    }
+
+    return entry.bvh;
+}
+
+void TriangleBVHCache::prune()
+{
+    std::scoped_lock lock(_mutex);
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        const auto& entry = itr->second;
+        bool verticesExternal = entry.vertices && entry.vertices->referenceCount() > 1;
+        bool indicesExternal = entry.indices && entry.indices->referenceCount() > 1;
+        if (!verticesExternal && !indicesExternal)
+            itr = _entries.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+void TriangleBVHCache::clear()
+{
+    std::scoped_lock lock(_mutex);
+    _entries.clear();
+}
@@ -23,6 +23,7 @@ using namespace vsg;
 //
 CommandBuffer::CommandBuffer(CommandPool* commandPool, VkCommandBuffer commandBuffer, VkCommandBufferLevel level) :
     deviceID(commandPool->getDevice()->deviceID),
+    dispatch(commandPool->getDevice()->getDispatch()),
     scratchMemory(ScratchMemory::create(4096)),
     _commandBuffer(commandBuffer),
     _level(level),
@@ -46,7 +47,12 @@ void CommandBuffer::reset()
     _currentPipelineLayout = VK_NULL_HANDLE;
     _currentPushConstantStageFlags = 0;
 
-    _commandPool->reset();
+    invalidateBufferBindings();
+
+    // this CommandBuffer has exclusive use of its CommandPool so a pool level reset is cheaper than resetting the
+    // command buffer itself, and retaining the pool's allocations avoids the driver releasing and reacquiring the
+    // command memory when a similar workload is re-recorded every frame.
+    _commandPool->reset(0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/RenderPass.h>
 #include <vsg/vk/State.h>
 
+#include <algorithm>
+
 using namespace vsg;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -94,7 +96,9 @@ Context::Context(Device* in_device, const ResourceRequirements& in_resourceRequi
     scratchBufferSize(0)
 {
     //semaphore = vsg::Semaphore::create(device);
+    syncObjectPool = in_device->getSyncObjectPool();
     scratchMemory = ScratchMemory::create(4096);
+    descriptorScratchMemory = ScratchMemory::create(4096);
 
     minimum_maxSets = in_resourceRequirements.computeNumDescriptorSets();
     minimum_descriptorPoolSizes = in_resourceRequirements.computeDescriptorPoolSizes();
@@ -108,6 +112,7 @@ Context::Context(const Context& context) :
     viewID(context.viewID),
     mask(context.mask),
     viewDependentState(context.viewDependentState),
+    framesInFlight(context.framesInFlight),
     minimum_maxSets(context.minimum_maxSets),
     minimum_descriptorPoolSizes(context.minimum_descriptorPoolSizes),
     renderPass(context.renderPass),
@@ -120,12 +125,18 @@ Context::Context(const Context& context) :
     stagingMemoryBufferPools(context.stagingMemoryBufferPools),
     scratchBufferSize(context.scratchBufferSize)
 {
+    syncObjectPool = context.syncObjectPool;
     scratchMemory = ScratchMemory::create(4096);
+    descriptorScratchMemory = ScratchMemory::create(4096);
 }
 
 Context::~Context()
 {
+    flushDescriptorWrites();
+
     waitForCompletion();
+
+    if (fence) syncObjectPool->recycle(fence);
 }
 
 ref_ptr<CommandBuffer> Context::getOrCreateCommandBuffer()
@@ -196,7 +207,12 @@ ref_ptr<DescriptorSet::Implementation> Context::allocateDescriptorSet(Descriptor
     DescriptorPoolSizes descriptorPoolSizes;
     descriptorSetLayout->getDescriptorPoolSizes(descriptorPoolSizes);
 
-    uint32_t maxSets = 1;
+    // grow the pools geometrically so that sustained allocation beyond the ResourceRequirements estimates,
+    // such as under paging churn, settles on a few large pools rather than creating a stream of small ones.
+    uint32_t scale = 1u << std::min(descriptorPools.size(), size_t(10));
+    uint32_t maxSets = scale;
+    for (auto& poolSize : descriptorPoolSizes) poolSize.descriptorCount *= scale;
+
     getDescriptorPoolSizesToUse(maxSets, descriptorPoolSizes);
 
     auto descriptorPool = vsg::DescriptorPool::create(device, maxSets, descriptorPoolSizes);
@@ -222,6 +238,10 @@ void Context::reserve(const ResourceRequirements& requirements)
     DescriptorPoolSizes available_descriptorPoolSizes;
     for (auto& descriptorPool : descriptorPools)
     {
+        // opportunistically reclaim pools whose sets have all been freed, such as after PagedLOD subgraphs expire,
+        // restoring their full capacity before totting up what's available.
+        descriptorPool->reset();
+
         descriptorPool->getAvailability(available_maxSets, available_descriptorPoolSizes);
     }
 
@@ -277,6 +297,8 @@ void Context::copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest)
     }
 
     copyImageCmd->copy(data, dest);
+
+    if (data->properties.dataVariance == STATIC_DATA_UNREF_AFTER_TRANSFER) imageInfosToRelease.push_back(dest);
 }
 
 void Context::copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest, uint32_t numMipMapLevels)
@@ -290,6 +312,8 @@ void Context::copy(ref_ptr<Data> data, ref_ptr<ImageInfo> dest, uint32_t numMipM
     }
 
     copyImageCmd->copy(data, dest, numMipMapLevels);
+
+    if (data->properties.dataVariance == STATIC_DATA_UNREF_AFTER_TRANSFER) imageInfosToRelease.push_back(dest);
 }
 
 void Context::copy(ref_ptr<BufferInfo> src, ref_ptr<BufferInfo> dest)
@@ -305,17 +329,54 @@ void Context::copy(ref_ptr<BufferInfo> src, ref_ptr<BufferInfo> dest)
     copyBufferCmd->add(src, dest);
 }
 
+void Context::batchDescriptorWrites(VkDescriptorSet descriptorSet, const Descriptors& in_descriptors)
+{
+    CPU_INSTRUMENTATION_L2_NC(instrumentation, "Context batchDescriptorWrites", COLOR_COMPILE)
+
+    if (in_descriptors.empty()) return;
+
+    // build the writes and the arrays they point to in the dedicated scratch memory, it is only released
+    // by flushDescriptorWrites() so the entries remain valid while other compiles reuse the shared scratchMemory.
+    std::swap(scratchMemory, descriptorScratchMemory);
+
+    auto writes = scratchMemory->allocate<VkWriteDescriptorSet>(in_descriptors.size());
+    for (size_t i = 0; i < in_descriptors.size(); ++i)
+    {
+        in_descriptors[i]->assignTo(*this, writes[i]);
+        writes[i].dstSet = descriptorSet;
+    }
+
+    std::swap(scratchMemory, descriptorScratchMemory);
+
+    descriptorWrites.insert(descriptorWrites.end(), writes, writes + in_descriptors.size());
+}
+
+void Context::flushDescriptorWrites()
+{
+    if (descriptorWrites.empty()) return;
+
+    CPU_INSTRUMENTATION_L1_NC(instrumentation, "Context flushDescriptorWrites", COLOR_COMPILE)
+
+    vkUpdateDescriptorSets(*device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+
+    descriptorWrites.clear();
+    descriptorScratchMemory->release();
+}
+
 bool Context::record()
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "Context record", COLOR_COMPILE)
 
+    // apply any descriptor writes accumulated during the compile traversal before the recorded commands are submitted.
+    flushDescriptorWrites();
+
     if (commands.empty() && buildAccelerationStructureCommands.empty()) return false;
 
     //auto before_compile = std::chrono::steady_clock::now();
 
     if (!fence)
     {
-        fence = vsg::Fence::create(device);
+        fence = syncObjectPool->acquireFence();
     }
     else
     {
@@ -407,4 +468,19 @@ void Context::waitForCompletion()
     commands.clear();
     copyImageCmd = nullptr;
     copyBufferCmd = nullptr;
+
+    // the fence confirms the transfers have completed so the CPU side copies of static data marked
+    // STATIC_DATA_UNREF_AFTER_TRANSFER are no longer required and can be unreffed, freeing the host
+    // memory when no other references to the data remain.
+    for (auto& bufferInfo : bufferInfosToRelease)
+    {
+        bufferInfo->data = {};
+    }
+    bufferInfosToRelease.clear();
+
+    for (auto& imageInfo : imageInfosToRelease)
+    {
+        if (imageInfo->imageView && imageInfo->imageView->image) imageInfo->imageView->image->data = {};
+    }
+    imageInfosToRelease.clear();
 }
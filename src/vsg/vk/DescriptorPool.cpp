@@ -23,6 +23,8 @@ using namespace vsg;
 
 DescriptorPool::DescriptorPool(Device* device, uint32_t maxSets, const DescriptorPoolSizes& descriptorPoolSizes) :
     _device(device),
+    _maxSets(maxSets),
+    _descriptorPoolSizes(descriptorPoolSizes),
     _availableDescriptorSet(maxSets),
     _availableDescriptorPoolSizes(descriptorPoolSizes)
 {
@@ -48,6 +50,18 @@ DescriptorPool::~DescriptorPool()
     }
 }
 
+std::list<DescriptorPool::RecycledSets>::iterator DescriptorPool::_findRecycledSets(DescriptorSetLayout* descriptorSetLayout)
+{
+    for (auto itr = _recyclingLists.begin(); itr != _recyclingLists.end(); ++itr)
+    {
+        if (itr->descriptorSetLayout.get() == descriptorSetLayout || compare_value_container(itr->descriptorSetLayout->bindings, descriptorSetLayout->bindings) == 0)
+        {
+            return itr;
+        }
+    }
+    return _recyclingLists.end();
+}
+
 ref_ptr<DescriptorSet::Implementation> DescriptorPool::allocateDescriptorSet(DescriptorSetLayout* descriptorSetLayout)
 {
     std::scoped_lock<std::mutex> lock(mutex);
@@ -57,20 +71,20 @@ ref_ptr<DescriptorSet::Implementation> DescriptorPool::allocateDescriptorSet(Des
         return {};
     }
 
-    for (auto itr = _recyclingList.begin(); itr != _recyclingList.end(); ++itr)
+    if (auto itr = _findRecycledSets(descriptorSetLayout); itr != _recyclingLists.end())
     {
-        auto dsi = *itr;
-        if (dsi->_descriptorSetLayout.get() == descriptorSetLayout || compare_value_container(dsi->_descriptorSetLayout->bindings, descriptorSetLayout->bindings) == 0)
-        {
-            dsi->_descriptorPool = this;
-            _recyclingList.erase(itr);
-            --_availableDescriptorSet;
-            // debug("DescriptorPool::allocateDescriptorSet(..) reusing ", dsi)   ;
-            return dsi;
-        }
+        auto dsi = itr->sets.back();
+        itr->sets.pop_back();
+        if (itr->sets.empty()) _recyclingLists.erase(itr);
+        --_numRecycledSets;
+
+        dsi->_descriptorPool = this;
+        --_availableDescriptorSet;
+        // debug("DescriptorPool::allocateDescriptorSet(..) reusing ", dsi)   ;
+        return dsi;
     }
 
-    if (_availableDescriptorSet == _recyclingList.size())
+    if (_availableDescriptorSet == _numRecycledSets)
     {
         //debug("The only available vkDescriptorSets associated with DescriptorPool are in the recyclingList, but none are compatible.");
         return {};
@@ -110,13 +124,45 @@ void DescriptorPool::freeDescriptorSet(ref_ptr<DescriptorSet::Implementation> ds
 {
     {
         std::scoped_lock<std::mutex> lock(mutex);
-        _recyclingList.push_back(dsi);
+
+        if (auto itr = _findRecycledSets(dsi->_descriptorSetLayout); itr != _recyclingLists.end())
+        {
+            itr->sets.push_back(dsi);
+        }
+        else
+        {
+            _recyclingLists.push_back(RecycledSets{dsi->_descriptorSetLayout, {dsi}});
+        }
+
+        ++_numRecycledSets;
         ++_availableDescriptorSet;
     }
 
     dsi->_descriptorPool = {};
 }
 
+bool DescriptorPool::reset()
+{
+    std::scoped_lock<std::mutex> lock(mutex);
+
+    // only reset when every allocated DescriptorSet has been freed back to the pool
+    if (_availableDescriptorSet != _maxSets) return false;
+
+    if (_numRecycledSets > 0)
+    {
+        // the recycled DescriptorSet::Implementations no longer reference this pool so their
+        // VkDescriptorSets are reclaimed in bulk by resetting the VkDescriptorPool.
+        _recyclingLists.clear();
+        _numRecycledSets = 0;
+
+        vkResetDescriptorPool(*_device, _descriptorPool, 0);
+
+        _availableDescriptorPoolSizes = _descriptorPoolSizes;
+    }
+
+    return true;
+}
+
 bool DescriptorPool::getAvailability(uint32_t& maxSets, DescriptorPoolSizes& descriptorPoolSizes) const
 {
     std::scoped_lock<std::mutex> lock(mutex);
@@ -0,0 +1,106 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Options.h>
+#include <vsg/vk/DestructionQueue.h>
+
+using namespace vsg;
+
+DestructionQueue::DestructionQueue()
+{
+}
+
+DestructionQueue::~DestructionQueue()
+{
+}
+
+void DestructionQueue::defer(ref_ptr<Object> object)
+{
+    if (!object) return;
+
+    std::scoped_lock lock(_mutex);
+    _pending.push_back(object);
+}
+
+void DestructionQueue::advance(const Fences& frameFences)
+{
+    // collect the objects to release so their destructors, which may be heavyweight subgraph teardowns,
+    // run outside the mutex.
+    std::vector<ref_ptr<Object>> toRelease;
+
+    {
+        std::scoped_lock lock(_mutex);
+
+        if (!_pending.empty())
+        {
+            if (frameFences.empty())
+            {
+                // nothing in flight to wait for, destroy the parked objects immediately
+                toRelease.swap(_pending);
+            }
+            else
+            {
+                auto& batch = _batches.emplace_back();
+                batch.fences = frameFences;
+                batch.objects.swap(_pending);
+            }
+        }
+    }
+
+    toRelease.clear();
+
+    expire();
+}
+
+size_t DestructionQueue::expire()
+{
+    std::vector<ref_ptr<Object>> toRelease;
+
+    {
+        std::scoped_lock lock(_mutex);
+
+        // frames complete in submission order, so stop at the first batch whose fences haven't all signaled
+        while (!_batches.empty())
+        {
+            auto& batch = _batches.front();
+
+            bool completed = true;
+            for (auto& fence : batch.fences)
+            {
+                if (fence->status() != VK_SUCCESS)
+                {
+                    completed = false;
+                    break;
+                }
+            }
+
+            if (!completed) break;
+
+            toRelease.insert(toRelease.end(), batch.objects.begin(), batch.objects.end());
+            _batches.pop_front();
+        }
+    }
+
+    size_t released = toRelease.size();
+    toRelease.clear();
+
+    return released;
+}
+
+size_t DestructionQueue::pendingObjects() const
+{
+    std::scoped_lock lock(_mutex);
+
+    size_t count = _pending.size();
+    for (const auto& batch : _batches) count += batch.objects.size();
+    return count;
+}
@@ -14,7 +14,11 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Version.h>
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
+#include <vsg/state/Sampler.h>
+#include <vsg/vk/DestructionQueue.h>
 #include <vsg/vk/Device.h>
+#include <vsg/vk/PipelineCache.h>
+#include <vsg/vk/SyncObjectPool.h>
 
 #include <cstring>
 #include <set>
@@ -162,10 +166,18 @@ Device::Device(PhysicalDevice* physicalDevice, const QueueSettings& queueSetting
     }
 
     _extensions = DeviceExtensions::create(this);
+    _dispatch = DeviceDispatch::create(this);
+
+    pipelineCache = PipelineCache::create(this);
+
+    samplerCache = SamplerCache::create();
 }
 
 Device::~Device()
 {
+    // destroy the PipelineCache, saving its data to file if assigned a filename, before the VkDevice it wraps is destroyed.
+    pipelineCache = {};
+
     if (_device)
     {
         vkDestroyDevice(_device, _allocator);
@@ -179,6 +191,32 @@ uint32_t Device::maxNumDevices()
     return VSG_MAX_DEVICES;
 }
 
+ref_ptr<SyncObjectPool> Device::getSyncObjectPool()
+{
+    std::scoped_lock lock(_syncObjectPoolMutex);
+
+    auto pool = _syncObjectPool.ref_ptr();
+    if (!pool)
+    {
+        pool = SyncObjectPool::create(this);
+        _syncObjectPool = pool;
+    }
+    return pool;
+}
+
+ref_ptr<DestructionQueue> Device::getDestructionQueue()
+{
+    std::scoped_lock lock(_destructionQueueMutex);
+
+    auto queue = _destructionQueue.ref_ptr();
+    if (!queue)
+    {
+        queue = DestructionQueue::create();
+        _destructionQueue = queue;
+    }
+    return queue;
+}
+
 ref_ptr<Queue> Device::getQueue(uint32_t queueFamilyIndex, uint32_t queueIndex)
 {
     for (auto& queue : _queues)
@@ -0,0 +1,32 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/vk/Device.h>
+
+using namespace vsg;
+
+DeviceDispatch::DeviceDispatch(Device* device)
+{
+    // all entries are core Vulkan-1.0 commands so vkGetDeviceProcAddr is guaranteed to resolve them
+    // for a valid device, but fall back to the loader's trampolines to keep the table callable without
+    // null checks in the record hot paths should a non conformant driver fail to provide one.
+    if (!device->getProcAddr(vkCmdBindPipeline, "vkCmdBindPipeline")) vkCmdBindPipeline = ::vkCmdBindPipeline;
+    if (!device->getProcAddr(vkCmdBindDescriptorSets, "vkCmdBindDescriptorSets")) vkCmdBindDescriptorSets = ::vkCmdBindDescriptorSets;
+    if (!device->getProcAddr(vkCmdPushConstants, "vkCmdPushConstants")) vkCmdPushConstants = ::vkCmdPushConstants;
+    if (!device->getProcAddr(vkCmdBindVertexBuffers, "vkCmdBindVertexBuffers")) vkCmdBindVertexBuffers = ::vkCmdBindVertexBuffers;
+    if (!device->getProcAddr(vkCmdBindIndexBuffer, "vkCmdBindIndexBuffer")) vkCmdBindIndexBuffer = ::vkCmdBindIndexBuffer;
+    if (!device->getProcAddr(vkCmdDraw, "vkCmdDraw")) vkCmdDraw = ::vkCmdDraw;
+    if (!device->getProcAddr(vkCmdDrawIndexed, "vkCmdDrawIndexed")) vkCmdDrawIndexed = ::vkCmdDrawIndexed;
+    if (!device->getProcAddr(vkCmdDrawIndirect, "vkCmdDrawIndirect")) vkCmdDrawIndirect = ::vkCmdDrawIndirect;
+    if (!device->getProcAddr(vkCmdDrawIndexedIndirect, "vkCmdDrawIndexedIndirect")) vkCmdDrawIndexedIndirect = ::vkCmdDrawIndexedIndirect;
+    if (!device->getProcAddr(vkCmdDispatch, "vkCmdDispatch")) vkCmdDispatch = ::vkCmdDispatch;
+}
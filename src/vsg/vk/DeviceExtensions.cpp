@@ -24,6 +24,11 @@ DeviceExtensions::DeviceExtensions(Device* device)
     // VK_EXT_host_query_reset
     device->getProcAddr(vkResetQueryPool, "vkResetQueryPool", "vkResetQueryPoolEXT");
 
+    // VK_KHR_timeline_semaphore
+    device->getProcAddr(vkWaitSemaphores, "vkWaitSemaphores", "vkWaitSemaphoresKHR");
+    device->getProcAddr(vkSignalSemaphore, "vkSignalSemaphore", "vkSignalSemaphoreKHR");
+    device->getProcAddr(vkGetSemaphoreCounterValue, "vkGetSemaphoreCounterValue", "vkGetSemaphoreCounterValueKHR");
+
     // VK_KHR_create_renderpass2
     if (device->supportsApiVersion(VK_API_VERSION_1_2))
         device->getProcAddr(vkCreateRenderPass2, "vkCreateRenderPass2");
@@ -36,17 +41,26 @@ DeviceExtensions::DeviceExtensions(Device* device)
     device->getProcAddr(vkGetAccelerationStructureDeviceAddressKHR, "vkGetAccelerationStructureDeviceAddressKHR");
     device->getProcAddr(vkGetAccelerationStructureBuildSizesKHR, "vkGetAccelerationStructureBuildSizesKHR");
     device->getProcAddr(vkCmdBuildAccelerationStructuresKHR, "vkCmdBuildAccelerationStructuresKHR");
+    device->getProcAddr(vkCmdWriteAccelerationStructuresPropertiesKHR, "vkCmdWriteAccelerationStructuresPropertiesKHR");
+    device->getProcAddr(vkCmdCopyAccelerationStructureKHR, "vkCmdCopyAccelerationStructureKHR");
     device->getProcAddr(vkCreateRayTracingPipelinesKHR, "vkCreateRayTracingPipelinesKHR");
     device->getProcAddr(vkGetRayTracingShaderGroupHandlesKHR, "vkGetRayTracingShaderGroupHandlesKHR");
     device->getProcAddr(vkCmdTraceRaysKHR, "vkCmdTraceRaysKHR");
 
     device->getProcAddr(vkGetBufferDeviceAddressKHR, "vkGetBufferDeviceAddressKHR");
 
+    // VK_KHR_push_descriptor
+    device->getProcAddr(vkCmdPushDescriptorSetKHR, "vkCmdPushDescriptorSetKHR");
+
     // VK_EXT_mesh_shader
     device->getProcAddr(vkCmdDrawMeshTasksEXT, "vkCmdDrawMeshTasksEXT");
     device->getProcAddr(vkCmdDrawMeshTasksIndirectEXT, "vkCmdDrawMeshTasksIndirectEXT");
     device->getProcAddr(vkCmdDrawMeshTasksIndirectCountEXT, "vkCmdDrawMeshTasksIndirectCountEXT");
 
+    // VK_EXT_host_image_copy
+    device->getProcAddr(vkCopyMemoryToImageEXT, "vkCopyMemoryToImageEXT");
+    device->getProcAddr(vkTransitionImageLayoutEXT, "vkTransitionImageLayoutEXT");
+
     // VK_EXT_extended_dynamic_state
     if (device->supportsApiVersion(VK_API_VERSION_1_3))
     {
@@ -86,6 +86,36 @@ DeviceMemory::~DeviceMemory()
     }
 }
 
+VkResult DeviceMemory::getMemoryFd(VkExternalMemoryHandleTypeFlagBits handleType, int& fd) const
+{
+    PFN_vkGetMemoryFdKHR vkGetMemoryFdKHR = nullptr;
+    _device->getProcAddr(vkGetMemoryFdKHR, "vkGetMemoryFdKHR");
+    if (!vkGetMemoryFdKHR) return VK_ERROR_EXTENSION_NOT_PRESENT;
+
+    VkMemoryGetFdInfoKHR getFdInfo = {};
+    getFdInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+    getFdInfo.memory = _deviceMemory;
+    getFdInfo.handleType = handleType;
+
+    return vkGetMemoryFdKHR(*_device, &getFdInfo, &fd);
+}
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+VkResult DeviceMemory::getMemoryWin32Handle(VkExternalMemoryHandleTypeFlagBits handleType, HANDLE& handle) const
+{
+    PFN_vkGetMemoryWin32HandleKHR vkGetMemoryWin32HandleKHR = nullptr;
+    _device->getProcAddr(vkGetMemoryWin32HandleKHR, "vkGetMemoryWin32HandleKHR");
+    if (!vkGetMemoryWin32HandleKHR) return VK_ERROR_EXTENSION_NOT_PRESENT;
+
+    VkMemoryGetWin32HandleInfoKHR getHandleInfo = {};
+    getHandleInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR;
+    getHandleInfo.memory = _deviceMemory;
+    getHandleInfo.handleType = handleType;
+
+    return vkGetMemoryWin32HandleKHR(*_device, &getHandleInfo, &handle);
+}
+#endif
+
 VkResult DeviceMemory::map(VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
 {
     return vkMapMemory(*_device, _deviceMemory, offset, size, flags, ppData);
@@ -110,7 +140,7 @@ void DeviceMemory::copy(VkDeviceSize offset, VkDeviceSize size, const void* src_
 
 void DeviceMemory::copy(VkDeviceSize offset, const Data* data)
 {
-    copy(offset, data->dataSize(), data->dataPointer());
+    copy(offset, data->dataSize(), data->constDataPointer());
 }
 
 MemorySlots::OptionalOffset DeviceMemory::reserve(VkDeviceSize size)
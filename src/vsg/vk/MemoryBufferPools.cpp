@@ -75,15 +75,87 @@ VkDeviceSize MemoryBufferPools::computeBufferTotalReserved() const
     return totalReservedSize;
 }
 
+void MemoryBufferPools::report(std::ostream& out) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    out << "MemoryBufferPools::report() " << name << ", memoryPools = " << memoryPools.size() << ", bufferPools = " << bufferPools.size() << std::endl;
+
+    auto reportSlots = [&out](size_t totalSize, size_t reserved, size_t available, size_t largestAvailable) {
+        out << "size = " << totalSize << ", used = " << reserved << ", avail = " << available << ", largest free = " << largestAvailable;
+        if (available > 0)
+        {
+            // proportion of the free space that cannot be served by the largest contiguous slot
+            double fragmentation = 1.0 - static_cast<double>(largestAvailable) / static_cast<double>(available);
+            out << ", fragmentation = " << fragmentation * 100.0 << "%";
+        }
+    };
+
+    for (const auto& deviceMemory : memoryPools)
+    {
+        out << "    DeviceMemory " << deviceMemory.get() << " [";
+        reportSlots(deviceMemory->totalAvailableSize() + deviceMemory->totalReservedSize(), deviceMemory->totalReservedSize(), deviceMemory->totalAvailableSize(), deviceMemory->maximumAvailableSpace());
+        out << "]" << std::endl;
+    }
+
+    for (const auto& buffer : bufferPools)
+    {
+        out << "    Buffer " << buffer.get() << " [";
+        reportSlots(buffer->size, buffer->totalReservedSize(), buffer->totalAvailableSize(), buffer->maximumAvailableSpace());
+        out << "]" << std::endl;
+    }
+}
+
+size_t MemoryBufferPools::releaseEmptyPools()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    size_t released = 0;
+
+    // release idle Buffers first so that their DeviceMemory reservations are returned
+    // before the memory pools themselves are checked.
+    for (auto itr = bufferPools.begin(); itr != bufferPools.end();)
+    {
+        if ((*itr)->totalReservedSize() == 0)
+        {
+            itr = bufferPools.erase(itr);
+            ++released;
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    for (auto itr = memoryPools.begin(); itr != memoryPools.end();)
+    {
+        if ((*itr)->totalReservedSize() == 0)
+        {
+            itr = memoryPools.erase(itr);
+            ++released;
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    return released;
+}
+
 ref_ptr<BufferInfo> MemoryBufferPools::reserveBuffer(VkDeviceSize totalSize, VkDeviceSize alignment, VkBufferUsageFlags bufferUsageFlags, VkSharingMode sharingMode, VkMemoryPropertyFlags memoryProperties)
 {
     ref_ptr<BufferInfo> bufferInfo = BufferInfo::create();
 
+    // in arena mode requests whose usage is a subset of the arena's share the arena's large buffers
+    bool arena = arenaBufferSize != 0 && (arenaUsageFlags & bufferUsageFlags) == bufferUsageFlags;
+    VkBufferUsageFlags poolUsageFlags = arena ? arenaUsageFlags : bufferUsageFlags;
+
     {
         std::scoped_lock<std::mutex> lock(_mutex);
         for (auto& bufferFromPool : bufferPools)
         {
-            if (bufferFromPool->usage == bufferUsageFlags && bufferFromPool->size >= totalSize)
+            if (bufferFromPool->usage == poolUsageFlags && bufferFromPool->size >= totalSize)
             {
                 MemorySlots::OptionalOffset reservedBufferSlot = bufferFromPool->reserve(totalSize, alignment);
                 if (reservedBufferSlot.first)
@@ -97,9 +169,9 @@ ref_ptr<BufferInfo> MemoryBufferPools::reserveBuffer(VkDeviceSize totalSize, VkD
         }
     }
 
-    VkDeviceSize deviceSize = std::max(totalSize, minimumBufferSize);
+    VkDeviceSize deviceSize = std::max(totalSize, arena ? arenaBufferSize : minimumBufferSize);
 
-    bufferInfo->buffer = Buffer::create(deviceSize, bufferUsageFlags, sharingMode);
+    bufferInfo->buffer = Buffer::create(deviceSize, poolUsageFlags, sharingMode);
     bufferInfo->buffer->compile(device);
 
     MemorySlots::OptionalOffset reservedBufferSlot = bufferInfo->buffer->reserve(totalSize, alignment);
@@ -119,7 +191,18 @@ ref_ptr<BufferInfo> MemoryBufferPools::reserveBuffer(VkDeviceSize totalSize, VkD
     VkMemoryRequirements memRequirements;
     vkGetBufferMemoryRequirements(*device, bufferInfo->buffer->vk(device->deviceID), &memRequirements);
 
-    auto reservedMemorySlot = reserveMemory(memRequirements, memoryProperties);
+    // memory that backs buffers created with VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT must itself be
+    // allocated with VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT
+    VkMemoryAllocateFlagsInfo allocateFlagsInfo = {};
+    void* pNextAllocInfo = nullptr;
+    if ((bufferUsageFlags & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) != 0)
+    {
+        allocateFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        allocateFlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        pNextAllocInfo = &allocateFlagsInfo;
+    }
+
+    auto reservedMemorySlot = reserveMemory(memRequirements, memoryProperties, pNextAllocInfo);
 
     if (!reservedMemorySlot.first)
     {
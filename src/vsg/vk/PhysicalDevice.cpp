@@ -34,6 +34,9 @@ PhysicalDevice::PhysicalDevice(Instance* instance, VkPhysicalDevice device) :
     /// get function pointers
     instance->getProcAddr(_vkGetPhysicalDeviceFeatures2, "vkGetPhysicalDeviceFeatures2", "vkGetPhysicalDeviceFeatures2KHR");
     instance->getProcAddr(_vkGetPhysicalDeviceProperties2, "vkGetPhysicalDeviceProperties2", "vkGetPhysicalDeviceProperties2KHR");
+    instance->getProcAddr(_vkGetPhysicalDeviceMemoryProperties2, "vkGetPhysicalDeviceMemoryProperties2", "vkGetPhysicalDeviceMemoryProperties2KHR");
+
+    _supportsMemoryBudget = _vkGetPhysicalDeviceMemoryProperties2 && supportsDeviceExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
 }
 
 PhysicalDevice::~PhysicalDevice()
@@ -67,6 +70,20 @@ int PhysicalDevice::getQueueFamily(VkQueueFlags queueFlags) const
     return bestFamily;
 }
 
+int PhysicalDevice::getDedicatedQueueFamily(VkQueueFlags queueFlags, VkQueueFlags excludedFlags) const
+{
+    for (int i = 0; i < static_cast<int>(_queueFamilies.size()); ++i)
+    {
+        const auto& queueFamily = _queueFamilies[i];
+        if ((queueFamily.queueFlags & queueFlags) == queueFlags && (queueFamily.queueFlags & excludedFlags) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
 std::pair<int, int> PhysicalDevice::getQueueFamily(VkQueueFlags queueFlags, Surface* surface) const
 {
     int queueFamily = -1;
@@ -93,6 +110,35 @@ std::pair<int, int> PhysicalDevice::getQueueFamily(VkQueueFlags queueFlags, Surf
     return {queueFamily, presentFamily};
 }
 
+PhysicalDevice::MemoryBudgets PhysicalDevice::getMemoryBudgets() const
+{
+    if (!_supportsMemoryBudget) return {};
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties = {};
+    budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 memoryProperties2 = {};
+    memoryProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    memoryProperties2.pNext = &budgetProperties;
+
+    _vkGetPhysicalDeviceMemoryProperties2(_device, &memoryProperties2);
+
+    const auto& memoryProperties = memoryProperties2.memoryProperties;
+
+    MemoryBudgets memoryBudgets(memoryProperties.memoryHeapCount);
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+    {
+        auto& memoryBudget = memoryBudgets[i];
+        memoryBudget.heapIndex = i;
+        memoryBudget.flags = memoryProperties.memoryHeaps[i].flags;
+        memoryBudget.size = memoryProperties.memoryHeaps[i].size;
+        memoryBudget.budget = budgetProperties.heapBudget[i];
+        memoryBudget.usage = budgetProperties.heapUsage[i];
+    }
+
+    return memoryBudgets;
+}
+
 std::vector<VkExtensionProperties> PhysicalDevice::enumerateDeviceExtensionProperties(const char* pLayerName)
 {
     uint32_t propertyCount;
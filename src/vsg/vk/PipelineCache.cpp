@@ -0,0 +1,90 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Exception.h>
+#include <vsg/io/Logger.h>
+#include <vsg/vk/PipelineCache.h>
+
+#include <fstream>
+
+using namespace vsg;
+
+PipelineCache::PipelineCache(Device* device, const Path& in_filename) :
+    filename(in_filename),
+    _device(device->vk()),
+    _allocator(device->getAllocationCallbacks())
+{
+    std::vector<char> initialData;
+    if (filename)
+    {
+        std::ifstream fin(filename, std::ios::ate | std::ios::binary);
+        if (fin.is_open())
+        {
+            size_t fileSize = fin.tellg();
+            initialData.resize(fileSize);
+            fin.seekg(0);
+            fin.read(initialData.data(), fileSize);
+            if (!fin.good()) initialData.clear();
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = initialData.size();
+    createInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+    createInfo.pNext = nullptr;
+
+    VkResult result = vkCreatePipelineCache(_device, &createInfo, _allocator, &_pipelineCache);
+    if (result != VK_SUCCESS && !initialData.empty())
+    {
+        // cache data written by a different driver version is unusable, so fall back to an empty cache.
+        debug("PipelineCache::PipelineCache() unable to use initial data from ", filename, ", creating empty cache.");
+
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+
+        result = vkCreatePipelineCache(_device, &createInfo, _allocator, &_pipelineCache);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        throw Exception{"Error: vsg::PipelineCache failed to create VkPipelineCache.", result};
+    }
+}
+
+PipelineCache::~PipelineCache()
+{
+    if (_pipelineCache)
+    {
+        if (filename) save(filename);
+
+        vkDestroyPipelineCache(_device, _pipelineCache, _allocator);
+    }
+}
+
+bool PipelineCache::save(const Path& saveFilename) const
+{
+    if (!_pipelineCache) return false;
+
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(_device, _pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) return false;
+
+    std::vector<char> data(dataSize);
+    if (vkGetPipelineCacheData(_device, _pipelineCache, &dataSize, data.data()) != VK_SUCCESS) return false;
+
+    std::ofstream fout(saveFilename, std::ios::binary);
+    if (!fout.is_open()) return false;
+
+    fout.write(data.data(), dataSize);
+
+    return fout.good();
+}
@@ -40,6 +40,12 @@ VkResult Queue::submit(const VkSubmitInfo& submitInfo, Fence* fence)
     return vkQueueSubmit(_vkQueue, 1, &submitInfo, fence ? fence->vk() : VK_NULL_HANDLE);
 }
 
+VkResult Queue::bindSparse(const VkBindSparseInfo& bindSparseInfo, Fence* fence)
+{
+    std::scoped_lock<std::mutex> guard(_mutex);
+    return vkQueueBindSparse(_vkQueue, 1, &bindSparseInfo, fence ? fence->vk() : VK_NULL_HANDLE);
+}
+
 VkResult Queue::present(const VkPresentInfoKHR& info)
 {
     std::scoped_lock<std::mutex> guard(_mutex);
@@ -0,0 +1,352 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/io/Options.h>
+#include <vsg/vk/Context.h>
+#include <vsg/vk/SparseImageManager.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace vsg;
+
+namespace
+{
+    /// transient command that uploads page data from staging buffers into newly bound sparse image pages,
+    /// transitioning each page's subresource to TRANSFER_DST and back to SHADER_READ_ONLY around the copy.
+    class CopySparseImagePages : public Inherit<Command, CopySparseImagePages>
+    {
+    public:
+        struct CopyData
+        {
+            ref_ptr<Image> image;
+            ref_ptr<BufferInfo> source;
+            VkBufferImageCopy region = {};
+            VkImageLayout oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        };
+
+        std::vector<CopyData> copies;
+
+        void record(CommandBuffer& commandBuffer) const override
+        {
+            auto deviceID = commandBuffer.deviceID;
+
+            for (const auto& cd : copies)
+            {
+                VkImage vkImage = cd.image->vk(deviceID);
+
+                VkImageMemoryBarrier barrier = {};
+                barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.oldLayout = cd.oldLayout;
+                barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.image = vkImage;
+                barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, cd.region.imageSubresource.mipLevel, 1, cd.region.imageSubresource.baseArrayLayer, 1};
+
+                vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+                vkCmdCopyBufferToImage(commandBuffer, cd.source->buffer->vk(deviceID), vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &cd.region);
+
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+                barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+                vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+            }
+        }
+
+    protected:
+        ~CopySparseImagePages() = default;
+    };
+} // namespace
+
+bool SparseImageManager::PageKey::operator<(const PageKey& rhs) const
+{
+    if (image != rhs.image) return image < rhs.image;
+    if (mipLevel != rhs.mipLevel) return mipLevel < rhs.mipLevel;
+    if (arrayLayer != rhs.arrayLayer) return arrayLayer < rhs.arrayLayer;
+    if (offset.x != rhs.offset.x) return offset.x < rhs.offset.x;
+    if (offset.y != rhs.offset.y) return offset.y < rhs.offset.y;
+    return offset.z < rhs.offset.z;
+}
+
+SparseImageManager::SparseImageManager(Device* in_device) :
+    device(in_device)
+{
+    syncObjectPool = in_device->getSyncObjectPool();
+
+    int queueFamily = in_device->getPhysicalDevice()->getQueueFamily(VK_QUEUE_SPARSE_BINDING_BIT);
+    if (queueFamily >= 0) sparseBindingQueue = in_device->getQueue(static_cast<uint32_t>(queueFamily));
+
+    if (!sparseBindingQueue)
+    {
+        warn("SparseImageManager unable to assign sparseBindingQueue, the Device must be created with a queue from a family supporting VK_QUEUE_SPARSE_BINDING_BIT.");
+    }
+}
+
+SparseImageManager::~SparseImageManager()
+{
+}
+
+VkExtent3D SparseImageManager::pageGranularity(Image* image) const
+{
+    auto sparseMemoryRequirements = image->getSparseMemoryRequirements(device->deviceID);
+    if (sparseMemoryRequirements.empty()) return VkExtent3D{0, 0, 0};
+
+    return sparseMemoryRequirements.front().formatProperties.imageGranularity;
+}
+
+VkDeviceSize SparseImageManager::residentMemory() const
+{
+    std::scoped_lock lock(_mutex);
+    return _residentMemory;
+}
+
+void SparseImageManager::requestPage(ref_ptr<Image> image, uint32_t mipLevel, uint32_t arrayLayer, const VkOffset3D& offset, ref_ptr<Data> pageData)
+{
+    auto deviceID = device->deviceID;
+    if (!image || image->vk(deviceID) == VK_NULL_HANDLE)
+    {
+        warn("SparseImageManager::requestPage() requires an Image that has been compiled for the manager's device.");
+        return;
+    }
+
+    auto granularity = pageGranularity(image);
+    if (granularity.width == 0)
+    {
+        warn("SparseImageManager::requestPage() image has no sparse memory requirements, was it created with VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT?");
+        return;
+    }
+
+    // align the offset down to the page granularity and clamp the page extent to the mip level's dimensions
+    VkOffset3D alignedOffset{
+        offset.x - (offset.x % static_cast<int32_t>(granularity.width)),
+        offset.y - (offset.y % static_cast<int32_t>(granularity.height)),
+        offset.z - (offset.z % static_cast<int32_t>(granularity.depth))};
+
+    VkExtent3D levelExtent{
+        std::max(image->extent.width >> mipLevel, 1u),
+        std::max(image->extent.height >> mipLevel, 1u),
+        std::max(image->extent.depth >> mipLevel, 1u)};
+
+    VkExtent3D pageExtent{
+        std::min(granularity.width, levelExtent.width - static_cast<uint32_t>(alignedOffset.x)),
+        std::min(granularity.height, levelExtent.height - static_cast<uint32_t>(alignedOffset.y)),
+        std::min(granularity.depth, levelExtent.depth - static_cast<uint32_t>(alignedOffset.z))};
+
+    PageKey key{image->vk(deviceID), mipLevel, arrayLayer, alignedOffset};
+
+    std::scoped_lock lock(_mutex);
+
+    PendingPage pending;
+    pending.image = image;
+    pending.bind.subresource = {VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, arrayLayer};
+    pending.bind.offset = alignedOffset;
+    pending.bind.extent = pageExtent;
+    pending.bind.memoryOffset = 0;
+    pending.bind.flags = 0;
+    pending.data = pageData;
+
+    if (auto itr = _pages.find(key); itr != _pages.end())
+    {
+        // page already resident, only a re-upload of the page data is required
+        if (pageData)
+        {
+            pending.memory = itr->second.memory;
+            pending.bind.memory = *(itr->second.memory);
+            _pendingUploads.push_back(pending);
+        }
+        return;
+    }
+
+    // allocate a dedicated page sized allocation, using the image's memory requirements for the
+    // memory type and the sparse binding alignment which equals the page size in bytes
+    auto memRequirements = image->getMemoryRequirements(deviceID);
+    VkDeviceSize pageSize = memRequirements.alignment;
+    memRequirements.size = pageSize;
+
+    auto memory = DeviceMemory::create(device, memRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    pending.memory = memory;
+    pending.bind.memory = *memory;
+    _pendingBinds.push_back(pending);
+
+    _pages[key] = Page{memory, pageSize};
+    _residentMemory += pageSize;
+}
+
+void SparseImageManager::releasePage(ref_ptr<Image> image, uint32_t mipLevel, uint32_t arrayLayer, const VkOffset3D& offset)
+{
+    auto deviceID = device->deviceID;
+    if (!image || image->vk(deviceID) == VK_NULL_HANDLE) return;
+
+    auto granularity = pageGranularity(image);
+    if (granularity.width == 0) return;
+
+    VkOffset3D alignedOffset{
+        offset.x - (offset.x % static_cast<int32_t>(granularity.width)),
+        offset.y - (offset.y % static_cast<int32_t>(granularity.height)),
+        offset.z - (offset.z % static_cast<int32_t>(granularity.depth))};
+
+    PageKey key{image->vk(deviceID), mipLevel, arrayLayer, alignedOffset};
+
+    std::scoped_lock lock(_mutex);
+
+    auto itr = _pages.find(key);
+    if (itr == _pages.end()) return;
+
+    // queue an unbind, keeping a reference to the page's memory until the unbind has completed
+    PendingPage pending;
+    pending.image = image;
+    pending.memory = itr->second.memory;
+    pending.bind.subresource = {VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, arrayLayer};
+    pending.bind.offset = alignedOffset;
+    pending.bind.extent = VkExtent3D{
+        std::min(granularity.width, std::max(image->extent.width >> mipLevel, 1u) - static_cast<uint32_t>(alignedOffset.x)),
+        std::min(granularity.height, std::max(image->extent.height >> mipLevel, 1u) - static_cast<uint32_t>(alignedOffset.y)),
+        std::min(granularity.depth, std::max(image->extent.depth >> mipLevel, 1u) - static_cast<uint32_t>(alignedOffset.z))};
+    pending.bind.memory = VK_NULL_HANDLE;
+    pending.bind.memoryOffset = 0;
+    pending.bind.flags = 0;
+
+    _pendingUnbinds.push_back(pending);
+
+    _residentMemory -= itr->second.size;
+    _pages.erase(itr);
+}
+
+VkResult SparseImageManager::flush(Context& context)
+{
+    std::vector<PendingPage> binds, unbinds, uploads;
+    {
+        std::scoped_lock lock(_mutex);
+        binds.swap(_pendingBinds);
+        unbinds.swap(_pendingUnbinds);
+        uploads.swap(_pendingUploads);
+    }
+
+    if (binds.empty() && unbinds.empty() && uploads.empty()) return VK_SUCCESS;
+
+    auto deviceID = device->deviceID;
+    VkResult result = VK_SUCCESS;
+
+    if (!binds.empty() || !unbinds.empty())
+    {
+        if (!sparseBindingQueue)
+        {
+            warn("SparseImageManager::flush() cannot apply page binds without a sparseBindingQueue.");
+            return VK_ERROR_FEATURE_NOT_PRESENT;
+        }
+
+        // group the binds/unbinds by image so each image gets a single VkSparseImageMemoryBindInfo entry
+        std::map<VkImage, std::vector<VkSparseImageMemoryBind>> bindsPerImage;
+        for (const auto& pending : binds) bindsPerImage[pending.image->vk(deviceID)].push_back(pending.bind);
+        for (const auto& pending : unbinds) bindsPerImage[pending.image->vk(deviceID)].push_back(pending.bind);
+
+        std::vector<VkSparseImageMemoryBindInfo> imageBindInfos;
+        imageBindInfos.reserve(bindsPerImage.size());
+        for (const auto& [vkImage, pageBinds] : bindsPerImage)
+        {
+            VkSparseImageMemoryBindInfo bindInfo = {};
+            bindInfo.image = vkImage;
+            bindInfo.bindCount = static_cast<uint32_t>(pageBinds.size());
+            bindInfo.pBinds = pageBinds.data();
+            imageBindInfos.push_back(bindInfo);
+        }
+
+        VkBindSparseInfo bindSparseInfo = {};
+        bindSparseInfo.sType = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        bindSparseInfo.imageBindCount = static_cast<uint32_t>(imageBindInfos.size());
+        bindSparseInfo.pImageBinds = imageBindInfos.data();
+
+        auto fence = syncObjectPool->acquireFence();
+
+        result = sparseBindingQueue->bindSparse(bindSparseInfo, fence);
+        if (result == VK_SUCCESS)
+        {
+            // wait for the binds to complete so that the unbound pages' memory can be released
+            // and uploads into the newly bound pages can be safely recorded
+            uint64_t timeout = 1000000000;
+            VkResult waitResult;
+            while ((waitResult = fence->wait(timeout)) == VK_TIMEOUT)
+            {
+                info("SparseImageManager::flush() ", this, " fence->wait() timed out, trying again.");
+            }
+            if (waitResult != VK_SUCCESS) result = waitResult;
+        }
+        else
+        {
+            warn("SparseImageManager::flush() vkQueueBindSparse() failed. VkResult = ", result);
+        }
+
+        syncObjectPool->recycle(fence);
+    }
+
+    // the unbinds have completed so the memory held by the unbind entries is released as they go out of scope
+
+    // schedule the upload of the newly bound pages' data
+    for (auto& pending : binds)
+    {
+        if (pending.data) uploads.push_back(pending);
+    }
+
+    if (uploads.empty() || result != VK_SUCCESS) return result;
+
+    auto copyCommand = CopySparseImagePages::create();
+
+    for (auto& pending : uploads)
+    {
+        VkDeviceSize size = pending.data->dataSize();
+
+        auto stagingBufferInfo = context.stagingMemoryBufferPools->reserveBuffer(size, 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+        ref_ptr<Buffer> stagingBuffer(stagingBufferInfo->buffer);
+        ref_ptr<DeviceMemory> stagingMemory(stagingBuffer->getDeviceMemory(deviceID));
+        if (!stagingMemory) continue;
+
+        void* buffer_data = nullptr;
+        stagingMemory->map(stagingBuffer->getMemoryOffset(deviceID) + stagingBufferInfo->offset, size, 0, &buffer_data);
+        std::memcpy(buffer_data, pending.data->constDataPointer(), size);
+        stagingMemory->unmap();
+
+        CopySparseImagePages::CopyData cd;
+        cd.image = pending.image;
+        cd.source = stagingBufferInfo;
+        cd.region.bufferOffset = stagingBufferInfo->offset;
+        cd.region.bufferRowLength = 0; // page data is tightly packed
+        cd.region.bufferImageHeight = 0;
+        cd.region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, pending.bind.subresource.mipLevel, pending.bind.subresource.arrayLayer, 1};
+        cd.region.imageOffset = pending.bind.offset;
+        cd.region.imageExtent = pending.bind.extent;
+
+        // the first upload into a subresource transitions it out of VK_IMAGE_LAYOUT_UNDEFINED
+        auto subresourceKey = std::make_tuple(pending.image->vk(deviceID), pending.bind.subresource.mipLevel, pending.bind.subresource.arrayLayer);
+        {
+            std::scoped_lock lock(_mutex);
+            if (_initializedSubresources.insert(subresourceKey).second)
+                cd.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            else
+                cd.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        }
+
+        copyCommand->copies.push_back(cd);
+    }
+
+    if (!copyCommand->copies.empty()) context.commands.push_back(copyCommand);
+
+    return result;
+}
@@ -218,6 +218,27 @@ Swapchain::Swapchain(PhysicalDevice* physicalDevice, Device* device, Surface* su
 
     createInfo.pNext = nullptr;
 
+#if defined(VK_EXT_swapchain_maintenance1)
+    // when a set of compatible present modes is provided chain it into the swapchain creation so the
+    // present mode can later be switched at runtime via Swapchain::setPresentMode() without recreation.
+    // Requires the VK_EXT_swapchain_maintenance1 device extension to be enabled by the application.
+    VkSwapchainPresentModesCreateInfoEXT presentModesCreateInfo = {};
+    if (!preferences.compatiblePresentModes.empty())
+    {
+        if (std::find(preferences.compatiblePresentModes.begin(), preferences.compatiblePresentModes.end(), presentMode) == preferences.compatiblePresentModes.end())
+        {
+            preferences.compatiblePresentModes.push_back(presentMode);
+        }
+
+        presentModesCreateInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODES_CREATE_INFO_EXT;
+        presentModesCreateInfo.presentModeCount = static_cast<uint32_t>(preferences.compatiblePresentModes.size());
+        presentModesCreateInfo.pPresentModes = preferences.compatiblePresentModes.data();
+        createInfo.pNext = &presentModesCreateInfo;
+
+        _compatiblePresentModes = preferences.compatiblePresentModes;
+    }
+#endif
+
     VkSwapchainKHR swapchain;
     VkResult result = vkCreateSwapchainKHR(*device, &createInfo, _device->getAllocationCallbacks(), &swapchain);
     if (result != VK_SUCCESS)
@@ -231,6 +252,7 @@ Swapchain::Swapchain(PhysicalDevice* physicalDevice, Device* device, Surface* su
 
     _format = surfaceFormat.format;
     _extent = extent;
+    _presentMode = presentMode;
 
     // create the ImageViews
     vkGetSwapchainImagesKHR(*device, swapchain, &imageCount, nullptr);
@@ -270,3 +292,17 @@ VkResult Swapchain::acquireNextImage(uint64_t timeout, ref_ptr<Semaphore> semaph
     VkFence vk_fence = fence ? fence->vk() : VK_NULL_HANDLE;
     return vkAcquireNextImageKHR(*_device, _swapchain, timeout, vk_semaphore, vk_fence, &imageIndex);
 }
+
+bool Swapchain::setPresentMode(VkPresentModeKHR presentMode)
+{
+    if (presentMode == _presentMode) return true;
+
+    if (std::find(_compatiblePresentModes.begin(), _compatiblePresentModes.end(), presentMode) == _compatiblePresentModes.end())
+    {
+        warn("Swapchain::setPresentMode(", presentMode, ") mode is not in the swapchain's compatible present modes, ignoring.");
+        return false;
+    }
+
+    _presentMode = presentMode;
+    return true;
+}
@@ -0,0 +1,113 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Event.h>
+#include <vsg/io/Options.h>
+#include <vsg/vk/SyncObjectPool.h>
+
+using namespace vsg;
+
+SyncObjectPool::SyncObjectPool(Device* in_device) :
+    device(in_device)
+{
+}
+
+SyncObjectPool::~SyncObjectPool()
+{
+}
+
+ref_ptr<Fence> SyncObjectPool::acquireFence()
+{
+    {
+        std::scoped_lock lock(_mutex);
+        if (!_fences.empty())
+        {
+            auto fence = _fences.back();
+            _fences.pop_back();
+            return fence;
+        }
+    }
+
+    return Fence::create(device);
+}
+
+ref_ptr<Semaphore> SyncObjectPool::acquireSemaphore(VkPipelineStageFlags pipelineStageFlags)
+{
+    {
+        std::scoped_lock lock(_mutex);
+        if (!_semaphores.empty())
+        {
+            auto semaphore = _semaphores.back();
+            _semaphores.pop_back();
+            semaphore->pipelineStageFlags() = pipelineStageFlags;
+            return semaphore;
+        }
+    }
+
+    return Semaphore::create(device, pipelineStageFlags);
+}
+
+ref_ptr<Event> SyncObjectPool::acquireEvent()
+{
+    {
+        std::scoped_lock lock(_mutex);
+        if (!_events.empty())
+        {
+            auto event = _events.back();
+            _events.pop_back();
+            return event;
+        }
+    }
+
+    return Event::create(device);
+}
+
+void SyncObjectPool::recycle(ref_ptr<Fence> fence)
+{
+    if (!fence || fence->getDevice() != device) return;
+
+    // an unsignaled fence with dependencies still registered is associated with an incomplete submission,
+    // so cannot be safely reset and reused.
+    if (fence->hasDependencies() && fence->status() == VK_NOT_READY) return;
+
+    fence->resetFenceAndDependencies();
+
+    std::scoped_lock lock(_mutex);
+    _fences.push_back(fence);
+}
+
+void SyncObjectPool::recycle(ref_ptr<Semaphore> semaphore)
+{
+    if (!semaphore || semaphore->getDevice() != device) return;
+
+    // semaphores with pending submissions cannot be safely reused.
+    if (semaphore->numDependentSubmissions().load() != 0) return;
+
+    std::scoped_lock lock(_mutex);
+    _semaphores.push_back(semaphore);
+}
+
+void SyncObjectPool::recycle(ref_ptr<Event> event)
+{
+    if (!event) return;
+
+    event->reset();
+
+    std::scoped_lock lock(_mutex);
+    _events.push_back(event);
+}
+
+size_t SyncObjectPool::numAvailable() const
+{
+    std::scoped_lock lock(_mutex);
+    return _fences.size() + _semaphores.size() + _events.size();
+}
@@ -0,0 +1,69 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2026 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Exception.h>
+#include <vsg/io/Options.h>
+#include <vsg/vk/TimelineSemaphore.h>
+
+using namespace vsg;
+
+namespace
+{
+    // the VkSemaphoreTypeCreateInfo is only read during the base Semaphore constructor's vkCreateSemaphore call,
+    // so a thread local is sufficient to pass it through the member initializer list.
+    VkSemaphoreTypeCreateInfo* timelineSemaphoreTypeCreateInfo(uint64_t initialValue)
+    {
+        static thread_local VkSemaphoreTypeCreateInfo s_createInfo;
+        s_createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        s_createInfo.pNext = nullptr;
+        s_createInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        s_createInfo.initialValue = initialValue;
+        return &s_createInfo;
+    }
+} // namespace
+
+TimelineSemaphore::TimelineSemaphore(Device* device, uint64_t initialValue, VkPipelineStageFlags pipelineStageFlags) :
+    Inherit(device, pipelineStageFlags, timelineSemaphoreTypeCreateInfo(initialValue))
+{
+    if (!_device->getExtensions()->vkWaitSemaphores)
+    {
+        throw Exception{"Error: vsg::TimelineSemaphore requires VK_KHR_timeline_semaphore or Vulkan-1.2.", VK_ERROR_EXTENSION_NOT_PRESENT};
+    }
+}
+
+VkResult TimelineSemaphore::wait(uint64_t value, uint64_t timeout) const
+{
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &_semaphore;
+    waitInfo.pValues = &value;
+
+    return _device->getExtensions()->vkWaitSemaphores(*_device, &waitInfo, timeout);
+}
+
+VkResult TimelineSemaphore::signal(uint64_t value) const
+{
+    VkSemaphoreSignalInfo signalInfo = {};
+    signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+    signalInfo.semaphore = _semaphore;
+    signalInfo.value = value;
+
+    return _device->getExtensions()->vkSignalSemaphore(*_device, &signalInfo);
+}
+
+uint64_t TimelineSemaphore::counterValue() const
+{
+    uint64_t value = 0;
+    _device->getExtensions()->vkGetSemaphoreCounterValue(*_device, _semaphore, &value);
+    return value;
+}